@@ -58,6 +58,7 @@
 #include "content/public/browser/storage_partition.h"
 #include "content/public/browser/user_metrics.h"
 #include "net/base/net_errors.h"
+#include "net/base/sdch_manager.h"
 #include "net/cookies/cookie_store.h"
 #include "net/disk_cache/disk_cache.h"
 #include "net/http/http_cache.h"
@@ -272,9 +273,10 @@ void BrowsingDataRemover::RemoveImpl(int remove_mask,
           &history_task_tracker_);
     }
 
-    // Need to clear the host cache and accumulated speculative data, as it also
-    // reveals some history: we have no mechanism to track when these items were
-    // created, so we'll clear them all. Better safe than sorry.
+    // Need to clear the host cache, the certificate verification cache and
+    // accumulated speculative data, as they also reveal some history: we have
+    // no mechanism to track when these items were created, so we'll clear them
+    // all. Better safe than sorry.
     if (g_browser_process->io_thread()) {
       waiting_for_clear_hostname_resolution_cache_ = true;
       BrowserThread::PostTask(
@@ -701,6 +703,7 @@ void BrowsingDataRemover::ClearHostnameResolutionCacheOnIOThread(
   DCHECK(BrowserThread::CurrentlyOn(BrowserThread::IO));
 
   io_thread->ClearHostCache();
+  io_thread->ClearCertVerifyCache();
 
   // Notify the UI thread that we are done.
   BrowserThread::PostTask(
@@ -786,6 +789,11 @@ void BrowsingDataRemover::ClearCacheOnIOThread() {
   DCHECK(main_context_getter_.get());
   DCHECK(media_context_getter_.get());
 
+  // SDCH dictionaries are cached responses too, and are kept for all
+  // profiles.
+  if (net::SdchManager::Global())
+    net::SdchManager::Global()->ClearData();
+
   next_cache_state_ = STATE_CREATE_MAIN;
   DoClearCache(net::OK);
 }
@@ -14,6 +14,7 @@
 #include "base/debug/trace_event.h"
 #include "base/logging.h"
 #include "base/metrics/field_trial.h"
+#include "base/path_service.h"
 #include "base/prefs/pref_registry_simple.h"
 #include "base/prefs/pref_service.h"
 #include "base/stl_util.h"
@@ -28,6 +29,7 @@
 #include "chrome/browser/extensions/event_router_forwarder.h"
 #include "chrome/browser/net/async_dns_field_trial.h"
 #include "chrome/browser/net/basic_http_user_agent_settings.h"
+#include "chrome/browser/net/cert_verify_cache_persister.h"
 #include "chrome/browser/net/chrome_net_log.h"
 #include "chrome/browser/net/chrome_network_delegate.h"
 #include "chrome/browser/net/chrome_url_request_context.h"
@@ -40,6 +42,7 @@
 #include "chrome/browser/net/sdch_dictionary_fetcher.h"
 #include "chrome/browser/net/spdyproxy/http_auth_handler_spdyproxy.h"
 #include "chrome/browser/policy/policy_service.h"
+#include "chrome/common/chrome_paths.h"
 #include "chrome/common/chrome_switches.h"
 #include "chrome/common/pref_names.h"
 #include "chrome/common/url_constants.h"
@@ -49,6 +52,8 @@
 #include "net/base/network_time_notifier.h"
 #include "net/base/sdch_manager.h"
 #include "net/cert/cert_verifier.h"
+#include "net/cert/cert_verify_proc.h"
+#include "net/cert/multi_threaded_cert_verifier.h"
 #include "net/cookies/cookie_monster.h"
 #include "net/dns/host_cache.h"
 #include "net/dns/host_resolver.h"
@@ -515,7 +520,16 @@ void IOThread::InitAsync() {
   globals_->system_network_delegate.reset(network_delegate);
   globals_->host_resolver = CreateGlobalHostResolver(net_log_);
   UpdateDnsClientEnabled();
-  globals_->cert_verifier.reset(net::CertVerifier::CreateDefault());
+  net::MultiThreadedCertVerifier* cert_verifier =
+      new net::MultiThreadedCertVerifier(net::CertVerifyProc::CreateDefault());
+  globals_->cert_verifier.reset(cert_verifier);
+  base::FilePath user_data_dir;
+  if (PathService::Get(chrome::DIR_USER_DATA, &user_data_dir)) {
+    globals_->cert_verify_cache_persister.reset(
+        new CertVerifyCachePersister(cert_verifier, user_data_dir));
+  }
+  globals_->off_the_record_cert_verifier.reset(
+      net::CertVerifier::CreateDefault());
   globals_->transport_security_state.reset(new net::TransportSecurityState());
   globals_->ssl_config_service = GetSSLConfigService();
   if (command_line.HasSwitch(switches::kSpdyProxyAuthOrigin)) {
@@ -620,6 +634,13 @@ void IOThread::InitAsync() {
           scoped_ptr<base::TickClock>(new base::DefaultTickClock())));
 
   sdch_manager_ = new net::SdchManager();
+  // Dictionaries fetched for off the record profiles are not persisted; see
+  // ChromeNetworkDelegate::OnCanPersistSdchDictionary().
+  if (!user_data_dir.empty()) {
+    sdch_manager_->EnablePersistence(
+        user_data_dir.Append(FILE_PATH_LITERAL("SDCH Dictionaries")),
+        BrowserThread::GetMessageLoopProxyForThread(BrowserThread::FILE));
+  }
 
 #if defined(OS_MACOSX) && !defined(OS_IOS)
   // Start observing Keychain events. This needs to be done on the UI thread,
@@ -873,6 +894,13 @@ void IOThread::ClearHostCache() {
     host_cache->clear();
 }
 
+void IOThread::ClearCertVerifyCache() {
+  DCHECK(BrowserThread::CurrentlyOn(BrowserThread::IO));
+
+  if (globals_->cert_verify_cache_persister.get())
+    globals_->cert_verify_cache_persister->ClearData();
+}
+
 void IOThread::InitializeNetworkSessionParams(
     net::HttpNetworkSession::Params* params) {
   params->host_resolver = globals_->host_resolver.get();
@@ -20,6 +20,7 @@
 #include "net/http/http_network_session.h"
 #include "net/socket/next_proto.h"
 
+class CertVerifyCachePersister;
 class ChromeNetLog;
 class CommandLine;
 class PrefProxyConfigTracker;
@@ -111,6 +112,11 @@ class IOThread : public content::BrowserThreadDelegate {
     scoped_ptr<net::NetworkDelegate> system_network_delegate;
     scoped_ptr<net::HostResolver> host_resolver;
     scoped_ptr<net::CertVerifier> cert_verifier;
+    // Persists the results cached by |cert_verifier| across restarts.
+    scoped_ptr<CertVerifyCachePersister> cert_verify_cache_persister;
+    // Used by off the record profiles, so that the certificates they verify
+    // are not persisted.
+    scoped_ptr<net::CertVerifier> off_the_record_cert_verifier;
     // The ServerBoundCertService must outlive the HttpTransactionFactory.
     scoped_ptr<net::ServerBoundCertService> system_server_bound_cert_service;
     // This TransportSecurityState doesn't load or save any state. It's only
@@ -205,6 +211,11 @@ class IOThread : public content::BrowserThreadDelegate {
   // called on the IO thread.
   void ClearHostCache();
 
+  // Clears the cached certificate verification results, in memory and on
+  // disk, as they reveal recently visited sites too.  Must be called on the
+  // IO thread.
+  void ClearCertVerifyCache();
+
   void InitializeNetworkSessionParams(net::HttpNetworkSession::Params* params);
 
  private:
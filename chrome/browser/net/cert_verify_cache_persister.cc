@@ -0,0 +1,95 @@
+// Copyright 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "chrome/browser/net/cert_verify_cache_persister.h"
+
+#include "base/bind.h"
+#include "base/file_util.h"
+#include "base/pickle.h"
+#include "content/public/browser/browser_thread.h"
+
+using content::BrowserThread;
+
+namespace {
+
+const base::FilePath::CharType kCertVerifyCacheFilename[] =
+    FILE_PATH_LITERAL("Certificate Verification Cache");
+
+// Returns the contents of the file at |path|, or an empty string if it
+// cannot be read.
+std::string LoadFile(const base::FilePath& path) {
+  DCHECK(BrowserThread::CurrentlyOn(BrowserThread::FILE));
+  std::string data;
+  if (!file_util::ReadFileToString(path, &data))
+    data.clear();
+  return data;
+}
+
+}  // namespace
+
+CertVerifyCachePersister::CertVerifyCachePersister(
+    net::MultiThreadedCertVerifier* verifier,
+    const base::FilePath& user_data_dir)
+    : verifier_(verifier),
+      writer_(user_data_dir.Append(kCertVerifyCacheFilename),
+              BrowserThread::GetMessageLoopProxyForThread(BrowserThread::FILE)
+                  .get()),
+      weak_ptr_factory_(this) {
+  DCHECK(BrowserThread::CurrentlyOn(BrowserThread::IO));
+
+  verifier_->SetDelegate(this);
+
+  BrowserThread::PostTaskAndReplyWithResult(
+      BrowserThread::FILE, FROM_HERE,
+      base::Bind(&LoadFile, writer_.path()),
+      base::Bind(&CertVerifyCachePersister::CompleteLoad,
+                 weak_ptr_factory_.GetWeakPtr()));
+}
+
+CertVerifyCachePersister::~CertVerifyCachePersister() {
+  DCHECK(BrowserThread::CurrentlyOn(BrowserThread::IO));
+
+  if (writer_.HasPendingWrite())
+    writer_.DoScheduledWrite();
+
+  verifier_->SetDelegate(NULL);
+}
+
+void CertVerifyCachePersister::ClearData() {
+  DCHECK(BrowserThread::CurrentlyOn(BrowserThread::IO));
+
+  weak_ptr_factory_.InvalidateWeakPtrs();
+  verifier_->ClearCache();
+
+  std::string data;
+  SerializeData(&data);
+  writer_.WriteNow(data);
+}
+
+void CertVerifyCachePersister::CacheIsDirty(
+    net::MultiThreadedCertVerifier* verifier) {
+  DCHECK(BrowserThread::CurrentlyOn(BrowserThread::IO));
+  DCHECK_EQ(verifier_, verifier);
+
+  writer_.ScheduleWrite(this);
+}
+
+bool CertVerifyCachePersister::SerializeData(std::string* output) {
+  DCHECK(BrowserThread::CurrentlyOn(BrowserThread::IO));
+
+  Pickle pickle;
+  verifier_->PersistCache(&pickle);
+  output->assign(static_cast<const char*>(pickle.data()), pickle.size());
+  return true;
+}
+
+void CertVerifyCachePersister::CompleteLoad(const std::string& data) {
+  DCHECK(BrowserThread::CurrentlyOn(BrowserThread::IO));
+
+  if (data.empty())
+    return;
+  Pickle pickle(data.data(), static_cast<int>(data.size()));
+  if (!verifier_->LoadCache(pickle))
+    LOG(WARNING) << "Failed to load the certificate verification cache";
+}
@@ -0,0 +1,61 @@
+// Copyright 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef CHROME_BROWSER_NET_CERT_VERIFY_CACHE_PERSISTER_H_
+#define CHROME_BROWSER_NET_CERT_VERIFY_CACHE_PERSISTER_H_
+
+#include <string>
+
+#include "base/files/file_path.h"
+#include "base/files/important_file_writer.h"
+#include "base/memory/weak_ptr.h"
+#include "net/cert/multi_threaded_cert_verifier.h"
+
+// Reads and updates the on-disk copy of the certificate verification results
+// cached by a MultiThreadedCertVerifier, so that the first connections after
+// a restart do not wait for chain building and revocation checks.
+//
+// The results are loaded on the file thread after startup, without delaying
+// verifications meanwhile, and written when the cache changes, at most once
+// per commit interval of the ImportantFileWriter.
+//
+// Must be created, used and destroyed only on the IO thread.
+class CertVerifyCachePersister
+    : public net::MultiThreadedCertVerifier::Delegate,
+      public base::ImportantFileWriter::DataSerializer {
+ public:
+  // |verifier| must outlive the persister. The results are stored in a file
+  // of |user_data_dir|, as the verifier is shared by the profiles.
+  CertVerifyCachePersister(net::MultiThreadedCertVerifier* verifier,
+                           const base::FilePath& user_data_dir);
+  virtual ~CertVerifyCachePersister();
+
+  // Removes the cached results from the verifier and from disk, and drops a
+  // load that is still in progress. The file lists the hosts that were
+  // visited, so it is cleared along with the browsing history.
+  void ClearData();
+
+  // net::MultiThreadedCertVerifier::Delegate:
+  virtual void CacheIsDirty(net::MultiThreadedCertVerifier* verifier) OVERRIDE;
+
+  // base::ImportantFileWriter::DataSerializer:
+  //
+  // Serializes the cache of |verifier_| as a Pickle written by
+  // MultiThreadedCertVerifier::PersistCache().
+  virtual bool SerializeData(std::string* data) OVERRIDE;
+
+ private:
+  void CompleteLoad(const std::string& data);
+
+  net::MultiThreadedCertVerifier* verifier_;
+
+  // Helper for safely writing the data.
+  base::ImportantFileWriter writer_;
+
+  base::WeakPtrFactory<CertVerifyCachePersister> weak_ptr_factory_;
+
+  DISALLOW_COPY_AND_ASSIGN(CertVerifyCachePersister);
+};
+
+#endif  // CHROME_BROWSER_NET_CERT_VERIFY_CACHE_PERSISTER_H_
@@ -0,0 +1,163 @@
+// Copyright 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "chrome/browser/net/cert_verify_cache_persister.h"
+
+#include <string>
+
+#include "base/file_util.h"
+#include "base/files/file_path.h"
+#include "base/files/scoped_temp_dir.h"
+#include "base/message_loop/message_loop.h"
+#include "base/pickle.h"
+#include "content/public/test/test_browser_thread.h"
+#include "net/base/net_errors.h"
+#include "net/base/net_log.h"
+#include "net/base/test_completion_callback.h"
+#include "net/base/test_data_directory.h"
+#include "net/cert/cert_verify_proc.h"
+#include "net/cert/cert_verify_result.h"
+#include "net/cert/multi_threaded_cert_verifier.h"
+#include "net/cert/x509_certificate.h"
+#include "net/test/cert_test_util.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace {
+
+const char kHostname[] = "www.example.com";
+
+class MockCertVerifyProc : public net::CertVerifyProc {
+ public:
+  MockCertVerifyProc() {}
+
+ private:
+  virtual ~MockCertVerifyProc() {}
+
+  // net::CertVerifyProc:
+  virtual bool SupportsAdditionalTrustAnchors() const OVERRIDE {
+    return false;
+  }
+
+  virtual int VerifyInternal(
+      net::X509Certificate* cert,
+      const std::string& hostname,
+      int flags,
+      net::CRLSet* crl_set,
+      const net::CertificateList& additional_trust_anchors,
+      net::CertVerifyResult* verify_result) OVERRIDE {
+    verify_result->Reset();
+    verify_result->verified_cert = cert;
+    return net::OK;
+  }
+};
+
+}  // namespace
+
+class CertVerifyCachePersisterTest : public testing::Test {
+ public:
+  CertVerifyCachePersisterTest()
+      : message_loop_(base::MessageLoop::TYPE_IO),
+        test_file_thread_(content::BrowserThread::FILE, &message_loop_),
+        test_io_thread_(content::BrowserThread::IO, &message_loop_),
+        verifier_(new MockCertVerifyProc()) {
+  }
+
+  virtual ~CertVerifyCachePersisterTest() {
+    persister_.reset();
+    message_loop_.RunUntilIdle();
+  }
+
+  virtual void SetUp() OVERRIDE {
+    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
+    cert_ = net::ImportCertFromFile(net::GetTestCertsDirectory(),
+                                    "ok_cert.pem");
+    ASSERT_TRUE(cert_.get());
+  }
+
+ protected:
+  // Verifies |cert_| with |verifier|, and returns true if the result came
+  // from the cache.
+  bool VerifyFromCache(net::MultiThreadedCertVerifier* verifier) {
+    net::CertVerifyResult verify_result;
+    net::TestCompletionCallback callback;
+    net::CertVerifier::RequestHandle request_handle;
+    int rv = verifier->Verify(cert_.get(), kHostname, 0, NULL, &verify_result,
+                              callback.callback(), &request_handle,
+                              net::BoundNetLog());
+    if (rv != net::ERR_IO_PENDING) {
+      EXPECT_EQ(net::OK, rv);
+      return true;
+    }
+    EXPECT_EQ(net::OK, callback.WaitForResult());
+    return false;
+  }
+
+  // Stores a cache that holds the result for |cert_| in the file that the
+  // persister loads.
+  void WriteCacheFile() {
+    net::MultiThreadedCertVerifier verifier(new MockCertVerifyProc());
+    EXPECT_FALSE(VerifyFromCache(&verifier));
+    Pickle pickle;
+    verifier.PersistCache(&pickle);
+    int size = static_cast<int>(pickle.size());
+    ASSERT_EQ(size, file_util::WriteFile(
+        CacheFilePath(), static_cast<const char*>(pickle.data()), size));
+  }
+
+  base::FilePath CacheFilePath() const {
+    return temp_dir_.path().Append(
+        FILE_PATH_LITERAL("Certificate Verification Cache"));
+  }
+
+  // Ordering is important here. If member variables are not destroyed in the
+  // right order, then DCHECKs will fail all over the place.
+  base::MessageLoop message_loop_;
+
+  // Needed for ImportantFileWriter, which CertVerifyCachePersister uses.
+  content::TestBrowserThread test_file_thread_;
+
+  // CertVerifyCachePersister runs on the IO thread.
+  content::TestBrowserThread test_io_thread_;
+
+  base::ScopedTempDir temp_dir_;
+  scoped_refptr<net::X509Certificate> cert_;
+  net::MultiThreadedCertVerifier verifier_;
+  scoped_ptr<CertVerifyCachePersister> persister_;
+};
+
+TEST_F(CertVerifyCachePersisterTest, LoadCache) {
+  WriteCacheFile();
+
+  persister_.reset(new CertVerifyCachePersister(&verifier_, temp_dir_.path()));
+  message_loop_.RunUntilIdle();
+  EXPECT_TRUE(VerifyFromCache(&verifier_));
+}
+
+TEST_F(CertVerifyCachePersisterTest, ClearData) {
+  WriteCacheFile();
+
+  persister_.reset(new CertVerifyCachePersister(&verifier_, temp_dir_.path()));
+  message_loop_.RunUntilIdle();
+  persister_->ClearData();
+  message_loop_.RunUntilIdle();
+
+  // The results are gone from memory and from disk.
+  EXPECT_FALSE(VerifyFromCache(&verifier_));
+  std::string data;
+  ASSERT_TRUE(file_util::ReadFileToString(CacheFilePath(), &data));
+  Pickle pickle(data.data(), static_cast<int>(data.size()));
+  net::MultiThreadedCertVerifier verifier(new MockCertVerifyProc());
+  EXPECT_TRUE(verifier.LoadCache(pickle));
+  EXPECT_FALSE(VerifyFromCache(&verifier));
+}
+
+TEST_F(CertVerifyCachePersisterTest, ClearDataWhileLoading) {
+  WriteCacheFile();
+
+  // The load that is still in progress must not bring the results back.
+  persister_.reset(new CertVerifyCachePersister(&verifier_, temp_dir_.path()));
+  persister_->ClearData();
+  message_loop_.RunUntilIdle();
+  EXPECT_FALSE(VerifyFromCache(&verifier_));
+}
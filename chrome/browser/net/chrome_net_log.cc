@@ -15,6 +15,7 @@
 #include "chrome/browser/ui/webui/net_internals/net_internals_ui.h"
 #include "chrome/common/chrome_switches.h"
 #include "content/public/common/content_switches.h"
+#include "net/base/net_log_binary_logger.h"
 #include "net/base/net_log_logger.h"
 
 ChromeNetLog::ChromeNetLog()
@@ -43,11 +44,15 @@ ChromeNetLog::ChromeNetLog()
     // would result in an unbounded buffer size, so not much can be gained by
     // doing this on another thread.  It's only used when debugging Chrome, so
     // performance is not a big concern.
+    //
+    // With --net-log-binary, events are instead written by a thread of the
+    // logger, from per-thread ring buffers.
+    bool binary = command_line->HasSwitch(switches::kNetLogBinary);
     FILE* file = NULL;
 #if defined(OS_WIN)
-    file = _wfopen(log_path.value().c_str(), L"w");
+    file = _wfopen(log_path.value().c_str(), binary ? L"wb" : L"w");
 #elif defined(OS_POSIX)
-    file = fopen(log_path.value().c_str(), "w");
+    file = fopen(log_path.value().c_str(), binary ? "wb" : "w");
 #endif
 
     if (file == NULL) {
@@ -55,8 +60,14 @@ ChromeNetLog::ChromeNetLog()
                  << " for net logging";
     } else {
       scoped_ptr<base::Value> constants(NetInternalsUI::GetConstants());
-      net_log_logger_.reset(new net::NetLogLogger(file, *constants));
-      net_log_logger_->StartObserving(this);
+      if (binary) {
+        net_log_binary_logger_.reset(
+            new net::NetLogBinaryLogger(file, *constants));
+        net_log_binary_logger_->StartObserving(this, LOG_ALL_BUT_BYTES);
+      } else {
+        net_log_logger_.reset(new net::NetLogLogger(file, *constants));
+        net_log_logger_->StartObserving(this);
+      }
     }
   }
 }
@@ -66,5 +77,7 @@ ChromeNetLog::~ChromeNetLog() {
   // Remove the observers we own before we're destroyed.
   if (net_log_logger_)
     RemoveThreadSafeObserver(net_log_logger_.get());
+  if (net_log_binary_logger_)
+    net_log_binary_logger_->StopObserving();
 }
 
@@ -12,6 +12,7 @@
 #include "net/base/net_log.h"
 
 namespace net {
+class NetLogBinaryLogger;
 class NetLogLogger;
 }
 
@@ -30,6 +31,7 @@ class ChromeNetLog : public net::NetLog {
 
  private:
   scoped_ptr<net::NetLogLogger> net_log_logger_;
+  scoped_ptr<net::NetLogBinaryLogger> net_log_binary_logger_;
   scoped_ptr<NetLogTempFile> net_log_temp_file_;
 
   DISALLOW_COPY_AND_ASSIGN(ChromeNetLog);
@@ -90,6 +90,12 @@ class ChromeNetworkDelegate : public net::NetworkDelegate {
     force_google_safe_search_ = force_google_safe_search;
   }
 
+  // If |incognito| is true, SDCH dictionaries fetched for requests observed
+  // by this delegate are never written to disk.
+  void set_incognito(bool incognito) {
+    incognito_ = incognito;
+  }
+
   // Causes |OnCanThrottleRequest| to always return false, for all
   // instances of this object.
   static void NeverThrottleRequests();
@@ -160,6 +166,8 @@ class ChromeNetworkDelegate : public net::NetworkDelegate {
   virtual bool OnCanEnablePrivacyMode(
       const GURL& url,
       const GURL& first_party_for_cookies) const OVERRIDE;
+  virtual bool OnCanPersistSdchDictionary(
+      const net::URLRequest& request) const OVERRIDE;
   virtual int OnBeforeSocketStreamConnect(
       net::SocketStream* stream,
       const net::CompletionCallback& callback) OVERRIDE;
@@ -186,6 +194,9 @@ class ChromeNetworkDelegate : public net::NetworkDelegate {
   // Weak, owned by our owner.
   const policy::URLBlacklistManager* url_blacklist_manager_;
 
+  // True if the requests observed belong to an off the record profile.
+  bool incognito_;
+
   // When true, allow access to all file:// URLs.
   static bool g_allow_file_access_;
 
@@ -6,6 +6,8 @@
 
 #include "chrome/browser/net/predictor.h"
 #include "net/base/load_flags.h"
+#include "net/base/load_timing_info.h"
+#include "net/base/net_log.h"
 #include "net/url_request/url_request.h"
 
 namespace chrome_browser_net {
@@ -83,4 +85,24 @@ void ConnectInterceptor::WitnessURLRequest(net::URLRequest* request) {
   return;
 }
 
+void ConnectInterceptor::WitnessURLResponse(net::URLRequest* request) {
+  // Cache hits, and requests sent on a kept-alive or SPDY connection, did not
+  // need a new connection.
+  if (request->was_cached())
+    return;
+  net::LoadTimingInfo load_timing_info;
+  request->GetLoadTimingInfo(&load_timing_info);
+  if (load_timing_info.socket_log_id == net::NetLog::Source::kInvalidId ||
+      load_timing_info.socket_reused) {
+    return;
+  }
+
+  GURL request_scheme_host(Predictor::CanonicalizeUrl(request->url()));
+  if (request_scheme_host == GURL::EmptyGURL())
+    return;
+
+  // Let the predictor know whether its preconnections are being used.
+  predictor_->RecordConnectionNeeded(request_scheme_host);
+}
+
 }  // namespace chrome_browser_net
@@ -32,6 +32,10 @@ class ConnectInterceptor {
   // Learn about referrers, and optionally preconnect based on history.
   void WitnessURLRequest(net::URLRequest* request);
 
+  // Let the predictor know whether the response to |request| needed a
+  // connection of its own, which a preconnected socket could have provided.
+  void WitnessURLResponse(net::URLRequest* request);
+
  private:
   // Provide access to local class TimedCache for testing.
   FRIEND_TEST_ALL_PREFIXES(ConnectInterceptorTest, TimedCacheRecall);
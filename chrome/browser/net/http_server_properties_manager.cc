@@ -249,6 +249,21 @@ HttpServerPropertiesManager::GetPipelineCapabilityMap() const {
   return http_server_properties_impl_->GetPipelineCapabilityMap();
 }
 
+net::AddressFamily HttpServerPropertiesManager::GetPreferredAddressFamily(
+    const net::HostPortPair& server) {
+  DCHECK(BrowserThread::CurrentlyOn(BrowserThread::IO));
+  return http_server_properties_impl_->GetPreferredAddressFamily(server);
+}
+
+void HttpServerPropertiesManager::SetPreferredAddressFamily(
+    const net::HostPortPair& server,
+    net::AddressFamily address_family) {
+  DCHECK(BrowserThread::CurrentlyOn(BrowserThread::IO));
+  // The preference is kept in memory only, so there is nothing to persist.
+  http_server_properties_impl_->SetPreferredAddressFamily(server,
+                                                          address_family);
+}
+
 //
 // Update the HttpServerPropertiesImpl's cache with data from preferences.
 //
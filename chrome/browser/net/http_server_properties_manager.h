@@ -152,6 +152,13 @@ class HttpServerPropertiesManager
 
   virtual net::PipelineCapabilityMap GetPipelineCapabilityMap() const OVERRIDE;
 
+  virtual net::AddressFamily GetPreferredAddressFamily(
+      const net::HostPortPair& server) OVERRIDE;
+
+  virtual void SetPreferredAddressFamily(
+      const net::HostPortPair& server,
+      net::AddressFamily address_family) OVERRIDE;
+
  protected:
   // --------------------
   // SPDY related methods
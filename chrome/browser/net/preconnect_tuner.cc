@@ -0,0 +1,203 @@
+// Copyright 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "chrome/browser/net/preconnect_tuner.h"
+
+#include <math.h>
+
+#include <algorithm>
+
+#include "base/logging.h"
+#include "base/metrics/histogram.h"
+
+namespace chrome_browser_net {
+
+namespace {
+
+// The share of preconnected sockets we accept to waste.  The threshold rises
+// by (1 - kTargetWastedRatio) * kThresholdStep for each wasted socket and
+// falls by kTargetWastedRatio * kThresholdStep for each used one, so that it
+// settles where this share of the sockets is wasted.
+const double kTargetWastedRatio = 0.33;
+const double kThresholdStep = 0.05;
+
+// Bounds of the preconnect threshold.  The lower one stays above the
+// expectation at which the Predictor merely preresolves hosts.
+const double kMinPreconnectThreshold = 0.3;
+const double kMaxPreconnectThreshold = 4.0;
+
+// The number of hosts whose demand over the day is remembered.
+const size_t kMaxHostDemands = 200;
+
+// Each time a host is needed, its past demand is scaled down by this factor,
+// so that the time of day pattern follows changing habits.  The demand for
+// all hosts together is scaled down each time any host is needed.
+const double kHostDemandDecay = 0.99;
+const double kTotalDemandDecay = 0.999;
+
+// The time of day factor is only applied once a host was needed about this
+// many times.
+const double kMinDemandForTimeOfDay = 10.0;
+
+// Bounds of the time of day factor.  A host is not given up on entirely just
+// because it was never needed at this time of day.
+const double kMinTimeOfDayFactor = 0.5;
+const double kMaxTimeOfDayFactor = 2.0;
+
+}  // namespace
+
+// static
+const int PreconnectTuner::kTimeOfDaySlots;
+
+PreconnectTuner::WarmSocket::WarmSocket(const GURL& url,
+                                        base::Time preconnect_time)
+    : url(url),
+      preconnect_time(preconnect_time) {
+}
+
+PreconnectTuner::HostDemand::HostDemand() {
+  std::fill(connections, connections + kTimeOfDaySlots, 0.0);
+}
+
+void PreconnectTuner::HostDemand::Add(int slot, double decay) {
+  for (int i = 0; i < kTimeOfDaySlots; ++i)
+    connections[i] *= decay;
+  connections[slot] += 1.0;
+}
+
+double PreconnectTuner::HostDemand::Total() const {
+  double total = 0.0;
+  for (int i = 0; i < kTimeOfDaySlots; ++i)
+    total += connections[i];
+  return total;
+}
+
+PreconnectTuner::PreconnectTuner(double initial_threshold,
+                                 int max_warm_sockets,
+                                 base::TimeDelta unused_socket_lifetime)
+    : preconnect_threshold_(initial_threshold),
+      max_warm_sockets_(max_warm_sockets),
+      unused_socket_lifetime_(unused_socket_lifetime),
+      host_demand_(kMaxHostDemands),
+      used_count_(0),
+      wasted_count_(0) {
+  DCHECK_GT(max_warm_sockets_, 0);
+}
+
+PreconnectTuner::~PreconnectTuner() {}
+
+int PreconnectTuner::GetPreconnectCount(const GURL& url,
+                                        double expected_connections,
+                                        int extra_sockets,
+                                        base::Time now) {
+  ExpireWarmSockets(now);
+
+  // The time of day only decides whether to preconnect.  The number of
+  // sockets follows the Referrer, which already tracks recent page loads.
+  if (expected_connections * GetTimeOfDayFactor(url, now) <=
+      preconnect_threshold_) {
+    return 0;
+  }
+
+  const int budget = max_warm_sockets_ - warm_socket_count();
+  if (budget <= 0)
+    return 0;
+  return std::min(static_cast<int>(ceil(expected_connections)) + extra_sockets,
+                  budget);
+}
+
+void PreconnectTuner::OnPreconnect(const GURL& url,
+                                   int count,
+                                   int extra_sockets,
+                                   base::Time now) {
+  ExpireWarmSockets(now);
+  const int new_sockets = count - extra_sockets - WarmSocketCountForUrl(url);
+  for (int i = 0; i < new_sockets; ++i)
+    warm_sockets_.push_back(WarmSocket(url, now));
+}
+
+void PreconnectTuner::OnConnectionNeeded(const GURL& url, base::Time now) {
+  ExpireWarmSockets(now);
+
+  const int slot = GetTimeOfDaySlot(now);
+  HostDemandCache::iterator demand = host_demand_.Get(url);
+  if (demand == host_demand_.end())
+    demand = host_demand_.Put(url, HostDemand());
+  demand->second.Add(slot, kHostDemandDecay);
+  total_demand_.Add(slot, kTotalDemandDecay);
+
+  for (std::list<WarmSocket>::iterator it = warm_sockets_.begin();
+       it != warm_sockets_.end(); ++it) {
+    if (it->url == url) {
+      warm_sockets_.erase(it);
+      RecordOutcome(true);
+      return;
+    }
+  }
+}
+
+double PreconnectTuner::GetTimeOfDayFactor(const GURL& url,
+                                           base::Time now) {
+  HostDemandCache::iterator demand = host_demand_.Peek(url);
+  if (demand == host_demand_.end())
+    return 1.0;
+
+  const HostDemand& host = demand->second;
+  const double host_total = host.Total();
+  if (host_total < kMinDemandForTimeOfDay)
+    return 1.0;
+
+  // Compare the share of the host's demand falling in this slot with the
+  // share of all demand falling in it, so that hosts are not favored merely
+  // for being needed at the times the browser is used.
+  const int slot = GetTimeOfDaySlot(now);
+  const double total_share =
+      total_demand_.connections[slot] / total_demand_.Total();
+  if (total_share <= 0.0)
+    return kMinTimeOfDayFactor;
+  const double factor = host.connections[slot] / host_total / total_share;
+  return std::max(kMinTimeOfDayFactor, std::min(kMaxTimeOfDayFactor, factor));
+}
+
+void PreconnectTuner::ExpireWarmSockets(base::Time now) {
+  while (!warm_sockets_.empty() &&
+         now - warm_sockets_.front().preconnect_time >=
+             unused_socket_lifetime_) {
+    warm_sockets_.pop_front();
+    RecordOutcome(false);
+  }
+}
+
+int PreconnectTuner::WarmSocketCountForUrl(const GURL& url) const {
+  int count = 0;
+  for (std::list<WarmSocket>::const_iterator it = warm_sockets_.begin();
+       it != warm_sockets_.end(); ++it) {
+    if (it->url == url)
+      ++count;
+  }
+  return count;
+}
+
+// static
+int PreconnectTuner::GetTimeOfDaySlot(base::Time time) {
+  base::Time::Exploded exploded;
+  time.LocalExplode(&exploded);
+  return exploded.hour * kTimeOfDaySlots / 24;
+}
+
+void PreconnectTuner::RecordOutcome(bool used) {
+  UMA_HISTOGRAM_BOOLEAN("Net.PreconnectedSocketUsed", used);
+  if (used) {
+    ++used_count_;
+    preconnect_threshold_ -= kThresholdStep * kTargetWastedRatio;
+  } else {
+    ++wasted_count_;
+    preconnect_threshold_ += kThresholdStep * (1 - kTargetWastedRatio);
+  }
+  preconnect_threshold_ = std::max(
+      kMinPreconnectThreshold,
+      std::min(kMaxPreconnectThreshold, preconnect_threshold_));
+}
+
+}  // namespace chrome_browser_net
@@ -0,0 +1,138 @@
+// Copyright 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// The PreconnectTuner decides how many sockets the Predictor preconnects to a
+// subresource host, and learns from how many of them end up being used.
+//
+// A preconnected socket is counted as used when a connection to its host is
+// needed before the socket would be dropped as an unused idle socket, and as
+// wasted otherwise.  The share of wasted sockets moves the expected number of
+// connections a host must need before preconnecting to it is worthwhile: up
+// when too many sockets are wasted, down when nearly all of them are used.
+// The expectation learned by the Referrer is also weighted by how much the
+// host is needed at the current time of day, and the number of sockets kept
+// warm at any time is bounded by a budget.
+//
+// All access to this class is performed via the Predictor class, which only
+// operates on the IO thread.
+
+#ifndef CHROME_BROWSER_NET_PRECONNECT_TUNER_H_
+#define CHROME_BROWSER_NET_PRECONNECT_TUNER_H_
+
+#include <list>
+
+#include "base/basictypes.h"
+#include "base/containers/mru_cache.h"
+#include "base/time/time.h"
+#include "url/gurl.h"
+
+namespace chrome_browser_net {
+
+class PreconnectTuner {
+ public:
+  // The day is split into this many slots to track when hosts are needed.
+  static const int kTimeOfDaySlots = 6;
+
+  // |initial_threshold| is the expected number of connections above which a
+  // host is preconnected to, until outcomes are observed.  At most
+  // |max_warm_sockets| preconnected sockets are expected to be unused at any
+  // time; sockets unused after |unused_socket_lifetime| are counted as wasted.
+  PreconnectTuner(double initial_threshold,
+                  int max_warm_sockets,
+                  base::TimeDelta unused_socket_lifetime);
+  ~PreconnectTuner();
+
+  // Returns the number of sockets worth preconnecting to |url| at |now|, given
+  // that the Referrer expects |expected_connections| connections to it, plus
+  // |extra_sockets| needed besides those.  Returns 0 when preconnecting is not
+  // worthwhile, or there is no budget left.  The count never exceeds the
+  // budget, |extra_sockets| included.
+  int GetPreconnectCount(const GURL& url,
+                         double expected_connections,
+                         int extra_sockets,
+                         base::Time now);
+
+  // Records that sockets were preconnected to |url| so that |count| sockets
+  // are open to it, |extra_sockets| of which were in use already.  The socket
+  // pool only opens the sockets missing from |count|, so the sockets still
+  // warm from an earlier preconnect to |url| are not counted again.
+  void OnPreconnect(const GURL& url,
+                    int count,
+                    int extra_sockets,
+                    base::Time now);
+
+  // Records that a request to |url| needed a connection of its own, rather
+  // than being served from the cache or on a connection already in use.  This
+  // uses up the oldest socket preconnected to |url|, if any.
+  void OnConnectionNeeded(const GURL& url, base::Time now);
+
+  // Returns the factor by which the demand for |url| at |now| differs from its
+  // average, relative to how much the browser is used at this time of day.
+  // It is 1.0 until enough demand has been observed.
+  double GetTimeOfDayFactor(const GURL& url, base::Time now);
+
+  // Counts the preconnected sockets older than |unused_socket_lifetime_| as
+  // wasted.  Done by the other methods, and exposed for testing.
+  void ExpireWarmSockets(base::Time now);
+
+  double preconnect_threshold() const { return preconnect_threshold_; }
+  int warm_socket_count() const { return warm_sockets_.size(); }
+  int64 used_count() const { return used_count_; }
+  int64 wasted_count() const { return wasted_count_; }
+
+ private:
+  // A preconnected socket which hasn't been used yet.
+  struct WarmSocket {
+    WarmSocket(const GURL& url, base::Time preconnect_time);
+
+    GURL url;
+    base::Time preconnect_time;
+  };
+
+  // Decayed count of the connections needed to a host in each time of day
+  // slot.
+  struct HostDemand {
+    HostDemand();
+
+    // Scales down the past demand by |decay| and counts a connection in
+    // |slot|.
+    void Add(int slot, double decay);
+    double Total() const;
+
+    double connections[kTimeOfDaySlots];
+  };
+
+  typedef base::MRUCache<GURL, HostDemand> HostDemandCache;
+
+  // Returns the time of day slot of |time|, in local time.
+  static int GetTimeOfDaySlot(base::Time time);
+
+  // Returns the number of sockets preconnected to |url| not used yet.
+  int WarmSocketCountForUrl(const GURL& url) const;
+
+  // Moves the threshold after a socket was used or wasted.
+  void RecordOutcome(bool used);
+
+  double preconnect_threshold_;
+  const int max_warm_sockets_;
+  const base::TimeDelta unused_socket_lifetime_;
+
+  // Preconnected sockets not used yet, oldest first.  There are rarely more
+  // than |max_warm_sockets_| of them, so they are searched linearly.
+  std::list<WarmSocket> warm_sockets_;
+
+  HostDemandCache host_demand_;
+
+  // The demand for all hosts together.
+  HostDemand total_demand_;
+
+  int64 used_count_;
+  int64 wasted_count_;
+
+  DISALLOW_COPY_AND_ASSIGN(PreconnectTuner);
+};
+
+}  // namespace chrome_browser_net
+
+#endif  // CHROME_BROWSER_NET_PRECONNECT_TUNER_H_
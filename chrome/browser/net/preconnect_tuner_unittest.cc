@@ -0,0 +1,492 @@
+// Copyright 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "chrome/browser/net/preconnect_tuner.h"
+
+#include <math.h>
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "base/logging.h"
+#include "base/memory/scoped_vector.h"
+#include "base/message_loop/message_loop.h"
+#include "base/time/time.h"
+#include "chrome/browser/net/referrer.h"
+#include "net/base/completion_callback.h"
+#include "net/base/host_port_pair.h"
+#include "net/base/net_errors.h"
+#include "net/base/net_log.h"
+#include "net/base/request_priority.h"
+#include "net/dns/mock_host_resolver.h"
+#include "net/socket/client_socket_handle.h"
+#include "net/socket/client_socket_pool_histograms.h"
+#include "net/socket/socket_test_util.h"
+#include "net/socket/transport_client_socket_pool.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+using base::Time;
+using base::TimeDelta;
+
+namespace chrome_browser_net {
+
+namespace {
+
+// The values the Predictor uses.
+const double kPreconnectWorthyExpectedValue = 0.8;
+const int kMaxWarmSockets = 16;
+const int kUnusedSocketLifetimeSeconds = 10;
+
+// Limits of the socket pool the trace is replayed through.
+const int kMaxSockets = 256;
+const int kMaxSocketsPerGroup = 6;
+
+Time LocalTime(int day_of_month, int hour) {
+  Time::Exploded exploded = {2013, 10, 0, day_of_month, hour, 0, 0, 0};
+  return Time::FromLocalExploded(exploded);
+}
+
+class PreconnectTunerTest : public testing::Test {
+ protected:
+  PreconnectTunerTest()
+      : tuner_(kPreconnectWorthyExpectedValue,
+               kMaxWarmSockets,
+               TimeDelta::FromSeconds(kUnusedSocketLifetimeSeconds)),
+        url_a_("http://a.com/"),
+        url_b_("http://b.com/"),
+        now_(LocalTime(1, 12)) {
+  }
+
+  PreconnectTuner tuner_;
+  const GURL url_a_;
+  const GURL url_b_;
+  const Time now_;
+};
+
+TEST_F(PreconnectTunerTest, CountFollowsExpectation) {
+  EXPECT_EQ(0, tuner_.GetPreconnectCount(url_a_, 0.5, 0, now_));
+  EXPECT_EQ(0, tuner_.GetPreconnectCount(url_a_, 0.8, 0, now_));
+  EXPECT_EQ(1, tuner_.GetPreconnectCount(url_a_, 0.9, 0, now_));
+  EXPECT_EQ(3, tuner_.GetPreconnectCount(url_a_, 2.4, 0, now_));
+}
+
+TEST_F(PreconnectTunerTest, UsedSocketsLowerThreshold) {
+  tuner_.OnPreconnect(url_a_, 3, 0, now_);
+  EXPECT_EQ(3, tuner_.warm_socket_count());
+
+  const Time later = now_ + TimeDelta::FromSeconds(1);
+  tuner_.OnConnectionNeeded(url_b_, later);
+  EXPECT_EQ(0, tuner_.used_count());
+  for (int i = 0; i < 4; ++i)
+    tuner_.OnConnectionNeeded(url_a_, later);
+  EXPECT_EQ(3, tuner_.used_count());
+  EXPECT_EQ(0, tuner_.wasted_count());
+  EXPECT_EQ(0, tuner_.warm_socket_count());
+  EXPECT_LT(tuner_.preconnect_threshold(), kPreconnectWorthyExpectedValue);
+}
+
+TEST_F(PreconnectTunerTest, UnusedSocketsAreWasted) {
+  tuner_.OnPreconnect(url_a_, 2, 0, now_);
+  tuner_.OnPreconnect(url_b_, 1, 0, now_ + TimeDelta::FromSeconds(5));
+
+  tuner_.ExpireWarmSockets(now_ + TimeDelta::FromSeconds(9));
+  EXPECT_EQ(0, tuner_.wasted_count());
+  tuner_.ExpireWarmSockets(
+      now_ + TimeDelta::FromSeconds(kUnusedSocketLifetimeSeconds));
+  EXPECT_EQ(2, tuner_.wasted_count());
+  EXPECT_EQ(1, tuner_.warm_socket_count());
+  EXPECT_GT(tuner_.preconnect_threshold(), kPreconnectWorthyExpectedValue);
+
+  // A connection needed after the socket expired doesn't use it.
+  tuner_.OnConnectionNeeded(url_a_, now_ + TimeDelta::FromSeconds(11));
+  EXPECT_EQ(0, tuner_.used_count());
+}
+
+TEST_F(PreconnectTunerTest, RepeatPreconnectCountsNewSockets) {
+  tuner_.OnPreconnect(url_a_, 2, 0, now_);
+
+  // Preconnecting again only adds the sockets missing from the count.
+  const Time later = now_ + TimeDelta::FromSeconds(5);
+  tuner_.OnPreconnect(url_a_, 3, 0, later);
+  EXPECT_EQ(3, tuner_.warm_socket_count());
+  tuner_.OnConnectionNeeded(url_a_, later);
+  tuner_.OnPreconnect(url_a_, 2, 0, later);
+  EXPECT_EQ(2, tuner_.warm_socket_count());
+
+  // Sockets already in use aren't preconnected either.
+  tuner_.OnPreconnect(url_b_, 2, 1, later);
+  EXPECT_EQ(3, tuner_.warm_socket_count());
+
+  tuner_.ExpireWarmSockets(later + TimeDelta::FromSeconds(
+      kUnusedSocketLifetimeSeconds));
+  EXPECT_EQ(1, tuner_.used_count());
+  EXPECT_EQ(3, tuner_.wasted_count());
+}
+
+TEST_F(PreconnectTunerTest, ThresholdSettlesOnWastedRatio) {
+  // When two out of three sockets are used, the threshold barely moves.
+  for (int i = 0; i < 30; ++i) {
+    const Time visit = now_ + TimeDelta::FromMinutes(i);
+    tuner_.OnPreconnect(url_a_, 3, 0, visit);
+    tuner_.OnConnectionNeeded(url_a_, visit);
+    tuner_.OnConnectionNeeded(url_a_, visit);
+  }
+  EXPECT_NEAR(kPreconnectWorthyExpectedValue, tuner_.preconnect_threshold(),
+              0.05);
+
+  // Wasting every socket raises it until nothing is preconnected.
+  for (int i = 30; i < 90; ++i)
+    tuner_.OnPreconnect(url_a_, 2, 0, now_ + TimeDelta::FromMinutes(i));
+  tuner_.ExpireWarmSockets(now_ + TimeDelta::FromMinutes(91));
+  EXPECT_EQ(0, tuner_.GetPreconnectCount(url_b_, 3.5, 0, now_));
+}
+
+TEST_F(PreconnectTunerTest, BudgetLimitsWarmSockets) {
+  PreconnectTuner tuner(kPreconnectWorthyExpectedValue, 4,
+                        TimeDelta::FromSeconds(kUnusedSocketLifetimeSeconds));
+  tuner.OnPreconnect(url_a_, 3, 0, now_);
+  EXPECT_EQ(1, tuner.GetPreconnectCount(url_b_, 3.0, 0, now_));
+  tuner.OnPreconnect(url_b_, 1, 0, now_);
+  EXPECT_EQ(0, tuner.GetPreconnectCount(url_b_, 3.0, 0, now_));
+
+  // Using or wasting sockets frees the budget.
+  tuner.OnConnectionNeeded(url_a_, now_);
+  EXPECT_EQ(1, tuner.GetPreconnectCount(url_b_, 3.0, 0, now_));
+  const Time later =
+      now_ + TimeDelta::FromSeconds(kUnusedSocketLifetimeSeconds);
+  EXPECT_EQ(3, tuner.GetPreconnectCount(url_b_, 3.0, 0, later));
+  EXPECT_EQ(0, tuner.warm_socket_count());
+
+  // Extra sockets count against the budget too.
+  EXPECT_EQ(4, tuner.GetPreconnectCount(url_b_, 3.0, 1, later));
+  EXPECT_EQ(4, tuner.GetPreconnectCount(url_b_, 3.5, 1, later));
+  tuner.OnPreconnect(url_a_, 3, 0, later);
+  EXPECT_EQ(1, tuner.GetPreconnectCount(url_b_, 3.0, 1, later));
+}
+
+TEST_F(PreconnectTunerTest, TimeOfDayFactor) {
+  const Time morning = LocalTime(1, 9);
+  const Time evening = LocalTime(1, 21);
+
+  // Until enough demand is known, the time of day doesn't matter.
+  for (int i = 0; i < 5; ++i) {
+    tuner_.OnConnectionNeeded(url_a_, morning);
+    tuner_.OnConnectionNeeded(url_b_, evening);
+  }
+  EXPECT_DOUBLE_EQ(1.0, tuner_.GetTimeOfDayFactor(url_a_, evening));
+  EXPECT_DOUBLE_EQ(1.0, tuner_.GetTimeOfDayFactor(GURL("http://c.com/"),
+                                                  evening));
+
+  for (int i = 0; i < 15; ++i) {
+    tuner_.OnConnectionNeeded(url_a_, morning);
+    tuner_.OnConnectionNeeded(url_b_, evening);
+  }
+  EXPECT_DOUBLE_EQ(2.0, tuner_.GetTimeOfDayFactor(url_a_, morning));
+  EXPECT_DOUBLE_EQ(0.5, tuner_.GetTimeOfDayFactor(url_a_, evening));
+  EXPECT_NEAR(2.0, tuner_.GetTimeOfDayFactor(url_b_, evening), 0.01);
+  EXPECT_EQ(1, tuner_.GetPreconnectCount(url_a_, 1.0, 0, morning));
+  EXPECT_EQ(0, tuner_.GetPreconnectCount(url_a_, 1.0, 0, evening));
+
+  // A host needed whenever the browser is used is not favored at any time.
+  for (int day = 1; day <= 200; ++day) {
+    tuner_.OnConnectionNeeded(url_a_, morning + TimeDelta::FromDays(day));
+    tuner_.OnConnectionNeeded(url_a_, evening + TimeDelta::FromDays(day));
+    tuner_.OnConnectionNeeded(url_b_, morning + TimeDelta::FromDays(day));
+    tuner_.OnConnectionNeeded(url_b_, evening + TimeDelta::FromDays(day));
+  }
+  EXPECT_NEAR(1.0, tuner_.GetTimeOfDayFactor(url_a_, morning), 0.1);
+  EXPECT_NEAR(1.0, tuner_.GetTimeOfDayFactor(url_a_, evening), 0.1);
+}
+
+// The connections the subresource hosts of a page need when it is loaded.
+typedef std::vector<std::pair<GURL, int> > SubresourceConnections;
+
+// Replays page loads the way the Predictor sees them, preconnecting learned
+// subresources through a TransportClientSocketPool over mock sockets, and
+// counts how many of the preconnected sockets are handed out to requests.
+class PreconnectTraceReplayer {
+ public:
+  // Preconnects through |tuner|, or with the fixed threshold when it is NULL.
+  explicit PreconnectTraceReplayer(PreconnectTuner* tuner)
+      : tuner_(tuner),
+        histograms_("PreconnectTraceReplay"),
+        pool_(kMaxSockets, kMaxSocketsPerGroup, &histograms_, &host_resolver_,
+              &socket_factory_, NULL),
+        preconnected_count_(0),
+        used_count_(0),
+        request_count_(0) {
+    host_resolver_.set_synchronous_mode(true);
+  }
+
+  // Loads |page| at |now|.  A load soon after the previous one finds the
+  // sockets that load preconnected and left unused in the pool.
+  void LoadPage(const GURL& page,
+                const SubresourceConnections& subresources,
+                Time now) {
+    DropUnusedIdleSockets(now);
+
+    Referrer& referrer = referrers_[page];
+    for (Referrer::iterator it = referrer.begin(); it != referrer.end();
+         ++it) {
+      const double expectation = it->second.subresource_use_rate();
+      it->second.ReferrerWasObserved();
+      int count = 0;
+      if (tuner_) {
+        count = tuner_->GetPreconnectCount(it->first, expectation, 0, now);
+      } else if (expectation > kPreconnectWorthyExpectedValue) {
+        count = static_cast<int>(ceil(expectation));
+      }
+      if (count <= 0)
+        continue;
+      count = std::min(count, kMaxSocketsPerGroup);
+      const int idle_count = pool_.IdleSocketCount();
+      AddSocketData(count);
+      pool_.RequestSockets(GroupName(it->first), &GetParams(it->first), count,
+                           net::BoundNetLog());
+      // The pool only connects the sockets missing from |count|.
+      const int new_sockets = pool_.IdleSocketCount() - idle_count;
+      if (tuner_) {
+        tuner_->ExpireWarmSockets(now);
+        const int warm_count = tuner_->warm_socket_count();
+        tuner_->OnPreconnect(it->first, count, 0, now);
+        EXPECT_EQ(new_sockets, tuner_->warm_socket_count() - warm_count);
+      }
+      preconnected_count_ += new_sockets;
+    }
+
+    // The connections of a page are open at the same time, so that each one
+    // takes its own socket.
+    ScopedVector<net::ClientSocketHandle> handles;
+    for (size_t i = 0; i < subresources.size(); ++i) {
+      const GURL& url = subresources[i].first;
+      for (int j = 0; j < subresources[i].second; ++j) {
+        referrer.SuggestHost(url);
+
+        AddSocketData(1);
+        net::ClientSocketHandle* handle = new net::ClientSocketHandle;
+        handles.push_back(handle);
+        ASSERT_EQ(net::OK,
+                  handle->Init(GroupName(url), GetParams(url), net::MEDIUM,
+                               net::CompletionCallback(), &pool_,
+                               net::BoundNetLog()));
+        ++request_count_;
+        if (handle->reuse_type() == net::ClientSocketHandle::UNUSED_IDLE)
+          ++used_count_;
+        // As the ConnectInterceptor does, only requests that did not reuse a
+        // socket count as needing a connection.
+        if (tuner_ && !handle->is_reused())
+          tuner_->OnConnectionNeeded(url, now);
+      }
+    }
+    // The sockets of the page aren't kept alive for later pages.
+    for (size_t i = 0; i < handles.size(); ++i) {
+      handles[i]->socket()->Disconnect();
+      handles[i]->Reset();
+    }
+  }
+
+  int preconnected_count() const { return preconnected_count_; }
+  int used_count() const { return used_count_; }
+  int request_count() const { return request_count_; }
+
+  double HitRate() const {
+    return preconnected_count_ ?
+        static_cast<double>(used_count_) / preconnected_count_ : 0.0;
+  }
+
+ private:
+  typedef std::map<GURL, Referrer> Referrers;
+  typedef std::map<GURL, scoped_refptr<net::TransportSocketParams> >
+      ParamsMap;
+
+  // The pool drops unused idle sockets after kUnusedSocketLifetimeSeconds,
+  // as the tuner assumes, but it does so in real time.  Drop them once the
+  // trace is past that time.
+  void DropUnusedIdleSockets(Time now) {
+    const TimeDelta lifetime =
+        TimeDelta::FromSeconds(kUnusedSocketLifetimeSeconds);
+    if (now - last_load_time_ >= lifetime) {
+      pool_.CloseIdleSockets();
+      first_load_time_ = now;
+    }
+    last_load_time_ = now;
+    // The trace never needs only some of the idle sockets to be dropped.
+    EXPECT_LT(now - first_load_time_, lifetime);
+  }
+
+  static std::string GroupName(const GURL& url) {
+    return url.host();
+  }
+
+  const scoped_refptr<net::TransportSocketParams>& GetParams(const GURL& url) {
+    scoped_refptr<net::TransportSocketParams>& params = params_[url];
+    if (!params.get()) {
+      params = new net::TransportSocketParams(
+          net::HostPortPair::FromURL(url), net::MEDIUM, false, false,
+          net::OnHostResolutionCallback());
+    }
+    return params;
+  }
+
+  // Queues data for the next |count| sockets the pool connects.
+  void AddSocketData(int count) {
+    for (int i = 0; i < count; ++i) {
+      net::StaticSocketDataProvider* data =
+          new net::StaticSocketDataProvider();
+      data->set_connect_data(net::MockConnect(net::SYNCHRONOUS, net::OK));
+      socket_data_.push_back(data);
+      socket_factory_.AddSocketDataProvider(data);
+    }
+  }
+
+  PreconnectTuner* const tuner_;
+  Referrers referrers_;
+  // The first and the last load since the idle sockets were dropped.
+  Time first_load_time_;
+  Time last_load_time_;
+  ParamsMap params_;
+
+  net::MockHostResolver host_resolver_;
+  net::MockClientSocketFactory socket_factory_;
+  ScopedVector<net::StaticSocketDataProvider> socket_data_;
+  net::ClientSocketPoolHistograms histograms_;
+  net::TransportClientSocketPool pool_;
+
+  int preconnected_count_;
+  int used_count_;
+  int request_count_;
+
+  DISALLOW_COPY_AND_ASSIGN(PreconnectTraceReplayer);
+};
+
+// Replays a week of browsing: a morning and an evening session a day, each
+// visiting three sites in turn.  Some of their subresources are always
+// needed, one only in the morning, and some in bursts of |burst_connections|
+// on some visits.  Some visits without a burst reload the page soon after,
+// which preconnects again to hosts that still have unused sockets.
+void ReplayTrace(int burst_connections,
+                 PreconnectTraceReplayer* replayer,
+                 PreconnectTuner* tuner) {
+  const GURL site_a("http://www.a.com/");
+  const GURL site_b("http://www.b.com/");
+  const GURL site_c("http://www.c.com/");
+  const GURL cdn_a("http://cdn.a.com/");
+  const GURL video_a("http://video.a.com/");
+  const GURL api_b("http://api.b.com/");
+  const GURL ads_b("http://ads.b.com/");
+  const GURL news_c("http://news.c.com/");
+  const GURL static_c("http://static.c.com/");
+  const int kVisitsPerSession = 30;
+
+  Time now;
+  for (int day = 1; day <= 7; ++day) {
+    for (int hour = 9; hour <= 21; hour += 12) {
+      const Time session_start = LocalTime(day, hour);
+      for (int visit = 0; visit < kVisitsPerSession; ++visit) {
+        now = session_start + TimeDelta::FromSeconds(
+            visit * 3 * kUnusedSocketLifetimeSeconds);
+        SubresourceConnections subresources;
+        GURL page;
+        switch (visit % 3) {
+          case 0:
+            page = site_a;
+            subresources.push_back(std::make_pair(cdn_a, 4));
+            // Videos are only played on every fourth visit.
+            if (visit % 12 == 0)
+              subresources.push_back(std::make_pair(video_a,
+                                                    burst_connections));
+            break;
+          case 1:
+            page = site_b;
+            subresources.push_back(std::make_pair(api_b, 1));
+            // Ads are only shown on every third visit.
+            if (visit % 9 == 1)
+              subresources.push_back(std::make_pair(ads_b, burst_connections));
+            break;
+          case 2:
+            page = site_c;
+            subresources.push_back(std::make_pair(static_c, 2));
+            if (hour < 12)
+              subresources.push_back(std::make_pair(news_c, 3));
+            break;
+        }
+        replayer->LoadPage(page, subresources, now);
+        if (visit % 9 == 4) {
+          replayer->LoadPage(page, subresources, now + TimeDelta::FromSeconds(
+              kUnusedSocketLifetimeSeconds / 2));
+        }
+      }
+    }
+  }
+  // Count the sockets preconnected by the last page.
+  if (tuner)
+    tuner->ExpireWarmSockets(now + TimeDelta::FromDays(1));
+}
+
+class PreconnectTraceReplayTest : public testing::Test {
+ protected:
+  PreconnectTraceReplayTest()
+      : tuner_(kPreconnectWorthyExpectedValue,
+               kMaxWarmSockets,
+               TimeDelta::FromSeconds(kUnusedSocketLifetimeSeconds)),
+        fixed_replayer_(NULL),
+        tuned_replayer_(&tuner_) {
+  }
+
+  // Replays the trace with the fixed threshold and with the tuner, and checks
+  // that the tuner's accounting matches what the socket pool saw.
+  void Replay(int burst_connections) {
+    ReplayTrace(burst_connections, &fixed_replayer_, NULL);
+    ReplayTrace(burst_connections, &tuned_replayer_, &tuner_);
+
+    VLOG(1) << "Fixed threshold: " << fixed_replayer_.used_count() << " of "
+            << fixed_replayer_.preconnected_count()
+            << " preconnected sockets used (" << fixed_replayer_.HitRate()
+            << "), " << fixed_replayer_.request_count() << " requests.";
+    VLOG(1) << "Tuned threshold: " << tuned_replayer_.used_count() << " of "
+            << tuned_replayer_.preconnected_count()
+            << " preconnected sockets used (" << tuned_replayer_.HitRate()
+            << "), threshold " << tuner_.preconnect_threshold() << ".";
+
+    EXPECT_EQ(tuned_replayer_.used_count(), tuner_.used_count());
+    EXPECT_EQ(
+        tuned_replayer_.preconnected_count() - tuned_replayer_.used_count(),
+        tuner_.wasted_count());
+    EXPECT_EQ(0, tuner_.warm_socket_count());
+
+    // About two thirds of the preconnected sockets get used.
+    EXPECT_GT(tuned_replayer_.HitRate(), 0.6);
+  }
+
+  // The socket pools run a timer to clean up idle sockets.
+  base::MessageLoopForIO message_loop_;
+  PreconnectTuner tuner_;
+  PreconnectTraceReplayer fixed_replayer_;
+  PreconnectTraceReplayer tuned_replayer_;
+};
+
+// When few preconnected sockets are wasted, the threshold is lowered to serve
+// more requests from preconnected sockets.
+TEST_F(PreconnectTraceReplayTest, SteadyDemand) {
+  Replay(1);
+  EXPECT_LT(tuner_.preconnect_threshold(), kPreconnectWorthyExpectedValue);
+  EXPECT_GT(tuned_replayer_.used_count(), fixed_replayer_.used_count());
+}
+
+// When many are wasted, the threshold is raised to waste fewer.
+TEST_F(PreconnectTraceReplayTest, BurstyDemand) {
+  Replay(6);
+  EXPECT_GT(tuner_.preconnect_threshold(), kPreconnectWorthyExpectedValue);
+  EXPECT_GT(tuned_replayer_.HitRate(), fixed_replayer_.HitRate());
+  EXPECT_LT(tuned_replayer_.preconnected_count() -
+                tuned_replayer_.used_count(),
+            fixed_replayer_.preconnected_count() -
+                fixed_replayer_.used_count());
+}
+
+}  // namespace
+
+}  // namespace chrome_browser_net
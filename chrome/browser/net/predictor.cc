@@ -5,7 +5,6 @@
 #include "chrome/browser/net/predictor.h"
 
 #include <algorithm>
-#include <cmath>
 #include <set>
 #include <sstream>
 
@@ -26,6 +25,7 @@
 #include "base/values.h"
 #include "chrome/browser/io_thread.h"
 #include "chrome/browser/net/preconnect.h"
+#include "chrome/browser/net/preconnect_tuner.h"
 #include "chrome/browser/prefs/scoped_user_pref_update.h"
 #include "chrome/browser/prefs/session_startup_pref.h"
 #include "chrome/common/chrome_switches.h"
@@ -67,6 +67,7 @@ const int64 Predictor::kDurationBetweenTrimmingIncrementsSeconds = 15;
 const size_t Predictor::kUrlsTrimmedPerIncrement = 5u;
 const size_t Predictor::kMaxSpeculativeParallelResolves = 3;
 const int Predictor::kMaxUnusedSocketLifetimeSecondsWithoutAGet = 10;
+const int Predictor::kMaxWarmPreconnectedSockets = 16;
 // To control our congestion avoidance system, which discards a queue when
 // resolutions are "taking too long," we need an expected resolution time.
 // Common average is in the range of 300-500ms.
@@ -268,6 +269,10 @@ Predictor::Predictor(bool preconnect_enabled)
       host_resolver_(NULL),
       preconnect_enabled_(preconnect_enabled),
       consecutive_omnibox_preconnect_count_(0),
+      preconnect_tuner_(new PreconnectTuner(
+          kPreconnectWorthyExpectedValue,
+          kMaxWarmPreconnectedSockets,
+          TimeDelta::FromSeconds(kMaxUnusedSocketLifetimeSecondsWithoutAGet))),
       next_trim_time_(base::TimeTicks::Now() +
                       TimeDelta::FromHours(kDurationBetweenTrimmingsHours)) {
   DCHECK(BrowserThread::CurrentlyOn(BrowserThread::UI));
@@ -684,6 +689,17 @@ void Predictor::GetHtmlInfo(std::string* output) {
     initial_observer_->GetFirstResolutionsHtml(output);
   // Show list of subresource predictions and stats.
   GetHtmlReferrerLists(output);
+  if (preconnect_enabled_) {
+    preconnect_tuner_->ExpireWarmSockets(base::Time::Now());
+    base::StringAppendF(
+        output,
+        "<br>Preconnected sockets used: %d, wasted: %d, unused yet: %d. "
+        "Subresources are preconnected above %2.3f expected connects.<br>",
+        static_cast<int>(preconnect_tuner_->used_count()),
+        static_cast<int>(preconnect_tuner_->wasted_count()),
+        preconnect_tuner_->warm_socket_count(),
+        preconnect_tuner_->preconnect_threshold());
+  }
 
   // Local lists for calling UrlInfo
   UrlInfo::UrlInfoTable name_not_found;
@@ -1009,6 +1025,13 @@ void Predictor::RecordLinkNavigation(const GURL& url) {
     preconnect_usage_->ObserveLinkNavigation(url);
 }
 
+void Predictor::RecordConnectionNeeded(const GURL& url) {
+  DCHECK(BrowserThread::CurrentlyOn(BrowserThread::IO));
+  if (!preconnect_enabled_)
+    return;
+  preconnect_tuner_->OnConnectionNeeded(url, base::Time::Now());
+}
+
 void Predictor::PredictFrameSubresources(const GURL& url,
                                          const GURL& first_party_for_cookies) {
   DCHECK(BrowserThread::CurrentlyOn(BrowserThread::UI) ||
@@ -1059,6 +1082,7 @@ void Predictor::PrepareFrameSubresources(const GURL& url,
   referrer->IncrementUseCount();
   const UrlInfo::ResolutionMotivation motivation =
       UrlInfo::LEARNED_REFERAL_MOTIVATED;
+  const base::Time now = base::Time::Now();
   for (Referrer::iterator future_url = referrer->begin();
        future_url != referrer->end(); ++future_url) {
     SubresourceValue evalution(TOO_NEW);
@@ -1067,13 +1091,20 @@ void Predictor::PrepareFrameSubresources(const GURL& url,
                                 static_cast<int>(connection_expectation * 100),
                                 10, 5000, 50);
     future_url->second.ReferrerWasObserved();
-    if (preconnect_enabled_ &&
-        connection_expectation > kPreconnectWorthyExpectedValue) {
+    // The referring page holds a socket to its own host.
+    const int extra_sockets = url.host() == future_url->first.host() ? 1 : 0;
+    int count = 0;
+    if (preconnect_enabled_) {
+      count = preconnect_tuner_->GetPreconnectCount(
+          future_url->first, connection_expectation, extra_sockets, now);
+    }
+    if (count > 0) {
       evalution = PRECONNECTION;
       future_url->second.IncrementPreconnectionCount();
-      int count = static_cast<int>(std::ceil(connection_expectation));
-      if (url.host() == future_url->first.host())
-        ++count;
+      // Only the preconnects of learned subresources tune the threshold they
+      // are decided by.
+      preconnect_tuner_->OnPreconnect(future_url->first, count, extra_sockets,
+                                      now);
       PreconnectUrlOnIOThread(future_url->first, first_party_for_cookies,
                               motivation, count);
     } else if (connection_expectation > kDNSPreresolutionWorthyExpectedValue) {
@@ -54,6 +54,8 @@ class PrefRegistrySyncable;
 
 namespace chrome_browser_net {
 
+class PreconnectTuner;
+
 typedef chrome_common_net::UrlList UrlList;
 typedef chrome_common_net::NameList NameList;
 typedef std::map<GURL, UrlInfo> Results;
@@ -99,6 +101,10 @@ class Predictor {
   // TODO(jar): We should do a persistent field trial to validate/optimize this.
   static const int kMaxUnusedSocketLifetimeSecondsWithoutAGet;
 
+  // The most preconnected sockets we expect to be unused at any time.  Learned
+  // subresource preconnections are skipped when they would exceed it.
+  static const int kMaxWarmPreconnectedSockets;
+
   // |max_concurrent| specifies how many concurrent (parallel) prefetches will
   // be performed. Host lookups will be issued through |host_resolver|.
   explicit Predictor(bool preconnect_enabled);
@@ -245,6 +251,10 @@ class Predictor {
 
   void RecordLinkNavigation(const GURL& url);
 
+  // Records that a request to |url| needed a connection of its own, so that
+  // the preconnections are tuned to how many of them are used.
+  void RecordConnectionNeeded(const GURL& url);
+
   // ------------- End IO thread methods.
 
   // The following methods may be called on either the IO or UI threads.
@@ -517,6 +527,10 @@ class Predictor {
   class PreconnectUsage;
   scoped_ptr<PreconnectUsage> preconnect_usage_;
 
+  // Decides how many sockets subresources are preconnected with, based on how
+  // many of the previous preconnections were used.
+  scoped_ptr<PreconnectTuner> preconnect_tuner_;
+
   // For each URL that we might navigate to (that we've "learned about")
   // we have a Referrer list. Each Referrer list has all hostnames we might
   // need to pre-resolve or pre-connect to when there is a navigation to the
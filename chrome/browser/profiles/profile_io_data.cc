@@ -762,6 +762,7 @@ void ProfileIOData::Init(content::ProtocolHandlerMap* protocol_handlers) const {
   network_delegate->set_enable_do_not_track(&enable_do_not_track_);
   network_delegate->set_force_google_safe_search(&force_safesearch_);
   network_delegate->set_load_time_stats(load_time_stats_);
+  network_delegate->set_incognito(is_incognito());
   network_delegate_.reset(network_delegate);
 
   fraudulent_certificate_reporter_.reset(
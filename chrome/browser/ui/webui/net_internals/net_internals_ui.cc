@@ -1179,7 +1179,7 @@ void NetInternalsMessageHandler::IOThreadImpl::OnGetHostResolverInfo(
     entry_dict->SetInteger("address_family",
         static_cast<int>(key.address_family));
     entry_dict->SetString("expiration",
-                          net::NetLog::TickCountToString(it.expiration()));
+                          net::NetLog::TickCountToString(entry.expires));
 
     if (entry.error != net::OK) {
       entry_dict->SetInteger("error", entry.error);
@@ -961,6 +961,11 @@ const char kMultiProfiles[]                 = "multi-profiles";
 // equal sign. E.g. "host1=/path/to/host1/manifest.json,host2=/path/host2.json".
 const char kNativeMessagingHosts[]          = "native-messaging-hosts";
 
+// Makes --log-net-log write a compact binary log, which costs the network
+// stack less than JSON. Convert it with net_log_binary_to_json to load it in
+// about:net-internals.
+const char kNetLogBinary[]                  = "net-log-binary";
+
 // Sets the base logging level for the net log. Log 0 logs the most data.
 // Intended primarily for use with --log-net-log.
 const char kNetLogLevel[]                   = "net-log-level";
@@ -264,6 +264,7 @@ extern const char kMessageLoopHistogrammer[];
 extern const char kMetricsRecordingOnly[];
 extern const char kMultiProfiles[];
 extern const char kNativeMessagingHosts[];
+extern const char kNetLogBinary[];
 extern const char kNetLogLevel[];
 extern const char kNewProfileManagement[];
 extern const char kNoDefaultBrowserCheck[];
@@ -4,10 +4,12 @@
 
 #include "content/browser/net/sqlite_persistent_cookie_store.h"
 
+#include <algorithm>
 #include <list>
 #include <map>
 #include <set>
 #include <utility>
+#include <vector>
 
 #include "base/basictypes.h"
 #include "base/bind.h"
@@ -21,6 +23,7 @@
 #include "base/metrics/field_trial.h"
 #include "base/metrics/histogram.h"
 #include "base/sequenced_task_runner.h"
+#include "base/stl_util.h"
 #include "base/strings/string_util.h"
 #include "base/strings/stringprintf.h"
 #include "base/synchronization/lock.h"
@@ -51,9 +54,10 @@ namespace content {
 // delegates to Backend::Load, which posts a Backend::LoadAndNotifyOnDBThread
 // task to the background runner.  This task calls Backend::ChainLoadCookies(),
 // which repeatedly posts itself to the BG runner to load each eTLD+1's cookies
-// in separate tasks.  When this is complete, Backend::CompleteLoadOnIOThread is
-// posted to the client runner, which notifies the caller of
-// SQLitePersistentCookieStore::Load that the load is complete.
+// in separate tasks, most recently accessed first.  When this is complete,
+// Backend::CompleteLoadOnIOThread is posted to the client runner, which
+// notifies the caller of SQLitePersistentCookieStore::Load that the load is
+// complete.
 //
 // If a priority load request is invoked via SQLitePersistentCookieStore::
 // LoadCookiesForKey, it is delegated to Backend::LoadCookiesForKey, which posts
@@ -65,7 +69,11 @@ namespace content {
 // Subsequent to loading, mutations may be queued by any thread using
 // AddCookie, UpdateCookieAccessTime, and DeleteCookie. These are flushed to
 // disk on the BG runner every 30 seconds, 512 operations, or call to Flush(),
-// whichever occurs first.
+// whichever occurs first. Before being written, access time updates are folded
+// into earlier operations on the same cookie, and cookies which are added and
+// deleted again cancel out. Except for Flush() and Close(), the operations are
+// written in transactions of bounded size, each in its own task, so that a big
+// batch does not hold up priority loads.
 class SQLitePersistentCookieStore::Backend
     : public base::RefCountedThreadSafe<SQLitePersistentCookieStore::Backend> {
  public:
@@ -85,6 +93,7 @@ class SQLitePersistentCookieStore::Backend
         num_cookies_read_(0),
         client_task_runner_(client_task_runner),
         background_task_runner_(background_task_runner),
+        commit_continuation_posted_(false),
         num_priority_waiting_(0),
         total_priority_requests_(0) {}
 
@@ -120,6 +129,7 @@ class SQLitePersistentCookieStore::Backend
   ~Backend() {
     DCHECK(!db_.get()) << "Close should have already been called.";
     DCHECK(num_pending_ == 0 && pending_.empty());
+    DCHECK(commit_queue_.empty());
   }
 
   // Database upgrade statements.
@@ -138,6 +148,7 @@ class SQLitePersistentCookieStore::Backend
 
     OperationType op() const { return op_; }
     const net::CanonicalCookie& cc() const { return cc_; }
+    void set_cc(const net::CanonicalCookie& cc) { cc_ = cc; }
 
    private:
     OperationType op_;
@@ -192,8 +203,16 @@ class SQLitePersistentCookieStore::Backend
   // Batch a cookie operation (add or delete)
   void BatchOperation(PendingOperation::OperationType op,
                       const net::CanonicalCookie& cc);
-  // Commit our pending operations to the database.
+  // Commit some of our pending operations to the database, and post a task to
+  // commit the rest.
   void Commit();
+  // Commit all of our pending operations to the database.
+  void CommitAll();
+  // Moves |pending_| to |commit_queue_|, coalescing operations on the same
+  // cookie.
+  void QueuePendingOperations();
+  // Writes up to |max_operations| from |commit_queue_| in one transaction.
+  void WriteQueuedOperations(size_t max_operations);
   // Close() executed on the background runner.
   void InternalBackgroundClose();
 
@@ -229,6 +248,11 @@ class SQLitePersistentCookieStore::Backend
   // Map of domain keys(eTLD+1) to domains/hosts that are to be loaded from DB.
   std::map<std::string, std::set<std::string> > keys_to_load_;
 
+  // The domain keys in the order in which ChainLoadCookies() loads them, most
+  // recently accessed first. Keys which have been loaded by a priority load in
+  // the meantime are skipped.
+  std::list<std::string> key_load_order_;
+
   // Map of (domain keys(eTLD+1), is secure cookie) to number of cookies in the
   // database.
   typedef std::pair<std::string, bool> CookieOrigin;
@@ -258,6 +282,15 @@ class SQLitePersistentCookieStore::Backend
   scoped_refptr<base::SequencedTaskRunner> client_task_runner_;
   scoped_refptr<base::SequencedTaskRunner> background_task_runner_;
 
+  // Operations taken from |pending_| which have not been written yet, in
+  // order. Only accessed on the background runner.
+  PendingOperationsList commit_queue_;
+  // The last operation in |commit_queue_| on each cookie, by creation time.
+  typedef std::map<int64, PendingOperationsList::iterator> LastOperationMap;
+  LastOperationMap last_operations_;
+  // True if a task is posted to write the rest of |commit_queue_|.
+  bool commit_continuation_posted_;
+
   // Guards the following metrics-related properties (only accessed when
   // starting/completing priority loads or completing the total load).
   base::Lock metrics_lock_;
@@ -296,6 +329,9 @@ namespace {
 const int kCurrentVersionNumber = 6;
 const int kCompatibleVersionNumber = 5;
 
+// Periodic commits write at most this many operations per transaction.
+const size_t kMaxOperationsPerTransaction = 128;
+
 // Possible values for the 'priority' column.
 enum DBCookiePriority {
   kCookiePriorityLow = 0,
@@ -587,9 +623,9 @@ bool SQLitePersistentCookieStore::Backend::InitializeDatabase() {
 
   start = base::Time::Now();
 
-  // Retrieve all the domains
+  // Retrieve all the domains, with the time their cookies were last accessed.
   sql::Statement smt(db_->GetUniqueStatement(
-    "SELECT DISTINCT host_key FROM cookies"));
+    "SELECT host_key, MAX(last_access_utc) FROM cookies GROUP BY host_key"));
 
   if (!smt.is_valid()) {
     if (corruption_detected_)
@@ -600,8 +636,11 @@ bool SQLitePersistentCookieStore::Backend::InitializeDatabase() {
   }
 
   std::vector<std::string> host_keys;
-  while (smt.Step())
+  std::vector<int64> last_access_times;
+  while (smt.Step()) {
     host_keys.push_back(smt.ColumnString(0));
+    last_access_times.push_back(smt.ColumnInt64(1));
+  }
 
   UMA_HISTOGRAM_CUSTOM_TIMES(
       "Cookie.TimeLoadDomains",
@@ -612,6 +651,7 @@ bool SQLitePersistentCookieStore::Backend::InitializeDatabase() {
   base::Time start_parse = base::Time::Now();
 
   // Build a map of domain keys (always eTLD+1) to domains.
+  std::map<std::string, int64> key_access_times;
   for (size_t idx = 0; idx < host_keys.size(); ++idx) {
     const std::string& domain = host_keys[idx];
     std::string key =
@@ -620,7 +660,22 @@ bool SQLitePersistentCookieStore::Backend::InitializeDatabase() {
             net::registry_controlled_domains::EXCLUDE_PRIVATE_REGISTRIES);
 
     keys_to_load_[key].insert(domain);
+    int64& access_time = key_access_times[key];
+    access_time = std::max(access_time, last_access_times[idx]);
+  }
+
+  // Load the domain keys used most recently first, as they are the most
+  // likely to be requested before the load completes.
+  std::vector<std::pair<int64, std::string> > keys_by_access_time;
+  keys_by_access_time.reserve(key_access_times.size());
+  for (std::map<std::string, int64>::const_iterator it =
+           key_access_times.begin();
+       it != key_access_times.end(); ++it) {
+    keys_by_access_time.push_back(std::make_pair(-it->second, it->first));
   }
+  std::sort(keys_by_access_time.begin(), keys_by_access_time.end());
+  for (size_t idx = 0; idx < keys_by_access_time.size(); ++idx)
+    key_load_order_.push_back(keys_by_access_time[idx].second);
 
   UMA_HISTOGRAM_CUSTOM_TIMES(
       "Cookie.TimeParseDomains",
@@ -648,12 +703,18 @@ void SQLitePersistentCookieStore::Backend::ChainLoadCookies(
   if (!db_) {
     // Close() has been called on this store.
     load_success = false;
-  } else if (keys_to_load_.size() > 0) {
-    // Load cookies for the first domain key.
-    std::map<std::string, std::set<std::string> >::iterator
-      it = keys_to_load_.begin();
-    load_success = LoadCookiesForDomains(it->second);
-    keys_to_load_.erase(it);
+  } else {
+    // Load cookies for the next domain key which has not been loaded yet.
+    while (!key_load_order_.empty()) {
+      std::map<std::string, std::set<std::string> >::iterator
+        it = keys_to_load_.find(key_load_order_.front());
+      key_load_order_.pop_front();
+      if (it != keys_to_load_.end()) {
+        load_success = LoadCookiesForDomains(it->second);
+        keys_to_load_.erase(it);
+        break;
+      }
+    }
   }
 
   // If load is successful and there are more domain keys to be loaded,
@@ -908,6 +969,27 @@ void SQLitePersistentCookieStore::Backend::BatchOperation(
 
 void SQLitePersistentCookieStore::Backend::Commit() {
   DCHECK(background_task_runner_->RunsTasksOnCurrentThread());
+  commit_continuation_posted_ = false;
+
+  QueuePendingOperations();
+  WriteQueuedOperations(kMaxOperationsPerTransaction);
+
+  // Let other tasks, such as priority loads, run before writing the rest.
+  if (!commit_queue_.empty() && !commit_continuation_posted_) {
+    commit_continuation_posted_ = true;
+    PostBackgroundTask(FROM_HERE, base::Bind(&Backend::Commit, this));
+  }
+}
+
+void SQLitePersistentCookieStore::Backend::CommitAll() {
+  DCHECK(background_task_runner_->RunsTasksOnCurrentThread());
+
+  QueuePendingOperations();
+  WriteQueuedOperations(commit_queue_.size());
+}
+
+void SQLitePersistentCookieStore::Backend::QueuePendingOperations() {
+  DCHECK(background_task_runner_->RunsTasksOnCurrentThread());
 
   PendingOperationsList ops;
   {
@@ -916,8 +998,44 @@ void SQLitePersistentCookieStore::Backend::Commit() {
     num_pending_ = 0;
   }
 
+  for (PendingOperationsList::iterator it = ops.begin();
+       it != ops.end(); ++it) {
+    scoped_ptr<PendingOperation> po(*it);
+    int64 creation_time = po->cc().CreationDate().ToInternalValue();
+    LastOperationMap::iterator last = last_operations_.find(creation_time);
+    if (last != last_operations_.end()) {
+      PendingOperation* last_po = *last->second;
+      if (po->op() == PendingOperation::COOKIE_UPDATEACCESS &&
+          last_po->op() != PendingOperation::COOKIE_DELETE) {
+        // The access time is written along with the earlier operation.
+        last_po->set_cc(po->cc());
+        continue;
+      }
+      if (po->op() == PendingOperation::COOKIE_DELETE &&
+          last_po->op() == PendingOperation::COOKIE_ADD) {
+        // The cookie never needs to be written.
+        delete last_po;
+        commit_queue_.erase(last->second);
+        last_operations_.erase(last);
+        continue;
+      }
+    }
+    commit_queue_.push_back(po.release());
+    last_operations_[creation_time] = --commit_queue_.end();
+  }
+}
+
+void SQLitePersistentCookieStore::Backend::WriteQueuedOperations(
+    size_t max_operations) {
+  DCHECK(background_task_runner_->RunsTasksOnCurrentThread());
+
   // Maybe an old timer fired or we are already Close()'ed.
-  if (!db_.get() || ops.empty())
+  if (!db_.get()) {
+    STLDeleteElements(&commit_queue_);
+    last_operations_.clear();
+    return;
+  }
+  if (commit_queue_.empty())
     return;
 
   sql::Statement add_smt(db_->GetCachedStatement(SQL_FROM_HERE,
@@ -925,27 +1043,32 @@ void SQLitePersistentCookieStore::Backend::Commit() {
       "expires_utc, secure, httponly, last_access_utc, has_expires, "
       "persistent, priority) "
       "VALUES (?,?,?,?,?,?,?,?,?,?,?,?)"));
-  if (!add_smt.is_valid())
-    return;
-
   sql::Statement update_access_smt(db_->GetCachedStatement(SQL_FROM_HERE,
       "UPDATE cookies SET last_access_utc=? WHERE creation_utc=?"));
-  if (!update_access_smt.is_valid())
-    return;
-
   sql::Statement del_smt(db_->GetCachedStatement(SQL_FROM_HERE,
                          "DELETE FROM cookies WHERE creation_utc=?"));
-  if (!del_smt.is_valid())
-    return;
 
+  base::TimeTicks start = base::TimeTicks::Now();
   sql::Transaction transaction(db_.get());
-  if (!transaction.Begin())
+  if (!add_smt.is_valid() || !update_access_smt.is_valid() ||
+      !del_smt.is_valid() || !transaction.Begin()) {
+    // The operations are lost, rather than retried forever.
+    STLDeleteElements(&commit_queue_);
+    last_operations_.clear();
     return;
+  }
 
-  for (PendingOperationsList::iterator it = ops.begin();
-       it != ops.end(); ++it) {
+  for (size_t i = 0; i < max_operations && !commit_queue_.empty(); ++i) {
     // Free the cookies as we commit them to the database.
-    scoped_ptr<PendingOperation> po(*it);
+    scoped_ptr<PendingOperation> po(commit_queue_.front());
+    LastOperationMap::iterator last = last_operations_.find(
+        po->cc().CreationDate().ToInternalValue());
+    if (last != last_operations_.end() &&
+        last->second == commit_queue_.begin()) {
+      last_operations_.erase(last);
+    }
+    commit_queue_.pop_front();
+
     switch (po->op()) {
       case PendingOperation::COOKIE_ADD:
         cookies_per_origin_[
@@ -995,17 +1118,19 @@ void SQLitePersistentCookieStore::Backend::Commit() {
   bool succeeded = transaction.Commit();
   UMA_HISTOGRAM_ENUMERATION("Cookie.BackingStoreUpdateResults",
                             succeeded ? 0 : 1, 2);
+  UMA_HISTOGRAM_TIMES("Cookie.TimeCommit", base::TimeTicks::Now() - start);
 }
 
 void SQLitePersistentCookieStore::Backend::Flush(
     const base::Closure& callback) {
   DCHECK(!background_task_runner_->RunsTasksOnCurrentThread());
-  PostBackgroundTask(FROM_HERE, base::Bind(&Backend::Commit, this));
+  PostBackgroundTask(FROM_HERE, base::Bind(&Backend::CommitAll, this));
 
   if (!callback.is_null()) {
-    // We want the completion task to run immediately after Commit() returns.
-    // Posting it from here means there is less chance of another task getting
-    // onto the message queue first, than if we posted it from Commit() itself.
+    // We want the completion task to run immediately after CommitAll()
+    // returns. Posting it from here means there is less chance of another task
+    // getting onto the message queue first, than if we posted it from
+    // CommitAll() itself.
     PostBackgroundTask(FROM_HERE, callback);
   }
 }
@@ -1026,7 +1151,7 @@ void SQLitePersistentCookieStore::Backend::Close() {
 void SQLitePersistentCookieStore::Backend::InternalBackgroundClose() {
   DCHECK(background_task_runner_->RunsTasksOnCurrentThread());
   // Commit any pending operations
-  Commit();
+  CommitAll();
 
   if (!force_keep_session_state_ && special_storage_policy_.get() &&
       special_storage_policy_->HasSessionOnlyOrigins()) {
@@ -9,6 +9,7 @@
 #include "base/files/scoped_temp_dir.h"
 #include "base/perftimer.h"
 #include "base/sequenced_task_runner.h"
+#include "base/stl_util.h"
 #include "base/strings/stringprintf.h"
 #include "base/synchronization/waitable_event.h"
 #include "base/test/sequenced_worker_pool_owner.h"
@@ -24,6 +25,9 @@ namespace {
 
 const base::FilePath::CharType cookie_filename[] = FILE_PATH_LITERAL("Cookies");
 
+const int kNumDomains = 300;
+const int kCookiesPerDomain = 50;
+
 }  // namespace
 
 class SQLitePersistentCookieStorePerfTest : public testing::Test {
@@ -50,6 +54,32 @@ class SQLitePersistentCookieStorePerfTest : public testing::Test {
     loaded_event_.Wait();
   }
 
+  void Flush() {
+    base::WaitableEvent event(false, false);
+    store_->Flush(base::Bind(&base::WaitableEvent::Signal,
+                             base::Unretained(&event)));
+    event.Wait();
+  }
+
+  // Adds |kCookiesPerDomain| cookies for each of the domains numbered from
+  // |first_domain| to |first_domain| + |num_domains|, with creation times
+  // after |*t|.
+  void AddCookies(int first_domain, int num_domains, base::Time* t) {
+    for (int domain_num = first_domain;
+         domain_num < first_domain + num_domains; ++domain_num) {
+      std::string domain_name(base::StringPrintf(".domain_%d.com", domain_num));
+      GURL gurl("www" + domain_name);
+      for (int cookie_num = 0; cookie_num < kCookiesPerDomain; ++cookie_num) {
+        *t += base::TimeDelta::FromInternalValue(10);
+        store_->AddCookie(
+            net::CanonicalCookie(gurl,
+                base::StringPrintf("Cookie_%d", cookie_num), "1",
+                domain_name, "/", *t, *t, *t, false, false,
+                net::COOKIE_PRIORITY_DEFAULT));
+      }
+    }
+  }
+
   scoped_refptr<base::SequencedTaskRunner> background_task_runner() {
     return pool_owner_->pool()->GetSequencedTaskRunner(
         pool_owner_->pool()->GetNamedSequenceToken("background"));
@@ -72,18 +102,7 @@ class SQLitePersistentCookieStorePerfTest : public testing::Test {
     ASSERT_EQ(0u, cookies_.size());
     // Creates 15000 cookies from 300 eTLD+1s.
     base::Time t = base::Time::Now();
-    for (int domain_num = 0; domain_num < 300; domain_num++) {
-      std::string domain_name(base::StringPrintf(".domain_%d.com", domain_num));
-      GURL gurl("www" + domain_name);
-      for (int cookie_num = 0; cookie_num < 50; ++cookie_num) {
-        t += base::TimeDelta::FromInternalValue(10);
-        store_->AddCookie(
-            net::CanonicalCookie(gurl,
-                base::StringPrintf("Cookie_%d", cookie_num), "1",
-                domain_name, "/", t, t, t, false, false,
-                net::COOKIE_PRIORITY_DEFAULT));
-      }
-    }
+    AddCookies(0, kNumDomains, &t);
     // Replace the store effectively destroying the current one and forcing it
     // to write its data to disk.
     store_ = NULL;
@@ -126,7 +145,7 @@ TEST_F(SQLitePersistentCookieStorePerfTest, TestLoadForKeyPerformance) {
     key_loaded_event_.Wait();
     timer.Done();
 
-    ASSERT_EQ(50U, cookies_.size());
+    ASSERT_EQ(static_cast<size_t>(kCookiesPerDomain), cookies_.size());
   }
 }
 
@@ -136,7 +155,46 @@ TEST_F(SQLitePersistentCookieStorePerfTest, TestLoadPerformance) {
   Load();
   timer.Done();
 
-  ASSERT_EQ(15000U, cookies_.size());
+  ASSERT_EQ(static_cast<size_t>(kNumDomains * kCookiesPerDomain),
+            cookies_.size());
+}
+
+// Test the performance of committing batches of operations.
+TEST_F(SQLitePersistentCookieStorePerfTest, TestCommitPerformance) {
+  Load();
+  std::vector<net::CanonicalCookie*> cookies;
+  cookies.swap(cookies_);
+  ASSERT_EQ(static_cast<size_t>(kNumDomains * kCookiesPerDomain),
+            cookies.size());
+
+  {
+    PerfTimeLogger timer("Commit access time updates");
+    base::Time access_time = base::Time::Now();
+    for (size_t i = 0; i < cookies.size(); ++i) {
+      cookies[i]->SetLastAccessDate(access_time);
+      store_->UpdateCookieAccessTime(*cookies[i]);
+    }
+    Flush();
+    timer.Done();
+  }
+
+  {
+    PerfTimeLogger timer("Commit cookie additions");
+    base::Time t = base::Time::Now();
+    AddCookies(kNumDomains, kNumDomains, &t);
+    Flush();
+    timer.Done();
+  }
+
+  {
+    PerfTimeLogger timer("Commit cookie deletions");
+    for (size_t i = 0; i < cookies.size(); ++i)
+      store_->DeleteCookie(*cookies[i]);
+    Flush();
+    timer.Done();
+  }
+
+  STLDeleteElements(&cookies);
 }
 
 }  // namespace content
@@ -308,6 +308,54 @@ TEST_F(SQLitePersistentCookieStoreTest, TestFlush) {
   ASSERT_GT(info.size, base_size);
 }
 
+// Test that operations on the same cookie which are committed together are
+// written correctly.
+TEST_F(SQLitePersistentCookieStoreTest, TestCoalescedOperations) {
+  InitializeStore(false);
+  base::Time t = base::Time::Now();
+  AddCookie("A", "B", "foo.bar", "/", t);
+  net::CanonicalCookie cookie(GURL(), "A", "B", "foo.bar", "/", t, t, t,
+                              false, false, net::COOKIE_PRIORITY_DEFAULT);
+  base::Time access_time = t + base::TimeDelta::FromMinutes(1);
+  cookie.SetLastAccessDate(access_time);
+  store_->UpdateCookieAccessTime(cookie);
+
+  // This cookie is deleted before it is ever written.
+  t += base::TimeDelta::FromInternalValue(10);
+  AddCookie("C", "D", "foo.bar", "/", t);
+  store_->DeleteCookie(
+      net::CanonicalCookie(GURL(), "C", "D", "foo.bar", "/", t, t, t,
+                           false, false, net::COOKIE_PRIORITY_DEFAULT));
+  DestroyStore();
+
+  CanonicalCookieVector cookies;
+  CreateAndLoad(false, &cookies);
+  ASSERT_EQ(1U, cookies.size());
+  EXPECT_EQ("A", cookies[0]->Name());
+  EXPECT_EQ(access_time, cookies[0]->LastAccessDate());
+  STLDeleteElements(&cookies);
+}
+
+// Test that the domain keys used most recently are loaded first.
+TEST_F(SQLitePersistentCookieStoreTest, TestLoadOrder) {
+  InitializeStore(false);
+  base::Time t = base::Time::Now();
+  AddCookie("A", "B", "www.aaa.com", "/", t);
+  t += base::TimeDelta::FromInternalValue(10);
+  AddCookie("A", "B", "www.ccc.com", "/", t);
+  t += base::TimeDelta::FromInternalValue(10);
+  AddCookie("A", "B", "www.bbb.com", "/", t);
+  DestroyStore();
+
+  CanonicalCookieVector cookies;
+  CreateAndLoad(false, &cookies);
+  ASSERT_EQ(3U, cookies.size());
+  EXPECT_EQ("www.bbb.com", cookies[0]->Domain());
+  EXPECT_EQ("www.ccc.com", cookies[1]->Domain());
+  EXPECT_EQ("www.aaa.com", cookies[2]->Domain());
+  STLDeleteElements(&cookies);
+}
+
 // Test loading old session cookies from the disk.
 TEST_F(SQLitePersistentCookieStoreTest, TestLoadOldSessionCookies) {
   InitializeStore(true);
@@ -123,6 +123,12 @@ class ExpiringCache {
   // Note: The returned pointer remains owned by the ExpiringCache and is
   // invalidated by a call to a non-const method.
   const ValueType* Get(const KeyType& key, const ExpirationType& now) {
+    return GetMutable(key, now);
+  }
+
+  // Same as Get(), but the returned value may be updated in place. Doing so
+  // does not change its expiration.
+  ValueType* GetMutable(const KeyType& key, const ExpirationType& now) {
     typename EntryMap::iterator it = entries_.find(key);
     if (it == entries_.end())
       return NULL;
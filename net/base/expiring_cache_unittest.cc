@@ -254,6 +254,28 @@ TEST(ExpiringCacheTest, GetTruncatesExpiredEntries) {
   EXPECT_EQ(6U, cache.size());
 }
 
+TEST(ExpiringCacheTest, GetMutable) {
+  const base::TimeDelta kTTL = base::TimeDelta::FromSeconds(10);
+
+  Cache cache(kMaxCacheEntries);
+
+  // Start at t=0.
+  base::TimeTicks now;
+  EXPECT_FALSE(cache.GetMutable("entry1", now));
+  cache.Put("entry1", "test1", now, now + kTTL);
+
+  // Update the value in place.
+  std::string* value = cache.GetMutable("entry1", now);
+  ASSERT_TRUE(value);
+  *value = "updated1";
+  EXPECT_THAT(cache.Get("entry1", now), Pointee(StrEq("updated1")));
+
+  // The update does not extend the lifetime of the entry.
+  now += kTTL;
+  EXPECT_FALSE(cache.GetMutable("entry1", now));
+  EXPECT_EQ(0U, cache.size());
+}
+
 TEST(ExpiringCacheTest, CustomFunctor) {
   ExpiringCache<std::string, std::string, std::string, TestFunctor> cache(5);
 
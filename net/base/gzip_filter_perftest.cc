@@ -0,0 +1,140 @@
+// Copyright 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "base/file_util.h"
+#include "base/memory/scoped_ptr.h"
+#include "base/path_service.h"
+#include "base/perftimer.h"
+#include "base/strings/stringprintf.h"
+#include "net/base/filter.h"
+#include "net/base/io_buffer.h"
+#include "net/base/mock_filter_context.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/zlib/zlib.h"
+
+namespace net {
+
+namespace {
+
+// Response bodies of the kinds that are commonly compressed: HTML, plain
+// text and scripts.
+const char* const kCorpus[][2] = {
+  { "filter_unittests", "google.txt" },
+  { "url_request_unittest", "BullRunSpeech.txt" },
+  { "proxy_resolver_perftest", "no-ads.pac" },
+  { "proxy_resolver_v8_unittest", "pac_library_unittest.js" },
+};
+
+// Each response of the corpus is decoded until this many bytes were output.
+const size_t kBytesPerResponse = 20 * 1024 * 1024;
+
+// The size of the buffers URLRequestJob reads filtered data into.
+const int kReadSize = 32 * 1024;
+
+// Returns |data| compressed as a Content-Encoding of |type|.
+std::string Compress(const std::string& data, Filter::FilterType type) {
+  z_stream stream;
+  memset(&stream, 0, sizeof(stream));
+  if (type == Filter::FILTER_TYPE_GZIP) {
+    EXPECT_EQ(Z_OK, deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
+                                 MAX_WBITS + 16,  // With a gzip wrapper.
+                                 8, Z_DEFAULT_STRATEGY));
+  } else {
+    EXPECT_EQ(Z_OK, deflateInit(&stream, Z_DEFAULT_COMPRESSION));
+  }
+
+  std::string compressed(deflateBound(&stream, data.size()) + 32, '\0');
+  stream.next_in = bit_cast<Bytef*>(data.data());
+  stream.avail_in = data.size();
+  stream.next_out = bit_cast<Bytef*>(&compressed[0]);
+  stream.avail_out = compressed.size();
+  EXPECT_EQ(Z_STREAM_END, deflate(&stream, Z_FINISH));
+  compressed.resize(compressed.size() - stream.avail_out);
+  deflateEnd(&stream);
+  return compressed;
+}
+
+class GZipFilterPerfTest : public testing::Test {
+ public:
+  virtual void SetUp() {
+    base::FilePath data_dir;
+    PathService::Get(base::DIR_SOURCE_ROOT, &data_dir);
+    data_dir = data_dir.AppendASCII("net").AppendASCII("data");
+    for (size_t i = 0; i < arraysize(kCorpus); ++i) {
+      std::string response;
+      ASSERT_TRUE(file_util::ReadFileToString(
+          data_dir.AppendASCII(kCorpus[i][0]).AppendASCII(kCorpus[i][1]),
+          &response));
+      corpus_.push_back(response);
+    }
+  }
+
+ protected:
+  // Decodes |compressed| with a new filter of |type|, the way URLRequestJob
+  // does, and returns the number of bytes decoded.
+  size_t Decode(Filter::FilterType type, const std::string& compressed) {
+    std::vector<Filter::FilterType> filter_types;
+    filter_types.push_back(type);
+    scoped_ptr<Filter> filter(Filter::Factory(filter_types, filter_context_));
+
+    size_t decoded = 0;
+    size_t offset = 0;
+    char output[kReadSize];
+    Filter::FilterStatus status = Filter::FILTER_NEED_MORE_DATA;
+    while (status != Filter::FILTER_DONE && status != Filter::FILTER_ERROR) {
+      if (status == Filter::FILTER_NEED_MORE_DATA) {
+        if (offset == compressed.size())
+          break;
+        size_t length = std::min(
+            compressed.size() - offset,
+            static_cast<size_t>(filter->stream_buffer_size()));
+        memcpy(filter->stream_buffer()->data(), compressed.data() + offset,
+               length);
+        filter->FlushStreamBuffer(length);
+        offset += length;
+      }
+      int output_length = sizeof(output);
+      status = filter->ReadData(output, &output_length);
+      decoded += output_length;
+    }
+    EXPECT_EQ(Filter::FILTER_DONE, status);
+    return decoded;
+  }
+
+  // Decodes every response of the corpus, compressed with |type|, and logs
+  // the throughput.
+  void RunTest(const char* name, Filter::FilterType type) {
+    for (size_t i = 0; i < corpus_.size(); ++i) {
+      std::string compressed = Compress(corpus_[i], type);
+      ASSERT_EQ(corpus_[i].size(), Decode(type, compressed));
+
+      size_t decoded = 0;
+      PerfTimer timer;
+      while (decoded < kBytesPerResponse)
+        decoded += Decode(type, compressed);
+      double seconds = timer.Elapsed().InSecondsF();
+      LogPerfResult(base::StringPrintf("%s_%s", name, kCorpus[i][1]).c_str(),
+                    decoded / seconds / (1024 * 1024), "MB/s");
+    }
+  }
+
+  std::vector<std::string> corpus_;
+  MockFilterContext filter_context_;
+};
+
+TEST_F(GZipFilterPerfTest, Gzip) {
+  RunTest("GZipFilter_Gzip", Filter::FILTER_TYPE_GZIP);
+}
+
+TEST_F(GZipFilterPerfTest, Deflate) {
+  RunTest("GZipFilter_Deflate", Filter::FILTER_TYPE_DEFLATE);
+}
+
+}  // namespace
+
+}  // namespace net
@@ -0,0 +1,152 @@
+// Copyright 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "net/base/io_buffer_pool.h"
+
+#include "base/lazy_instance.h"
+#include "base/logging.h"
+#include "base/metrics/histogram.h"
+#include "base/threading/thread_local_storage.h"
+
+namespace net {
+
+namespace {
+
+// The size classes are kMinPooledSize, 2 * kMinPooledSize, ...,
+// kMaxPooledSize.
+const int kSizeClassCount = 5;
+COMPILE_ASSERT(PooledIOBuffer::kMinPooledSize << (kSizeClassCount - 1) ==
+                   PooledIOBuffer::kMaxPooledSize,
+               size_class_count_mismatch);
+
+// The hit rate of each thread's cache is recorded once every this many
+// allocations, as a histogram sample per allocation would cost about as much
+// as the allocation itself.
+const int kAllocationsPerSample = 1000;
+
+// The blocks cached by one thread.
+struct ThreadCache {
+  ThreadCache() : allocations(0), hits(0) {
+    for (int i = 0; i < kSizeClassCount; ++i)
+      counts[i] = 0;
+  }
+
+  ~ThreadCache() {
+    for (int i = 0; i < kSizeClassCount; ++i) {
+      for (int j = 0; j < counts[i]; ++j)
+        delete[] blocks[i][j];
+    }
+  }
+
+  int counts[kSizeClassCount];
+  char* blocks[kSizeClassCount][PooledIOBuffer::kMaxCachedBlocksPerSize];
+
+  // Allocations and cache hits since the hit rate was last recorded.
+  int allocations;
+  int hits;
+};
+
+void DeleteThreadCache(void* cache) {
+  delete static_cast<ThreadCache*>(cache);
+}
+
+// Owns the TLS slot that holds the ThreadCache of each thread.
+class ThreadCacheSlot {
+ public:
+  ThreadCacheSlot() : slot_(&DeleteThreadCache) {}
+
+  // Returns the cache of the current thread, creating it if |create| is true.
+  ThreadCache* Get(bool create) {
+    ThreadCache* cache = static_cast<ThreadCache*>(slot_.Get());
+    if (!cache && create) {
+      cache = new ThreadCache;
+      slot_.Set(cache);
+    }
+    return cache;
+  }
+
+  void Reset() {
+    delete static_cast<ThreadCache*>(slot_.Get());
+    slot_.Set(NULL);
+  }
+
+ private:
+  base::ThreadLocalStorage::Slot slot_;
+
+  DISALLOW_COPY_AND_ASSIGN(ThreadCacheSlot);
+};
+
+base::LazyInstance<ThreadCacheSlot>::Leaky g_thread_cache_slot =
+    LAZY_INSTANCE_INITIALIZER;
+
+// Returns the size class of a buffer of |size| bytes, or -1 if it is too
+// large to be pooled.
+int GetSizeClass(int size) {
+  int size_class = 0;
+  for (int block_size = PooledIOBuffer::kMinPooledSize;
+       size_class < kSizeClassCount; block_size <<= 1, ++size_class) {
+    if (size <= block_size)
+      return size_class;
+  }
+  return -1;
+}
+
+char* AllocateBlock(int size_class) {
+  ThreadCache* cache = g_thread_cache_slot.Get().Get(true);
+  if (++cache->allocations == kAllocationsPerSample) {
+    UMA_HISTOGRAM_PERCENTAGE("Net.IOBufferPool.CacheHitRate",
+                             cache->hits * 100 / kAllocationsPerSample);
+    cache->allocations = 0;
+    cache->hits = 0;
+  }
+  if (cache->counts[size_class] > 0) {
+    ++cache->hits;
+    return cache->blocks[size_class][--cache->counts[size_class]];
+  }
+  return new char[PooledIOBuffer::kMinPooledSize << size_class];
+}
+
+void ReleaseBlock(int size_class, char* block) {
+  ThreadCache* cache = g_thread_cache_slot.Get().Get(true);
+  if (cache->counts[size_class] == PooledIOBuffer::kMaxCachedBlocksPerSize) {
+    delete[] block;
+    return;
+  }
+  cache->blocks[size_class][cache->counts[size_class]++] = block;
+}
+
+}  // namespace
+
+PooledIOBuffer::PooledIOBuffer(int size)
+    : IOBufferWithSize(NULL, size),
+      size_class_(GetSizeClass(size)) {
+  CHECK_GE(size, 0);
+  data_ = size_class_ < 0 ? new char[size] : AllocateBlock(size_class_);
+}
+
+// static
+void PooledIOBuffer::TrimCurrentThreadCache() {
+  g_thread_cache_slot.Get().Reset();
+}
+
+// static
+int PooledIOBuffer::GetCurrentThreadCachedBlockCountForTesting() {
+  ThreadCache* cache = g_thread_cache_slot.Get().Get(false);
+  if (!cache)
+    return 0;
+  int count = 0;
+  for (int i = 0; i < kSizeClassCount; ++i)
+    count += cache->counts[i];
+  return count;
+}
+
+PooledIOBuffer::~PooledIOBuffer() {
+  if (size_class_ >= 0) {
+    ReleaseBlock(size_class_, data_);
+    // Keep IOBuffer::~IOBuffer() from freeing the block.
+    data_ = NULL;
+  }
+}
+
+}  // namespace net
@@ -0,0 +1,56 @@
+// Copyright 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef NET_BASE_IO_BUFFER_POOL_H_
+#define NET_BASE_IO_BUFFER_POOL_H_
+
+#include "base/basictypes.h"
+#include "net/base/io_buffer.h"
+#include "net/base/net_export.h"
+
+namespace net {
+
+// A PooledIOBuffer is an IOBufferWithSize whose storage comes from a small
+// per-thread cache of blocks, rather than straight from the heap. It is meant
+// for the short-lived buffers that are allocated for every transport read or
+// write, where allocating and freeing tens of kilobytes many thousands of
+// times per second shows up in profiles.
+//
+// Requested sizes are rounded up to a power of two between kMinPooledSize and
+// kMaxPooledSize; larger buffers are allocated and freed as usual. When the
+// last reference to the buffer goes away, its storage is cached by the thread
+// that released it, so no locking is involved, and the thread frees whatever
+// it still caches when it exits. Each thread caches at most
+// kMaxCachedBlocksPerSize blocks of each size.
+//
+// Only size() bytes may be used, even if the block is larger.
+class NET_EXPORT PooledIOBuffer : public IOBufferWithSize {
+ public:
+  enum {
+    kMinPooledSize = 2 * 1024,
+    kMaxPooledSize = 32 * 1024,
+    kMaxCachedBlocksPerSize = 4,
+  };
+
+  explicit PooledIOBuffer(int size);
+
+  // Frees the blocks cached by the current thread.
+  static void TrimCurrentThreadCache();
+
+  // Returns the number of blocks cached by the current thread.
+  static int GetCurrentThreadCachedBlockCountForTesting();
+
+ private:
+  virtual ~PooledIOBuffer();
+
+  // Index of the size class |data_| belongs to, or -1 if it was allocated
+  // outside of the pool.
+  int size_class_;
+
+  DISALLOW_COPY_AND_ASSIGN(PooledIOBuffer);
+};
+
+}  // namespace net
+
+#endif  // NET_BASE_IO_BUFFER_POOL_H_
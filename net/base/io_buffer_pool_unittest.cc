@@ -0,0 +1,89 @@
+// Copyright 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "net/base/io_buffer_pool.h"
+
+#include "base/bind.h"
+#include "base/memory/ref_counted.h"
+#include "base/threading/thread.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace net {
+
+namespace {
+
+class PooledIOBufferTest : public testing::Test {
+ protected:
+  virtual void SetUp() OVERRIDE {
+    PooledIOBuffer::TrimCurrentThreadCache();
+  }
+
+  virtual void TearDown() OVERRIDE {
+    PooledIOBuffer::TrimCurrentThreadCache();
+  }
+};
+
+TEST_F(PooledIOBufferTest, ReusesReleasedBlock) {
+  scoped_refptr<PooledIOBuffer> buffer(new PooledIOBuffer(3000));
+  EXPECT_EQ(3000, buffer->size());
+  char* data = buffer->data();
+  buffer = NULL;
+  EXPECT_EQ(1, PooledIOBuffer::GetCurrentThreadCachedBlockCountForTesting());
+
+  // Any size of the same class gets the cached block back.
+  buffer = new PooledIOBuffer(4096);
+  EXPECT_EQ(data, buffer->data());
+  EXPECT_EQ(0, PooledIOBuffer::GetCurrentThreadCachedBlockCountForTesting());
+
+  // A different class does not.
+  scoped_refptr<PooledIOBuffer> other(new PooledIOBuffer(100));
+  other = NULL;
+  scoped_refptr<PooledIOBuffer> larger(new PooledIOBuffer(8192));
+  EXPECT_EQ(1, PooledIOBuffer::GetCurrentThreadCachedBlockCountForTesting());
+}
+
+TEST_F(PooledIOBufferTest, LargeBuffersAreNotPooled) {
+  scoped_refptr<PooledIOBuffer> buffer(
+      new PooledIOBuffer(PooledIOBuffer::kMaxPooledSize + 1));
+  EXPECT_EQ(PooledIOBuffer::kMaxPooledSize + 1, buffer->size());
+  buffer->data()[PooledIOBuffer::kMaxPooledSize] = 'x';
+  buffer = NULL;
+  EXPECT_EQ(0, PooledIOBuffer::GetCurrentThreadCachedBlockCountForTesting());
+}
+
+TEST_F(PooledIOBufferTest, CacheIsBounded) {
+  const int kBuffers = PooledIOBuffer::kMaxCachedBlocksPerSize + 3;
+  scoped_refptr<PooledIOBuffer> buffers[kBuffers];
+  for (int i = 0; i < kBuffers; ++i)
+    buffers[i] = new PooledIOBuffer(PooledIOBuffer::kMaxPooledSize);
+  for (int i = 0; i < kBuffers; ++i)
+    buffers[i] = NULL;
+  EXPECT_EQ(PooledIOBuffer::kMaxCachedBlocksPerSize,
+            PooledIOBuffer::GetCurrentThreadCachedBlockCountForTesting());
+}
+
+void ReleaseBuffer(scoped_refptr<PooledIOBuffer>* buffer, int* cached) {
+  *buffer = NULL;
+  *cached = PooledIOBuffer::GetCurrentThreadCachedBlockCountForTesting();
+}
+
+// The block goes back to the cache of the thread that releases the buffer.
+TEST_F(PooledIOBufferTest, ReleasedOnOtherThread) {
+  base::Thread thread("PooledIOBufferTest");
+  ASSERT_TRUE(thread.Start());
+
+  scoped_refptr<PooledIOBuffer> buffer(new PooledIOBuffer(1024));
+  int cached = 0;
+  thread.message_loop()->PostTask(
+      FROM_HERE, base::Bind(&ReleaseBuffer, &buffer, &cached));
+  thread.Stop();
+
+  EXPECT_FALSE(buffer.get());
+  EXPECT_EQ(1, cached);
+  EXPECT_EQ(0, PooledIOBuffer::GetCurrentThreadCachedBlockCountForTesting());
+}
+
+}  // namespace
+
+}  // namespace net
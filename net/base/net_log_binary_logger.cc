@@ -0,0 +1,587 @@
+// Copyright 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "net/base/net_log_binary_logger.h"
+
+#include <string.h>
+
+#include <algorithm>
+
+#include "base/atomic_sequence_num.h"
+#include "base/atomicops.h"
+#include "base/bind.h"
+#include "base/json/json_writer.h"
+#include "base/lazy_instance.h"
+#include "base/logging.h"
+#include "base/message_loop/message_loop_proxy.h"
+#include "base/threading/thread.h"
+#include "base/threading/thread_local_storage.h"
+#include "base/values.h"
+
+namespace net {
+
+namespace {
+
+// Starts every file, followed by the length of the JSON constants and the
+// constants themselves, then by the records. Also tells apart files written
+// on a machine of another byte order, which are not supported.
+const uint32 kFileMagic = 0x31424c4e;  // "NLB1"
+
+// Must be a power of two.
+const uint32 kRingBufferSize = 256 * 1024;
+
+const int kDrainIntervalMs = 100;
+
+// Each record is a RecordHeader followed by the encoded parameters of the
+// entry.
+struct RecordHeader {
+  // The size of the whole record, including this header.
+  uint32 size;
+  uint32 type;
+  uint32 source_type;
+  uint32 source_id;
+  uint32 phase;
+  uint32 unused;
+  int64 time;
+};
+
+// Tags of the encoded values. Values are written as a tag, followed by:
+//  - TAG_BOOLEAN: an uint8.
+//  - TAG_INTEGER: an int32.
+//  - TAG_DOUBLE: a double.
+//  - TAG_STRING: an uint32 length and the characters.
+//  - TAG_DICTIONARY: an uint32 count of entries, then each key as for
+//    TAG_STRING without the tag, followed by its value.
+//  - TAG_LIST: an uint32 count of values, then the values.
+// TAG_NONE stands for the lack of parameters. Binary values, which cannot
+// be written as JSON, are written as TAG_NULL.
+enum ValueTag {
+  TAG_NONE,
+  TAG_NULL,
+  TAG_BOOLEAN,
+  TAG_INTEGER,
+  TAG_DOUBLE,
+  TAG_STRING,
+  TAG_DICTIONARY,
+  TAG_LIST,
+};
+
+base::StaticAtomicSequenceNumber g_next_logger_id;
+
+template <typename T>
+void Append(const T& value, std::string* out) {
+  out->append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void AppendString(const std::string& value, std::string* out) {
+  Append(static_cast<uint32>(value.size()), out);
+  out->append(value);
+}
+
+void EncodeValue(const base::Value* value, std::string* out) {
+  if (!value) {
+    Append(static_cast<uint8>(TAG_NONE), out);
+    return;
+  }
+  switch (value->GetType()) {
+    case base::Value::TYPE_BOOLEAN: {
+      bool boolean = false;
+      value->GetAsBoolean(&boolean);
+      Append(static_cast<uint8>(TAG_BOOLEAN), out);
+      Append(static_cast<uint8>(boolean), out);
+      return;
+    }
+    case base::Value::TYPE_INTEGER: {
+      int integer = 0;
+      value->GetAsInteger(&integer);
+      Append(static_cast<uint8>(TAG_INTEGER), out);
+      Append(static_cast<int32>(integer), out);
+      return;
+    }
+    case base::Value::TYPE_DOUBLE: {
+      double number = 0;
+      value->GetAsDouble(&number);
+      Append(static_cast<uint8>(TAG_DOUBLE), out);
+      Append(number, out);
+      return;
+    }
+    case base::Value::TYPE_STRING: {
+      std::string string;
+      value->GetAsString(&string);
+      Append(static_cast<uint8>(TAG_STRING), out);
+      AppendString(string, out);
+      return;
+    }
+    case base::Value::TYPE_DICTIONARY: {
+      const base::DictionaryValue* dict = NULL;
+      value->GetAsDictionary(&dict);
+      Append(static_cast<uint8>(TAG_DICTIONARY), out);
+      Append(static_cast<uint32>(dict->size()), out);
+      for (base::DictionaryValue::Iterator it(*dict); !it.IsAtEnd();
+           it.Advance()) {
+        AppendString(it.key(), out);
+        EncodeValue(&it.value(), out);
+      }
+      return;
+    }
+    case base::Value::TYPE_LIST: {
+      const base::ListValue* list = NULL;
+      value->GetAsList(&list);
+      Append(static_cast<uint8>(TAG_LIST), out);
+      Append(static_cast<uint32>(list->GetSize()), out);
+      for (base::ListValue::const_iterator it = list->begin();
+           it != list->end(); ++it) {
+        EncodeValue(*it, out);
+      }
+      return;
+    }
+    default:
+      Append(static_cast<uint8>(TAG_NULL), out);
+      return;
+  }
+}
+
+// Reads from a range of a binary log.
+class Reader {
+ public:
+  Reader(const char* data, size_t size) : pos_(data), end_(data + size) {}
+
+  size_t remaining() const { return end_ - pos_; }
+
+  template <typename T>
+  bool Read(T* value) {
+    if (remaining() < sizeof(*value))
+      return false;
+    memcpy(value, pos_, sizeof(*value));
+    pos_ += sizeof(*value);
+    return true;
+  }
+
+  bool ReadString(std::string* value) {
+    uint32 length = 0;
+    if (!Read(&length) || remaining() < length)
+      return false;
+    value->assign(pos_, length);
+    pos_ += length;
+    return true;
+  }
+
+  // Decodes a value written by EncodeValue(). Sets |value| to NULL for
+  // TAG_NONE. Returns false if the data is invalid.
+  bool ReadValue(scoped_ptr<base::Value>* value);
+
+ private:
+  const char* pos_;
+  const char* const end_;
+};
+
+bool Reader::ReadValue(scoped_ptr<base::Value>* value) {
+  uint8 tag = 0;
+  if (!Read(&tag))
+    return false;
+  switch (tag) {
+    case TAG_NONE:
+      value->reset();
+      return true;
+    case TAG_NULL:
+      value->reset(base::Value::CreateNullValue());
+      return true;
+    case TAG_BOOLEAN: {
+      uint8 boolean = 0;
+      if (!Read(&boolean))
+        return false;
+      value->reset(new base::FundamentalValue(boolean != 0));
+      return true;
+    }
+    case TAG_INTEGER: {
+      int32 integer = 0;
+      if (!Read(&integer))
+        return false;
+      value->reset(new base::FundamentalValue(static_cast<int>(integer)));
+      return true;
+    }
+    case TAG_DOUBLE: {
+      double number = 0;
+      if (!Read(&number))
+        return false;
+      value->reset(new base::FundamentalValue(number));
+      return true;
+    }
+    case TAG_STRING: {
+      std::string string;
+      if (!ReadString(&string))
+        return false;
+      value->reset(new base::StringValue(string));
+      return true;
+    }
+    case TAG_DICTIONARY: {
+      uint32 count = 0;
+      if (!Read(&count))
+        return false;
+      scoped_ptr<base::DictionaryValue> dict(new base::DictionaryValue());
+      for (uint32 i = 0; i < count; ++i) {
+        std::string key;
+        scoped_ptr<base::Value> entry;
+        if (!ReadString(&key) || !ReadValue(&entry) || !entry)
+          return false;
+        dict->SetWithoutPathExpansion(key, entry.release());
+      }
+      value->reset(dict.release());
+      return true;
+    }
+    case TAG_LIST: {
+      uint32 count = 0;
+      if (!Read(&count))
+        return false;
+      scoped_ptr<base::ListValue> list(new base::ListValue());
+      for (uint32 i = 0; i < count; ++i) {
+        scoped_ptr<base::Value> entry;
+        if (!ReadValue(&entry) || !entry)
+          return false;
+        list->Append(entry.release());
+      }
+      value->reset(list.release());
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+
+// Returns a copy of |value|, for the parameters of a converted entry.
+base::Value* CopyParametersCallback(const base::Value* value,
+                                    NetLog::LogLevel /* log_level */) {
+  return value ? value->DeepCopy() : NULL;
+}
+
+// A record in a binary log, located for sorting by time.
+struct RecordLocation {
+  int64 time;
+  const char* data;
+  size_t size;
+};
+
+bool RecordTimeLess(const RecordLocation& a, const RecordLocation& b) {
+  return a.time < b.time;
+}
+
+}  // namespace
+
+namespace internal {
+
+// The ring buffer of one thread. It has a single producer, the thread that
+// logs, and a single consumer, the writer thread, so writing and reading
+// only need the positions to be published with memory barriers.
+//
+// It is referenced by the thread local storage of the thread until that
+// thread exits or logs to another logger, and by the logger until it has
+// been drained after that.
+class NetLogRingBuffer : public base::RefCountedThreadSafe<NetLogRingBuffer> {
+ public:
+  explicit NetLogRingBuffer(int logger_id)
+      : logger_id_(logger_id),
+        data_(new char[kRingBufferSize]),
+        write_position_(0),
+        read_position_(0),
+        dropped_event_count_(0) {}
+
+  int logger_id() const { return logger_id_; }
+
+  // Scratch space to build records in. Only used by the producer.
+  std::string* record() { return &record_; }
+
+  // Appends |size| bytes to the buffer, or drops them if they do not fit.
+  // Returns true if the buffer just became more than half full. Only called
+  // by the producer.
+  bool Write(const char* data, size_t size) {
+    uint32 write = base::subtle::NoBarrier_Load(&write_position_);
+    uint32 read = base::subtle::Acquire_Load(&read_position_);
+    if (size > kRingBufferSize - (write - read)) {
+      base::subtle::NoBarrier_AtomicIncrement(&dropped_event_count_, 1);
+      return false;
+    }
+    size_t offset = write & (kRingBufferSize - 1);
+    size_t first = std::min(size, kRingBufferSize - offset);
+    memcpy(data_.get() + offset, data, first);
+    memcpy(data_.get(), data + first, size - first);
+    base::subtle::Release_Store(&write_position_, write + size);
+    return write - read <= kRingBufferSize / 2 &&
+        write + size - read > kRingBufferSize / 2;
+  }
+
+  // Writes the contents of the buffer to |file| and empties it. Only
+  // called by the consumer.
+  void ReadTo(FILE* file) {
+    uint32 read = base::subtle::NoBarrier_Load(&read_position_);
+    uint32 write = base::subtle::Acquire_Load(&write_position_);
+    size_t size = write - read;
+    size_t offset = read & (kRingBufferSize - 1);
+    size_t first = std::min(size, kRingBufferSize - offset);
+    fwrite(data_.get() + offset, 1, first, file);
+    fwrite(data_.get(), 1, size - first, file);
+    base::subtle::Release_Store(&read_position_, write);
+  }
+
+  int dropped_event_count() const {
+    return base::subtle::NoBarrier_Load(&dropped_event_count_);
+  }
+
+ private:
+  friend class base::RefCountedThreadSafe<NetLogRingBuffer>;
+
+  ~NetLogRingBuffer() {}
+
+  const int logger_id_;
+  scoped_ptr<char[]> data_;
+
+  // Positions in the stream of bytes written to the buffer. They wrap
+  // around, as only their difference and their value modulo
+  // kRingBufferSize matter.
+  base::subtle::Atomic32 write_position_;
+  base::subtle::Atomic32 read_position_;
+
+  base::subtle::Atomic32 dropped_event_count_;
+
+  std::string record_;
+
+  DISALLOW_COPY_AND_ASSIGN(NetLogRingBuffer);
+};
+
+}  // namespace internal
+
+namespace {
+
+void ReleaseRingBuffer(void* ring_buffer) {
+  static_cast<internal::NetLogRingBuffer*>(ring_buffer)->Release();
+}
+
+// Owns the TLS slot that holds the ring buffer of each thread.
+class RingBufferSlot {
+ public:
+  RingBufferSlot() : slot_(&ReleaseRingBuffer) {}
+
+  internal::NetLogRingBuffer* Get() {
+    return static_cast<internal::NetLogRingBuffer*>(slot_.Get());
+  }
+
+  // Takes a reference to |ring_buffer|, and releases the previous one.
+  void Set(internal::NetLogRingBuffer* ring_buffer) {
+    ring_buffer->AddRef();
+    internal::NetLogRingBuffer* old_ring_buffer = Get();
+    slot_.Set(ring_buffer);
+    if (old_ring_buffer)
+      old_ring_buffer->Release();
+  }
+
+ private:
+  base::ThreadLocalStorage::Slot slot_;
+
+  DISALLOW_COPY_AND_ASSIGN(RingBufferSlot);
+};
+
+base::LazyInstance<RingBufferSlot>::Leaky g_ring_buffer_slot =
+    LAZY_INSTANCE_INITIALIZER;
+
+}  // namespace
+
+NetLogBinaryLogger::NetLogBinaryLogger(FILE* file,
+                                       const base::Value& constants)
+    : file_(file),
+      id_(g_next_logger_id.GetNext()),
+      drain_requested_(0),
+      dropped_event_count_(0) {
+  DCHECK(file);
+
+  std::string json;
+  base::JSONWriter::Write(&constants, &json);
+  std::string header;
+  Append(kFileMagic, &header);
+  AppendString(json, &header);
+  fwrite(header.data(), 1, header.size(), file_.get());
+}
+
+NetLogBinaryLogger::~NetLogBinaryLogger() {
+  // The writer thread may still run if the NetLog stopped being observed
+  // without StopObserving().
+  writer_thread_.reset();
+  Drain();
+}
+
+void NetLogBinaryLogger::StartObserving(NetLog* net_log,
+                                        NetLog::LogLevel log_level) {
+  DCHECK(!writer_thread_);
+  writer_thread_.reset(new base::Thread("NetLogBinaryWriter"));
+  writer_thread_->Start();
+  writer_thread_->message_loop()->PostDelayedTask(
+      FROM_HERE,
+      base::Bind(&NetLogBinaryLogger::DrainPeriodically,
+                 base::Unretained(this)),
+      base::TimeDelta::FromMilliseconds(kDrainIntervalMs));
+  net_log->AddThreadSafeObserver(this, log_level);
+}
+
+void NetLogBinaryLogger::StopObserving() {
+  net_log()->RemoveThreadSafeObserver(this);
+  writer_thread_.reset();
+  Drain();
+  fflush(file_.get());
+}
+
+int NetLogBinaryLogger::dropped_event_count() const {
+  base::AutoLock lock(lock_);
+  int count = dropped_event_count_;
+  for (size_t i = 0; i < ring_buffers_.size(); ++i)
+    count += ring_buffers_[i]->dropped_event_count();
+  return count;
+}
+
+void NetLogBinaryLogger::OnAddEntry(const NetLog::Entry& entry) {
+  internal::NetLogRingBuffer* ring_buffer = GetRingBufferForCurrentThread();
+
+  std::string* record = ring_buffer->record();
+  record->clear();
+  RecordHeader header;
+  header.size = 0;
+  header.type = entry.type();
+  header.source_type = entry.source().type;
+  header.source_id = entry.source().id;
+  header.phase = entry.phase();
+  header.unused = 0;
+  header.time = entry.time().ToInternalValue();
+  Append(header, record);
+
+  scoped_ptr<base::Value> parameters(entry.ParametersToValue());
+  EncodeValue(parameters.get(), record);
+
+  uint32 size = static_cast<uint32>(record->size());
+  memcpy(&(*record)[0], &size, sizeof(size));
+  if (!ring_buffer->Write(record->data(), record->size()))
+    return;
+
+  // Wake up the writer rather than wait for its next periodic drain, so
+  // that bursts of events do not overflow the ring buffer. Only one thread
+  // posts until the drain starts.
+  if (writer_thread_ &&
+      base::subtle::NoBarrier_CompareAndSwap(&drain_requested_, 0, 1) == 0) {
+    writer_thread_->message_loop_proxy()->PostTask(
+        FROM_HERE,
+        base::Bind(&NetLogBinaryLogger::DrainRequested,
+                   base::Unretained(this)));
+  }
+}
+
+// static
+bool NetLogBinaryLogger::ConvertToJson(const std::string& binary_log,
+                                       std::string* json) {
+  Reader reader(binary_log.data(), binary_log.size());
+  uint32 magic = 0;
+  std::string constants;
+  if (!reader.Read(&magic) || magic != kFileMagic ||
+      !reader.ReadString(&constants)) {
+    return false;
+  }
+
+  // Locate the records, and sort them by time.
+  std::vector<RecordLocation> records;
+  const char* end = binary_log.data() + binary_log.size();
+  const char* data = end - reader.remaining();
+  RecordHeader header;
+  while (Reader(data, end - data).Read(&header) &&
+         header.size >= sizeof(header) &&
+         header.size <= static_cast<size_t>(end - data)) {
+    RecordLocation location = { header.time, data, header.size };
+    records.push_back(location);
+    data += header.size;
+  }
+  std::stable_sort(records.begin(), records.end(), &RecordTimeLess);
+
+  json->assign("{\"constants\": ");
+  json->append(constants);
+  json->append(",\n\"events\": [\n");
+  for (size_t i = 0; i < records.size(); ++i) {
+    Reader record_reader(records[i].data, records[i].size);
+    record_reader.Read(&header);
+    scoped_ptr<base::Value> parameters;
+    if (!record_reader.ReadValue(&parameters) ||
+        header.type >= static_cast<uint32>(NetLog::EVENT_COUNT) ||
+        header.source_type >= static_cast<uint32>(NetLog::SOURCE_COUNT) ||
+        header.phase > static_cast<uint32>(NetLog::PHASE_END)) {
+      return false;
+    }
+
+    NetLog::ParametersCallback parameters_callback =
+        base::Bind(&CopyParametersCallback, parameters.get());
+    NetLog::Entry entry(
+        static_cast<NetLog::EventType>(header.type),
+        NetLog::Source(static_cast<NetLog::SourceType>(header.source_type),
+                       header.source_id),
+        static_cast<NetLog::EventPhase>(header.phase),
+        base::TimeTicks::FromInternalValue(header.time),
+        &parameters_callback,
+        NetLog::LOG_ALL);
+    scoped_ptr<base::Value> value(entry.ToValue());
+    std::string event_json;
+    base::JSONWriter::Write(value.get(), &event_json);
+    if (i > 0)
+      json->append(",\n");
+    json->append(event_json);
+  }
+  json->append("]}");
+  return true;
+}
+
+internal::NetLogRingBuffer*
+NetLogBinaryLogger::GetRingBufferForCurrentThread() {
+  RingBufferSlot& slot = g_ring_buffer_slot.Get();
+  internal::NetLogRingBuffer* ring_buffer = slot.Get();
+  if (ring_buffer && ring_buffer->logger_id() == id_)
+    return ring_buffer;
+
+  ring_buffer = new internal::NetLogRingBuffer(id_);
+  slot.Set(ring_buffer);
+  base::AutoLock lock(lock_);
+  ring_buffers_.push_back(ring_buffer);
+  return ring_buffer;
+}
+
+void NetLogBinaryLogger::Drain() {
+  // Ring buffers only referenced by |ring_buffers_| belong to threads that
+  // have exited, so no more records will be written to them.
+  std::vector<scoped_refptr<internal::NetLogRingBuffer> > ring_buffers;
+  std::vector<scoped_refptr<internal::NetLogRingBuffer> > final_ring_buffers;
+  {
+    base::AutoLock lock(lock_);
+    for (size_t i = 0; i < ring_buffers_.size(); ++i) {
+      if (ring_buffers_[i]->HasOneRef()) {
+        final_ring_buffers.push_back(ring_buffers_[i]);
+        dropped_event_count_ += ring_buffers_[i]->dropped_event_count();
+      } else {
+        ring_buffers.push_back(ring_buffers_[i]);
+      }
+    }
+    ring_buffers_ = ring_buffers;
+  }
+
+  for (size_t i = 0; i < ring_buffers.size(); ++i)
+    ring_buffers[i]->ReadTo(file_.get());
+  for (size_t i = 0; i < final_ring_buffers.size(); ++i)
+    final_ring_buffers[i]->ReadTo(file_.get());
+}
+
+void NetLogBinaryLogger::DrainRequested() {
+  base::subtle::Release_Store(&drain_requested_, 0);
+  Drain();
+}
+
+void NetLogBinaryLogger::DrainPeriodically() {
+  Drain();
+  fflush(file_.get());
+  base::MessageLoop::current()->PostDelayedTask(
+      FROM_HERE,
+      base::Bind(&NetLogBinaryLogger::DrainPeriodically,
+                 base::Unretained(this)),
+      base::TimeDelta::FromMilliseconds(kDrainIntervalMs));
+}
+
+}  // namespace net
@@ -0,0 +1,110 @@
+// Copyright 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef NET_BASE_NET_LOG_BINARY_LOGGER_H_
+#define NET_BASE_NET_LOG_BINARY_LOGGER_H_
+
+#include <stdio.h>
+
+#include <string>
+#include <vector>
+
+#include "base/atomicops.h"
+#include "base/memory/ref_counted.h"
+#include "base/memory/scoped_handle.h"
+#include "base/memory/scoped_ptr.h"
+#include "base/synchronization/lock.h"
+#include "net/base/net_log.h"
+
+namespace base {
+class Thread;
+class Value;
+}
+
+namespace net {
+
+namespace internal {
+class NetLogRingBuffer;
+}  // namespace internal
+
+// NetLogBinaryLogger is a cheaper alternative to NetLogLogger, for when
+// the NetLog is captured to a file while the network stack is under load.
+//
+// Rather than building and serializing a JSON object for every entry on
+// the thread that adds it, each thread appends a compact binary record to
+// a ring buffer of its own, without taking any lock. A background thread
+// drains the ring buffers to the file. Events are dropped, and counted,
+// when a thread fills its ring buffer faster than it is drained.
+//
+// Records from different threads are not ordered in the file.
+// ConvertToJson() turns a file into the format written by NetLogLogger,
+// with events sorted by time.
+class NET_EXPORT NetLogBinaryLogger : public NetLog::ThreadSafeObserver {
+ public:
+  // Takes ownership of |file|, which must be non-NULL and open for
+  // writing in binary mode. |constants| is a legend for decoding constant
+  // values used in the log, as for NetLogLogger.
+  NetLogBinaryLogger(FILE* file, const base::Value& constants);
+  virtual ~NetLogBinaryLogger();
+
+  // Starts observing |net_log| at |log_level|, and starts the thread that
+  // writes to the file. Must not already be watching a NetLog.
+  void StartObserving(NetLog* net_log, NetLog::LogLevel log_level);
+
+  // Stops observing net_log(), writes any remaining records and stops the
+  // writer thread. Must already be watching.
+  void StopObserving();
+
+  // Returns the number of events dropped because a ring buffer was full.
+  int dropped_event_count() const;
+
+  // net::NetLog::ThreadSafeObserver implementation:
+  virtual void OnAddEntry(const NetLog::Entry& entry) OVERRIDE;
+
+  // Converts the contents of a file written by a NetLogBinaryLogger to the
+  // JSON written by NetLogLogger. Returns false if |binary_log| is not
+  // such a file; a truncated last record is ignored.
+  static bool ConvertToJson(const std::string& binary_log, std::string* json);
+
+ private:
+  // Returns the ring buffer of the current thread, creating it if needed.
+  internal::NetLogRingBuffer* GetRingBufferForCurrentThread();
+
+  // Writes the records in all ring buffers to the file. Called on the
+  // writer thread, and by StopObserving() once it has stopped.
+  void Drain();
+
+  // Drains the ring buffers, when a thread has filled half of its own.
+  void DrainRequested();
+
+  // Drains the ring buffers, and posts a task to do so again later.
+  void DrainPeriodically();
+
+  ScopedStdioHandle file_;
+
+  // Identifies the ring buffers of this logger, which may outlive it in
+  // the thread local storage of the threads that logged to it.
+  const int id_;
+
+  // Thread that writes the ring buffers to |file_|.
+  scoped_ptr<base::Thread> writer_thread_;
+
+  // Set while a DrainRequested() task is pending on the writer thread.
+  base::subtle::Atomic32 drain_requested_;
+
+  // Protects |ring_buffers_|. Taken when a thread logs its first event,
+  // and by the writer, but not for each event.
+  mutable base::Lock lock_;
+  std::vector<scoped_refptr<internal::NetLogRingBuffer> > ring_buffers_;
+
+  // The events dropped by ring buffers that are no longer in
+  // |ring_buffers_|.
+  int dropped_event_count_;
+
+  DISALLOW_COPY_AND_ASSIGN(NetLogBinaryLogger);
+};
+
+}  // namespace net
+
+#endif  // NET_BASE_NET_LOG_BINARY_LOGGER_H_
@@ -0,0 +1,211 @@
+// Copyright 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "net/base/net_log_binary_logger.h"
+
+#include <string>
+
+#include "base/bind.h"
+#include "base/file_util.h"
+#include "base/files/file_path.h"
+#include "base/files/scoped_temp_dir.h"
+#include "base/json/json_reader.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/threading/thread.h"
+#include "base/values.h"
+#include "net/base/net_log_logger.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace net {
+
+namespace {
+
+base::Value* TestParametersCallback(int index, NetLog::LogLevel log_level) {
+  base::DictionaryValue* dict = new base::DictionaryValue();
+  dict->SetInteger("index", index);
+  dict->SetString("url", "http://www.example.com/");
+  dict->SetBoolean("flag", index % 2 == 0);
+  dict->SetDouble("ratio", 0.5);
+  // Keys with dots are not paths.
+  dict->SetWithoutPathExpansion("a.b", base::Value::CreateNullValue());
+  base::ListValue* list = new base::ListValue();
+  list->AppendInteger(-index);
+  list->AppendString("item");
+  list->Append(new base::DictionaryValue());
+  dict->Set("list", list);
+  return dict;
+}
+
+// Adds the entries of the tests to |observer|, a millisecond apart from
+// |time|.
+void AddEntries(NetLog::ThreadSafeObserver* observer,
+                base::TimeTicks time,
+                int count) {
+  for (int i = 0; i < count; ++i) {
+    NetLog::ParametersCallback callback =
+        base::Bind(&TestParametersCallback, i);
+    NetLog::Entry entry(NetLog::TYPE_URL_REQUEST_START_JOB,
+                        NetLog::Source(NetLog::SOURCE_URL_REQUEST, i + 1),
+                        static_cast<NetLog::EventPhase>(i % 3),
+                        time + base::TimeDelta::FromMilliseconds(i),
+                        i % 4 == 0 ? NULL : &callback,
+                        NetLog::LOG_ALL_BUT_BYTES);
+    observer->OnAddEntry(entry);
+  }
+}
+
+void AddGlobalEntries(NetLog* net_log, int count) {
+  for (int i = 0; i < count; ++i)
+    net_log->AddGlobalEntry(NetLog::TYPE_CANCELLED);
+}
+
+class NetLogBinaryLoggerTest : public testing::Test {
+ public:
+  virtual void SetUp() {
+    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
+    log_path_ = temp_dir_.path().AppendASCII("NetLogFile");
+  }
+
+ protected:
+  // Converts the binary log to JSON, and parses it.
+  scoped_ptr<base::DictionaryValue> ReadConvertedLog() {
+    std::string binary_log;
+    EXPECT_TRUE(file_util::ReadFileToString(log_path_, &binary_log));
+    return ParseConvertedLog(binary_log);
+  }
+
+  scoped_ptr<base::DictionaryValue> ParseConvertedLog(
+      const std::string& binary_log) {
+    std::string json;
+    EXPECT_TRUE(NetLogBinaryLogger::ConvertToJson(binary_log, &json));
+    base::JSONReader reader;
+    scoped_ptr<base::Value> root(reader.ReadToValue(json));
+    EXPECT_TRUE(root) << reader.GetErrorMessage();
+    base::DictionaryValue* dict = NULL;
+    if (!root || !root->GetAsDictionary(&dict))
+      return scoped_ptr<base::DictionaryValue>();
+    ignore_result(root.release());
+    return scoped_ptr<base::DictionaryValue>(dict);
+  }
+
+  base::ScopedTempDir temp_dir_;
+  base::FilePath log_path_;
+};
+
+TEST_F(NetLogBinaryLoggerTest, ConvertsToSameJsonAsNetLogLogger) {
+  const int kEntries = 10;
+  scoped_ptr<base::Value> constants(NetLogLogger::GetConstants());
+  base::TimeTicks time = base::TimeTicks::Now();
+
+  base::FilePath json_log_path = temp_dir_.path().AppendASCII("NetLogJson");
+  {
+    FILE* file = file_util::OpenFile(json_log_path, "w");
+    ASSERT_TRUE(file);
+    NetLogLogger logger(file, *constants);
+    AddEntries(&logger, time, kEntries);
+  }
+  {
+    FILE* file = file_util::OpenFile(log_path_, "wb");
+    ASSERT_TRUE(file);
+    NetLogBinaryLogger logger(file, *constants);
+    AddEntries(&logger, time, kEntries);
+  }
+
+  std::string json;
+  ASSERT_TRUE(file_util::ReadFileToString(json_log_path, &json));
+  scoped_ptr<base::Value> expected(base::JSONReader::Read(json));
+  ASSERT_TRUE(expected);
+
+  scoped_ptr<base::DictionaryValue> converted(ReadConvertedLog());
+  ASSERT_TRUE(converted);
+  base::ListValue* events = NULL;
+  ASSERT_TRUE(converted->GetList("events", &events));
+  EXPECT_EQ(static_cast<size_t>(kEntries), events->GetSize());
+  EXPECT_TRUE(expected->Equals(converted.get()));
+}
+
+TEST_F(NetLogBinaryLoggerTest, SortsEventsOfSeveralThreads) {
+  const int kEntriesPerThread = 100;
+  NetLog net_log;
+  FILE* file = file_util::OpenFile(log_path_, "wb");
+  ASSERT_TRUE(file);
+  scoped_ptr<base::Value> constants(NetLogLogger::GetConstants());
+  NetLogBinaryLogger logger(file, *constants);
+  logger.StartObserving(&net_log, NetLog::LOG_ALL_BUT_BYTES);
+
+  base::Thread thread("NetLogBinaryLoggerTest");
+  ASSERT_TRUE(thread.Start());
+  thread.message_loop()->PostTask(
+      FROM_HERE, base::Bind(&AddGlobalEntries, &net_log, kEntriesPerThread));
+  AddGlobalEntries(&net_log, kEntriesPerThread);
+  thread.Stop();
+
+  logger.StopObserving();
+  EXPECT_EQ(0, logger.dropped_event_count());
+
+  scoped_ptr<base::DictionaryValue> converted(ReadConvertedLog());
+  ASSERT_TRUE(converted);
+  base::ListValue* events = NULL;
+  ASSERT_TRUE(converted->GetList("events", &events));
+  ASSERT_EQ(static_cast<size_t>(2 * kEntriesPerThread), events->GetSize());
+  int64 last_time = 0;
+  for (size_t i = 0; i < events->GetSize(); ++i) {
+    base::DictionaryValue* event = NULL;
+    ASSERT_TRUE(events->GetDictionary(i, &event));
+    std::string time_string;
+    int64 time = 0;
+    ASSERT_TRUE(event->GetString("time", &time_string));
+    ASSERT_TRUE(base::StringToInt64(time_string, &time));
+    EXPECT_LE(last_time, time);
+    last_time = time;
+  }
+}
+
+TEST_F(NetLogBinaryLoggerTest, IgnoresTruncatedRecord) {
+  {
+    FILE* file = file_util::OpenFile(log_path_, "wb");
+    ASSERT_TRUE(file);
+    scoped_ptr<base::Value> constants(NetLogLogger::GetConstants());
+    NetLogBinaryLogger logger(file, *constants);
+    AddEntries(&logger, base::TimeTicks::Now(), 3);
+  }
+
+  std::string binary_log;
+  ASSERT_TRUE(file_util::ReadFileToString(log_path_, &binary_log));
+  binary_log.resize(binary_log.size() - 1);
+  scoped_ptr<base::DictionaryValue> converted(ParseConvertedLog(binary_log));
+  ASSERT_TRUE(converted);
+  base::ListValue* events = NULL;
+  ASSERT_TRUE(converted->GetList("events", &events));
+  EXPECT_EQ(2u, events->GetSize());
+
+  std::string json;
+  EXPECT_FALSE(NetLogBinaryLogger::ConvertToJson("{\"constants\"", &json));
+}
+
+TEST_F(NetLogBinaryLoggerTest, DropsEventsWhenRingBufferIsFull) {
+  // Without a writer thread, nothing drains the ring buffer until the
+  // logger is destroyed.
+  const int kEntries = 10000;
+  FILE* file = file_util::OpenFile(log_path_, "wb");
+  ASSERT_TRUE(file);
+  scoped_ptr<base::Value> constants(NetLogLogger::GetConstants());
+  int written_entries = 0;
+  {
+    NetLogBinaryLogger logger(file, *constants);
+    AddEntries(&logger, base::TimeTicks::Now(), kEntries);
+    EXPECT_LT(0, logger.dropped_event_count());
+    written_entries = kEntries - logger.dropped_event_count();
+  }
+
+  scoped_ptr<base::DictionaryValue> converted(ReadConvertedLog());
+  ASSERT_TRUE(converted);
+  base::ListValue* events = NULL;
+  ASSERT_TRUE(converted->GetList("events", &events));
+  EXPECT_EQ(static_cast<size_t>(written_entries), events->GetSize());
+}
+
+}  // namespace
+
+}  // namespace net
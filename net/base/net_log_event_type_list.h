@@ -65,6 +65,19 @@ EVENT_TYPE(HOST_RESOLVER_IMPL_IPV6_SUPPORTED)
 // This event is logged when a request is handled by a cache entry.
 EVENT_TYPE(HOST_RESOLVER_IMPL_CACHE_HIT)
 
+// This event is logged when a request is handled by a cache entry that has
+// expired, but is kept around to be served while it is refreshed.
+//
+//   {
+//     "expired_by_ms": <How long ago the entry expired>,
+//   }
+EVENT_TYPE(HOST_RESOLVER_IMPL_STALE_CACHE_HIT)
+
+// This event is logged when a cache hit starts a HostResolverImpl::Job to
+// refresh the entry in the background, because it has expired, or is popular
+// and about to expire. The request does not wait for the Job.
+EVENT_TYPE(HOST_RESOLVER_IMPL_CACHE_REFRESH)
+
 // This event is logged when a request is handled by a HOSTS entry.
 EVENT_TYPE(HOST_RESOLVER_IMPL_HOSTS_HIT)
 
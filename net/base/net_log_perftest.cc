@@ -0,0 +1,95 @@
+// Copyright 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <stdio.h>
+
+#include "base/bind.h"
+#include "base/file_util.h"
+#include "base/files/scoped_temp_dir.h"
+#include "base/memory/scoped_ptr.h"
+#include "base/perftimer.h"
+#include "base/values.h"
+#include "net/base/net_log.h"
+#include "net/base/net_log_binary_logger.h"
+#include "net/base/net_log_logger.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace net {
+
+namespace {
+
+const int kIterations = 100000;
+
+base::Value* ParametersCallback(int index, NetLog::LogLevel log_level) {
+  base::DictionaryValue* dict = new base::DictionaryValue();
+  dict->SetInteger("index", index);
+  dict->SetString("url", "http://www.example.com/index.html");
+  dict->SetBoolean("flag", true);
+  return dict;
+}
+
+// Adds about the mix of entries a request adds: half of them with
+// parameters.
+void AddEntries(const char* test_name, NetLog* net_log) {
+  BoundNetLog bound_net_log =
+      BoundNetLog::Make(net_log, NetLog::SOURCE_URL_REQUEST);
+  PerfTimeLogger timer(test_name);
+  for (int i = 0; i < kIterations; ++i) {
+    if (i % 2 == 0) {
+      bound_net_log.AddEvent(NetLog::TYPE_URL_REQUEST_START_JOB,
+                             base::Bind(&ParametersCallback, i));
+    } else {
+      bound_net_log.AddEvent(NetLog::TYPE_CANCELLED);
+    }
+  }
+  timer.Done();
+}
+
+class NetLogPerfTest : public testing::Test {
+ public:
+  virtual void SetUp() {
+    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
+    constants_.reset(NetLogLogger::GetConstants());
+  }
+
+ protected:
+  FILE* OpenLogFile(const char* mode) {
+    return file_util::OpenFile(temp_dir_.path().AppendASCII("NetLogFile"),
+                               mode);
+  }
+
+  base::ScopedTempDir temp_dir_;
+  scoped_ptr<base::Value> constants_;
+};
+
+TEST_F(NetLogPerfTest, NotLogging) {
+  NetLog net_log;
+  AddEntries("NetLog_AddEntry_NotLogging", &net_log);
+}
+
+TEST_F(NetLogPerfTest, JsonLogger) {
+  NetLog net_log;
+  FILE* file = OpenLogFile("w");
+  ASSERT_TRUE(file);
+  NetLogLogger logger(file, *constants_);
+  logger.StartObserving(&net_log);
+  AddEntries("NetLog_AddEntry_JsonLogger", &net_log);
+  logger.StopObserving();
+}
+
+TEST_F(NetLogPerfTest, BinaryLogger) {
+  NetLog net_log;
+  FILE* file = OpenLogFile("wb");
+  ASSERT_TRUE(file);
+  NetLogBinaryLogger logger(file, *constants_);
+  logger.StartObserving(&net_log, NetLog::LOG_ALL_BUT_BYTES);
+  AddEntries("NetLog_AddEntry_BinaryLogger", &net_log);
+  logger.StopObserving();
+  printf("Dropped %d of %d events\n", logger.dropped_event_count(),
+         kIterations);
+}
+
+}  // namespace
+
+}  // namespace net
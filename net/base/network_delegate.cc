@@ -125,6 +125,12 @@ bool NetworkDelegate::CanEnablePrivacyMode(
   return OnCanEnablePrivacyMode(url, first_party_for_cookies);
 }
 
+bool NetworkDelegate::CanPersistSdchDictionary(
+    const URLRequest& request) const {
+  DCHECK(CalledOnValidThread());
+  return OnCanPersistSdchDictionary(request);
+}
+
 bool NetworkDelegate::OnCanEnablePrivacyMode(
     const GURL& url,
     const GURL& first_party_for_cookies) const {
@@ -132,6 +138,12 @@ bool NetworkDelegate::OnCanEnablePrivacyMode(
   return false;
 }
 
+bool NetworkDelegate::OnCanPersistSdchDictionary(
+    const URLRequest& request) const {
+  // Default implementation allows dictionaries to be persisted.
+  return true;
+}
+
 int NetworkDelegate::NotifyBeforeSocketStreamConnect(
     SocketStream* socket,
     const CompletionCallback& callback) {
@@ -201,6 +201,27 @@ class PriorityQueue : public base::NonThreadSafe {
     return Pointer();
   }
 
+  // Returns a pointer to the value that follows |pointer| in FirstMax() order,
+  // that is, the next value of the same priority or else the first value of
+  // the next lower priority. Returns a null-pointer if |pointer| points to the
+  // last value in that order.
+  Pointer GetNextTowardsLastMin(const Pointer& pointer) {
+    DCHECK(CalledOnValidThread());
+    DCHECK(!pointer.is_null());
+    DCHECK_LT(pointer.priority_, lists_.size());
+
+    Priority priority = pointer.priority_;
+    typename List::iterator it = pointer.iterator_;
+    ++it;
+    while (it == lists_[priority].end()) {
+      if (priority == 0u)
+        return Pointer();
+      --priority;
+      it = lists_[priority].begin();
+    }
+    return Pointer(priority, it);
+  }
+
   // Empties the queue. All pointers become invalid.
   void Clear() {
     DCHECK(CalledOnValidThread());
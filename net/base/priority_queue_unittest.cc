@@ -100,6 +100,22 @@ TEST_F(PriorityQueueTest, EraseFromMiddle) {
   CheckEmpty();
 }
 
+TEST_F(PriorityQueueTest, GetNextTowardsLastMin) {
+  size_t count = 0;
+  for (PriorityQueue<int>::Pointer pointer = queue_.FirstMax();
+       !pointer.is_null(); pointer = queue_.GetNextTowardsLastMin(pointer)) {
+    ASSERT_LT(count, kNumElements);
+    EXPECT_EQ(kFirstMaxOrder[count], pointer.value());
+    ++count;
+  }
+  EXPECT_EQ(kNumElements, count);
+  // Iterating does not modify the queue.
+  EXPECT_EQ(kNumElements, queue_.size());
+
+  queue_.Erase(pointers_[kLastMinOrder[0]]);
+  EXPECT_TRUE(queue_.GetNextTowardsLastMin(queue_.LastMin()).is_null());
+}
+
 }  // namespace
 
 }  // namespace net
@@ -0,0 +1,5269 @@
+/* This file is generated by net/tools/dafsa/make_dafsa.py.
+   DO NOT EDIT! */
+
+const unsigned char kDafsa[63162] = {
+  0x00, 0x40, 0x61, 0x1a, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+  0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14,
+  0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x00, 0x00, 0x6c, 0x00, 0x07, 0xbd,
+  0x00, 0x08, 0x2f, 0x00, 0x0a, 0x6d, 0x00, 0x0b, 0xca, 0x00, 0x10, 0x2d,
+  0x00, 0x10, 0xea, 0x00, 0x16, 0xce, 0x00, 0x18, 0x19, 0x00, 0x19, 0xa8,
+  0x00, 0x1a, 0x56, 0x00, 0x1d, 0x83, 0x00, 0x27, 0x0c, 0x00, 0x50, 0x5a,
+  0x00, 0x53, 0xb2, 0x00, 0x80, 0x64, 0x00, 0xcf, 0xd5, 0x00, 0xcf, 0xe8,
+  0x00, 0xd6, 0x50, 0x00, 0xd9, 0xe3, 0x00, 0xe8, 0xfb, 0x00, 0xf1, 0xa0,
+  0x00, 0xf2, 0x7e, 0x00, 0xf3, 0xbd, 0x00, 0xf4, 0x1e, 0x00, 0xf5, 0x31,
+  0x00, 0x40, 0x32, 0x49, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x07,
+  0x00, 0x00, 0x08, 0x09, 0x0a, 0x00, 0x0b, 0x0c, 0x0d, 0x0e, 0x00, 0x0f,
+  0x10, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0xec, 0x00, 0x00, 0xfd, 0x00,
+  0x01, 0x21, 0x00, 0x01, 0x2d, 0x00, 0x01, 0x9e, 0x00, 0x01, 0xed, 0x00,
+  0x02, 0x2e, 0x00, 0x02, 0x33, 0x00, 0x02, 0x87, 0x00, 0x02, 0xb4, 0x00,
+  0x03, 0x44, 0x00, 0x03, 0xfe, 0x00, 0x01, 0x08, 0x00, 0x04, 0x38, 0x00,
+  0x04, 0x7a, 0x00, 0x01, 0xed, 0x00, 0x07, 0xba, 0x0e, 0x65, 0x79, 0x68,
+  0x33, 0x6c, 0x61, 0x32, 0x63, 0x6b, 0x78, 0x2d, 0x2d, 0x6e, 0x78, 0x80,
+  0x00, 0x00, 0x00, 0x02, 0x31, 0x6c, 0x00, 0x01, 0x08, 0x00, 0x01, 0x17,
+  0x0c, 0x66, 0x34, 0x61, 0x33, 0x61, 0x62, 0x67, 0x6d, 0x2d, 0x2d, 0x6e,
+  0x78, 0x80, 0x00, 0x07, 0x62, 0x67, 0x77, 0x2d, 0x2d, 0x6e, 0x78, 0x80,
+  0x00, 0x09, 0x38, 0x33, 0x78, 0x6e, 0x6e, 0x2d, 0x2d, 0x6e, 0x78, 0x80,
+  0x00, 0x00, 0x80, 0x01, 0x2e, 0x00, 0x01, 0x34, 0x00, 0x40, 0x61, 0x16,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x04,
+  0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x08, 0x09, 0x0a, 0x00, 0x01,
+  0x6c, 0x00, 0x01, 0x72, 0x00, 0x01, 0x77, 0x00, 0x01, 0x7d, 0x00, 0x01,
+  0x82, 0x00, 0x01, 0x87, 0x00, 0x01, 0x8b, 0x00, 0x01, 0x8f, 0x00, 0x01,
+  0x94, 0x00, 0x01, 0x99, 0x03, 0x73, 0x6e, 0x75, 0x80, 0x00, 0x02, 0x72,
+  0x6f, 0x80, 0x00, 0x03, 0x62, 0x6e, 0x75, 0x80, 0x00, 0x02, 0x69, 0x6d,
+  0x80, 0x00, 0x02, 0x6f, 0x63, 0x80, 0x00, 0x01, 0x63, 0x80, 0x00, 0x01,
+  0x72, 0x80, 0x00, 0x02, 0x65, 0x6e, 0x80, 0x00, 0x02, 0x64, 0x65, 0x80,
+  0x00, 0x02, 0x6f, 0x67, 0x80, 0x00, 0x00, 0x80, 0x01, 0x2e, 0x00, 0x01,
+  0xa5, 0x00, 0x40, 0x62, 0x14, 0x01, 0x02, 0x00, 0x03, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0x06, 0x00, 0x07, 0x08, 0x00, 0x00, 0x00, 0x09, 0x0a,
+  0x0b, 0x00, 0x01, 0xde, 0x00, 0x01, 0xf0, 0x00, 0x01, 0xff, 0x00, 0x02,
+  0x03, 0x00, 0x02, 0x07, 0x00, 0x02, 0x03, 0x00, 0x02, 0x12, 0x00, 0x02,
+  0x16, 0x00, 0x02, 0x03, 0x00, 0x02, 0x1a, 0x00, 0x02, 0x03, 0x00, 0x00,
+  0x03, 0x61, 0x6d, 0x6e, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x01,
+  0xed, 0x00, 0x80, 0x00, 0x00, 0x00, 0x03, 0x62, 0x67, 0x71, 0x00, 0x01,
+  0xed, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x01, 0x70, 0x80, 0x00, 0x01,
+  0x6e, 0x80, 0x00, 0x00, 0x00, 0x02, 0x73, 0x79, 0x00, 0x01, 0xed, 0x00,
+  0x01, 0xed, 0x01, 0x6f, 0x80, 0x00, 0x01, 0x63, 0x84, 0x00, 0x00, 0x00,
+  0x02, 0x6e, 0x6f, 0x00, 0x01, 0xed, 0x00, 0x02, 0x25, 0x06, 0x70, 0x73,
+  0x67, 0x6f, 0x6c, 0x62, 0x84, 0x00, 0x02, 0x73, 0x61, 0x80, 0x00, 0x00,
+  0x80, 0x01, 0x2e, 0x00, 0x02, 0x3a, 0x00, 0x40, 0x63, 0x14, 0x01, 0x00,
+  0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x04, 0x00,
+  0x00, 0x05, 0x00, 0x06, 0x07, 0x08, 0x00, 0x02, 0x6a, 0x00, 0x01, 0x72,
+  0x00, 0x01, 0x82, 0x00, 0x02, 0x6d, 0x00, 0x02, 0x73, 0x00, 0x02, 0x78,
+  0x00, 0x01, 0x94, 0x00, 0x01, 0x99, 0x00, 0x84, 0x00, 0x03, 0x66, 0x6e,
+  0x69, 0x80, 0x00, 0x02, 0x65, 0x70, 0x80, 0x00, 0x00, 0x00, 0x02, 0x65,
+  0x6e, 0x00, 0x02, 0x03, 0x00, 0x02, 0x83, 0x01, 0x69, 0x80, 0x00, 0x00,
+  0x80, 0x01, 0x2e, 0x00, 0x02, 0x8e, 0x00, 0x00, 0x06, 0x63, 0x67, 0x6f,
+  0x73, 0x74, 0x76, 0x00, 0x02, 0xa9, 0x00, 0x01, 0x72, 0x00, 0x01, 0x87,
+  0x00, 0x02, 0xad, 0x00, 0x01, 0x8f, 0x00, 0x01, 0x99, 0x01, 0x61, 0x80,
+  0x00, 0x04, 0x73, 0x65, 0x72, 0x70, 0x80, 0x00, 0x00, 0x80, 0x01, 0x2e,
+  0x00, 0x02, 0xbb, 0x00, 0x40, 0x61, 0x18, 0x01, 0x00, 0x02, 0x00, 0x03,
+  0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x06, 0x07, 0x08, 0x09, 0x00, 0x00,
+  0x0a, 0x0b, 0x00, 0x00, 0x0c, 0x00, 0x0d, 0x00, 0x01, 0x87, 0x00, 0x01,
+  0x87, 0x00, 0x02, 0xfe, 0x00, 0x01, 0x72, 0x00, 0x03, 0x04, 0x00, 0x03,
+  0x0a, 0x00, 0x01, 0x82, 0x00, 0x02, 0x83, 0x00, 0x03, 0x12, 0x00, 0x03,
+  0x26, 0x00, 0x03, 0x31, 0x00, 0x03, 0x3c, 0x00, 0x03, 0x40, 0x03, 0x6d,
+  0x61, 0x6e, 0x80, 0x00, 0x03, 0x62, 0x6f, 0x6d, 0x80, 0x00, 0x05, 0x6f,
+  0x6f, 0x68, 0x63, 0x73, 0x80, 0x00, 0x00, 0x00, 0x03, 0x63, 0x66, 0x72,
+  0x00, 0x01, 0xed, 0x00, 0x03, 0x21, 0x00, 0x01, 0xff, 0x02, 0x6e, 0x69,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x64, 0x6f, 0x00, 0x01, 0xed, 0x00, 0x01,
+  0xed, 0x00, 0x00, 0x02, 0x75, 0x77, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed,
+  0x01, 0x74, 0x80, 0x00, 0x01, 0x6d, 0x80, 0x00, 0x00, 0x80, 0x03, 0x2e,
+  0x67, 0x72, 0x00, 0x03, 0x53, 0x00, 0x03, 0xae, 0x00, 0x03, 0xbc, 0x00,
+  0x40, 0x62, 0x14, 0x01, 0x02, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x00,
+  0x01, 0x99, 0x00, 0x02, 0xa9, 0x00, 0x03, 0x83, 0x00, 0x03, 0x92, 0x00,
+  0x03, 0x9d, 0x00, 0x03, 0xa9, 0x00, 0x01, 0x8f, 0x00, 0x01, 0x94, 0x00,
+  0x00, 0x02, 0x65, 0x6c, 0x00, 0x03, 0x40, 0x00, 0x03, 0x8e, 0x01, 0x73,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x6e, 0x72, 0x00, 0x02, 0x83, 0x00, 0x02,
+  0x12, 0x01, 0x6f, 0x00, 0x02, 0x63, 0x6e, 0x00, 0x01, 0xed, 0x00, 0x01,
+  0xed, 0x02, 0x62, 0x61, 0x80, 0x00, 0x0b, 0x37, 0x68, 0x79, 0x61, 0x62,
+  0x67, 0x6d, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x01, 0x61, 0x80, 0x01,
+  0x2e, 0x00, 0x03, 0xc4, 0x00, 0x00, 0x06, 0x34, 0x36, 0x69, 0x6e, 0x72,
+  0x73, 0x00, 0x03, 0xdf, 0x00, 0x03, 0xe5, 0x00, 0x03, 0xea, 0x00, 0x03,
+  0xea, 0x00, 0x03, 0xef, 0x00, 0x03, 0xf8, 0x03, 0x36, 0x31, 0x65, 0x80,
+  0x00, 0x02, 0x70, 0x69, 0x80, 0x00, 0x02, 0x72, 0x75, 0x80, 0x00, 0x06,
+  0x64, 0x64, 0x61, 0x2d, 0x6e, 0x69, 0x80, 0x00, 0x03, 0x69, 0x72, 0x69,
+  0x80, 0x00, 0x00, 0x80, 0x01, 0x2e, 0x00, 0x04, 0x05, 0x00, 0x40, 0x65,
+  0x12, 0x01, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x07, 0x08, 0x00, 0x02, 0xfe, 0x00, 0x01,
+  0x72, 0x00, 0x04, 0x33, 0x00, 0x01, 0x7d, 0x00, 0x01, 0x82, 0x00, 0x01,
+  0x8f, 0x00, 0x01, 0x94, 0x00, 0x01, 0x99, 0x02, 0x63, 0x73, 0x80, 0x00,
+  0x00, 0x80, 0x01, 0x2e, 0x00, 0x04, 0x3f, 0x00, 0x40, 0x62, 0x15, 0x01,
+  0x00, 0x02, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x07, 0x08, 0x00, 0x04, 0x70, 0x00,
+  0x04, 0x75, 0x00, 0x01, 0x72, 0x00, 0x04, 0x33, 0x00, 0x01, 0x82, 0x00,
+  0x01, 0x8f, 0x00, 0x01, 0x94, 0x00, 0x01, 0x99, 0x02, 0x75, 0x70, 0x80,
+  0x00, 0x02, 0x65, 0x6d, 0x80, 0x00, 0x00, 0x80, 0x01, 0x2e, 0x00, 0x04,
+  0x81, 0x00, 0x40, 0x61, 0x1a, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+  0x08, 0x09, 0x00, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x00, 0x10, 0x11,
+  0x12, 0x13, 0x14, 0x00, 0x00, 0x15, 0x16, 0x00, 0x04, 0xe1, 0x00, 0x03,
+  0x8e, 0x00, 0x05, 0x4f, 0x00, 0x05, 0x58, 0x00, 0x05, 0x7d, 0x00, 0x02,
+  0x83, 0x00, 0x05, 0x92, 0x00, 0x05, 0x9d, 0x00, 0x05, 0xa1, 0x00, 0x05,
+  0xc4, 0x00, 0x06, 0x2e, 0x00, 0x06, 0x5b, 0x00, 0x06, 0x73, 0x00, 0x06,
+  0x9c, 0x00, 0x06, 0xad, 0x00, 0x06, 0xbc, 0x00, 0x05, 0x9d, 0x00, 0x06,
+  0xe1, 0x00, 0x01, 0x94, 0x00, 0x06, 0xf0, 0x00, 0x07, 0x6b, 0x00, 0x07,
+  0xb6, 0x00, 0x00, 0x06, 0x63, 0x65, 0x69, 0x73, 0x74, 0x76, 0x00, 0x04,
+  0xfc, 0x00, 0x05, 0x04, 0x00, 0x05, 0x0b, 0x00, 0x05, 0x2b, 0x00, 0x05,
+  0x41, 0x00, 0x05, 0x47, 0x05, 0x69, 0x6e, 0x6e, 0x69, 0x76, 0x80, 0x00,
+  0x04, 0x6d, 0x69, 0x72, 0x63, 0x80, 0x00, 0x00, 0x00, 0x02, 0x68, 0x73,
+  0x00, 0x05, 0x16, 0x00, 0x05, 0x22, 0x09, 0x7a, 0x68, 0x7a, 0x69, 0x72,
+  0x6f, 0x70, 0x61, 0x7a, 0x80, 0x00, 0x06, 0x74, 0x79, 0x6e, 0x6e, 0x69,
+  0x76, 0x80, 0x00, 0x00, 0x00, 0x02, 0x65, 0x73, 0x00, 0x05, 0x36, 0x00,
+  0x05, 0x3b, 0x02, 0x64, 0x6f, 0x80, 0x00, 0x03, 0x65, 0x64, 0x6f, 0x80,
+  0x00, 0x03, 0x6c, 0x61, 0x79, 0x80, 0x00, 0x05, 0x61, 0x74, 0x6c, 0x6f,
+  0x70, 0x80, 0x00, 0x06, 0x69, 0x6e, 0x69, 0x6d, 0x6f, 0x64, 0x80, 0x00,
+  0x00, 0x00, 0x02, 0x61, 0x6f, 0x00, 0x05, 0x63, 0x00, 0x05, 0x6e, 0x08,
+  0x72, 0x67, 0x6f, 0x76, 0x6f, 0x72, 0x69, 0x6b, 0x80, 0x00, 0x00, 0x80,
+  0x01, 0x72, 0x00, 0x05, 0x75, 0x05, 0x6f, 0x67, 0x68, 0x7a, 0x75, 0x80,
+  0x00, 0x00, 0x00, 0x03, 0x68, 0x6e, 0x74, 0x00, 0x05, 0x16, 0x00, 0x05,
+  0x8c, 0x00, 0x01, 0xed, 0x03, 0x76, 0x69, 0x72, 0x80, 0x00, 0x00, 0x00,
+  0x02, 0x6c, 0x72, 0x00, 0x01, 0xed, 0x00, 0x02, 0x12, 0x01, 0x6b, 0x80,
+  0x00, 0x00, 0x00, 0x02, 0x73, 0x79, 0x00, 0x05, 0xac, 0x00, 0x05, 0xb7,
+  0x08, 0x74, 0x76, 0x69, 0x6e, 0x72, 0x65, 0x68, 0x63, 0x80, 0x00, 0x0a,
+  0x6b, 0x73, 0x74, 0x79, 0x6e, 0x6c, 0x65, 0x6d, 0x68, 0x6b, 0x80, 0x00,
+  0x00, 0x00, 0x03, 0x63, 0x6d, 0x73, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed,
+  0x00, 0x05, 0xd3, 0x00, 0x00, 0x03, 0x6e, 0x74, 0x76, 0x00, 0x05, 0xe2,
+  0x00, 0x05, 0xe9, 0x00, 0x05, 0xfe, 0x04, 0x61, 0x67, 0x75, 0x6c, 0x80,
+  0x00, 0x00, 0x00, 0x02, 0x65, 0x75, 0x00, 0x05, 0xf4, 0x00, 0x05, 0xfa,
+  0x03, 0x6e, 0x6f, 0x64, 0x80, 0x00, 0x01, 0x6c, 0x80, 0x00, 0x00, 0x00,
+  0x02, 0x69, 0x6f, 0x00, 0x06, 0x09, 0x00, 0x06, 0x17, 0x0b, 0x6b, 0x6e,
+  0x61, 0x72, 0x66, 0x2d, 0x6f, 0x6e, 0x61, 0x76, 0x69, 0x80, 0x00, 0x07,
+  0x72, 0x74, 0x65, 0x70, 0x6f, 0x72, 0x70, 0x00, 0x02, 0x65, 0x69, 0x00,
+  0x06, 0x29, 0x00, 0x06, 0x29, 0x02, 0x6e, 0x64, 0x80, 0x00, 0x00, 0x00,
+  0x03, 0x69, 0x6f, 0x70, 0x00, 0x06, 0x3d, 0x00, 0x06, 0x46, 0x00, 0x01,
+  0xed, 0x06, 0x70, 0x6f, 0x6e, 0x72, 0x65, 0x74, 0x80, 0x00, 0x05, 0x70,
+  0x6f, 0x74, 0x73, 0x61, 0x00, 0x02, 0x62, 0x76, 0x00, 0x06, 0x56, 0x00,
+  0x06, 0x56, 0x02, 0x65, 0x73, 0x80, 0x00, 0x00, 0x00, 0x04, 0x6b, 0x6f,
+  0x73, 0x79, 0x00, 0x01, 0xed, 0x00, 0x01, 0x87, 0x00, 0x01, 0xed, 0x00,
+  0x06, 0x6e, 0x02, 0x72, 0x6b, 0x80, 0x00, 0x00, 0x00, 0x06, 0x63, 0x64,
+  0x69, 0x6f, 0x76, 0x79, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x01,
+  0xed, 0x00, 0x06, 0x8e, 0x00, 0x01, 0xed, 0x00, 0x06, 0x96, 0x05, 0x73,
+  0x72, 0x65, 0x68, 0x6b, 0x80, 0x00, 0x03, 0x6c, 0x6f, 0x76, 0x80, 0x00,
+  0x00, 0x00, 0x02, 0x63, 0x6e, 0x00, 0x01, 0xed, 0x00, 0x06, 0xa7, 0x03,
+  0x76, 0x6f, 0x72, 0x80, 0x00, 0x00, 0x00, 0x03, 0x64, 0x70, 0x7a, 0x00,
+  0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x00, 0x04, 0x63,
+  0x69, 0x6b, 0x79, 0x00, 0x01, 0xed, 0x00, 0x06, 0xcf, 0x00, 0x01, 0xed,
+  0x00, 0x06, 0xd8, 0x06, 0x6d, 0x6f, 0x74, 0x69, 0x68, 0x7a, 0x80, 0x00,
+  0x06, 0x6d, 0x6f, 0x74, 0x79, 0x68, 0x7a, 0x80, 0x00, 0x00, 0x00, 0x03,
+  0x65, 0x6c, 0x7a, 0x00, 0x02, 0x03, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed,
+  0x00, 0x00, 0x07, 0x63, 0x65, 0x69, 0x6b, 0x6c, 0x6f, 0x72, 0x00, 0x01,
+  0xed, 0x00, 0x07, 0x0f, 0x00, 0x07, 0x22, 0x00, 0x01, 0xed, 0x00, 0x01,
+  0xed, 0x00, 0x07, 0x51, 0x00, 0x01, 0xed, 0x00, 0x00, 0x02, 0x61, 0x69,
+  0x00, 0x07, 0x1a, 0x00, 0x05, 0x9d, 0x05, 0x6c, 0x6f, 0x6b, 0x69, 0x6e,
+  0x80, 0x00, 0x00, 0x00, 0x05, 0x61, 0x68, 0x6b, 0x76, 0x79, 0x00, 0x07,
+  0x39, 0x00, 0x07, 0x41, 0x00, 0x07, 0x4a, 0x00, 0x05, 0xfa, 0x00, 0x05,
+  0x9d, 0x05, 0x6c, 0x6f, 0x6b, 0x79, 0x6d, 0x80, 0x00, 0x06, 0x69, 0x6e,
+  0x72, 0x65, 0x68, 0x63, 0x80, 0x00, 0x04, 0x72, 0x61, 0x68, 0x6b, 0x80,
+  0x00, 0x00, 0x00, 0x02, 0x67, 0x6b, 0x00, 0x07, 0x5c, 0x00, 0x07, 0x4a,
+  0x00, 0x80, 0x01, 0x69, 0x00, 0x07, 0x63, 0x05, 0x6e, 0x72, 0x65, 0x68,
+  0x63, 0x80, 0x00, 0x00, 0x00, 0x03, 0x69, 0x6d, 0x73, 0x00, 0x07, 0x7a,
+  0x00, 0x07, 0x87, 0x00, 0x07, 0x8c, 0x0a, 0x6b, 0x73, 0x74, 0x69, 0x6e,
+  0x6c, 0x65, 0x6d, 0x68, 0x6b, 0x80, 0x00, 0x02, 0x75, 0x73, 0x80, 0x00,
+  0x00, 0x00, 0x03, 0x61, 0x73, 0x74, 0x00, 0x07, 0x9b, 0x00, 0x07, 0xa3,
+  0x00, 0x07, 0xac, 0x05, 0x6b, 0x72, 0x65, 0x68, 0x63, 0x80, 0x00, 0x06,
+  0x61, 0x6b, 0x72, 0x65, 0x68, 0x63, 0x80, 0x00, 0x07, 0x76, 0x6f, 0x6e,
+  0x72, 0x65, 0x68, 0x63, 0x80, 0x00, 0x01, 0x75, 0x80, 0x00, 0x00, 0x82,
+  0x00, 0x00, 0x00, 0x03, 0x62, 0x6c, 0x73, 0x00, 0x07, 0xcc, 0x00, 0x08,
+  0x11, 0x00, 0x08, 0x11, 0x00, 0x80, 0x01, 0x2e, 0x00, 0x07, 0xd3, 0x00,
+  0x40, 0x65, 0x16, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x05, 0x06, 0x07, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x08, 0x05, 0x00, 0x01, 0x72, 0x00, 0x01, 0x82, 0x00, 0x02,
+  0x6d, 0x00, 0x01, 0x8f, 0x00, 0x01, 0x94, 0x00, 0x01, 0x99, 0x00, 0x08,
+  0x0c, 0x04, 0x72, 0x6f, 0x74, 0x73, 0x80, 0x00, 0x02, 0x69, 0x62, 0x80,
+  0x00, 0x00, 0x80, 0x01, 0x2e, 0x00, 0x08, 0x18, 0x00, 0x00, 0x05, 0x67,
+  0x6d, 0x74, 0x75, 0x76, 0x00, 0x01, 0x72, 0x00, 0x01, 0x82, 0x00, 0x01,
+  0x8f, 0x00, 0x01, 0x94, 0x00, 0x01, 0x99, 0x00, 0x40, 0x31, 0x46, 0x01,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0x05, 0x06, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x09,
+  0x0a, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x0c, 0x00, 0x0d, 0x00, 0x08, 0xa0,
+  0x00, 0x08, 0xab, 0x00, 0x08, 0xb9, 0x00, 0x08, 0xf6, 0x00, 0x09, 0x26,
+  0x00, 0x09, 0x3a, 0x00, 0x09, 0x98, 0x00, 0x0a, 0x1e, 0x00, 0x0a, 0x40,
+  0x00, 0x0a, 0x58, 0x00, 0x08, 0x11, 0x00, 0x01, 0xed, 0x00, 0x0a, 0x66,
+  0x08, 0x68, 0x62, 0x67, 0x77, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x0b,
+  0x65, 0x39, 0x63, 0x32, 0x63, 0x7a, 0x66, 0x2d, 0x2d, 0x6e, 0x78, 0x80,
+  0x00, 0x02, 0x6a, 0x72, 0x00, 0x02, 0x62, 0x63, 0x00, 0x08, 0xc6, 0x00,
+  0x08, 0xed, 0x00, 0x00, 0x03, 0x32, 0x35, 0x39, 0x00, 0x08, 0xd5, 0x00,
+  0x08, 0xdd, 0x00, 0x08, 0xe5, 0x05, 0x68, 0x2d, 0x2d, 0x6e, 0x78, 0x80,
+  0x00, 0x05, 0x34, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x05, 0x73, 0x2d,
+  0x2d, 0x6e, 0x78, 0x80, 0x00, 0x06, 0x65, 0x67, 0x2d, 0x2d, 0x6e, 0x78,
+  0x80, 0x00, 0x00, 0x80, 0x02, 0x2e, 0x33, 0x00, 0x09, 0x01, 0x00, 0x09,
+  0x1c, 0x00, 0x00, 0x06, 0x67, 0x6c, 0x6d, 0x74, 0x75, 0x76, 0x00, 0x01,
+  0x72, 0x00, 0x01, 0x7d, 0x00, 0x01, 0x82, 0x00, 0x01, 0x8f, 0x00, 0x01,
+  0x94, 0x00, 0x01, 0x99, 0x07, 0x61, 0x30, 0x39, 0x2d, 0x2d, 0x6e, 0x78,
+  0x80, 0x00, 0x11, 0x66, 0x37, 0x36, 0x61, 0x30, 0x63, 0x37, 0x79, 0x6c,
+  0x71, 0x62, 0x67, 0x6d, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x00, 0x80,
+  0x02, 0x2e, 0x30, 0x00, 0x09, 0x45, 0x00, 0x09, 0x8a, 0x00, 0x00, 0x03,
+  0x67, 0x72, 0x73, 0x00, 0x09, 0x54, 0x00, 0x09, 0x5f, 0x00, 0x09, 0x6c,
+  0x08, 0x6e, 0x69, 0x70, 0x70, 0x61, 0x72, 0x63, 0x73, 0x84, 0x00, 0x0a,
+  0x65, 0x76, 0x72, 0x65, 0x73, 0x2d, 0x65, 0x6d, 0x61, 0x67, 0x84, 0x00,
+  0x00, 0x00, 0x02, 0x6f, 0x73, 0x00, 0x09, 0x77, 0x00, 0x09, 0x80, 0x06,
+  0x74, 0x6f, 0x68, 0x70, 0x79, 0x6d, 0x84, 0x00, 0x07, 0x65, 0x63, 0x63,
+  0x61, 0x70, 0x74, 0x66, 0x84, 0x00, 0x0b, 0x61, 0x74, 0x66, 0x37, 0x62,
+  0x34, 0x35, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x00, 0x80, 0x01, 0x2e,
+  0x00, 0x09, 0x9f, 0x00, 0x40, 0x32, 0x45, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x05, 0x06, 0x07, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x09, 0x0a, 0x0b, 0x00, 0x0a, 0x09, 0x00, 0x01, 0x99, 0x00, 0x04,
+  0x75, 0x00, 0x01, 0x72, 0x00, 0x01, 0x7d, 0x00, 0x01, 0x82, 0x00, 0x0a,
+  0x0e, 0x00, 0x0a, 0x13, 0x00, 0x01, 0x8f, 0x00, 0x01, 0x94, 0x00, 0x01,
+  0x99, 0x02, 0x31, 0x6b, 0x80, 0x00, 0x02, 0x69, 0x66, 0x80, 0x00, 0x00,
+  0x00, 0x02, 0x66, 0x72, 0x00, 0x03, 0x21, 0x00, 0x01, 0xff, 0x00, 0x80,
+  0x01, 0x2e, 0x00, 0x0a, 0x25, 0x00, 0x00, 0x06, 0x67, 0x6d, 0x6f, 0x74,
+  0x75, 0x76, 0x00, 0x01, 0x72, 0x00, 0x01, 0x82, 0x00, 0x01, 0x87, 0x00,
+  0x01, 0x8f, 0x00, 0x01, 0x94, 0x00, 0x01, 0x99, 0x00, 0x80, 0x01, 0x2e,
+  0x00, 0x0a, 0x47, 0x00, 0x00, 0x02, 0x6d, 0x6f, 0x00, 0x03, 0x3c, 0x00,
+  0x0a, 0x52, 0x03, 0x73, 0x73, 0x61, 0x80, 0x00, 0x00, 0x80, 0x01, 0x2e,
+  0x00, 0x0a, 0x5f, 0x04, 0x6f, 0x73, 0x73, 0x61, 0x80, 0x00, 0x00, 0x80,
+  0x01, 0x2e, 0x00, 0x09, 0x01, 0x00, 0x40, 0x33, 0x42, 0x01, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x00, 0x00,
+  0x00, 0x06, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x09, 0x0a, 0x00, 0x0a, 0xd1, 0x00, 0x0a, 0xf4, 0x00, 0x0b, 0x00,
+  0x00, 0x07, 0xba, 0x00, 0x0b, 0x0d, 0x00, 0x01, 0xed, 0x00, 0x0b, 0x34,
+  0x00, 0x01, 0xed, 0x00, 0x0b, 0x83, 0x00, 0x0b, 0xb8, 0x00, 0x00, 0x02,
+  0x31, 0x63, 0x00, 0x0a, 0xdc, 0x00, 0x0a, 0xe7, 0x08, 0x77, 0x72, 0x70,
+  0x6b, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x0a, 0x39, 0x6a, 0x72, 0x63,
+  0x70, 0x66, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x09, 0x35, 0x79, 0x72,
+  0x70, 0x6b, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x00, 0x80, 0x01, 0x2e,
+  0x00, 0x0b, 0x07, 0x03, 0x6d, 0x6f, 0x6e, 0x80, 0x00, 0x00, 0x80, 0x02,
+  0x2e, 0x67, 0x00, 0x0b, 0x18, 0x00, 0x0b, 0x1e, 0x03, 0x76, 0x6f, 0x67,
+  0x80, 0x00, 0x13, 0x39, 0x61, 0x32, 0x67, 0x32, 0x62, 0x30, 0x61, 0x65,
+  0x30, 0x63, 0x68, 0x63, 0x6c, 0x63, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00,
+  0x00, 0x80, 0x01, 0x2e, 0x00, 0x0b, 0x3b, 0x00, 0x40, 0x62, 0x19, 0x01,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x06, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x08, 0x09,
+  0x00, 0x0b, 0x73, 0x00, 0x02, 0xa9, 0x00, 0x04, 0x33, 0x00, 0x01, 0x7d,
+  0x00, 0x0b, 0x78, 0x00, 0x02, 0x12, 0x00, 0x01, 0x8f, 0x00, 0x03, 0x40,
+  0x00, 0x08, 0x0c, 0x02, 0x65, 0x77, 0x80, 0x00, 0x00, 0x00, 0x02, 0x63,
+  0x67, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x80, 0x01, 0x2e, 0x00,
+  0x0b, 0x8a, 0x00, 0x00, 0x07, 0x64, 0x67, 0x6d, 0x6f, 0x74, 0x75, 0x76,
+  0x00, 0x04, 0x75, 0x00, 0x01, 0x72, 0x00, 0x01, 0x82, 0x00, 0x02, 0x6d,
+  0x00, 0x01, 0x8f, 0x00, 0x01, 0x94, 0x00, 0x0b, 0xa9, 0x00, 0x00, 0x02,
+  0x6f, 0x74, 0x00, 0x0b, 0xb4, 0x00, 0x01, 0xed, 0x01, 0x67, 0x80, 0x00,
+  0x00, 0x80, 0x01, 0x2e, 0x00, 0x0b, 0xbf, 0x08, 0x74, 0x6f, 0x70, 0x73,
+  0x67, 0x6f, 0x6c, 0x62, 0x84, 0x00, 0x00, 0x40, 0x31, 0x49, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04,
+  0x00, 0x05, 0x06, 0x00, 0x07, 0x00, 0x08, 0x09, 0x0a, 0x00, 0x0b, 0x0c,
+  0x00, 0x0d, 0x00, 0x0e, 0x0f, 0x00, 0x00, 0x10, 0x00, 0x00, 0x11, 0x00,
+  0x0c, 0x4a, 0x00, 0x0c, 0x59, 0x00, 0x0c, 0x66, 0x00, 0x0c, 0x8c, 0x00,
+  0x0c, 0xa8, 0x00, 0x0d, 0x37, 0x00, 0x0d, 0x8a, 0x00, 0x0d, 0xb7, 0x00,
+  0x0d, 0xc9, 0x00, 0x07, 0xba, 0x00, 0x0d, 0xe7, 0x00, 0x01, 0xed, 0x00,
+  0x0e, 0x4c, 0x00, 0x0e, 0x6e, 0x00, 0x0e, 0x84, 0x00, 0x0f, 0xb2, 0x00,
+  0x07, 0xba, 0x0c, 0x37, 0x61, 0x31, 0x68, 0x62, 0x62, 0x67, 0x6d, 0x2d,
+  0x2d, 0x6e, 0x78, 0x80, 0x00, 0x0a, 0x30, 0x37, 0x62, 0x30, 0x65, 0x33,
+  0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x00, 0x80, 0x01, 0x2e, 0x00, 0x0c,
+  0x6d, 0x00, 0x00, 0x07, 0x63, 0x67, 0x68, 0x6c, 0x6f, 0x74, 0x76, 0x00,
+  0x02, 0xa9, 0x00, 0x01, 0x72, 0x00, 0x04, 0x33, 0x00, 0x01, 0x7d, 0x00,
+  0x01, 0x87, 0x00, 0x01, 0x8f, 0x00, 0x01, 0x99, 0x00, 0x80, 0x01, 0x2e,
+  0x00, 0x0c, 0x93, 0x00, 0x00, 0x02, 0x63, 0x74, 0x00, 0x02, 0xa9, 0x00,
+  0x0c, 0x9e, 0x07, 0x6f, 0x70, 0x73, 0x67, 0x6f, 0x6c, 0x62, 0x84, 0x00,
+  0x00, 0x80, 0x02, 0x2e, 0x6f, 0x00, 0x0c, 0xb3, 0x00, 0x0d, 0x2f, 0x00,
+  0x00, 0x06, 0x65, 0x6b, 0x6d, 0x6e, 0x74, 0x7a, 0x00, 0x0c, 0xce, 0x00,
+  0x0c, 0xdd, 0x00, 0x0c, 0xe9, 0x00, 0x0c, 0xee, 0x00, 0x0c, 0x9e, 0x00,
+  0x0d, 0x0c, 0x0c, 0x64, 0x61, 0x72, 0x65, 0x67, 0x74, 0x6d, 0x75, 0x65,
+  0x61, 0x72, 0x74, 0x84, 0x00, 0x09, 0x65, 0x65, 0x67, 0x6e, 0x69, 0x65,
+  0x74, 0x73, 0x69, 0x84, 0x00, 0x02, 0x6f, 0x63, 0x84, 0x00, 0x00, 0x00,
+  0x02, 0x65, 0x69, 0x00, 0x0c, 0xf9, 0x00, 0x0d, 0x04, 0x08, 0x73, 0x67,
+  0x6e, 0x75, 0x74, 0x69, 0x65, 0x6c, 0x84, 0x00, 0x05, 0x65, 0x6d, 0x74,
+  0x73, 0x69, 0x84, 0x00, 0x03, 0x74, 0x65, 0x6e, 0x00, 0x02, 0x6d, 0x73,
+  0x00, 0x0d, 0x1a, 0x00, 0x0d, 0x22, 0x05, 0x69, 0x74, 0x62, 0x65, 0x6c,
+  0x84, 0x00, 0x0a, 0x61, 0x64, 0x74, 0x72, 0x65, 0x74, 0x74, 0x65, 0x75,
+  0x66, 0x84, 0x00, 0x05, 0x6e, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x00,
+  0x80, 0x01, 0x2e, 0x00, 0x0d, 0x3e, 0x00, 0x40, 0x62, 0x15, 0x01, 0x00,
+  0x02, 0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x09, 0x0a, 0x00, 0x0d, 0x75, 0x00, 0x04,
+  0x75, 0x00, 0x0a, 0x0e, 0x00, 0x01, 0x72, 0x00, 0x0d, 0x7a, 0x00, 0x0d,
+  0x7f, 0x00, 0x01, 0x82, 0x00, 0x0d, 0x85, 0x00, 0x01, 0x94, 0x00, 0x01,
+  0x99, 0x02, 0x69, 0x6c, 0x80, 0x00, 0x02, 0x72, 0x70, 0x80, 0x00, 0x03,
+  0x69, 0x69, 0x72, 0x80, 0x00, 0x02, 0x69, 0x61, 0x80, 0x00, 0x00, 0x80,
+  0x01, 0x2e, 0x00, 0x0d, 0x91, 0x00, 0x00, 0x06, 0x67, 0x6c, 0x6d, 0x74,
+  0x75, 0x76, 0x00, 0x01, 0x72, 0x00, 0x01, 0x7d, 0x00, 0x01, 0x82, 0x00,
+  0x0d, 0xac, 0x00, 0x01, 0x94, 0x00, 0x01, 0x99, 0x00, 0x00, 0x02, 0x65,
+  0x76, 0x00, 0x02, 0x03, 0x00, 0x01, 0xff, 0x00, 0x80, 0x01, 0x2e, 0x00,
+  0x0d, 0xbe, 0x00, 0x00, 0x02, 0x74, 0x76, 0x00, 0x0c, 0x9e, 0x00, 0x01,
+  0x99, 0x00, 0x80, 0x01, 0x2e, 0x00, 0x0d, 0xd0, 0x00, 0x00, 0x05, 0x67,
+  0x68, 0x6f, 0x74, 0x76, 0x00, 0x01, 0x72, 0x00, 0x04, 0x33, 0x00, 0x01,
+  0x87, 0x00, 0x01, 0x8f, 0x00, 0x01, 0x99, 0x00, 0x80, 0x02, 0x2e, 0x61,
+  0x00, 0x0d, 0xf2, 0x00, 0x0e, 0x21, 0x00, 0x00, 0x07, 0x63, 0x67, 0x6f,
+  0x73, 0x74, 0x75, 0x76, 0x00, 0x02, 0xa9, 0x00, 0x01, 0x72, 0x00, 0x01,
+  0x87, 0x00, 0x0e, 0x11, 0x00, 0x01, 0x8f, 0x00, 0x01, 0x94, 0x00, 0x0e,
+  0x16, 0x02, 0x74, 0x69, 0x80, 0x00, 0x00, 0x00, 0x02, 0x69, 0x6f, 0x00,
+  0x0d, 0x7a, 0x00, 0x0b, 0xb4, 0x01, 0x6e, 0x80, 0x01, 0x2e, 0x00, 0x0e,
+  0x29, 0x00, 0x00, 0x02, 0x72, 0x73, 0x00, 0x0e, 0x34, 0x00, 0x0e, 0x40,
+  0x09, 0x65, 0x68, 0x2e, 0x74, 0x6f, 0x67, 0x72, 0x6f, 0x66, 0x84, 0x00,
+  0x09, 0x69, 0x68, 0x2e, 0x74, 0x6f, 0x67, 0x72, 0x6f, 0x66, 0x84, 0x00,
+  0x00, 0x80, 0x01, 0x2e, 0x00, 0x0e, 0x53, 0x00, 0x00, 0x06, 0x62, 0x67,
+  0x6c, 0x6d, 0x74, 0x75, 0x00, 0x01, 0x99, 0x00, 0x01, 0x72, 0x00, 0x01,
+  0x7d, 0x00, 0x03, 0x9d, 0x00, 0x01, 0x8f, 0x00, 0x01, 0x94, 0x00, 0x80,
+  0x01, 0x2e, 0x00, 0x0e, 0x75, 0x00, 0x00, 0x03, 0x6d, 0x6f, 0x74, 0x00,
+  0x03, 0x9d, 0x00, 0x0a, 0x52, 0x00, 0x0c, 0x9e, 0x00, 0x80, 0x01, 0x2e,
+  0x00, 0x0e, 0x8b, 0x00, 0x40, 0x61, 0x1a, 0x01, 0x02, 0x03, 0x04, 0x05,
+  0x06, 0x07, 0x08, 0x09, 0x00, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x00,
+  0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x00, 0x01, 0xed,
+  0x00, 0x0e, 0xf1, 0x00, 0x0f, 0x0b, 0x00, 0x0f, 0x12, 0x00, 0x01, 0xed,
+  0x00, 0x01, 0xed, 0x00, 0x0f, 0x3c, 0x00, 0x0f, 0x43, 0x00, 0x0f, 0x4a,
+  0x00, 0x0f, 0x57, 0x00, 0x01, 0xed, 0x00, 0x0f, 0x63, 0x00, 0x0f, 0x6a,
+  0x00, 0x01, 0xed, 0x00, 0x0f, 0x89, 0x00, 0x01, 0xed, 0x00, 0x0f, 0x90,
+  0x00, 0x0f, 0x9d, 0x00, 0x01, 0xed, 0x00, 0x0f, 0x5e, 0x00, 0x01, 0xed,
+  0x00, 0x0f, 0xa4, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x80, 0x02,
+  0x69, 0x72, 0x00, 0x0e, 0xfc, 0x00, 0x0f, 0x03, 0x04, 0x62, 0x6e, 0x61,
+  0x6c, 0x80, 0x00, 0x05, 0x6f, 0x66, 0x6d, 0x6f, 0x6b, 0x80, 0x00, 0x00,
+  0x80, 0x01, 0x61, 0x00, 0x01, 0xed, 0x00, 0x80, 0x02, 0x62, 0x6e, 0x00,
+  0x01, 0xed, 0x00, 0x0f, 0x1d, 0x00, 0x00, 0x02, 0x61, 0x75, 0x00, 0x0f,
+  0x28, 0x00, 0x0f, 0x2d, 0x02, 0x72, 0x62, 0x80, 0x00, 0x0c, 0x62, 0x72,
+  0x6f, 0x66, 0x6c, 0x61, 0x6e, 0x75, 0x6d, 0x6d, 0x6f, 0x6b, 0x80, 0x00,
+  0x00, 0x80, 0x01, 0x72, 0x00, 0x02, 0x12, 0x00, 0x80, 0x01, 0x66, 0x00,
+  0x01, 0xed, 0x00, 0x80, 0x01, 0x74, 0x00, 0x0f, 0x51, 0x03, 0x72, 0x61,
+  0x70, 0x80, 0x00, 0x00, 0x80, 0x01, 0x73, 0x00, 0x0f, 0x5e, 0x02, 0x68,
+  0x66, 0x80, 0x00, 0x00, 0x80, 0x01, 0x74, 0x00, 0x01, 0xed, 0x00, 0x80,
+  0x02, 0x68, 0x6d, 0x00, 0x0f, 0x75, 0x00, 0x0f, 0x7a, 0x02, 0x73, 0x73,
+  0x80, 0x00, 0x0c, 0x79, 0x67, 0x73, 0x6b, 0x75, 0x72, 0x62, 0x72, 0x75,
+  0x74, 0x61, 0x6e, 0x80, 0x00, 0x00, 0x80, 0x01, 0x70, 0x00, 0x01, 0xed,
+  0x00, 0x80, 0x01, 0x73, 0x00, 0x0f, 0x97, 0x03, 0x65, 0x72, 0x70, 0x80,
+  0x00, 0x00, 0x80, 0x01, 0x6f, 0x00, 0x02, 0x25, 0x00, 0x80, 0x01, 0x75,
+  0x00, 0x0f, 0xab, 0x04, 0x76, 0x6d, 0x6f, 0x6b, 0x80, 0x00, 0x00, 0x80,
+  0x01, 0x2e, 0x00, 0x0f, 0xb9, 0x00, 0x40, 0x32, 0x45, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 0x06, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x08, 0x09, 0x00, 0x10, 0x1d, 0x00, 0x0b, 0x73,
+  0x00, 0x01, 0x72, 0x00, 0x01, 0x7d, 0x00, 0x01, 0x82, 0x00, 0x10, 0x22,
+  0x00, 0x01, 0x8f, 0x00, 0x01, 0x94, 0x00, 0x01, 0x99, 0x02, 0x31, 0x65,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x63, 0x66, 0x00, 0x01, 0xed, 0x00, 0x03,
+  0x21, 0x00, 0x40, 0x61, 0x17, 0x01, 0x02, 0x03, 0x00, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x08, 0x00, 0x08, 0x11, 0x00, 0x10, 0x60, 0x00, 0x0b,
+  0xb8, 0x00, 0x01, 0xed, 0x00, 0x10, 0x77, 0x00, 0x10, 0xd4, 0x00, 0x01,
+  0xed, 0x00, 0x01, 0xed, 0x00, 0x80, 0x02, 0x2e, 0x77, 0x00, 0x0b, 0x18,
+  0x00, 0x10, 0x6b, 0x09, 0x61, 0x39, 0x62, 0x67, 0x6d, 0x2d, 0x2d, 0x6e,
+  0x78, 0x80, 0x00, 0x00, 0x80, 0x01, 0x2e, 0x00, 0x10, 0x7e, 0x00, 0x40,
+  0x62, 0x13, 0x01, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x06, 0x07, 0x08, 0x00, 0x0b, 0x73,
+  0x00, 0x10, 0xad, 0x00, 0x08, 0x05, 0x00, 0x10, 0xb2, 0x00, 0x02, 0x6d,
+  0x00, 0x10, 0xbd, 0x00, 0x10, 0xce, 0x00, 0x01, 0x8f, 0x02, 0x65, 0x72,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x6f, 0x72, 0x00, 0x01, 0x87, 0x00, 0x0a,
+  0x0e, 0x01, 0x65, 0x00, 0x02, 0x68, 0x70, 0x00, 0x10, 0xc9, 0x00, 0x01,
+  0xed, 0x02, 0x74, 0x6f, 0x80, 0x00, 0x03, 0x74, 0x72, 0x61, 0x80, 0x00,
+  0x00, 0x80, 0x01, 0x2e, 0x00, 0x10, 0xdb, 0x00, 0x00, 0x03, 0x67, 0x6d,
+  0x75, 0x00, 0x01, 0x72, 0x00, 0x01, 0x82, 0x00, 0x01, 0x94, 0x00, 0x40,
+  0x33, 0x44, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x04, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x09, 0x0a, 0x00, 0x0b, 0x00, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x00, 0x11,
+  0x62, 0x00, 0x11, 0x6e, 0x00, 0x11, 0x82, 0x00, 0x11, 0x9c, 0x00, 0x12,
+  0x5e, 0x00, 0x12, 0x74, 0x00, 0x0d, 0xc9, 0x00, 0x0a, 0x66, 0x00, 0x12,
+  0xb1, 0x00, 0x12, 0xe9, 0x00, 0x07, 0xba, 0x00, 0x13, 0x0b, 0x00, 0x16,
+  0x74, 0x00, 0x01, 0xed, 0x00, 0x16, 0xa1, 0x00, 0x01, 0xed, 0x09, 0x39,
+  0x31, 0x77, 0x36, 0x6a, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x11, 0x38,
+  0x61, 0x34, 0x64, 0x35, 0x61, 0x34, 0x70, 0x72, 0x65, 0x62, 0x67, 0x6d,
+  0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x00, 0x80, 0x01, 0x2e, 0x00, 0x11,
+  0x89, 0x00, 0x00, 0x04, 0x67, 0x6d, 0x6f, 0x74, 0x00, 0x01, 0x72, 0x00,
+  0x03, 0x9d, 0x00, 0x01, 0x87, 0x00, 0x01, 0x8f, 0x00, 0x80, 0x01, 0x2e,
+  0x00, 0x11, 0xa3, 0x00, 0x40, 0x30, 0x4b, 0x01, 0x02, 0x03, 0x04, 0x05,
+  0x06, 0x07, 0x08, 0x09, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x0c, 0x0d, 0x0e,
+  0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a,
+  0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23, 0x24, 0x00, 0x01,
+  0xed, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x01,
+  0xed, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x01,
+  0xed, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x01,
+  0xed, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x01,
+  0xed, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x01,
+  0xed, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x01,
+  0xed, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x01,
+  0xed, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x01,
+  0xed, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x80,
+  0x01, 0x7a, 0x00, 0x12, 0x65, 0x0c, 0x61, 0x39, 0x61, 0x30, 0x63, 0x62,
+  0x67, 0x6d, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x00, 0x80, 0x01, 0x2e,
+  0x00, 0x12, 0x7b, 0x00, 0x40, 0x65, 0x12, 0x01, 0x00, 0x02, 0x00, 0x03,
+  0x00, 0x00, 0x04, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08,
+  0x09, 0x00, 0x02, 0xfe, 0x00, 0x01, 0x72, 0x00, 0x04, 0x33, 0x00, 0x01,
+  0x7d, 0x00, 0x01, 0x82, 0x00, 0x12, 0xac, 0x00, 0x01, 0x8f, 0x00, 0x01,
+  0x94, 0x00, 0x01, 0x99, 0x02, 0x75, 0x65, 0x80, 0x00, 0x00, 0x80, 0x01,
+  0x2e, 0x00, 0x12, 0xb8, 0x00, 0x00, 0x06, 0x64, 0x67, 0x6c, 0x6d, 0x75,
+  0x76, 0x00, 0x0d, 0x7a, 0x00, 0x01, 0x72, 0x00, 0x01, 0x7d, 0x00, 0x12,
+  0xd3, 0x00, 0x01, 0x94, 0x00, 0x01, 0x99, 0x00, 0x00, 0x02, 0x6f, 0x74,
+  0x00, 0x12, 0xde, 0x00, 0x01, 0xed, 0x00, 0x00, 0x02, 0x63, 0x6e, 0x00,
+  0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x80, 0x01, 0x2e, 0x00, 0x12, 0xf0,
+  0x00, 0x00, 0x06, 0x63, 0x67, 0x6d, 0x74, 0x75, 0x76, 0x00, 0x02, 0xa9,
+  0x00, 0x01, 0x72, 0x00, 0x01, 0x82, 0x00, 0x01, 0x8f, 0x00, 0x01, 0x94,
+  0x00, 0x01, 0x99, 0x01, 0x6f, 0x80, 0x01, 0x2e, 0x00, 0x13, 0x13, 0x00,
+  0x40, 0x61, 0x18, 0x01, 0x00, 0x00, 0x02, 0x03, 0x04, 0x05, 0x00, 0x00,
+  0x00, 0x06, 0x07, 0x00, 0x08, 0x09, 0x0a, 0x00, 0x0b, 0x0c, 0x0d, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x13, 0x59, 0x00, 0x13, 0x5d, 0x00, 0x13, 0xb0,
+  0x00, 0x14, 0x63, 0x00, 0x14, 0x6e, 0x00, 0x14, 0x7a, 0x00, 0x14, 0x93,
+  0x00, 0x14, 0xa1, 0x00, 0x14, 0xea, 0x00, 0x14, 0xf3, 0x00, 0x15, 0x28,
+  0x00, 0x15, 0x39, 0x00, 0x15, 0xc5, 0x00, 0x16, 0x56, 0x01, 0x7a, 0x84,
+  0x00, 0x00, 0x00, 0x04, 0x61, 0x65, 0x6e, 0x6f, 0x00, 0x13, 0x70, 0x00,
+  0x13, 0x7c, 0x00, 0x13, 0x9a, 0x00, 0x13, 0xa3, 0x09, 0x62, 0x2d, 0x79,
+  0x72, 0x65, 0x76, 0x2d, 0x73, 0x69, 0x84, 0x00, 0x00, 0x00, 0x02, 0x73,
+  0x76, 0x00, 0x13, 0x87, 0x00, 0x13, 0x92, 0x08, 0x75, 0x66, 0x6e, 0x6f,
+  0x63, 0x73, 0x69, 0x6d, 0x84, 0x00, 0x05, 0x61, 0x73, 0x2d, 0x73, 0x69,
+  0x84, 0x00, 0x06, 0x75, 0x6f, 0x66, 0x2d, 0x73, 0x69, 0x84, 0x00, 0x0a,
+  0x6f, 0x67, 0x2d, 0x79, 0x72, 0x65, 0x76, 0x2d, 0x73, 0x69, 0x84, 0x00,
+  0x00, 0x00, 0x07, 0x61, 0x63, 0x6c, 0x6d, 0x6e, 0x72, 0x74, 0x00, 0x02,
+  0x6a, 0x00, 0x13, 0xcf, 0x00, 0x13, 0xdc, 0x00, 0x13, 0xe9, 0x00, 0x14,
+  0x15, 0x00, 0x14, 0x1d, 0x00, 0x14, 0x30, 0x0a, 0x69, 0x6e, 0x2d, 0x79,
+  0x72, 0x65, 0x76, 0x2d, 0x73, 0x69, 0x84, 0x00, 0x0a, 0x61, 0x73, 0x2d,
+  0x34, 0x2d, 0x66, 0x66, 0x75, 0x74, 0x73, 0x84, 0x00, 0x00, 0x00, 0x03,
+  0x2d, 0x61, 0x6f, 0x00, 0x13, 0xf8, 0x00, 0x13, 0xff, 0x00, 0x14, 0x08,
+  0x04, 0x6d, 0x6f, 0x72, 0x66, 0x84, 0x00, 0x06, 0x67, 0x65, 0x76, 0x72,
+  0x65, 0x73, 0x84, 0x00, 0x0a, 0x68, 0x72, 0x75, 0x6f, 0x79, 0x73, 0x6c,
+  0x6c, 0x65, 0x73, 0x84, 0x00, 0x05, 0x6f, 0x7a, 0x64, 0x6f, 0x70, 0x84,
+  0x00, 0x10, 0x65, 0x68, 0x77, 0x6f, 0x6e, 0x67, 0x6e, 0x69, 0x6f, 0x67,
+  0x79, 0x6c, 0x64, 0x6c, 0x6f, 0x62, 0x84, 0x00, 0x00, 0x00, 0x02, 0x61,
+  0x69, 0x00, 0x14, 0x3b, 0x00, 0x14, 0x49, 0x0b, 0x64, 0x69, 0x64, 0x6e,
+  0x61, 0x63, 0x2d, 0x61, 0x2d, 0x73, 0x69, 0x84, 0x00, 0x01, 0x73, 0x00,
+  0x02, 0x2d, 0x67, 0x00, 0x14, 0x55, 0x00, 0x14, 0x5d, 0x05, 0x79, 0x62,
+  0x62, 0x6f, 0x68, 0x84, 0x00, 0x03, 0x6f, 0x6c, 0x62, 0x84, 0x00, 0x08,
+  0x65, 0x68, 0x63, 0x2d, 0x61, 0x2d, 0x73, 0x69, 0x84, 0x00, 0x09, 0x6f,
+  0x6c, 0x62, 0x79, 0x6d, 0x64, 0x61, 0x65, 0x72, 0x84, 0x00, 0x05, 0x65,
+  0x65, 0x67, 0x2d, 0x61, 0x00, 0x02, 0x2d, 0x73, 0x00, 0x14, 0x8a, 0x00,
+  0x14, 0x8f, 0x02, 0x73, 0x69, 0x84, 0x00, 0x01, 0x69, 0x84, 0x00, 0x0b,
+  0x69, 0x76, 0x65, 0x2d, 0x79, 0x72, 0x65, 0x76, 0x2d, 0x73, 0x69, 0x84,
+  0x00, 0x02, 0x61, 0x66, 0x00, 0x02, 0x73, 0x78, 0x00, 0x14, 0xae, 0x00,
+  0x14, 0xe0, 0x00, 0x00, 0x03, 0x63, 0x6e, 0x74, 0x00, 0x14, 0xbd, 0x00,
+  0x14, 0xca, 0x00, 0x14, 0xd6, 0x0a, 0x69, 0x74, 0x6c, 0x65, 0x63, 0x2d,
+  0x61, 0x2d, 0x73, 0x69, 0x84, 0x00, 0x09, 0x69, 0x75, 0x72, 0x62, 0x2d,
+  0x61, 0x2d, 0x73, 0x69, 0x84, 0x00, 0x07, 0x61, 0x70, 0x2d, 0x61, 0x2d,
+  0x73, 0x69, 0x84, 0x00, 0x07, 0x6f, 0x73, 0x2d, 0x61, 0x2d, 0x73, 0x69,
+  0x84, 0x00, 0x06, 0x6a, 0x6f, 0x64, 0x73, 0x6e, 0x64, 0x84, 0x00, 0x00,
+  0x00, 0x03, 0x69, 0x6f, 0x74, 0x00, 0x15, 0x02, 0x00, 0x15, 0x09, 0x00,
+  0x15, 0x10, 0x04, 0x66, 0x6c, 0x65, 0x73, 0x84, 0x00, 0x04, 0x68, 0x62,
+  0x65, 0x77, 0x84, 0x00, 0x02, 0x66, 0x65, 0x00, 0x02, 0x6d, 0x76, 0x00,
+  0x15, 0x1d, 0x00, 0x15, 0x22, 0x02, 0x6f, 0x68, 0x84, 0x00, 0x03, 0x72,
+  0x65, 0x73, 0x84, 0x00, 0x0e, 0x65, 0x73, 0x75, 0x2d, 0x78, 0x75, 0x6e,
+  0x69, 0x6c, 0x2d, 0x61, 0x2d, 0x73, 0x69, 0x84, 0x00, 0x00, 0x00, 0x05,
+  0x61, 0x62, 0x6e, 0x73, 0x75, 0x00, 0x15, 0x50, 0x00, 0x15, 0x68, 0x00,
+  0x15, 0x71, 0x00, 0x15, 0xbb, 0x00, 0x02, 0x6a, 0x03, 0x69, 0x6c, 0x61,
+  0x00, 0x02, 0x6e, 0x73, 0x00, 0x15, 0x5e, 0x00, 0x15, 0x63, 0x02, 0x79,
+  0x64, 0x84, 0x00, 0x02, 0x6e, 0x64, 0x84, 0x00, 0x06, 0x62, 0x65, 0x76,
+  0x72, 0x65, 0x73, 0x84, 0x00, 0x01, 0x64, 0x00, 0x06, 0x65, 0x67, 0x6d,
+  0x6e, 0x72, 0x74, 0x00, 0x15, 0x8d, 0x00, 0x14, 0x5d, 0x00, 0x15, 0x93,
+  0x00, 0x15, 0x99, 0x00, 0x15, 0xb1, 0x00, 0x15, 0xb6, 0x03, 0x6d, 0x6f,
+  0x68, 0x84, 0x00, 0x03, 0x6f, 0x6f, 0x64, 0x84, 0x00, 0x02, 0x79, 0x64,
+  0x84, 0x01, 0x2e, 0x00, 0x15, 0xa2, 0x00, 0x00, 0x02, 0x65, 0x6f, 0x00,
+  0x15, 0x8d, 0x00, 0x15, 0xad, 0x01, 0x67, 0x84, 0x00, 0x02, 0x76, 0x64,
+  0x84, 0x00, 0x02, 0x6f, 0x67, 0x84, 0x00, 0x07, 0x61, 0x2d, 0x73, 0x6b,
+  0x63, 0x69, 0x6b, 0x84, 0x00, 0x00, 0x00, 0x03, 0x65, 0x68, 0x73, 0x00,
+  0x15, 0xd4, 0x00, 0x16, 0x0d, 0x00, 0x16, 0x19, 0x00, 0x00, 0x02, 0x65,
+  0x6e, 0x00, 0x15, 0xdf, 0x00, 0x15, 0xec, 0x0a, 0x77, 0x73, 0x2d, 0x79,
+  0x72, 0x65, 0x76, 0x2d, 0x73, 0x69, 0x84, 0x00, 0x05, 0x72, 0x65, 0x74,
+  0x6e, 0x69, 0x00, 0x02, 0x65, 0x66, 0x00, 0x15, 0xfc, 0x00, 0x16, 0x06,
+  0x07, 0x68, 0x74, 0x66, 0x6f, 0x64, 0x6e, 0x65, 0x84, 0x00, 0x04, 0x6f,
+  0x64, 0x6e, 0x65, 0x84, 0x00, 0x09, 0x67, 0x69, 0x6e, 0x6b, 0x2d, 0x61,
+  0x2d, 0x73, 0x69, 0x84, 0x00, 0x00, 0x00, 0x02, 0x69, 0x6f, 0x00, 0x16,
+  0x24, 0x00, 0x16, 0x3d, 0x04, 0x78, 0x65, 0x74, 0x6e, 0x00, 0x02, 0x6f,
+  0x73, 0x00, 0x16, 0x33, 0x00, 0x16, 0x37, 0x01, 0x64, 0x84, 0x00, 0x03,
+  0x65, 0x6f, 0x64, 0x84, 0x00, 0x00, 0x00, 0x02, 0x68, 0x6c, 0x00, 0x16,
+  0x48, 0x00, 0x16, 0x50, 0x05, 0x2d, 0x65, 0x6d, 0x61, 0x67, 0x84, 0x00,
+  0x03, 0x2d, 0x73, 0x69, 0x84, 0x00, 0x00, 0x00, 0x02, 0x69, 0x75, 0x00,
+  0x16, 0x61, 0x00, 0x16, 0x6a, 0x06, 0x6e, 0x75, 0x65, 0x6d, 0x6f, 0x68,
+  0x84, 0x00, 0x07, 0x6e, 0x69, 0x6c, 0x65, 0x6d, 0x6f, 0x68, 0x84, 0x00,
+  0x00, 0x80, 0x01, 0x2e, 0x00, 0x16, 0x7b, 0x00, 0x00, 0x06, 0x67, 0x6d,
+  0x72, 0x74, 0x75, 0x76, 0x00, 0x01, 0x72, 0x00, 0x01, 0x82, 0x00, 0x02,
+  0x73, 0x00, 0x16, 0x96, 0x00, 0x01, 0x94, 0x00, 0x01, 0x99, 0x00, 0x00,
+  0x02, 0x65, 0x6f, 0x00, 0x02, 0x03, 0x00, 0x02, 0x25, 0x00, 0x80, 0x01,
+  0x2e, 0x00, 0x16, 0xa8, 0x00, 0x00, 0x06, 0x63, 0x65, 0x67, 0x6d, 0x6f,
+  0x72, 0x00, 0x16, 0xc3, 0x00, 0x02, 0x03, 0x00, 0x01, 0x72, 0x00, 0x01,
+  0x82, 0x00, 0x0b, 0x78, 0x00, 0x02, 0x12, 0x00, 0x00, 0x02, 0x61, 0x73,
+  0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x40, 0x30, 0x45, 0x01, 0x00,
+  0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x05, 0x06, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x09,
+  0x00, 0x00, 0x0a, 0x00, 0x00, 0x0b, 0x0c, 0x00, 0x17, 0x3b, 0x00, 0x17,
+  0x4d, 0x00, 0x17, 0x58, 0x00, 0x08, 0x11, 0x00, 0x0b, 0xb8, 0x00, 0x17,
+  0x67, 0x00, 0x17, 0x73, 0x00, 0x07, 0xba, 0x00, 0x17, 0x91, 0x00, 0x17,
+  0xa1, 0x00, 0x17, 0xd9, 0x00, 0x17, 0xf7, 0x0f, 0x65, 0x65, 0x35, 0x61,
+  0x33, 0x6c, 0x64, 0x32, 0x63, 0x6b, 0x78, 0x2d, 0x2d, 0x6e, 0x78, 0x80,
+  0x00, 0x08, 0x77, 0x63, 0x33, 0x6f, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00,
+  0x0c, 0x61, 0x37, 0x6d, 0x61, 0x61, 0x62, 0x67, 0x6d, 0x2d, 0x2d, 0x6e,
+  0x78, 0x80, 0x00, 0x09, 0x30, 0x73, 0x62, 0x67, 0x70, 0x2d, 0x2d, 0x6e,
+  0x78, 0x80, 0x00, 0x00, 0x80, 0x01, 0x2e, 0x00, 0x17, 0x7a, 0x00, 0x00,
+  0x05, 0x67, 0x6c, 0x6d, 0x75, 0x76, 0x00, 0x01, 0x72, 0x00, 0x01, 0x7d,
+  0x00, 0x01, 0x82, 0x00, 0x01, 0x94, 0x00, 0x01, 0x99, 0x00, 0x80, 0x01,
+  0x61, 0x00, 0x17, 0x98, 0x06, 0x31, 0x6a, 0x2d, 0x2d, 0x6e, 0x78, 0x80,
+  0x00, 0x00, 0x80, 0x01, 0x2e, 0x00, 0x17, 0xa8, 0x00, 0x40, 0x67, 0x10,
+  0x01, 0x00, 0x02, 0x00, 0x00, 0x03, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x00, 0x06, 0x07, 0x08, 0x00, 0x01, 0x72, 0x00, 0x01, 0xed, 0x00, 0x01,
+  0x7d, 0x00, 0x01, 0x82, 0x00, 0x17, 0xd4, 0x00, 0x01, 0x8f, 0x00, 0x01,
+  0x94, 0x00, 0x01, 0x99, 0x02, 0x67, 0x6e, 0x80, 0x00, 0x00, 0x80, 0x01,
+  0x2e, 0x00, 0x17, 0xe0, 0x00, 0x00, 0x05, 0x67, 0x6c, 0x6d, 0x74, 0x76,
+  0x00, 0x01, 0x72, 0x00, 0x01, 0x7d, 0x00, 0x01, 0x82, 0x00, 0x01, 0x8f,
+  0x00, 0x01, 0x99, 0x00, 0x80, 0x01, 0x2e, 0x00, 0x17, 0xfe, 0x00, 0x00,
+  0x06, 0x63, 0x69, 0x6e, 0x6f, 0x72, 0x74, 0x00, 0x02, 0xa9, 0x00, 0x03,
+  0x40, 0x00, 0x02, 0x83, 0x00, 0x0b, 0x78, 0x00, 0x02, 0x12, 0x00, 0x01,
+  0x8f, 0x00, 0x40, 0x61, 0x16, 0x01, 0x02, 0x03, 0x00, 0x00, 0x04, 0x05,
+  0x00, 0x00, 0x00, 0x06, 0x07, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0x00, 0x00, 0x0a, 0x00, 0x18, 0x51, 0x00, 0x18, 0x7c, 0x00, 0x18, 0x9e,
+  0x00, 0x19, 0x19, 0x00, 0x19, 0x3b, 0x00, 0x19, 0x64, 0x00, 0x01, 0xed,
+  0x00, 0x07, 0xba, 0x00, 0x01, 0xed, 0x00, 0x19, 0x8a, 0x00, 0x80, 0x02,
+  0x2e, 0x31, 0x00, 0x18, 0x5c, 0x00, 0x18, 0x74, 0x00, 0x00, 0x04, 0x66,
+  0x67, 0x6d, 0x74, 0x00, 0x18, 0x6f, 0x00, 0x01, 0x72, 0x00, 0x01, 0x82,
+  0x00, 0x01, 0x8f, 0x02, 0x66, 0x6f, 0x80, 0x00, 0x05, 0x70, 0x2d, 0x2d,
+  0x6e, 0x78, 0x80, 0x00, 0x00, 0x80, 0x02, 0x2e, 0x6f, 0x00, 0x18, 0x87,
+  0x00, 0x03, 0x40, 0x00, 0x00, 0x05, 0x67, 0x6d, 0x6f, 0x72, 0x75, 0x00,
+  0x01, 0x72, 0x00, 0x01, 0x82, 0x00, 0x01, 0x87, 0x00, 0x02, 0x12, 0x00,
+  0x01, 0x94, 0x00, 0x80, 0x01, 0x2e, 0x00, 0x18, 0xa5, 0x00, 0x40, 0x61,
+  0x16, 0x01, 0x00, 0x02, 0x03, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x06, 0x00, 0x07, 0x00, 0x00, 0x08, 0x00, 0x09, 0x0a, 0x0b, 0x00,
+  0x18, 0xe0, 0x00, 0x02, 0xa9, 0x00, 0x18, 0xf1, 0x00, 0x18, 0xfc, 0x00,
+  0x01, 0x72, 0x00, 0x01, 0x82, 0x00, 0x19, 0x04, 0x00, 0x02, 0x12, 0x00,
+  0x02, 0x78, 0x00, 0x01, 0x94, 0x00, 0x19, 0x13, 0x0e, 0x79, 0x62, 0x2d,
+  0x74, 0x72, 0x6f, 0x70, 0x6f, 0x72, 0x61, 0x2d, 0x2d, 0x6e, 0x78, 0x80,
+  0x00, 0x00, 0x00, 0x02, 0x65, 0x6d, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed,
+  0x05, 0x73, 0x73, 0x65, 0x72, 0x70, 0x80, 0x00, 0x00, 0x00, 0x03, 0x63,
+  0x67, 0x73, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x02, 0x2e, 0x03,
+  0x75, 0x6f, 0x67, 0x80, 0x00, 0x00, 0x80, 0x01, 0x2e, 0x00, 0x19, 0x20,
+  0x00, 0x00, 0x03, 0x64, 0x69, 0x74, 0x00, 0x19, 0x2f, 0x00, 0x19, 0x36,
+  0x00, 0x0c, 0x9e, 0x04, 0x6e, 0x61, 0x6c, 0x61, 0x80, 0x00, 0x02, 0x6b,
+  0x69, 0x84, 0x00, 0x00, 0x80, 0x01, 0x2e, 0x00, 0x19, 0x42, 0x00, 0x00,
+  0x05, 0x64, 0x67, 0x6d, 0x75, 0x76, 0x00, 0x19, 0x59, 0x00, 0x01, 0x72,
+  0x00, 0x01, 0x82, 0x00, 0x01, 0x94, 0x00, 0x01, 0x99, 0x00, 0x00, 0x02,
+  0x6f, 0x74, 0x00, 0x03, 0x40, 0x00, 0x05, 0xfa, 0x00, 0x80, 0x01, 0x2e,
+  0x00, 0x19, 0x6b, 0x00, 0x00, 0x07, 0x67, 0x6d, 0x6f, 0x74, 0x75, 0x76,
+  0x7a, 0x00, 0x01, 0x72, 0x00, 0x01, 0x82, 0x00, 0x02, 0x6d, 0x00, 0x01,
+  0x8f, 0x00, 0x01, 0x94, 0x00, 0x01, 0x99, 0x00, 0x08, 0x0c, 0x00, 0x80,
+  0x01, 0x2e, 0x00, 0x19, 0x91, 0x00, 0x00, 0x05, 0x32, 0x67, 0x6d, 0x6f,
+  0x74, 0x00, 0x0a, 0x09, 0x00, 0x01, 0x72, 0x00, 0x01, 0x82, 0x00, 0x01,
+  0x87, 0x00, 0x01, 0x8f, 0x00, 0x00, 0x05, 0x38, 0x62, 0x64, 0x66, 0x74,
+  0x00, 0x19, 0xbf, 0x00, 0x19, 0xcf, 0x00, 0x01, 0xed, 0x00, 0x07, 0xba,
+  0x00, 0x19, 0xf2, 0x0d, 0x64, 0x61, 0x31, 0x74, 0x61, 0x62, 0x62, 0x67,
+  0x6c, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x00, 0x80, 0x01, 0x2e, 0x00,
+  0x19, 0xd6, 0x00, 0x00, 0x04, 0x6f, 0x74, 0x75, 0x76, 0x00, 0x0a, 0x52,
+  0x00, 0x0c, 0x9e, 0x00, 0x19, 0xe9, 0x00, 0x19, 0x13, 0x06, 0x61, 0x65,
+  0x72, 0x72, 0x61, 0x62, 0x80, 0x00, 0x00, 0x80, 0x01, 0x2e, 0x00, 0x19,
+  0xf9, 0x00, 0x40, 0x62, 0x19, 0x01, 0x02, 0x00, 0x03, 0x00, 0x04, 0x00,
+  0x00, 0x00, 0x00, 0x05, 0x06, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0x09, 0x0a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x0b, 0x73, 0x00, 0x1a, 0x37,
+  0x00, 0x02, 0xfe, 0x00, 0x01, 0x72, 0x00, 0x01, 0x7d, 0x00, 0x01, 0x82,
+  0x00, 0x0b, 0x78, 0x00, 0x1a, 0x42, 0x00, 0x01, 0x94, 0x00, 0x01, 0x99,
+  0x00, 0x08, 0x0c, 0x00, 0x00, 0x02, 0x61, 0x69, 0x00, 0x01, 0xed, 0x00,
+  0x02, 0x03, 0x00, 0x00, 0x03, 0x65, 0x6e, 0x73, 0x00, 0x02, 0x03, 0x00,
+  0x02, 0x83, 0x00, 0x1a, 0x51, 0x02, 0x65, 0x74, 0x80, 0x00, 0x00, 0x40,
+  0x63, 0x13, 0x01, 0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05,
+  0x06, 0x00, 0x00, 0x07, 0x00, 0x00, 0x08, 0x09, 0x0a, 0x00, 0x1a, 0x8b,
+  0x00, 0x0b, 0xb8, 0x00, 0x07, 0xba, 0x00, 0x1a, 0x98, 0x00, 0x1b, 0xde,
+  0x00, 0x1c, 0x3b, 0x00, 0x1c, 0x61, 0x00, 0x0b, 0xb8, 0x00, 0x01, 0xed,
+  0x00, 0x1c, 0xc7, 0x00, 0x82, 0x01, 0x2e, 0x00, 0x1a, 0x92, 0x03, 0x77,
+  0x77, 0x77, 0x81, 0x00, 0x00, 0x80, 0x01, 0x2e, 0x00, 0x1a, 0x9f, 0x00,
+  0x40, 0x61, 0x18, 0x01, 0x02, 0x00, 0x03, 0x00, 0x00, 0x04, 0x00, 0x05,
+  0x00, 0x00, 0x00, 0x06, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x09,
+  0x0a, 0x00, 0x0b, 0x00, 0x1a, 0xdc, 0x00, 0x1a, 0xfe, 0x00, 0x1b, 0x0b,
+  0x00, 0x1b, 0x42, 0x00, 0x1b, 0x66, 0x00, 0x1b, 0x97, 0x00, 0x1b, 0xad,
+  0x00, 0x16, 0x96, 0x00, 0x01, 0x94, 0x00, 0x1b, 0xb8, 0x00, 0x1b, 0xd2,
+  0x00, 0x00, 0x02, 0x34, 0x35, 0x00, 0x1a, 0xe7, 0x00, 0x1a, 0xf3, 0x09,
+  0x79, 0x61, 0x30, 0x63, 0x75, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x08,
+  0x77, 0x71, 0x6d, 0x67, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x0a, 0x33,
+  0x71, 0x61, 0x30, 0x64, 0x6f, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x00,
+  0x00, 0x02, 0x32, 0x35, 0x00, 0x1b, 0x16, 0x00, 0x1b, 0x37, 0x00, 0x00,
+  0x02, 0x32, 0x33, 0x00, 0x1b, 0x21, 0x00, 0x1b, 0x2c, 0x08, 0x73, 0x76,
+  0x63, 0x77, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x08, 0x72, 0x76, 0x63,
+  0x6c, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x08, 0x78, 0x71, 0x35, 0x35,
+  0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x00, 0x00, 0x03, 0x61, 0x6c, 0x72,
+  0x00, 0x1b, 0x51, 0x00, 0x1b, 0x5b, 0x00, 0x02, 0x12, 0x07, 0x30, 0x6e,
+  0x74, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x08, 0x61, 0x30, 0x64, 0x6f,
+  0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x00, 0x00, 0x03, 0x30, 0x37, 0x78,
+  0x00, 0x1b, 0x75, 0x00, 0x1b, 0x81, 0x00, 0x1b, 0x8c, 0x09, 0x35, 0x30,
+  0x71, 0x6d, 0x67, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x08, 0x61, 0x30,
+  0x6f, 0x69, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x08, 0x61, 0x30, 0x6b,
+  0x6d, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x00, 0x00, 0x02, 0x31, 0x6f,
+  0x00, 0x1b, 0xa2, 0x00, 0x01, 0x87, 0x08, 0x71, 0x74, 0x78, 0x6d, 0x2d,
+  0x2d, 0x6e, 0x78, 0x80, 0x00, 0x08, 0x70, 0x71, 0x69, 0x63, 0x2d, 0x2d,
+  0x6e, 0x78, 0x80, 0x00, 0x00, 0x00, 0x03, 0x64, 0x6f, 0x74, 0x00, 0x02,
+  0x83, 0x00, 0x0b, 0xb4, 0x00, 0x1b, 0xc7, 0x08, 0x61, 0x30, 0x63, 0x75,
+  0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x09, 0x76, 0x61, 0x30, 0x66, 0x7a,
+  0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x00, 0x80, 0x01, 0x2e, 0x00, 0x1b,
+  0xe5, 0x00, 0x40, 0x62, 0x15, 0x01, 0x02, 0x03, 0x00, 0x00, 0x04, 0x05,
+  0x00, 0x00, 0x00, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x00, 0x00, 0x00, 0x0b,
+  0x0c, 0x0d, 0x00, 0x0b, 0x73, 0x00, 0x1c, 0x25, 0x00, 0x1c, 0x2a, 0x00,
+  0x01, 0x72, 0x00, 0x04, 0x33, 0x00, 0x1c, 0x2f, 0x00, 0x01, 0x82, 0x00,
+  0x0a, 0x52, 0x00, 0x17, 0xd4, 0x00, 0x1c, 0x36, 0x00, 0x02, 0x78, 0x00,
+  0x01, 0x94, 0x00, 0x01, 0x99, 0x02, 0x6f, 0x73, 0x80, 0x00, 0x02, 0x74,
+  0x6c, 0x80, 0x00, 0x04, 0x65, 0x74, 0x6f, 0x68, 0x80, 0x00, 0x02, 0x72,
+  0x67, 0x80, 0x00, 0x00, 0x80, 0x01, 0x2e, 0x00, 0x1c, 0x42, 0x00, 0x00,
+  0x07, 0x65, 0x66, 0x67, 0x6d, 0x74, 0x75, 0x76, 0x00, 0x02, 0xfe, 0x00,
+  0x03, 0x21, 0x00, 0x01, 0x72, 0x00, 0x01, 0x82, 0x00, 0x01, 0x8f, 0x00,
+  0x01, 0x94, 0x00, 0x01, 0x99, 0x00, 0x80, 0x01, 0x2e, 0x00, 0x1c, 0x68,
+  0x00, 0x40, 0x62, 0x19, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0x04, 0x05, 0x06, 0x07, 0x00, 0x00, 0x08, 0x09, 0x0a,
+  0x0b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1c, 0xa9, 0x00, 0x01, 0x72, 0x00,
+  0x01, 0x99, 0x00, 0x1c, 0xb8, 0x00, 0x01, 0x99, 0x00, 0x02, 0x6d, 0x00,
+  0x01, 0x99, 0x00, 0x01, 0x99, 0x00, 0x01, 0x8f, 0x00, 0x01, 0x94, 0x00,
+  0x01, 0x99, 0x00, 0x08, 0x0c, 0x00, 0x00, 0x02, 0x65, 0x6f, 0x00, 0x1c,
+  0xb4, 0x00, 0x0b, 0xb4, 0x01, 0x77, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61,
+  0x6f, 0x00, 0x1c, 0xc3, 0x00, 0x01, 0x87, 0x01, 0x66, 0x80, 0x00, 0x00,
+  0x82, 0x01, 0x2e, 0x00, 0x1c, 0xce, 0x00, 0x40, 0x63, 0x17, 0x01, 0x02,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x05, 0x00,
+  0x00, 0x00, 0x06, 0x07, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x1d, 0x01,
+  0x00, 0x1d, 0x06, 0x00, 0x1d, 0x2f, 0x00, 0x1d, 0x34, 0x00, 0x1d, 0x46,
+  0x00, 0x1d, 0x53, 0x00, 0x1d, 0x58, 0x00, 0x1d, 0x72, 0x02, 0x69, 0x6e,
+  0x81, 0x00, 0x00, 0x00, 0x02, 0x6e, 0x6f, 0x00, 0x1d, 0x11, 0x00, 0x1d,
+  0x2b, 0x17, 0x61, 0x6c, 0x74, 0x6f, 0x63, 0x73, 0x2d, 0x79, 0x72, 0x61,
+  0x72, 0x62, 0x69, 0x6c, 0x2d, 0x6c, 0x61, 0x6e, 0x6f, 0x69, 0x74, 0x61,
+  0x6e, 0x81, 0x00, 0x01, 0x6d, 0x81, 0x00, 0x02, 0x63, 0x73, 0x82, 0x00,
+  0x00, 0x00, 0x02, 0x62, 0x65, 0x00, 0x1d, 0x3f, 0x00, 0x1d, 0x42, 0x00,
+  0x81, 0x00, 0x01, 0x6e, 0x81, 0x00, 0x0a, 0x63, 0x2e, 0x74, 0x6f, 0x70,
+  0x73, 0x67, 0x6f, 0x6c, 0x62, 0x84, 0x00, 0x02, 0x6c, 0x6e, 0x81, 0x00,
+  0x00, 0x00, 0x02, 0x65, 0x6e, 0x00, 0x1d, 0x63, 0x00, 0x1d, 0x67, 0x01,
+  0x6a, 0x81, 0x00, 0x08, 0x65, 0x6d, 0x61, 0x69, 0x6c, 0x72, 0x61, 0x70,
+  0x81, 0x00, 0x0e, 0x72, 0x61, 0x72, 0x62, 0x69, 0x6c, 0x2d, 0x68, 0x73,
+  0x69, 0x74, 0x69, 0x72, 0x62, 0x81, 0x00, 0x00, 0x40, 0x61, 0x14, 0x01,
+  0x00, 0x02, 0x00, 0x03, 0x04, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07,
+  0x08, 0x00, 0x09, 0x00, 0x00, 0x0a, 0x0b, 0x00, 0x0a, 0x66, 0x00, 0x1d,
+  0xbc, 0x00, 0x1d, 0xd6, 0x00, 0x1d, 0xe7, 0x00, 0x01, 0xed, 0x00, 0x1e,
+  0x08, 0x00, 0x1e, 0x21, 0x00, 0x1e, 0x4e, 0x00, 0x1e, 0x68, 0x00, 0x08,
+  0x11, 0x00, 0x27, 0x05, 0x00, 0x80, 0x01, 0x2e, 0x00, 0x1d, 0xc3, 0x00,
+  0x00, 0x04, 0x62, 0x6c, 0x6f, 0x76, 0x00, 0x01, 0x99, 0x00, 0x01, 0x7d,
+  0x00, 0x01, 0x87, 0x00, 0x01, 0x99, 0x00, 0x00, 0x02, 0x74, 0x76, 0x00,
+  0x01, 0xed, 0x00, 0x1d, 0xe1, 0x03, 0x61, 0x72, 0x74, 0x80, 0x00, 0x02,
+  0x38, 0x66, 0x00, 0x02, 0x70, 0x74, 0x00, 0x1d, 0xf4, 0x00, 0x1d, 0xfe,
+  0x07, 0x62, 0x67, 0x6f, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x07, 0x62,
+  0x67, 0x6d, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x00, 0x82, 0x02, 0x2e,
+  0x6d, 0x00, 0x1e, 0x13, 0x00, 0x01, 0xed, 0x0b, 0x6f, 0x63, 0x2e, 0x74,
+  0x6f, 0x70, 0x73, 0x67, 0x6f, 0x6c, 0x62, 0x84, 0x00, 0x00, 0x80, 0x01,
+  0x2e, 0x00, 0x1e, 0x28, 0x00, 0x00, 0x06, 0x65, 0x67, 0x6d, 0x74, 0x75,
+  0x76, 0x00, 0x18, 0xfc, 0x00, 0x01, 0x72, 0x00, 0x01, 0x82, 0x00, 0x01,
+  0x8f, 0x00, 0x01, 0x94, 0x00, 0x1e, 0x43, 0x00, 0x00, 0x02, 0x6f, 0x75,
+  0x00, 0x0b, 0xb4, 0x00, 0x01, 0x99, 0x00, 0x80, 0x01, 0x2e, 0x00, 0x1e,
+  0x55, 0x00, 0x00, 0x03, 0x6f, 0x74, 0x76, 0x00, 0x02, 0x16, 0x00, 0x0c,
+  0x9e, 0x00, 0x1e, 0x64, 0x01, 0x62, 0x80, 0x00, 0x00, 0x80, 0x01, 0x2e,
+  0x00, 0x1e, 0x6f, 0x00, 0x40, 0x61, 0x1a, 0x01, 0x00, 0x02, 0x03, 0x04,
+  0x00, 0x05, 0x06, 0x07, 0x00, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x00,
+  0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x00, 0x1e, 0xcf,
+  0x00, 0x20, 0x63, 0x00, 0x20, 0xbf, 0x00, 0x20, 0xd7, 0x00, 0x21, 0xe6,
+  0x00, 0x22, 0x16, 0x00, 0x22, 0x21, 0x00, 0x22, 0x46, 0x00, 0x22, 0xe8,
+  0x00, 0x23, 0x13, 0x00, 0x23, 0x51, 0x00, 0x23, 0xe9, 0x00, 0x24, 0xb0,
+  0x00, 0x24, 0xd5, 0x00, 0x1c, 0x25, 0x00, 0x24, 0xe0, 0x00, 0x01, 0x94,
+  0x00, 0x25, 0x12, 0x00, 0x25, 0x69, 0x00, 0x06, 0x56, 0x00, 0x25, 0xf9,
+  0x00, 0x26, 0x9c, 0x00, 0x40, 0x63, 0x18, 0x01, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0x04, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x08,
+  0x09, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x0b, 0x00, 0x1f, 0x0c, 0x00, 0x1f,
+  0x24, 0x00, 0x1f, 0x42, 0x00, 0x1f, 0x5d, 0x00, 0x1f, 0xa1, 0x00, 0x1f,
+  0xd9, 0x00, 0x1f, 0xdf, 0x00, 0x20, 0x09, 0x00, 0x20, 0x0e, 0x00, 0x20,
+  0x15, 0x00, 0x20, 0x49, 0x02, 0x69, 0x6e, 0x00, 0x02, 0x64, 0x67, 0x00,
+  0x1f, 0x19, 0x00, 0x1f, 0x1f, 0x03, 0x69, 0x77, 0x73, 0x80, 0x00, 0x02,
+  0x65, 0x6c, 0x80, 0x00, 0x00, 0x00, 0x03, 0x67, 0x6f, 0x75, 0x00, 0x01,
+  0xed, 0x00, 0x1f, 0x33, 0x00, 0x1f, 0x3a, 0x04, 0x72, 0x74, 0x73, 0x6f,
+  0x80, 0x00, 0x05, 0x72, 0x61, 0x77, 0x6f, 0x6e, 0x80, 0x00, 0x00, 0x00,
+  0x03, 0x64, 0x6d, 0x6e, 0x00, 0x04, 0x75, 0x00, 0x1f, 0x51, 0x00, 0x1f,
+  0x57, 0x03, 0x72, 0x61, 0x77, 0x80, 0x00, 0x03, 0x79, 0x64, 0x67, 0x80,
+  0x00, 0x00, 0x00, 0x04, 0x65, 0x73, 0x74, 0x79, 0x00, 0x1f, 0x70, 0x00,
+  0x1f, 0x89, 0x00, 0x1f, 0x93, 0x00, 0x1f, 0x98, 0x02, 0x6c, 0x6f, 0x00,
+  0x02, 0x67, 0x72, 0x00, 0x1f, 0x7d, 0x00, 0x1f, 0x83, 0x03, 0x75, 0x6c,
+  0x64, 0x80, 0x00, 0x03, 0x74, 0x73, 0x6f, 0x80, 0x00, 0x07, 0x6c, 0x6f,
+  0x70, 0x6f, 0x6c, 0x61, 0x6d, 0x80, 0x00, 0x02, 0x73, 0x75, 0x80, 0x00,
+  0x06, 0x74, 0x73, 0x79, 0x72, 0x75, 0x74, 0x80, 0x00, 0x00, 0x00, 0x02,
+  0x69, 0x6f, 0x00, 0x01, 0xff, 0x00, 0x1f, 0xac, 0x00, 0x00, 0x02, 0x6b,
+  0x77, 0x00, 0x1f, 0xb7, 0x00, 0x1f, 0xbc, 0x02, 0x7a, 0x73, 0x80, 0x00,
+  0x00, 0x00, 0x02, 0x2d, 0x6f, 0x00, 0x1f, 0xc7, 0x00, 0x1f, 0xd1, 0x07,
+  0x61, 0x77, 0x6f, 0x6c, 0x61, 0x74, 0x73, 0x80, 0x00, 0x05, 0x6b, 0x73,
+  0x6e, 0x6f, 0x6b, 0x80, 0x00, 0x03, 0x69, 0x6d, 0x67, 0x80, 0x00, 0x02,
+  0x6f, 0x67, 0x00, 0x03, 0x2d, 0x6a, 0x7a, 0x00, 0x1f, 0xf0, 0x00, 0x01,
+  0xed, 0x00, 0x01, 0xed, 0x02, 0x61, 0x69, 0x00, 0x02, 0x62, 0x6e, 0x00,
+  0x1f, 0xfd, 0x00, 0x20, 0x02, 0x02, 0x61, 0x62, 0x80, 0x00, 0x04, 0x65,
+  0x6c, 0x65, 0x6a, 0x80, 0x00, 0x02, 0x79, 0x6e, 0x80, 0x00, 0x04, 0x73,
+  0x61, 0x69, 0x6d, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x6f, 0x00, 0x20,
+  0x20, 0x00, 0x20, 0x41, 0x00, 0x00, 0x02, 0x6c, 0x7a, 0x00, 0x20, 0x2b,
+  0x00, 0x20, 0x3a, 0x00, 0x00, 0x03, 0x65, 0x69, 0x6f, 0x00, 0x08, 0x0c,
+  0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x04, 0x73, 0x72, 0x61, 0x77, 0x80,
+  0x00, 0x05, 0x6e, 0x61, 0x6d, 0x69, 0x6c, 0x80, 0x00, 0x00, 0x00, 0x02,
+  0x65, 0x6d, 0x00, 0x20, 0x54, 0x00, 0x20, 0x5e, 0x07, 0x69, 0x77, 0x6f,
+  0x6c, 0x61, 0x69, 0x62, 0x80, 0x00, 0x02, 0x6f, 0x6c, 0x80, 0x00, 0x00,
+  0x00, 0x04, 0x65, 0x6f, 0x70, 0x72, 0x00, 0x20, 0x76, 0x00, 0x20, 0xba,
+  0x00, 0x01, 0xed, 0x00, 0x02, 0x83, 0x00, 0x00, 0x02, 0x69, 0x6c, 0x00,
+  0x20, 0x81, 0x00, 0x20, 0xa7, 0x01, 0x77, 0x00, 0x02, 0x61, 0x6f, 0x00,
+  0x20, 0x8d, 0x00, 0x20, 0x96, 0x06, 0x6c, 0x73, 0x65, 0x6c, 0x6f, 0x62,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x6e, 0x72, 0x00, 0x20, 0xa1, 0x00, 0x1f,
+  0x83, 0x03, 0x73, 0x6f, 0x73, 0x80, 0x00, 0x01, 0x65, 0x00, 0x02, 0x69,
+  0x7a, 0x00, 0x03, 0x40, 0x00, 0x20, 0xb3, 0x04, 0x72, 0x6f, 0x67, 0x7a,
+  0x80, 0x00, 0x02, 0x72, 0x77, 0x80, 0x00, 0x00, 0x00, 0x03, 0x65, 0x69,
+  0x72, 0x00, 0x03, 0x40, 0x00, 0x02, 0xa9, 0x00, 0x20, 0xce, 0x06, 0x61,
+  0x67, 0x72, 0x61, 0x74, 0x73, 0x80, 0x00, 0x00, 0x00, 0x06, 0x63, 0x69,
+  0x6c, 0x6e, 0x74, 0x7a, 0x00, 0x20, 0xf2, 0x00, 0x21, 0x60, 0x00, 0x21,
+  0x8b, 0x00, 0x21, 0xa2, 0x00, 0x21, 0xc1, 0x00, 0x21, 0xcc, 0x00, 0x00,
+  0x03, 0x69, 0x6c, 0x79, 0x00, 0x21, 0x01, 0x00, 0x21, 0x4f, 0x00, 0x21,
+  0x56, 0x00, 0x00, 0x02, 0x6c, 0x77, 0x00, 0x21, 0x0c, 0x00, 0x21, 0x12,
+  0x03, 0x72, 0x6f, 0x67, 0x80, 0x00, 0x00, 0x00, 0x02, 0x69, 0x6f, 0x00,
+  0x21, 0x1d, 0x00, 0x21, 0x22, 0x02, 0x6c, 0x67, 0x80, 0x00, 0x00, 0x00,
+  0x03, 0x68, 0x6b, 0x74, 0x00, 0x21, 0x31, 0x00, 0x21, 0x44, 0x00, 0x21,
+  0x4a, 0x01, 0x63, 0x00, 0x02, 0x61, 0x6f, 0x00, 0x21, 0x3d, 0x00, 0x0d,
+  0x7a, 0x04, 0x72, 0x61, 0x74, 0x73, 0x80, 0x00, 0x03, 0x6c, 0x6f, 0x70,
+  0x80, 0x00, 0x02, 0x61, 0x6b, 0x80, 0x00, 0x04, 0x64, 0x65, 0x69, 0x73,
+  0x80, 0x00, 0x07, 0x7a, 0x72, 0x65, 0x69, 0x62, 0x6f, 0x6b, 0x80, 0x00,
+  0x00, 0x00, 0x03, 0x63, 0x6b, 0x73, 0x00, 0x21, 0x6f, 0x00, 0x21, 0x7a,
+  0x00, 0x21, 0x83, 0x08, 0x73, 0x6a, 0x75, 0x6f, 0x6e, 0x69, 0x77, 0x73,
+  0x80, 0x00, 0x06, 0x73, 0x72, 0x6f, 0x6d, 0x6f, 0x70, 0x80, 0x00, 0x05,
+  0x61, 0x6c, 0x64, 0x6f, 0x70, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x6f,
+  0x00, 0x21, 0x96, 0x00, 0x21, 0x9d, 0x04, 0x68, 0x64, 0x6f, 0x70, 0x80,
+  0x00, 0x02, 0x70, 0x6f, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x6f, 0x00,
+  0x21, 0xad, 0x00, 0x21, 0xb5, 0x05, 0x70, 0x6f, 0x6b, 0x61, 0x7a, 0x80,
+  0x00, 0x01, 0x62, 0x00, 0x02, 0x36, 0x6d, 0x00, 0x01, 0xed, 0x00, 0x01,
+  0xed, 0x08, 0x61, 0x74, 0x73, 0x65, 0x6c, 0x61, 0x65, 0x72, 0x80, 0x00,
+  0x00, 0x00, 0x02, 0x72, 0x73, 0x00, 0x21, 0xd7, 0x00, 0x21, 0xde, 0x04,
+  0x6f, 0x6d, 0x6f, 0x70, 0x80, 0x00, 0x05, 0x77, 0x6f, 0x7a, 0x61, 0x6d,
+  0x80, 0x00, 0x00, 0x00, 0x03, 0x61, 0x65, 0x72, 0x00, 0x21, 0xf5, 0x00,
+  0x21, 0xfc, 0x00, 0x02, 0x12, 0x04, 0x6c, 0x62, 0x6c, 0x65, 0x80, 0x00,
+  0x04, 0x7a, 0x72, 0x62, 0x6f, 0x00, 0x02, 0x6c, 0x6e, 0x00, 0x22, 0x0b,
+  0x00, 0x22, 0x10, 0x02, 0x6f, 0x6b, 0x80, 0x00, 0x03, 0x72, 0x61, 0x74,
+  0x80, 0x00, 0x08, 0x63, 0x79, 0x7a, 0x72, 0x62, 0x6c, 0x61, 0x77, 0x80,
+  0x00, 0x00, 0x00, 0x03, 0x63, 0x67, 0x6b, 0x00, 0x22, 0x30, 0x00, 0x22,
+  0x10, 0x00, 0x22, 0x3e, 0x0b, 0x73, 0x6f, 0x6d, 0x6f, 0x68, 0x63, 0x75,
+  0x72, 0x65, 0x69, 0x6e, 0x80, 0x00, 0x05, 0x6c, 0x61, 0x77, 0x75, 0x73,
+  0x80, 0x00, 0x00, 0x00, 0x06, 0x65, 0x69, 0x6c, 0x6f, 0x72, 0x73, 0x00,
+  0x22, 0x61, 0x00, 0x22, 0x7a, 0x00, 0x22, 0x81, 0x00, 0x22, 0x85, 0x00,
+  0x22, 0x9e, 0x00, 0x22, 0xb0, 0x00, 0x00, 0x02, 0x72, 0x77, 0x00, 0x22,
+  0x6c, 0x00, 0x22, 0x71, 0x02, 0x75, 0x74, 0x80, 0x00, 0x06, 0x61, 0x6c,
+  0x63, 0x6f, 0x6c, 0x77, 0x80, 0x00, 0x04, 0x6e, 0x62, 0x79, 0x72, 0x80,
+  0x00, 0x01, 0x65, 0x80, 0x00, 0x00, 0x00, 0x02, 0x6e, 0x74, 0x00, 0x22,
+  0x90, 0x00, 0x22, 0x95, 0x02, 0x61, 0x73, 0x80, 0x00, 0x06, 0x73, 0x79,
+  0x6c, 0x61, 0x69, 0x62, 0x80, 0x00, 0x02, 0x6f, 0x62, 0x00, 0x02, 0x65,
+  0x6c, 0x00, 0x05, 0xfa, 0x00, 0x22, 0xab, 0x02, 0x61, 0x6d, 0x80, 0x00,
+  0x00, 0x00, 0x05, 0x61, 0x6a, 0x6e, 0x70, 0x72, 0x00, 0x22, 0xc7, 0x00,
+  0x22, 0xcc, 0x00, 0x22, 0xd3, 0x00, 0x22, 0xd9, 0x00, 0x22, 0xdf, 0x02,
+  0x6c, 0x73, 0x80, 0x00, 0x04, 0x61, 0x7a, 0x65, 0x6c, 0x80, 0x00, 0x03,
+  0x61, 0x64, 0x67, 0x80, 0x00, 0x03, 0x75, 0x6c, 0x73, 0x80, 0x00, 0x06,
+  0x6f, 0x77, 0x65, 0x7a, 0x72, 0x70, 0x80, 0x00, 0x00, 0x00, 0x03, 0x63,
+  0x65, 0x69, 0x00, 0x22, 0xf7, 0x00, 0x22, 0xfd, 0x00, 0x23, 0x08, 0x03,
+  0x6f, 0x6c, 0x77, 0x80, 0x00, 0x00, 0x00, 0x02, 0x72, 0x76, 0x00, 0x01,
+  0xed, 0x00, 0x1d, 0xe1, 0x00, 0x00, 0x02, 0x61, 0x6d, 0x00, 0x03, 0x40,
+  0x00, 0x01, 0xed, 0x00, 0x00, 0x03, 0x6f, 0x73, 0x74, 0x00, 0x23, 0x22,
+  0x00, 0x23, 0x3f, 0x00, 0x0f, 0x0b, 0x00, 0x00, 0x04, 0x63, 0x64, 0x6e,
+  0x74, 0x00, 0x01, 0xed, 0x00, 0x23, 0x35, 0x00, 0x01, 0xed, 0x00, 0x23,
+  0x3a, 0x02, 0x61, 0x72, 0x80, 0x00, 0x02, 0x79, 0x62, 0x80, 0x00, 0x00,
+  0x00, 0x02, 0x67, 0x69, 0x00, 0x01, 0xed, 0x00, 0x23, 0x4a, 0x04, 0x72,
+  0x75, 0x6f, 0x74, 0x80, 0x00, 0x00, 0x00, 0x04, 0x61, 0x69, 0x75, 0x79,
+  0x00, 0x23, 0x64, 0x00, 0x23, 0x7a, 0x00, 0x23, 0xb9, 0x00, 0x23, 0xc0,
+  0x00, 0x00, 0x02, 0x67, 0x6e, 0x00, 0x23, 0x6f, 0x00, 0x23, 0x74, 0x02,
+  0x61, 0x7a, 0x80, 0x00, 0x03, 0x7a, 0x6f, 0x70, 0x80, 0x00, 0x00, 0x00,
+  0x05, 0x62, 0x63, 0x6d, 0x6e, 0x7a, 0x00, 0x23, 0x91, 0x00, 0x23, 0x96,
+  0x00, 0x23, 0x9e, 0x00, 0x22, 0x0b, 0x00, 0x23, 0xa5, 0x02, 0x75, 0x6c,
+  0x80, 0x00, 0x05, 0x65, 0x7a, 0x63, 0x7a, 0x73, 0x80, 0x00, 0x04, 0x6f,
+  0x6c, 0x6f, 0x77, 0x80, 0x00, 0x01, 0x64, 0x00, 0x02, 0x65, 0x6f, 0x00,
+  0x1e, 0x64, 0x00, 0x23, 0xb1, 0x05, 0x62, 0x65, 0x69, 0x77, 0x73, 0x80,
+  0x00, 0x04, 0x6c, 0x65, 0x69, 0x77, 0x80, 0x00, 0x00, 0x00, 0x02, 0x74,
+  0x7a, 0x00, 0x23, 0xcb, 0x00, 0x23, 0xd2, 0x04, 0x7a, 0x73, 0x6c, 0x6f,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x72, 0x73, 0x00, 0x23, 0xdd, 0x00, 0x23,
+  0xe3, 0x03, 0x74, 0x65, 0x6b, 0x80, 0x00, 0x03, 0x65, 0x69, 0x63, 0x80,
+  0x00, 0x00, 0x40, 0x63, 0x15, 0x01, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00,
+  0x00, 0x04, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x08, 0x00,
+  0x00, 0x09, 0x00, 0x02, 0x6a, 0x00, 0x03, 0x21, 0x00, 0x02, 0x03, 0x00,
+  0x24, 0x1d, 0x00, 0x24, 0x35, 0x00, 0x24, 0x3b, 0x00, 0x24, 0x8d, 0x00,
+  0x24, 0x92, 0x00, 0x24, 0x97, 0x00, 0x00, 0x02, 0x63, 0x7a, 0x00, 0x24,
+  0x28, 0x00, 0x24, 0x2e, 0x03, 0x65, 0x6c, 0x6f, 0x80, 0x00, 0x04, 0x64,
+  0x6f, 0x6c, 0x6b, 0x80, 0x00, 0x03, 0x6b, 0x61, 0x6e, 0x80, 0x00, 0x00,
+  0x00, 0x04, 0x6c, 0x70, 0x74, 0x7a, 0x00, 0x24, 0x4e, 0x00, 0x24, 0x54,
+  0x00, 0x24, 0x59, 0x00, 0x24, 0x6b, 0x03, 0x65, 0x69, 0x6d, 0x80, 0x00,
+  0x02, 0x65, 0x6b, 0x80, 0x00, 0x00, 0x00, 0x02, 0x75, 0x79, 0x00, 0x05,
+  0x9d, 0x00, 0x24, 0x64, 0x04, 0x7a, 0x63, 0x7a, 0x73, 0x80, 0x00, 0x00,
+  0x00, 0x03, 0x63, 0x65, 0x72, 0x00, 0x24, 0x7a, 0x00, 0x24, 0x80, 0x00,
+  0x24, 0x86, 0x03, 0x6f, 0x70, 0x6f, 0x80, 0x00, 0x03, 0x69, 0x6e, 0x67,
+  0x80, 0x00, 0x04, 0x6f, 0x77, 0x61, 0x6a, 0x80, 0x00, 0x02, 0x67, 0x61,
+  0x80, 0x00, 0x02, 0x75, 0x61, 0x80, 0x00, 0x00, 0x00, 0x02, 0x65, 0x6f,
+  0x00, 0x24, 0xa2, 0x00, 0x24, 0xa9, 0x04, 0x6a, 0x61, 0x72, 0x67, 0x80,
+  0x00, 0x04, 0x67, 0x61, 0x72, 0x6d, 0x80, 0x00, 0x00, 0x00, 0x03, 0x65,
+  0x6b, 0x6f, 0x00, 0x24, 0xbf, 0x00, 0x24, 0xc5, 0x00, 0x24, 0xd0, 0x03,
+  0x6c, 0x6b, 0x73, 0x80, 0x00, 0x08, 0x6c, 0x77, 0x77, 0x6f, 0x72, 0x74,
+  0x73, 0x6f, 0x80, 0x00, 0x02, 0x68, 0x73, 0x80, 0x00, 0x08, 0x6f, 0x6d,
+  0x6f, 0x70, 0x68, 0x63, 0x61, 0x7a, 0x80, 0x00, 0x00, 0x00, 0x05, 0x61,
+  0x65, 0x6f, 0x72, 0x73, 0x00, 0x24, 0xf7, 0x00, 0x24, 0xfe, 0x00, 0x25,
+  0x06, 0x00, 0x02, 0xa9, 0x00, 0x25, 0x0c, 0x04, 0x69, 0x77, 0x6f, 0x70,
+  0x80, 0x00, 0x01, 0x6e, 0x80, 0x01, 0x65, 0x00, 0x1f, 0x93, 0x03, 0x70,
+  0x6f, 0x73, 0x80, 0x00, 0x03, 0x65, 0x7a, 0x63, 0x80, 0x00, 0x00, 0x00,
+  0x02, 0x69, 0x6f, 0x00, 0x0d, 0x7a, 0x00, 0x25, 0x1d, 0x01, 0x67, 0x80,
+  0x01, 0x2e, 0x00, 0x25, 0x25, 0x00, 0x00, 0x06, 0x61, 0x67, 0x6d, 0x6f,
+  0x72, 0x77, 0x00, 0x01, 0xff, 0x00, 0x07, 0xb6, 0x00, 0x07, 0xb6, 0x00,
+  0x25, 0x40, 0x00, 0x03, 0x8e, 0x00, 0x25, 0x59, 0x00, 0x00, 0x03, 0x70,
+  0x73, 0x77, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x25, 0x4f, 0x07,
+  0x74, 0x73, 0x6f, 0x72, 0x61, 0x74, 0x73, 0x80, 0x00, 0x00, 0x00, 0x02,
+  0x6f, 0x75, 0x00, 0x25, 0x64, 0x00, 0x01, 0xed, 0x02, 0x70, 0x75, 0x80,
+  0x00, 0x00, 0x00, 0x02, 0x61, 0x6f, 0x00, 0x25, 0x74, 0x00, 0x25, 0x98,
+  0x00, 0x00, 0x02, 0x6c, 0x77, 0x00, 0x25, 0x7f, 0x00, 0x01, 0xed, 0x00,
+  0x00, 0x02, 0x63, 0x73, 0x00, 0x25, 0x8a, 0x00, 0x25, 0x90, 0x03, 0x6f,
+  0x72, 0x77, 0x80, 0x00, 0x05, 0x69, 0x7a, 0x64, 0x6f, 0x77, 0x80, 0x00,
+  0x00, 0x00, 0x05, 0x67, 0x6b, 0x72, 0x74, 0x7a, 0x00, 0x25, 0xaf, 0x00,
+  0x25, 0xb5, 0x00, 0x25, 0xcb, 0x00, 0x25, 0xda, 0x00, 0x25, 0xe2, 0x03,
+  0x6f, 0x6c, 0x67, 0x80, 0x00, 0x00, 0x00, 0x03, 0x61, 0x75, 0x7a, 0x00,
+  0x06, 0x6e, 0x00, 0x05, 0xfa, 0x00, 0x25, 0xc4, 0x04, 0x73, 0x75, 0x72,
+  0x70, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x67, 0x00, 0x25, 0xd6, 0x00,
+  0x0b, 0x73, 0x01, 0x7a, 0x80, 0x00, 0x05, 0x73, 0x75, 0x67, 0x75, 0x61,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x63, 0x73, 0x00, 0x25, 0xed, 0x00, 0x25,
+  0xf3, 0x03, 0x6f, 0x6b, 0x73, 0x80, 0x00, 0x03, 0x65, 0x7a, 0x72, 0x80,
+  0x00, 0x00, 0x40, 0x62, 0x19, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x08, 0x00, 0x26, 0x2e, 0x00, 0x26, 0x36,
+  0x00, 0x26, 0x52, 0x00, 0x26, 0x58, 0x00, 0x26, 0x72, 0x00, 0x26, 0x77,
+  0x00, 0x26, 0x8d, 0x00, 0x26, 0x94, 0x05, 0x75, 0x7a, 0x73, 0x61, 0x6b,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x69, 0x00, 0x26, 0x41, 0x00, 0x26,
+  0x4b, 0x07, 0x7a, 0x63, 0x7a, 0x73, 0x65, 0x69, 0x62, 0x80, 0x00, 0x04,
+  0x6b, 0x73, 0x65, 0x62, 0x80, 0x00, 0x03, 0x63, 0x79, 0x74, 0x80, 0x00,
+  0x00, 0x00, 0x02, 0x6a, 0x6c, 0x00, 0x06, 0x56, 0x00, 0x26, 0x63, 0x0c,
+  0x6f, 0x64, 0x2d, 0x7a, 0x72, 0x65, 0x69, 0x6d, 0x69, 0x7a, 0x61, 0x6b,
+  0x80, 0x00, 0x02, 0x61, 0x6c, 0x80, 0x00, 0x00, 0x00, 0x02, 0x6f, 0x75,
+  0x00, 0x26, 0x82, 0x00, 0x26, 0x87, 0x02, 0x67, 0x74, 0x80, 0x00, 0x03,
+  0x7a, 0x61, 0x6d, 0x80, 0x00, 0x04, 0x61, 0x6c, 0x75, 0x70, 0x80, 0x00,
+  0x05, 0x75, 0x74, 0x72, 0x61, 0x6b, 0x80, 0x00, 0x00, 0x00, 0x05, 0x61,
+  0x63, 0x64, 0x69, 0x73, 0x00, 0x26, 0xb3, 0x00, 0x26, 0xbc, 0x00, 0x26,
+  0xe1, 0x00, 0x1e, 0x64, 0x00, 0x26, 0xe9, 0x06, 0x6d, 0x2d, 0x61, 0x77,
+  0x61, 0x72, 0x80, 0x00, 0x00, 0x00, 0x03, 0x61, 0x69, 0x7a, 0x00, 0x26,
+  0xcb, 0x00, 0x26, 0xd2, 0x00, 0x26, 0xd8, 0x04, 0x70, 0x72, 0x61, 0x6b,
+  0x80, 0x00, 0x03, 0x77, 0x6f, 0x6c, 0x80, 0x00, 0x06, 0x73, 0x6f, 0x67,
+  0x64, 0x79, 0x62, 0x80, 0x00, 0x05, 0x61, 0x6c, 0x65, 0x7a, 0x63, 0x80,
+  0x00, 0x00, 0x00, 0x02, 0x69, 0x75, 0x00, 0x26, 0xf4, 0x00, 0x26, 0xff,
+  0x00, 0x00, 0x02, 0x6c, 0x70, 0x00, 0x21, 0x4a, 0x00, 0x01, 0xed, 0x03,
+  0x6b, 0x6c, 0x6f, 0x80, 0x00, 0x00, 0x80, 0x01, 0x2e, 0x00, 0x0b, 0x18,
+  0x00, 0x40, 0x61, 0x1a, 0x01, 0x02, 0x03, 0x04, 0x00, 0x05, 0x06, 0x07,
+  0x08, 0x09, 0x0a, 0x00, 0x0b, 0x00, 0x0c, 0x0d, 0x00, 0x00, 0x0e, 0x0f,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x01, 0xed, 0x00, 0x08, 0x11,
+  0x00, 0x27, 0x05, 0x00, 0x08, 0x11, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed,
+  0x00, 0x01, 0xed, 0x00, 0x27, 0x5d, 0x00, 0x07, 0xba, 0x00, 0x27, 0x93,
+  0x00, 0x07, 0xba, 0x00, 0x28, 0x1c, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed,
+  0x00, 0x33, 0x67, 0x00, 0x33, 0x8d, 0x00, 0x07, 0xba, 0x00, 0x80, 0x01,
+  0x2e, 0x00, 0x27, 0x64, 0x00, 0x00, 0x05, 0x63, 0x67, 0x6f, 0x74, 0x76,
+  0x00, 0x1a, 0x37, 0x00, 0x01, 0x72, 0x00, 0x27, 0x7b, 0x00, 0x01, 0x8f,
+  0x00, 0x01, 0x99, 0x01, 0x63, 0x80, 0x01, 0x2e, 0x00, 0x27, 0x83, 0x00,
+  0x00, 0x02, 0x63, 0x64, 0x00, 0x27, 0x8e, 0x00, 0x1c, 0x2a, 0x02, 0x6c,
+  0x70, 0x80, 0x00, 0x00, 0x80, 0x01, 0x2e, 0x00, 0x27, 0x9a, 0x00, 0x40,
+  0x64, 0x13, 0x01, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05,
+  0x06, 0x07, 0x08, 0x00, 0x00, 0x09, 0x00, 0x0a, 0x0b, 0x00, 0x0d, 0x7a,
+  0x00, 0x27, 0xd2, 0x00, 0x01, 0x72, 0x00, 0x01, 0x7d, 0x00, 0x12, 0xd3,
+  0x00, 0x27, 0xe9, 0x00, 0x0a, 0x52, 0x00, 0x27, 0xf2, 0x00, 0x27, 0xf8,
+  0x00, 0x01, 0x94, 0x00, 0x1e, 0x43, 0x00, 0x00, 0x02, 0x72, 0x73, 0x00,
+  0x27, 0xdd, 0x00, 0x02, 0xad, 0x09, 0x69, 0x61, 0x6e, 0x69, 0x72, 0x65,
+  0x74, 0x65, 0x76, 0x80, 0x00, 0x06, 0x69, 0x63, 0x65, 0x64, 0x65, 0x6d,
+  0x80, 0x00, 0x03, 0x6f, 0x6f, 0x63, 0x80, 0x00, 0x00, 0x00, 0x03, 0x65,
+  0x6e, 0x73, 0x00, 0x28, 0x07, 0x00, 0x28, 0x10, 0x00, 0x02, 0xa9, 0x06,
+  0x72, 0x69, 0x61, 0x74, 0x6f, 0x6e, 0x80, 0x00, 0x09, 0x65, 0x69, 0x63,
+  0x61, 0x6d, 0x72, 0x61, 0x68, 0x70, 0x80, 0x00, 0x00, 0x82, 0x02, 0x2e,
+  0x63, 0x00, 0x28, 0x27, 0x00, 0x28, 0xdb, 0x00, 0x00, 0x05, 0x65, 0x6c,
+  0x6d, 0x73, 0x74, 0x00, 0x28, 0x3e, 0x00, 0x28, 0x5f, 0x00, 0x28, 0x7f,
+  0x00, 0x28, 0xa5, 0x00, 0x28, 0xbf, 0x00, 0x00, 0x02, 0x6c, 0x6e, 0x00,
+  0x28, 0x49, 0x00, 0x28, 0x54, 0x08, 0x69, 0x62, 0x6f, 0x6d, 0x6e, 0x61,
+  0x6d, 0x6f, 0x81, 0x00, 0x08, 0x6f, 0x68, 0x70, 0x61, 0x69, 0x64, 0x65,
+  0x6d, 0x81, 0x00, 0x00, 0x00, 0x02, 0x65, 0x69, 0x00, 0x28, 0x6a, 0x00,
+  0x28, 0x72, 0x05, 0x74, 0x6e, 0x61, 0x6d, 0x6f, 0x81, 0x00, 0x0a, 0x63,
+  0x6e, 0x75, 0x6f, 0x63, 0x65, 0x74, 0x61, 0x74, 0x73, 0x81, 0x00, 0x00,
+  0x00, 0x02, 0x6f, 0x75, 0x00, 0x28, 0x8a, 0x00, 0x28, 0x98, 0x0b, 0x63,
+  0x65, 0x6c, 0x65, 0x74, 0x73, 0x61, 0x72, 0x77, 0x61, 0x6e, 0x81, 0x00,
+  0x0a, 0x65, 0x6c, 0x6f, 0x72, 0x74, 0x65, 0x70, 0x6b, 0x61, 0x72, 0x81,
+  0x00, 0x00, 0x00, 0x02, 0x61, 0x6e, 0x00, 0x28, 0xb0, 0x00, 0x28, 0xb7,
+  0x04, 0x72, 0x77, 0x61, 0x6e, 0x81, 0x00, 0x05, 0x65, 0x6d, 0x65, 0x69,
+  0x73, 0x81, 0x00, 0x01, 0x73, 0x00, 0x02, 0x65, 0x6f, 0x00, 0x28, 0xcb,
+  0x00, 0x28, 0xd3, 0x05, 0x66, 0x67, 0x6e, 0x6f, 0x73, 0x81, 0x00, 0x05,
+  0x70, 0x6e, 0x61, 0x6d, 0x6f, 0x81, 0x00, 0x00, 0x80, 0x01, 0x2e, 0x00,
+  0x28, 0xe2, 0x00, 0x40, 0x61, 0x19, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+  0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x00, 0x11,
+  0x12, 0x13, 0x14, 0x15, 0x00, 0x16, 0x17, 0x00, 0x29, 0x44, 0x00, 0x29,
+  0xd2, 0x00, 0x29, 0xe8, 0x00, 0x29, 0xfb, 0x00, 0x2a, 0x53, 0x00, 0x14,
+  0x63, 0x00, 0x2b, 0x9d, 0x00, 0x2b, 0xc0, 0x00, 0x2b, 0xcb, 0x00, 0x2b,
+  0xee, 0x00, 0x2b, 0xf7, 0x00, 0x2c, 0x4d, 0x00, 0x2b, 0xee, 0x00, 0x2c,
+  0xa8, 0x00, 0x2d, 0x8a, 0x00, 0x2d, 0xa1, 0x00, 0x2d, 0xbe, 0x00, 0x2f,
+  0xab, 0x00, 0x31, 0xb6, 0x00, 0x32, 0xdc, 0x00, 0x33, 0x20, 0x00, 0x33,
+  0x2b, 0x00, 0x33, 0x49, 0x00, 0x40, 0x63, 0x18, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x05, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x07, 0x08, 0x00, 0x00, 0x09, 0x00, 0x29, 0x7b, 0x00,
+  0x29, 0x83, 0x00, 0x29, 0x7b, 0x00, 0x29, 0x9a, 0x00, 0x29, 0xbf, 0x00,
+  0x02, 0x6a, 0x00, 0x29, 0x7b, 0x00, 0x29, 0x7b, 0x00, 0x02, 0x6a, 0x05,
+  0x2d, 0x6d, 0x6f, 0x72, 0x66, 0x84, 0x00, 0x00, 0x00, 0x02, 0x2d, 0x6f,
+  0x00, 0x13, 0xf8, 0x00, 0x29, 0x8e, 0x09, 0x79, 0x2d, 0x73, 0x65, 0x68,
+  0x63, 0x61, 0x65, 0x74, 0x84, 0x00, 0x00, 0x00, 0x02, 0x2d, 0x61, 0x00,
+  0x13, 0xf8, 0x00, 0x29, 0xa5, 0x02, 0x6c, 0x6c, 0x00, 0x02, 0x2d, 0x61,
+  0x00, 0x29, 0xb2, 0x00, 0x29, 0xb9, 0x04, 0x61, 0x2d, 0x73, 0x69, 0x84,
+  0x00, 0x03, 0x6d, 0x61, 0x69, 0x84, 0x00, 0x00, 0x00, 0x02, 0x2d, 0x63,
+  0x00, 0x13, 0xf8, 0x00, 0x29, 0xca, 0x05, 0x2d, 0x61, 0x2d, 0x73, 0x69,
+  0x84, 0x00, 0x00, 0x00, 0x02, 0x65, 0x67, 0x00, 0x29, 0xdd, 0x00, 0x02,
+  0x6a, 0x08, 0x77, 0x2d, 0x73, 0x6e, 0x64, 0x6e, 0x79, 0x64, 0x84, 0x00,
+  0x00, 0x00, 0x04, 0x64, 0x6e, 0x71, 0x73, 0x00, 0x29, 0x7b, 0x00, 0x29,
+  0x7b, 0x00, 0x02, 0x6a, 0x00, 0x29, 0x7b, 0x00, 0x00, 0x06, 0x65, 0x69,
+  0x6d, 0x6e, 0x73, 0x75, 0x00, 0x2a, 0x16, 0x00, 0x29, 0x7b, 0x00, 0x29,
+  0x7b, 0x00, 0x2a, 0x31, 0x00, 0x29, 0x7b, 0x00, 0x2a, 0x4b, 0x08, 0x69,
+  0x66, 0x69, 0x74, 0x72, 0x65, 0x63, 0x2d, 0x00, 0x02, 0x73, 0x74, 0x00,
+  0x14, 0x8f, 0x00, 0x2a, 0x29, 0x05, 0x6f, 0x6e, 0x2d, 0x73, 0x69, 0x84,
+  0x00, 0x00, 0x00, 0x02, 0x2d, 0x61, 0x00, 0x13, 0xf8, 0x00, 0x2a, 0x3c,
+  0x0c, 0x62, 0x65, 0x68, 0x74, 0x2d, 0x68, 0x74, 0x69, 0x77, 0x2d, 0x73,
+  0x69, 0x84, 0x00, 0x05, 0x6f, 0x6c, 0x63, 0x68, 0x72, 0x84, 0x00, 0x00,
+  0x40, 0x63, 0x14, 0x01, 0x02, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x00, 0x05, 0x06, 0x00, 0x00, 0x00, 0x07, 0x08, 0x09, 0x00, 0x0a, 0x00,
+  0x2a, 0x89, 0x00, 0x2a, 0x97, 0x00, 0x2a, 0xac, 0x00, 0x2a, 0xb8, 0x00,
+  0x2a, 0xd7, 0x00, 0x2b, 0x0f, 0x00, 0x2b, 0x21, 0x00, 0x2b, 0x29, 0x00,
+  0x2b, 0x3a, 0x00, 0x2b, 0x6f, 0x0b, 0x69, 0x66, 0x66, 0x6f, 0x2d, 0x73,
+  0x6e, 0x64, 0x6e, 0x79, 0x64, 0x84, 0x00, 0x00, 0x84, 0x02, 0x2d, 0x6f,
+  0x00, 0x13, 0xf8, 0x00, 0x2a, 0xa2, 0x07, 0x63, 0x65, 0x6c, 0x67, 0x6f,
+  0x6f, 0x67, 0x84, 0x00, 0x09, 0x72, 0x66, 0x2d, 0x73, 0x6e, 0x64, 0x6e,
+  0x79, 0x64, 0x84, 0x00, 0x00, 0x00, 0x02, 0x68, 0x70, 0x00, 0x2a, 0xc3,
+  0x00, 0x2a, 0xce, 0x08, 0x63, 0x65, 0x74, 0x2d, 0x61, 0x2d, 0x73, 0x69,
+  0x84, 0x00, 0x06, 0x2d, 0x73, 0x65, 0x6b, 0x69, 0x6c, 0x84, 0x00, 0x00,
+  0x00, 0x02, 0x69, 0x6f, 0x00, 0x2a, 0xe2, 0x00, 0x2a, 0xef, 0x0a, 0x6e,
+  0x61, 0x2d, 0x6f, 0x74, 0x6e, 0x69, 0x2d, 0x73, 0x69, 0x84, 0x00, 0x02,
+  0x68, 0x2d, 0x00, 0x02, 0x73, 0x74, 0x00, 0x2a, 0xfc, 0x00, 0x2b, 0x04,
+  0x05, 0x6e, 0x64, 0x6e, 0x79, 0x64, 0x84, 0x00, 0x08, 0x61, 0x2d, 0x73,
+  0x6e, 0x64, 0x6e, 0x79, 0x64, 0x84, 0x00, 0x00, 0x00, 0x02, 0x2d, 0x6f,
+  0x00, 0x13, 0xf8, 0x00, 0x2b, 0x1a, 0x04, 0x67, 0x2d, 0x73, 0x69, 0x84,
+  0x00, 0x05, 0x69, 0x68, 0x63, 0x65, 0x63, 0x84, 0x00, 0x00, 0x84, 0x01,
+  0x72, 0x00, 0x2b, 0x30, 0x07, 0x75, 0x6e, 0x2d, 0x61, 0x2d, 0x73, 0x69,
+  0x84, 0x00, 0x00, 0x00, 0x02, 0x69, 0x6f, 0x00, 0x2b, 0x45, 0x00, 0x2b,
+  0x62, 0x00, 0x00, 0x02, 0x6e, 0x73, 0x00, 0x2b, 0x50, 0x00, 0x2b, 0x59,
+  0x06, 0x75, 0x61, 0x72, 0x65, 0x70, 0x6f, 0x84, 0x00, 0x06, 0x2d, 0x79,
+  0x62, 0x62, 0x6f, 0x68, 0x84, 0x00, 0x0a, 0x6d, 0x65, 0x72, 0x2d, 0x73,
+  0x6e, 0x64, 0x6e, 0x79, 0x64, 0x84, 0x00, 0x00, 0x00, 0x02, 0x61, 0x69,
+  0x00, 0x2b, 0x7a, 0x00, 0x2b, 0x8c, 0x0f, 0x6c, 0x73, 0x2d, 0x65, 0x6c,
+  0x63, 0x69, 0x62, 0x75, 0x63, 0x2d, 0x61, 0x2d, 0x73, 0x69, 0x84, 0x00,
+  0x0e, 0x74, 0x61, 0x76, 0x72, 0x65, 0x73, 0x6e, 0x6f, 0x63, 0x2d, 0x61,
+  0x2d, 0x73, 0x69, 0x84, 0x00, 0x03, 0x6f, 0x6c, 0x62, 0x00, 0x02, 0x2d,
+  0x73, 0x00, 0x2b, 0xab, 0x00, 0x2b, 0xb4, 0x06, 0x73, 0x6e, 0x64, 0x6e,
+  0x79, 0x64, 0x84, 0x00, 0x09, 0x69, 0x68, 0x74, 0x73, 0x65, 0x74, 0x69,
+  0x72, 0x77, 0x84, 0x00, 0x00, 0x00, 0x02, 0x6e, 0x6f, 0x00, 0x29, 0x7b,
+  0x00, 0x29, 0x7b, 0x00, 0x00, 0x05, 0x68, 0x6b, 0x6d, 0x72, 0x77, 0x00,
+  0x29, 0x7b, 0x00, 0x2b, 0xe2, 0x00, 0x29, 0x7b, 0x00, 0x29, 0x7b, 0x00,
+  0x29, 0x7b, 0x09, 0x69, 0x77, 0x2d, 0x73, 0x6e, 0x64, 0x6e, 0x79, 0x64,
+  0x84, 0x00, 0x06, 0x6e, 0x2d, 0x6d, 0x6f, 0x72, 0x66, 0x84, 0x00, 0x00,
+  0x00, 0x07, 0x61, 0x63, 0x65, 0x6c, 0x6f, 0x72, 0x75, 0x00, 0x29, 0x7b,
+  0x00, 0x2c, 0x16, 0x00, 0x2c, 0x1f, 0x00, 0x2c, 0x2e, 0x00, 0x29, 0x7b,
+  0x00, 0x2c, 0x3f, 0x00, 0x02, 0x6a, 0x06, 0x69, 0x6c, 0x73, 0x2d, 0x73,
+  0x69, 0x84, 0x00, 0x04, 0x65, 0x67, 0x2d, 0x61, 0x00, 0x02, 0x2d, 0x73,
+  0x00, 0x14, 0x8a, 0x00, 0x14, 0x8f, 0x0e, 0x61, 0x74, 0x73, 0x6e, 0x61,
+  0x65, 0x62, 0x63, 0x69, 0x74, 0x73, 0x61, 0x6c, 0x65, 0x84, 0x00, 0x03,
+  0x6f, 0x77, 0x2d, 0x00, 0x02, 0x73, 0x74, 0x00, 0x2a, 0xfc, 0x00, 0x2b,
+  0x04, 0x00, 0x00, 0x04, 0x61, 0x66, 0x69, 0x72, 0x00, 0x2c, 0x60, 0x00,
+  0x29, 0x7b, 0x00, 0x2c, 0x77, 0x00, 0x2c, 0x8d, 0x00, 0x00, 0x02, 0x2d,
+  0x72, 0x00, 0x13, 0xf8, 0x00, 0x2c, 0x6b, 0x09, 0x65, 0x62, 0x69, 0x6c,
+  0x2d, 0x61, 0x2d, 0x73, 0x69, 0x84, 0x00, 0x00, 0x00, 0x02, 0x2d, 0x61,
+  0x00, 0x13, 0xf8, 0x00, 0x2c, 0x82, 0x08, 0x6d, 0x2d, 0x73, 0x6e, 0x64,
+  0x6e, 0x79, 0x64, 0x84, 0x00, 0x02, 0x75, 0x2d, 0x00, 0x02, 0x65, 0x74,
+  0x00, 0x2c, 0x9a, 0x00, 0x2c, 0xa2, 0x05, 0x6c, 0x70, 0x6d, 0x69, 0x73,
+  0x84, 0x00, 0x03, 0x61, 0x65, 0x6e, 0x84, 0x00, 0x00, 0x40, 0x61, 0x14,
+  0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x06, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x2c, 0xd8, 0x00,
+  0x02, 0x6a, 0x00, 0x2d, 0x41, 0x00, 0x29, 0x7b, 0x00, 0x29, 0x7b, 0x00,
+  0x2d, 0x4c, 0x00, 0x2d, 0x86, 0x00, 0x29, 0x7b, 0x00, 0x00, 0x03, 0x63,
+  0x66, 0x69, 0x00, 0x2c, 0xe7, 0x00, 0x2c, 0xf6, 0x00, 0x2d, 0x1b, 0x0c,
+  0x69, 0x6c, 0x62, 0x75, 0x70, 0x65, 0x72, 0x2d, 0x61, 0x2d, 0x73, 0x69,
+  0x84, 0x00, 0x00, 0x00, 0x02, 0x2d, 0x72, 0x00, 0x2d, 0x01, 0x00, 0x2d,
+  0x0e, 0x0a, 0x73, 0x6c, 0x6c, 0x75, 0x62, 0x2d, 0x61, 0x2d, 0x73, 0x69,
+  0x84, 0x00, 0x0a, 0x61, 0x63, 0x73, 0x61, 0x6e, 0x2d, 0x61, 0x2d, 0x73,
+  0x69, 0x84, 0x00, 0x00, 0x00, 0x02, 0x63, 0x72, 0x00, 0x2d, 0x26, 0x00,
+  0x2d, 0x32, 0x09, 0x69, 0x73, 0x75, 0x6d, 0x2d, 0x61, 0x2d, 0x73, 0x69,
+  0x84, 0x00, 0x0c, 0x61, 0x74, 0x72, 0x65, 0x62, 0x69, 0x6c, 0x2d, 0x61,
+  0x2d, 0x73, 0x69, 0x84, 0x00, 0x08, 0x65, 0x72, 0x67, 0x2d, 0x61, 0x2d,
+  0x73, 0x69, 0x84, 0x00, 0x00, 0x00, 0x03, 0x69, 0x72, 0x73, 0x00, 0x2d,
+  0x5b, 0x00, 0x2d, 0x6a, 0x00, 0x2d, 0x77, 0x0c, 0x73, 0x61, 0x6d, 0x2d,
+  0x61, 0x6c, 0x2d, 0x61, 0x2d, 0x74, 0x73, 0x65, 0x84, 0x00, 0x0a, 0x74,
+  0x61, 0x70, 0x2d, 0x65, 0x6c, 0x2d, 0x74, 0x73, 0x65, 0x84, 0x00, 0x0c,
+  0x69, 0x61, 0x6d, 0x2d, 0x61, 0x6c, 0x2d, 0x61, 0x2d, 0x74, 0x73, 0x65,
+  0x84, 0x00, 0x01, 0x6a, 0x84, 0x00, 0x00, 0x00, 0x03, 0x6a, 0x6d, 0x6e,
+  0x00, 0x2d, 0x99, 0x00, 0x29, 0x7b, 0x00, 0x02, 0x6a, 0x05, 0x6f, 0x64,
+  0x73, 0x6e, 0x64, 0x84, 0x00, 0x01, 0x69, 0x00, 0x03, 0x2d, 0x66, 0x79,
+  0x00, 0x2b, 0xab, 0x00, 0x2d, 0xb1, 0x00, 0x2d, 0xb7, 0x03, 0x6c, 0x65,
+  0x73, 0x84, 0x00, 0x04, 0x6d, 0x74, 0x65, 0x67, 0x84, 0x00, 0x00, 0x40,
+  0x61, 0x15, 0x01, 0x02, 0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x06, 0x07, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x2d, 0xef, 0x00, 0x02, 0x6a, 0x00, 0x2e, 0x07, 0x00, 0x02, 0x6a, 0x00,
+  0x02, 0x6a, 0x00, 0x2f, 0x44, 0x00, 0x29, 0x7b, 0x00, 0x2f, 0x86, 0x00,
+  0x84, 0x02, 0x2d, 0x74, 0x00, 0x13, 0xf8, 0x00, 0x2d, 0xfa, 0x0a, 0x73,
+  0x6b, 0x63, 0x6f, 0x72, 0x2d, 0x61, 0x2d, 0x73, 0x69, 0x84, 0x00, 0x00,
+  0x40, 0x65, 0x15, 0x01, 0x00, 0x02, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x08, 0x00, 0x09, 0x00, 0x00, 0x0a,
+  0x00, 0x2e, 0x3e, 0x00, 0x2e, 0x4c, 0x00, 0x2e, 0x58, 0x00, 0x2e, 0x7e,
+  0x00, 0x2e, 0x8e, 0x00, 0x2e, 0xd0, 0x00, 0x2e, 0xf7, 0x00, 0x2f, 0x03,
+  0x00, 0x2f, 0x18, 0x00, 0x2f, 0x25, 0x0b, 0x6e, 0x69, 0x67, 0x6e, 0x65,
+  0x2d, 0x6e, 0x61, 0x2d, 0x73, 0x69, 0x84, 0x00, 0x09, 0x67, 0x6f, 0x6c,
+  0x62, 0x2d, 0x61, 0x2d, 0x73, 0x69, 0x84, 0x00, 0x00, 0x00, 0x02, 0x63,
+  0x70, 0x00, 0x2e, 0x63, 0x00, 0x2e, 0x6e, 0x08, 0x61, 0x65, 0x74, 0x2d,
+  0x61, 0x2d, 0x73, 0x69, 0x84, 0x00, 0x0d, 0x61, 0x72, 0x67, 0x6f, 0x74,
+  0x6f, 0x68, 0x70, 0x2d, 0x61, 0x2d, 0x73, 0x69, 0x84, 0x00, 0x0d, 0x72,
+  0x6f, 0x77, 0x2d, 0x64, 0x72, 0x61, 0x68, 0x2d, 0x61, 0x2d, 0x73, 0x69,
+  0x84, 0x00, 0x00, 0x00, 0x02, 0x67, 0x69, 0x00, 0x2e, 0x99, 0x00, 0x2e,
+  0xa5, 0x09, 0x69, 0x73, 0x65, 0x64, 0x2d, 0x61, 0x2d, 0x73, 0x69, 0x84,
+  0x00, 0x01, 0x61, 0x00, 0x02, 0x72, 0x74, 0x00, 0x2e, 0xb1, 0x00, 0x2e,
+  0xc2, 0x0e, 0x74, 0x6c, 0x61, 0x6e, 0x6f, 0x73, 0x72, 0x65, 0x70, 0x2d,
+  0x61, 0x2d, 0x73, 0x69, 0x84, 0x00, 0x0b, 0x72, 0x65, 0x74, 0x6e, 0x65,
+  0x2d, 0x6e, 0x61, 0x2d, 0x73, 0x69, 0x84, 0x00, 0x00, 0x00, 0x02, 0x61,
+  0x65, 0x00, 0x2e, 0xdb, 0x00, 0x2e, 0xe9, 0x0b, 0x63, 0x73, 0x64, 0x6e,
+  0x61, 0x6c, 0x2d, 0x61, 0x2d, 0x73, 0x69, 0x84, 0x00, 0x0b, 0x65, 0x6b,
+  0x6b, 0x6f, 0x6f, 0x62, 0x2d, 0x61, 0x2d, 0x73, 0x69, 0x84, 0x00, 0x09,
+  0x65, 0x74, 0x61, 0x63, 0x2d, 0x61, 0x2d, 0x73, 0x69, 0x84, 0x00, 0x01,
+  0x6e, 0x00, 0x02, 0x69, 0x75, 0x00, 0x14, 0xd6, 0x00, 0x2f, 0x0f, 0x06,
+  0x68, 0x2d, 0x61, 0x2d, 0x73, 0x69, 0x84, 0x00, 0x0a, 0x72, 0x65, 0x73,
+  0x2d, 0x73, 0x6e, 0x64, 0x6e, 0x79, 0x64, 0x84, 0x00, 0x00, 0x00, 0x02,
+  0x61, 0x77, 0x00, 0x2f, 0x30, 0x00, 0x2f, 0x3a, 0x07, 0x6c, 0x70, 0x2d,
+  0x61, 0x2d, 0x73, 0x69, 0x84, 0x00, 0x07, 0x61, 0x6c, 0x2d, 0x61, 0x2d,
+  0x73, 0x69, 0x84, 0x00, 0x00, 0x00, 0x03, 0x2d, 0x73, 0x74, 0x00, 0x13,
+  0xf8, 0x00, 0x2f, 0x53, 0x00, 0x2f, 0x68, 0x12, 0x69, 0x76, 0x64, 0x61,
+  0x6c, 0x61, 0x69, 0x63, 0x6e, 0x61, 0x6e, 0x69, 0x66, 0x2d, 0x61, 0x2d,
+  0x73, 0x69, 0x84, 0x00, 0x01, 0x63, 0x00, 0x02, 0x61, 0x6f, 0x00, 0x2f,
+  0x74, 0x00, 0x2f, 0x7d, 0x06, 0x2d, 0x6e, 0x61, 0x2d, 0x73, 0x69, 0x84,
+  0x00, 0x06, 0x64, 0x2d, 0x61, 0x2d, 0x73, 0x69, 0x84, 0x00, 0x00, 0x00,
+  0x02, 0x61, 0x65, 0x00, 0x2f, 0x91, 0x00, 0x2f, 0x9b, 0x07, 0x73, 0x2d,
+  0x6f, 0x2d, 0x6e, 0x79, 0x64, 0x84, 0x00, 0x0d, 0x75, 0x67, 0x6f, 0x6c,
+  0x62, 0x2d, 0x6e, 0x6f, 0x6d, 0x2d, 0x74, 0x73, 0x65, 0x84, 0x00, 0x00,
+  0x40, 0x61, 0x17, 0x01, 0x02, 0x03, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05,
+  0x00, 0x06, 0x00, 0x07, 0x08, 0x00, 0x00, 0x00, 0x09, 0x0a, 0x00, 0x0b,
+  0x00, 0x0c, 0x00, 0x15, 0x50, 0x00, 0x15, 0x68, 0x00, 0x2f, 0xea, 0x00,
+  0x2f, 0xf6, 0x00, 0x30, 0x1e, 0x00, 0x29, 0x7b, 0x00, 0x29, 0x7b, 0x00,
+  0x30, 0x29, 0x00, 0x30, 0x53, 0x00, 0x30, 0x76, 0x00, 0x02, 0x6a, 0x00,
+  0x30, 0x9b, 0x09, 0x69, 0x70, 0x2d, 0x73, 0x6e, 0x64, 0x6e, 0x79, 0x64,
+  0x84, 0x00, 0x00, 0x00, 0x02, 0x6c, 0x6d, 0x00, 0x30, 0x01, 0x00, 0x30,
+  0x11, 0x0d, 0x61, 0x68, 0x77, 0x2d, 0x65, 0x68, 0x74, 0x2d, 0x73, 0x65,
+  0x76, 0x61, 0x73, 0x84, 0x00, 0x0a, 0x61, 0x67, 0x2d, 0x6f, 0x74, 0x6e,
+  0x69, 0x2d, 0x73, 0x69, 0x84, 0x00, 0x08, 0x70, 0x61, 0x65, 0x6c, 0x67,
+  0x6f, 0x6f, 0x67, 0x84, 0x00, 0x00, 0x00, 0x02, 0x64, 0x6f, 0x00, 0x30,
+  0x34, 0x00, 0x30, 0x43, 0x00, 0x00, 0x03, 0x67, 0x6d, 0x74, 0x00, 0x14,
+  0x5d, 0x00, 0x15, 0x93, 0x00, 0x15, 0xb6, 0x0d, 0x6f, 0x74, 0x72, 0x61,
+  0x63, 0x2d, 0x6f, 0x74, 0x6e, 0x69, 0x2d, 0x73, 0x69, 0x84, 0x00, 0x00,
+  0x00, 0x02, 0x61, 0x65, 0x00, 0x30, 0x5e, 0x00, 0x30, 0x6a, 0x09, 0x63,
+  0x2d, 0x6f, 0x74, 0x6e, 0x69, 0x2d, 0x73, 0x69, 0x84, 0x00, 0x09, 0x74,
+  0x73, 0x6f, 0x68, 0x6d, 0x61, 0x65, 0x72, 0x64, 0x84, 0x00, 0x01, 0x65,
+  0x00, 0x02, 0x6c, 0x72, 0x00, 0x30, 0x82, 0x00, 0x30, 0x8f, 0x0a, 0x2d,
+  0x72, 0x6f, 0x66, 0x2d, 0x73, 0x6c, 0x6c, 0x65, 0x73, 0x84, 0x00, 0x09,
+  0x74, 0x63, 0x61, 0x2d, 0x6e, 0x61, 0x2d, 0x73, 0x69, 0x84, 0x00, 0x08,
+  0x61, 0x6e, 0x6f, 0x7a, 0x61, 0x6d, 0x61, 0x2e, 0x00, 0x04, 0x31, 0x32,
+  0x33, 0x62, 0x00, 0x30, 0xb6, 0x00, 0x31, 0x7e, 0x00, 0x30, 0xe8, 0x00,
+  0x31, 0xb1, 0x03, 0x2d, 0x74, 0x73, 0x00, 0x02, 0x61, 0x65, 0x00, 0x30,
+  0xc4, 0x00, 0x31, 0x35, 0x01, 0x65, 0x00, 0x02, 0x2d, 0x68, 0x00, 0x30,
+  0xd0, 0x00, 0x31, 0x07, 0x00, 0x00, 0x02, 0x61, 0x73, 0x00, 0x30, 0xdb,
+  0x00, 0x30, 0xf8, 0x02, 0x73, 0x2d, 0x00, 0x02, 0x33, 0x65, 0x00, 0x30,
+  0xe8, 0x00, 0x30, 0xec, 0x01, 0x73, 0x84, 0x00, 0x09, 0x74, 0x69, 0x73,
+  0x62, 0x65, 0x77, 0x2d, 0x33, 0x73, 0x84, 0x00, 0x0c, 0x75, 0x2d, 0x65,
+  0x74, 0x69, 0x73, 0x62, 0x65, 0x77, 0x2d, 0x33, 0x73, 0x84, 0x00, 0x01,
+  0x74, 0x00, 0x02, 0x72, 0x75, 0x00, 0x31, 0x13, 0x00, 0x31, 0x24, 0x06,
+  0x6f, 0x6e, 0x2d, 0x70, 0x61, 0x2d, 0x00, 0x02, 0x33, 0x65, 0x00, 0x30,
+  0xe8, 0x00, 0x30, 0xec, 0x06, 0x6f, 0x73, 0x2d, 0x70, 0x61, 0x2d, 0x00,
+  0x02, 0x33, 0x65, 0x00, 0x30, 0xe8, 0x00, 0x30, 0xec, 0x02, 0x77, 0x2d,
+  0x00, 0x03, 0x73, 0x75, 0x76, 0x00, 0x31, 0x46, 0x00, 0x31, 0x53, 0x00,
+  0x31, 0x60, 0x02, 0x75, 0x2d, 0x00, 0x02, 0x33, 0x65, 0x00, 0x30, 0xe8,
+  0x00, 0x30, 0xec, 0x02, 0x65, 0x2d, 0x00, 0x02, 0x33, 0x65, 0x00, 0x30,
+  0xe8, 0x00, 0x30, 0xec, 0x06, 0x6f, 0x67, 0x2d, 0x73, 0x75, 0x2d, 0x00,
+  0x03, 0x33, 0x65, 0x73, 0x00, 0x30, 0xe8, 0x00, 0x30, 0xec, 0x00, 0x31,
+  0x75, 0x06, 0x70, 0x69, 0x66, 0x2d, 0x33, 0x73, 0x84, 0x00, 0x03, 0x2d,
+  0x74, 0x73, 0x00, 0x02, 0x61, 0x65, 0x00, 0x31, 0x8c, 0x00, 0x31, 0xa1,
+  0x0a, 0x65, 0x68, 0x74, 0x75, 0x6f, 0x73, 0x2d, 0x70, 0x61, 0x2d, 0x00,
+  0x02, 0x33, 0x65, 0x00, 0x30, 0xe8, 0x00, 0x30, 0xec, 0x05, 0x77, 0x2d,
+  0x73, 0x75, 0x2d, 0x00, 0x02, 0x33, 0x65, 0x00, 0x30, 0xe8, 0x00, 0x30,
+  0xec, 0x02, 0x6c, 0x65, 0x84, 0x00, 0x00, 0x40, 0x61, 0x16, 0x01, 0x00,
+  0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05,
+  0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x08, 0x09, 0x00, 0x31, 0xeb, 0x00,
+  0x29, 0x7b, 0x00, 0x31, 0xf9, 0x00, 0x29, 0x7b, 0x00, 0x32, 0x0f, 0x00,
+  0x32, 0x4c, 0x00, 0x32, 0x68, 0x00, 0x32, 0xc4, 0x00, 0x29, 0x7b, 0x0b,
+  0x72, 0x63, 0x6f, 0x6d, 0x65, 0x64, 0x2d, 0x61, 0x2d, 0x73, 0x69, 0x84,
+  0x00, 0x02, 0x65, 0x6c, 0x00, 0x02, 0x2d, 0x72, 0x00, 0x14, 0x8a, 0x00,
+  0x32, 0x06, 0x06, 0x65, 0x62, 0x75, 0x2d, 0x73, 0x69, 0x84, 0x00, 0x00,
+  0x00, 0x02, 0x61, 0x65, 0x00, 0x32, 0x1a, 0x00, 0x32, 0x2a, 0x0d, 0x74,
+  0x6e, 0x75, 0x6f, 0x63, 0x63, 0x61, 0x2d, 0x6e, 0x61, 0x2d, 0x73, 0x69,
+  0x84, 0x00, 0x00, 0x00, 0x02, 0x64, 0x72, 0x00, 0x32, 0x35, 0x00, 0x32,
+  0x40, 0x08, 0x75, 0x74, 0x73, 0x2d, 0x61, 0x2d, 0x73, 0x69, 0x84, 0x00,
+  0x09, 0x2d, 0x6f, 0x74, 0x2d, 0x65, 0x63, 0x61, 0x70, 0x73, 0x84, 0x00,
+  0x02, 0x70, 0x73, 0x00, 0x03, 0x65, 0x67, 0x70, 0x00, 0x32, 0x5d, 0x00,
+  0x14, 0x5d, 0x00, 0x32, 0x63, 0x03, 0x64, 0x6f, 0x63, 0x84, 0x00, 0x02,
+  0x70, 0x61, 0x84, 0x00, 0x01, 0x69, 0x00, 0x05, 0x68, 0x6c, 0x70, 0x74,
+  0x78, 0x00, 0x32, 0x80, 0x00, 0x32, 0x91, 0x00, 0x32, 0x9e, 0x00, 0x32,
+  0xab, 0x00, 0x32, 0xb6, 0x06, 0x63, 0x72, 0x61, 0x6e, 0x61, 0x2d, 0x00,
+  0x02, 0x61, 0x6e, 0x00, 0x16, 0x50, 0x00, 0x29, 0xb2, 0x0a, 0x61, 0x69,
+  0x63, 0x6f, 0x73, 0x2d, 0x61, 0x2d, 0x73, 0x69, 0x84, 0x00, 0x0a, 0x61,
+  0x72, 0x65, 0x68, 0x74, 0x2d, 0x61, 0x2d, 0x73, 0x69, 0x84, 0x00, 0x08,
+  0x72, 0x61, 0x2d, 0x6e, 0x61, 0x2d, 0x73, 0x69, 0x84, 0x00, 0x03, 0x65,
+  0x74, 0x6e, 0x00, 0x02, 0x6f, 0x73, 0x00, 0x16, 0x33, 0x00, 0x16, 0x37,
+  0x00, 0x00, 0x02, 0x2d, 0x6e, 0x00, 0x13, 0xf8, 0x00, 0x32, 0xcf, 0x0a,
+  0x79, 0x65, 0x6b, 0x63, 0x6f, 0x68, 0x2d, 0x61, 0x73, 0x69, 0x84, 0x00,
+  0x00, 0x00, 0x05, 0x2d, 0x65, 0x68, 0x6f, 0x72, 0x00, 0x32, 0xf3, 0x00,
+  0x02, 0x6a, 0x00, 0x02, 0x6a, 0x00, 0x32, 0xff, 0x00, 0x33, 0x10, 0x09,
+  0x72, 0x6f, 0x66, 0x2d, 0x73, 0x6c, 0x6c, 0x65, 0x73, 0x84, 0x00, 0x0e,
+  0x79, 0x6e, 0x61, 0x68, 0x74, 0x72, 0x65, 0x74, 0x72, 0x61, 0x6d, 0x73,
+  0x73, 0x69, 0x84, 0x00, 0x00, 0x84, 0x01, 0x75, 0x00, 0x33, 0x17, 0x06,
+  0x67, 0x2d, 0x61, 0x2d, 0x73, 0x69, 0x84, 0x00, 0x00, 0x00, 0x02, 0x6e,
+  0x77, 0x00, 0x29, 0x7b, 0x00, 0x29, 0x7b, 0x00, 0x00, 0x04, 0x69, 0x6f,
+  0x74, 0x75, 0x00, 0x16, 0x61, 0x00, 0x33, 0x3e, 0x00, 0x29, 0x7b, 0x00,
+  0x16, 0x6a, 0x08, 0x62, 0x61, 0x6e, 0x69, 0x61, 0x74, 0x65, 0x62, 0x84,
+  0x00, 0x00, 0x00, 0x04, 0x64, 0x6b, 0x75, 0x77, 0x00, 0x33, 0x5c, 0x00,
+  0x29, 0x7b, 0x00, 0x02, 0x6a, 0x00, 0x29, 0x7b, 0x08, 0x6e, 0x61, 0x63,
+  0x73, 0x65, 0x6b, 0x69, 0x6c, 0x84, 0x00, 0x00, 0x80, 0x01, 0x2e, 0x00,
+  0x33, 0x6e, 0x00, 0x00, 0x07, 0x67, 0x6c, 0x6d, 0x6f, 0x74, 0x75, 0x76,
+  0x00, 0x01, 0x72, 0x00, 0x01, 0x7d, 0x00, 0x03, 0x9d, 0x00, 0x01, 0x87,
+  0x00, 0x01, 0x8f, 0x00, 0x01, 0x94, 0x00, 0x01, 0x99, 0x04, 0x65, 0x73,
+  0x75, 0x6d, 0x80, 0x01, 0x2e, 0x00, 0x33, 0x98, 0x00, 0x40, 0x61, 0x1a,
+  0x01, 0x00, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x00, 0x09, 0x0a,
+  0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x00, 0x14, 0x15,
+  0x16, 0x17, 0x00, 0x33, 0xfb, 0x00, 0x36, 0xe9, 0x00, 0x37, 0x83, 0x00,
+  0x38, 0x74, 0x00, 0x3c, 0x11, 0x00, 0x3c, 0x29, 0x00, 0x3d, 0x66, 0x00,
+  0x3e, 0x18, 0x00, 0x3e, 0x81, 0x00, 0x3f, 0x3f, 0x00, 0x40, 0xb5, 0x00,
+  0x41, 0x83, 0x00, 0x45, 0x88, 0x00, 0x46, 0xba, 0x00, 0x46, 0xc4, 0x00,
+  0x46, 0xca, 0x00, 0x47, 0xfa, 0x00, 0x4b, 0x28, 0x00, 0x4c, 0xfe, 0x00,
+  0x4d, 0x30, 0x00, 0x4d, 0x42, 0x00, 0x4d, 0x63, 0x00, 0x50, 0x29, 0x00,
+  0x40, 0x39, 0x42, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x04, 0x05,
+  0x00, 0x06, 0x07, 0x08, 0x00, 0x09, 0x0a, 0x0b, 0x0c, 0x00, 0x00, 0x00,
+  0x0d, 0x0e, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x34, 0x71,
+  0x00, 0x34, 0x96, 0x00, 0x34, 0x9d, 0x00, 0x34, 0xca, 0x00, 0x34, 0xf4,
+  0x00, 0x35, 0x17, 0x00, 0x35, 0x37, 0x00, 0x35, 0x3d, 0x00, 0x35, 0xe3,
+  0x00, 0x35, 0xf6, 0x00, 0x36, 0x29, 0x00, 0x36, 0x5f, 0x00, 0x36, 0xa9,
+  0x00, 0x07, 0xb6, 0x00, 0x36, 0xc8, 0x00, 0x36, 0xe3, 0x22, 0x32, 0x63,
+  0x68, 0x67, 0x2d, 0x73, 0x65, 0x61, 0x63, 0x69, 0x6e, 0x75, 0x6d, 0x6f,
+  0x63, 0x65, 0x6c, 0x65, 0x74, 0x2d, 0x65, 0x2d, 0x73, 0x6f, 0x69, 0x65,
+  0x72, 0x72, 0x6f, 0x63, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x04, 0x74,
+  0x6e, 0x61, 0x76, 0x80, 0x00, 0x00, 0x00, 0x02, 0x69, 0x72, 0x00, 0x34,
+  0xa8, 0x00, 0x34, 0xc2, 0x00, 0x00, 0x02, 0x61, 0x72, 0x00, 0x34, 0xb3,
+  0x00, 0x34, 0xb9, 0x03, 0x64, 0x75, 0x6a, 0x80, 0x00, 0x06, 0x66, 0x61,
+  0x74, 0x73, 0x61, 0x65, 0x80, 0x00, 0x05, 0x6f, 0x6c, 0x6c, 0x61, 0x6d,
+  0x80, 0x00, 0x00, 0x00, 0x03, 0x61, 0x65, 0x69, 0x00, 0x34, 0xd9, 0x00,
+  0x34, 0xdf, 0x00, 0x34, 0xed, 0x03, 0x6e, 0x61, 0x63, 0x80, 0x00, 0x0b,
+  0x6e, 0x6f, 0x6d, 0x61, 0x6c, 0x65, 0x64, 0x61, 0x73, 0x61, 0x63, 0x80,
+  0x00, 0x04, 0x72, 0x6f, 0x6c, 0x66, 0x80, 0x00, 0x00, 0x00, 0x02, 0x72,
+  0x73, 0x00, 0x34, 0xff, 0x00, 0x35, 0x0f, 0x0d, 0x61, 0x61, 0x69, 0x68,
+  0x70, 0x6c, 0x65, 0x64, 0x61, 0x6c, 0x69, 0x68, 0x70, 0x80, 0x00, 0x05,
+  0x72, 0x65, 0x64, 0x6e, 0x75, 0x80, 0x00, 0x00, 0x00, 0x02, 0x68, 0x6f,
+  0x00, 0x35, 0x22, 0x00, 0x35, 0x2c, 0x07, 0x61, 0x6e, 0x6e, 0x61, 0x76,
+  0x61, 0x73, 0x80, 0x00, 0x08, 0x6f, 0x6e, 0x61, 0x74, 0x74, 0x61, 0x68,
+  0x63, 0x80, 0x00, 0x03, 0x61, 0x6d, 0x6f, 0x80, 0x00, 0x00, 0x40, 0x61,
+  0x14, 0x01, 0x02, 0x00, 0x03, 0x00, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x08, 0x09, 0x00, 0x35, 0x70,
+  0x00, 0x35, 0x77, 0x00, 0x04, 0x75, 0x00, 0x35, 0x8c, 0x00, 0x35, 0x93,
+  0x00, 0x35, 0x9f, 0x00, 0x35, 0xba, 0x00, 0x35, 0xd5, 0x00, 0x35, 0xdb,
+  0x04, 0x75, 0x68, 0x73, 0x75, 0x80, 0x00, 0x05, 0x6d, 0x75, 0x6c, 0x6f,
+  0x63, 0x80, 0x01, 0x68, 0x00, 0x35, 0x83, 0x06, 0x73, 0x69, 0x74, 0x69,
+  0x72, 0x62, 0x80, 0x00, 0x04, 0x72, 0x6f, 0x65, 0x67, 0x80, 0x00, 0x09,
+  0x70, 0x6c, 0x65, 0x64, 0x61, 0x6c, 0x69, 0x68, 0x70, 0x80, 0x00, 0x00,
+  0x00, 0x02, 0x61, 0x65, 0x00, 0x35, 0xaa, 0x00, 0x35, 0xb2, 0x05, 0x72,
+  0x74, 0x73, 0x75, 0x61, 0x80, 0x00, 0x05, 0x74, 0x61, 0x6c, 0x69, 0x66,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x69, 0x72, 0x00, 0x35, 0xc5, 0x00, 0x35,
+  0xcc, 0x04, 0x67, 0x72, 0x69, 0x76, 0x80, 0x00, 0x06, 0x6f, 0x66, 0x69,
+  0x6c, 0x61, 0x63, 0x80, 0x00, 0x03, 0x73, 0x75, 0x72, 0x80, 0x00, 0x05,
+  0x73, 0x6f, 0x6e, 0x6f, 0x64, 0x80, 0x00, 0x02, 0x73, 0x61, 0x00, 0x02,
+  0x6c, 0x72, 0x00, 0x02, 0xa9, 0x00, 0x35, 0xf0, 0x03, 0x62, 0x65, 0x6e,
+  0x80, 0x00, 0x00, 0x00, 0x03, 0x6c, 0x71, 0x75, 0x00, 0x36, 0x05, 0x00,
+  0x36, 0x0c, 0x00, 0x36, 0x17, 0x04, 0x6f, 0x6a, 0x61, 0x6c, 0x80, 0x00,
+  0x08, 0x2d, 0x73, 0x6e, 0x6c, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x05,
+  0x6f, 0x73, 0x73, 0x69, 0x6d, 0x80, 0x01, 0x74, 0x00, 0x36, 0x23, 0x03,
+  0x72, 0x6f, 0x66, 0x80, 0x00, 0x00, 0x00, 0x03, 0x61, 0x65, 0x6f, 0x00,
+  0x36, 0x38, 0x00, 0x36, 0x4e, 0x00, 0x36, 0x54, 0x00, 0x00, 0x02, 0x62,
+  0x6e, 0x00, 0x36, 0x43, 0x00, 0x36, 0x49, 0x03, 0x61, 0x6c, 0x61, 0x80,
+  0x00, 0x02, 0x61, 0x70, 0x80, 0x00, 0x03, 0x6e, 0x69, 0x63, 0x80, 0x00,
+  0x00, 0x00, 0x02, 0x6d, 0x72, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00,
+  0x00, 0x04, 0x61, 0x65, 0x69, 0x6f, 0x00, 0x36, 0x72, 0x00, 0x36, 0x8b,
+  0x00, 0x36, 0x93, 0x00, 0x36, 0xa0, 0x00, 0x00, 0x02, 0x63, 0x69, 0x00,
+  0x36, 0x7d, 0x00, 0x36, 0x85, 0x05, 0x69, 0x72, 0x65, 0x6d, 0x61, 0x80,
+  0x00, 0x03, 0x64, 0x6e, 0x69, 0x80, 0x00, 0x05, 0x64, 0x61, 0x73, 0x61,
+  0x70, 0x80, 0x00, 0x0a, 0x6c, 0x6f, 0x72, 0x61, 0x63, 0x68, 0x74, 0x75,
+  0x6f, 0x73, 0x80, 0x00, 0x06, 0x6c, 0x65, 0x63, 0x72, 0x61, 0x62, 0x80,
+  0x00, 0x00, 0x00, 0x02, 0x61, 0x65, 0x00, 0x36, 0xb4, 0x00, 0x36, 0xc0,
+  0x09, 0x62, 0x72, 0x61, 0x62, 0x61, 0x74, 0x6e, 0x61, 0x73, 0x80, 0x00,
+  0x05, 0x7a, 0x7a, 0x69, 0x76, 0x73, 0x80, 0x00, 0x00, 0x00, 0x02, 0x6e,
+  0x6f, 0x00, 0x36, 0xd3, 0x00, 0x36, 0xda, 0x04, 0x61, 0x6c, 0x74, 0x61,
+  0x80, 0x00, 0x06, 0x73, 0x65, 0x6e, 0x6e, 0x69, 0x6d, 0x80, 0x00, 0x03,
+  0x61, 0x6c, 0x70, 0x80, 0x00, 0x00, 0x00, 0x04, 0x64, 0x65, 0x69, 0x79,
+  0x00, 0x36, 0xfc, 0x00, 0x37, 0x09, 0x00, 0x37, 0x10, 0x00, 0x02, 0x03,
+  0x0a, 0x6e, 0x6f, 0x74, 0x67, 0x6e, 0x69, 0x68, 0x73, 0x61, 0x77, 0x80,
+  0x00, 0x04, 0x62, 0x65, 0x75, 0x71, 0x80, 0x00, 0x00, 0x00, 0x07, 0x64,
+  0x66, 0x68, 0x6c, 0x73, 0x74, 0x76, 0x00, 0x37, 0x2f, 0x00, 0x37, 0x3b,
+  0x00, 0x37, 0x42, 0x00, 0x37, 0x4f, 0x00, 0x37, 0x55, 0x00, 0x37, 0x5a,
+  0x00, 0x07, 0xb6, 0x09, 0x65, 0x70, 0x6f, 0x6c, 0x63, 0x79, 0x63, 0x6e,
+  0x65, 0x80, 0x00, 0x04, 0x69, 0x63, 0x61, 0x70, 0x80, 0x00, 0x0a, 0x70,
+  0x61, 0x72, 0x67, 0x6f, 0x6e, 0x61, 0x65, 0x63, 0x6f, 0x80, 0x00, 0x03,
+  0x62, 0x75, 0x70, 0x80, 0x00, 0x02, 0x75, 0x6d, 0x80, 0x00, 0x00, 0x00,
+  0x03, 0x63, 0x6c, 0x6e, 0x00, 0x37, 0x69, 0x00, 0x37, 0x74, 0x00, 0x37,
+  0x79, 0x08, 0x61, 0x72, 0x70, 0x6f, 0x72, 0x69, 0x68, 0x63, 0x80, 0x00,
+  0x02, 0x65, 0x63, 0x80, 0x00, 0x07, 0x61, 0x6c, 0x74, 0x61, 0x64, 0x69,
+  0x6d, 0x80, 0x00, 0x00, 0x00, 0x05, 0x61, 0x69, 0x6c, 0x6e, 0x72, 0x00,
+  0x37, 0x9a, 0x00, 0x37, 0xc5, 0x00, 0x37, 0xe3, 0x00, 0x37, 0xe9, 0x00,
+  0x38, 0x5b, 0x00, 0x00, 0x04, 0x64, 0x65, 0x6d, 0x6f, 0x00, 0x37, 0xad,
+  0x00, 0x37, 0xb4, 0x00, 0x01, 0xed, 0x00, 0x37, 0xbd, 0x04, 0x68, 0x67,
+  0x61, 0x62, 0x80, 0x00, 0x06, 0x74, 0x73, 0x6d, 0x72, 0x61, 0x66, 0x80,
+  0x00, 0x05, 0x72, 0x6c, 0x69, 0x61, 0x72, 0x80, 0x00, 0x00, 0x00, 0x02,
+  0x72, 0x75, 0x00, 0x37, 0xd0, 0x00, 0x37, 0xd6, 0x03, 0x64, 0x61, 0x6d,
+  0x80, 0x00, 0x0a, 0x6c, 0x65, 0x67, 0x6e, 0x65, 0x64, 0x6c, 0x65, 0x65,
+  0x62, 0x80, 0x00, 0x03, 0x65, 0x69, 0x66, 0x80, 0x00, 0x00, 0x00, 0x02,
+  0x61, 0x75, 0x00, 0x37, 0xf4, 0x00, 0x38, 0x36, 0x00, 0x80, 0x01, 0x6c,
+  0x00, 0x37, 0xfb, 0x00, 0x00, 0x05, 0x67, 0x6e, 0x72, 0x74, 0x79, 0x00,
+  0x38, 0x12, 0x00, 0x0a, 0x0e, 0x00, 0x38, 0x17, 0x00, 0x38, 0x20, 0x00,
+  0x38, 0x30, 0x02, 0x6e, 0x65, 0x80, 0x00, 0x06, 0x61, 0x67, 0x79, 0x64,
+  0x75, 0x6a, 0x80, 0x00, 0x00, 0x00, 0x02, 0x6f, 0x72, 0x00, 0x04, 0x33,
+  0x00, 0x38, 0x2b, 0x02, 0x6f, 0x70, 0x80, 0x00, 0x03, 0x72, 0x61, 0x6d,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x62, 0x6f, 0x00, 0x38, 0x41, 0x00, 0x38,
+  0x4f, 0x0b, 0x72, 0x6f, 0x66, 0x73, 0x64, 0x67, 0x79, 0x62, 0x6d, 0x65,
+  0x68, 0x80, 0x00, 0x09, 0x73, 0x64, 0x6e, 0x61, 0x65, 0x67, 0x61, 0x6d,
+  0x69, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x6f, 0x00, 0x38, 0x66, 0x00,
+  0x38, 0x6e, 0x05, 0x75, 0x67, 0x72, 0x69, 0x61, 0x80, 0x00, 0x03, 0x66,
+  0x78, 0x6f, 0x80, 0x00, 0x00, 0x40, 0x63, 0x14, 0x01, 0x02, 0x03, 0x04,
+  0x05, 0x00, 0x06, 0x00, 0x07, 0x08, 0x09, 0x0a, 0x00, 0x00, 0x00, 0x0b,
+  0x0c, 0x0d, 0x0e, 0x0f, 0x00, 0x38, 0xb9, 0x00, 0x39, 0x53, 0x00, 0x39,
+  0x72, 0x00, 0x39, 0x84, 0x00, 0x39, 0x9e, 0x00, 0x39, 0xdc, 0x00, 0x39,
+  0xf5, 0x00, 0x3a, 0x00, 0x00, 0x3a, 0x47, 0x00, 0x3a, 0x6f, 0x00, 0x3a,
+  0x92, 0x00, 0x3b, 0x4c, 0x00, 0x3b, 0x7f, 0x00, 0x3b, 0xd1, 0x00, 0x3b,
+  0xf3, 0x00, 0x00, 0x04, 0x61, 0x6e, 0x70, 0x72, 0x00, 0x38, 0xcc, 0x00,
+  0x38, 0xea, 0x00, 0x39, 0x48, 0x00, 0x39, 0x4e, 0x00, 0x00, 0x02, 0x6c,
+  0x70, 0x00, 0x38, 0xd7, 0x00, 0x03, 0x8e, 0x00, 0x00, 0x02, 0x61, 0x70,
+  0x00, 0x01, 0xff, 0x00, 0x38, 0xe2, 0x05, 0x68, 0x74, 0x72, 0x69, 0x62,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x65, 0x00, 0x38, 0xf5, 0x00, 0x39,
+  0x0f, 0x00, 0x00, 0x02, 0x6c, 0x74, 0x00, 0x39, 0x00, 0x00, 0x39, 0x07,
+  0x04, 0x75, 0x62, 0x6d, 0x61, 0x80, 0x00, 0x05, 0x73, 0x69, 0x73, 0x65,
+  0x72, 0x80, 0x00, 0x00, 0x00, 0x03, 0x66, 0x67, 0x69, 0x00, 0x39, 0x1e,
+  0x00, 0x39, 0x2a, 0x00, 0x39, 0x34, 0x09, 0x65, 0x64, 0x6c, 0x61, 0x74,
+  0x73, 0x61, 0x6f, 0x63, 0x80, 0x00, 0x07, 0x69, 0x6c, 0x6c, 0x65, 0x74,
+  0x6e, 0x69, 0x80, 0x00, 0x02, 0x63, 0x73, 0x80, 0x01, 0x66, 0x00, 0x39,
+  0x3d, 0x08, 0x6f, 0x79, 0x72, 0x6f, 0x74, 0x73, 0x69, 0x68, 0x80, 0x00,
+  0x03, 0x65, 0x69, 0x6e, 0x80, 0x00, 0x02, 0x6f, 0x66, 0x80, 0x00, 0x00,
+  0x00, 0x02, 0x6e, 0x72, 0x00, 0x39, 0x5e, 0x00, 0x39, 0x69, 0x08, 0x75,
+  0x6b, 0x6e, 0x65, 0x6b, 0x6c, 0x6f, 0x76, 0x80, 0x00, 0x06, 0x65, 0x76,
+  0x61, 0x73, 0x65, 0x6d, 0x80, 0x00, 0x00, 0x00, 0x02, 0x72, 0x74, 0x00,
+  0x03, 0x3c, 0x00, 0x39, 0x7d, 0x04, 0x73, 0x75, 0x72, 0x74, 0x80, 0x00,
+  0x00, 0x00, 0x02, 0x61, 0x69, 0x00, 0x39, 0x8f, 0x00, 0x39, 0x96, 0x04,
+  0x74, 0x6e, 0x61, 0x73, 0x80, 0x00, 0x05, 0x6c, 0x64, 0x6c, 0x69, 0x77,
+  0x80, 0x00, 0x00, 0x00, 0x03, 0x61, 0x64, 0x72, 0x00, 0x39, 0xad, 0x00,
+  0x39, 0xd3, 0x00, 0x01, 0x99, 0x00, 0x00, 0x02, 0x6c, 0x74, 0x00, 0x39,
+  0xb8, 0x00, 0x39, 0xbe, 0x03, 0x6c, 0x69, 0x76, 0x80, 0x00, 0x04, 0x69,
+  0x72, 0x65, 0x68, 0x80, 0x01, 0x6c, 0x00, 0x39, 0xc9, 0x07, 0x61, 0x6e,
+  0x6f, 0x69, 0x74, 0x61, 0x6e, 0x80, 0x00, 0x06, 0x69, 0x72, 0x62, 0x6d,
+  0x61, 0x63, 0x80, 0x00, 0x00, 0x00, 0x02, 0x63, 0x6e, 0x00, 0x39, 0xe7,
+  0x00, 0x39, 0xed, 0x03, 0x6e, 0x75, 0x6d, 0x80, 0x00, 0x05, 0x6f, 0x6c,
+  0x6c, 0x61, 0x77, 0x80, 0x00, 0x08, 0x6f, 0x6f, 0x72, 0x62, 0x72, 0x65,
+  0x68, 0x73, 0x80, 0x00, 0x00, 0x00, 0x06, 0x61, 0x62, 0x63, 0x69, 0x6f,
+  0x74, 0x00, 0x1e, 0x64, 0x00, 0x08, 0x0c, 0x00, 0x3a, 0x1b, 0x00, 0x3a,
+  0x25, 0x00, 0x3a, 0x3c, 0x00, 0x3a, 0x41, 0x07, 0x79, 0x63, 0x72, 0x6f,
+  0x74, 0x6f, 0x6d, 0x80, 0x00, 0x00, 0x00, 0x02, 0x73, 0x74, 0x00, 0x3a,
+  0x30, 0x00, 0x3a, 0x36, 0x03, 0x73, 0x69, 0x6d, 0x80, 0x00, 0x03, 0x78,
+  0x65, 0x74, 0x80, 0x00, 0x02, 0x6b, 0x73, 0x80, 0x00, 0x03, 0x73, 0x61,
+  0x63, 0x80, 0x00, 0x00, 0x00, 0x03, 0x61, 0x69, 0x75, 0x00, 0x3a, 0x56,
+  0x00, 0x3a, 0x60, 0x00, 0x3a, 0x68, 0x07, 0x66, 0x66, 0x6f, 0x6c, 0x6c,
+  0x61, 0x68, 0x80, 0x00, 0x01, 0x74, 0x80, 0x01, 0x69, 0x00, 0x38, 0x30,
+  0x04, 0x74, 0x73, 0x6f, 0x63, 0x80, 0x00, 0x00, 0x00, 0x03, 0x67, 0x69,
+  0x72, 0x00, 0x3a, 0x7e, 0x00, 0x3a, 0x85, 0x00, 0x3a, 0x8b, 0x04, 0x6f,
+  0x6c, 0x6f, 0x73, 0x80, 0x00, 0x03, 0x6c, 0x6e, 0x6f, 0x80, 0x00, 0x04,
+  0x65, 0x63, 0x75, 0x6c, 0x80, 0x00, 0x00, 0x00, 0x05, 0x61, 0x69, 0x6f,
+  0x75, 0x76, 0x00, 0x3a, 0xa9, 0x00, 0x3a, 0xcd, 0x00, 0x3b, 0x05, 0x00,
+  0x3b, 0x0e, 0x00, 0x3b, 0x46, 0x00, 0x00, 0x02, 0x75, 0x77, 0x00, 0x3a,
+  0xb4, 0x00, 0x3a, 0xb9, 0x02, 0x71, 0x73, 0x80, 0x00, 0x04, 0x61, 0x6c,
+  0x65, 0x64, 0x80, 0x01, 0x66, 0x00, 0x3a, 0xc4, 0x06, 0x6f, 0x65, 0x74,
+  0x61, 0x74, 0x73, 0x80, 0x00, 0x00, 0x00, 0x02, 0x68, 0x6f, 0x00, 0x3a,
+  0xd8, 0x00, 0x3a, 0xfe, 0x01, 0x73, 0x00, 0x03, 0x61, 0x6b, 0x70, 0x00,
+  0x3a, 0xe8, 0x00, 0x3a, 0xef, 0x00, 0x3a, 0xf5, 0x04, 0x63, 0x6e, 0x61,
+  0x6c, 0x80, 0x00, 0x03, 0x72, 0x6f, 0x79, 0x80, 0x00, 0x06, 0x6d, 0x61,
+  0x68, 0x77, 0x65, 0x6e, 0x80, 0x00, 0x04, 0x74, 0x73, 0x69, 0x68, 0x80,
+  0x00, 0x06, 0x6d, 0x69, 0x74, 0x6c, 0x61, 0x62, 0x80, 0x00, 0x01, 0x74,
+  0x00, 0x04, 0x61, 0x63, 0x69, 0x6c, 0x00, 0x02, 0x03, 0x00, 0x3b, 0x22,
+  0x00, 0x3b, 0x2c, 0x00, 0x3b, 0x33, 0x07, 0x65, 0x74, 0x69, 0x68, 0x63,
+  0x72, 0x61, 0x80, 0x00, 0x04, 0x6e, 0x72, 0x75, 0x66, 0x80, 0x00, 0x02,
+  0x75, 0x63, 0x80, 0x02, 0x69, 0x73, 0x00, 0x3b, 0x40, 0x00, 0x07, 0xb6,
+  0x03, 0x72, 0x67, 0x61, 0x80, 0x00, 0x03, 0x75, 0x6f, 0x6c, 0x80, 0x00,
+  0x00, 0x00, 0x04, 0x61, 0x69, 0x73, 0x75, 0x00, 0x3b, 0x5f, 0x00, 0x3b,
+  0x67, 0x00, 0x3b, 0x70, 0x00, 0x3b, 0x76, 0x05, 0x62, 0x61, 0x74, 0x61,
+  0x64, 0x80, 0x00, 0x06, 0x61, 0x63, 0x6e, 0x61, 0x72, 0x66, 0x80, 0x00,
+  0x03, 0x69, 0x75, 0x73, 0x80, 0x00, 0x02, 0x6f, 0x68, 0x80, 0x01, 0x6c,
+  0x00, 0x37, 0x55, 0x00, 0x00, 0x03, 0x61, 0x69, 0x74, 0x00, 0x3b, 0x8e,
+  0x00, 0x3b, 0xc1, 0x00, 0x3b, 0xc9, 0x00, 0x00, 0x03, 0x6c, 0x72, 0x74,
+  0x00, 0x3b, 0x9d, 0x00, 0x21, 0x4a, 0x00, 0x3b, 0xa5, 0x05, 0x6f, 0x63,
+  0x6f, 0x68, 0x63, 0x80, 0x00, 0x01, 0x73, 0x80, 0x01, 0x65, 0x00, 0x3b,
+  0xad, 0x00, 0x80, 0x01, 0x79, 0x00, 0x3b, 0xb4, 0x06, 0x72, 0x74, 0x6e,
+  0x75, 0x6f, 0x63, 0x80, 0x01, 0x73, 0x00, 0x07, 0xb6, 0x05, 0x6d, 0x65,
+  0x73, 0x6f, 0x79, 0x80, 0x00, 0x05, 0x65, 0x76, 0x72, 0x6f, 0x63, 0x80,
+  0x00, 0x00, 0x00, 0x02, 0x71, 0x76, 0x00, 0x3b, 0xdc, 0x00, 0x3b, 0xeb,
+  0x0c, 0x69, 0x68, 0x70, 0x61, 0x72, 0x67, 0x6f, 0x6e, 0x61, 0x65, 0x63,
+  0x6f, 0x80, 0x00, 0x05, 0x65, 0x6c, 0x6c, 0x65, 0x62, 0x80, 0x00, 0x02,
+  0x69, 0x74, 0x00, 0x02, 0x63, 0x6f, 0x00, 0x3c, 0x00, 0x00, 0x3c, 0x09,
+  0x06, 0x61, 0x72, 0x65, 0x74, 0x6e, 0x69, 0x80, 0x00, 0x05, 0x6d, 0x6f,
+  0x74, 0x75, 0x61, 0x80, 0x00, 0x00, 0x00, 0x02, 0x69, 0x6f, 0x00, 0x3c,
+  0x1c, 0x00, 0x3c, 0x21, 0x02, 0x75, 0x6a, 0x80, 0x00, 0x05, 0x68, 0x67,
+  0x72, 0x75, 0x62, 0x80, 0x00, 0x00, 0x00, 0x03, 0x6e, 0x6f, 0x72, 0x00,
+  0x3c, 0x38, 0x00, 0x3c, 0x9a, 0x00, 0x3c, 0x9f, 0x00, 0x00, 0x02, 0x69,
+  0x75, 0x00, 0x3c, 0x43, 0x00, 0x3c, 0x8d, 0x00, 0x00, 0x07, 0x64, 0x67,
+  0x6b, 0x6c, 0x6e, 0x70, 0x76, 0x00, 0x3c, 0x62, 0x00, 0x3c, 0x69, 0x00,
+  0x3c, 0x78, 0x00, 0x3c, 0x7d, 0x00, 0x01, 0x7d, 0x00, 0x3c, 0x83, 0x00,
+  0x0d, 0x75, 0x04, 0x6c, 0x69, 0x75, 0x62, 0x80, 0x00, 0x0c, 0x69, 0x6e,
+  0x65, 0x72, 0x65, 0x76, 0x6d, 0x75, 0x65, 0x73, 0x75, 0x6d, 0x80, 0x00,
+  0x02, 0x69, 0x76, 0x80, 0x00, 0x03, 0x61, 0x68, 0x77, 0x80, 0x00, 0x07,
+  0x65, 0x65, 0x6b, 0x65, 0x6d, 0x69, 0x74, 0x80, 0x00, 0x0a, 0x6c, 0x6d,
+  0x6d, 0x61, 0x73, 0x74, 0x73, 0x6e, 0x75, 0x6b, 0x80, 0x00, 0x02, 0x72,
+  0x66, 0x80, 0x00, 0x00, 0x00, 0x02, 0x65, 0x75, 0x00, 0x3c, 0xaa, 0x00,
+  0x3c, 0xd3, 0x01, 0x62, 0x00, 0x02, 0x6d, 0x6e, 0x00, 0x3c, 0xb6, 0x00,
+  0x3c, 0xbd, 0x04, 0x65, 0x72, 0x75, 0x6e, 0x80, 0x00, 0x01, 0x72, 0x00,
+  0x02, 0x61, 0x65, 0x00, 0x3c, 0xc9, 0x00, 0x3c, 0xce, 0x02, 0x74, 0x73,
+  0x80, 0x00, 0x02, 0x75, 0x6e, 0x80, 0x00, 0x00, 0x00, 0x02, 0x62, 0x6f,
+  0x00, 0x3c, 0xde, 0x00, 0x3d, 0x53, 0x00, 0x00, 0x06, 0x69, 0x6c, 0x6d,
+  0x72, 0x73, 0x7a, 0x00, 0x3c, 0xf9, 0x00, 0x22, 0x81, 0x00, 0x3c, 0xff,
+  0x00, 0x22, 0xab, 0x00, 0x3d, 0x13, 0x00, 0x3d, 0x4d, 0x03, 0x65, 0x72,
+  0x66, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x75, 0x00, 0x3d, 0x0a, 0x00,
+  0x3d, 0x0e, 0x01, 0x68, 0x80, 0x00, 0x02, 0x61, 0x6e, 0x80, 0x00, 0x00,
+  0x00, 0x03, 0x6d, 0x6e, 0x72, 0x00, 0x3d, 0x22, 0x00, 0x3d, 0x39, 0x00,
+  0x3d, 0x44, 0x06, 0x61, 0x69, 0x6c, 0x6c, 0x69, 0x77, 0x80, 0x01, 0x6c,
+  0x00, 0x3d, 0x2f, 0x07, 0x61, 0x69, 0x6e, 0x6f, 0x6c, 0x6f, 0x63, 0x80,
+  0x00, 0x08, 0x61, 0x69, 0x74, 0x73, 0x69, 0x72, 0x68, 0x63, 0x80, 0x00,
+  0x06, 0x65, 0x74, 0x65, 0x70, 0x74, 0x73, 0x80, 0x00, 0x03, 0x6c, 0x61,
+  0x73, 0x80, 0x00, 0x01, 0x62, 0x00, 0x02, 0x69, 0x6d, 0x00, 0x3c, 0x9a,
+  0x00, 0x3d, 0x5f, 0x04, 0x65, 0x78, 0x75, 0x6c, 0x80, 0x00, 0x00, 0x00,
+  0x05, 0x61, 0x63, 0x67, 0x73, 0x74, 0x00, 0x3d, 0x7d, 0x00, 0x3d, 0x82,
+  0x00, 0x3d, 0xa8, 0x00, 0x3d, 0xc7, 0x00, 0x3d, 0xde, 0x02, 0x74, 0x75,
+  0x80, 0x00, 0x00, 0x00, 0x03, 0x72, 0x73, 0x75, 0x00, 0x3d, 0x91, 0x00,
+  0x3d, 0x99, 0x00, 0x3d, 0xa3, 0x05, 0x61, 0x65, 0x73, 0x65, 0x72, 0x80,
+  0x00, 0x07, 0x69, 0x72, 0x6f, 0x74, 0x73, 0x69, 0x68, 0x80, 0x00, 0x02,
+  0x6f, 0x74, 0x80, 0x00, 0x00, 0x00, 0x02, 0x65, 0x72, 0x00, 0x3d, 0xb3,
+  0x00, 0x3d, 0xbd, 0x07, 0x61, 0x31, 0x68, 0x2d, 0x2d, 0x6e, 0x78, 0x80,
+  0x00, 0x07, 0x75, 0x62, 0x73, 0x74, 0x74, 0x69, 0x70, 0x80, 0x00, 0x01,
+  0x69, 0x00, 0x02, 0x74, 0x77, 0x00, 0x3d, 0xd3, 0x00, 0x3d, 0xd9, 0x03,
+  0x69, 0x72, 0x62, 0x80, 0x00, 0x02, 0x65, 0x6a, 0x80, 0x00, 0x00, 0x00,
+  0x03, 0x6c, 0x72, 0x75, 0x00, 0x3d, 0xed, 0x00, 0x3d, 0xf3, 0x00, 0x3e,
+  0x06, 0x03, 0x61, 0x65, 0x68, 0x80, 0x00, 0x01, 0x6f, 0x00, 0x02, 0x6e,
+  0x77, 0x00, 0x01, 0xed, 0x00, 0x3d, 0xff, 0x04, 0x74, 0x72, 0x6f, 0x66,
+  0x80, 0x00, 0x01, 0x6f, 0x00, 0x02, 0x6d, 0x79, 0x00, 0x3e, 0x12, 0x00,
+  0x01, 0xed, 0x03, 0x6e, 0x6f, 0x6d, 0x80, 0x00, 0x00, 0x00, 0x06, 0x64,
+  0x69, 0x6b, 0x6c, 0x73, 0x74, 0x00, 0x3e, 0x33, 0x00, 0x3e, 0x42, 0x00,
+  0x3e, 0x49, 0x00, 0x3e, 0x5c, 0x00, 0x3e, 0x6f, 0x00, 0x3e, 0x76, 0x0c,
+  0x36, 0x67, 0x6c, 0x62, 0x68, 0x62, 0x64, 0x39, 0x2d, 0x2d, 0x6e, 0x78,
+  0x80, 0x00, 0x04, 0x61, 0x77, 0x61, 0x68, 0x80, 0x00, 0x00, 0x00, 0x02,
+  0x6e, 0x73, 0x00, 0x3e, 0x54, 0x00, 0x01, 0xed, 0x05, 0x69, 0x73, 0x6c,
+  0x65, 0x68, 0x80, 0x00, 0x02, 0x61, 0x64, 0x80, 0x01, 0x72, 0x00, 0x3e,
+  0x65, 0x07, 0x6f, 0x64, 0x61, 0x76, 0x6c, 0x61, 0x73, 0x80, 0x00, 0x04,
+  0x69, 0x73, 0x73, 0x61, 0x80, 0x00, 0x08, 0x61, 0x6e, 0x6e, 0x69, 0x63,
+  0x6e, 0x69, 0x63, 0x80, 0x00, 0x00, 0x00, 0x07, 0x63, 0x66, 0x69, 0x6c,
+  0x6e, 0x6f, 0x72, 0x00, 0x3e, 0xa0, 0x00, 0x3e, 0xd7, 0x00, 0x3e, 0xdb,
+  0x00, 0x3e, 0xe3, 0x00, 0x3e, 0xf5, 0x00, 0x3f, 0x09, 0x00, 0x3f, 0x13,
+  0x00, 0x00, 0x02, 0x6e, 0x6f, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xb4, 0x06,
+  0x69, 0x76, 0x6c, 0x65, 0x65, 0x67, 0x80, 0x00, 0x02, 0x6c, 0x63, 0x80,
+  0x02, 0x2d, 0x64, 0x00, 0x3e, 0xc1, 0x00, 0x3e, 0xcd, 0x09, 0x64, 0x6e,
+  0x61, 0x2d, 0x68, 0x63, 0x74, 0x61, 0x77, 0x80, 0x00, 0x07, 0x6e, 0x61,
+  0x68, 0x63, 0x74, 0x61, 0x77, 0x80, 0x00, 0x01, 0x6a, 0x80, 0x00, 0x05,
+  0x6e, 0x65, 0x62, 0x69, 0x73, 0x80, 0x00, 0x00, 0x00, 0x02, 0x69, 0x6f,
+  0x00, 0x03, 0x8e, 0x00, 0x3e, 0xee, 0x04, 0x66, 0x72, 0x6f, 0x6e, 0x80,
+  0x00, 0x01, 0x61, 0x00, 0x02, 0x72, 0x74, 0x00, 0x3f, 0x01, 0x00, 0x01,
+  0xed, 0x05, 0x66, 0x65, 0x6e, 0x6e, 0x61, 0x80, 0x00, 0x07, 0x6f, 0x72,
+  0x62, 0x6e, 0x61, 0x72, 0x63, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x6f,
+  0x00, 0x3f, 0x1e, 0x00, 0x3f, 0x37, 0x01, 0x6d, 0x00, 0x02, 0x6e, 0x72,
+  0x00, 0x3f, 0x2a, 0x00, 0x3f, 0x2f, 0x02, 0x65, 0x64, 0x80, 0x00, 0x05,
+  0x65, 0x69, 0x65, 0x74, 0x73, 0x80, 0x00, 0x01, 0x79, 0x80, 0x01, 0x77,
+  0x00, 0x01, 0x8f, 0x00, 0x00, 0x05, 0x61, 0x65, 0x69, 0x6c, 0x6f, 0x00,
+  0x3f, 0x56, 0x00, 0x40, 0x05, 0x00, 0x40, 0x25, 0x00, 0x40, 0x41, 0x00,
+  0x40, 0x99, 0x00, 0x40, 0x63, 0x14, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 0x00, 0x06, 0x00, 0x07,
+  0x08, 0x09, 0x00, 0x3f, 0x89, 0x00, 0x3f, 0xcb, 0x00, 0x3f, 0xd3, 0x00,
+  0x3f, 0xdb, 0x00, 0x01, 0x87, 0x00, 0x3f, 0xf0, 0x00, 0x3f, 0xf8, 0x00,
+  0x3f, 0xfe, 0x00, 0x3d, 0x0e, 0x01, 0x69, 0x00, 0x04, 0x64, 0x67, 0x6e,
+  0x72, 0x00, 0x04, 0x75, 0x00, 0x3f, 0x9d, 0x00, 0x3f, 0xbc, 0x00, 0x3f,
+  0xc3, 0x03, 0x6f, 0x6c, 0x6f, 0x00, 0x03, 0x65, 0x6d, 0x6f, 0x00, 0x3f,
+  0xaf, 0x00, 0x3f, 0xb7, 0x00, 0x25, 0xd6, 0x05, 0x61, 0x68, 0x63, 0x72,
+  0x61, 0x80, 0x00, 0x02, 0x65, 0x67, 0x80, 0x00, 0x04, 0x61, 0x74, 0x6f,
+  0x62, 0x80, 0x00, 0x05, 0x6f, 0x74, 0x73, 0x69, 0x68, 0x80, 0x00, 0x05,
+  0x72, 0x74, 0x6e, 0x6f, 0x6d, 0x80, 0x00, 0x05, 0x72, 0x6f, 0x6d, 0x65,
+  0x6d, 0x80, 0x00, 0x04, 0x6f, 0x69, 0x74, 0x61, 0x00, 0x02, 0x63, 0x6e,
+  0x00, 0x3f, 0xea, 0x00, 0x01, 0xed, 0x03, 0x75, 0x64, 0x65, 0x80, 0x00,
+  0x05, 0x75, 0x74, 0x6c, 0x75, 0x63, 0x80, 0x00, 0x03, 0x72, 0x6f, 0x70,
+  0x80, 0x00, 0x04, 0x74, 0x72, 0x69, 0x76, 0x80, 0x00, 0x00, 0x00, 0x03,
+  0x6e, 0x73, 0x75, 0x00, 0x40, 0x14, 0x00, 0x40, 0x1a, 0x00, 0x3f, 0xfe,
+  0x03, 0x75, 0x72, 0x62, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x73, 0x00,
+  0x1e, 0x64, 0x00, 0x40, 0x14, 0x00, 0x00, 0x02, 0x61, 0x73, 0x00, 0x40,
+  0x30, 0x00, 0x40, 0x3b, 0x08, 0x72, 0x74, 0x6e, 0x6f, 0x67, 0x65, 0x72,
+  0x6f, 0x80, 0x00, 0x03, 0x61, 0x72, 0x62, 0x80, 0x00, 0x00, 0x00, 0x03,
+  0x61, 0x65, 0x69, 0x00, 0x40, 0x50, 0x00, 0x40, 0x6d, 0x00, 0x40, 0x81,
+  0x00, 0x00, 0x02, 0x62, 0x68, 0x00, 0x40, 0x5b, 0x00, 0x40, 0x62, 0x04,
+  0x65, 0x73, 0x61, 0x62, 0x80, 0x00, 0x08, 0x73, 0x6e, 0x6f, 0x65, 0x67,
+  0x72, 0x75, 0x73, 0x80, 0x00, 0x00, 0x00, 0x02, 0x68, 0x72, 0x00, 0x03,
+  0x8e, 0x00, 0x40, 0x78, 0x06, 0x64, 0x6e, 0x65, 0x76, 0x6c, 0x65, 0x80,
+  0x00, 0x00, 0x00, 0x02, 0x62, 0x6d, 0x00, 0x01, 0xed, 0x00, 0x40, 0x8c,
+  0x00, 0x80, 0x01, 0x64, 0x00, 0x40, 0x93, 0x03, 0x6e, 0x69, 0x77, 0x80,
+  0x00, 0x00, 0x00, 0x03, 0x62, 0x6f, 0x74, 0x00, 0x04, 0x70, 0x00, 0x40,
+  0xa8, 0x00, 0x40, 0xae, 0x03, 0x68, 0x63, 0x73, 0x80, 0x00, 0x04, 0x73,
+  0x69, 0x72, 0x62, 0x80, 0x00, 0x00, 0x00, 0x07, 0x61, 0x63, 0x65, 0x6c,
+  0x72, 0x73, 0x75, 0x00, 0x40, 0xd4, 0x00, 0x03, 0x3c, 0x00, 0x41, 0x05,
+  0x00, 0x41, 0x15, 0x00, 0x41, 0x2d, 0x00, 0x41, 0x32, 0x00, 0x41, 0x3d,
+  0x00, 0x00, 0x03, 0x64, 0x65, 0x68, 0x00, 0x40, 0xe3, 0x00, 0x3c, 0xc9,
+  0x00, 0x40, 0xec, 0x06, 0x72, 0x65, 0x74, 0x73, 0x6d, 0x61, 0x80, 0x00,
+  0x00, 0x00, 0x02, 0x6e, 0x72, 0x00, 0x40, 0xf7, 0x00, 0x41, 0x00, 0x06,
+  0x65, 0x74, 0x6c, 0x65, 0x68, 0x63, 0x80, 0x00, 0x02, 0x75, 0x64, 0x80,
+  0x00, 0x03, 0x6c, 0x61, 0x73, 0x80, 0x01, 0x75, 0x00, 0x41, 0x0f, 0x03,
+  0x72, 0x65, 0x6a, 0x80, 0x00, 0x00, 0x00, 0x03, 0x69, 0x6f, 0x75, 0x00,
+  0x1c, 0xc3, 0x00, 0x41, 0x24, 0x00, 0x01, 0xed, 0x06, 0x68, 0x6b, 0x63,
+  0x6f, 0x74, 0x73, 0x80, 0x00, 0x02, 0x61, 0x66, 0x80, 0x00, 0x08, 0x69,
+  0x6c, 0x61, 0x6e, 0x72, 0x75, 0x6f, 0x6a, 0x80, 0x00, 0x00, 0x00, 0x03,
+  0x65, 0x69, 0x74, 0x00, 0x41, 0x4c, 0x00, 0x41, 0x60, 0x00, 0x41, 0x7a,
+  0x11, 0x73, 0x75, 0x6d, 0x79, 0x72, 0x6f, 0x74, 0x73, 0x69, 0x68, 0x6c,
+  0x61, 0x72, 0x75, 0x74, 0x61, 0x6e, 0x80, 0x00, 0x02, 0x72, 0x61, 0x00,
+  0x02, 0x74, 0x75, 0x00, 0x41, 0x6d, 0x00, 0x41, 0x75, 0x05, 0x65, 0x6e,
+  0x61, 0x6c, 0x70, 0x80, 0x00, 0x02, 0x71, 0x61, 0x80, 0x00, 0x06, 0x65,
+  0x72, 0x6f, 0x62, 0x72, 0x61, 0x80, 0x00, 0x00, 0x40, 0x61, 0x17, 0x01,
+  0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x04, 0x05, 0x00, 0x00, 0x06, 0x00,
+  0x07, 0x08, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0a, 0x0b, 0x00, 0x41,
+  0xbf, 0x00, 0x42, 0x1f, 0x00, 0x42, 0xfd, 0x00, 0x43, 0x1c, 0x00, 0x43,
+  0x3c, 0x00, 0x43, 0x53, 0x00, 0x43, 0x65, 0x00, 0x43, 0x7b, 0x00, 0x45,
+  0x47, 0x00, 0x45, 0x7d, 0x00, 0x3d, 0xa3, 0x00, 0x00, 0x05, 0x63, 0x67,
+  0x69, 0x6d, 0x77, 0x00, 0x41, 0xd6, 0x00, 0x41, 0xf0, 0x00, 0x41, 0xf8,
+  0x00, 0x42, 0x0a, 0x00, 0x42, 0x13, 0x00, 0x80, 0x01, 0x69, 0x00, 0x41,
+  0xdd, 0x04, 0x72, 0x65, 0x6d, 0x61, 0x80, 0x01, 0x65, 0x00, 0x41, 0xe8,
+  0x05, 0x76, 0x69, 0x74, 0x61, 0x6e, 0x80, 0x00, 0x05, 0x69, 0x68, 0x63,
+  0x69, 0x6d, 0x80, 0x00, 0x00, 0x00, 0x02, 0x64, 0x74, 0x00, 0x03, 0x21,
+  0x00, 0x42, 0x03, 0x04, 0x70, 0x79, 0x67, 0x65, 0x80, 0x00, 0x06, 0x66,
+  0x6f, 0x65, 0x6c, 0x73, 0x69, 0x80, 0x00, 0x09, 0x65, 0x68, 0x63, 0x74,
+  0x61, 0x6b, 0x73, 0x61, 0x73, 0x80, 0x00, 0x00, 0x00, 0x07, 0x64, 0x67,
+  0x68, 0x6c, 0x70, 0x72, 0x73, 0x00, 0x42, 0x3e, 0x00, 0x42, 0x96, 0x00,
+  0x42, 0xa0, 0x00, 0x42, 0xa8, 0x00, 0x42, 0xb1, 0x00, 0x42, 0xc4, 0x00,
+  0x42, 0xf6, 0x00, 0x00, 0x03, 0x61, 0x65, 0x72, 0x00, 0x42, 0x4d, 0x00,
+  0x42, 0x57, 0x00, 0x42, 0x5c, 0x07, 0x6c, 0x6f, 0x6b, 0x6f, 0x68, 0x63,
+  0x73, 0x80, 0x00, 0x02, 0x77, 0x73, 0x80, 0x00, 0x02, 0x61, 0x67, 0x80,
+  0x03, 0x63, 0x6c, 0x73, 0x00, 0x42, 0x6d, 0x00, 0x42, 0x76, 0x00, 0x42,
+  0x81, 0x06, 0x69, 0x6e, 0x61, 0x74, 0x6f, 0x62, 0x80, 0x00, 0x08, 0x61,
+  0x63, 0x69, 0x6e, 0x61, 0x74, 0x6f, 0x62, 0x80, 0x00, 0x00, 0x00, 0x02,
+  0x6e, 0x75, 0x00, 0x42, 0x8c, 0x00, 0x01, 0xed, 0x07, 0x65, 0x72, 0x64,
+  0x6c, 0x69, 0x68, 0x63, 0x80, 0x00, 0x07, 0x61, 0x68, 0x6e, 0x65, 0x70,
+  0x6f, 0x63, 0x80, 0x00, 0x05, 0x63, 0x6e, 0x65, 0x75, 0x6d, 0x80, 0x00,
+  0x06, 0x61, 0x66, 0x74, 0x73, 0x65, 0x77, 0x80, 0x00, 0x10, 0x70, 0x61,
+  0x68, 0x63, 0x73, 0x6e, 0x65, 0x74, 0x65, 0x77, 0x72, 0x75, 0x75, 0x74,
+  0x61, 0x6e, 0x80, 0x00, 0x00, 0x00, 0x03, 0x64, 0x65, 0x68, 0x00, 0x42,
+  0xd3, 0x00, 0x42, 0xda, 0x00, 0x42, 0xe3, 0x04, 0x6c, 0x69, 0x68, 0x63,
+  0x80, 0x00, 0x06, 0x64, 0x6e, 0x61, 0x61, 0x6c, 0x76, 0x80, 0x00, 0x01,
+  0x75, 0x80, 0x01, 0x64, 0x00, 0x42, 0xeb, 0x08, 0x6e, 0x75, 0x74, 0x61,
+  0x6d, 0x69, 0x65, 0x68, 0x80, 0x00, 0x04, 0x73, 0x65, 0x69, 0x67, 0x80,
+  0x00, 0x04, 0x69, 0x73, 0x65, 0x64, 0x80, 0x01, 0x64, 0x00, 0x43, 0x08,
+  0x01, 0x6e, 0x00, 0x02, 0x61, 0x75, 0x00, 0x10, 0xce, 0x00, 0x43, 0x14,
+  0x05, 0x74, 0x73, 0x6e, 0x75, 0x6b, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61,
+  0x6f, 0x00, 0x43, 0x27, 0x00, 0x43, 0x36, 0x01, 0x62, 0x80, 0x01, 0x6e,
+  0x00, 0x43, 0x2f, 0x04, 0x65, 0x73, 0x69, 0x65, 0x80, 0x00, 0x03, 0x6a,
+  0x74, 0x73, 0x80, 0x00, 0x00, 0x00, 0x02, 0x6c, 0x74, 0x00, 0x43, 0x47,
+  0x00, 0x43, 0x4d, 0x03, 0x72, 0x65, 0x62, 0x80, 0x00, 0x03, 0x73, 0x75,
+  0x61, 0x80, 0x00, 0x00, 0x00, 0x02, 0x65, 0x6f, 0x00, 0x22, 0x0b, 0x00,
+  0x43, 0x5e, 0x04, 0x63, 0x6e, 0x69, 0x6c, 0x80, 0x00, 0x00, 0x00, 0x02,
+  0x6f, 0x75, 0x00, 0x1e, 0x64, 0x00, 0x43, 0x70, 0x08, 0x72, 0x62, 0x6e,
+  0x65, 0x6f, 0x68, 0x63, 0x73, 0x80, 0x00, 0x00, 0x00, 0x06, 0x64, 0x67,
+  0x69, 0x72, 0x73, 0x74, 0x00, 0x43, 0x96, 0x00, 0x43, 0x9c, 0x00, 0x43,
+  0xa2, 0x00, 0x02, 0x83, 0x00, 0x44, 0xf7, 0x00, 0x45, 0x24, 0x03, 0x6e,
+  0x6f, 0x6c, 0x80, 0x00, 0x03, 0x65, 0x72, 0x6f, 0x80, 0x00, 0x00, 0x00,
+  0x02, 0x73, 0x74, 0x00, 0x43, 0xad, 0x00, 0x43, 0xd4, 0x00, 0x00, 0x02,
+  0x69, 0x6e, 0x00, 0x43, 0xb8, 0x00, 0x22, 0xab, 0x01, 0x76, 0x00, 0x02,
+  0x64, 0x65, 0x00, 0x43, 0xc4, 0x00, 0x43, 0xce, 0x07, 0x6e, 0x61, 0x64,
+  0x6e, 0x75, 0x6f, 0x73, 0x80, 0x00, 0x03, 0x6c, 0x65, 0x74, 0x80, 0x00,
+  0x00, 0x00, 0x03, 0x61, 0x63, 0x69, 0x00, 0x43, 0xe3, 0x00, 0x44, 0xd1,
+  0x00, 0x44, 0xef, 0x00, 0x40, 0x63, 0x18, 0x01, 0x02, 0x03, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x08,
+  0x09, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x44, 0x20, 0x00, 0x44,
+  0x42, 0x00, 0x44, 0x49, 0x00, 0x44, 0x4e, 0x00, 0x44, 0x59, 0x00, 0x44,
+  0x67, 0x00, 0x44, 0x71, 0x00, 0x44, 0x9d, 0x00, 0x44, 0xa6, 0x00, 0x44,
+  0xb1, 0x00, 0x44, 0x9d, 0x00, 0x00, 0x02, 0x69, 0x75, 0x00, 0x44, 0x2b,
+  0x00, 0x44, 0x34, 0x06, 0x6e, 0x75, 0x6d, 0x6d, 0x6f, 0x63, 0x80, 0x00,
+  0x02, 0x64, 0x65, 0x80, 0x01, 0x74, 0x00, 0x44, 0x3d, 0x02, 0x72, 0x61,
+  0x80, 0x00, 0x04, 0x6e, 0x75, 0x6f, 0x66, 0x80, 0x00, 0x02, 0x72, 0x63,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x63, 0x76, 0x00, 0x0a, 0x5f, 0x00, 0x02,
+  0xa9, 0x0b, 0x69, 0x6e, 0x75, 0x6d, 0x6d, 0x6f, 0x6b, 0x65, 0x6c, 0x65,
+  0x74, 0x80, 0x00, 0x07, 0x69, 0x73, 0x73, 0x61, 0x73, 0x73, 0x61, 0x80,
+  0x00, 0x00, 0x00, 0x03, 0x62, 0x6f, 0x74, 0x00, 0x44, 0x80, 0x00, 0x44,
+  0x8e, 0x00, 0x44, 0x95, 0x0b, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x73, 0x65,
+  0x76, 0x72, 0x61, 0x68, 0x80, 0x00, 0x04, 0x70, 0x72, 0x6f, 0x63, 0x80,
+  0x00, 0x05, 0x73, 0x75, 0x6c, 0x6c, 0x69, 0x80, 0x00, 0x06, 0x69, 0x6c,
+  0x69, 0x76, 0x69, 0x63, 0x80, 0x00, 0x00, 0x00, 0x02, 0x6e, 0x73, 0x00,
+  0x36, 0xe3, 0x00, 0x01, 0xed, 0x03, 0x72, 0x65, 0x73, 0x00, 0x02, 0x65,
+  0x6e, 0x00, 0x0d, 0x7a, 0x00, 0x44, 0xbf, 0x0f, 0x6f, 0x63, 0x6c, 0x61,
+  0x74, 0x6e, 0x65, 0x6d, 0x6e, 0x6f, 0x72, 0x69, 0x76, 0x6e, 0x65, 0x80,
+  0x00, 0x00, 0x00, 0x02, 0x65, 0x69, 0x00, 0x44, 0xdc, 0x00, 0x44, 0xe3,
+  0x04, 0x6c, 0x6c, 0x6f, 0x63, 0x80, 0x00, 0x09, 0x66, 0x2d, 0x65, 0x63,
+  0x6e, 0x65, 0x69, 0x63, 0x73, 0x80, 0x00, 0x05, 0x62, 0x69, 0x68, 0x78,
+  0x65, 0x80, 0x00, 0x00, 0x00, 0x04, 0x64, 0x69, 0x72, 0x73, 0x00, 0x45,
+  0x0a, 0x00, 0x45, 0x10, 0x00, 0x45, 0x16, 0x00, 0x45, 0x1e, 0x03, 0x6e,
+  0x61, 0x68, 0x80, 0x00, 0x03, 0x6d, 0x61, 0x6a, 0x80, 0x00, 0x05, 0x65,
+  0x66, 0x66, 0x65, 0x6a, 0x80, 0x00, 0x03, 0x72, 0x61, 0x6c, 0x80, 0x00,
+  0x00, 0x00, 0x03, 0x65, 0x6e, 0x73, 0x00, 0x45, 0x33, 0x00, 0x45, 0x3c,
+  0x00, 0x45, 0x42, 0x06, 0x72, 0x62, 0x65, 0x70, 0x61, 0x63, 0x80, 0x00,
+  0x03, 0x69, 0x6c, 0x63, 0x80, 0x00, 0x02, 0x6f, 0x62, 0x80, 0x00, 0x00,
+  0x00, 0x02, 0x65, 0x6f, 0x00, 0x45, 0x52, 0x00, 0x45, 0x74, 0x00, 0x00,
+  0x05, 0x62, 0x64, 0x74, 0x75, 0x7a, 0x00, 0x01, 0xed, 0x00, 0x45, 0x69,
+  0x00, 0x45, 0x6e, 0x00, 0x1f, 0xfd, 0x00, 0x23, 0x91, 0x02, 0x6f, 0x6d,
+  0x80, 0x00, 0x03, 0x73, 0x65, 0x77, 0x80, 0x00, 0x06, 0x62, 0x72, 0x65,
+  0x64, 0x61, 0x70, 0x80, 0x00, 0x08, 0x61, 0x68, 0x6e, 0x65, 0x62, 0x65,
+  0x6f, 0x6b, 0x80, 0x00, 0x00, 0x40, 0x32, 0x41, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x00, 0x04,
+  0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x07, 0x08, 0x09, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x45, 0xeb, 0x00, 0x46, 0x00, 0x00, 0x46, 0x07, 0x00, 0x46,
+  0x32, 0x00, 0x46, 0x38, 0x00, 0x46, 0x5c, 0x00, 0x46, 0x82, 0x00, 0x46,
+  0x8d, 0x00, 0x46, 0x96, 0x00, 0x46, 0x9d, 0x12, 0x61, 0x36, 0x76, 0x2d,
+  0x73, 0x65, 0x61, 0x63, 0x69, 0x6e, 0x75, 0x6d, 0x6f, 0x63, 0x2d, 0x2d,
+  0x6e, 0x78, 0x80, 0x00, 0x04, 0x62, 0x6c, 0x69, 0x62, 0x80, 0x00, 0x00,
+  0x00, 0x03, 0x65, 0x69, 0x73, 0x00, 0x46, 0x16, 0x00, 0x46, 0x1d, 0x00,
+  0x46, 0x26, 0x04, 0x64, 0x74, 0x72, 0x61, 0x80, 0x00, 0x06, 0x78, 0x65,
+  0x6d, 0x77, 0x65, 0x6e, 0x80, 0x00, 0x09, 0x69, 0x63, 0x6e, 0x61, 0x72,
+  0x66, 0x6e, 0x61, 0x73, 0x80, 0x00, 0x03, 0x6c, 0x61, 0x70, 0x80, 0x00,
+  0x00, 0x00, 0x02, 0x61, 0x65, 0x00, 0x46, 0x43, 0x00, 0x46, 0x54, 0x00,
+  0x00, 0x02, 0x63, 0x74, 0x00, 0x46, 0x4e, 0x00, 0x02, 0x12, 0x03, 0x69,
+  0x68, 0x63, 0x80, 0x00, 0x05, 0x69, 0x64, 0x6e, 0x61, 0x73, 0x80, 0x00,
+  0x00, 0x00, 0x03, 0x63, 0x64, 0x72, 0x00, 0x46, 0x6b, 0x00, 0x46, 0x73,
+  0x00, 0x46, 0x7b, 0x05, 0x61, 0x64, 0x6e, 0x75, 0x66, 0x80, 0x00, 0x05,
+  0x69, 0x73, 0x65, 0x72, 0x70, 0x80, 0x00, 0x04, 0x61, 0x74, 0x6e, 0x6f,
+  0x80, 0x00, 0x08, 0x6c, 0x65, 0x63, 0x69, 0x74, 0x6e, 0x6f, 0x6d, 0x80,
+  0x00, 0x06, 0x69, 0x74, 0x69, 0x72, 0x61, 0x6d, 0x80, 0x00, 0x04, 0x69,
+  0x72, 0x6f, 0x74, 0x80, 0x00, 0x00, 0x00, 0x02, 0x68, 0x69, 0x00, 0x46,
+  0xa8, 0x00, 0x46, 0xae, 0x03, 0x74, 0x6e, 0x61, 0x80, 0x00, 0x09, 0x65,
+  0x6e, 0x61, 0x6a, 0x65, 0x64, 0x6f, 0x69, 0x72, 0x80, 0x00, 0x07, 0x6f,
+  0x68, 0x73, 0x6b, 0x72, 0x6f, 0x77, 0x80, 0x00, 0x03, 0x61, 0x72, 0x69,
+  0x80, 0x00, 0x00, 0x00, 0x06, 0x61, 0x64, 0x65, 0x69, 0x6f, 0x75, 0x00,
+  0x46, 0xe5, 0x00, 0x46, 0xfe, 0x00, 0x47, 0x02, 0x00, 0x47, 0xc6, 0x00,
+  0x47, 0xd4, 0x00, 0x47, 0xda, 0x01, 0x77, 0x80, 0x02, 0x64, 0x6c, 0x00,
+  0x46, 0xf1, 0x00, 0x46, 0xf7, 0x03, 0x6c, 0x6f, 0x63, 0x80, 0x00, 0x04,
+  0x69, 0x76, 0x69, 0x63, 0x80, 0x00, 0x01, 0x64, 0x80, 0x00, 0x00, 0x00,
+  0x06, 0x62, 0x69, 0x6c, 0x6e, 0x70, 0x74, 0x00, 0x47, 0x1d, 0x00, 0x47,
+  0x28, 0x00, 0x47, 0x2f, 0x00, 0x47, 0x3a, 0x00, 0x47, 0x46, 0x00, 0x47,
+  0x4f, 0x00, 0x00, 0x02, 0x6d, 0x79, 0x00, 0x02, 0xa9, 0x00, 0x01, 0x87,
+  0x04, 0x72, 0x72, 0x61, 0x63, 0x80, 0x00, 0x08, 0x6c, 0x69, 0x6d, 0x73,
+  0x69, 0x77, 0x65, 0x6c, 0x80, 0x00, 0x09, 0x61, 0x6b, 0x73, 0x69, 0x7a,
+  0x6e, 0x61, 0x72, 0x66, 0x80, 0x00, 0x06, 0x61, 0x70, 0x73, 0x77, 0x65,
+  0x6e, 0x80, 0x00, 0x00, 0x00, 0x05, 0x61, 0x65, 0x6e, 0x73, 0x75, 0x00,
+  0x47, 0x66, 0x00, 0x47, 0x6c, 0x00, 0x47, 0x71, 0x00, 0x47, 0xa1, 0x00,
+  0x47, 0xbf, 0x03, 0x65, 0x68, 0x74, 0x80, 0x00, 0x02, 0x78, 0x65, 0x80,
+  0x00, 0x02, 0x65, 0x63, 0x80, 0x04, 0x65, 0x6c, 0x6d, 0x74, 0x00, 0x47,
+  0x86, 0x00, 0x47, 0x8f, 0x00, 0x47, 0x99, 0x00, 0x44, 0x3d, 0x06, 0x63,
+  0x6e, 0x65, 0x69, 0x63, 0x73, 0x80, 0x00, 0x07, 0x61, 0x72, 0x75, 0x74,
+  0x6c, 0x75, 0x63, 0x80, 0x00, 0x05, 0x75, 0x65, 0x73, 0x75, 0x6d, 0x80,
+  0x00, 0x00, 0x00, 0x02, 0x65, 0x6e, 0x00, 0x47, 0xac, 0x00, 0x47, 0xb9,
+  0x02, 0x68, 0x63, 0x00, 0x02, 0x6e, 0x6f, 0x00, 0x22, 0xab, 0x00, 0x01,
+  0x8b, 0x03, 0x65, 0x75, 0x6d, 0x80, 0x00, 0x04, 0x70, 0x6d, 0x6f, 0x63,
+  0x80, 0x00, 0x01, 0x61, 0x80, 0x01, 0x6e, 0x00, 0x47, 0xce, 0x03, 0x65,
+  0x70, 0x6f, 0x80, 0x00, 0x03, 0x62, 0x61, 0x6c, 0x80, 0x00, 0x00, 0x00,
+  0x03, 0x61, 0x6f, 0x74, 0x00, 0x47, 0xe9, 0x00, 0x47, 0xd4, 0x00, 0x47,
+  0xf1, 0x05, 0x73, 0x6f, 0x6e, 0x69, 0x64, 0x80, 0x00, 0x06, 0x61, 0x6b,
+  0x69, 0x72, 0x61, 0x6b, 0x80, 0x00, 0x00, 0x40, 0x61, 0x15, 0x01, 0x00,
+  0x00, 0x02, 0x03, 0x00, 0x04, 0x05, 0x06, 0x00, 0x00, 0x07, 0x08, 0x09,
+  0x00, 0x00, 0x00, 0x0a, 0x0b, 0x0c, 0x0d, 0x00, 0x48, 0x3a, 0x00, 0x48,
+  0x5b, 0x00, 0x48, 0x71, 0x00, 0x49, 0xa8, 0x00, 0x49, 0xb4, 0x00, 0x49,
+  0xba, 0x00, 0x49, 0xe3, 0x00, 0x49, 0xfb, 0x00, 0x4a, 0x0c, 0x00, 0x4a,
+  0x68, 0x00, 0x4a, 0xa1, 0x00, 0x4a, 0xac, 0x00, 0x4b, 0x09, 0x00, 0x00,
+  0x02, 0x6c, 0x78, 0x00, 0x48, 0x45, 0x00, 0x1a, 0x51, 0x00, 0x00, 0x02,
+  0x67, 0x6c, 0x00, 0x01, 0xed, 0x00, 0x48, 0x50, 0x00, 0x00, 0x02, 0x61,
+  0x65, 0x00, 0x46, 0xfe, 0x00, 0x3d, 0x0a, 0x01, 0x69, 0x00, 0x02, 0x6b,
+  0x70, 0x00, 0x01, 0xed, 0x00, 0x48, 0x67, 0x07, 0x61, 0x72, 0x64, 0x6e,
+  0x61, 0x72, 0x67, 0x80, 0x00, 0x00, 0x40, 0x63, 0x13, 0x01, 0x02, 0x00,
+  0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x07, 0x00, 0x08, 0x00, 0x48, 0xa0, 0x00, 0x48, 0xb5, 0x00, 0x48,
+  0xbb, 0x00, 0x48, 0xfb, 0x00, 0x49, 0x05, 0x00, 0x49, 0x4a, 0x00, 0x49,
+  0x66, 0x00, 0x49, 0x74, 0x05, 0x6e, 0x65, 0x69, 0x63, 0x73, 0x80, 0x01,
+  0x6c, 0x00, 0x48, 0xac, 0x06, 0x61, 0x72, 0x75, 0x74, 0x61, 0x6e, 0x80,
+  0x00, 0x03, 0x6e, 0x61, 0x6c, 0x80, 0x00, 0x03, 0x63, 0x73, 0x69, 0x00,
+  0x03, 0x64, 0x72, 0x73, 0x00, 0x48, 0xcd, 0x00, 0x48, 0xd3, 0x00, 0x48,
+  0xf3, 0x03, 0x65, 0x75, 0x6a, 0x80, 0x00, 0x05, 0x6f, 0x74, 0x73, 0x69,
+  0x68, 0x80, 0x02, 0x6e, 0x72, 0x00, 0x48, 0xe3, 0x00, 0x48, 0xec, 0x06,
+  0x69, 0x7a, 0x69, 0x64, 0x65, 0x6d, 0x80, 0x00, 0x04, 0x75, 0x74, 0x61,
+  0x6e, 0x80, 0x00, 0x05, 0x65, 0x6c, 0x68, 0x63, 0x73, 0x80, 0x00, 0x07,
+  0x74, 0x69, 0x6e, 0x61, 0x6d, 0x75, 0x68, 0x80, 0x00, 0x00, 0x00, 0x03,
+  0x61, 0x65, 0x6c, 0x00, 0x1c, 0xb4, 0x00, 0x49, 0x14, 0x00, 0x49, 0x1d,
+  0x06, 0x67, 0x6e, 0x61, 0x73, 0x6f, 0x6c, 0x80, 0x00, 0x00, 0x00, 0x02,
+  0x65, 0x69, 0x00, 0x49, 0x28, 0x00, 0x49, 0x42, 0x00, 0x00, 0x02, 0x72,
+  0x78, 0x00, 0x49, 0x33, 0x00, 0x40, 0x14, 0x0c, 0x75, 0x74, 0x61, 0x6e,
+  0x73, 0x65, 0x63, 0x6e, 0x65, 0x69, 0x63, 0x73, 0x80, 0x00, 0x05, 0x61,
+  0x73, 0x72, 0x65, 0x76, 0x80, 0x00, 0x00, 0x00, 0x02, 0x65, 0x74, 0x00,
+  0x49, 0x55, 0x00, 0x3a, 0x41, 0x00, 0x00, 0x02, 0x65, 0x75, 0x00, 0x03,
+  0x40, 0x00, 0x49, 0x60, 0x03, 0x67, 0x69, 0x66, 0x80, 0x00, 0x0b, 0x75,
+  0x6f, 0x68, 0x63, 0x69, 0x72, 0x6f, 0x74, 0x73, 0x69, 0x68, 0x80, 0x00,
+  0x00, 0x00, 0x02, 0x65, 0x71, 0x00, 0x02, 0x03, 0x00, 0x49, 0x7f, 0x00,
+  0x00, 0x02, 0x61, 0x69, 0x00, 0x49, 0x8a, 0x00, 0x49, 0x90, 0x03, 0x64,
+  0x61, 0x63, 0x80, 0x00, 0x03, 0x74, 0x6e, 0x61, 0x80, 0x02, 0x6e, 0x73,
+  0x00, 0x49, 0x9e, 0x00, 0x07, 0xb6, 0x07, 0x61, 0x63, 0x69, 0x72, 0x65,
+  0x6d, 0x61, 0x80, 0x00, 0x09, 0x6e, 0x69, 0x72, 0x70, 0x73, 0x6d, 0x6c,
+  0x61, 0x70, 0x80, 0x00, 0x03, 0x74, 0x61, 0x62, 0x80, 0x00, 0x00, 0x00,
+  0x04, 0x6c, 0x72, 0x75, 0x78, 0x00, 0x49, 0xcd, 0x00, 0x36, 0x49, 0x00,
+  0x49, 0xd9, 0x00, 0x02, 0xa9, 0x09, 0x6f, 0x70, 0x61, 0x6e, 0x61, 0x69,
+  0x64, 0x6e, 0x69, 0x80, 0x00, 0x07, 0x6f, 0x6c, 0x74, 0x6e, 0x69, 0x61,
+  0x73, 0x80, 0x00, 0x00, 0x00, 0x02, 0x65, 0x6c, 0x00, 0x49, 0xee, 0x00,
+  0x49, 0xf6, 0x05, 0x73, 0x73, 0x75, 0x72, 0x62, 0x80, 0x00, 0x02, 0x6f,
+  0x64, 0x80, 0x00, 0x0e, 0x72, 0x61, 0x65, 0x72, 0x69, 0x66, 0x6c, 0x61,
+  0x6e, 0x6f, 0x69, 0x74, 0x61, 0x6e, 0x80, 0x00, 0x00, 0x00, 0x03, 0x61,
+  0x65, 0x6f, 0x00, 0x4a, 0x1b, 0x00, 0x4a, 0x2d, 0x00, 0x4a, 0x36, 0x00,
+  0x00, 0x02, 0x62, 0x6c, 0x00, 0x4a, 0x26, 0x00, 0x01, 0xed, 0x04, 0x6c,
+  0x61, 0x74, 0x73, 0x80, 0x00, 0x06, 0x72, 0x64, 0x6c, 0x69, 0x68, 0x63,
+  0x80, 0x00, 0x01, 0x69, 0x00, 0x02, 0x73, 0x74, 0x00, 0x4a, 0x42, 0x00,
+  0x4a, 0x48, 0x03, 0x6e, 0x61, 0x6d, 0x80, 0x00, 0x09, 0x61, 0x63, 0x69,
+  0x6e, 0x75, 0x6d, 0x6d, 0x6f, 0x63, 0x80, 0x01, 0x65, 0x00, 0x4a, 0x58,
+  0x0d, 0x6c, 0x65, 0x74, 0x2d, 0x64, 0x6e, 0x61, 0x2d, 0x73, 0x74, 0x73,
+  0x6f, 0x70, 0x80, 0x00, 0x01, 0x65, 0x00, 0x05, 0x64, 0x6c, 0x6d, 0x6e,
+  0x74, 0x00, 0x4a, 0x80, 0x00, 0x4a, 0x87, 0x00, 0x4a, 0x8e, 0x00, 0x01,
+  0x7d, 0x00, 0x4a, 0x94, 0x04, 0x6e, 0x61, 0x6c, 0x66, 0x80, 0x00, 0x04,
+  0x74, 0x74, 0x65, 0x73, 0x80, 0x00, 0x03, 0x72, 0x61, 0x66, 0x80, 0x00,
+  0x0a, 0x6e, 0x65, 0x63, 0x65, 0x63, 0x6e, 0x65, 0x69, 0x63, 0x73, 0x80,
+  0x00, 0x00, 0x00, 0x02, 0x61, 0x65, 0x00, 0x21, 0x1d, 0x00, 0x0d, 0x7a,
+  0x00, 0x00, 0x04, 0x66, 0x6e, 0x6f, 0x72, 0x00, 0x4a, 0xbf, 0x00, 0x36,
+  0xe3, 0x00, 0x4a, 0xd2, 0x00, 0x4a, 0xd8, 0x03, 0x61, 0x72, 0x63, 0x80,
+  0x01, 0x64, 0x00, 0x4a, 0xc9, 0x06, 0x6e, 0x61, 0x73, 0x74, 0x72, 0x61,
+  0x80, 0x00, 0x03, 0x6c, 0x69, 0x70, 0x80, 0x00, 0x01, 0x61, 0x80, 0x03,
+  0x65, 0x73, 0x78, 0x00, 0x4a, 0xe8, 0x00, 0x07, 0xb6, 0x00, 0x4b, 0x02,
+  0x00, 0x00, 0x02, 0x6e, 0x76, 0x00, 0x0a, 0x0e, 0x00, 0x4a, 0xf3, 0x08,
+  0x69, 0x74, 0x61, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x80, 0x01, 0x73, 0x00,
+  0x07, 0xb6, 0x04, 0x75, 0x61, 0x65, 0x62, 0x80, 0x00, 0x00, 0x00, 0x02,
+  0x62, 0x63, 0x00, 0x4b, 0x14, 0x00, 0x4b, 0x22, 0x00, 0x80, 0x01, 0x6d,
+  0x00, 0x4b, 0x1b, 0x04, 0x75, 0x6c, 0x6f, 0x63, 0x80, 0x00, 0x03, 0x72,
+  0x69, 0x63, 0x80, 0x00, 0x00, 0x40, 0x61, 0x13, 0x01, 0x00, 0x02, 0x03,
+  0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x06, 0x07, 0x00,
+  0x00, 0x08, 0x09, 0x00, 0x4b, 0x5a, 0x00, 0x4b, 0x65, 0x00, 0x4b, 0x6d,
+  0x00, 0x4b, 0x73, 0x00, 0x4b, 0x90, 0x00, 0x4b, 0x98, 0x00, 0x4b, 0xd5,
+  0x00, 0x4b, 0xdb, 0x00, 0x4c, 0x8f, 0x08, 0x67, 0x69, 0x6c, 0x6c, 0x74,
+  0x72, 0x6f, 0x70, 0x80, 0x00, 0x05, 0x65, 0x6a, 0x6f, 0x72, 0x70, 0x80,
+  0x00, 0x03, 0x61, 0x74, 0x73, 0x80, 0x00, 0x00, 0x00, 0x02, 0x65, 0x6b,
+  0x00, 0x4b, 0x7e, 0x00, 0x4b, 0x84, 0x03, 0x73, 0x75, 0x6d, 0x80, 0x00,
+  0x09, 0x72, 0x61, 0x6d, 0x6e, 0x61, 0x69, 0x64, 0x6e, 0x69, 0x80, 0x00,
+  0x05, 0x6f, 0x72, 0x74, 0x65, 0x64, 0x80, 0x00, 0x01, 0x65, 0x00, 0x02,
+  0x6d, 0x76, 0x00, 0x4b, 0xa4, 0x00, 0x4b, 0xcf, 0x00, 0x00, 0x03, 0x65,
+  0x6e, 0x70, 0x00, 0x4b, 0xb3, 0x00, 0x4b, 0xbb, 0x00, 0x4b, 0xc4, 0x05,
+  0x6c, 0x74, 0x74, 0x65, 0x73, 0x80, 0x00, 0x06, 0x6f, 0x72, 0x69, 0x76,
+  0x6e, 0x65, 0x80, 0x00, 0x08, 0x69, 0x75, 0x71, 0x65, 0x6d, 0x72, 0x61,
+  0x66, 0x80, 0x00, 0x03, 0x6e, 0x6f, 0x63, 0x80, 0x00, 0x03, 0x70, 0x65,
+  0x64, 0x80, 0x00, 0x00, 0x00, 0x03, 0x61, 0x6f, 0x75, 0x00, 0x4b, 0xea,
+  0x00, 0x4c, 0x6f, 0x00, 0x4c, 0x86, 0x00, 0xc0, 0x64, 0x16, 0x01, 0x02,
+  0x00, 0x03, 0x04, 0x00, 0x00, 0x05, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x4c, 0x1c, 0x00,
+  0x4c, 0x22, 0x00, 0x4c, 0x28, 0x00, 0x4c, 0x30, 0x00, 0x4c, 0x38, 0x00,
+  0x4c, 0x3e, 0x00, 0x4c, 0x5a, 0x00, 0x4c, 0x61, 0x03, 0x72, 0x69, 0x62,
+  0x80, 0x00, 0x03, 0x6e, 0x69, 0x66, 0x80, 0x00, 0x05, 0x74, 0x74, 0x75,
+  0x74, 0x73, 0x80, 0x00, 0x05, 0x73, 0x69, 0x77, 0x65, 0x6a, 0x80, 0x00,
+  0x03, 0x63, 0x6f, 0x72, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x6f, 0x00,
+  0x4c, 0x49, 0x00, 0x4c, 0x52, 0x06, 0x63, 0x69, 0x72, 0x65, 0x6d, 0x61,
+  0x80, 0x00, 0x05, 0x6f, 0x74, 0x72, 0x61, 0x63, 0x80, 0x00, 0x04, 0x61,
+  0x6d, 0x73, 0x61, 0x80, 0x00, 0x0b, 0x72, 0x61, 0x72, 0x6f, 0x70, 0x6d,
+  0x65, 0x74, 0x6e, 0x6f, 0x63, 0x80, 0x00, 0x01, 0x70, 0x00, 0x03, 0x61,
+  0x73, 0x77, 0x00, 0x06, 0x56, 0x00, 0x4c, 0x7f, 0x00, 0x01, 0x8f, 0x04,
+  0x6e, 0x61, 0x72, 0x74, 0x80, 0x00, 0x06, 0x66, 0x6b, 0x6e, 0x61, 0x72,
+  0x66, 0x80, 0x00, 0x00, 0x00, 0x06, 0x61, 0x65, 0x69, 0x6e, 0x72, 0x75,
+  0x00, 0x4c, 0xaa, 0x00, 0x4c, 0xc5, 0x00, 0x4c, 0xce, 0x00, 0x4c, 0xd6,
+  0x00, 0x4c, 0xdb, 0x00, 0x4c, 0xf9, 0x00, 0x00, 0x02, 0x63, 0x6f, 0x00,
+  0x4c, 0xb5, 0x00, 0x4c, 0xbd, 0x05, 0x64, 0x61, 0x6f, 0x72, 0x62, 0x80,
+  0x00, 0x05, 0x63, 0x74, 0x73, 0x61, 0x65, 0x80, 0x00, 0x06, 0x77, 0x68,
+  0x74, 0x75, 0x6f, 0x73, 0x80, 0x00, 0x05, 0x6c, 0x61, 0x79, 0x6f, 0x6c,
+  0x80, 0x00, 0x02, 0x75, 0x6b, 0x80, 0x00, 0x00, 0x00, 0x02, 0x6f, 0x75,
+  0x00, 0x4c, 0xe6, 0x00, 0x4c, 0xf0, 0x07, 0x68, 0x6e, 0x65, 0x6d, 0x6c,
+  0x65, 0x64, 0x80, 0x00, 0x06, 0x68, 0x6c, 0x79, 0x72, 0x61, 0x6d, 0x80,
+  0x00, 0x02, 0x72, 0x74, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x72, 0x00,
+  0x4d, 0x09, 0x00, 0x4d, 0x2a, 0x00, 0x00, 0x02, 0x62, 0x65, 0x00, 0x4d,
+  0x14, 0x00, 0x4d, 0x1b, 0x04, 0x67, 0x72, 0x65, 0x62, 0x80, 0x00, 0x0c,
+  0x74, 0x61, 0x6c, 0x70, 0x6f, 0x64, 0x61, 0x72, 0x6f, 0x6c, 0x6f, 0x63,
+  0x80, 0x00, 0x03, 0x6d, 0x79, 0x63, 0x80, 0x00, 0x00, 0x00, 0x02, 0x6f,
+  0x72, 0x00, 0x4d, 0x3b, 0x00, 0x02, 0x03, 0x04, 0x63, 0x73, 0x6f, 0x6d,
+  0x80, 0x00, 0x00, 0x00, 0x04, 0x65, 0x69, 0x6e, 0x74, 0x00, 0x4d, 0x55,
+  0x00, 0x4d, 0x5b, 0x00, 0x22, 0xab, 0x00, 0x22, 0x90, 0x03, 0x73, 0x73,
+  0x65, 0x80, 0x00, 0x05, 0x6e, 0x65, 0x6f, 0x68, 0x70, 0x80, 0x00, 0x00,
+  0x40, 0x61, 0x14, 0x01, 0x00, 0x02, 0x03, 0x04, 0x00, 0x05, 0x06, 0x00,
+  0x00, 0x00, 0x07, 0x08, 0x09, 0x00, 0x0a, 0x00, 0x0b, 0x0c, 0x0d, 0x00,
+  0x4d, 0xa2, 0x00, 0x4d, 0xd1, 0x00, 0x01, 0x82, 0x00, 0x4d, 0xda, 0x00,
+  0x4e, 0x58, 0x00, 0x4e, 0xb3, 0x00, 0x4e, 0xbf, 0x00, 0x4e, 0xd9, 0x00,
+  0x4e, 0xf4, 0x00, 0x03, 0x8e, 0x00, 0x4f, 0x05, 0x00, 0x4f, 0xd8, 0x00,
+  0x4f, 0xe1, 0x00, 0x00, 0x02, 0x62, 0x77, 0x00, 0x4d, 0xad, 0x00, 0x4d,
+  0xba, 0x0a, 0x65, 0x6b, 0x61, 0x65, 0x70, 0x61, 0x73, 0x65, 0x68, 0x63,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x65, 0x6c, 0x00, 0x4d, 0xc5, 0x00, 0x4d,
+  0xcb, 0x03, 0x74, 0x61, 0x67, 0x80, 0x00, 0x03, 0x69, 0x61, 0x72, 0x80,
+  0x00, 0x06, 0x61, 0x6d, 0x72, 0x61, 0x68, 0x70, 0x80, 0x00, 0x00, 0x00,
+  0x05, 0x68, 0x6c, 0x6e, 0x72, 0x73, 0x00, 0x4d, 0xf1, 0x00, 0x4d, 0xf7,
+  0x00, 0x4e, 0x28, 0x00, 0x4e, 0x38, 0x00, 0x4e, 0x3e, 0x03, 0x73, 0x75,
+  0x62, 0x80, 0x00, 0x00, 0x00, 0x02, 0x65, 0x6c, 0x00, 0x4e, 0x02, 0x00,
+  0x4e, 0x09, 0x04, 0x6b, 0x72, 0x65, 0x62, 0x80, 0x00, 0x00, 0x00, 0x02,
+  0x61, 0x6f, 0x00, 0x4e, 0x14, 0x00, 0x4c, 0xf9, 0x01, 0x76, 0x80, 0x01,
+  0x65, 0x00, 0x4e, 0x1c, 0x09, 0x6e, 0x69, 0x77, 0x79, 0x64, 0x6e, 0x61,
+  0x72, 0x62, 0x80, 0x00, 0x00, 0x00, 0x02, 0x64, 0x6f, 0x00, 0x4e, 0x33,
+  0x00, 0x03, 0x40, 0x02, 0x79, 0x73, 0x80, 0x00, 0x03, 0x72, 0x75, 0x73,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x6e, 0x72, 0x00, 0x4e, 0x49, 0x00, 0x4e,
+  0x50, 0x04, 0x72, 0x65, 0x75, 0x67, 0x80, 0x00, 0x05, 0x65, 0x6a, 0x77,
+  0x65, 0x6e, 0x80, 0x00, 0x03, 0x6f, 0x6c, 0x6f, 0x00, 0x06, 0x65, 0x6d,
+  0x6e, 0x6f, 0x70, 0x72, 0x00, 0x4e, 0x76, 0x00, 0x4e, 0x88, 0x00, 0x4e,
+  0x8f, 0x00, 0x25, 0xd6, 0x00, 0x4e, 0x9b, 0x00, 0x4e, 0xae, 0x00, 0x00,
+  0x02, 0x61, 0x67, 0x00, 0x4e, 0x81, 0x00, 0x01, 0xed, 0x04, 0x68, 0x63,
+  0x72, 0x61, 0x80, 0x00, 0x04, 0x6f, 0x74, 0x6e, 0x65, 0x80, 0x00, 0x01,
+  0x68, 0x00, 0x02, 0x63, 0x74, 0x00, 0x1a, 0x51, 0x00, 0x22, 0x81, 0x01,
+  0x6f, 0x00, 0x02, 0x72, 0x74, 0x00, 0x4e, 0xa7, 0x00, 0x01, 0xed, 0x04,
+  0x68, 0x74, 0x6e, 0x61, 0x80, 0x00, 0x02, 0x6f, 0x68, 0x80, 0x00, 0x09,
+  0x70, 0x61, 0x72, 0x67, 0x6f, 0x74, 0x6f, 0x68, 0x70, 0x80, 0x00, 0x00,
+  0x00, 0x02, 0x65, 0x69, 0x00, 0x4e, 0xca, 0x00, 0x4e, 0xd3, 0x06, 0x74,
+  0x61, 0x6c, 0x69, 0x68, 0x70, 0x80, 0x00, 0x03, 0x6d, 0x61, 0x66, 0x80,
+  0x00, 0x00, 0x00, 0x02, 0x65, 0x6f, 0x00, 0x4e, 0xe4, 0x00, 0x4e, 0xeb,
+  0x04, 0x64, 0x61, 0x63, 0x61, 0x80, 0x00, 0x06, 0x6e, 0x6f, 0x72, 0x74,
+  0x73, 0x61, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x79, 0x00, 0x4e, 0xff,
+  0x00, 0x02, 0x03, 0x03, 0x74, 0x6f, 0x62, 0x80, 0x00, 0x00, 0x00, 0x06,
+  0x61, 0x65, 0x6c, 0x6e, 0x6f, 0x74, 0x00, 0x4f, 0x20, 0x00, 0x4f, 0x3d,
+  0x00, 0x4f, 0x67, 0x00, 0x4f, 0x6e, 0x00, 0x4f, 0x79, 0x00, 0x4f, 0xc6,
+  0x00, 0x00, 0x02, 0x72, 0x74, 0x00, 0x4f, 0x2b, 0x00, 0x4f, 0x36, 0x08,
+  0x6f, 0x70, 0x6d, 0x65, 0x74, 0x6e, 0x6f, 0x63, 0x80, 0x00, 0x04, 0x69,
+  0x6c, 0x69, 0x6d, 0x80, 0x00, 0x00, 0x00, 0x03, 0x64, 0x6c, 0x76, 0x00,
+  0x4f, 0x4c, 0x00, 0x4f, 0x55, 0x00, 0x4f, 0x5f, 0x06, 0x69, 0x6f, 0x72,
+  0x62, 0x6d, 0x65, 0x80, 0x00, 0x03, 0x6c, 0x61, 0x67, 0x80, 0x01, 0x74,
+  0x00, 0x44, 0x3d, 0x05, 0x6f, 0x63, 0x73, 0x69, 0x64, 0x80, 0x00, 0x04,
+  0x65, 0x77, 0x65, 0x6a, 0x80, 0x00, 0x08, 0x6f, 0x73, 0x61, 0x6d, 0x65,
+  0x65, 0x72, 0x66, 0x80, 0x00, 0x04, 0x74, 0x73, 0x69, 0x68, 0x80, 0x06,
+  0x64, 0x65, 0x67, 0x6c, 0x72, 0x73, 0x00, 0x4f, 0x98, 0x00, 0x47, 0x86,
+  0x00, 0x4f, 0xa4, 0x00, 0x4f, 0xb0, 0x00, 0x4f, 0xbc, 0x00, 0x07, 0xb6,
+  0x09, 0x6e, 0x61, 0x65, 0x63, 0x6e, 0x65, 0x69, 0x63, 0x73, 0x80, 0x00,
+  0x05, 0x6e, 0x69, 0x76, 0x69, 0x6c, 0x80, 0x01, 0x73, 0x00, 0x07, 0xb6,
+  0x01, 0x61, 0x00, 0x02, 0x63, 0x72, 0x00, 0x20, 0x5e, 0x00, 0x48, 0xec,
+  0x07, 0x65, 0x74, 0x75, 0x70, 0x6d, 0x6f, 0x63, 0x80, 0x00, 0x0f, 0x73,
+  0x75, 0x64, 0x6e, 0x69, 0x64, 0x6e, 0x61, 0x65, 0x63, 0x6e, 0x65, 0x69,
+  0x63, 0x73, 0x80, 0x00, 0x06, 0x70, 0x65, 0x6c, 0x69, 0x70, 0x65, 0x80,
+  0x00, 0x00, 0x00, 0x03, 0x65, 0x69, 0x6e, 0x00, 0x4f, 0xf0, 0x00, 0x50,
+  0x07, 0x00, 0x50, 0x23, 0x04, 0x69, 0x63, 0x6f, 0x73, 0x80, 0x01, 0x6c,
+  0x00, 0x4f, 0xfb, 0x09, 0x61, 0x63, 0x69, 0x72, 0x6f, 0x74, 0x73, 0x69,
+  0x68, 0x80, 0x00, 0x00, 0x00, 0x02, 0x6e, 0x73, 0x00, 0x50, 0x12, 0x00,
+  0x50, 0x1a, 0x05, 0x75, 0x6d, 0x6d, 0x6f, 0x63, 0x80, 0x00, 0x06, 0x72,
+  0x65, 0x76, 0x69, 0x6e, 0x75, 0x80, 0x00, 0x03, 0x75, 0x6f, 0x63, 0x80,
+  0x00, 0x00, 0x00, 0x05, 0x61, 0x69, 0x6e, 0x6f, 0x75, 0x00, 0x1c, 0x36,
+  0x00, 0x50, 0x40, 0x00, 0x0d, 0x75, 0x00, 0x50, 0x48, 0x00, 0x50, 0x50,
+  0x05, 0x65, 0x77, 0x68, 0x63, 0x73, 0x80, 0x00, 0x05, 0x6a, 0x61, 0x64,
+  0x61, 0x62, 0x80, 0x00, 0x07, 0x72, 0x63, 0x61, 0x74, 0x6e, 0x61, 0x73,
+  0x80, 0x00, 0x00, 0x40, 0x61, 0x16, 0x01, 0x02, 0x03, 0x00, 0x00, 0x00,
+  0x04, 0x05, 0x06, 0x00, 0x07, 0x00, 0x08, 0x00, 0x00, 0x09, 0x00, 0x00,
+  0x0a, 0x0b, 0x00, 0x0c, 0x00, 0x50, 0x98, 0x00, 0x07, 0xba, 0x00, 0x50,
+  0xb2, 0x00, 0x12, 0xe9, 0x00, 0x51, 0xba, 0x00, 0x51, 0xdc, 0x00, 0x52,
+  0x22, 0x00, 0x52, 0x3c, 0x00, 0x52, 0x5b, 0x00, 0x52, 0x79, 0x00, 0x52,
+  0xb2, 0x00, 0x53, 0x69, 0x00, 0x80, 0x01, 0x2e, 0x00, 0x50, 0x9f, 0x00,
+  0x00, 0x04, 0x67, 0x6d, 0x74, 0x75, 0x00, 0x01, 0x72, 0x00, 0x01, 0x82,
+  0x00, 0x01, 0x8f, 0x00, 0x01, 0x94, 0x00, 0x80, 0x01, 0x2e, 0x00, 0x50,
+  0xb9, 0x00, 0x40, 0x61, 0x1a, 0x01, 0x02, 0x03, 0x04, 0x05, 0x00, 0x06,
+  0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x00, 0x0f, 0x00, 0x10,
+  0x11, 0x12, 0x13, 0x14, 0x15, 0x00, 0x16, 0x00, 0x3d, 0x0a, 0x00, 0x3d,
+  0x0a, 0x00, 0x16, 0xc3, 0x00, 0x51, 0x19, 0x00, 0x3d, 0x0a, 0x00, 0x51,
+  0x28, 0x00, 0x51, 0x33, 0x00, 0x51, 0x42, 0x00, 0x51, 0x4d, 0x00, 0x3d,
+  0x0a, 0x00, 0x51, 0x64, 0x00, 0x51, 0x73, 0x00, 0x51, 0x7e, 0x00, 0x03,
+  0x40, 0x00, 0x01, 0x87, 0x00, 0x51, 0x91, 0x00, 0x01, 0x8f, 0x00, 0x01,
+  0x94, 0x00, 0x01, 0x99, 0x00, 0x03, 0x3c, 0x00, 0x51, 0x9c, 0x00, 0x51,
+  0xaf, 0x00, 0x00, 0x03, 0x35, 0x67, 0x73, 0x00, 0x1b, 0x37, 0x00, 0x01,
+  0xed, 0x00, 0x01, 0xed, 0x00, 0x00, 0x02, 0x6c, 0x72, 0x00, 0x1b, 0x5b,
+  0x00, 0x02, 0x12, 0x00, 0x00, 0x03, 0x61, 0x71, 0x73, 0x00, 0x01, 0xed,
+  0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x00, 0x02, 0x37, 0x68, 0x00,
+  0x1b, 0x81, 0x00, 0x01, 0xed, 0x00, 0x00, 0x05, 0x62, 0x66, 0x74, 0x78,
+  0x7a, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x01,
+  0xed, 0x00, 0x01, 0xed, 0x00, 0x00, 0x03, 0x68, 0x69, 0x6a, 0x00, 0x01,
+  0xed, 0x00, 0x03, 0x40, 0x00, 0x01, 0xed, 0x00, 0x00, 0x02, 0x6e, 0x6f,
+  0x00, 0x01, 0xed, 0x00, 0x01, 0x87, 0x00, 0x00, 0x04, 0x68, 0x6c, 0x73,
+  0x79, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x01,
+  0xed, 0x00, 0x00, 0x02, 0x67, 0x6a, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed,
+  0x00, 0x00, 0x04, 0x67, 0x6a, 0x6e, 0x73, 0x00, 0x01, 0xed, 0x00, 0x01,
+  0xed, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x00, 0x02, 0x67, 0x78,
+  0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x80, 0x01, 0x2e, 0x00, 0x51,
+  0xc1, 0x00, 0x00, 0x06, 0x62, 0x67, 0x6c, 0x6d, 0x74, 0x75, 0x00, 0x01,
+  0x99, 0x00, 0x01, 0x72, 0x00, 0x01, 0x7d, 0x00, 0x01, 0x82, 0x00, 0x01,
+  0x8f, 0x00, 0x01, 0x94, 0x00, 0x80, 0x01, 0x2e, 0x00, 0x51, 0xe3, 0x00,
+  0x40, 0x63, 0x14, 0x01, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x05, 0x06, 0x07, 0x00, 0x00, 0x00, 0x08, 0x09, 0x0a, 0x0b, 0x00,
+  0x1a, 0x37, 0x00, 0x03, 0x21, 0x00, 0x01, 0x72, 0x00, 0x01, 0x7d, 0x00,
+  0x52, 0x1c, 0x00, 0x3f, 0xb7, 0x00, 0x01, 0x87, 0x00, 0x10, 0xad, 0x00,
+  0x16, 0x96, 0x00, 0x01, 0x94, 0x00, 0x01, 0x99, 0x03, 0x72, 0x69, 0x66,
+  0x80, 0x00, 0x00, 0x80, 0x01, 0x2e, 0x00, 0x52, 0x29, 0x00, 0x00, 0x04,
+  0x67, 0x74, 0x75, 0x76, 0x00, 0x01, 0x72, 0x00, 0x01, 0x8f, 0x00, 0x01,
+  0x94, 0x00, 0x01, 0x99, 0x00, 0x80, 0x01, 0x2e, 0x00, 0x52, 0x43, 0x00,
+  0x00, 0x04, 0x63, 0x67, 0x75, 0x76, 0x00, 0x52, 0x56, 0x00, 0x01, 0x72,
+  0x00, 0x01, 0x94, 0x00, 0x01, 0x99, 0x02, 0x79, 0x6e, 0x84, 0x00, 0x00,
+  0x80, 0x01, 0x2e, 0x00, 0x52, 0x62, 0x00, 0x00, 0x05, 0x67, 0x6f, 0x74,
+  0x75, 0x76, 0x00, 0x01, 0x72, 0x00, 0x01, 0x87, 0x00, 0x01, 0x8f, 0x00,
+  0x01, 0x94, 0x00, 0x01, 0x99, 0x00, 0x80, 0x01, 0x2e, 0x00, 0x52, 0x80,
+  0x00, 0x00, 0x06, 0x67, 0x6d, 0x6f, 0x74, 0x75, 0x76, 0x00, 0x01, 0x72,
+  0x00, 0x01, 0x82, 0x00, 0x52, 0x9b, 0x00, 0x44, 0x3d, 0x00, 0x01, 0x94,
+  0x00, 0x52, 0xa2, 0x04, 0x73, 0x72, 0x65, 0x70, 0x80, 0x00, 0x00, 0x00,
+  0x02, 0x69, 0x75, 0x00, 0x52, 0xad, 0x00, 0x01, 0x99, 0x02, 0x6e, 0x75,
+  0x80, 0x00, 0x00, 0x80, 0x01, 0x2e, 0x00, 0x52, 0xb9, 0x00, 0x40, 0x64,
+  0x13, 0x01, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x06,
+  0x07, 0x00, 0x00, 0x00, 0x08, 0x09, 0x0a, 0x0b, 0x00, 0x03, 0x21, 0x00,
+  0x52, 0xf1, 0x00, 0x01, 0x72, 0x00, 0x52, 0xfa, 0x00, 0x53, 0x00, 0x00,
+  0x53, 0x1b, 0x00, 0x53, 0x2c, 0x00, 0x53, 0x3d, 0x00, 0x53, 0x49, 0x00,
+  0x53, 0x64, 0x00, 0x01, 0x99, 0x06, 0x73, 0x6e, 0x65, 0x66, 0x65, 0x64,
+  0x80, 0x00, 0x03, 0x74, 0x6e, 0x69, 0x80, 0x00, 0x00, 0x00, 0x02, 0x6f,
+  0x73, 0x00, 0x53, 0x0b, 0x00, 0x53, 0x13, 0x01, 0x63, 0x80, 0x01, 0x6e,
+  0x00, 0x01, 0x7d, 0x05, 0x69, 0x72, 0x75, 0x6f, 0x74, 0x80, 0x00, 0x00,
+  0x00, 0x02, 0x65, 0x69, 0x00, 0x53, 0x26, 0x00, 0x1c, 0xc3, 0x03, 0x72,
+  0x75, 0x74, 0x80, 0x00, 0x00, 0x00, 0x02, 0x66, 0x73, 0x00, 0x03, 0x21,
+  0x00, 0x53, 0x37, 0x03, 0x72, 0x65, 0x70, 0x80, 0x00, 0x01, 0x6e, 0x00,
+  0x02, 0x65, 0x72, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x00, 0x03,
+  0x61, 0x65, 0x72, 0x00, 0x02, 0x03, 0x00, 0x53, 0x58, 0x00, 0x53, 0x64,
+  0x01, 0x6e, 0x80, 0x02, 0x69, 0x75, 0x00, 0x3b, 0x40, 0x00, 0x01, 0x94,
+  0x02, 0x6e, 0x72, 0x80, 0x00, 0x00, 0x80, 0x01, 0x2e, 0x00, 0x53, 0x70,
+  0x00, 0x40, 0x63, 0x18, 0x01, 0x00, 0x02, 0x00, 0x03, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x09,
+  0x00, 0x00, 0x00, 0x0a, 0x00, 0x02, 0xa9, 0x00, 0x02, 0xfe, 0x00, 0x01,
+  0x72, 0x00, 0x53, 0xaa, 0x00, 0x01, 0x82, 0x00, 0x0a, 0x13, 0x00, 0x02,
+  0x78, 0x00, 0x01, 0x94, 0x00, 0x01, 0x99, 0x00, 0x08, 0x0c, 0x05, 0x74,
+  0x6c, 0x61, 0x65, 0x68, 0x80, 0x00, 0x00, 0x40, 0x37, 0x3e, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x04, 0x05, 0x00, 0x06, 0x00, 0x00,
+  0x07, 0x08, 0x00, 0x00, 0x09, 0x0a, 0x00, 0x00, 0x00, 0x0b, 0x0c, 0x0d,
+  0x00, 0x54, 0x1b, 0x00, 0x54, 0x29, 0x00, 0x54, 0x4b, 0x00, 0x54, 0x71,
+  0x00, 0x54, 0xba, 0x00, 0x54, 0xfd, 0x00, 0x55, 0xad, 0x00, 0x03, 0xfe,
+  0x00, 0x08, 0x11, 0x00, 0x55, 0xc7, 0x00, 0x7a, 0xe9, 0x00, 0x80, 0x4e,
+  0x00, 0x0a, 0x66, 0x0b, 0x36, 0x69, 0x34, 0x6f, 0x72, 0x66, 0x79, 0x2d,
+  0x2d, 0x6e, 0x78, 0x80, 0x00, 0x00, 0x80, 0x01, 0x2e, 0x00, 0x54, 0x30,
+  0x00, 0x00, 0x06, 0x62, 0x64, 0x67, 0x6f, 0x74, 0x76, 0x00, 0x01, 0xff,
+  0x00, 0x22, 0x81, 0x00, 0x02, 0x12, 0x00, 0x01, 0x87, 0x00, 0x02, 0x83,
+  0x00, 0x0b, 0xb4, 0x00, 0x80, 0x01, 0x2e, 0x00, 0x54, 0x52, 0x00, 0x00,
+  0x07, 0x62, 0x67, 0x6c, 0x6d, 0x74, 0x75, 0x76, 0x00, 0x01, 0x99, 0x00,
+  0x01, 0x72, 0x00, 0x01, 0x7d, 0x00, 0x01, 0x82, 0x00, 0x02, 0x78, 0x00,
+  0x01, 0x94, 0x00, 0x0b, 0xa9, 0x00, 0x80, 0x01, 0x2e, 0x00, 0x54, 0x78,
+  0x00, 0x40, 0x62, 0x15, 0x01, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x08, 0x09,
+  0x0a, 0x00, 0x0b, 0x73, 0x00, 0x10, 0xad, 0x00, 0x01, 0x72, 0x00, 0x01,
+  0x7d, 0x00, 0x54, 0xaf, 0x00, 0x02, 0x6d, 0x00, 0x10, 0xce, 0x00, 0x02,
+  0x78, 0x00, 0x01, 0x94, 0x00, 0x01, 0x99, 0x00, 0x00, 0x02, 0x6f, 0x72,
+  0x00, 0x12, 0xde, 0x00, 0x0a, 0x0e, 0x00, 0x80, 0x01, 0x2e, 0x00, 0x54,
+  0xc1, 0x00, 0x40, 0x62, 0x15, 0x01, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+  0x07, 0x08, 0x00, 0x1c, 0xa9, 0x00, 0x22, 0xc7, 0x00, 0x01, 0x72, 0x00,
+  0x01, 0x7d, 0x00, 0x01, 0x82, 0x00, 0x54, 0xf2, 0x00, 0x01, 0x94, 0x00,
+  0x01, 0x99, 0x00, 0x00, 0x02, 0x65, 0x72, 0x00, 0x02, 0x03, 0x00, 0x02,
+  0xa9, 0x00, 0x80, 0x01, 0x6e, 0x00, 0x55, 0x04, 0x01, 0x69, 0x80, 0x01,
+  0x2e, 0x00, 0x55, 0x0c, 0x00, 0x00, 0x05, 0x65, 0x6c, 0x70, 0x72, 0x73,
+  0x00, 0x55, 0x23, 0x00, 0x55, 0x70, 0x00, 0x55, 0x7c, 0x00, 0x55, 0x87,
+  0x00, 0x55, 0x90, 0x00, 0x00, 0x03, 0x67, 0x68, 0x72, 0x00, 0x55, 0x32,
+  0x00, 0x55, 0x58, 0x00, 0x55, 0x62, 0x0c, 0x64, 0x65, 0x6c, 0x77, 0x6f,
+  0x6e, 0x6b, 0x2d, 0x66, 0x6f, 0x2d, 0x6c, 0x00, 0x02, 0x65, 0x6c, 0x00,
+  0x55, 0x49, 0x00, 0x55, 0x50, 0x04, 0x72, 0x72, 0x61, 0x62, 0x84, 0x00,
+  0x05, 0x65, 0x72, 0x72, 0x61, 0x62, 0x84, 0x00, 0x07, 0x74, 0x2d, 0x73,
+  0x6b, 0x6f, 0x72, 0x67, 0x84, 0x00, 0x0b, 0x6f, 0x6d, 0x2d, 0x72, 0x6f,
+  0x66, 0x2d, 0x65, 0x72, 0x65, 0x68, 0x84, 0x00, 0x09, 0x6c, 0x61, 0x74,
+  0x69, 0x73, 0x77, 0x6f, 0x6e, 0x6b, 0x84, 0x00, 0x00, 0x00, 0x02, 0x69,
+  0x6f, 0x00, 0x15, 0x02, 0x00, 0x15, 0x09, 0x06, 0x75, 0x6f, 0x2d, 0x72,
+  0x6f, 0x66, 0x84, 0x00, 0x00, 0x00, 0x02, 0x69, 0x6e, 0x00, 0x55, 0x9b,
+  0x00, 0x55, 0xa6, 0x08, 0x68, 0x74, 0x2d, 0x73, 0x6b, 0x6f, 0x72, 0x67,
+  0x84, 0x00, 0x04, 0x64, 0x6e, 0x79, 0x64, 0x84, 0x00, 0x00, 0x80, 0x01,
+  0x2e, 0x00, 0x55, 0xb4, 0x00, 0x00, 0x02, 0x62, 0x6d, 0x00, 0x55, 0xbf,
+  0x00, 0x01, 0x82, 0x05, 0x75, 0x68, 0x74, 0x69, 0x67, 0x84, 0x00, 0x00,
+  0x80, 0x01, 0x2e, 0x00, 0x55, 0xce, 0x00, 0x40, 0x61, 0x19, 0x01, 0x02,
+  0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e,
+  0x0f, 0x10, 0x00, 0x11, 0x12, 0x13, 0x14, 0x15, 0x00, 0x00, 0x16, 0x00,
+  0x56, 0x2d, 0x00, 0x63, 0x23, 0x00, 0x64, 0xbb, 0x00, 0x65, 0x3f, 0x00,
+  0x69, 0x4b, 0x00, 0x6a, 0xf5, 0x00, 0x6b, 0x5a, 0x00, 0x6c, 0x34, 0x00,
+  0x6c, 0x82, 0x00, 0x6c, 0xfa, 0x00, 0x6d, 0x28, 0x00, 0x6e, 0x34, 0x00,
+  0x70, 0xf4, 0x00, 0x71, 0x96, 0x00, 0x74, 0x52, 0x00, 0x75, 0x48, 0x00,
+  0x75, 0x6b, 0x00, 0x77, 0x05, 0x00, 0x77, 0xf7, 0x00, 0x79, 0x11, 0x00,
+  0x79, 0xc9, 0x00, 0x79, 0xdc, 0x00, 0x40, 0x30, 0x4b, 0x01, 0x02, 0x00,
+  0x03, 0x04, 0x00, 0x00, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08,
+  0x00, 0x09, 0x00, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12,
+  0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e,
+  0x00, 0x56, 0xd6, 0x00, 0x57, 0x29, 0x00, 0x58, 0x12, 0x00, 0x58, 0x24,
+  0x00, 0x58, 0xd9, 0x00, 0x58, 0xed, 0x00, 0x59, 0x2f, 0x00, 0x59, 0x3b,
+  0x00, 0x59, 0x51, 0x00, 0x59, 0x7e, 0x00, 0x59, 0xa5, 0x00, 0x01, 0xed,
+  0x00, 0x59, 0xe6, 0x00, 0x59, 0xf1, 0x00, 0x5a, 0x04, 0x00, 0x5a, 0x38,
+  0x00, 0x5a, 0xa2, 0x00, 0x5a, 0xa8, 0x00, 0x5b, 0xe5, 0x00, 0x5c, 0x73,
+  0x00, 0x5c, 0x79, 0x00, 0x5c, 0xfa, 0x00, 0x5e, 0xf6, 0x00, 0x5f, 0x58,
+  0x00, 0x5f, 0xc1, 0x00, 0x61, 0x12, 0x00, 0x61, 0x34, 0x00, 0x61, 0x44,
+  0x00, 0x62, 0x2e, 0x00, 0x63, 0x12, 0x00, 0x00, 0x04, 0x62, 0x63, 0x67,
+  0x6b, 0x00, 0x56, 0xe9, 0x00, 0x56, 0xf9, 0x00, 0x57, 0x09, 0x00, 0x57,
+  0x19, 0x0d, 0x2d, 0x65, 0x6b, 0x68, 0x67, 0x6e, 0x61, 0x72, 0x6b, 0x2d,
+  0x2d, 0x6e, 0x78, 0x80, 0x00, 0x0d, 0x2d, 0x69, 0x65, 0x68, 0x73, 0x72,
+  0x67, 0x65, 0x76, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x0d, 0x2d, 0x6c,
+  0x6b, 0x73, 0x65, 0x64, 0x6c, 0x69, 0x67, 0x2d, 0x2d, 0x6e, 0x78, 0x80,
+  0x00, 0x0d, 0x2d, 0x6e, 0x65, 0x67, 0x6e, 0x61, 0x6e, 0x76, 0x6b, 0x2d,
+  0x2d, 0x6e, 0x78, 0x80, 0x00, 0x00, 0x00, 0x05, 0x70, 0x71, 0x72, 0x73,
+  0x76, 0x00, 0x57, 0x40, 0x00, 0x57, 0x4f, 0x00, 0x57, 0xcf, 0x00, 0x57,
+  0xde, 0x00, 0x57, 0xed, 0x0c, 0x2d, 0x6e, 0x65, 0x64, 0x72, 0x61, 0x67,
+  0x79, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x01, 0x2d, 0x00, 0x06, 0x61,
+  0x67, 0x6c, 0x6e, 0x72, 0x73, 0x00, 0x57, 0x6b, 0x00, 0x57, 0x78, 0x00,
+  0x57, 0x85, 0x00, 0x57, 0x92, 0x00, 0x57, 0xb5, 0x00, 0x57, 0xc2, 0x0a,
+  0x73, 0x69, 0x65, 0x72, 0x72, 0x73, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00,
+  0x0a, 0x72, 0x65, 0x62, 0x73, 0x6e, 0x74, 0x2d, 0x2d, 0x6e, 0x78, 0x80,
+  0x00, 0x0a, 0x61, 0x64, 0x6f, 0x2d, 0x72, 0x73, 0x2d, 0x2d, 0x6e, 0x78,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x65, 0x6f, 0x00, 0x57, 0x9d, 0x00, 0x57,
+  0xa9, 0x09, 0x67, 0x6e, 0x69, 0x64, 0x6c, 0x2d, 0x2d, 0x6e, 0x78, 0x80,
+  0x00, 0x09, 0x72, 0x66, 0x2d, 0x72, 0x73, 0x2d, 0x2d, 0x6e, 0x78, 0x80,
+  0x00, 0x0a, 0x65, 0x67, 0x6e, 0x61, 0x79, 0x68, 0x2d, 0x2d, 0x6e, 0x78,
+  0x80, 0x00, 0x0a, 0x73, 0x6f, 0x66, 0x65, 0x6e, 0x68, 0x2d, 0x2d, 0x6e,
+  0x78, 0x80, 0x00, 0x0c, 0x2d, 0x64, 0x61, 0x74, 0x73, 0x67, 0x72, 0x74,
+  0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x0c, 0x2d, 0x6c, 0x61, 0x64, 0x72,
+  0x6a, 0x74, 0x73, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x02, 0x2d, 0x79,
+  0x00, 0x02, 0x73, 0x76, 0x00, 0x57, 0xfa, 0x00, 0x58, 0x06, 0x09, 0x65,
+  0x6e, 0x6e, 0x65, 0x72, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x09, 0x72,
+  0x65, 0x6a, 0x6b, 0x73, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x0f, 0x67,
+  0x2d, 0x64, 0x61, 0x74, 0x73, 0x6f, 0x62, 0x65, 0x67, 0x68, 0x2d, 0x2d,
+  0x6e, 0x78, 0x80, 0x00, 0x00, 0x00, 0x04, 0x35, 0x36, 0x73, 0x79, 0x00,
+  0x58, 0x37, 0x00, 0x58, 0x71, 0x00, 0x58, 0x81, 0x00, 0x58, 0xad, 0x01,
+  0x2d, 0x00, 0x03, 0x64, 0x67, 0x74, 0x00, 0x58, 0x47, 0x00, 0x58, 0x55,
+  0x00, 0x58, 0x63, 0x0b, 0x6e, 0x61, 0x6c, 0x65, 0x70, 0x72, 0x6a, 0x2d,
+  0x2d, 0x6e, 0x78, 0x80, 0x00, 0x0b, 0x6f, 0x6b, 0x73, 0x6e, 0x65, 0x72,
+  0x6c, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x0b, 0x65, 0x64, 0x6e, 0x61,
+  0x6c, 0x79, 0x68, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x0d, 0x2d, 0x6e,
+  0x65, 0x6c, 0x61, 0x64, 0x6e, 0x6a, 0x6d, 0x2d, 0x2d, 0x6e, 0x78, 0x80,
+  0x00, 0x01, 0x2d, 0x00, 0x02, 0x61, 0x69, 0x00, 0x58, 0x8d, 0x00, 0x58,
+  0x9d, 0x0d, 0x6e, 0x74, 0x6f, 0x75, 0x76, 0x61, 0x63, 0x68, 0x62, 0x2d,
+  0x2d, 0x6e, 0x78, 0x80, 0x00, 0x0d, 0x6d, 0x70, 0x6f, 0x75, 0x76, 0x74,
+  0x61, 0x6c, 0x6d, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x01, 0x2d, 0x00,
+  0x02, 0x61, 0x69, 0x00, 0x58, 0xb9, 0x00, 0x58, 0xc9, 0x0d, 0x67, 0x72,
+  0x6a, 0x6e, 0x65, 0x76, 0x76, 0x61, 0x64, 0x2d, 0x2d, 0x6e, 0x78, 0x80,
+  0x00, 0x0d, 0x6b, 0x68, 0x76, 0x6c, 0x61, 0x72, 0x61, 0x65, 0x62, 0x2d,
+  0x2d, 0x6e, 0x78, 0x80, 0x00, 0x11, 0x6b, 0x2d, 0x61, 0x6e, 0x74, 0x6f,
+  0x75, 0x76, 0x61, 0x63, 0x63, 0x68, 0x62, 0x2d, 0x2d, 0x6e, 0x78, 0x80,
+  0x00, 0x00, 0x00, 0x03, 0x6b, 0x6c, 0x6d, 0x00, 0x58, 0xfc, 0x00, 0x59,
+  0x0d, 0x00, 0x59, 0x1e, 0x0e, 0x2d, 0x72, 0x65, 0x6b, 0x69, 0x65, 0x2d,
+  0x65, 0x72, 0x76, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x0e, 0x2d, 0x6c,
+  0x61, 0x64, 0x72, 0x75, 0x61, 0x2d, 0x72, 0x73, 0x2d, 0x2d, 0x6e, 0x78,
+  0x80, 0x00, 0x0e, 0x2d, 0x64, 0x61, 0x72, 0x65, 0x68, 0x73, 0x64, 0x72,
+  0x6b, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x00, 0x80, 0x01, 0x2e, 0x00,
+  0x59, 0x36, 0x02, 0x73, 0x67, 0x80, 0x00, 0x13, 0x63, 0x74, 0x2d, 0x65,
+  0x69, 0x6d, 0x65, 0x75, 0x76, 0x65, 0x6a, 0x73, 0x65, 0x6d, 0x6e, 0x2d,
+  0x2d, 0x6e, 0x78, 0x80, 0x00, 0x00, 0x00, 0x05, 0x64, 0x69, 0x6c, 0x6e,
+  0x75, 0x00, 0x02, 0x12, 0x00, 0x59, 0x68, 0x00, 0x59, 0x72, 0x00, 0x59,
+  0x77, 0x00, 0x22, 0x90, 0x07, 0x69, 0x73, 0x65, 0x76, 0x76, 0x61, 0x64,
+  0x80, 0x00, 0x02, 0x6f, 0x76, 0x80, 0x00, 0x04, 0x61, 0x72, 0x74, 0x73,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x31, 0x32, 0x00, 0x59, 0x89, 0x00, 0x59,
+  0x9c, 0x01, 0x2d, 0x00, 0x02, 0x6c, 0x73, 0x00, 0x59, 0x95, 0x00, 0x59,
+  0x95, 0x04, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x06, 0x2d, 0x68, 0x2d,
+  0x2d, 0x6e, 0x78, 0x80, 0x00, 0x00, 0x00, 0x05, 0x31, 0x61, 0x65, 0x6c,
+  0x72, 0x00, 0x59, 0xbc, 0x00, 0x59, 0xcd, 0x00, 0x59, 0xcd, 0x00, 0x3d,
+  0xa3, 0x00, 0x59, 0xd1, 0x0e, 0x30, 0x61, 0x71, 0x30, 0x2d, 0x69, 0x6e,
+  0x65, 0x76, 0x65, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x01, 0x76, 0x80,
+  0x00, 0x03, 0x61, 0x6a, 0x6e, 0x00, 0x02, 0x65, 0x75, 0x00, 0x59, 0xdf,
+  0x00, 0x01, 0xed, 0x04, 0x76, 0x76, 0x61, 0x64, 0x80, 0x00, 0x08, 0x7a,
+  0x2d, 0x6c, 0x66, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x00, 0x00, 0x02,
+  0x64, 0x73, 0x00, 0x59, 0xfc, 0x00, 0x1f, 0x1f, 0x05, 0x64, 0x61, 0x64,
+  0x61, 0x62, 0x80, 0x00, 0x00, 0x00, 0x03, 0x65, 0x68, 0x69, 0x00, 0x05,
+  0xfa, 0x00, 0x5a, 0x13, 0x00, 0x5a, 0x1d, 0x07, 0x6f, 0x6a, 0x73, 0x61,
+  0x72, 0x61, 0x6b, 0x80, 0x00, 0x02, 0x69, 0x76, 0x00, 0x02, 0x61, 0x72,
+  0x00, 0x5a, 0x2a, 0x00, 0x3d, 0x0e, 0x03, 0x67, 0x6e, 0x61, 0x00, 0x02,
+  0x65, 0x67, 0x00, 0x05, 0xfa, 0x00, 0x01, 0xed, 0x00, 0x00, 0x06, 0x66,
+  0x6c, 0x6f, 0x73, 0x74, 0x75, 0x00, 0x01, 0xed, 0x00, 0x5a, 0x53, 0x00,
+  0x5a, 0x5c, 0x00, 0x5a, 0x67, 0x00, 0x5a, 0x6f, 0x00, 0x5a, 0x8d, 0x06,
+  0x61, 0x68, 0x72, 0x65, 0x76, 0x6f, 0x80, 0x00, 0x00, 0x00, 0x02, 0x6d,
+  0x73, 0x00, 0x03, 0x8e, 0x00, 0x01, 0xed, 0x05, 0x65, 0x6e, 0x6e, 0x65,
+  0x76, 0x80, 0x00, 0x01, 0x2d, 0x00, 0x02, 0x69, 0x74, 0x00, 0x5a, 0x7b,
+  0x00, 0x5a, 0x84, 0x06, 0x6c, 0x6d, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00,
+  0x06, 0x6f, 0x6d, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x00, 0x00, 0x02,
+  0x2d, 0x73, 0x00, 0x5a, 0x98, 0x00, 0x01, 0xed, 0x07, 0x65, 0x64, 0x72,
+  0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x03, 0x75, 0x61, 0x72, 0x80, 0x00,
+  0x00, 0x40, 0x30, 0x4b, 0x01, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x06, 0x00, 0x07, 0x08, 0x00, 0x00, 0x00, 0x09, 0x0a,
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x5b, 0x1b, 0x00, 0x5b,
+  0x26, 0x00, 0x5b, 0x31, 0x00, 0x5b, 0x51, 0x00, 0x5b, 0x72, 0x00, 0x3c,
+  0x78, 0x00, 0x1c, 0x25, 0x00, 0x49, 0xf6, 0x00, 0x02, 0xa9, 0x00, 0x01,
+  0x8f, 0x00, 0x5b, 0x7e, 0x00, 0x5b, 0xda, 0x08, 0x2d, 0x74, 0x73, 0x72,
+  0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x08, 0x2d, 0x64, 0x6f, 0x62, 0x2d,
+  0x2d, 0x6e, 0x78, 0x80, 0x00, 0x01, 0x2d, 0x00, 0x02, 0x61, 0x74, 0x00,
+  0x5b, 0x3d, 0x00, 0x5b, 0x47, 0x07, 0x73, 0x69, 0x72, 0x2d, 0x2d, 0x6e,
+  0x78, 0x80, 0x00, 0x07, 0x61, 0x6c, 0x73, 0x2d, 0x2d, 0x6e, 0x78, 0x80,
+  0x00, 0x00, 0x00, 0x02, 0x72, 0x74, 0x00, 0x5b, 0x5c, 0x00, 0x01, 0xed,
+  0x00, 0x80, 0x03, 0x2d, 0x66, 0x74, 0x00, 0x5b, 0x6b, 0x00, 0x01, 0xed,
+  0x00, 0x01, 0xed, 0x04, 0x69, 0x2d, 0x6f, 0x6d, 0x80, 0x00, 0x09, 0x6f,
+  0x75, 0x76, 0x73, 0x61, 0x74, 0x76, 0x69, 0x64, 0x80, 0x00, 0x00, 0x00,
+  0x02, 0x61, 0x6f, 0x00, 0x5b, 0x89, 0x00, 0x5b, 0x95, 0x09, 0x6f, 0x75,
+  0x76, 0x61, 0x74, 0x68, 0x65, 0x69, 0x67, 0x80, 0x00, 0x02, 0x75, 0x76,
+  0x00, 0x03, 0x61, 0x69, 0x73, 0x00, 0x5b, 0xa6, 0x00, 0x5b, 0xc2, 0x00,
+  0x5b, 0xc7, 0x00, 0x00, 0x02, 0x63, 0x6e, 0x00, 0x5b, 0xb1, 0x00, 0x01,
+  0xed, 0x00, 0x00, 0x02, 0x63, 0x68, 0x00, 0x5b, 0xbc, 0x00, 0x1f, 0xfd,
+  0x03, 0x68, 0x61, 0x62, 0x80, 0x00, 0x02, 0x61, 0x67, 0x80, 0x00, 0x01,
+  0x61, 0x00, 0x02, 0x6d, 0x74, 0x00, 0x02, 0x12, 0x00, 0x5b, 0xd3, 0x04,
+  0x74, 0x76, 0x69, 0x64, 0x80, 0x00, 0x08, 0x2d, 0x72, 0x65, 0x79, 0x2d,
+  0x2d, 0x6e, 0x78, 0x80, 0x00, 0x00, 0x00, 0x06, 0x70, 0x71, 0x72, 0x73,
+  0x76, 0x77, 0x00, 0x5c, 0x00, 0x00, 0x5c, 0x20, 0x00, 0x5c, 0x2c, 0x00,
+  0x5c, 0x38, 0x00, 0x5c, 0x44, 0x00, 0x5c, 0x50, 0x01, 0x2d, 0x00, 0x02,
+  0x6c, 0x73, 0x00, 0x5c, 0x0c, 0x00, 0x5c, 0x16, 0x07, 0x61, 0x64, 0x72,
+  0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x07, 0x65, 0x6e, 0x73, 0x2d, 0x2d,
+  0x6e, 0x78, 0x80, 0x00, 0x09, 0x2d, 0x6e, 0x61, 0x67, 0x76, 0x2d, 0x2d,
+  0x6e, 0x78, 0x80, 0x00, 0x09, 0x2d, 0x61, 0x73, 0x6e, 0x73, 0x2d, 0x2d,
+  0x6e, 0x78, 0x80, 0x00, 0x09, 0x2d, 0x6b, 0x6a, 0x6b, 0x73, 0x2d, 0x2d,
+  0x6e, 0x78, 0x80, 0x00, 0x09, 0x2d, 0x6d, 0x75, 0x72, 0x62, 0x2d, 0x2d,
+  0x6e, 0x78, 0x80, 0x00, 0x01, 0x2d, 0x00, 0x02, 0x61, 0x75, 0x00, 0x5c,
+  0x5c, 0x00, 0x5c, 0x69, 0x02, 0x6e, 0x72, 0x00, 0x02, 0x66, 0x74, 0x00,
+  0x59, 0x95, 0x00, 0x59, 0x95, 0x07, 0x62, 0x6c, 0x6b, 0x2d, 0x2d, 0x6e,
+  0x78, 0x80, 0x00, 0x03, 0x70, 0x6f, 0x6c, 0x80, 0x00, 0x00, 0x00, 0x03,
+  0x30, 0x78, 0x79, 0x00, 0x5c, 0x88, 0x00, 0x5c, 0xb7, 0x00, 0x5c, 0xed,
+  0x02, 0x2d, 0x74, 0x00, 0x03, 0x62, 0x73, 0x76, 0x00, 0x5c, 0x99, 0x00,
+  0x5c, 0xa3, 0x00, 0x5c, 0xad, 0x07, 0x61, 0x6f, 0x6c, 0x2d, 0x2d, 0x6e,
+  0x78, 0x80, 0x00, 0x07, 0x6f, 0x75, 0x6d, 0x2d, 0x2d, 0x6e, 0x78, 0x80,
+  0x00, 0x07, 0x65, 0x69, 0x62, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x01,
+  0x2d, 0x00, 0x02, 0x69, 0x72, 0x00, 0x5c, 0xc3, 0x00, 0x5c, 0xce, 0x08,
+  0x70, 0x70, 0x68, 0x6c, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x00, 0x00,
+  0x02, 0x65, 0x69, 0x00, 0x5c, 0xd9, 0x00, 0x5c, 0xe3, 0x07, 0x6d, 0x62,
+  0x68, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x07, 0x6d, 0x70, 0x68, 0x2d,
+  0x2d, 0x6e, 0x78, 0x80, 0x00, 0x0a, 0x2d, 0x74, 0x69, 0x6e, 0x6b, 0x73,
+  0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x00, 0x40, 0x66, 0x11, 0x01, 0x02,
+  0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x00, 0x00, 0x0c,
+  0x0d, 0x00, 0x0e, 0x00, 0x5d, 0x39, 0x00, 0x5d, 0x45, 0x00, 0x5d, 0xba,
+  0x00, 0x5d, 0xe4, 0x00, 0x5e, 0x5b, 0x00, 0x24, 0x92, 0x00, 0x5e, 0x89,
+  0x00, 0x5e, 0xab, 0x00, 0x5e, 0xb8, 0x00, 0x5e, 0xc5, 0x00, 0x5e, 0xca,
+  0x00, 0x5e, 0xd7, 0x00, 0x5e, 0xe4, 0x00, 0x5e, 0xe9, 0x09, 0x2d, 0x61,
+  0x74, 0x73, 0x72, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x01, 0x2d, 0x00,
+  0x06, 0x61, 0x65, 0x6d, 0x6e, 0x6f, 0x73, 0x00, 0x5d, 0x61, 0x00, 0x5d,
+  0x75, 0x00, 0x5d, 0x92, 0x00, 0x5d, 0x9c, 0x00, 0x5d, 0xa6, 0x00, 0x5d,
+  0xb0, 0x01, 0x6e, 0x00, 0x02, 0x6d, 0x6e, 0x00, 0x08, 0xe5, 0x00, 0x5d,
+  0x6d, 0x05, 0x64, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x00, 0x00, 0x02,
+  0x64, 0x6e, 0x00, 0x5d, 0x80, 0x00, 0x5d, 0x89, 0x06, 0x72, 0x66, 0x2d,
+  0x2d, 0x6e, 0x78, 0x80, 0x00, 0x06, 0x67, 0x73, 0x2d, 0x2d, 0x6e, 0x78,
+  0x80, 0x00, 0x07, 0x75, 0x72, 0x73, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00,
+  0x07, 0x65, 0x74, 0x6c, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x07, 0x6c,
+  0x6d, 0x62, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x07, 0x6f, 0x72, 0x72,
+  0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x01, 0x2d, 0x00, 0x02, 0x61, 0x65,
+  0x00, 0x5d, 0xc6, 0x00, 0x5d, 0xda, 0x00, 0x00, 0x02, 0x6c, 0x79, 0x00,
+  0x5d, 0xd1, 0x00, 0x5d, 0x80, 0x06, 0x6d, 0x73, 0x2d, 0x2d, 0x6e, 0x78,
+  0x80, 0x00, 0x07, 0x6d, 0x6a, 0x74, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00,
+  0x00, 0x00, 0x02, 0x2d, 0x73, 0x00, 0x5d, 0xef, 0x00, 0x3d, 0x7d, 0x00,
+  0x00, 0x03, 0x6c, 0x72, 0x79, 0x00, 0x5d, 0xfe, 0x00, 0x5b, 0x3d, 0x00,
+  0x5e, 0x08, 0x07, 0x62, 0x6f, 0x68, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00,
+  0x00, 0x00, 0x04, 0x64, 0x6b, 0x6c, 0x72, 0x00, 0x5e, 0x1b, 0x00, 0x5e,
+  0x36, 0x00, 0x5e, 0x3f, 0x00, 0x5e, 0x48, 0x00, 0x00, 0x02, 0x61, 0x6e,
+  0x00, 0x5e, 0x26, 0x00, 0x5e, 0x2e, 0x05, 0x72, 0x2d, 0x2d, 0x6e, 0x78,
+  0x80, 0x00, 0x05, 0x61, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x06, 0x73,
+  0x61, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x06, 0x65, 0x6d, 0x2d, 0x2d,
+  0x6e, 0x78, 0x80, 0x00, 0x00, 0x00, 0x02, 0x75, 0x79, 0x00, 0x5e, 0x53,
+  0x00, 0x5d, 0x6d, 0x05, 0x6c, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x01,
+  0x2d, 0x00, 0x03, 0x64, 0x72, 0x73, 0x00, 0x5e, 0x6b, 0x00, 0x5e, 0x75,
+  0x00, 0x5e, 0x7f, 0x07, 0x72, 0x61, 0x76, 0x2d, 0x2d, 0x6e, 0x78, 0x80,
+  0x00, 0x07, 0x6f, 0x6c, 0x66, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x07,
+  0x64, 0x61, 0x76, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x01, 0x2d, 0x00,
+  0x02, 0x64, 0x6c, 0x00, 0x5e, 0x95, 0x00, 0x5e, 0xa0, 0x08, 0x72, 0x6f,
+  0x6a, 0x66, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x08, 0x61, 0x72, 0x65,
+  0x73, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x0a, 0x2d, 0x74, 0x6c, 0x6f,
+  0x68, 0x72, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x0a, 0x2d, 0x65, 0x73,
+  0x61, 0x6e, 0x73, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x02, 0x6c, 0x66,
+  0x80, 0x00, 0x0a, 0x2d, 0x73, 0x64, 0x6e, 0x69, 0x6c, 0x2d, 0x2d, 0x6e,
+  0x78, 0x80, 0x00, 0x0a, 0x2d, 0x6c, 0x61, 0x64, 0x72, 0x6c, 0x2d, 0x2d,
+  0x6e, 0x78, 0x80, 0x00, 0x02, 0x69, 0x68, 0x80, 0x00, 0x0a, 0x2d, 0x72,
+  0x76, 0x73, 0x79, 0x74, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x00, 0x00,
+  0x06, 0x61, 0x69, 0x6c, 0x6d, 0x73, 0x75, 0x00, 0x5f, 0x11, 0x00, 0x5f,
+  0x21, 0x00, 0x5f, 0x3e, 0x00, 0x5f, 0x4a, 0x00, 0x5f, 0x53, 0x00, 0x1c,
+  0xc3, 0x00, 0x00, 0x02, 0x6e, 0x6f, 0x00, 0x03, 0x8e, 0x00, 0x5f, 0x1c,
+  0x02, 0x6e, 0x73, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x65, 0x00, 0x01,
+  0x8b, 0x00, 0x5f, 0x2c, 0x01, 0x72, 0x00, 0x02, 0x64, 0x72, 0x00, 0x5f,
+  0x38, 0x00, 0x1c, 0x25, 0x03, 0x72, 0x6f, 0x6e, 0x80, 0x00, 0x01, 0x61,
+  0x00, 0x02, 0x67, 0x68, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x02, 0x6f,
+  0x72, 0x80, 0x01, 0x74, 0x00, 0x01, 0xed, 0x02, 0x69, 0x72, 0x80, 0x00,
+  0x00, 0x00, 0x06, 0x6b, 0x6c, 0x70, 0x72, 0x73, 0x75, 0x00, 0x5f, 0x73,
+  0x00, 0x02, 0xa9, 0x00, 0x5f, 0x7d, 0x00, 0x5f, 0x8b, 0x00, 0x5f, 0x99,
+  0x00, 0x5f, 0xb3, 0x07, 0x6f, 0x75, 0x6c, 0x6f, 0x6e, 0x6b, 0x61, 0x80,
+  0x00, 0x0b, 0x2d, 0x72, 0x61, 0x64, 0x64, 0x6a, 0x62, 0x2d, 0x2d, 0x6e,
+  0x78, 0x80, 0x00, 0x0b, 0x2d, 0x61, 0x67, 0x72, 0x6a, 0x6e, 0x75, 0x2d,
+  0x2d, 0x6e, 0x78, 0x80, 0x00, 0x00, 0x00, 0x03, 0x61, 0x6f, 0x72, 0x00,
+  0x5f, 0xa8, 0x00, 0x3c, 0x9a, 0x00, 0x02, 0x12, 0x08, 0x65, 0x66, 0x72,
+  0x61, 0x6d, 0x6d, 0x61, 0x68, 0x80, 0x00, 0x0b, 0x2d, 0x76, 0x72, 0x65,
+  0x69, 0x6b, 0x73, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x00, 0x40, 0x68,
+  0x13, 0x01, 0x02, 0x03, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0x06, 0x07, 0x00, 0x08, 0x09, 0x00, 0x5f, 0xf3, 0x00,
+  0x60, 0x01, 0x00, 0x60, 0x25, 0x00, 0x60, 0x33, 0x00, 0x60, 0x41, 0x00,
+  0x60, 0x72, 0x00, 0x60, 0x7f, 0x00, 0x60, 0xb5, 0x00, 0x61, 0x05, 0x0b,
+  0x2d, 0x64, 0x6e, 0x75, 0x73, 0x65, 0x6c, 0x2d, 0x2d, 0x6e, 0x78, 0x80,
+  0x00, 0x01, 0x2d, 0x00, 0x02, 0x64, 0x76, 0x00, 0x60, 0x0d, 0x00, 0x60,
+  0x19, 0x09, 0x72, 0x6f, 0x6a, 0x66, 0x6b, 0x2d, 0x2d, 0x6e, 0x78, 0x80,
+  0x00, 0x09, 0x6c, 0x65, 0x73, 0x6c, 0x6d, 0x2d, 0x2d, 0x6e, 0x78, 0x80,
+  0x00, 0x0b, 0x2d, 0x65, 0x6b, 0x65, 0x72, 0x6f, 0x6d, 0x2d, 0x2d, 0x6e,
+  0x78, 0x80, 0x00, 0x0b, 0x2d, 0x72, 0x65, 0x6b, 0x72, 0x65, 0x6d, 0x2d,
+  0x2d, 0x6e, 0x78, 0x80, 0x00, 0x01, 0x2d, 0x00, 0x03, 0x64, 0x67, 0x73,
+  0x00, 0x60, 0x51, 0x00, 0x60, 0x5c, 0x00, 0x60, 0x67, 0x08, 0x6e, 0x61,
+  0x6c, 0x72, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x08, 0x6f, 0x6b, 0x73,
+  0x72, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x08, 0x65, 0x6e, 0x73, 0x6b,
+  0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x0a, 0x2d, 0x6e, 0x65, 0x6b, 0x79,
+  0x72, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x01, 0x2d, 0x00, 0x02, 0x6b,
+  0x6f, 0x00, 0x60, 0x8b, 0x00, 0x60, 0xaa, 0x00, 0x00, 0x02, 0x61, 0x69,
+  0x00, 0x60, 0x96, 0x00, 0x60, 0xa0, 0x07, 0x62, 0x72, 0x64, 0x2d, 0x2d,
+  0x6e, 0x78, 0x80, 0x00, 0x07, 0x76, 0x6a, 0x67, 0x2d, 0x2d, 0x6e, 0x78,
+  0x80, 0x00, 0x08, 0x72, 0x79, 0x73, 0x6f, 0x2d, 0x2d, 0x6e, 0x78, 0x80,
+  0x00, 0x02, 0x2d, 0x79, 0x00, 0x04, 0x64, 0x6d, 0x6e, 0x72, 0x00, 0x60,
+  0xca, 0x00, 0x60, 0xd4, 0x00, 0x60, 0xde, 0x00, 0x60, 0xfb, 0x07, 0x6e,
+  0x61, 0x73, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x07, 0x72, 0x61, 0x6b,
+  0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x6e, 0x00,
+  0x60, 0xe9, 0x00, 0x60, 0xf2, 0x06, 0x72, 0x74, 0x2d, 0x2d, 0x6e, 0x78,
+  0x80, 0x00, 0x06, 0x69, 0x66, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x07,
+  0x65, 0x76, 0x61, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x0a, 0x2d, 0x73,
+  0x6d, 0x6f, 0x72, 0x74, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x00, 0x80,
+  0x03, 0x2e, 0x6c, 0x72, 0x00, 0x59, 0x36, 0x00, 0x61, 0x21, 0x00, 0x61,
+  0x2d, 0x09, 0x65, 0x64, 0x61, 0x74, 0x73, 0x6b, 0x6f, 0x72, 0x6b, 0x80,
+  0x00, 0x04, 0x65, 0x69, 0x6b, 0x73, 0x80, 0x00, 0x0d, 0x68, 0x2d, 0x61,
+  0x6e, 0x74, 0x6f, 0x75, 0x76, 0x6e, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00,
+  0x00, 0x40, 0x39, 0x36, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x00, 0x03, 0x00, 0x04, 0x05, 0x06, 0x00, 0x00, 0x07, 0x08, 0x00, 0x61,
+  0x96, 0x00, 0x61, 0xb1, 0x00, 0x61, 0xc0, 0x00, 0x61, 0xcf, 0x00, 0x61,
+  0xde, 0x00, 0x61, 0xed, 0x00, 0x62, 0x10, 0x00, 0x62, 0x1f, 0x18, 0x2d,
+  0x64, 0x6c, 0x6f, 0x66, 0x74, 0x73, 0x2d, 0x2d, 0x6e, 0x78, 0x2e, 0x61,
+  0x6f, 0x71, 0x2d, 0x72, 0x65, 0x6c, 0x76, 0x2d, 0x2d, 0x6e, 0x78, 0x80,
+  0x00, 0x0c, 0x2d, 0x6e, 0x6d, 0x61, 0x68, 0x65, 0x72, 0x6b, 0x2d, 0x2d,
+  0x6e, 0x78, 0x80, 0x00, 0x0c, 0x2d, 0x64, 0x6e, 0x61, 0x6c, 0x6e, 0x6b,
+  0x73, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x0c, 0x2d, 0x6e, 0x65, 0x6c,
+  0x74, 0x6c, 0x6f, 0x68, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x0c, 0x2d,
+  0x64, 0x72, 0x67, 0x65, 0x70, 0x70, 0x6f, 0x2d, 0x2d, 0x6e, 0x78, 0x80,
+  0x00, 0x04, 0x2d, 0x67, 0x76, 0x65, 0x00, 0x02, 0x67, 0x6c, 0x00, 0x61,
+  0xfc, 0x00, 0x62, 0x06, 0x07, 0x6e, 0x61, 0x6c, 0x2d, 0x2d, 0x6e, 0x78,
+  0x80, 0x00, 0x07, 0x72, 0x65, 0x62, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00,
+  0x0c, 0x2d, 0x6e, 0x65, 0x67, 0x6e, 0x69, 0x6c, 0x72, 0x2d, 0x2d, 0x6e,
+  0x78, 0x80, 0x00, 0x0c, 0x2d, 0x64, 0x72, 0x6f, 0x6a, 0x66, 0x76, 0x6b,
+  0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x00, 0x00, 0x07, 0x37, 0x38, 0x62,
+  0x65, 0x66, 0x67, 0x6f, 0x00, 0x62, 0x4d, 0x00, 0x62, 0x5d, 0x00, 0x62,
+  0x6d, 0x00, 0x62, 0xb1, 0x00, 0x62, 0xbf, 0x00, 0x63, 0x04, 0x00, 0x3c,
+  0x9a, 0x0d, 0x2d, 0x75, 0x6a, 0x64, 0x61, 0x65, 0x68, 0x61, 0x6c, 0x2d,
+  0x2d, 0x6e, 0x78, 0x80, 0x00, 0x0d, 0x2d, 0x61, 0x6e, 0x74, 0x6f, 0x75,
+  0x76, 0x69, 0x67, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x01, 0x2d, 0x00,
+  0x04, 0x64, 0x67, 0x6b, 0x72, 0x00, 0x62, 0x81, 0x00, 0x62, 0x8d, 0x00,
+  0x62, 0x99, 0x00, 0x62, 0xa5, 0x09, 0x6c, 0x6f, 0x66, 0x72, 0x73, 0x2d,
+  0x2d, 0x6e, 0x78, 0x80, 0x00, 0x09, 0x6f, 0x6b, 0x73, 0x6d, 0x72, 0x2d,
+  0x2d, 0x6e, 0x78, 0x80, 0x00, 0x09, 0x69, 0x76, 0x72, 0x79, 0x72, 0x2d,
+  0x2d, 0x6e, 0x78, 0x80, 0x00, 0x09, 0x65, 0x74, 0x73, 0x6c, 0x6a, 0x2d,
+  0x2d, 0x6e, 0x78, 0x80, 0x00, 0x0b, 0x2d, 0x6e, 0x65, 0x6a, 0x73, 0x6f,
+  0x6d, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x02, 0x2d, 0x79, 0x00, 0x03,
+  0x6b, 0x72, 0x73, 0x00, 0x62, 0xd0, 0x00, 0x62, 0xdb, 0x00, 0x62, 0xf9,
+  0x08, 0x72, 0x61, 0x6a, 0x62, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x01,
+  0x65, 0x00, 0x02, 0x64, 0x74, 0x00, 0x62, 0xe7, 0x00, 0x62, 0xf0, 0x06,
+  0x6e, 0x69, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x06, 0x73, 0x6f, 0x2d,
+  0x2d, 0x6e, 0x78, 0x80, 0x00, 0x08, 0x74, 0x69, 0x76, 0x6b, 0x2d, 0x2d,
+  0x6e, 0x78, 0x80, 0x00, 0x0b, 0x2d, 0x72, 0x65, 0x67, 0x61, 0x72, 0x6b,
+  0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x0e, 0x39, 0x2d, 0x64, 0x72, 0x6f,
+  0x6a, 0x66, 0x73, 0x74, 0x62, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x00,
+  0x40, 0x32, 0x40, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x06,
+  0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x08, 0x00, 0x63, 0x7f, 0x00, 0x63,
+  0x92, 0x00, 0x63, 0xa6, 0x00, 0x63, 0xdb, 0x00, 0x64, 0x0a, 0x00, 0x64,
+  0x3b, 0x00, 0x64, 0x50, 0x00, 0x64, 0x66, 0x10, 0x35, 0x2d, 0x61, 0x6b,
+  0x69, 0x69, 0x76, 0x61, 0x67, 0x61, 0x65, 0x6c, 0x2d, 0x2d, 0x6e, 0x78,
+  0x80, 0x00, 0x11, 0x33, 0x61, 0x79, 0x37, 0x2d, 0x6f, 0x6c, 0x6f, 0x75,
+  0x73, 0x65, 0x63, 0x68, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x00, 0x00,
+  0x03, 0x69, 0x6c, 0x6e, 0x00, 0x63, 0xb5, 0x00, 0x63, 0xc0, 0x00, 0x63,
+  0xcf, 0x08, 0x79, 0x2d, 0x67, 0x76, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00,
+  0x04, 0x65, 0x2d, 0x74, 0x6c, 0x00, 0x02, 0x62, 0x73, 0x00, 0x59, 0x95,
+  0x00, 0x59, 0x95, 0x09, 0x30, 0x2d, 0x79, 0x64, 0x72, 0x2d, 0x2d, 0x6e,
+  0x78, 0x80, 0x00, 0x00, 0x00, 0x02, 0x30, 0x7a, 0x00, 0x63, 0xe6, 0x00,
+  0x63, 0xf8, 0x0f, 0x2d, 0x64, 0x6e, 0x61, 0x6c, 0x2d, 0x65, 0x72, 0x64,
+  0x6e, 0x73, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x0f, 0x2d, 0x6e, 0x65,
+  0x74, 0x6f, 0x74, 0x2d, 0x65, 0x72, 0x74, 0x73, 0x2d, 0x2d, 0x6e, 0x78,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x67, 0x6f, 0x00, 0x64, 0x15, 0x00, 0x64,
+  0x28, 0x10, 0x2d, 0x72, 0x65, 0x67, 0x6e, 0x61, 0x72, 0x61, 0x76, 0x2d,
+  0x72, 0x73, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x10, 0x2d, 0x6e, 0x65,
+  0x6a, 0x73, 0x73, 0x65, 0x6e, 0x64, 0x6e, 0x61, 0x73, 0x2d, 0x2d, 0x6e,
+  0x78, 0x80, 0x00, 0x12, 0x75, 0x2d, 0x65, 0x72, 0x64, 0x69, 0x6c, 0x73,
+  0x2d, 0x65, 0x72, 0x74, 0x73, 0x79, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00,
+  0x13, 0x6a, 0x2d, 0x64, 0x6e, 0x61, 0x6c, 0x68, 0x2d, 0x67, 0x6f, 0x6b,
+  0x73, 0x72, 0x75, 0x61, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x00, 0x00,
+  0x02, 0x71, 0x73, 0x00, 0x64, 0x71, 0x00, 0x64, 0xa5, 0x14, 0x2d, 0x6c,
+  0x61, 0x64, 0x73, 0x6d, 0x6f, 0x72, 0x2d, 0x67, 0x6f, 0x2d, 0x65, 0x72,
+  0x6d, 0x2d, 0x2d, 0x6e, 0x78, 0x2e, 0x00, 0x02, 0x61, 0x65, 0x00, 0x64,
+  0x90, 0x00, 0x64, 0x9e, 0x0b, 0x72, 0x69, 0x2d, 0x79, 0x72, 0x65, 0x68,
+  0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x04, 0x64, 0x6e, 0x61, 0x73, 0x80,
+  0x00, 0x13, 0x2d, 0x6e, 0x65, 0x73, 0x6c, 0x61, 0x68, 0x73, 0x6c, 0x61,
+  0x64, 0x72, 0x6a, 0x74, 0x73, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x01,
+  0x61, 0x00, 0x07, 0x34, 0x38, 0x69, 0x6c, 0x6e, 0x6f, 0x75, 0x00, 0x64,
+  0xdb, 0x00, 0x64, 0xee, 0x00, 0x65, 0x00, 0x00, 0x65, 0x0b, 0x00, 0x65,
+  0x17, 0x00, 0x65, 0x24, 0x00, 0x65, 0x31, 0x10, 0x73, 0x2d, 0x61, 0x74,
+  0x73, 0x61, 0x65, 0x66, 0x72, 0x6d, 0x6d, 0x68, 0x2d, 0x2d, 0x6e, 0x78,
+  0x80, 0x00, 0x0f, 0x6d, 0x2d, 0x64, 0x6e, 0x75, 0x73, 0x79, 0x6e, 0x6e,
+  0x72, 0x62, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x08, 0x6c, 0x2d, 0x74,
+  0x6c, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x09, 0x65, 0x2d, 0x73, 0x6c,
+  0x67, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x0a, 0x35, 0x2d, 0x72, 0x64,
+  0x69, 0x62, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x0a, 0x70, 0x2d, 0x64,
+  0x72, 0x67, 0x6c, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x0b, 0x77, 0x2d,
+  0x79, 0x6e, 0x6e, 0x72, 0x62, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x00,
+  0x00, 0x07, 0x61, 0x62, 0x69, 0x6c, 0x6e, 0x72, 0x75, 0x00, 0x65, 0x5e,
+  0x00, 0x66, 0x1d, 0x00, 0x66, 0x2d, 0x00, 0x66, 0x58, 0x00, 0x66, 0x84,
+  0x00, 0x68, 0x88, 0x00, 0x69, 0x3e, 0x00, 0x00, 0x03, 0x71, 0x72, 0x74,
+  0x00, 0x65, 0x6d, 0x00, 0x65, 0x7b, 0x00, 0x65, 0x9a, 0x0b, 0x78, 0x2d,
+  0x74, 0x67, 0x67, 0x72, 0x76, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x02,
+  0x65, 0x68, 0x80, 0x03, 0x6e, 0x73, 0x75, 0x00, 0x65, 0x8c, 0x00, 0x65,
+  0x93, 0x00, 0x22, 0x90, 0x04, 0x6e, 0x69, 0x76, 0x6b, 0x80, 0x00, 0x04,
+  0x64, 0x6f, 0x72, 0x6b, 0x80, 0x00, 0x01, 0x73, 0x00, 0x07, 0x65, 0x67,
+  0x6b, 0x6c, 0x6d, 0x6f, 0x72, 0x00, 0x65, 0xba, 0x00, 0x65, 0xdf, 0x00,
+  0x65, 0xe5, 0x00, 0x65, 0xf8, 0x00, 0x65, 0xff, 0x00, 0x66, 0x05, 0x00,
+  0x66, 0x0d, 0x00, 0x00, 0x04, 0x62, 0x6b, 0x6c, 0x6e, 0x00, 0x02, 0x83,
+  0x00, 0x65, 0xcd, 0x00, 0x65, 0xd3, 0x00, 0x65, 0xd9, 0x03, 0x6b, 0x61,
+  0x72, 0x80, 0x00, 0x03, 0x6c, 0x79, 0x68, 0x80, 0x00, 0x03, 0x6e, 0x61,
+  0x6e, 0x80, 0x00, 0x03, 0x6f, 0x72, 0x74, 0x80, 0x00, 0x00, 0x00, 0x02,
+  0x61, 0x69, 0x00, 0x5e, 0xc5, 0x00, 0x65, 0xf0, 0x05, 0x72, 0x64, 0x65,
+  0x72, 0x66, 0x80, 0x00, 0x04, 0x65, 0x76, 0x65, 0x76, 0x80, 0x00, 0x03,
+  0x69, 0x72, 0x67, 0x80, 0x00, 0x05, 0x62, 0x65, 0x67, 0x61, 0x68, 0x80,
+  0x00, 0x00, 0x00, 0x02, 0x61, 0x65, 0x00, 0x3d, 0x0a, 0x00, 0x66, 0x18,
+  0x02, 0x6a, 0x67, 0x80, 0x00, 0x0d, 0x61, 0x72, 0x6d, 0x2d, 0x6a, 0x64,
+  0x64, 0x64, 0x62, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x01, 0x65, 0x80,
+  0x02, 0x72, 0x73, 0x00, 0x66, 0x39, 0x00, 0x66, 0x3e, 0x02, 0x61, 0x68,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x65, 0x6c, 0x00, 0x66, 0x49, 0x00, 0x66,
+  0x50, 0x04, 0x74, 0x69, 0x76, 0x6b, 0x80, 0x00, 0x05, 0x61, 0x64, 0x6d,
+  0x61, 0x6e, 0x80, 0x00, 0x02, 0x6f, 0x66, 0x00, 0x02, 0x72, 0x74, 0x00,
+  0x1c, 0x25, 0x00, 0x66, 0x65, 0x01, 0x73, 0x00, 0x02, 0x65, 0x6f, 0x00,
+  0x66, 0x71, 0x00, 0x66, 0x7b, 0x07, 0x76, 0x2e, 0x65, 0x64, 0x6e, 0x61,
+  0x73, 0x80, 0x00, 0x06, 0x2e, 0x72, 0x65, 0x6c, 0x61, 0x76, 0x80, 0x00,
+  0x00, 0x00, 0x02, 0x61, 0x75, 0x00, 0x66, 0x8f, 0x00, 0x67, 0xf1, 0x00,
+  0x00, 0x03, 0x6c, 0x72, 0x73, 0x00, 0x66, 0x9e, 0x00, 0x67, 0xad, 0x00,
+  0x67, 0xd1, 0x00, 0x40, 0x2d, 0x48, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x00, 0x03, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+  0x07, 0x00, 0x00, 0x08, 0x00, 0x09, 0x00, 0x67, 0x05, 0x00, 0x67, 0x18,
+  0x00, 0x67, 0x22, 0x00, 0x67, 0x5e, 0x00, 0x23, 0x3a, 0x00, 0x67, 0x80,
+  0x00, 0x67, 0x86, 0x00, 0x67, 0x9c, 0x00, 0x67, 0xa7, 0x03, 0x65, 0x72,
+  0x64, 0x00, 0x02, 0x6e, 0x72, 0x00, 0x1c, 0x25, 0x00, 0x67, 0x13, 0x02,
+  0x6f, 0x6e, 0x80, 0x00, 0x07, 0x64, 0x72, 0x6f, 0x68, 0x2e, 0x73, 0x6f,
+  0x80, 0x00, 0x04, 0x72, 0x6f, 0x6e, 0x2e, 0x00, 0x03, 0x61, 0x6f, 0x79,
+  0x00, 0x67, 0x35, 0x00, 0x1e, 0x64, 0x00, 0x67, 0x57, 0x00, 0x00, 0x02,
+  0x67, 0x72, 0x00, 0x67, 0x40, 0x00, 0x67, 0x4a, 0x07, 0x35, 0x2d, 0x62,
+  0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x0a, 0x69, 0x2d, 0x79, 0x72, 0x65,
+  0x68, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x04, 0x6f, 0x72, 0x65, 0x68,
+  0x80, 0x00, 0x00, 0x00, 0x03, 0x6d, 0x70, 0x76, 0x00, 0x67, 0x6d, 0x00,
+  0x67, 0x7a, 0x00, 0x02, 0x83, 0x00, 0x80, 0x01, 0x6c, 0x00, 0x67, 0x74,
+  0x03, 0x65, 0x6a, 0x68, 0x80, 0x00, 0x03, 0x72, 0x6f, 0x6a, 0x80, 0x00,
+  0x03, 0x61, 0x6b, 0x73, 0x80, 0x00, 0x00, 0x00, 0x02, 0x68, 0x72, 0x00,
+  0x67, 0x91, 0x00, 0x1c, 0xc3, 0x08, 0x2d, 0x67, 0x6f, 0x6b, 0x73, 0x72,
+  0x75, 0x61, 0x80, 0x00, 0x00, 0x00, 0x02, 0x6f, 0x75, 0x00, 0x01, 0xed,
+  0x00, 0x02, 0xa9, 0x03, 0x72, 0x6f, 0x73, 0x80, 0x00, 0x02, 0x74, 0x73,
+  0x80, 0x01, 0x65, 0x00, 0x67, 0xb6, 0x00, 0x00, 0x03, 0x64, 0x6c, 0x6d,
+  0x00, 0x67, 0xc5, 0x00, 0x1f, 0xfd, 0x00, 0x67, 0xcb, 0x03, 0x65, 0x76,
+  0x74, 0x80, 0x00, 0x03, 0x6c, 0x6f, 0x68, 0x80, 0x00, 0x00, 0x00, 0x03,
+  0x65, 0x6e, 0x72, 0x00, 0x67, 0xe0, 0x00, 0x67, 0xe7, 0x00, 0x39, 0x4e,
+  0x04, 0x6c, 0x6c, 0x69, 0x6c, 0x80, 0x00, 0x07, 0x61, 0x69, 0x74, 0x73,
+  0x69, 0x72, 0x6b, 0x80, 0x00, 0x00, 0x00, 0x02, 0x6c, 0x73, 0x00, 0x67,
+  0xfc, 0x00, 0x68, 0x03, 0x00, 0x80, 0x01, 0x6f, 0x00, 0x03, 0x8e, 0x00,
+  0xc0, 0x64, 0x16, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04,
+  0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x68, 0x35, 0x00, 0x68, 0x46, 0x00, 0x68, 0x57, 0x00, 0x68,
+  0x5d, 0x00, 0x67, 0xe7, 0x00, 0x68, 0x63, 0x00, 0x68, 0x7a, 0x00, 0x68,
+  0x7f, 0x00, 0x00, 0x02, 0x69, 0x6c, 0x00, 0x03, 0x40, 0x00, 0x68, 0x40,
+  0x03, 0x65, 0x6a, 0x74, 0x80, 0x00, 0x00, 0x00, 0x02, 0x67, 0x6c, 0x00,
+  0x68, 0x51, 0x00, 0x02, 0xa9, 0x03, 0x75, 0x61, 0x68, 0x80, 0x00, 0x03,
+  0x6b, 0x6f, 0x68, 0x80, 0x00, 0x03, 0x61, 0x76, 0x6b, 0x80, 0x00, 0x00,
+  0x00, 0x02, 0x61, 0x65, 0x00, 0x1c, 0xc3, 0x00, 0x68, 0x6e, 0x01, 0x67,
+  0x00, 0x02, 0x65, 0x69, 0x00, 0x01, 0xed, 0x00, 0x22, 0x81, 0x02, 0x65,
+  0x66, 0x80, 0x00, 0x06, 0x6f, 0x6e, 0x6e, 0x6f, 0x72, 0x62, 0x80, 0x00,
+  0x00, 0x00, 0x02, 0x61, 0x6f, 0x00, 0x68, 0x93, 0x00, 0x68, 0xba, 0x00,
+  0x00, 0x02, 0x62, 0x67, 0x00, 0x68, 0x9e, 0x00, 0x68, 0xa9, 0x04, 0x6c,
+  0x61, 0x76, 0x73, 0x80, 0x01, 0x2e, 0x00, 0x59, 0x36, 0x00, 0x00, 0x02,
+  0x65, 0x6c, 0x00, 0x68, 0xb4, 0x00, 0x02, 0xa9, 0x03, 0x70, 0x70, 0x6f,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x6a, 0x74, 0x00, 0x68, 0xc5, 0x00, 0x03,
+  0x8e, 0x00, 0x00, 0x02, 0x66, 0x6c, 0x00, 0x68, 0xd0, 0x00, 0x06, 0x56,
+  0x00, 0x00, 0x06, 0x61, 0x64, 0x65, 0x6c, 0x72, 0x73, 0x00, 0x68, 0xeb,
+  0x00, 0x69, 0x00, 0x00, 0x69, 0x05, 0x00, 0x69, 0x1d, 0x00, 0x69, 0x24,
+  0x00, 0x69, 0x2f, 0x00, 0x80, 0x03, 0x64, 0x6b, 0x76, 0x00, 0x68, 0xfa,
+  0x00, 0x01, 0xed, 0x00, 0x05, 0x9d, 0x03, 0x6e, 0x69, 0x76, 0x80, 0x00,
+  0x02, 0x69, 0x65, 0x80, 0x00, 0x00, 0x00, 0x02, 0x64, 0x6b, 0x00, 0x69,
+  0x10, 0x00, 0x69, 0x16, 0x03, 0x6e, 0x61, 0x73, 0x80, 0x00, 0x04, 0x6b,
+  0x65, 0x6c, 0x66, 0x80, 0x00, 0x04, 0x6c, 0x69, 0x6e, 0x73, 0x80, 0x00,
+  0x00, 0x00, 0x02, 0x69, 0x6f, 0x00, 0x1f, 0x1f, 0x00, 0x3c, 0xc9, 0x00,
+  0x00, 0x03, 0x6c, 0x74, 0x79, 0x00, 0x1f, 0xfd, 0x00, 0x1f, 0xfd, 0x00,
+  0x03, 0x3c, 0x0a, 0x72, 0x65, 0x6b, 0x73, 0x75, 0x62, 0x2e, 0x73, 0x65,
+  0x6e, 0x80, 0x00, 0x00, 0x40, 0x61, 0x15, 0x01, 0x00, 0x00, 0x02, 0x00,
+  0x00, 0x03, 0x00, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x00, 0x00, 0x00,
+  0x0a, 0x0b, 0x0c, 0x0d, 0x00, 0x69, 0x8b, 0x00, 0x69, 0x9b, 0x00, 0x69,
+  0xaa, 0x00, 0x69, 0xba, 0x00, 0x69, 0xeb, 0x00, 0x6a, 0x01, 0x00, 0x6a,
+  0x45, 0x00, 0x6a, 0x71, 0x00, 0x6a, 0x81, 0x00, 0x6a, 0xb2, 0x00, 0x6a,
+  0xd4, 0x00, 0x6a, 0xdb, 0x00, 0x1c, 0x36, 0x0d, 0x79, 0x62, 0x2d, 0x79,
+  0x72, 0x65, 0x74, 0x74, 0x6e, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x00,
+  0x00, 0x03, 0x61, 0x6c, 0x72, 0x00, 0x01, 0x8b, 0x00, 0x45, 0x69, 0x00,
+  0x39, 0x4e, 0x00, 0x00, 0x02, 0x67, 0x6e, 0x00, 0x69, 0xb5, 0x00, 0x4b,
+  0x6d, 0x02, 0x79, 0x72, 0x80, 0x00, 0x00, 0x00, 0x02, 0x6d, 0x72, 0x00,
+  0x69, 0xc5, 0x00, 0x69, 0xe5, 0x03, 0x65, 0x75, 0x76, 0x00, 0x02, 0x65,
+  0x73, 0x00, 0x69, 0xd3, 0x00, 0x69, 0xdd, 0x07, 0x6a, 0x73, 0x65, 0x6d,
+  0x61, 0x61, 0x6e, 0x80, 0x00, 0x05, 0x65, 0x6b, 0x61, 0x61, 0x6c, 0x80,
+  0x00, 0x03, 0x6a, 0x65, 0x61, 0x80, 0x00, 0x00, 0x00, 0x02, 0x64, 0x6c,
+  0x00, 0x69, 0xf6, 0x00, 0x06, 0x56, 0x00, 0x00, 0x02, 0x65, 0x6f, 0x00,
+  0x1c, 0xc3, 0x00, 0x3a, 0x3c, 0x00, 0x00, 0x05, 0x65, 0x68, 0x69, 0x6b,
+  0x73, 0x00, 0x6a, 0x18, 0x00, 0x6a, 0x1f, 0x00, 0x6a, 0x28, 0x00, 0x6a,
+  0x31, 0x00, 0x6a, 0x3a, 0x04, 0x72, 0x61, 0x6f, 0x6d, 0x80, 0x00, 0x06,
+  0x67, 0x6e, 0x61, 0x61, 0x72, 0x6b, 0x80, 0x00, 0x06, 0x72, 0x65, 0x67,
+  0x6e, 0x69, 0x72, 0x80, 0x00, 0x02, 0x6f, 0x74, 0x80, 0x01, 0x73, 0x00,
+  0x01, 0xed, 0x00, 0x00, 0x02, 0x69, 0x75, 0x00, 0x0b, 0xb4, 0x00, 0x41,
+  0x2d, 0x00, 0x00, 0x04, 0x62, 0x6b, 0x6c, 0x6f, 0x00, 0x6a, 0x58, 0x00,
+  0x23, 0x3a, 0x00, 0x6a, 0x5e, 0x00, 0x3d, 0x0a, 0x03, 0x6d, 0x61, 0x62,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x65, 0x00, 0x59, 0xcd, 0x00, 0x6a,
+  0x69, 0x05, 0x68, 0x74, 0x61, 0x74, 0x73, 0x80, 0x00, 0x00, 0x00, 0x02,
+  0x69, 0x6f, 0x00, 0x03, 0x3c, 0x00, 0x6a, 0x7c, 0x02, 0x6a, 0x74, 0x80,
+  0x00, 0x00, 0x00, 0x07, 0x61, 0x67, 0x6d, 0x72, 0x74, 0x75, 0x79, 0x00,
+  0x1c, 0x36, 0x00, 0x1c, 0x25, 0x00, 0x6a, 0xa0, 0x00, 0x6a, 0xa5, 0x00,
+  0x22, 0x81, 0x00, 0x6a, 0xab, 0x00, 0x0f, 0x28, 0x02, 0x65, 0x68, 0x80,
+  0x00, 0x03, 0x65, 0x69, 0x6c, 0x80, 0x00, 0x04, 0x6d, 0x6d, 0x6f, 0x6b,
+  0x80, 0x00, 0x00, 0x00, 0x03, 0x64, 0x75, 0x76, 0x00, 0x6a, 0xc1, 0x00,
+  0x02, 0xa9, 0x00, 0x49, 0xf6, 0x08, 0x69, 0x6c, 0x73, 0x2d, 0x65, 0x72,
+  0x74, 0x73, 0x00, 0x02, 0x65, 0x79, 0x00, 0x59, 0xcd, 0x00, 0x02, 0x12,
+  0x04, 0x61, 0x61, 0x6e, 0x73, 0x80, 0x00, 0x00, 0x00, 0x02, 0x72, 0x73,
+  0x00, 0x6a, 0xe6, 0x00, 0x6a, 0xee, 0x05, 0x6f, 0x62, 0x72, 0x61, 0x61,
+  0x80, 0x00, 0x04, 0x70, 0x61, 0x61, 0x76, 0x80, 0x00, 0x00, 0x00, 0x05,
+  0x36, 0x61, 0x6f, 0x73, 0x76, 0x00, 0x6b, 0x0c, 0x00, 0x6b, 0x1e, 0x00,
+  0x6b, 0x4f, 0x00, 0x59, 0x2f, 0x00, 0x59, 0x2f, 0x0f, 0x32, 0x61, 0x74,
+  0x73, 0x2d, 0x75, 0x67, 0x73, 0x72, 0x6f, 0x70, 0x2d, 0x2d, 0x6e, 0x78,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x31, 0x37, 0x00, 0x6b, 0x29, 0x00, 0x6b,
+  0x3b, 0x0f, 0x30, 0x2d, 0x75, 0x6a, 0x76, 0x72, 0x65, 0x6b, 0x6b, 0x68,
+  0x72, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x11, 0x6b, 0x2d, 0x74, 0x61,
+  0x6a, 0x6a, 0x72, 0x76, 0x2d, 0x61, 0x74, 0x74, 0x6d, 0x2d, 0x2d, 0x6e,
+  0x78, 0x80, 0x00, 0x00, 0x80, 0x02, 0x2e, 0x68, 0x00, 0x59, 0x36, 0x00,
+  0x01, 0xed, 0x00, 0x00, 0x06, 0x35, 0x61, 0x6e, 0x6f, 0x72, 0x75, 0x00,
+  0x6b, 0x75, 0x00, 0x6b, 0x86, 0x00, 0x6b, 0xa3, 0x00, 0x6b, 0xbe, 0x00,
+  0x6b, 0xdf, 0x00, 0x6c, 0x2a, 0x06, 0x61, 0x6c, 0x79, 0x2d, 0x79, 0x72,
+  0x00, 0x02, 0x6e, 0x76, 0x00, 0x59, 0x95, 0x00, 0x59, 0x95, 0x00, 0x00,
+  0x02, 0x6c, 0x76, 0x00, 0x6b, 0x91, 0x00, 0x6b, 0x97, 0x03, 0x6c, 0x6f,
+  0x72, 0x80, 0x00, 0x01, 0x65, 0x00, 0x02, 0x67, 0x6c, 0x00, 0x48, 0xb5,
+  0x00, 0x43, 0x47, 0x00, 0x00, 0x02, 0x61, 0x6f, 0x00, 0x6b, 0xae, 0x00,
+  0x1c, 0x36, 0x01, 0x76, 0x80, 0x01, 0x73, 0x00, 0x6b, 0xb6, 0x05, 0x6e,
+  0x65, 0x6c, 0x6c, 0x75, 0x80, 0x00, 0x02, 0x6b, 0x73, 0x00, 0x04, 0x64,
+  0x6d, 0x6e, 0x72, 0x00, 0x69, 0x00, 0x00, 0x6b, 0xd3, 0x00, 0x6b, 0xd8,
+  0x00, 0x02, 0x12, 0x02, 0x6f, 0x72, 0x80, 0x00, 0x04, 0x65, 0x72, 0x6f,
+  0x6c, 0x80, 0x00, 0x00, 0x00, 0x02, 0x65, 0x6f, 0x00, 0x6b, 0xea, 0x00,
+  0x6c, 0x21, 0x01, 0x62, 0x80, 0x03, 0x61, 0x65, 0x73, 0x00, 0x6b, 0xfa,
+  0x00, 0x6c, 0x01, 0x00, 0x6c, 0x08, 0x04, 0x64, 0x6e, 0x61, 0x72, 0x80,
+  0x00, 0x04, 0x64, 0x79, 0x70, 0x73, 0x80, 0x00, 0x00, 0x00, 0x04, 0x64,
+  0x65, 0x67, 0x6e, 0x00, 0x69, 0x00, 0x00, 0x5e, 0xc5, 0x00, 0x6c, 0x1b,
+  0x00, 0x3d, 0xa3, 0x03, 0x6e, 0x6f, 0x6b, 0x80, 0x00, 0x06, 0x62, 0x73,
+  0x70, 0x72, 0x61, 0x73, 0x80, 0x00, 0x07, 0x61, 0x68, 0x61, 0x74, 0x73,
+  0x6c, 0x61, 0x80, 0x00, 0x00, 0x00, 0x03, 0x30, 0x37, 0x61, 0x00, 0x6c,
+  0x43, 0x00, 0x6c, 0x51, 0x00, 0x59, 0x2f, 0x0b, 0x61, 0x6c, 0x75, 0x2d,
+  0x79, 0x73, 0x6d, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x00, 0x00, 0x02,
+  0x34, 0x35, 0x00, 0x6c, 0x5c, 0x00, 0x6c, 0x6f, 0x10, 0x61, 0x79, 0x38,
+  0x2d, 0x61, 0x6b, 0x69, 0x69, 0x76, 0x61, 0x67, 0x67, 0x2d, 0x2d, 0x6e,
+  0x78, 0x80, 0x00, 0x10, 0x61, 0x79, 0x37, 0x2d, 0x61, 0x74, 0x6b, 0x6f,
+  0x75, 0x6c, 0x6f, 0x6b, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x00, 0x00,
+  0x07, 0x65, 0x6b, 0x6c, 0x6d, 0x70, 0x72, 0x73, 0x00, 0x6c, 0xa1, 0x00,
+  0x6c, 0xb5, 0x00, 0x6c, 0xcb, 0x00, 0x6c, 0xd0, 0x00, 0x6c, 0xdc, 0x00,
+  0x6c, 0xe3, 0x00, 0x6c, 0xf1, 0x00, 0x00, 0x02, 0x68, 0x72, 0x00, 0x6c,
+  0xac, 0x00, 0x1c, 0xc3, 0x06, 0x73, 0x72, 0x61, 0x67, 0x65, 0x76, 0x80,
+  0x00, 0x00, 0x00, 0x02, 0x68, 0x73, 0x00, 0x6c, 0xc0, 0x00, 0x01, 0xed,
+  0x08, 0x61, 0x76, 0x6c, 0x61, 0x72, 0x61, 0x65, 0x62, 0x80, 0x00, 0x02,
+  0x6d, 0x61, 0x80, 0x00, 0x09, 0x70, 0x6f, 0x75, 0x76, 0x74, 0x61, 0x6c,
+  0x61, 0x6d, 0x80, 0x00, 0x04, 0x70, 0x68, 0x61, 0x6c, 0x80, 0x00, 0x0b,
+  0x72, 0x6f, 0x75, 0x6e, 0x61, 0x64, 0x64, 0x6c, 0x65, 0x69, 0x64, 0x80,
+  0x00, 0x06, 0x73, 0x61, 0x6e, 0x65, 0x76, 0x65, 0x80, 0x00, 0x00, 0x00,
+  0x02, 0x30, 0x39, 0x00, 0x6d, 0x05, 0x00, 0x6d, 0x14, 0x0c, 0x61, 0x6f,
+  0x71, 0x2d, 0x79, 0x73, 0x67, 0x76, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00,
+  0x11, 0x34, 0x62, 0x61, 0x77, 0x68, 0x2d, 0x61, 0x6b, 0x68, 0x6f, 0x6a,
+  0x72, 0x6b, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x00, 0x00, 0x05, 0x61,
+  0x69, 0x6b, 0x6f, 0x72, 0x00, 0x6d, 0x3f, 0x00, 0x6d, 0x5b, 0x00, 0x6d,
+  0xcb, 0x00, 0x6d, 0xd3, 0x00, 0x6d, 0xdc, 0x00, 0x00, 0x03, 0x62, 0x6a,
+  0x6c, 0x00, 0x6d, 0x4e, 0x00, 0x3a, 0x3c, 0x00, 0x6d, 0x54, 0x03, 0x6f,
+  0x72, 0x64, 0x80, 0x00, 0x04, 0x6c, 0x65, 0x69, 0x73, 0x80, 0x00, 0x01,
+  0x76, 0x80, 0x07, 0x61, 0x6c, 0x6d, 0x6e, 0x6f, 0x72, 0x73, 0x00, 0x6d,
+  0x7b, 0x00, 0x6d, 0x84, 0x00, 0x5b, 0xc2, 0x00, 0x1f, 0x1f, 0x00, 0x66,
+  0x18, 0x00, 0x6d, 0x98, 0x00, 0x6d, 0xbc, 0x06, 0x6b, 0x6c, 0x65, 0x6a,
+  0x70, 0x73, 0x80, 0x00, 0x00, 0x00, 0x03, 0x61, 0x65, 0x75, 0x00, 0x03,
+  0x40, 0x00, 0x6d, 0x93, 0x00, 0x01, 0xed, 0x02, 0x76, 0x73, 0x80, 0x00,
+  0x00, 0x00, 0x04, 0x61, 0x65, 0x69, 0x79, 0x00, 0x6d, 0xab, 0x00, 0x6d,
+  0xb6, 0x00, 0x1f, 0x1f, 0x00, 0x6b, 0xd3, 0x00, 0x00, 0x02, 0x6c, 0x6e,
+  0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x03, 0x70, 0x6f, 0x6b, 0x80, 0x00,
+  0x00, 0x00, 0x03, 0x61, 0x6b, 0x6f, 0x00, 0x3d, 0x0a, 0x00, 0x1f, 0x1f,
+  0x00, 0x03, 0x40, 0x05, 0x61, 0x62, 0x65, 0x6e, 0x65, 0x80, 0x00, 0x06,
+  0x6a, 0x73, 0x61, 0x72, 0x61, 0x6b, 0x80, 0x00, 0x02, 0x61, 0x6d, 0x00,
+  0x02, 0x64, 0x65, 0x00, 0x6d, 0xe9, 0x00, 0x6e, 0x10, 0x03, 0x65, 0x68,
+  0x2e, 0x00, 0x03, 0x61, 0x72, 0x73, 0x00, 0x6d, 0xfb, 0x00, 0x6e, 0x09,
+  0x00, 0x02, 0x12, 0x0b, 0x6f, 0x71, 0x2d, 0x72, 0x65, 0x6c, 0x76, 0x2d,
+  0x2d, 0x6e, 0x78, 0x80, 0x00, 0x04, 0x65, 0x6c, 0x61, 0x76, 0x80, 0x00,
+  0x00, 0x00, 0x02, 0x6c, 0x72, 0x00, 0x6e, 0x1b, 0x00, 0x02, 0xa9, 0x03,
+  0x65, 0x74, 0x2e, 0x00, 0x02, 0x61, 0x6f, 0x00, 0x6e, 0x29, 0x00, 0x1e,
+  0x64, 0x08, 0x67, 0x35, 0x2d, 0x62, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00,
+  0x00, 0x40, 0x61, 0x12, 0x01, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x04,
+  0x05, 0x00, 0x00, 0x06, 0x00, 0x07, 0x08, 0x00, 0x00, 0x09, 0x00, 0x6e,
+  0x65, 0x00, 0x70, 0x75, 0x00, 0x70, 0x91, 0x00, 0x59, 0x2f, 0x00, 0x70,
+  0x99, 0x00, 0x70, 0xaa, 0x00, 0x59, 0x2f, 0x00, 0x70, 0xe1, 0x00, 0x59,
+  0x2f, 0x00, 0x80, 0x03, 0x64, 0x6b, 0x72, 0x00, 0x6e, 0x74, 0x00, 0x70,
+  0x66, 0x00, 0x70, 0x6f, 0x00, 0x40, 0x61, 0x19, 0x01, 0x00, 0x00, 0x02,
+  0x03, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x06, 0x00, 0x07, 0x08, 0x09,
+  0x00, 0x0a, 0x0b, 0x0c, 0x00, 0x0d, 0x00, 0x00, 0x0e, 0x00, 0x6e, 0xbb,
+  0x00, 0x6e, 0xc2, 0x00, 0x6e, 0xd5, 0x00, 0x6f, 0x0a, 0x00, 0x01, 0x72,
+  0x00, 0x6f, 0x1a, 0x00, 0x6f, 0x53, 0x00, 0x6f, 0x87, 0x00, 0x21, 0x9d,
+  0x00, 0x6f, 0x93, 0x00, 0x6f, 0xda, 0x00, 0x70, 0x22, 0x00, 0x70, 0x3d,
+  0x00, 0x03, 0x3c, 0x04, 0x6e, 0x72, 0x75, 0x73, 0x80, 0x00, 0x00, 0x00,
+  0x02, 0x6e, 0x72, 0x00, 0x6e, 0xcd, 0x00, 0x67, 0x13, 0x05, 0x75, 0x6d,
+  0x75, 0x72, 0x62, 0x80, 0x00, 0x00, 0x00, 0x04, 0x67, 0x6e, 0x73, 0x74,
+  0x00, 0x6e, 0xe8, 0x00, 0x6e, 0xef, 0x00, 0x6e, 0xf4, 0x00, 0x6f, 0x04,
+  0x04, 0x6e, 0x61, 0x72, 0x64, 0x80, 0x00, 0x02, 0x74, 0x65, 0x80, 0x00,
+  0x00, 0x00, 0x02, 0x6d, 0x73, 0x00, 0x6a, 0xa0, 0x00, 0x6e, 0xff, 0x02,
+  0x69, 0x6e, 0x80, 0x00, 0x03, 0x74, 0x69, 0x6e, 0x80, 0x00, 0x00, 0x00,
+  0x02, 0x69, 0x6e, 0x00, 0x03, 0x8e, 0x00, 0x6f, 0x15, 0x02, 0x79, 0x6c,
+  0x80, 0x00, 0x00, 0x00, 0x03, 0x65, 0x6c, 0x75, 0x00, 0x03, 0x40, 0x00,
+  0x6f, 0x29, 0x00, 0x6f, 0x3d, 0x00, 0x00, 0x02, 0x65, 0x6f, 0x00, 0x6f,
+  0x34, 0x00, 0x1c, 0xc3, 0x06, 0x6a, 0x66, 0x74, 0x74, 0x61, 0x68, 0x80,
+  0x00, 0x00, 0x00, 0x02, 0x61, 0x73, 0x00, 0x6f, 0x48, 0x00, 0x01, 0xed,
+  0x08, 0x67, 0x2d, 0x65, 0x72, 0x74, 0x64, 0x69, 0x6d, 0x80, 0x00, 0x00,
+  0x00, 0x07, 0x61, 0x65, 0x67, 0x69, 0x6b, 0x6e, 0x6f, 0x00, 0x03, 0x40,
+  0x00, 0x44, 0x3d, 0x00, 0x1c, 0x25, 0x00, 0x6f, 0x72, 0x00, 0x1c, 0x25,
+  0x00, 0x07, 0x87, 0x00, 0x3e, 0xd7, 0x00, 0x00, 0x03, 0x62, 0x6e, 0x72,
+  0x00, 0x01, 0xed, 0x00, 0x6f, 0x81, 0x00, 0x01, 0xed, 0x03, 0x72, 0x6f,
+  0x68, 0x80, 0x00, 0x01, 0x2d, 0x00, 0x02, 0x64, 0x72, 0x00, 0x5f, 0x38,
+  0x00, 0x1c, 0x25, 0x00, 0x00, 0x05, 0x61, 0x65, 0x69, 0x6f, 0x75, 0x00,
+  0x6f, 0xaa, 0x00, 0x6f, 0xb5, 0x00, 0x03, 0x8e, 0x00, 0x6f, 0xc4, 0x00,
+  0x6f, 0xcf, 0x00, 0x80, 0x02, 0x6c, 0x6e, 0x00, 0x01, 0xed, 0x00, 0x38,
+  0x30, 0x00, 0x00, 0x03, 0x67, 0x6c, 0x76, 0x00, 0x38, 0x12, 0x00, 0x01,
+  0xed, 0x00, 0x01, 0xed, 0x00, 0x00, 0x02, 0x6a, 0x74, 0x00, 0x3c, 0xc9,
+  0x00, 0x03, 0x8e, 0x00, 0x00, 0x02, 0x61, 0x68, 0x00, 0x6f, 0x87, 0x00,
+  0x01, 0xed, 0x00, 0x00, 0x04, 0x65, 0x6b, 0x6d, 0x75, 0x00, 0x6f, 0xed,
+  0x00, 0x70, 0x07, 0x00, 0x70, 0x0c, 0x00, 0x5b, 0xc2, 0x00, 0x00, 0x03,
+  0x6a, 0x6e, 0x72, 0x00, 0x0b, 0xb4, 0x00, 0x6f, 0xfc, 0x00, 0x70, 0x02,
+  0x03, 0x69, 0x76, 0x6b, 0x80, 0x00, 0x02, 0x79, 0x66, 0x80, 0x00, 0x02,
+  0x61, 0x76, 0x80, 0x00, 0x0b, 0x6f, 0x72, 0x2d, 0x67, 0x6f, 0x2d, 0x65,
+  0x72, 0x6f, 0x6d, 0x2e, 0x00, 0x02, 0x65, 0x79, 0x00, 0x64, 0x9e, 0x00,
+  0x67, 0x57, 0x00, 0x00, 0x03, 0x6c, 0x72, 0x73, 0x00, 0x22, 0x90, 0x00,
+  0x70, 0x31, 0x00, 0x70, 0x37, 0x03, 0x61, 0x6a, 0x68, 0x80, 0x00, 0x03,
+  0x75, 0x61, 0x6e, 0x80, 0x00, 0x00, 0x00, 0x02, 0x6c, 0x75, 0x00, 0x70,
+  0x48, 0x00, 0x70, 0x5b, 0x00, 0x00, 0x02, 0x61, 0x65, 0x00, 0x01, 0xed,
+  0x00, 0x70, 0x53, 0x05, 0x2d, 0x72, 0x6f, 0x74, 0x73, 0x80, 0x00, 0x08,
+  0x2d, 0x67, 0x6f, 0x2d, 0x65, 0x72, 0x6f, 0x6e, 0x80, 0x00, 0x06, 0x73,
+  0x65, 0x64, 0x6c, 0x69, 0x67, 0x80, 0x00, 0x03, 0x65, 0x73, 0x61, 0x80,
+  0x00, 0x02, 0x69, 0x62, 0x00, 0x02, 0x65, 0x73, 0x00, 0x70, 0x82, 0x00,
+  0x70, 0x89, 0x04, 0x6b, 0x6c, 0x6f, 0x66, 0x80, 0x00, 0x05, 0x65, 0x6b,
+  0x6c, 0x79, 0x66, 0x80, 0x00, 0x01, 0x73, 0x80, 0x01, 0x64, 0x00, 0x66,
+  0x39, 0x00, 0x00, 0x02, 0x6d, 0x73, 0x00, 0x01, 0xed, 0x00, 0x70, 0xa4,
+  0x03, 0x79, 0x72, 0x74, 0x80, 0x00, 0x00, 0x00, 0x02, 0x65, 0x6f, 0x00,
+  0x70, 0xb5, 0x00, 0x70, 0xba, 0x02, 0x6a, 0x66, 0x80, 0x00, 0x01, 0x76,
+  0x00, 0x04, 0x65, 0x67, 0x6b, 0x73, 0x00, 0x70, 0xce, 0x00, 0x70, 0xd5,
+  0x00, 0x02, 0x2e, 0x00, 0x70, 0xdb, 0x04, 0x74, 0x73, 0x75, 0x61, 0x80,
+  0x00, 0x03, 0x6e, 0x69, 0x74, 0x80, 0x00, 0x03, 0x64, 0x69, 0x65, 0x80,
+  0x00, 0x00, 0x80, 0x04, 0x2e, 0x62, 0x67, 0x68, 0x00, 0x59, 0x36, 0x00,
+  0x4e, 0xae, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x00, 0x07, 0x61,
+  0x66, 0x68, 0x69, 0x6f, 0x74, 0x75, 0x00, 0x71, 0x13, 0x00, 0x59, 0x2f,
+  0x00, 0x59, 0x2f, 0x00, 0x71, 0x1e, 0x00, 0x05, 0xfa, 0x00, 0x59, 0x2f,
+  0x00, 0x71, 0x58, 0x00, 0x00, 0x02, 0x72, 0x76, 0x00, 0x66, 0x39, 0x00,
+  0x05, 0x9d, 0x00, 0x00, 0x02, 0x65, 0x6b, 0x00, 0x71, 0x29, 0x00, 0x02,
+  0x2e, 0x00, 0x00, 0x02, 0x68, 0x72, 0x00, 0x71, 0x34, 0x00, 0x71, 0x50,
+  0x00, 0x00, 0x03, 0x64, 0x72, 0x73, 0x00, 0x71, 0x43, 0x00, 0x70, 0xce,
+  0x00, 0x71, 0x4a, 0x04, 0x6e, 0x6f, 0x72, 0x74, 0x80, 0x00, 0x03, 0x73,
+  0x65, 0x6a, 0x80, 0x00, 0x05, 0x6b, 0x72, 0x65, 0x6a, 0x62, 0x80, 0x00,
+  0x00, 0x00, 0x04, 0x64, 0x65, 0x72, 0x74, 0x00, 0x45, 0x69, 0x00, 0x4b,
+  0x7e, 0x00, 0x71, 0x6b, 0x00, 0x71, 0x8f, 0x00, 0x00, 0x05, 0x61, 0x64,
+  0x65, 0x6f, 0x75, 0x00, 0x1e, 0x64, 0x00, 0x71, 0x82, 0x00, 0x71, 0x89,
+  0x00, 0x03, 0x8e, 0x00, 0x3d, 0x0a, 0x04, 0x72, 0x65, 0x6a, 0x67, 0x80,
+  0x00, 0x03, 0x76, 0x6c, 0x65, 0x80, 0x00, 0x04, 0x74, 0x61, 0x6c, 0x73,
+  0x80, 0x00, 0x00, 0x40, 0x61, 0x19, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x03, 0x00, 0x04, 0x00, 0x05, 0x06, 0x07, 0x08, 0x09, 0x00, 0x00, 0x0a,
+  0x0b, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x71, 0xda, 0x00, 0x72,
+  0x17, 0x00, 0x73, 0xcf, 0x00, 0x73, 0xdf, 0x00, 0x45, 0x42, 0x00, 0x73,
+  0xf9, 0x00, 0x74, 0x03, 0x00, 0x74, 0x0c, 0x00, 0x74, 0x20, 0x00, 0x74,
+  0x2e, 0x00, 0x74, 0x46, 0x00, 0x67, 0x80, 0x00, 0x74, 0x4c, 0x00, 0x00,
+  0x04, 0x67, 0x6a, 0x6f, 0x72, 0x00, 0x71, 0xed, 0x00, 0x72, 0x01, 0x00,
+  0x01, 0x8b, 0x00, 0x72, 0x07, 0x00, 0x00, 0x02, 0x61, 0x6f, 0x00, 0x59,
+  0xcd, 0x00, 0x71, 0xf8, 0x06, 0x6b, 0x73, 0x73, 0x6d, 0x61, 0x6e, 0x80,
+  0x00, 0x03, 0x6c, 0x69, 0x73, 0x80, 0x00, 0x00, 0x00, 0x02, 0x67, 0x72,
+  0x00, 0x01, 0xed, 0x00, 0x72, 0x12, 0x02, 0x65, 0x76, 0x80, 0x00, 0x00,
+  0x40, 0x64, 0x16, 0x01, 0x00, 0x00, 0x02, 0x00, 0x03, 0x00, 0x04, 0x05,
+  0x06, 0x00, 0x07, 0x08, 0x00, 0x00, 0x09, 0x0a, 0x00, 0x0b, 0x00, 0x00,
+  0x0c, 0x00, 0x72, 0x55, 0x00, 0x72, 0x89, 0x00, 0x3a, 0x3c, 0x00, 0x73,
+  0x00, 0x00, 0x73, 0x11, 0x00, 0x73, 0x4c, 0x00, 0x73, 0x53, 0x00, 0x73,
+  0x69, 0x00, 0x73, 0x70, 0x00, 0x73, 0x89, 0x00, 0x73, 0xaf, 0x00, 0x73,
+  0xc2, 0x00, 0x00, 0x03, 0x64, 0x6c, 0x72, 0x00, 0x72, 0x64, 0x00, 0x66,
+  0x39, 0x00, 0x72, 0x70, 0x01, 0x6f, 0x00, 0x02, 0x73, 0x74, 0x00, 0x01,
+  0x8f, 0x00, 0x67, 0x13, 0x00, 0x00, 0x02, 0x61, 0x6f, 0x00, 0x72, 0x7b,
+  0x00, 0x72, 0x81, 0x03, 0x67, 0x79, 0x6f, 0x80, 0x00, 0x05, 0x6a, 0x66,
+  0x73, 0x61, 0x6d, 0x80, 0x00, 0x00, 0x00, 0x03, 0x69, 0x6e, 0x72, 0x00,
+  0x72, 0x98, 0x00, 0x72, 0x9e, 0x00, 0x72, 0xfb, 0x03, 0x65, 0x74, 0x73,
+  0x80, 0x00, 0x00, 0x00, 0x03, 0x61, 0x69, 0x79, 0x00, 0x72, 0xad, 0x00,
+  0x72, 0xf0, 0x00, 0x05, 0xfa, 0x00, 0x00, 0x04, 0x6c, 0x6e, 0x74, 0x76,
+  0x00, 0x72, 0xc0, 0x00, 0x68, 0x5d, 0x00, 0x72, 0xcb, 0x00, 0x72, 0xde,
+  0x00, 0x00, 0x02, 0x61, 0x6c, 0x00, 0x03, 0x8e, 0x00, 0x1f, 0xfd, 0x00,
+  0x00, 0x02, 0x61, 0x64, 0x00, 0x1c, 0x36, 0x00, 0x72, 0xd6, 0x05, 0x64,
+  0x6f, 0x73, 0x65, 0x6e, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x65, 0x00,
+  0x05, 0xfa, 0x00, 0x72, 0xe9, 0x04, 0x73, 0x73, 0x6f, 0x76, 0x80, 0x00,
+  0x00, 0x00, 0x02, 0x64, 0x6c, 0x00, 0x20, 0x5e, 0x00, 0x23, 0x35, 0x02,
+  0x65, 0x62, 0x80, 0x00, 0x00, 0x00, 0x02, 0x73, 0x79, 0x00, 0x73, 0x0b,
+  0x00, 0x6b, 0xd3, 0x03, 0x72, 0x6f, 0x74, 0x80, 0x00, 0x00, 0x00, 0x02,
+  0x61, 0x75, 0x00, 0x73, 0x1c, 0x00, 0x0b, 0xb4, 0x00, 0x00, 0x02, 0x64,
+  0x74, 0x00, 0x73, 0x27, 0x00, 0x67, 0xcb, 0x00, 0x00, 0x03, 0x67, 0x6e,
+  0x6f, 0x00, 0x73, 0x36, 0x00, 0x73, 0x3c, 0x00, 0x03, 0x40, 0x03, 0x6e,
+  0x6f, 0x73, 0x80, 0x00, 0x00, 0x00, 0x02, 0x65, 0x6f, 0x00, 0x01, 0x8b,
+  0x00, 0x73, 0x47, 0x02, 0x6a, 0x6d, 0x80, 0x00, 0x04, 0x6d, 0x61, 0x72,
+  0x64, 0x80, 0x00, 0x02, 0x6a, 0x73, 0x00, 0x02, 0x6f, 0x73, 0x00, 0x03,
+  0x40, 0x00, 0x73, 0x60, 0x06, 0x65, 0x6e, 0x64, 0x6e, 0x61, 0x73, 0x80,
+  0x00, 0x04, 0x70, 0x6f, 0x6c, 0x67, 0x80, 0x00, 0x00, 0x00, 0x02, 0x6c,
+  0x6f, 0x00, 0x73, 0x7b, 0x00, 0x01, 0xed, 0x0b, 0x61, 0x68, 0x73, 0x6c,
+  0x61, 0x64, 0x72, 0x6f, 0x6a, 0x74, 0x73, 0x80, 0x00, 0x00, 0x00, 0x02,
+  0x6f, 0x72, 0x00, 0x73, 0x94, 0x00, 0x4e, 0xae, 0x00, 0x00, 0x02, 0x6c,
+  0x74, 0x00, 0x01, 0xed, 0x00, 0x73, 0x9f, 0x05, 0x2d, 0x65, 0x72, 0x74,
+  0x73, 0x00, 0x02, 0x65, 0x6f, 0x00, 0x59, 0xcd, 0x00, 0x01, 0xed, 0x02,
+  0x6c, 0x79, 0x00, 0x02, 0x6b, 0x6e, 0x00, 0x73, 0xbc, 0x00, 0x70, 0x07,
+  0x03, 0x6b, 0x79, 0x73, 0x80, 0x00, 0x06, 0x61, 0x6d, 0x2d, 0x6e, 0x61,
+  0x6a, 0x80, 0x01, 0x2e, 0x00, 0x59, 0x36, 0x00, 0x00, 0x02, 0x6f, 0x75,
+  0x00, 0x3c, 0x9a, 0x00, 0x73, 0xda, 0x02, 0x6a, 0x62, 0x80, 0x00, 0x00,
+  0x00, 0x02, 0x64, 0x76, 0x00, 0x73, 0xea, 0x00, 0x73, 0xf2, 0x05, 0x6e,
+  0x61, 0x6f, 0x72, 0x74, 0x80, 0x00, 0x04, 0x6e, 0x61, 0x72, 0x67, 0x80,
+  0x00, 0x07, 0x61, 0x64, 0x65, 0x6e, 0x64, 0x75, 0x61, 0x80, 0x00, 0x06,
+  0x61, 0x68, 0x65, 0x72, 0x6b, 0x61, 0x80, 0x00, 0x00, 0x00, 0x02, 0x69,
+  0x75, 0x00, 0x03, 0x3c, 0x00, 0x74, 0x17, 0x06, 0x72, 0x67, 0x73, 0x72,
+  0x6f, 0x70, 0x80, 0x00, 0x03, 0x72, 0x66, 0x2d, 0x00, 0x02, 0x64, 0x72,
+  0x00, 0x5f, 0x38, 0x00, 0x1c, 0x25, 0x00, 0x00, 0x02, 0x61, 0x65, 0x00,
+  0x74, 0x39, 0x00, 0x74, 0x3f, 0x03, 0x69, 0x65, 0x62, 0x80, 0x00, 0x04,
+  0x76, 0x61, 0x74, 0x73, 0x80, 0x00, 0x03, 0x66, 0x65, 0x76, 0x80, 0x00,
+  0x03, 0x72, 0x74, 0x73, 0x80, 0x00, 0x00, 0x40, 0x36, 0x3e, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x05, 0x06, 0x07, 0x08, 0x00, 0x00, 0x00, 0x09, 0x0a,
+  0x00, 0x74, 0xb2, 0x00, 0x02, 0x6a, 0x00, 0x74, 0xc4, 0x00, 0x74, 0xcf,
+  0x00, 0x74, 0xd5, 0x00, 0x74, 0xdd, 0x00, 0x75, 0x0e, 0x00, 0x75, 0x16,
+  0x00, 0x75, 0x21, 0x00, 0x75, 0x3d, 0x0f, 0x61, 0x78, 0x69, 0x2d, 0x79,
+  0x67, 0x76, 0x74, 0x73, 0x65, 0x76, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00,
+  0x00, 0x00, 0x02, 0x6f, 0x72, 0x00, 0x1e, 0x64, 0x00, 0x70, 0x07, 0x03,
+  0x65, 0x76, 0x73, 0x80, 0x00, 0x05, 0x73, 0x73, 0x6f, 0x75, 0x66, 0x80,
+  0x00, 0x00, 0x00, 0x03, 0x6d, 0x6f, 0x73, 0x00, 0x45, 0x42, 0x00, 0x74,
+  0xec, 0x00, 0x75, 0x06, 0x02, 0x75, 0x73, 0x00, 0x02, 0x61, 0x65, 0x00,
+  0x74, 0xf9, 0x00, 0x74, 0xff, 0x03, 0x64, 0x6e, 0x61, 0x80, 0x00, 0x04,
+  0x63, 0x68, 0x61, 0x63, 0x80, 0x00, 0x01, 0x6f, 0x80, 0x01, 0x2e, 0x00,
+  0x59, 0x36, 0x05, 0x73, 0x64, 0x65, 0x6b, 0x73, 0x80, 0x00, 0x08, 0x69,
+  0x65, 0x6b, 0x6f, 0x74, 0x75, 0x61, 0x6b, 0x80, 0x00, 0x00, 0x00, 0x03,
+  0x65, 0x6f, 0x79, 0x00, 0x75, 0x30, 0x00, 0x5e, 0xc5, 0x00, 0x75, 0x37,
+  0x04, 0x67, 0x61, 0x72, 0x6b, 0x80, 0x00, 0x03, 0x6f, 0x73, 0x6f, 0x80,
+  0x00, 0x00, 0x00, 0x02, 0x64, 0x6d, 0x00, 0x70, 0x07, 0x00, 0x65, 0xdf,
+  0x00, 0x00, 0x02, 0x65, 0x70, 0x00, 0x46, 0xfe, 0x00, 0x75, 0x53, 0x00,
+  0x00, 0x02, 0x61, 0x65, 0x00, 0x75, 0x5e, 0x00, 0x75, 0x66, 0x05, 0x6b,
+  0x64, 0x72, 0x6f, 0x6e, 0x80, 0x00, 0x02, 0x6c, 0x6b, 0x80, 0x00, 0x00,
+  0x00, 0x06, 0x61, 0x65, 0x69, 0x6d, 0x6f, 0x74, 0x00, 0x75, 0x86, 0x00,
+  0x75, 0xc0, 0x00, 0x76, 0xf8, 0x00, 0x59, 0x2f, 0x00, 0x76, 0xff, 0x00,
+  0x59, 0x2f, 0x00, 0x00, 0x05, 0x64, 0x6a, 0x6c, 0x6d, 0x76, 0x00, 0x75,
+  0x9d, 0x00, 0x75, 0xae, 0x00, 0x75, 0xb4, 0x00, 0x66, 0x39, 0x00, 0x75,
+  0xba, 0x00, 0x00, 0x02, 0x64, 0x69, 0x00, 0x75, 0xa8, 0x00, 0x1f, 0xfd,
+  0x03, 0x6a, 0x61, 0x62, 0x80, 0x00, 0x03, 0x74, 0x69, 0x66, 0x80, 0x00,
+  0x03, 0x75, 0x61, 0x67, 0x80, 0x00, 0x03, 0x73, 0x79, 0x74, 0x80, 0x00,
+  0x00, 0x40, 0x67, 0x13, 0x01, 0x00, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x75, 0xf2, 0x00, 0x05, 0xfa, 0x00, 0x76, 0x68, 0x00, 0x76, 0x71, 0x00,
+  0x76, 0xc0, 0x00, 0x76, 0xcc, 0x00, 0x76, 0xe1, 0x00, 0x76, 0xe7, 0x00,
+  0x02, 0x12, 0x01, 0x6e, 0x00, 0x02, 0x61, 0x69, 0x00, 0x75, 0xfe, 0x00,
+  0x76, 0x5f, 0x00, 0x40, 0x6b, 0x0f, 0x01, 0x00, 0x02, 0x03, 0x00, 0x00,
+  0x00, 0x04, 0x05, 0x06, 0x00, 0x07, 0x00, 0x00, 0x08, 0x00, 0x76, 0x29,
+  0x00, 0x76, 0x34, 0x00, 0x76, 0x3a, 0x00, 0x76, 0x45, 0x00, 0x3f, 0xf8,
+  0x00, 0x76, 0x4e, 0x00, 0x76, 0x54, 0x00, 0x4e, 0xae, 0x00, 0x00, 0x02,
+  0x69, 0x72, 0x00, 0x1f, 0x1f, 0x00, 0x02, 0x12, 0x03, 0x65, 0x72, 0x62,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x6d, 0x00, 0x03, 0x3c, 0x00, 0x22,
+  0x90, 0x06, 0x61, 0x76, 0x2d, 0x72, 0x6f, 0x73, 0x80, 0x00, 0x03, 0x61,
+  0x6c, 0x66, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x65, 0x00, 0x3c, 0xc9,
+  0x00, 0x05, 0xfa, 0x06, 0x76, 0x73, 0x67, 0x6e, 0x6f, 0x6b, 0x80, 0x00,
+  0x06, 0x6b, 0x6e, 0x69, 0x65, 0x74, 0x73, 0x80, 0x00, 0x00, 0x00, 0x04,
+  0x61, 0x69, 0x72, 0x73, 0x00, 0x76, 0x84, 0x00, 0x76, 0xb1, 0x00, 0x22,
+  0xab, 0x00, 0x02, 0xa9, 0x00, 0x00, 0x03, 0x6e, 0x72, 0x73, 0x00, 0x76,
+  0x93, 0x00, 0x04, 0x75, 0x00, 0x76, 0x99, 0x03, 0x76, 0x65, 0x6a, 0x80,
+  0x00, 0x00, 0x00, 0x02, 0x67, 0x6e, 0x00, 0x76, 0xa4, 0x00, 0x76, 0xaa,
+  0x03, 0x6e, 0x69, 0x72, 0x80, 0x00, 0x04, 0x65, 0x6c, 0x6c, 0x75, 0x80,
+  0x00, 0x04, 0x65, 0x2d, 0x65, 0x72, 0x00, 0x02, 0x64, 0x76, 0x00, 0x01,
+  0x8f, 0x00, 0x02, 0x12, 0x01, 0x61, 0x00, 0x02, 0x6a, 0x76, 0x00, 0x1c,
+  0xc3, 0x00, 0x3d, 0x0a, 0x00, 0x00, 0x02, 0x62, 0x6d, 0x00, 0x66, 0x39,
+  0x00, 0x76, 0xd7, 0x07, 0x61, 0x68, 0x65, 0x6c, 0x6c, 0x69, 0x6c, 0x80,
+  0x00, 0x03, 0x6e, 0x75, 0x6c, 0x80, 0x00, 0x01, 0x73, 0x00, 0x02, 0x6c,
+  0x75, 0x00, 0x76, 0xf3, 0x00, 0x05, 0xfa, 0x02, 0x6f, 0x6a, 0x80, 0x00,
+  0x04, 0x6d, 0x70, 0x61, 0x68, 0x80, 0x00, 0x03, 0x73, 0x69, 0x72, 0x80,
+  0x00, 0x00, 0x40, 0x61, 0x15, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03,
+  0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07,
+  0x00, 0x08, 0x00, 0x77, 0x36, 0x00, 0x77, 0x3d, 0x00, 0x59, 0xcd, 0x00,
+  0x1c, 0xc3, 0x00, 0x77, 0xb6, 0x00, 0x77, 0xbe, 0x00, 0x77, 0xc9, 0x00,
+  0x77, 0xe0, 0x04, 0x64, 0x6e, 0x69, 0x6c, 0x80, 0x00, 0x01, 0x6e, 0x00,
+  0x06, 0x64, 0x65, 0x6d, 0x6e, 0x73, 0x74, 0x00, 0x69, 0x10, 0x00, 0x77,
+  0x59, 0x00, 0x77, 0x7f, 0x00, 0x77, 0x8b, 0x00, 0x77, 0x99, 0x00, 0x77,
+  0xb0, 0x00, 0x00, 0x03, 0x64, 0x6b, 0x76, 0x00, 0x24, 0x8d, 0x00, 0x77,
+  0x68, 0x00, 0x22, 0x81, 0x00, 0x00, 0x02, 0x72, 0x73, 0x00, 0x77, 0x73,
+  0x00, 0x45, 0x69, 0x01, 0x69, 0x00, 0x02, 0x62, 0x6b, 0x00, 0x01, 0xed,
+  0x00, 0x01, 0xed, 0x01, 0x65, 0x00, 0x02, 0x68, 0x6a, 0x00, 0x01, 0xed,
+  0x00, 0x0b, 0xb4, 0x0b, 0x72, 0x6f, 0x68, 0x2d, 0x67, 0x6f, 0x2d, 0x65,
+  0x6a, 0x76, 0x65, 0x80, 0x00, 0x00, 0x00, 0x05, 0x61, 0x65, 0x6b, 0x6f,
+  0x79, 0x00, 0x01, 0xed, 0x00, 0x77, 0x36, 0x00, 0x02, 0x12, 0x00, 0x1c,
+  0xc3, 0x00, 0x03, 0x3c, 0x03, 0x73, 0x65, 0x76, 0x80, 0x00, 0x05, 0x67,
+  0x61, 0x76, 0x61, 0x6c, 0x80, 0x00, 0x00, 0x00, 0x02, 0x72, 0x73, 0x00,
+  0x6b, 0xd3, 0x00, 0x02, 0xfe, 0x01, 0x6f, 0x00, 0x03, 0x66, 0x6d, 0x76,
+  0x00, 0x77, 0xd9, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x04, 0x65, 0x6e,
+  0x6f, 0x68, 0x80, 0x00, 0x01, 0x68, 0x00, 0x02, 0x6c, 0x73, 0x00, 0x04,
+  0x75, 0x00, 0x77, 0xec, 0x08, 0x72, 0x65, 0x6b, 0x61, 0x2e, 0x73, 0x65,
+  0x6e, 0x80, 0x00, 0x00, 0x40, 0x61, 0x14, 0x01, 0x00, 0x00, 0x00, 0x02,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x04, 0x00, 0x05, 0x06, 0x00, 0x00,
+  0x00, 0x07, 0x08, 0x00, 0x78, 0x27, 0x00, 0x78, 0x8c, 0x00, 0x78, 0xd0,
+  0x00, 0x78, 0xd7, 0x00, 0x59, 0x2f, 0x00, 0x78, 0xde, 0x00, 0x78, 0xf1,
+  0x00, 0x79, 0x0a, 0x00, 0x00, 0x07, 0x62, 0x67, 0x6a, 0x6c, 0x73, 0x74,
+  0x76, 0x00, 0x78, 0x46, 0x00, 0x78, 0x4c, 0x00, 0x78, 0x5d, 0x00, 0x78,
+  0x6a, 0x00, 0x78, 0x76, 0x00, 0x03, 0x8e, 0x00, 0x78, 0x7c, 0x03, 0x61,
+  0x6f, 0x6c, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x67, 0x00, 0x59, 0x72,
+  0x00, 0x78, 0x57, 0x03, 0x72, 0x61, 0x76, 0x80, 0x00, 0x0a, 0x6a, 0x72,
+  0x61, 0x76, 0x2d, 0x61, 0x74, 0x74, 0x61, 0x6d, 0x80, 0x00, 0x01, 0x61,
+  0x00, 0x02, 0x62, 0x73, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x03, 0x6f,
+  0x75, 0x6d, 0x80, 0x00, 0x00, 0x00, 0x02, 0x65, 0x6f, 0x00, 0x08, 0x0c,
+  0x00, 0x78, 0x87, 0x02, 0x75, 0x72, 0x80, 0x00, 0x00, 0x00, 0x04, 0x64,
+  0x66, 0x73, 0x76, 0x00, 0x78, 0x9f, 0x00, 0x01, 0xed, 0x00, 0x78, 0xa8,
+  0x00, 0x78, 0xc8, 0x06, 0x6e, 0x61, 0x6c, 0x79, 0x6f, 0x68, 0x80, 0x00,
+  0x00, 0x00, 0x03, 0x6e, 0x72, 0x73, 0x00, 0x78, 0xb7, 0x00, 0x78, 0xbc,
+  0x00, 0x01, 0x8f, 0x02, 0x79, 0x74, 0x80, 0x00, 0x09, 0x6f, 0x6b, 0x6f,
+  0x6d, 0x73, 0x64, 0x65, 0x6b, 0x73, 0x80, 0x00, 0x05, 0x74, 0x70, 0x69,
+  0x6b, 0x73, 0x80, 0x00, 0x04, 0x6e, 0x61, 0x6b, 0x73, 0x80, 0x00, 0x04,
+  0x6f, 0x68, 0x61, 0x72, 0x80, 0x00, 0x00, 0x00, 0x02, 0x6d, 0x70, 0x00,
+  0x02, 0xa9, 0x00, 0x78, 0xe9, 0x05, 0x73, 0x67, 0x6f, 0x6c, 0x62, 0x84,
+  0x00, 0x00, 0x80, 0x03, 0x2e, 0x65, 0x6f, 0x00, 0x59, 0x36, 0x00, 0x79,
+  0x00, 0x00, 0x01, 0x8b, 0x07, 0x66, 0x72, 0x65, 0x6d, 0x6d, 0x61, 0x68,
+  0x80, 0x00, 0x04, 0x65, 0x72, 0x64, 0x69, 0x80, 0x00, 0x00, 0x00, 0x06,
+  0x62, 0x64, 0x67, 0x6a, 0x6b, 0x6e, 0x00, 0x79, 0x2c, 0x00, 0x79, 0x59,
+  0x00, 0x79, 0x66, 0x00, 0x79, 0x79, 0x00, 0x79, 0xa3, 0x00, 0x79, 0xab,
+  0x00, 0x80, 0x04, 0x2e, 0x61, 0x65, 0x6c, 0x00, 0x59, 0x36, 0x00, 0x75,
+  0x66, 0x00, 0x79, 0x3f, 0x00, 0x06, 0x56, 0x00, 0x00, 0x03, 0x64, 0x67,
+  0x6e, 0x00, 0x79, 0x4e, 0x00, 0x76, 0xa4, 0x00, 0x79, 0x53, 0x02, 0x6e,
+  0x61, 0x80, 0x00, 0x03, 0x6e, 0x65, 0x72, 0x80, 0x00, 0x02, 0x72, 0x61,
+  0x00, 0x02, 0x62, 0x65, 0x00, 0x01, 0xed, 0x00, 0x1e, 0x64, 0x00, 0x00,
+  0x02, 0x6e, 0x76, 0x00, 0x79, 0x71, 0x00, 0x02, 0x83, 0x05, 0x61, 0x73,
+  0x72, 0x6f, 0x70, 0x80, 0x00, 0x00, 0x00, 0x03, 0x64, 0x6a, 0x76, 0x00,
+  0x79, 0x88, 0x00, 0x79, 0x91, 0x00, 0x79, 0x98, 0x06, 0x61, 0x65, 0x68,
+  0x61, 0x6c, 0x61, 0x80, 0x00, 0x04, 0x65, 0x64, 0x75, 0x62, 0x80, 0x00,
+  0x08, 0x61, 0x72, 0x65, 0x6b, 0x6b, 0x68, 0x61, 0x72, 0x80, 0x00, 0x05,
+  0x73, 0x69, 0x6f, 0x75, 0x66, 0x80, 0x00, 0x00, 0x00, 0x02, 0x64, 0x74,
+  0x00, 0x79, 0xb6, 0x00, 0x79, 0xc3, 0x0a, 0x69, 0x61, 0x65, 0x67, 0x61,
+  0x64, 0x76, 0x6f, 0x75, 0x67, 0x80, 0x00, 0x03, 0x61, 0x65, 0x64, 0x80,
+  0x00, 0x00, 0x00, 0x02, 0x69, 0x6c, 0x00, 0x0d, 0x7a, 0x00, 0x79, 0xd4,
+  0x05, 0x65, 0x73, 0x6c, 0x61, 0x6d, 0x80, 0x00, 0x00, 0x00, 0x02, 0x62,
+  0x6f, 0x00, 0x79, 0xe7, 0x00, 0x7a, 0x08, 0x00, 0x00, 0x04, 0x65, 0x6e,
+  0x73, 0x74, 0x00, 0x79, 0xfa, 0x00, 0x1d, 0xe1, 0x00, 0x7a, 0x01, 0x00,
+  0x77, 0xb0, 0x04, 0x73, 0x73, 0x65, 0x6e, 0x80, 0x00, 0x04, 0x65, 0x62,
+  0x65, 0x6c, 0x80, 0x00, 0x00, 0x40, 0x64, 0x13, 0x01, 0x00, 0x00, 0x02,
+  0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x06, 0x00, 0x00, 0x00, 0x07, 0x08,
+  0x00, 0x00, 0x09, 0x00, 0x7a, 0x3a, 0x00, 0x7a, 0x51, 0x00, 0x7a, 0x5a,
+  0x00, 0x04, 0x75, 0x00, 0x7a, 0x6b, 0x00, 0x7a, 0x71, 0x00, 0x7a, 0x87,
+  0x00, 0x7a, 0xc3, 0x00, 0x7a, 0xe1, 0x00, 0x00, 0x03, 0x61, 0x6e, 0x6f,
+  0x00, 0x01, 0x8b, 0x00, 0x7a, 0x49, 0x00, 0x01, 0x8b, 0x01, 0x61, 0x80,
+  0x01, 0x73, 0x00, 0x01, 0xed, 0x06, 0x61, 0x76, 0x74, 0x73, 0x65, 0x76,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x72, 0x73, 0x00, 0x7a, 0x65, 0x00, 0x02,
+  0xa9, 0x03, 0x61, 0x6a, 0x62, 0x80, 0x00, 0x03, 0x72, 0x61, 0x6b, 0x80,
+  0x00, 0x00, 0x00, 0x02, 0x61, 0x6e, 0x00, 0x4c, 0xf9, 0x00, 0x7a, 0x7c,
+  0x00, 0x00, 0x02, 0x69, 0x6f, 0x00, 0x1c, 0xc3, 0x00, 0x0f, 0x28, 0x00,
+  0x00, 0x04, 0x61, 0x65, 0x75, 0x79, 0x00, 0x7a, 0x9a, 0x00, 0x7a, 0xa9,
+  0x00, 0x05, 0xfa, 0x00, 0x46, 0xfe, 0x00, 0x00, 0x03, 0x6d, 0x6e, 0x76,
+  0x00, 0x66, 0x39, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x00, 0x03,
+  0x64, 0x74, 0x76, 0x00, 0x03, 0x21, 0x00, 0x7a, 0xb8, 0x00, 0x02, 0xa9,
+  0x00, 0x00, 0x02, 0x73, 0x74, 0x00, 0x02, 0x12, 0x00, 0x67, 0x13, 0x00,
+  0x00, 0x05, 0x61, 0x65, 0x67, 0x6c, 0x74, 0x00, 0x03, 0x40, 0x00, 0x7a,
+  0xda, 0x00, 0x70, 0x07, 0x00, 0x7a, 0x6b, 0x00, 0x6f, 0xfc, 0x04, 0x6e,
+  0x6e, 0x65, 0x72, 0x80, 0x00, 0x05, 0x72, 0x65, 0x6a, 0x6b, 0x73, 0x80,
+  0x00, 0x00, 0x80, 0x03, 0x2e, 0x65, 0x70, 0x00, 0x7a, 0xf8, 0x00, 0x7b,
+  0x3d, 0x00, 0x80, 0x1a, 0x00, 0x40, 0x63, 0x15, 0x01, 0x00, 0x02, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x06, 0x07, 0x00, 0x00, 0x08, 0x00, 0x10, 0xad, 0x00, 0x08, 0x05, 0x00,
+  0x01, 0x72, 0x00, 0x7b, 0x29, 0x00, 0x02, 0x6d, 0x00, 0x10, 0xce, 0x00,
+  0x02, 0x1a, 0x00, 0x7b, 0x38, 0x00, 0x00, 0x03, 0x6f, 0x72, 0x74, 0x00,
+  0x12, 0xde, 0x00, 0x0a, 0x0e, 0x00, 0x01, 0xed, 0x02, 0x77, 0x77, 0x80,
+  0x00, 0x01, 0x61, 0x80, 0x01, 0x2e, 0x00, 0x7b, 0x45, 0x00, 0x40, 0x61,
+  0x19, 0x01, 0x02, 0x03, 0x00, 0x04, 0x00, 0x05, 0x06, 0x07, 0x00, 0x00,
+  0x08, 0x00, 0x09, 0x0a, 0x0b, 0x00, 0x0c, 0x0d, 0x0e, 0x00, 0x00, 0x0f,
+  0x00, 0x10, 0x00, 0x7b, 0x92, 0x00, 0x7b, 0xac, 0x00, 0x7b, 0xbc, 0x00,
+  0x7b, 0xdb, 0x00, 0x7c, 0x92, 0x00, 0x7d, 0x23, 0x00, 0x7d, 0x2d, 0x00,
+  0x7d, 0x33, 0x00, 0x7d, 0x75, 0x00, 0x7e, 0x32, 0x00, 0x7e, 0x39, 0x00,
+  0x7e, 0x64, 0x00, 0x7e, 0xbb, 0x00, 0x7f, 0x06, 0x00, 0x7f, 0xe7, 0x00,
+  0x7f, 0xf2, 0x00, 0x00, 0x03, 0x61, 0x63, 0x69, 0x00, 0x01, 0x87, 0x00,
+  0x7b, 0xa1, 0x00, 0x7b, 0xa6, 0x02, 0x67, 0x64, 0x80, 0x00, 0x03, 0x64,
+  0x65, 0x6d, 0x80, 0x00, 0x03, 0x75, 0x6c, 0x63, 0x80, 0x01, 0x6f, 0x00,
+  0x7b, 0xb6, 0x03, 0x72, 0x65, 0x61, 0x80, 0x00, 0x01, 0x69, 0x00, 0x02,
+  0x66, 0x74, 0x00, 0x7b, 0xc8, 0x00, 0x7b, 0xd2, 0x07, 0x66, 0x61, 0x72,
+  0x74, 0x72, 0x69, 0x61, 0x80, 0x00, 0x06, 0x61, 0x62, 0x6f, 0x72, 0x65,
+  0x61, 0x80, 0x00, 0x00, 0x00, 0x05, 0x63, 0x67, 0x6d, 0x6e, 0x72, 0x00,
+  0x7b, 0xf2, 0x00, 0x7c, 0x59, 0x00, 0x7c, 0x62, 0x00, 0x7c, 0x6c, 0x00,
+  0x7c, 0x89, 0x00, 0x00, 0x02, 0x61, 0x6e, 0x00, 0x7b, 0xfd, 0x00, 0x7c,
+  0x08, 0x08, 0x6c, 0x70, 0x74, 0x65, 0x6b, 0x72, 0x61, 0x6d, 0x80, 0x00,
+  0x00, 0x00, 0x02, 0x61, 0x65, 0x00, 0x7c, 0x13, 0x00, 0x7c, 0x50, 0x00,
+  0x00, 0x03, 0x6c, 0x6e, 0x72, 0x00, 0x7c, 0x22, 0x00, 0x7c, 0x40, 0x00,
+  0x7c, 0x49, 0x00, 0x00, 0x02, 0x6c, 0x75, 0x00, 0x7c, 0x2d, 0x00, 0x7c,
+  0x3a, 0x0a, 0x69, 0x65, 0x76, 0x72, 0x75, 0x73, 0x2d, 0x72, 0x69, 0x61,
+  0x80, 0x00, 0x03, 0x62, 0x6d, 0x61, 0x80, 0x00, 0x06, 0x65, 0x74, 0x6e,
+  0x69, 0x61, 0x6d, 0x80, 0x00, 0x04, 0x75, 0x73, 0x6e, 0x69, 0x80, 0x00,
+  0x06, 0x72, 0x65, 0x66, 0x6e, 0x6f, 0x63, 0x80, 0x00, 0x06, 0x6e, 0x61,
+  0x68, 0x63, 0x78, 0x65, 0x80, 0x00, 0x07, 0x6f, 0x72, 0x64, 0x6f, 0x72,
+  0x65, 0x61, 0x80, 0x00, 0x01, 0x69, 0x00, 0x03, 0x67, 0x6c, 0x7a, 0x00,
+  0x38, 0x12, 0x00, 0x7c, 0x7c, 0x00, 0x7c, 0x82, 0x03, 0x72, 0x69, 0x61,
+  0x80, 0x00, 0x04, 0x61, 0x67, 0x61, 0x6d, 0x80, 0x00, 0x06, 0x61, 0x77,
+  0x74, 0x66, 0x6f, 0x73, 0x80, 0x00, 0x02, 0x6e, 0x69, 0x00, 0x07, 0x64,
+  0x6c, 0x6e, 0x72, 0x73, 0x74, 0x76, 0x00, 0x7c, 0xb3, 0x00, 0x7c, 0xcb,
+  0x00, 0x7c, 0xe9, 0x00, 0x7c, 0xf2, 0x00, 0x7c, 0xf9, 0x00, 0x7c, 0xff,
+  0x00, 0x7d, 0x1b, 0x00, 0x00, 0x02, 0x61, 0x69, 0x00, 0x4c, 0xf9, 0x00,
+  0x7c, 0xbe, 0x02, 0x6c, 0x67, 0x80, 0x02, 0x61, 0x67, 0x00, 0x0f, 0x51,
+  0x00, 0x45, 0x0a, 0x00, 0x00, 0x02, 0x64, 0x6c, 0x00, 0x7c, 0xd6, 0x00,
+  0x7c, 0xe2, 0x09, 0x6e, 0x61, 0x68, 0x64, 0x6e, 0x75, 0x6f, 0x72, 0x67,
+  0x80, 0x00, 0x04, 0x65, 0x64, 0x6f, 0x6d, 0x80, 0x00, 0x06, 0x6f, 0x6f,
+  0x6c, 0x6c, 0x61, 0x62, 0x80, 0x00, 0x04, 0x65, 0x74, 0x61, 0x63, 0x80,
+  0x00, 0x03, 0x61, 0x65, 0x6c, 0x80, 0x00, 0x00, 0x00, 0x02, 0x6c, 0x75,
+  0x00, 0x7d, 0x0a, 0x00, 0x7d, 0x12, 0x05, 0x75, 0x73, 0x6e, 0x6f, 0x63,
+  0x80, 0x00, 0x06, 0x68, 0x63, 0x61, 0x72, 0x61, 0x70, 0x80, 0x00, 0x05,
+  0x69, 0x64, 0x79, 0x6b, 0x73, 0x80, 0x00, 0x07, 0x63, 0x72, 0x61, 0x65,
+  0x73, 0x65, 0x72, 0x80, 0x00, 0x03, 0x78, 0x61, 0x74, 0x80, 0x00, 0x00,
+  0x00, 0x04, 0x61, 0x65, 0x69, 0x6f, 0x00, 0x7d, 0x46, 0x00, 0x7d, 0x4e,
+  0x00, 0x7d, 0x53, 0x00, 0x7d, 0x5b, 0x05, 0x6e, 0x72, 0x75, 0x6f, 0x6a,
+  0x80, 0x00, 0x02, 0x75, 0x66, 0x80, 0x00, 0x05, 0x63, 0x6e, 0x75, 0x6f,
+  0x63, 0x80, 0x00, 0x05, 0x72, 0x74, 0x6e, 0x6f, 0x63, 0x80, 0x01, 0x2d,
+  0x00, 0x7d, 0x67, 0x0b, 0x63, 0x69, 0x66, 0x66, 0x61, 0x72, 0x74, 0x2d,
+  0x72, 0x69, 0x61, 0x80, 0x00, 0x00, 0x00, 0x02, 0x67, 0x6f, 0x00, 0x7d,
+  0x80, 0x00, 0x7d, 0x87, 0x04, 0x69, 0x73, 0x65, 0x64, 0x80, 0x00, 0x01,
+  0x69, 0x00, 0x02, 0x6e, 0x74, 0x00, 0x07, 0xb6, 0x00, 0x7d, 0x93, 0x00,
+  0x00, 0x03, 0x61, 0x63, 0x6e, 0x00, 0x7d, 0xa2, 0x00, 0x7e, 0x19, 0x00,
+  0x7e, 0x21, 0x00, 0x00, 0x05, 0x63, 0x65, 0x67, 0x69, 0x72, 0x00, 0x7d,
+  0xb9, 0x00, 0x7d, 0xc3, 0x00, 0x7d, 0xca, 0x00, 0x7d, 0xe7, 0x00, 0x7e,
+  0x12, 0x07, 0x69, 0x66, 0x69, 0x74, 0x72, 0x65, 0x63, 0x80, 0x00, 0x04,
+  0x72, 0x63, 0x65, 0x72, 0x80, 0x00, 0x01, 0x69, 0x00, 0x02, 0x74, 0x76,
+  0x00, 0x7d, 0xd6, 0x00, 0x3d, 0x0e, 0x0e, 0x73, 0x65, 0x76, 0x6e, 0x69,
+  0x2d, 0x74, 0x6e, 0x65, 0x64, 0x69, 0x63, 0x63, 0x61, 0x80, 0x00, 0x00,
+  0x00, 0x02, 0x63, 0x76, 0x00, 0x7d, 0xf2, 0x00, 0x7e, 0x09, 0x04, 0x6f,
+  0x73, 0x73, 0x61, 0x80, 0x01, 0x2d, 0x00, 0x7d, 0xfd, 0x09, 0x72, 0x65,
+  0x67, 0x6e, 0x65, 0x73, 0x73, 0x61, 0x70, 0x80, 0x00, 0x06, 0x61, 0x6c,
+  0x69, 0x76, 0x69, 0x63, 0x80, 0x00, 0x04, 0x65, 0x64, 0x65, 0x66, 0x80,
+  0x00, 0x05, 0x75, 0x64, 0x6f, 0x72, 0x70, 0x80, 0x00, 0x0e, 0x65, 0x76,
+  0x65, 0x72, 0x70, 0x2d, 0x74, 0x6e, 0x65, 0x64, 0x69, 0x63, 0x63, 0x61,
+  0x80, 0x00, 0x04, 0x67, 0x72, 0x61, 0x63, 0x80, 0x00, 0x00, 0x00, 0x02,
+  0x69, 0x75, 0x00, 0x7e, 0x44, 0x00, 0x7e, 0x51, 0x0a, 0x68, 0x73, 0x6e,
+  0x6f, 0x69, 0x70, 0x6d, 0x61, 0x68, 0x63, 0x80, 0x00, 0x03, 0x6f, 0x72,
+  0x67, 0x80, 0x01, 0x67, 0x00, 0x7e, 0x5b, 0x06, 0x6e, 0x69, 0x6b, 0x72,
+  0x6f, 0x77, 0x80, 0x00, 0x00, 0x00, 0x02, 0x65, 0x6f, 0x00, 0x7e, 0x6f,
+  0x00, 0x7e, 0xa2, 0x00, 0x00, 0x05, 0x64, 0x65, 0x6b, 0x6e, 0x74, 0x00,
+  0x1d, 0xe1, 0x00, 0x7e, 0x86, 0x00, 0x7e, 0x8e, 0x00, 0x7e, 0x94, 0x00,
+  0x7e, 0x9b, 0x05, 0x6e, 0x69, 0x67, 0x6e, 0x65, 0x80, 0x00, 0x03, 0x6f,
+  0x72, 0x62, 0x80, 0x00, 0x04, 0x69, 0x61, 0x72, 0x74, 0x80, 0x00, 0x04,
+  0x72, 0x61, 0x68, 0x63, 0x80, 0x00, 0x00, 0x00, 0x02, 0x68, 0x74, 0x00,
+  0x7e, 0xad, 0x00, 0x7e, 0xb3, 0x03, 0x74, 0x75, 0x61, 0x80, 0x00, 0x05,
+  0x61, 0x63, 0x75, 0x64, 0x65, 0x80, 0x00, 0x00, 0x00, 0x05, 0x63, 0x65,
+  0x6b, 0x73, 0x74, 0x00, 0x7e, 0xd2, 0x00, 0x7e, 0xdc, 0x00, 0x7e, 0xef,
+  0x00, 0x7e, 0xf5, 0x00, 0x7e, 0xff, 0x07, 0x69, 0x74, 0x73, 0x69, 0x67,
+  0x6f, 0x6c, 0x80, 0x00, 0x00, 0x00, 0x02, 0x63, 0x72, 0x00, 0x7e, 0xe7,
+  0x00, 0x01, 0xed, 0x05, 0x69, 0x76, 0x72, 0x65, 0x73, 0x80, 0x00, 0x03,
+  0x72, 0x6f, 0x77, 0x80, 0x00, 0x03, 0x65, 0x72, 0x70, 0x80, 0x01, 0x78,
+  0x00, 0x22, 0x81, 0x04, 0x6e, 0x65, 0x67, 0x61, 0x80, 0x00, 0x00, 0x00,
+  0x07, 0x66, 0x68, 0x6c, 0x6e, 0x6f, 0x72, 0x73, 0x00, 0x7f, 0x25, 0x00,
+  0x7f, 0x3a, 0x00, 0x7f, 0x59, 0x00, 0x7f, 0x63, 0x00, 0x4a, 0xd2, 0x00,
+  0x7f, 0xc2, 0x00, 0x7f, 0xca, 0x04, 0x61, 0x72, 0x63, 0x72, 0x00, 0x02,
+  0x69, 0x6f, 0x00, 0x02, 0xa9, 0x00, 0x7f, 0x34, 0x03, 0x74, 0x6f, 0x72,
+  0x80, 0x00, 0x02, 0x67, 0x69, 0x00, 0x02, 0x65, 0x6c, 0x00, 0x3c, 0x9a,
+  0x00, 0x7f, 0x47, 0x00, 0x00, 0x02, 0x66, 0x6f, 0x00, 0x01, 0xed, 0x00,
+  0x7f, 0x52, 0x04, 0x72, 0x63, 0x69, 0x6d, 0x80, 0x00, 0x07, 0x69, 0x75,
+  0x62, 0x65, 0x6d, 0x6f, 0x68, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x65,
+  0x00, 0x7f, 0x6e, 0x00, 0x7f, 0x78, 0x07, 0x74, 0x6c, 0x75, 0x73, 0x6e,
+  0x6f, 0x63, 0x80, 0x00, 0x00, 0x00, 0x02, 0x64, 0x6d, 0x00, 0x7f, 0x83,
+  0x00, 0x7f, 0x89, 0x03, 0x75, 0x74, 0x73, 0x80, 0x00, 0x00, 0x00, 0x03,
+  0x65, 0x6e, 0x70, 0x00, 0x7f, 0x98, 0x00, 0x7f, 0x9f, 0x00, 0x7f, 0xbb,
+  0x04, 0x73, 0x75, 0x6d, 0x61, 0x80, 0x00, 0x00, 0x00, 0x02, 0x69, 0x72,
+  0x00, 0x7f, 0xaa, 0x00, 0x7f, 0xb4, 0x07, 0x61, 0x74, 0x72, 0x65, 0x74,
+  0x6e, 0x65, 0x80, 0x00, 0x04, 0x65, 0x76, 0x6f, 0x67, 0x80, 0x00, 0x04,
+  0x69, 0x75, 0x71, 0x65, 0x80, 0x00, 0x05, 0x6f, 0x70, 0x72, 0x69, 0x61,
+  0x80, 0x00, 0x01, 0x69, 0x00, 0x02, 0x6c, 0x74, 0x00, 0x7f, 0xd6, 0x00,
+  0x7f, 0xdf, 0x06, 0x61, 0x6e, 0x72, 0x75, 0x6f, 0x6a, 0x80, 0x00, 0x05,
+  0x6e, 0x65, 0x69, 0x63, 0x73, 0x80, 0x00, 0x00, 0x00, 0x02, 0x65, 0x6f,
+  0x00, 0x44, 0x49, 0x00, 0x24, 0xd0, 0x00, 0x00, 0x03, 0x63, 0x64, 0x74,
+  0x00, 0x80, 0x01, 0x00, 0x80, 0x0b, 0x00, 0x80, 0x13, 0x07, 0x6e, 0x65,
+  0x67, 0x72, 0x65, 0x6d, 0x65, 0x80, 0x00, 0x05, 0x6f, 0x62, 0x70, 0x65,
+  0x72, 0x80, 0x00, 0x04, 0x65, 0x66, 0x61, 0x73, 0x80, 0x00, 0x00, 0x80,
+  0x01, 0x2e, 0x00, 0x80, 0x21, 0x00, 0x00, 0x05, 0x61, 0x64, 0x67, 0x72,
+  0x77, 0x00, 0x80, 0x38, 0x00, 0x04, 0x75, 0x00, 0x38, 0x12, 0x00, 0x80,
+  0x43, 0x00, 0x26, 0x72, 0x00, 0x00, 0x02, 0x63, 0x70, 0x00, 0x02, 0xa9,
+  0x00, 0x01, 0x87, 0x00, 0x00, 0x02, 0x61, 0x75, 0x00, 0x1e, 0x64, 0x00,
+  0x3e, 0xd7, 0x00, 0x80, 0x01, 0x2e, 0x00, 0x80, 0x55, 0x00, 0x00, 0x03,
+  0x67, 0x6d, 0x74, 0x00, 0x01, 0x72, 0x00, 0x01, 0x82, 0x00, 0x01, 0x8f,
+  0x00, 0x00, 0x06, 0x67, 0x6a, 0x6b, 0x6d, 0x6e, 0x6f, 0x00, 0x80, 0x7f,
+  0x00, 0x80, 0xa1, 0x00, 0xcf, 0xb3, 0x00, 0x01, 0xed, 0x00, 0x07, 0xba,
+  0x00, 0x01, 0x82, 0x00, 0x80, 0x01, 0x2e, 0x00, 0x80, 0x86, 0x00, 0x00,
+  0x06, 0x67, 0x69, 0x6d, 0x6f, 0x74, 0x75, 0x00, 0x01, 0x72, 0x00, 0x03,
+  0x04, 0x00, 0x01, 0x82, 0x00, 0x0a, 0x52, 0x00, 0x01, 0x8f, 0x00, 0x01,
+  0x94, 0x00, 0x80, 0x01, 0x2e, 0x00, 0x80, 0xa8, 0x00, 0x40, 0x61, 0x15,
+  0x01, 0x00, 0x02, 0x03, 0x04, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x08, 0x00, 0x09, 0x0a, 0x00, 0x80, 0xdf,
+  0x00, 0x02, 0xa9, 0x00, 0xa8, 0xca, 0x00, 0xa8, 0xd5, 0x00, 0x05, 0xfa,
+  0x00, 0xad, 0xfa, 0x00, 0xbe, 0x1a, 0x00, 0xcd, 0xfc, 0x00, 0x0c, 0x9e,
+  0x00, 0xce, 0x07, 0x00, 0x40, 0x62, 0x18, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0x00, 0x06, 0x00, 0x00, 0x07, 0x00, 0x08, 0x00, 0x81, 0x13, 0x00, 0x84,
+  0x33, 0x00, 0x86, 0xbf, 0x00, 0x8e, 0x13, 0x00, 0x9c, 0xcc, 0x00, 0x9e,
+  0x67, 0x00, 0xa3, 0xc4, 0x00, 0xa8, 0xbf, 0x03, 0x69, 0x68, 0x63, 0x80,
+  0x01, 0x2e, 0x00, 0x81, 0x1d, 0x00, 0x00, 0x06, 0x61, 0x65, 0x69, 0x6e,
+  0x6f, 0x75, 0x00, 0x81, 0x38, 0x00, 0x82, 0x6b, 0x00, 0x82, 0x83, 0x00,
+  0x83, 0x35, 0x00, 0x83, 0x43, 0x00, 0x83, 0xf1, 0x00, 0x40, 0x62, 0x18,
+  0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x06, 0x00, 0x00, 0x07, 0x00, 0x08,
+  0x00, 0x81, 0x6c, 0x00, 0x67, 0x13, 0x00, 0x81, 0x77, 0x00, 0x81, 0x9b,
+  0x00, 0x81, 0xda, 0x00, 0x81, 0xee, 0x00, 0x82, 0x08, 0x00, 0x82, 0x4e,
+  0x08, 0x69, 0x68, 0x63, 0x69, 0x61, 0x6b, 0x6f, 0x79, 0x80, 0x00, 0x01,
+  0x61, 0x00, 0x02, 0x68, 0x79, 0x00, 0x01, 0x7d, 0x00, 0x81, 0x83, 0x01,
+  0x65, 0x00, 0x02, 0x72, 0x74, 0x00, 0x81, 0x8f, 0x00, 0x81, 0x96, 0x04,
+  0x61, 0x67, 0x61, 0x6e, 0x80, 0x00, 0x02, 0x61, 0x74, 0x80, 0x00, 0x00,
+  0x00, 0x02, 0x61, 0x75, 0x00, 0x81, 0xa6, 0x00, 0x81, 0xbc, 0x00, 0x00,
+  0x03, 0x62, 0x67, 0x68, 0x00, 0x45, 0x69, 0x00, 0x3d, 0x0e, 0x00, 0x81,
+  0xb5, 0x04, 0x69, 0x68, 0x63, 0x69, 0x80, 0x00, 0x00, 0x00, 0x03, 0x61,
+  0x6b, 0x75, 0x00, 0x81, 0xcb, 0x00, 0x22, 0x90, 0x00, 0x81, 0xd3, 0x05,
+  0x67, 0x65, 0x64, 0x6f, 0x73, 0x80, 0x00, 0x04, 0x73, 0x74, 0x61, 0x6b,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x6f, 0x75, 0x00, 0x03, 0x8e, 0x00, 0x81,
+  0xe5, 0x06, 0x66, 0x6f, 0x6d, 0x69, 0x68, 0x73, 0x80, 0x00, 0x00, 0x00,
+  0x02, 0x61, 0x69, 0x00, 0x81, 0xf9, 0x00, 0x82, 0x02, 0x06, 0x6d, 0x69,
+  0x68, 0x63, 0x61, 0x79, 0x80, 0x00, 0x03, 0x72, 0x61, 0x6e, 0x80, 0x00,
+  0x00, 0x00, 0x02, 0x61, 0x69, 0x00, 0x82, 0x13, 0x00, 0x82, 0x47, 0x00,
+  0x00, 0x03, 0x67, 0x6b, 0x7a, 0x00, 0x82, 0x22, 0x00, 0x81, 0xb5, 0x00,
+  0x82, 0x3f, 0x00, 0x00, 0x02, 0x69, 0x6f, 0x00, 0x82, 0x2d, 0x00, 0x82,
+  0x39, 0x01, 0x6d, 0x00, 0x02, 0x61, 0x6f, 0x00, 0x45, 0x0a, 0x00, 0x01,
+  0xed, 0x03, 0x6d, 0x61, 0x6b, 0x80, 0x00, 0x05, 0x75, 0x73, 0x74, 0x75,
+  0x6d, 0x80, 0x00, 0x04, 0x68, 0x73, 0x61, 0x6b, 0x80, 0x00, 0x00, 0x00,
+  0x02, 0x61, 0x69, 0x00, 0x82, 0x59, 0x00, 0x82, 0x61, 0x05, 0x67, 0x61,
+  0x6d, 0x61, 0x6b, 0x80, 0x00, 0x07, 0x6d, 0x6f, 0x6e, 0x69, 0x68, 0x63,
+  0x69, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x6e, 0x00, 0x82, 0x76, 0x00,
+  0x82, 0x7c, 0x03, 0x6b, 0x61, 0x73, 0x80, 0x00, 0x04, 0x61, 0x67, 0x6f,
+  0x74, 0x80, 0x00, 0x00, 0x40, 0x61, 0x15, 0x01, 0x00, 0x00, 0x00, 0x02,
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x08, 0x00, 0x82, 0xb4, 0x00, 0x82, 0xba, 0x00, 0x82,
+  0xc1, 0x00, 0x82, 0xe4, 0x00, 0x82, 0xf0, 0x00, 0x82, 0xf6, 0x00, 0x82,
+  0xfd, 0x00, 0x83, 0x2e, 0x03, 0x7a, 0x6e, 0x69, 0x80, 0x00, 0x04, 0x73,
+  0x6f, 0x68, 0x63, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x73, 0x00, 0x02,
+  0x2e, 0x00, 0x82, 0xcc, 0x00, 0x00, 0x02, 0x61, 0x6f, 0x00, 0x82, 0xd7,
+  0x00, 0x82, 0xdf, 0x05, 0x62, 0x61, 0x6e, 0x75, 0x66, 0x80, 0x00, 0x02,
+  0x68, 0x63, 0x80, 0x00, 0x01, 0x61, 0x00, 0x02, 0x74, 0x7a, 0x00, 0x02,
+  0x12, 0x00, 0x22, 0x0b, 0x03, 0x75, 0x73, 0x69, 0x80, 0x00, 0x04, 0x72,
+  0x69, 0x68, 0x73, 0x80, 0x00, 0x00, 0x00, 0x03, 0x61, 0x6f, 0x75, 0x00,
+  0x83, 0x0c, 0x00, 0x83, 0x1b, 0x00, 0x83, 0x26, 0x0c, 0x6b, 0x69, 0x68,
+  0x61, 0x62, 0x69, 0x68, 0x73, 0x6f, 0x6b, 0x6f, 0x79, 0x80, 0x00, 0x00,
+  0x00, 0x02, 0x64, 0x74, 0x00, 0x01, 0x7d, 0x00, 0x21, 0x4a, 0x05, 0x6b,
+  0x75, 0x6a, 0x75, 0x6b, 0x80, 0x00, 0x04, 0x73, 0x69, 0x68, 0x73, 0x80,
+  0x00, 0x03, 0x61, 0x6e, 0x6f, 0x00, 0x02, 0x68, 0x79, 0x00, 0x01, 0x87,
+  0x00, 0x05, 0x9d, 0x00, 0x40, 0x64, 0x16, 0x01, 0x00, 0x00, 0x00, 0x02,
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x05, 0x06,
+  0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x83, 0x75, 0x00, 0x83, 0x91, 0x00,
+  0x83, 0x9a, 0x00, 0x83, 0xb6, 0x00, 0x83, 0xc0, 0x00, 0x83, 0xcb, 0x00,
+  0x82, 0xdf, 0x00, 0x83, 0xe9, 0x00, 0x00, 0x02, 0x69, 0x75, 0x00, 0x83,
+  0x80, 0x00, 0x83, 0x8a, 0x07, 0x61, 0x6b, 0x75, 0x73, 0x74, 0x6f, 0x79,
+  0x80, 0x00, 0x04, 0x73, 0x74, 0x61, 0x6d, 0x80, 0x00, 0x06, 0x73, 0x6f,
+  0x6e, 0x68, 0x6f, 0x74, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x69, 0x00,
+  0x83, 0xa5, 0x00, 0x03, 0xa9, 0x00, 0x00, 0x02, 0x72, 0x74, 0x00, 0x83,
+  0xb0, 0x00, 0x01, 0xed, 0x03, 0x69, 0x68, 0x73, 0x80, 0x00, 0x07, 0x69,
+  0x68, 0x73, 0x61, 0x72, 0x61, 0x6e, 0x80, 0x00, 0x08, 0x6f, 0x62, 0x69,
+  0x6d, 0x61, 0x6e, 0x69, 0x6d, 0x80, 0x00, 0x02, 0x61, 0x73, 0x00, 0x02,
+  0x61, 0x69, 0x00, 0x83, 0xd8, 0x00, 0x83, 0xe3, 0x08, 0x72, 0x69, 0x68,
+  0x73, 0x69, 0x6d, 0x61, 0x6f, 0x80, 0x00, 0x03, 0x6d, 0x6f, 0x74, 0x80,
+  0x00, 0x05, 0x69, 0x68, 0x63, 0x61, 0x79, 0x80, 0x00, 0x00, 0x00, 0x03,
+  0x6b, 0x73, 0x7a, 0x00, 0x84, 0x00, 0x00, 0x84, 0x07, 0x00, 0x84, 0x2a,
+  0x04, 0x75, 0x6a, 0x6e, 0x6f, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x74,
+  0x00, 0x84, 0x12, 0x00, 0x84, 0x19, 0x04, 0x79, 0x61, 0x72, 0x75, 0x80,
+  0x00, 0x00, 0x00, 0x02, 0x69, 0x74, 0x00, 0x84, 0x24, 0x00, 0x7d, 0x4e,
+  0x03, 0x6d, 0x69, 0x6b, 0x80, 0x00, 0x06, 0x61, 0x72, 0x61, 0x73, 0x69,
+  0x6b, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x69, 0x00, 0x84, 0x3e, 0x00,
+  0x85, 0x8f, 0x01, 0x73, 0x80, 0x01, 0x2e, 0x00, 0x84, 0x46, 0x00, 0x00,
+  0x05, 0x61, 0x65, 0x69, 0x6e, 0x75, 0x00, 0x84, 0x5d, 0x00, 0x84, 0xbf,
+  0x00, 0x84, 0xda, 0x00, 0x85, 0x59, 0x00, 0x85, 0x60, 0x00, 0x00, 0x04,
+  0x67, 0x6d, 0x72, 0x74, 0x00, 0x22, 0x90, 0x00, 0x84, 0x70, 0x00, 0x81,
+  0x96, 0x00, 0x84, 0x92, 0x00, 0x00, 0x02, 0x61, 0x69, 0x00, 0x84, 0x7b,
+  0x00, 0x82, 0x47, 0x00, 0x00, 0x02, 0x74, 0x79, 0x00, 0x84, 0x86, 0x00,
+  0x84, 0x8d, 0x04, 0x61, 0x6d, 0x61, 0x68, 0x80, 0x00, 0x02, 0x69, 0x6b,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x69, 0x00, 0x84, 0x9d, 0x00, 0x84,
+  0xaf, 0x00, 0x00, 0x02, 0x67, 0x68, 0x00, 0x84, 0xa8, 0x00, 0x84, 0xa8,
+  0x04, 0x61, 0x74, 0x69, 0x6b, 0x80, 0x00, 0x02, 0x72, 0x61, 0x80, 0x01,
+  0x69, 0x00, 0x84, 0xb8, 0x04, 0x68, 0x73, 0x69, 0x6e, 0x80, 0x00, 0x00,
+  0x00, 0x02, 0x6b, 0x6e, 0x00, 0x84, 0xca, 0x00, 0x84, 0xd1, 0x04, 0x61,
+  0x69, 0x72, 0x61, 0x80, 0x00, 0x06, 0x69, 0x6d, 0x69, 0x6d, 0x61, 0x6b,
+  0x80, 0x00, 0x00, 0x00, 0x06, 0x61, 0x67, 0x68, 0x6b, 0x6d, 0x72, 0x00,
+  0x84, 0xf5, 0x00, 0x84, 0xfc, 0x00, 0x85, 0x0e, 0x00, 0x85, 0x32, 0x00,
+  0x85, 0x3a, 0x00, 0x85, 0x43, 0x04, 0x6b, 0x6e, 0x65, 0x67, 0x80, 0x00,
+  0x00, 0x00, 0x02, 0x61, 0x6f, 0x00, 0x85, 0x07, 0x00, 0x01, 0xed, 0x04,
+  0x72, 0x75, 0x79, 0x6b, 0x80, 0x00, 0x00, 0x00, 0x02, 0x63, 0x73, 0x00,
+  0x85, 0x19, 0x00, 0x85, 0x29, 0x00, 0x00, 0x02, 0x61, 0x75, 0x00, 0x85,
+  0x24, 0x00, 0x02, 0x12, 0x02, 0x6d, 0x6f, 0x80, 0x00, 0x06, 0x69, 0x6f,
+  0x72, 0x69, 0x68, 0x73, 0x80, 0x00, 0x05, 0x61, 0x7a, 0x6e, 0x61, 0x6b,
+  0x80, 0x00, 0x06, 0x6f, 0x64, 0x75, 0x6b, 0x75, 0x66, 0x80, 0x00, 0x01,
+  0x61, 0x00, 0x02, 0x67, 0x6d, 0x00, 0x85, 0x4f, 0x00, 0x02, 0x83, 0x07,
+  0x6f, 0x6e, 0x69, 0x68, 0x73, 0x6f, 0x79, 0x80, 0x00, 0x04, 0x65, 0x7a,
+  0x69, 0x68, 0x80, 0x00, 0x00, 0x00, 0x02, 0x6b, 0x73, 0x00, 0x85, 0x6b,
+  0x00, 0x85, 0x7d, 0x00, 0x00, 0x02, 0x61, 0x6f, 0x00, 0x03, 0x3c, 0x00,
+  0x85, 0x76, 0x04, 0x68, 0x75, 0x6f, 0x6b, 0x80, 0x00, 0x00, 0x00, 0x02,
+  0x6f, 0x74, 0x00, 0x03, 0x3c, 0x00, 0x85, 0x88, 0x04, 0x61, 0x72, 0x61,
+  0x6b, 0x80, 0x00, 0x02, 0x68, 0x73, 0x80, 0x01, 0x2e, 0x00, 0x85, 0x98,
+  0x00, 0x00, 0x07, 0x61, 0x65, 0x68, 0x69, 0x6e, 0x6f, 0x75, 0x00, 0x85,
+  0xb7, 0x00, 0x86, 0x01, 0x00, 0x86, 0x1c, 0x00, 0x86, 0x23, 0x00, 0x86,
+  0x5b, 0x00, 0x86, 0x72, 0x00, 0x86, 0x9e, 0x00, 0x00, 0x04, 0x6b, 0x6d,
+  0x72, 0x77, 0x00, 0x22, 0x0b, 0x00, 0x85, 0xca, 0x00, 0x85, 0xf0, 0x00,
+  0x85, 0xf8, 0x00, 0x00, 0x02, 0x61, 0x69, 0x00, 0x85, 0xd5, 0x00, 0x85,
+  0xe7, 0x00, 0x00, 0x02, 0x68, 0x79, 0x00, 0x81, 0x8f, 0x00, 0x85, 0xe0,
+  0x04, 0x69, 0x72, 0x6f, 0x6d, 0x80, 0x00, 0x06, 0x68, 0x73, 0x61, 0x6b,
+  0x61, 0x74, 0x80, 0x00, 0x05, 0x61, 0x62, 0x69, 0x61, 0x6d, 0x80, 0x00,
+  0x06, 0x61, 0x67, 0x6f, 0x74, 0x6f, 0x6e, 0x80, 0x00, 0x00, 0x00, 0x02,
+  0x6d, 0x6e, 0x00, 0x86, 0x0c, 0x00, 0x86, 0x15, 0x06, 0x69, 0x68, 0x61,
+  0x72, 0x6f, 0x74, 0x80, 0x00, 0x04, 0x6f, 0x6b, 0x69, 0x68, 0x80, 0x00,
+  0x04, 0x6f, 0x75, 0x79, 0x72, 0x80, 0x00, 0x00, 0x00, 0x04, 0x61, 0x65,
+  0x6b, 0x6d, 0x00, 0x86, 0x36, 0x00, 0x86, 0x40, 0x00, 0x86, 0x46, 0x00,
+  0x86, 0x50, 0x07, 0x7a, 0x61, 0x69, 0x68, 0x73, 0x69, 0x6e, 0x80, 0x00,
+  0x03, 0x73, 0x6f, 0x6b, 0x80, 0x00, 0x07, 0x75, 0x73, 0x74, 0x61, 0x6b,
+  0x61, 0x74, 0x80, 0x00, 0x08, 0x6f, 0x69, 0x68, 0x73, 0x61, 0x67, 0x69,
+  0x68, 0x80, 0x00, 0x01, 0x61, 0x00, 0x02, 0x6d, 0x6e, 0x00, 0x86, 0x67,
+  0x00, 0x22, 0x0b, 0x08, 0x69, 0x68, 0x63, 0x61, 0x68, 0x69, 0x6d, 0x6f,
+  0x80, 0x00, 0x00, 0x00, 0x03, 0x68, 0x6d, 0x74, 0x00, 0x86, 0x81, 0x00,
+  0x5b, 0xc2, 0x00, 0x86, 0x87, 0x03, 0x73, 0x69, 0x61, 0x80, 0x00, 0x00,
+  0x00, 0x03, 0x61, 0x6f, 0x74, 0x00, 0x86, 0x96, 0x00, 0x05, 0x9d, 0x00,
+  0x5f, 0x53, 0x05, 0x73, 0x6f, 0x79, 0x6f, 0x74, 0x80, 0x00, 0x01, 0x73,
+  0x00, 0x02, 0x61, 0x74, 0x00, 0x86, 0xaa, 0x00, 0x86, 0xae, 0x01, 0x79,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x6f, 0x00, 0x86, 0xb9, 0x00, 0x01,
+  0xed, 0x03, 0x73, 0x75, 0x6b, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x6f,
+  0x00, 0x86, 0xca, 0x00, 0x89, 0x70, 0x02, 0x73, 0x6f, 0x80, 0x01, 0x2e,
+  0x00, 0x86, 0xd3, 0x00, 0x00, 0x07, 0x61, 0x65, 0x68, 0x69, 0x6e, 0x6f,
+  0x75, 0x00, 0x86, 0xf2, 0x00, 0x88, 0x05, 0x00, 0x88, 0x1c, 0x00, 0x88,
+  0x23, 0x00, 0x88, 0xd1, 0x00, 0x88, 0xe9, 0x00, 0x89, 0x63, 0x00, 0x00,
+  0x06, 0x64, 0x6b, 0x6d, 0x72, 0x74, 0x77, 0x00, 0x87, 0x0d, 0x00, 0x87,
+  0x26, 0x00, 0x87, 0x76, 0x00, 0x87, 0x98, 0x00, 0x87, 0xc7, 0x00, 0x87,
+  0xe5, 0x00, 0x00, 0x02, 0x61, 0x65, 0x00, 0x87, 0x18, 0x00, 0x87, 0x21,
+  0x06, 0x77, 0x69, 0x68, 0x73, 0x69, 0x6b, 0x80, 0x00, 0x02, 0x6b, 0x69,
+  0x80, 0x00, 0x00, 0x00, 0x03, 0x61, 0x6f, 0x75, 0x00, 0x87, 0x35, 0x00,
+  0x87, 0x68, 0x00, 0x87, 0x6f, 0x00, 0x00, 0x02, 0x6e, 0x73, 0x00, 0x87,
+  0x40, 0x00, 0x87, 0x47, 0x04, 0x6f, 0x79, 0x6f, 0x74, 0x80, 0x00, 0x00,
+  0x00, 0x02, 0x61, 0x6f, 0x00, 0x87, 0x52, 0x00, 0x87, 0x5e, 0x09, 0x6b,
+  0x61, 0x61, 0x79, 0x61, 0x68, 0x69, 0x68, 0x63, 0x80, 0x00, 0x07, 0x69,
+  0x68, 0x73, 0x61, 0x67, 0x69, 0x68, 0x80, 0x00, 0x04, 0x61, 0x64, 0x61,
+  0x74, 0x80, 0x00, 0x04, 0x7a, 0x69, 0x61, 0x6b, 0x80, 0x00, 0x00, 0x00,
+  0x02, 0x61, 0x6f, 0x00, 0x87, 0x81, 0x00, 0x87, 0x92, 0x03, 0x79, 0x61,
+  0x73, 0x80, 0x01, 0x61, 0x00, 0x87, 0x8b, 0x04, 0x6b, 0x61, 0x73, 0x6f,
+  0x80, 0x00, 0x03, 0x64, 0x61, 0x6b, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61,
+  0x65, 0x00, 0x87, 0xa3, 0x00, 0x87, 0xbe, 0x00, 0x00, 0x02, 0x62, 0x77,
+  0x00, 0x87, 0xae, 0x00, 0x87, 0xb6, 0x05, 0x75, 0x73, 0x74, 0x61, 0x6d,
+  0x80, 0x00, 0x05, 0x69, 0x68, 0x73, 0x61, 0x6b, 0x80, 0x00, 0x06, 0x64,
+  0x69, 0x69, 0x6a, 0x75, 0x66, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x69,
+  0x00, 0x87, 0xd2, 0x00, 0x87, 0xda, 0x05, 0x6b, 0x61, 0x72, 0x69, 0x68,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x6b, 0x75, 0x00, 0x01, 0xed, 0x00, 0x03,
+  0x8e, 0x02, 0x61, 0x67, 0x00, 0x02, 0x61, 0x6f, 0x00, 0x87, 0xf2, 0x00,
+  0x87, 0xf8, 0x03, 0x79, 0x65, 0x6e, 0x80, 0x00, 0x0a, 0x64, 0x6f, 0x79,
+  0x69, 0x68, 0x73, 0x61, 0x67, 0x69, 0x68, 0x80, 0x00, 0x00, 0x00, 0x02,
+  0x73, 0x74, 0x00, 0x67, 0x13, 0x00, 0x88, 0x10, 0x09, 0x61, 0x77, 0x61,
+  0x6e, 0x6f, 0x6a, 0x69, 0x68, 0x73, 0x80, 0x00, 0x04, 0x6f, 0x6e, 0x69,
+  0x6d, 0x80, 0x00, 0x00, 0x00, 0x05, 0x61, 0x68, 0x6b, 0x6d, 0x72, 0x00,
+  0x82, 0x76, 0x00, 0x88, 0x3a, 0x00, 0x88, 0x8d, 0x00, 0x88, 0xb2, 0x00,
+  0x88, 0xb8, 0x00, 0x00, 0x02, 0x63, 0x73, 0x00, 0x88, 0x45, 0x00, 0x88,
+  0x4e, 0x06, 0x75, 0x67, 0x69, 0x72, 0x6f, 0x6d, 0x80, 0x00, 0x00, 0x00,
+  0x03, 0x61, 0x69, 0x6f, 0x00, 0x88, 0x5d, 0x00, 0x88, 0x68, 0x00, 0x88,
+  0x7e, 0x08, 0x79, 0x61, 0x62, 0x61, 0x64, 0x6e, 0x6f, 0x74, 0x80, 0x00,
+  0x00, 0x00, 0x02, 0x61, 0x6e, 0x00, 0x88, 0x73, 0x00, 0x01, 0xed, 0x00,
+  0x00, 0x02, 0x6b, 0x74, 0x00, 0x81, 0x96, 0x00, 0x01, 0xed, 0x0c, 0x79,
+  0x69, 0x6d, 0x75, 0x73, 0x69, 0x68, 0x73, 0x61, 0x67, 0x69, 0x68, 0x80,
+  0x00, 0x00, 0x00, 0x02, 0x61, 0x75, 0x00, 0x88, 0x98, 0x00, 0x88, 0xa9,
+  0x00, 0x00, 0x02, 0x72, 0x73, 0x00, 0x88, 0xa3, 0x00, 0x01, 0x7d, 0x03,
+  0x61, 0x62, 0x69, 0x80, 0x00, 0x06, 0x73, 0x74, 0x61, 0x6b, 0x61, 0x74,
+  0x80, 0x00, 0x03, 0x75, 0x7a, 0x69, 0x80, 0x00, 0x00, 0x00, 0x02, 0x69,
+  0x6f, 0x00, 0x88, 0xc3, 0x00, 0x88, 0xc9, 0x03, 0x6a, 0x61, 0x74, 0x80,
+  0x00, 0x05, 0x74, 0x61, 0x6d, 0x75, 0x6b, 0x80, 0x00, 0x02, 0x61, 0x6e,
+  0x00, 0x02, 0x61, 0x6e, 0x00, 0x05, 0x9d, 0x00, 0x88, 0xde, 0x00, 0x00,
+  0x02, 0x61, 0x65, 0x00, 0x3d, 0x0a, 0x00, 0x03, 0x8e, 0x00, 0x00, 0x04,
+  0x61, 0x6e, 0x74, 0x75, 0x00, 0x86, 0xaa, 0x00, 0x88, 0xfc, 0x00, 0x89,
+  0x40, 0x00, 0x82, 0xdf, 0x00, 0x00, 0x04, 0x61, 0x65, 0x69, 0x6f, 0x00,
+  0x89, 0x0f, 0x00, 0x03, 0xa9, 0x00, 0x89, 0x32, 0x00, 0x89, 0x3a, 0x00,
+  0x00, 0x03, 0x67, 0x73, 0x74, 0x00, 0x89, 0x1e, 0x00, 0x89, 0x2a, 0x00,
+  0x21, 0x4a, 0x09, 0x61, 0x6e, 0x69, 0x68, 0x63, 0x61, 0x77, 0x61, 0x6b,
+  0x80, 0x00, 0x05, 0x69, 0x6d, 0x75, 0x7a, 0x69, 0x80, 0x00, 0x05, 0x6b,
+  0x69, 0x62, 0x61, 0x68, 0x80, 0x00, 0x03, 0x79, 0x6f, 0x74, 0x80, 0x00,
+  0x00, 0x00, 0x03, 0x61, 0x69, 0x6f, 0x00, 0x89, 0x4f, 0x00, 0x89, 0x55,
+  0x00, 0x89, 0x5a, 0x03, 0x6e, 0x69, 0x6d, 0x80, 0x00, 0x02, 0x61, 0x64,
+  0x80, 0x00, 0x06, 0x6d, 0x61, 0x6d, 0x69, 0x68, 0x73, 0x80, 0x00, 0x02,
+  0x73, 0x74, 0x00, 0x02, 0x6f, 0x74, 0x00, 0x89, 0x2a, 0x00, 0x06, 0x56,
+  0x01, 0x75, 0x00, 0x02, 0x6b, 0x7a, 0x00, 0x89, 0x7c, 0x00, 0x8c, 0x4e,
+  0x02, 0x75, 0x66, 0x80, 0x01, 0x2e, 0x00, 0x89, 0x85, 0x00, 0x00, 0x06,
+  0x61, 0x65, 0x69, 0x6e, 0x6f, 0x75, 0x00, 0x89, 0xa0, 0x00, 0x8a, 0xa8,
+  0x00, 0x8a, 0xcf, 0x00, 0x8b, 0xab, 0x00, 0x8b, 0xc9, 0x00, 0x8c, 0x28,
+  0x00, 0x40, 0x64, 0x16, 0x01, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x04,
+  0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x07, 0x00, 0x00, 0x08,
+  0x00, 0x09, 0x00, 0x89, 0xd5, 0x00, 0x89, 0xe6, 0x00, 0x89, 0xfb, 0x00,
+  0x8a, 0x01, 0x00, 0x8a, 0x1a, 0x00, 0x8a, 0x37, 0x00, 0x8a, 0x3e, 0x00,
+  0x8a, 0x64, 0x00, 0x8a, 0x97, 0x00, 0x00, 0x02, 0x61, 0x65, 0x00, 0x89,
+  0xe0, 0x00, 0x1c, 0x25, 0x03, 0x6d, 0x61, 0x79, 0x80, 0x00, 0x00, 0x00,
+  0x03, 0x6e, 0x6f, 0x75, 0x00, 0x02, 0x12, 0x00, 0x05, 0x9d, 0x00, 0x89,
+  0xf5, 0x03, 0x73, 0x61, 0x6b, 0x80, 0x00, 0x03, 0x69, 0x6b, 0x75, 0x80,
+  0x00, 0x00, 0x00, 0x02, 0x61, 0x75, 0x00, 0x8a, 0x0c, 0x00, 0x8a, 0x14,
+  0x05, 0x77, 0x61, 0x79, 0x69, 0x6d, 0x80, 0x00, 0x03, 0x7a, 0x69, 0x69,
+  0x80, 0x00, 0x01, 0x61, 0x00, 0x02, 0x6b, 0x79, 0x00, 0x3d, 0x0e, 0x00,
+  0x8a, 0x26, 0x00, 0x00, 0x02, 0x61, 0x69, 0x00, 0x8a, 0x31, 0x00, 0x03,
+  0x40, 0x03, 0x73, 0x69, 0x68, 0x80, 0x00, 0x04, 0x61, 0x77, 0x61, 0x6b,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x75, 0x00, 0x8a, 0x49, 0x00, 0x85,
+  0x24, 0x00, 0x00, 0x02, 0x67, 0x6b, 0x00, 0x67, 0x13, 0x00, 0x8a, 0x54,
+  0x01, 0x61, 0x00, 0x03, 0x68, 0x6e, 0x74, 0x00, 0x01, 0xed, 0x00, 0x37,
+  0x55, 0x00, 0x01, 0xed, 0x01, 0x61, 0x00, 0x02, 0x67, 0x6b, 0x00, 0x8a,
+  0x70, 0x00, 0x8a, 0x8f, 0x00, 0x00, 0x02, 0x61, 0x69, 0x00, 0x8a, 0x7b,
+  0x00, 0x22, 0x90, 0x00, 0x00, 0x03, 0x6b, 0x6e, 0x74, 0x00, 0x3d, 0x0e,
+  0x00, 0x8a, 0x8a, 0x00, 0x01, 0xed, 0x02, 0x61, 0x79, 0x80, 0x00, 0x01,
+  0x6f, 0x80, 0x01, 0x72, 0x00, 0x5e, 0xe4, 0x00, 0x00, 0x02, 0x69, 0x75,
+  0x00, 0x8a, 0xa2, 0x00, 0x89, 0xf5, 0x03, 0x68, 0x73, 0x61, 0x80, 0x00,
+  0x00, 0x00, 0x03, 0x6d, 0x74, 0x75, 0x00, 0x8a, 0xb7, 0x00, 0x8a, 0xc8,
+  0x00, 0x03, 0x8e, 0x00, 0x00, 0x02, 0x61, 0x75, 0x00, 0x86, 0xaa, 0x00,
+  0x8a, 0xc2, 0x03, 0x72, 0x75, 0x6b, 0x80, 0x00, 0x04, 0x61, 0x72, 0x75,
+  0x6b, 0x80, 0x00, 0x00, 0x00, 0x07, 0x61, 0x67, 0x68, 0x6b, 0x6d, 0x72,
+  0x75, 0x00, 0x8a, 0xee, 0x00, 0x8b, 0x08, 0x00, 0x8b, 0x0f, 0x00, 0x8b,
+  0x3e, 0x00, 0x8b, 0x77, 0x00, 0x8b, 0x93, 0x00, 0x1f, 0x93, 0x00, 0x00,
+  0x02, 0x6e, 0x72, 0x00, 0x8a, 0xf9, 0x00, 0x8a, 0xff, 0x03, 0x6f, 0x68,
+  0x73, 0x80, 0x00, 0x06, 0x61, 0x69, 0x68, 0x63, 0x61, 0x74, 0x80, 0x00,
+  0x04, 0x6f, 0x72, 0x75, 0x6b, 0x80, 0x00, 0x00, 0x00, 0x02, 0x63, 0x73,
+  0x00, 0x8b, 0x1a, 0x00, 0x8b, 0x21, 0x04, 0x75, 0x6b, 0x75, 0x66, 0x80,
+  0x00, 0x00, 0x00, 0x02, 0x61, 0x69, 0x00, 0x8b, 0x2c, 0x00, 0x02, 0x03,
+  0x00, 0x00, 0x02, 0x67, 0x68, 0x00, 0x5e, 0xe4, 0x00, 0x8b, 0x37, 0x04,
+  0x75, 0x6b, 0x75, 0x79, 0x80, 0x00, 0x00, 0x00, 0x04, 0x61, 0x69, 0x6f,
+  0x75, 0x00, 0x8b, 0x51, 0x00, 0x8b, 0x69, 0x00, 0x01, 0xed, 0x00, 0x8b,
+  0x6f, 0x00, 0x00, 0x02, 0x67, 0x6d, 0x00, 0x8b, 0x5c, 0x00, 0x8b, 0x62,
+  0x03, 0x61, 0x6b, 0x6f, 0x80, 0x00, 0x04, 0x75, 0x7a, 0x69, 0x6d, 0x80,
+  0x00, 0x03, 0x75, 0x73, 0x74, 0x80, 0x00, 0x05, 0x73, 0x74, 0x61, 0x6e,
+  0x69, 0x80, 0x00, 0x00, 0x00, 0x03, 0x61, 0x6f, 0x75, 0x00, 0x89, 0x4f,
+  0x00, 0x8b, 0x86, 0x00, 0x01, 0xed, 0x0a, 0x74, 0x69, 0x68, 0x73, 0x6f,
+  0x79, 0x6e, 0x69, 0x68, 0x73, 0x80, 0x00, 0x00, 0x00, 0x02, 0x6f, 0x75,
+  0x00, 0x8b, 0x9e, 0x00, 0x8b, 0xa3, 0x02, 0x67, 0x6f, 0x80, 0x00, 0x05,
+  0x67, 0x61, 0x73, 0x61, 0x73, 0x80, 0x00, 0x01, 0x65, 0x00, 0x02, 0x73,
+  0x7a, 0x00, 0x8b, 0xb7, 0x00, 0x8b, 0xbd, 0x03, 0x69, 0x65, 0x6b, 0x80,
+  0x00, 0x01, 0x75, 0x00, 0x02, 0x62, 0x6b, 0x00, 0x01, 0xed, 0x00, 0x46,
+  0x4e, 0x00, 0x00, 0x07, 0x67, 0x68, 0x6a, 0x6b, 0x6e, 0x74, 0x75, 0x00,
+  0x8b, 0xe8, 0x00, 0x8b, 0xf0, 0x00, 0x8c, 0x06, 0x00, 0x8c, 0x16, 0x00,
+  0x8c, 0x1d, 0x00, 0x02, 0x12, 0x00, 0x82, 0xdf, 0x05, 0x75, 0x6b, 0x69,
+  0x68, 0x63, 0x80, 0x00, 0x00, 0x00, 0x03, 0x61, 0x6f, 0x75, 0x00, 0x05,
+  0x9d, 0x00, 0x03, 0x3c, 0x00, 0x8b, 0xff, 0x04, 0x6b, 0x69, 0x68, 0x63,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x6f, 0x75, 0x00, 0x8c, 0x11, 0x00, 0x8b,
+  0xff, 0x02, 0x6e, 0x6f, 0x80, 0x00, 0x04, 0x61, 0x79, 0x69, 0x6d, 0x80,
+  0x00, 0x08, 0x69, 0x68, 0x73, 0x75, 0x6b, 0x69, 0x68, 0x63, 0x80, 0x00,
+  0x00, 0x00, 0x03, 0x66, 0x67, 0x73, 0x00, 0x8c, 0x37, 0x00, 0x8c, 0x3f,
+  0x00, 0x8c, 0x46, 0x05, 0x69, 0x61, 0x7a, 0x61, 0x64, 0x80, 0x00, 0x04,
+  0x6e, 0x69, 0x68, 0x73, 0x80, 0x00, 0x05, 0x74, 0x6f, 0x79, 0x6f, 0x74,
+  0x80, 0x00, 0x03, 0x69, 0x68, 0x73, 0x80, 0x01, 0x2e, 0x00, 0x8c, 0x58,
+  0x00, 0x00, 0x05, 0x61, 0x69, 0x6e, 0x6f, 0x75, 0x00, 0x8c, 0x6f, 0x00,
+  0x8d, 0x33, 0x00, 0x8d, 0x98, 0x00, 0x8d, 0xa3, 0x00, 0x8d, 0xb5, 0x00,
+  0x40, 0x62, 0x18, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00,
+  0x07, 0x00, 0x08, 0x00, 0x8c, 0xa3, 0x00, 0x8c, 0xab, 0x00, 0x8c, 0xd3,
+  0x00, 0x8c, 0xdc, 0x00, 0x8c, 0xe4, 0x00, 0x8c, 0xff, 0x00, 0x8d, 0x05,
+  0x00, 0x8d, 0x28, 0x05, 0x6d, 0x65, 0x74, 0x6f, 0x67, 0x80, 0x00, 0x00,
+  0x00, 0x04, 0x61, 0x65, 0x69, 0x6f, 0x00, 0x8c, 0xbe, 0x00, 0x8c, 0xc5,
+  0x00, 0x8c, 0xcc, 0x00, 0x8c, 0xbe, 0x04, 0x6d, 0x69, 0x68, 0x73, 0x80,
+  0x00, 0x04, 0x69, 0x6a, 0x75, 0x66, 0x80, 0x00, 0x04, 0x68, 0x73, 0x6f,
+  0x79, 0x80, 0x00, 0x06, 0x6f, 0x75, 0x7a, 0x69, 0x68, 0x73, 0x80, 0x00,
+  0x05, 0x69, 0x68, 0x73, 0x69, 0x6d, 0x80, 0x00, 0x01, 0x61, 0x00, 0x02,
+  0x62, 0x68, 0x00, 0x8c, 0xf0, 0x00, 0x8c, 0xf6, 0x03, 0x69, 0x61, 0x68,
+  0x80, 0x00, 0x06, 0x6f, 0x6e, 0x69, 0x6b, 0x61, 0x6d, 0x80, 0x00, 0x03,
+  0x61, 0x77, 0x69, 0x80, 0x00, 0x01, 0x61, 0x00, 0x02, 0x67, 0x6b, 0x00,
+  0x8d, 0x11, 0x00, 0x8c, 0xc5, 0x00, 0x00, 0x02, 0x65, 0x75, 0x00, 0x8d,
+  0x1c, 0x00, 0x8d, 0x22, 0x03, 0x6b, 0x61, 0x6b, 0x80, 0x00, 0x03, 0x6b,
+  0x69, 0x6b, 0x80, 0x00, 0x08, 0x69, 0x6d, 0x6f, 0x6e, 0x69, 0x6a, 0x75,
+  0x66, 0x80, 0x00, 0x00, 0x00, 0x07, 0x61, 0x68, 0x6a, 0x6b, 0x6d, 0x6e,
+  0x6f, 0x00, 0x8d, 0x52, 0x00, 0x8d, 0x5d, 0x00, 0x7d, 0x4e, 0x00, 0x8d,
+  0x67, 0x00, 0x8d, 0x74, 0x00, 0x8d, 0x86, 0x00, 0x8d, 0x90, 0x00, 0x00,
+  0x02, 0x72, 0x73, 0x00, 0x02, 0xa9, 0x00, 0x22, 0x0b, 0x07, 0x63, 0x61,
+  0x6d, 0x69, 0x72, 0x6f, 0x6d, 0x80, 0x00, 0x02, 0x61, 0x7a, 0x00, 0x02,
+  0x65, 0x75, 0x00, 0x35, 0x37, 0x00, 0x83, 0x8a, 0x01, 0x61, 0x00, 0x02,
+  0x6e, 0x74, 0x00, 0x8d, 0x80, 0x00, 0x02, 0xa9, 0x03, 0x6e, 0x61, 0x6b,
+  0x80, 0x00, 0x07, 0x75, 0x6b, 0x6f, 0x6e, 0x75, 0x7a, 0x69, 0x80, 0x00,
+  0x05, 0x72, 0x75, 0x6b, 0x75, 0x66, 0x80, 0x00, 0x08, 0x6f, 0x68, 0x65,
+  0x6e, 0x61, 0x77, 0x61, 0x6b, 0x80, 0x00, 0x00, 0x00, 0x02, 0x6e, 0x74,
+  0x00, 0x8d, 0xae, 0x00, 0x02, 0x83, 0x04, 0x6f, 0x73, 0x75, 0x73, 0x80,
+  0x00, 0x00, 0x00, 0x02, 0x73, 0x7a, 0x00, 0x8d, 0xc0, 0x00, 0x8d, 0xca,
+  0x07, 0x74, 0x61, 0x6d, 0x61, 0x6d, 0x61, 0x68, 0x80, 0x00, 0x00, 0x00,
+  0x02, 0x61, 0x69, 0x00, 0x8d, 0xd5, 0x00, 0x8d, 0xe0, 0x00, 0x00, 0x02,
+  0x6d, 0x77, 0x00, 0x3c, 0xce, 0x00, 0x21, 0x4a, 0x00, 0x80, 0x03, 0x61,
+  0x69, 0x6d, 0x00, 0x86, 0xaa, 0x00, 0x8d, 0xef, 0x00, 0x83, 0xb0, 0x00,
+  0x00, 0x02, 0x68, 0x6d, 0x00, 0x8d, 0xfa, 0x00, 0x8e, 0x0c, 0x01, 0x73,
+  0x00, 0x02, 0x61, 0x69, 0x00, 0x8e, 0x06, 0x00, 0x02, 0x03, 0x03, 0x67,
+  0x69, 0x68, 0x80, 0x00, 0x04, 0x61, 0x6e, 0x69, 0x6d, 0x80, 0x00, 0x00,
+  0x00, 0x03, 0x61, 0x69, 0x6e, 0x00, 0x8e, 0x22, 0x00, 0x95, 0x5c, 0x00,
+  0x9a, 0xfb, 0x00, 0x00, 0x03, 0x68, 0x74, 0x79, 0x00, 0x8e, 0x31, 0x00,
+  0x8e, 0x43, 0x00, 0x91, 0x5a, 0x04, 0x6f, 0x6b, 0x6f, 0x79, 0x82, 0x01,
+  0x2e, 0x00, 0x8e, 0x3c, 0x04, 0x79, 0x74, 0x69, 0x63, 0x81, 0x00, 0x03,
+  0x69, 0x61, 0x73, 0x80, 0x01, 0x2e, 0x00, 0x8e, 0x4d, 0x00, 0x00, 0x06,
+  0x61, 0x65, 0x69, 0x6e, 0x6f, 0x75, 0x00, 0x8e, 0x68, 0x00, 0x8f, 0xb7,
+  0x00, 0x8f, 0xf2, 0x00, 0x90, 0x89, 0x00, 0x90, 0x91, 0x00, 0x91, 0x2d,
+  0x00, 0x00, 0x07, 0x64, 0x6b, 0x6d, 0x6e, 0x77, 0x79, 0x7a, 0x00, 0x8e,
+  0x87, 0x00, 0x8e, 0x9c, 0x00, 0x8e, 0xbd, 0x00, 0x02, 0x83, 0x00, 0x8f,
+  0x20, 0x00, 0x8f, 0x79, 0x00, 0x8f, 0xb1, 0x00, 0x00, 0x03, 0x69, 0x6f,
+  0x75, 0x00, 0x8c, 0xcc, 0x00, 0x03, 0x3c, 0x00, 0x8e, 0x96, 0x03, 0x73,
+  0x61, 0x68, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x6f, 0x00, 0x8e, 0xa7,
+  0x00, 0x8e, 0xb2, 0x00, 0x00, 0x02, 0x64, 0x73, 0x00, 0x5e, 0xe4, 0x00,
+  0x02, 0xa9, 0x00, 0x00, 0x02, 0x61, 0x73, 0x00, 0x82, 0xf6, 0x00, 0x01,
+  0xed, 0x00, 0x00, 0x03, 0x61, 0x69, 0x75, 0x00, 0x8e, 0xcc, 0x00, 0x8f,
+  0x05, 0x00, 0x8f, 0x1b, 0x00, 0x00, 0x02, 0x74, 0x79, 0x00, 0x8e, 0xd7,
+  0x00, 0x8e, 0xdd, 0x03, 0x69, 0x61, 0x73, 0x80, 0x00, 0x00, 0x00, 0x03,
+  0x61, 0x6f, 0x75, 0x00, 0x03, 0x8e, 0x00, 0x8e, 0xec, 0x00, 0x8e, 0xf7,
+  0x00, 0x00, 0x02, 0x72, 0x74, 0x00, 0x45, 0x69, 0x00, 0x66, 0x39, 0x0b,
+  0x73, 0x74, 0x61, 0x6d, 0x69, 0x68, 0x73, 0x61, 0x67, 0x69, 0x68, 0x80,
+  0x00, 0x00, 0x00, 0x02, 0x68, 0x6a, 0x00, 0x8f, 0x10, 0x00, 0x8a, 0x37,
+  0x08, 0x73, 0x61, 0x67, 0x75, 0x72, 0x75, 0x73, 0x74, 0x80, 0x00, 0x02,
+  0x72, 0x69, 0x80, 0x00, 0x01, 0x61, 0x00, 0x04, 0x67, 0x6b, 0x72, 0x7a,
+  0x00, 0x8f, 0x34, 0x00, 0x8f, 0x54, 0x00, 0x07, 0xb6, 0x00, 0x8f, 0x70,
+  0x00, 0x00, 0x03, 0x65, 0x69, 0x6f, 0x00, 0x8f, 0x43, 0x00, 0x8f, 0x4e,
+  0x00, 0x01, 0xed, 0x00, 0x00, 0x02, 0x6b, 0x6d, 0x00, 0x02, 0x12, 0x00,
+  0x3d, 0x0e, 0x03, 0x6b, 0x6f, 0x74, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61,
+  0x69, 0x00, 0x44, 0x3d, 0x00, 0x8f, 0x5f, 0x00, 0x00, 0x02, 0x68, 0x6d,
+  0x00, 0x8f, 0x6a, 0x00, 0x21, 0x4a, 0x03, 0x73, 0x6f, 0x79, 0x80, 0x00,
+  0x06, 0x6f, 0x72, 0x6f, 0x6b, 0x6f, 0x74, 0x80, 0x00, 0x00, 0x00, 0x02,
+  0x61, 0x69, 0x00, 0x8f, 0x84, 0x00, 0x85, 0x24, 0x00, 0x00, 0x02, 0x67,
+  0x6b, 0x00, 0x8f, 0x8f, 0x00, 0x7d, 0x4e, 0x00, 0x00, 0x03, 0x61, 0x69,
+  0x6f, 0x00, 0x8f, 0x9e, 0x00, 0x8f, 0xa4, 0x00, 0x8f, 0xab, 0x03, 0x6d,
+  0x75, 0x6b, 0x80, 0x00, 0x04, 0x68, 0x73, 0x6f, 0x6b, 0x80, 0x00, 0x03,
+  0x74, 0x61, 0x68, 0x80, 0x00, 0x03, 0x69, 0x69, 0x6e, 0x80, 0x00, 0x00,
+  0x00, 0x05, 0x62, 0x6f, 0x73, 0x74, 0x7a, 0x00, 0x8f, 0xce, 0x00, 0x8f,
+  0xd7, 0x00, 0x8f, 0xdf, 0x00, 0x8f, 0xe5, 0x00, 0x8f, 0xeb, 0x06, 0x61,
+  0x6b, 0x75, 0x73, 0x61, 0x6b, 0x80, 0x00, 0x05, 0x67, 0x61, 0x77, 0x61,
+  0x6b, 0x80, 0x00, 0x03, 0x6f, 0x67, 0x6f, 0x80, 0x00, 0x03, 0x74, 0x61,
+  0x73, 0x80, 0x00, 0x04, 0x6f, 0x6b, 0x6f, 0x79, 0x80, 0x00, 0x00, 0x00,
+  0x05, 0x62, 0x68, 0x69, 0x6b, 0x6d, 0x00, 0x90, 0x09, 0x00, 0x90, 0x10,
+  0x00, 0x3a, 0xef, 0x00, 0x90, 0x3e, 0x00, 0x90, 0x5f, 0x04, 0x61, 0x72,
+  0x61, 0x77, 0x80, 0x00, 0x00, 0x00, 0x02, 0x63, 0x73, 0x00, 0x90, 0x1b,
+  0x00, 0x90, 0x24, 0x06, 0x75, 0x67, 0x61, 0x77, 0x61, 0x6b, 0x80, 0x00,
+  0x00, 0x00, 0x02, 0x6f, 0x75, 0x00, 0x90, 0x2f, 0x00, 0x90, 0x35, 0x03,
+  0x79, 0x69, 0x6d, 0x80, 0x00, 0x06, 0x62, 0x75, 0x73, 0x74, 0x61, 0x6d,
+  0x80, 0x00, 0x00, 0x00, 0x03, 0x61, 0x69, 0x75, 0x00, 0x10, 0xc9, 0x00,
+  0x24, 0xd0, 0x00, 0x90, 0x4d, 0x00, 0x00, 0x02, 0x6b, 0x73, 0x00, 0x01,
+  0xed, 0x00, 0x90, 0x58, 0x04, 0x74, 0x61, 0x77, 0x69, 0x80, 0x00, 0x00,
+  0x00, 0x03, 0x61, 0x69, 0x75, 0x00, 0x90, 0x6e, 0x00, 0x90, 0x75, 0x00,
+  0x90, 0x80, 0x04, 0x6b, 0x6f, 0x79, 0x72, 0x80, 0x00, 0x00, 0x00, 0x02,
+  0x68, 0x6a, 0x00, 0x8f, 0x6a, 0x00, 0x7d, 0x4e, 0x06, 0x7a, 0x69, 0x69,
+  0x6d, 0x61, 0x6b, 0x80, 0x00, 0x05, 0x61, 0x7a, 0x6e, 0x61, 0x72, 0x80,
+  0x00, 0x00, 0x00, 0x07, 0x64, 0x69, 0x6a, 0x6e, 0x72, 0x74, 0x7a, 0x00,
+  0x90, 0xb0, 0x00, 0x90, 0xb7, 0x00, 0x90, 0xbe, 0x00, 0x90, 0xc4, 0x00,
+  0x90, 0xea, 0x00, 0x91, 0x06, 0x00, 0x21, 0x4a, 0x04, 0x61, 0x6b, 0x61,
+  0x73, 0x80, 0x00, 0x04, 0x68, 0x73, 0x61, 0x79, 0x80, 0x00, 0x03, 0x6e,
+  0x6f, 0x68, 0x80, 0x00, 0x00, 0x00, 0x04, 0x61, 0x69, 0x6e, 0x6f, 0x00,
+  0x90, 0xd7, 0x00, 0x90, 0xe2, 0x00, 0x66, 0x39, 0x00, 0x86, 0xaa, 0x00,
+  0x00, 0x02, 0x67, 0x6e, 0x00, 0x02, 0x12, 0x00, 0x01, 0x7d, 0x05, 0x6d,
+  0x69, 0x6a, 0x75, 0x66, 0x80, 0x00, 0x00, 0x00, 0x02, 0x69, 0x6f, 0x00,
+  0x90, 0xf5, 0x00, 0x90, 0xfe, 0x06, 0x68, 0x73, 0x61, 0x79, 0x69, 0x6d,
+  0x80, 0x00, 0x05, 0x74, 0x61, 0x67, 0x61, 0x6e, 0x80, 0x00, 0x00, 0x00,
+  0x03, 0x61, 0x69, 0x6f, 0x00, 0x91, 0x15, 0x00, 0x91, 0x1f, 0x00, 0x91,
+  0x25, 0x03, 0x73, 0x69, 0x6d, 0x80, 0x01, 0x61, 0x00, 0x05, 0x9d, 0x03,
+  0x67, 0x75, 0x73, 0x80, 0x00, 0x05, 0x6d, 0x61, 0x74, 0x69, 0x6b, 0x80,
+  0x00, 0x00, 0x00, 0x03, 0x62, 0x73, 0x79, 0x00, 0x91, 0x3c, 0x00, 0x91,
+  0x52, 0x00, 0x45, 0x0a, 0x06, 0x69, 0x68, 0x63, 0x69, 0x68, 0x63, 0x80,
+  0x01, 0x69, 0x00, 0x91, 0x49, 0x06, 0x68, 0x73, 0x61, 0x67, 0x69, 0x68,
+  0x80, 0x00, 0x05, 0x6f, 0x6e, 0x75, 0x6f, 0x6b, 0x80, 0x00, 0x00, 0x00,
+  0x02, 0x61, 0x6f, 0x00, 0x91, 0x65, 0x00, 0x94, 0x37, 0x01, 0x6b, 0x00,
+  0x02, 0x61, 0x6f, 0x00, 0x91, 0x71, 0x00, 0x92, 0xe4, 0x01, 0x77, 0x80,
+  0x01, 0x2e, 0x00, 0x91, 0x79, 0x00, 0x00, 0x06, 0x61, 0x65, 0x69, 0x6e,
+  0x6f, 0x75, 0x00, 0x91, 0x94, 0x00, 0x92, 0x6d, 0x00, 0x92, 0x7f, 0x00,
+  0x92, 0xa4, 0x00, 0x92, 0xac, 0x00, 0x92, 0xdc, 0x00, 0x40, 0x64, 0x17,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x07, 0x08, 0x00,
+  0x91, 0xc7, 0x00, 0x91, 0xdb, 0x00, 0x91, 0xe2, 0x00, 0x92, 0x1a, 0x00,
+  0x92, 0x32, 0x00, 0x92, 0x38, 0x00, 0x22, 0x0b, 0x00, 0x22, 0x0b, 0x00,
+  0x00, 0x02, 0x69, 0x6e, 0x00, 0x44, 0x3d, 0x00, 0x91, 0xd2, 0x06, 0x6f,
+  0x74, 0x69, 0x6d, 0x61, 0x6b, 0x80, 0x00, 0x04, 0x61, 0x64, 0x69, 0x68,
+  0x80, 0x00, 0x01, 0x61, 0x00, 0x02, 0x68, 0x79, 0x00, 0x91, 0xee, 0x00,
+  0x91, 0xf9, 0x00, 0x00, 0x02, 0x61, 0x69, 0x00, 0x82, 0xf6, 0x00, 0x03,
+  0x40, 0x00, 0x00, 0x02, 0x61, 0x6f, 0x00, 0x92, 0x04, 0x00, 0x92, 0x14,
+  0x00, 0x00, 0x02, 0x6b, 0x74, 0x00, 0x92, 0x0f, 0x00, 0x84, 0x8d, 0x02,
+  0x61, 0x77, 0x80, 0x00, 0x03, 0x64, 0x75, 0x6b, 0x80, 0x00, 0x01, 0x75,
+  0x00, 0x02, 0x75, 0x79, 0x00, 0x92, 0x26, 0x00, 0x01, 0xed, 0x09, 0x73,
+  0x74, 0x61, 0x6b, 0x69, 0x68, 0x63, 0x61, 0x6e, 0x80, 0x00, 0x03, 0x61,
+  0x75, 0x79, 0x80, 0x00, 0x01, 0x61, 0x00, 0x02, 0x67, 0x6b, 0x00, 0x92,
+  0x44, 0x00, 0x92, 0x66, 0x00, 0x00, 0x02, 0x61, 0x6f, 0x00, 0x92, 0x4f,
+  0x00, 0x92, 0x60, 0x00, 0x00, 0x02, 0x64, 0x7a, 0x00, 0x92, 0x5a, 0x00,
+  0x22, 0x0b, 0x03, 0x69, 0x72, 0x61, 0x80, 0x00, 0x03, 0x72, 0x69, 0x68,
+  0x80, 0x00, 0x04, 0x6f, 0x6e, 0x69, 0x6b, 0x80, 0x00, 0x00, 0x00, 0x02,
+  0x62, 0x64, 0x00, 0x92, 0x78, 0x00, 0x8c, 0xff, 0x04, 0x61, 0x6e, 0x61,
+  0x74, 0x80, 0x00, 0x00, 0x00, 0x03, 0x67, 0x6a, 0x6d, 0x00, 0x92, 0x8e,
+  0x00, 0x92, 0x98, 0x00, 0x92, 0x9e, 0x07, 0x61, 0x72, 0x75, 0x73, 0x74,
+  0x61, 0x6b, 0x80, 0x00, 0x03, 0x69, 0x61, 0x74, 0x80, 0x00, 0x03, 0x61,
+  0x6e, 0x69, 0x80, 0x00, 0x05, 0x61, 0x6e, 0x69, 0x61, 0x6b, 0x80, 0x00,
+  0x00, 0x00, 0x03, 0x62, 0x6e, 0x74, 0x00, 0x01, 0x99, 0x00, 0x92, 0xbb,
+  0x00, 0x92, 0xc2, 0x04, 0x69, 0x6d, 0x69, 0x6b, 0x80, 0x00, 0x00, 0x00,
+  0x02, 0x61, 0x6f, 0x00, 0x3a, 0x30, 0x00, 0x92, 0xcd, 0x04, 0x6d, 0x69,
+  0x68, 0x73, 0x00, 0x02, 0x61, 0x75, 0x00, 0x3d, 0x0a, 0x00, 0x05, 0x9d,
+  0x05, 0x67, 0x6e, 0x69, 0x68, 0x73, 0x80, 0x00, 0x00, 0x80, 0x01, 0x2e,
+  0x00, 0x92, 0xeb, 0x00, 0x00, 0x05, 0x61, 0x65, 0x69, 0x6e, 0x6f, 0x00,
+  0x93, 0x02, 0x00, 0x93, 0x78, 0x00, 0x93, 0x8a, 0x00, 0x93, 0xdd, 0x00,
+  0x93, 0xf6, 0x00, 0x00, 0x05, 0x6a, 0x6b, 0x6d, 0x72, 0x77, 0x00, 0x1c,
+  0x25, 0x00, 0x93, 0x19, 0x00, 0x93, 0x21, 0x00, 0x93, 0x4b, 0x00, 0x93,
+  0x67, 0x05, 0x6f, 0x61, 0x73, 0x61, 0x6b, 0x80, 0x00, 0x00, 0x00, 0x02,
+  0x61, 0x69, 0x00, 0x93, 0x2c, 0x00, 0x93, 0x42, 0x01, 0x79, 0x00, 0x02,
+  0x61, 0x75, 0x00, 0x93, 0x38, 0x00, 0x93, 0x3d, 0x02, 0x6b, 0x6f, 0x80,
+  0x00, 0x02, 0x73, 0x74, 0x80, 0x00, 0x06, 0x68, 0x73, 0x61, 0x79, 0x61,
+  0x68, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x75, 0x00, 0x93, 0x56, 0x00,
+  0x93, 0x5b, 0x02, 0x62, 0x69, 0x80, 0x00, 0x09, 0x6b, 0x61, 0x77, 0x61,
+  0x69, 0x68, 0x73, 0x69, 0x6e, 0x80, 0x00, 0x01, 0x69, 0x00, 0x02, 0x61,
+  0x6e, 0x00, 0x93, 0x73, 0x00, 0x22, 0xab, 0x02, 0x6b, 0x61, 0x80, 0x00,
+  0x00, 0x00, 0x02, 0x67, 0x6b, 0x00, 0x93, 0x83, 0x00, 0x92, 0x0f, 0x04,
+  0x61, 0x6b, 0x61, 0x79, 0x80, 0x00, 0x00, 0x00, 0x04, 0x67, 0x68, 0x6b,
+  0x6d, 0x00, 0x3d, 0x0e, 0x00, 0x93, 0x9d, 0x00, 0x93, 0xc9, 0x00, 0x8f,
+  0xb1, 0x00, 0x00, 0x02, 0x63, 0x73, 0x00, 0x93, 0xa8, 0x00, 0x93, 0xc0,
+  0x01, 0x75, 0x00, 0x02, 0x6b, 0x6f, 0x00, 0x93, 0xb4, 0x00, 0x93, 0xba,
+  0x03, 0x61, 0x73, 0x61, 0x80, 0x00, 0x03, 0x74, 0x65, 0x73, 0x80, 0x00,
+  0x06, 0x61, 0x68, 0x61, 0x6b, 0x61, 0x74, 0x80, 0x00, 0x00, 0x00, 0x02,
+  0x61, 0x69, 0x00, 0x3a, 0x30, 0x00, 0x93, 0xd4, 0x06, 0x68, 0x73, 0x61,
+  0x72, 0x75, 0x6b, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x65, 0x00, 0x93,
+  0xe8, 0x00, 0x93, 0xf0, 0x05, 0x6e, 0x65, 0x6d, 0x75, 0x6b, 0x80, 0x00,
+  0x03, 0x7a, 0x69, 0x62, 0x80, 0x00, 0x00, 0x00, 0x05, 0x68, 0x6a, 0x6e,
+  0x6f, 0x75, 0x00, 0x94, 0x0d, 0x00, 0x8c, 0x3f, 0x00, 0x94, 0x15, 0x00,
+  0x24, 0xd0, 0x00, 0x94, 0x2e, 0x05, 0x73, 0x6f, 0x74, 0x61, 0x73, 0x80,
+  0x00, 0x00, 0x00, 0x02, 0x61, 0x69, 0x00, 0x94, 0x20, 0x00, 0x94, 0x26,
+  0x03, 0x6d, 0x61, 0x74, 0x80, 0x00, 0x05, 0x6d, 0x61, 0x67, 0x61, 0x6b,
+  0x80, 0x00, 0x06, 0x68, 0x63, 0x69, 0x62, 0x69, 0x6b, 0x80, 0x00, 0x01,
+  0x74, 0x80, 0x01, 0x2e, 0x00, 0x94, 0x3f, 0x00, 0x00, 0x06, 0x61, 0x65,
+  0x69, 0x6e, 0x6f, 0x75, 0x00, 0x94, 0x5a, 0x00, 0x94, 0xbf, 0x00, 0x94,
+  0xd0, 0x00, 0x95, 0x1e, 0x00, 0x95, 0x26, 0x00, 0x95, 0x2d, 0x00, 0x00,
+  0x07, 0x64, 0x67, 0x6b, 0x6d, 0x6e, 0x72, 0x77, 0x00, 0x94, 0x79, 0x00,
+  0x3d, 0xa3, 0x00, 0x94, 0x80, 0x00, 0x94, 0x88, 0x00, 0x94, 0x9b, 0x00,
+  0x92, 0x98, 0x00, 0x94, 0xa2, 0x04, 0x61, 0x6d, 0x61, 0x79, 0x80, 0x00,
+  0x05, 0x6f, 0x61, 0x6b, 0x61, 0x74, 0x80, 0x00, 0x02, 0x61, 0x79, 0x00,
+  0x02, 0x65, 0x6f, 0x00, 0x94, 0x95, 0x00, 0x03, 0x3c, 0x03, 0x74, 0x61,
+  0x74, 0x80, 0x00, 0x04, 0x61, 0x68, 0x6f, 0x6a, 0x80, 0x00, 0x03, 0x61,
+  0x6b, 0x69, 0x00, 0x02, 0x69, 0x72, 0x00, 0x94, 0xb0, 0x00, 0x94, 0xb8,
+  0x05, 0x6e, 0x61, 0x6b, 0x61, 0x6e, 0x80, 0x00, 0x04, 0x65, 0x6d, 0x61,
+  0x6e, 0x80, 0x00, 0x01, 0x62, 0x00, 0x02, 0x61, 0x6f, 0x00, 0x94, 0xcb,
+  0x00, 0x8a, 0xc2, 0x02, 0x79, 0x6f, 0x80, 0x00, 0x00, 0x00, 0x03, 0x68,
+  0x6b, 0x6d, 0x00, 0x94, 0xdf, 0x00, 0x94, 0xff, 0x00, 0x95, 0x07, 0x00,
+  0x00, 0x03, 0x61, 0x63, 0x73, 0x00, 0x02, 0x2e, 0x00, 0x94, 0xee, 0x00,
+  0x94, 0xf6, 0x05, 0x69, 0x69, 0x6d, 0x61, 0x6b, 0x80, 0x00, 0x06, 0x61,
+  0x68, 0x61, 0x6e, 0x75, 0x66, 0x80, 0x00, 0x05, 0x75, 0x7a, 0x61, 0x6e,
+  0x75, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x69, 0x00, 0x95, 0x12, 0x00,
+  0x3d, 0x0a, 0x01, 0x6e, 0x00, 0x02, 0x69, 0x6f, 0x00, 0x01, 0xed, 0x00,
+  0x03, 0x3c, 0x05, 0x65, 0x7a, 0x75, 0x79, 0x6e, 0x80, 0x00, 0x04, 0x74,
+  0x6e, 0x61, 0x6e, 0x80, 0x00, 0x00, 0x00, 0x03, 0x68, 0x73, 0x7a, 0x00,
+  0x95, 0x3c, 0x00, 0x95, 0x42, 0x00, 0x95, 0x4c, 0x03, 0x63, 0x75, 0x66,
+  0x80, 0x00, 0x07, 0x74, 0x69, 0x6d, 0x75, 0x6b, 0x75, 0x66, 0x80, 0x00,
+  0x00, 0x00, 0x02, 0x69, 0x6f, 0x00, 0x95, 0x57, 0x00, 0x07, 0xb6, 0x02,
+  0x6d, 0x69, 0x80, 0x00, 0x02, 0x68, 0x73, 0x00, 0x02, 0x6f, 0x75, 0x00,
+  0x95, 0x69, 0x00, 0x97, 0xd3, 0x00, 0x00, 0x02, 0x67, 0x72, 0x00, 0x95,
+  0x74, 0x00, 0x96, 0x88, 0x02, 0x61, 0x6b, 0x80, 0x01, 0x2e, 0x00, 0x95,
+  0x7d, 0x00, 0x00, 0x06, 0x61, 0x65, 0x69, 0x6e, 0x6f, 0x75, 0x00, 0x95,
+  0x98, 0x00, 0x95, 0xc9, 0x00, 0x96, 0x0d, 0x00, 0x96, 0x59, 0x00, 0x96,
+  0x5f, 0x00, 0x96, 0x7e, 0x00, 0x00, 0x03, 0x6d, 0x73, 0x79, 0x00, 0x95,
+  0xa7, 0x00, 0x02, 0x83, 0x00, 0x95, 0xc2, 0x00, 0x00, 0x02, 0x61, 0x69,
+  0x00, 0x95, 0xb2, 0x00, 0x95, 0xb9, 0x04, 0x79, 0x75, 0x6f, 0x6b, 0x80,
+  0x00, 0x06, 0x68, 0x73, 0x6f, 0x67, 0x61, 0x6b, 0x80, 0x00, 0x04, 0x6f,
+  0x6e, 0x61, 0x6b, 0x80, 0x00, 0x00, 0x00, 0x03, 0x62, 0x6e, 0x74, 0x00,
+  0x95, 0xd8, 0x00, 0x95, 0xe1, 0x00, 0x96, 0x00, 0x06, 0x61, 0x6e, 0x61,
+  0x77, 0x61, 0x6b, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x75, 0x00, 0x95,
+  0xec, 0x00, 0x93, 0x73, 0x01, 0x74, 0x00, 0x02, 0x61, 0x69, 0x00, 0x24,
+  0x35, 0x00, 0x95, 0xf8, 0x05, 0x6d, 0x61, 0x6e, 0x69, 0x6d, 0x80, 0x00,
+  0x0a, 0x6f, 0x6d, 0x6f, 0x6f, 0x6e, 0x69, 0x68, 0x73, 0x69, 0x6e, 0x80,
+  0x00, 0x00, 0x00, 0x04, 0x61, 0x6b, 0x6d, 0x75, 0x00, 0x96, 0x20, 0x00,
+  0x96, 0x2e, 0x00, 0x96, 0x43, 0x00, 0x96, 0x53, 0x0b, 0x64, 0x6e, 0x65,
+  0x73, 0x61, 0x6d, 0x75, 0x73, 0x74, 0x61, 0x73, 0x80, 0x00, 0x00, 0x00,
+  0x02, 0x61, 0x6f, 0x00, 0x96, 0x39, 0x00, 0x5e, 0xe4, 0x07, 0x7a, 0x61,
+  0x72, 0x75, 0x6b, 0x61, 0x6d, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x75,
+  0x00, 0x6c, 0xcb, 0x00, 0x96, 0x4e, 0x02, 0x7a, 0x69, 0x80, 0x00, 0x03,
+  0x73, 0x75, 0x79, 0x80, 0x00, 0x03, 0x65, 0x73, 0x69, 0x80, 0x00, 0x00,
+  0x00, 0x03, 0x6b, 0x6f, 0x74, 0x00, 0x96, 0x6e, 0x00, 0x03, 0x8e, 0x00,
+  0x96, 0x74, 0x03, 0x6e, 0x69, 0x6b, 0x80, 0x00, 0x07, 0x6f, 0x6d, 0x75,
+  0x73, 0x74, 0x61, 0x6d, 0x80, 0x00, 0x07, 0x7a, 0x69, 0x6d, 0x75, 0x72,
+  0x61, 0x74, 0x80, 0x00, 0x02, 0x69, 0x68, 0x80, 0x01, 0x2e, 0x00, 0x96,
+  0x91, 0x00, 0x00, 0x06, 0x61, 0x65, 0x69, 0x6e, 0x6f, 0x75, 0x00, 0x96,
+  0xac, 0x00, 0x97, 0x45, 0x00, 0x97, 0x56, 0x00, 0x97, 0xac, 0x00, 0x97,
+  0xba, 0x00, 0x97, 0xcc, 0x00, 0x00, 0x05, 0x6b, 0x6d, 0x72, 0x74, 0x77,
+  0x00, 0x96, 0xc3, 0x00, 0x96, 0xcf, 0x00, 0x97, 0x12, 0x00, 0x97, 0x39,
+  0x00, 0x97, 0x3f, 0x01, 0x61, 0x00, 0x02, 0x6e, 0x73, 0x00, 0x01, 0xed,
+  0x00, 0x01, 0xed, 0x00, 0x00, 0x02, 0x61, 0x69, 0x00, 0x96, 0xda, 0x00,
+  0x96, 0xe2, 0x05, 0x79, 0x75, 0x6b, 0x75, 0x66, 0x80, 0x00, 0x00, 0x00,
+  0x02, 0x68, 0x6a, 0x00, 0x96, 0xed, 0x00, 0x96, 0xfc, 0x0c, 0x73, 0x6f,
+  0x72, 0x69, 0x68, 0x69, 0x68, 0x73, 0x61, 0x67, 0x69, 0x68, 0x80, 0x00,
+  0x00, 0x00, 0x02, 0x61, 0x69, 0x00, 0x6e, 0xef, 0x00, 0x97, 0x07, 0x08,
+  0x6d, 0x61, 0x6b, 0x69, 0x6b, 0x61, 0x73, 0x6f, 0x80, 0x00, 0x00, 0x00,
+  0x02, 0x61, 0x65, 0x00, 0x97, 0x1d, 0x00, 0x03, 0x8e, 0x00, 0x00, 0x02,
+  0x62, 0x68, 0x00, 0x8a, 0xf9, 0x00, 0x97, 0x28, 0x00, 0x00, 0x02, 0x65,
+  0x69, 0x00, 0x97, 0x33, 0x00, 0x03, 0x40, 0x03, 0x6b, 0x61, 0x74, 0x80,
+  0x00, 0x03, 0x69, 0x61, 0x6b, 0x80, 0x00, 0x03, 0x69, 0x61, 0x64, 0x80,
+  0x00, 0x00, 0x00, 0x02, 0x6b, 0x72, 0x00, 0x97, 0x50, 0x00, 0x4c, 0xd6,
+  0x03, 0x61, 0x74, 0x6f, 0x80, 0x00, 0x00, 0x00, 0x03, 0x68, 0x6d, 0x75,
+  0x00, 0x97, 0x65, 0x00, 0x97, 0xa2, 0x00, 0x05, 0x9d, 0x00, 0x00, 0x02,
+  0x63, 0x73, 0x00, 0x97, 0x70, 0x00, 0x97, 0x8f, 0x01, 0x69, 0x00, 0x03,
+  0x61, 0x6d, 0x6e, 0x00, 0x97, 0x80, 0x00, 0x97, 0x89, 0x00, 0x83, 0xb0,
+  0x06, 0x6b, 0x75, 0x73, 0x74, 0x61, 0x68, 0x80, 0x00, 0x03, 0x6f, 0x6e,
+  0x6f, 0x80, 0x00, 0x00, 0x00, 0x02, 0x69, 0x6f, 0x00, 0x97, 0x9a, 0x00,
+  0x90, 0x2f, 0x05, 0x6e, 0x61, 0x72, 0x65, 0x73, 0x80, 0x00, 0x07, 0x61,
+  0x6e, 0x69, 0x6d, 0x61, 0x73, 0x61, 0x80, 0x00, 0x0b, 0x65, 0x67, 0x6f,
+  0x6b, 0x69, 0x6b, 0x65, 0x73, 0x6e, 0x69, 0x6a, 0x80, 0x00, 0x00, 0x00,
+  0x02, 0x67, 0x6e, 0x00, 0x90, 0xbe, 0x00, 0x97, 0xc5, 0x04, 0x61, 0x6d,
+  0x75, 0x6b, 0x80, 0x00, 0x04, 0x68, 0x63, 0x75, 0x66, 0x80, 0x00, 0x01,
+  0x6b, 0x00, 0x02, 0x6f, 0x75, 0x00, 0x97, 0xdf, 0x00, 0x98, 0xbc, 0x01,
+  0x74, 0x80, 0x01, 0x2e, 0x00, 0x97, 0xe7, 0x00, 0x00, 0x05, 0x61, 0x65,
+  0x69, 0x6e, 0x6f, 0x00, 0x97, 0xfe, 0x00, 0x98, 0x37, 0x00, 0x98, 0x43,
+  0x00, 0x98, 0x97, 0x00, 0x98, 0xa4, 0x00, 0x00, 0x03, 0x62, 0x6d, 0x77,
+  0x00, 0x81, 0xb5, 0x00, 0x98, 0x0d, 0x00, 0x98, 0x2e, 0x01, 0x69, 0x00,
+  0x02, 0x68, 0x6d, 0x00, 0x98, 0x19, 0x00, 0x01, 0xed, 0x02, 0x73, 0x75,
+  0x00, 0x02, 0x6b, 0x73, 0x00, 0x3d, 0xa3, 0x00, 0x98, 0x26, 0x05, 0x74,
+  0x61, 0x6d, 0x6f, 0x6b, 0x80, 0x00, 0x06, 0x61, 0x67, 0x61, 0x6b, 0x61,
+  0x6e, 0x80, 0x00, 0x09, 0x67, 0x69, 0x68, 0x73, 0x75, 0x73, 0x74, 0x61,
+  0x6d, 0x80, 0x00, 0x00, 0x00, 0x05, 0x67, 0x68, 0x6b, 0x6d, 0x75, 0x00,
+  0x37, 0x55, 0x00, 0x98, 0x5a, 0x00, 0x98, 0x75, 0x00, 0x98, 0x7c, 0x00,
+  0x98, 0x8d, 0x00, 0x00, 0x02, 0x63, 0x73, 0x00, 0x98, 0x65, 0x00, 0x98,
+  0x6e, 0x06, 0x6f, 0x67, 0x61, 0x6e, 0x61, 0x73, 0x80, 0x00, 0x04, 0x6f,
+  0x79, 0x69, 0x6d, 0x80, 0x00, 0x04, 0x69, 0x6a, 0x61, 0x77, 0x80, 0x00,
+  0x00, 0x00, 0x02, 0x61, 0x75, 0x00, 0x89, 0x4f, 0x00, 0x98, 0x87, 0x03,
+  0x7a, 0x69, 0x61, 0x80, 0x00, 0x07, 0x6b, 0x69, 0x68, 0x73, 0x69, 0x68,
+  0x73, 0x80, 0x00, 0x02, 0x61, 0x6e, 0x00, 0x02, 0x61, 0x69, 0x00, 0x01,
+  0xed, 0x00, 0x21, 0x4a, 0x00, 0x00, 0x02, 0x6e, 0x74, 0x00, 0x98, 0xaf,
+  0x00, 0x98, 0xb5, 0x03, 0x61, 0x74, 0x69, 0x80, 0x00, 0x04, 0x75, 0x72,
+  0x61, 0x6e, 0x80, 0x00, 0x01, 0x66, 0x80, 0x01, 0x2e, 0x00, 0x98, 0xc4,
+  0x00, 0x00, 0x06, 0x61, 0x65, 0x69, 0x6e, 0x6f, 0x75, 0x00, 0x98, 0xdf,
+  0x00, 0x99, 0xc3, 0x00, 0x99, 0xed, 0x00, 0x9a, 0x61, 0x00, 0x9a, 0x6a,
+  0x00, 0x9a, 0xca, 0x00, 0x00, 0x05, 0x62, 0x6d, 0x72, 0x74, 0x77, 0x00,
+  0x98, 0xf6, 0x00, 0x98, 0xfd, 0x00, 0x99, 0x3f, 0x00, 0x99, 0x5e, 0x00,
+  0x99, 0x6e, 0x04, 0x61, 0x74, 0x75, 0x66, 0x80, 0x00, 0x00, 0x00, 0x04,
+  0x61, 0x69, 0x6f, 0x75, 0x00, 0x99, 0x10, 0x00, 0x99, 0x2c, 0x00, 0x03,
+  0x8e, 0x00, 0x93, 0x38, 0x00, 0x00, 0x02, 0x74, 0x79, 0x00, 0x02, 0x12,
+  0x00, 0x99, 0x1b, 0x00, 0x00, 0x02, 0x65, 0x69, 0x00, 0x8d, 0x80, 0x00,
+  0x99, 0x26, 0x03, 0x72, 0x6f, 0x6b, 0x80, 0x00, 0x02, 0x68, 0x73, 0x00,
+  0x02, 0x69, 0x75, 0x00, 0x03, 0x40, 0x00, 0x99, 0x39, 0x03, 0x6b, 0x75,
+  0x66, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x75, 0x00, 0x99, 0x4a, 0x00,
+  0x99, 0x56, 0x09, 0x62, 0x6f, 0x69, 0x68, 0x73, 0x61, 0x74, 0x69, 0x6b,
+  0x80, 0x00, 0x05, 0x67, 0x61, 0x6e, 0x61, 0x74, 0x80, 0x00, 0x01, 0x61,
+  0x00, 0x03, 0x6b, 0x6d, 0x72, 0x00, 0x84, 0xa8, 0x00, 0x8a, 0x37, 0x00,
+  0x5e, 0xe4, 0x00, 0x00, 0x02, 0x61, 0x6f, 0x00, 0x99, 0x79, 0x00, 0x24,
+  0xd0, 0x00, 0x00, 0x03, 0x67, 0x6b, 0x6e, 0x00, 0x99, 0x88, 0x00, 0x99,
+  0xa3, 0x00, 0x66, 0x39, 0x00, 0x00, 0x03, 0x61, 0x65, 0x75, 0x00, 0x99,
+  0x97, 0x00, 0x99, 0x9d, 0x00, 0x86, 0xaa, 0x03, 0x6b, 0x75, 0x73, 0x80,
+  0x00, 0x03, 0x6d, 0x61, 0x73, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x69,
+  0x00, 0x99, 0xae, 0x00, 0x99, 0xbd, 0x00, 0x00, 0x03, 0x6d, 0x72, 0x73,
+  0x00, 0x81, 0x96, 0x00, 0x83, 0xb0, 0x00, 0x02, 0xa9, 0x03, 0x68, 0x73,
+  0x69, 0x80, 0x00, 0x00, 0x00, 0x03, 0x67, 0x69, 0x74, 0x00, 0x99, 0xd2,
+  0x00, 0x02, 0xfe, 0x00, 0x99, 0xdc, 0x07, 0x6e, 0x61, 0x62, 0x75, 0x7a,
+  0x69, 0x61, 0x80, 0x00, 0x01, 0x61, 0x00, 0x02, 0x64, 0x74, 0x00, 0x01,
+  0xed, 0x00, 0x99, 0xe8, 0x02, 0x69, 0x69, 0x80, 0x00, 0x00, 0x00, 0x06,
+  0x61, 0x65, 0x68, 0x6b, 0x6d, 0x72, 0x00, 0x9a, 0x08, 0x00, 0x9a, 0x0f,
+  0x00, 0x9a, 0x15, 0x00, 0x9a, 0x2a, 0x00, 0x9a, 0x46, 0x00, 0x9a, 0x4d,
+  0x04, 0x64, 0x6e, 0x61, 0x62, 0x80, 0x00, 0x03, 0x6e, 0x65, 0x74, 0x80,
+  0x00, 0x01, 0x73, 0x00, 0x02, 0x61, 0x69, 0x00, 0x8e, 0x06, 0x00, 0x9a,
+  0x21, 0x06, 0x69, 0x6d, 0x61, 0x67, 0x61, 0x6b, 0x80, 0x00, 0x00, 0x00,
+  0x02, 0x61, 0x75, 0x00, 0x9a, 0x35, 0x00, 0x9a, 0x40, 0x00, 0x00, 0x02,
+  0x77, 0x7a, 0x00, 0x02, 0x83, 0x00, 0x89, 0x2a, 0x03, 0x62, 0x61, 0x79,
+  0x80, 0x00, 0x04, 0x69, 0x6e, 0x75, 0x6b, 0x80, 0x00, 0x00, 0x00, 0x02,
+  0x6f, 0x75, 0x00, 0x22, 0x0b, 0x00, 0x9a, 0x58, 0x06, 0x73, 0x74, 0x61,
+  0x6d, 0x61, 0x79, 0x80, 0x00, 0x06, 0x69, 0x68, 0x73, 0x69, 0x61, 0x74,
+  0x80, 0x00, 0x00, 0x00, 0x04, 0x67, 0x6e, 0x72, 0x74, 0x00, 0x9a, 0x7d,
+  0x00, 0x9a, 0x97, 0x00, 0x9a, 0xaa, 0x00, 0x9a, 0xb5, 0x00, 0x00, 0x04,
+  0x65, 0x69, 0x6e, 0x6f, 0x00, 0x9a, 0x90, 0x00, 0x84, 0xb8, 0x00, 0x3d,
+  0x0e, 0x00, 0x8c, 0xbe, 0x04, 0x74, 0x6f, 0x6d, 0x6f, 0x80, 0x00, 0x01,
+  0x6f, 0x80, 0x02, 0x64, 0x72, 0x00, 0x9a, 0xa3, 0x00, 0x5e, 0xe4, 0x04,
+  0x75, 0x72, 0x75, 0x66, 0x80, 0x00, 0x08, 0x69, 0x68, 0x73, 0x61, 0x77,
+  0x61, 0x6e, 0x69, 0x80, 0x00, 0x01, 0x61, 0x00, 0x02, 0x6d, 0x73, 0x00,
+  0x8a, 0x8a, 0x00, 0x9a, 0xc1, 0x06, 0x69, 0x6d, 0x75, 0x7a, 0x69, 0x61,
+  0x80, 0x00, 0x00, 0x00, 0x03, 0x72, 0x73, 0x7a, 0x00, 0x9a, 0xd9, 0x00,
+  0x9a, 0xe0, 0x00, 0x9a, 0xee, 0x04, 0x61, 0x68, 0x69, 0x6d, 0x80, 0x00,
+  0x0b, 0x74, 0x61, 0x6d, 0x61, 0x6b, 0x61, 0x77, 0x75, 0x7a, 0x69, 0x61,
+  0x80, 0x00, 0x02, 0x69, 0x61, 0x00, 0x02, 0x69, 0x6e, 0x00, 0x84, 0xb8,
+  0x00, 0x8a, 0x8a, 0x02, 0x75, 0x67, 0x80, 0x01, 0x2e, 0x00, 0x9b, 0x04,
+  0x00, 0x00, 0x04, 0x61, 0x69, 0x6f, 0x75, 0x00, 0x9b, 0x17, 0x00, 0x9c,
+  0x0d, 0x00, 0x9c, 0x7b, 0x00, 0x9c, 0xa7, 0x00, 0x40, 0x62, 0x16, 0x01,
+  0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x04, 0x05,
+  0x00, 0x00, 0x00, 0x06, 0x00, 0x07, 0x00, 0x00, 0x08, 0x00, 0x8a, 0x37,
+  0x00, 0x9b, 0x49, 0x00, 0x9b, 0x51, 0x00, 0x9b, 0x72, 0x00, 0x9b, 0x94,
+  0x00, 0x9b, 0xa8, 0x00, 0x9b, 0xd7, 0x00, 0x9b, 0xf5, 0x05, 0x6f, 0x79,
+  0x69, 0x68, 0x63, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x6f, 0x00, 0x9b,
+  0x5c, 0x00, 0x9b, 0x62, 0x03, 0x6e, 0x6e, 0x61, 0x80, 0x00, 0x01, 0x69,
+  0x00, 0x03, 0x68, 0x6a, 0x6d, 0x00, 0x8f, 0x6a, 0x00, 0x7d, 0x4e, 0x00,
+  0x3d, 0xa3, 0x00, 0x00, 0x02, 0x61, 0x75, 0x00, 0x9b, 0x7d, 0x00, 0x9b,
+  0x85, 0x05, 0x79, 0x61, 0x6b, 0x61, 0x74, 0x80, 0x00, 0x0c, 0x73, 0x74,
+  0x61, 0x67, 0x61, 0x69, 0x68, 0x73, 0x61, 0x67, 0x69, 0x68, 0x80, 0x00,
+  0x00, 0x00, 0x02, 0x69, 0x6e, 0x00, 0x9b, 0x9f, 0x00, 0x21, 0x4a, 0x06,
+  0x68, 0x73, 0x61, 0x74, 0x61, 0x6b, 0x80, 0x00, 0x00, 0x00, 0x04, 0x61,
+  0x6e, 0x6f, 0x75, 0x00, 0x9b, 0xbb, 0x00, 0x21, 0x4a, 0x00, 0x01, 0xed,
+  0x00, 0x9b, 0xc5, 0x07, 0x68, 0x6f, 0x6e, 0x61, 0x67, 0x61, 0x6e, 0x80,
+  0x00, 0x00, 0x00, 0x02, 0x6b, 0x6d, 0x00, 0x98, 0xaf, 0x00, 0x9b, 0xd0,
+  0x04, 0x61, 0x6d, 0x61, 0x74, 0x80, 0x00, 0x00, 0x00, 0x03, 0x61, 0x69,
+  0x6f, 0x00, 0x9b, 0xe6, 0x00, 0x9b, 0xec, 0x00, 0x01, 0xed, 0x03, 0x6d,
+  0x75, 0x6e, 0x80, 0x00, 0x06, 0x6e, 0x6f, 0x6d, 0x69, 0x68, 0x73, 0x80,
+  0x00, 0x00, 0x00, 0x03, 0x61, 0x69, 0x6f, 0x00, 0x9c, 0x04, 0x00, 0x04,
+  0x75, 0x00, 0x24, 0xd0, 0x06, 0x6b, 0x75, 0x62, 0x69, 0x68, 0x73, 0x80,
+  0x00, 0x00, 0x00, 0x05, 0x68, 0x6b, 0x6d, 0x6f, 0x72, 0x00, 0x9c, 0x24,
+  0x00, 0x9c, 0x40, 0x00, 0x9c, 0x52, 0x00, 0x9c, 0x6b, 0x00, 0x9c, 0x74,
+  0x02, 0x73, 0x61, 0x00, 0x02, 0x62, 0x79, 0x00, 0x9c, 0x31, 0x00, 0x9c,
+  0x37, 0x03, 0x65, 0x61, 0x6d, 0x80, 0x00, 0x06, 0x61, 0x62, 0x65, 0x74,
+  0x61, 0x74, 0x80, 0x00, 0x02, 0x61, 0x73, 0x00, 0x02, 0x61, 0x65, 0x00,
+  0x97, 0x33, 0x00, 0x9c, 0x4d, 0x02, 0x73, 0x69, 0x80, 0x00, 0x00, 0x00,
+  0x02, 0x61, 0x75, 0x00, 0x9c, 0x5d, 0x00, 0x9c, 0x65, 0x05, 0x6b, 0x61,
+  0x6e, 0x69, 0x6d, 0x80, 0x00, 0x03, 0x7a, 0x69, 0x6f, 0x80, 0x00, 0x06,
+  0x67, 0x61, 0x6d, 0x75, 0x73, 0x74, 0x80, 0x00, 0x04, 0x6f, 0x64, 0x69,
+  0x6d, 0x80, 0x00, 0x00, 0x00, 0x03, 0x6a, 0x6e, 0x74, 0x00, 0x9c, 0x8a,
+  0x00, 0x9c, 0x93, 0x00, 0x8c, 0x3f, 0x06, 0x6f, 0x6e, 0x61, 0x6b, 0x61,
+  0x6e, 0x80, 0x00, 0x00, 0x00, 0x02, 0x65, 0x6f, 0x00, 0x07, 0xb6, 0x00,
+  0x9c, 0x9e, 0x06, 0x79, 0x69, 0x6b, 0x75, 0x73, 0x74, 0x80, 0x00, 0x00,
+  0x00, 0x03, 0x6b, 0x73, 0x79, 0x00, 0x9c, 0xb6, 0x00, 0x9c, 0xbe, 0x00,
+  0x9c, 0xc6, 0x05, 0x6f, 0x6d, 0x6e, 0x61, 0x6e, 0x80, 0x00, 0x05, 0x74,
+  0x61, 0x73, 0x75, 0x6b, 0x80, 0x00, 0x03, 0x72, 0x69, 0x6b, 0x80, 0x00,
+  0x02, 0x61, 0x6e, 0x80, 0x01, 0x2e, 0x00, 0x9c, 0xd5, 0x00, 0x00, 0x04,
+  0x61, 0x65, 0x69, 0x6f, 0x00, 0x9c, 0xe8, 0x00, 0x9d, 0x79, 0x00, 0x9d,
+  0x9b, 0x00, 0x9e, 0x2a, 0x00, 0x00, 0x06, 0x62, 0x64, 0x67, 0x6d, 0x72,
+  0x77, 0x00, 0x87, 0xb6, 0x00, 0x9d, 0x03, 0x00, 0x9d, 0x21, 0x00, 0x9d,
+  0x29, 0x00, 0x9d, 0x5a, 0x00, 0x9d, 0x66, 0x00, 0x00, 0x02, 0x61, 0x75,
+  0x00, 0x9d, 0x0e, 0x00, 0x9d, 0x1a, 0x09, 0x6b, 0x61, 0x74, 0x6f, 0x74,
+  0x61, 0x6d, 0x61, 0x79, 0x80, 0x00, 0x00, 0x80, 0x01, 0x6f, 0x00, 0x01,
+  0xed, 0x05, 0x75, 0x72, 0x61, 0x6b, 0x69, 0x80, 0x00, 0x00, 0x00, 0x02,
+  0x61, 0x6f, 0x00, 0x9d, 0x34, 0x00, 0x87, 0x21, 0x01, 0x79, 0x00, 0x02,
+  0x61, 0x69, 0x00, 0x9d, 0x40, 0x00, 0x9d, 0x4e, 0x03, 0x74, 0x69, 0x6b,
+  0x00, 0x02, 0x69, 0x6f, 0x00, 0x82, 0x39, 0x00, 0x8c, 0xbe, 0x09, 0x72,
+  0x6f, 0x6b, 0x6f, 0x74, 0x61, 0x6d, 0x61, 0x79, 0x80, 0x00, 0x01, 0x61,
+  0x00, 0x02, 0x68, 0x6e, 0x00, 0x87, 0xb6, 0x00, 0x01, 0xed, 0x01, 0x61,
+  0x00, 0x02, 0x67, 0x6b, 0x00, 0x9d, 0x72, 0x00, 0x9a, 0x0f, 0x04, 0x65,
+  0x73, 0x6f, 0x6e, 0x80, 0x00, 0x00, 0x00, 0x04, 0x6b, 0x6f, 0x73, 0x75,
+  0x00, 0x8c, 0x16, 0x00, 0x9d, 0x8c, 0x00, 0x01, 0x99, 0x00, 0x9d, 0x94,
+  0x05, 0x7a, 0x61, 0x6d, 0x61, 0x79, 0x80, 0x00, 0x04, 0x73, 0x74, 0x69,
+  0x6d, 0x80, 0x00, 0x00, 0x40, 0x61, 0x12, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x03, 0x00, 0x04, 0x05, 0x00, 0x06, 0x07, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x9d, 0xc9, 0x00, 0x92, 0x8e, 0x00, 0x9d, 0xdb, 0x00, 0x02,
+  0x12, 0x00, 0x9d, 0xf8, 0x00, 0x9e, 0x04, 0x00, 0x1c, 0x25, 0x00, 0x9e,
+  0x0d, 0x00, 0x00, 0x02, 0x72, 0x77, 0x00, 0x9d, 0xd4, 0x00, 0x21, 0x4a,
+  0x04, 0x75, 0x6b, 0x61, 0x73, 0x80, 0x00, 0x00, 0x00, 0x02, 0x63, 0x73,
+  0x00, 0x9d, 0xe6, 0x00, 0x9d, 0xef, 0x06, 0x69, 0x6f, 0x6d, 0x69, 0x68,
+  0x73, 0x80, 0x00, 0x06, 0x69, 0x6e, 0x61, 0x77, 0x61, 0x6b, 0x80, 0x00,
+  0x01, 0x61, 0x00, 0x02, 0x6d, 0x74, 0x00, 0x8d, 0x80, 0x00, 0x8b, 0x08,
+  0x06, 0x61, 0x6b, 0x61, 0x77, 0x61, 0x6b, 0x80, 0x00, 0x00, 0x00, 0x03,
+  0x6e, 0x6f, 0x75, 0x00, 0x1a, 0x51, 0x00, 0x9e, 0x1c, 0x00, 0x9e, 0x24,
+  0x05, 0x74, 0x61, 0x6b, 0x61, 0x74, 0x80, 0x00, 0x03, 0x67, 0x65, 0x68,
+  0x80, 0x00, 0x00, 0x00, 0x06, 0x64, 0x67, 0x6a, 0x6e, 0x74, 0x79, 0x00,
+  0x9e, 0x45, 0x00, 0x69, 0x10, 0x00, 0x8c, 0x3f, 0x00, 0x9e, 0x50, 0x00,
+  0x9e, 0x5c, 0x00, 0x99, 0x26, 0x00, 0x00, 0x02, 0x6e, 0x6f, 0x00, 0x02,
+  0xa9, 0x00, 0x94, 0xcb, 0x05, 0x69, 0x68, 0x73, 0x6f, 0x79, 0x80, 0x01,
+  0x69, 0x00, 0x91, 0x49, 0x08, 0x6f, 0x6d, 0x61, 0x72, 0x61, 0x77, 0x61,
+  0x74, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x69, 0x00, 0x9e, 0x72, 0x00,
+  0xa1, 0x7e, 0x01, 0x67, 0x00, 0x02, 0x61, 0x69, 0x00, 0x9e, 0x7e, 0x00,
+  0x9f, 0xee, 0x03, 0x6d, 0x61, 0x79, 0x80, 0x01, 0x2e, 0x00, 0x9e, 0x88,
+  0x00, 0x00, 0x05, 0x61, 0x65, 0x69, 0x6f, 0x75, 0x00, 0x9e, 0x9f, 0x00,
+  0x9f, 0x86, 0x00, 0x9f, 0xac, 0x00, 0x9f, 0xd7, 0x00, 0x9f, 0xe6, 0x00,
+  0x00, 0x07, 0x64, 0x6b, 0x6d, 0x72, 0x74, 0x77, 0x7a, 0x00, 0x9e, 0xbe,
+  0x00, 0x9e, 0xc6, 0x00, 0x9e, 0xe2, 0x00, 0x9f, 0x06, 0x00, 0x9f, 0x0d,
+  0x00, 0x9f, 0x30, 0x00, 0x9f, 0x81, 0x05, 0x69, 0x68, 0x73, 0x69, 0x6f,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x6f, 0x00, 0x9e, 0xd1, 0x00, 0x9e,
+  0xda, 0x06, 0x74, 0x61, 0x72, 0x69, 0x68, 0x73, 0x80, 0x00, 0x05, 0x75,
+  0x72, 0x75, 0x73, 0x74, 0x80, 0x00, 0x02, 0x61, 0x79, 0x00, 0x03, 0x61,
+  0x65, 0x6f, 0x00, 0x9e, 0xf3, 0x00, 0x8d, 0x80, 0x00, 0x9e, 0xfe, 0x00,
+  0x00, 0x02, 0x6b, 0x72, 0x00, 0x3d, 0x0e, 0x00, 0x37, 0x55, 0x05, 0x6e,
+  0x69, 0x6d, 0x61, 0x6b, 0x80, 0x00, 0x04, 0x75, 0x6b, 0x68, 0x6f, 0x80,
+  0x00, 0x01, 0x61, 0x00, 0x03, 0x67, 0x68, 0x6b, 0x00, 0x9f, 0x1d, 0x00,
+  0x9f, 0x29, 0x00, 0x22, 0x90, 0x01, 0x61, 0x00, 0x02, 0x6d, 0x6e, 0x00,
+  0x8a, 0x8a, 0x00, 0x7d, 0x4e, 0x04, 0x61, 0x6b, 0x61, 0x74, 0x80, 0x00,
+  0x01, 0x61, 0x00, 0x03, 0x67, 0x6b, 0x7a, 0x00, 0x9f, 0x40, 0x00, 0x9f,
+  0x53, 0x00, 0x9f, 0x65, 0x00, 0x00, 0x02, 0x65, 0x6f, 0x00, 0x82, 0x76,
+  0x00, 0x9f, 0x4b, 0x05, 0x72, 0x75, 0x6d, 0x61, 0x6d, 0x80, 0x00, 0x01,
+  0x69, 0x00, 0x02, 0x68, 0x6d, 0x00, 0x9f, 0x5f, 0x00, 0x01, 0xed, 0x03,
+  0x73, 0x69, 0x6e, 0x80, 0x00, 0x00, 0x00, 0x03, 0x61, 0x65, 0x6f, 0x00,
+  0x9f, 0x74, 0x00, 0x9f, 0x7b, 0x00, 0x03, 0x3c, 0x04, 0x6e, 0x61, 0x62,
+  0x6f, 0x80, 0x00, 0x03, 0x6e, 0x6f, 0x79, 0x80, 0x00, 0x02, 0x75, 0x79,
+  0x80, 0x00, 0x00, 0x00, 0x05, 0x61, 0x62, 0x64, 0x6e, 0x6f, 0x00, 0x9f,
+  0x9d, 0x00, 0x9f, 0xa3, 0x00, 0x99, 0xe8, 0x00, 0x87, 0x5e, 0x00, 0x01,
+  0xed, 0x03, 0x67, 0x61, 0x73, 0x80, 0x00, 0x06, 0x6f, 0x6e, 0x61, 0x6d,
+  0x61, 0x79, 0x80, 0x00, 0x00, 0x00, 0x03, 0x61, 0x68, 0x6e, 0x00, 0x9f,
+  0xbb, 0x00, 0x9f, 0xc6, 0x00, 0x9f, 0xd1, 0x00, 0x00, 0x02, 0x67, 0x6e,
+  0x00, 0x3d, 0x0e, 0x00, 0x8a, 0xf9, 0x00, 0x00, 0x02, 0x61, 0x73, 0x00,
+  0x02, 0x2e, 0x00, 0x9d, 0xef, 0x03, 0x75, 0x67, 0x6f, 0x80, 0x00, 0x00,
+  0x00, 0x03, 0x64, 0x6a, 0x79, 0x00, 0x9a, 0x0f, 0x00, 0x8c, 0x3f, 0x00,
+  0x65, 0xd9, 0x05, 0x6b, 0x6f, 0x68, 0x61, 0x6b, 0x80, 0x00, 0x02, 0x69,
+  0x6e, 0x80, 0x01, 0x2e, 0x00, 0x9f, 0xf7, 0x00, 0x00, 0x06, 0x61, 0x65,
+  0x69, 0x6e, 0x6f, 0x75, 0x00, 0xa0, 0x12, 0x00, 0xa0, 0x8c, 0x00, 0xa0,
+  0xa7, 0x00, 0xa1, 0x05, 0x00, 0xa1, 0x1d, 0x00, 0xa1, 0x65, 0x00, 0x00,
+  0x06, 0x67, 0x6b, 0x6d, 0x74, 0x77, 0x79, 0x00, 0x02, 0xa9, 0x00, 0xa0,
+  0x2d, 0x00, 0xa0, 0x38, 0x00, 0xa0, 0x43, 0x00, 0xa0, 0x5e, 0x00, 0xa0,
+  0x86, 0x00, 0x00, 0x02, 0x69, 0x6f, 0x00, 0x37, 0x55, 0x00, 0x81, 0x8f,
+  0x04, 0x75, 0x6e, 0x6f, 0x75, 0x80, 0x01, 0x69, 0x00, 0x95, 0xf8, 0x00,
+  0x00, 0x02, 0x61, 0x69, 0x00, 0xa0, 0x4e, 0x00, 0xa0, 0x59, 0x00, 0x00,
+  0x02, 0x62, 0x67, 0x00, 0x83, 0xb0, 0x00, 0x8f, 0xb1, 0x02, 0x6f, 0x79,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x69, 0x00, 0xa0, 0x69, 0x00, 0x7a,
+  0x6b, 0x00, 0x00, 0x03, 0x67, 0x6b, 0x7a, 0x00, 0xa0, 0x78, 0x00, 0xa0,
+  0x7f, 0x00, 0x9f, 0x81, 0x04, 0x69, 0x6f, 0x74, 0x69, 0x80, 0x00, 0x04,
+  0x69, 0x6b, 0x65, 0x73, 0x80, 0x00, 0x03, 0x69, 0x6a, 0x6f, 0x80, 0x00,
+  0x00, 0x00, 0x02, 0x6b, 0x6d, 0x00, 0xa0, 0x97, 0x00, 0xa0, 0x9f, 0x05,
+  0x75, 0x73, 0x74, 0x69, 0x6d, 0x80, 0x00, 0x05, 0x61, 0x62, 0x75, 0x73,
+  0x74, 0x80, 0x00, 0x00, 0x00, 0x04, 0x61, 0x68, 0x6b, 0x6d, 0x00, 0xa0,
+  0xba, 0x00, 0xa0, 0xc1, 0x00, 0xa0, 0xcb, 0x00, 0xa0, 0xe8, 0x04, 0x6e,
+  0x69, 0x61, 0x74, 0x80, 0x00, 0x07, 0x63, 0x61, 0x6d, 0x61, 0x6b, 0x6f,
+  0x74, 0x80, 0x00, 0x02, 0x61, 0x7a, 0x00, 0x02, 0x61, 0x6f, 0x00, 0xa0,
+  0xd8, 0x00, 0xa0, 0xe1, 0x06, 0x77, 0x69, 0x68, 0x73, 0x61, 0x6b, 0x80,
+  0x00, 0x04, 0x6d, 0x75, 0x7a, 0x69, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61,
+  0x6f, 0x00, 0xa0, 0xf3, 0x00, 0x01, 0xed, 0x00, 0x00, 0x02, 0x67, 0x6b,
+  0x00, 0x81, 0x96, 0x00, 0xa0, 0xfe, 0x04, 0x61, 0x72, 0x75, 0x6d, 0x80,
+  0x00, 0x00, 0x00, 0x02, 0x61, 0x65, 0x00, 0xa1, 0x10, 0x00, 0xa1, 0x17,
+  0x04, 0x6e, 0x75, 0x73, 0x74, 0x80, 0x00, 0x03, 0x73, 0x6f, 0x67, 0x80,
+  0x00, 0x00, 0x00, 0x07, 0x64, 0x69, 0x6a, 0x6b, 0x6d, 0x6e, 0x72, 0x00,
+  0x22, 0x90, 0x00, 0xa1, 0x3c, 0x00, 0x69, 0x10, 0x00, 0xa1, 0x43, 0x00,
+  0x21, 0x4a, 0x00, 0xa1, 0x59, 0x00, 0xa1, 0x5f, 0x04, 0x68, 0x63, 0x6f,
+  0x74, 0x80, 0x00, 0x00, 0x00, 0x02, 0x69, 0x6f, 0x00, 0xa1, 0x4e, 0x00,
+  0xa1, 0x54, 0x03, 0x68, 0x61, 0x79, 0x80, 0x00, 0x02, 0x79, 0x6d, 0x80,
+  0x00, 0x03, 0x61, 0x67, 0x61, 0x80, 0x00, 0x03, 0x69, 0x65, 0x73, 0x80,
+  0x00, 0x00, 0x00, 0x02, 0x6f, 0x73, 0x00, 0xa1, 0x70, 0x00, 0xa1, 0x77,
+  0x04, 0x72, 0x69, 0x65, 0x73, 0x80, 0x00, 0x04, 0x74, 0x65, 0x6f, 0x6a,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x6b, 0x6f, 0x00, 0xa1, 0x89, 0x00, 0xa2,
+  0xf0, 0x01, 0x61, 0x80, 0x01, 0x2e, 0x00, 0xa1, 0x91, 0x00, 0x00, 0x06,
+  0x61, 0x65, 0x69, 0x6e, 0x6f, 0x75, 0x00, 0xa1, 0xac, 0x00, 0xa2, 0x0c,
+  0x00, 0xa2, 0x4c, 0x00, 0xa2, 0x78, 0x00, 0xa2, 0x80, 0x00, 0xa2, 0xd6,
+  0x00, 0x00, 0x04, 0x67, 0x6b, 0x74, 0x77, 0x00, 0x02, 0x12, 0x00, 0xa1,
+  0xbf, 0x00, 0xa1, 0xd1, 0x00, 0xa1, 0xfc, 0x00, 0x00, 0x02, 0x61, 0x6f,
+  0x00, 0x86, 0x40, 0x00, 0xa1, 0xca, 0x04, 0x69, 0x6d, 0x61, 0x6b, 0x80,
+  0x00, 0x00, 0x00, 0x02, 0x61, 0x69, 0x00, 0xa1, 0xdc, 0x00, 0xa1, 0xed,
+  0x02, 0x67, 0x6f, 0x80, 0x01, 0x72, 0x00, 0xa1, 0xe5, 0x05, 0x69, 0x68,
+  0x63, 0x61, 0x68, 0x80, 0x00, 0x02, 0x6b, 0x61, 0x80, 0x01, 0x61, 0x00,
+  0xa1, 0xf6, 0x03, 0x74, 0x69, 0x6b, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61,
+  0x6f, 0x00, 0x87, 0x21, 0x00, 0xa2, 0x07, 0x02, 0x79, 0x6b, 0x80, 0x00,
+  0x00, 0x00, 0x04, 0x6d, 0x6e, 0x73, 0x74, 0x00, 0xa2, 0x1f, 0x00, 0xa2,
+  0x26, 0x00, 0xa2, 0x2d, 0x00, 0xa2, 0x3b, 0x04, 0x6f, 0x6a, 0x6f, 0x67,
+  0x80, 0x00, 0x04, 0x61, 0x74, 0x69, 0x6d, 0x80, 0x00, 0x0b, 0x75, 0x72,
+  0x61, 0x6e, 0x69, 0x68, 0x73, 0x61, 0x67, 0x69, 0x68, 0x80, 0x00, 0x00,
+  0x00, 0x02, 0x61, 0x6f, 0x00, 0x05, 0x36, 0x00, 0xa2, 0x46, 0x03, 0x6b,
+  0x6f, 0x79, 0x80, 0x00, 0x00, 0x00, 0x03, 0x68, 0x6d, 0x6e, 0x00, 0xa2,
+  0x5b, 0x00, 0xa2, 0x65, 0x00, 0xa2, 0x6e, 0x07, 0x73, 0x6f, 0x79, 0x69,
+  0x72, 0x6f, 0x6d, 0x80, 0x00, 0x06, 0x61, 0x67, 0x61, 0x74, 0x61, 0x6b,
+  0x80, 0x00, 0x07, 0x61, 0x6f, 0x6b, 0x69, 0x6d, 0x61, 0x6b, 0x80, 0x00,
+  0x05, 0x65, 0x73, 0x69, 0x61, 0x64, 0x80, 0x00, 0x00, 0x00, 0x06, 0x68,
+  0x6a, 0x6e, 0x72, 0x74, 0x79, 0x00, 0xa2, 0x9b, 0x00, 0xa2, 0xa2, 0x00,
+  0xa2, 0xb2, 0x00, 0xa2, 0xb9, 0x00, 0xa2, 0xc1, 0x00, 0xa2, 0xcf, 0x04,
+  0x61, 0x6b, 0x69, 0x6e, 0x80, 0x00, 0x03, 0x6e, 0x6f, 0x68, 0x80, 0x01,
+  0x69, 0x00, 0xa2, 0xac, 0x03, 0x72, 0x75, 0x79, 0x80, 0x00, 0x04, 0x75,
+  0x7a, 0x61, 0x6b, 0x80, 0x00, 0x05, 0x69, 0x68, 0x73, 0x6f, 0x6e, 0x80,
+  0x00, 0x03, 0x61, 0x73, 0x69, 0x00, 0x02, 0x6a, 0x6d, 0x00, 0x7d, 0x4e,
+  0x00, 0x01, 0xed, 0x04, 0x6a, 0x6e, 0x6f, 0x68, 0x80, 0x00, 0x00, 0x00,
+  0x02, 0x6b, 0x6f, 0x00, 0xa2, 0xe1, 0x00, 0xa2, 0xe9, 0x05, 0x6f, 0x62,
+  0x6d, 0x65, 0x73, 0x80, 0x00, 0x04, 0x70, 0x70, 0x61, 0x68, 0x80, 0x00,
+  0x00, 0x80, 0x01, 0x2e, 0x00, 0xa2, 0xf7, 0x00, 0x00, 0x05, 0x61, 0x65,
+  0x69, 0x6f, 0x75, 0x00, 0xa3, 0x0e, 0x00, 0xa3, 0x57, 0x00, 0xa3, 0x73,
+  0x00, 0xa3, 0xa1, 0x00, 0xa3, 0xab, 0x00, 0x00, 0x04, 0x64, 0x6d, 0x73,
+  0x74, 0x00, 0xa3, 0x21, 0x00, 0xa3, 0x2d, 0x00, 0x07, 0xb6, 0x00, 0xa3,
+  0x41, 0x09, 0x61, 0x6b, 0x61, 0x74, 0x6f, 0x67, 0x6e, 0x75, 0x62, 0x80,
+  0x00, 0x00, 0x00, 0x02, 0x61, 0x69, 0x00, 0x8e, 0x96, 0x00, 0xa3, 0x38,
+  0x06, 0x68, 0x73, 0x65, 0x6d, 0x69, 0x68, 0x80, 0x00, 0x00, 0x00, 0x02,
+  0x65, 0x69, 0x00, 0x97, 0x33, 0x00, 0xa3, 0x4c, 0x00, 0x00, 0x02, 0x68,
+  0x6f, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x00, 0x02, 0x6f, 0x75,
+  0x00, 0xa3, 0x62, 0x00, 0xa3, 0x6a, 0x05, 0x6e, 0x6f, 0x6b, 0x6f, 0x6b,
+  0x80, 0x00, 0x06, 0x73, 0x74, 0x69, 0x6d, 0x61, 0x6b, 0x80, 0x00, 0x00,
+  0x00, 0x03, 0x6a, 0x6b, 0x6d, 0x00, 0x5e, 0xe4, 0x00, 0xa3, 0x82, 0x00,
+  0xa3, 0x99, 0x00, 0x00, 0x03, 0x61, 0x69, 0x75, 0x00, 0xa3, 0x91, 0x00,
+  0x22, 0x90, 0x00, 0x1f, 0x93, 0x05, 0x73, 0x69, 0x6e, 0x75, 0x6b, 0x80,
+  0x00, 0x05, 0x75, 0x6b, 0x75, 0x73, 0x74, 0x80, 0x00, 0x07, 0x6e, 0x6f,
+  0x6f, 0x67, 0x6e, 0x75, 0x62, 0x80, 0x00, 0x00, 0x00, 0x04, 0x66, 0x6a,
+  0x70, 0x73, 0x00, 0x9f, 0x81, 0x00, 0x4c, 0xd6, 0x00, 0xa3, 0xbe, 0x00,
+  0x4c, 0xd6, 0x03, 0x70, 0x65, 0x62, 0x80, 0x00, 0x01, 0x61, 0x00, 0x03,
+  0x67, 0x6b, 0x6e, 0x00, 0xa3, 0xd4, 0x00, 0xa6, 0x1c, 0x00, 0xa6, 0xec,
+  0x01, 0x61, 0x00, 0x02, 0x6b, 0x6e, 0x00, 0xa3, 0xe0, 0x00, 0xa4, 0xb2,
+  0x00, 0x80, 0x01, 0x2e, 0x00, 0xa3, 0xe7, 0x00, 0x00, 0x05, 0x61, 0x65,
+  0x69, 0x6f, 0x75, 0x00, 0xa3, 0xfe, 0x00, 0xa4, 0x2d, 0x00, 0xa4, 0x37,
+  0x00, 0xa4, 0x69, 0x00, 0xa4, 0x87, 0x00, 0x00, 0x03, 0x6d, 0x72, 0x77,
+  0x00, 0xa4, 0x0d, 0x00, 0xa4, 0x16, 0x00, 0xa4, 0x1f, 0x06, 0x69, 0x68,
+  0x73, 0x6f, 0x61, 0x6e, 0x80, 0x00, 0x06, 0x69, 0x68, 0x6f, 0x74, 0x6f,
+  0x6b, 0x80, 0x00, 0x03, 0x61, 0x67, 0x61, 0x00, 0x02, 0x6b, 0x79, 0x00,
+  0x87, 0x5e, 0x00, 0x02, 0xa9, 0x07, 0x6d, 0x61, 0x67, 0x75, 0x72, 0x61,
+  0x6d, 0x80, 0x00, 0x00, 0x00, 0x03, 0x6a, 0x6b, 0x6d, 0x00, 0xa4, 0x46,
+  0x00, 0xa4, 0x59, 0x00, 0xa4, 0x60, 0x00, 0x00, 0x02, 0x6e, 0x75, 0x00,
+  0x95, 0xc2, 0x00, 0xa4, 0x51, 0x05, 0x73, 0x74, 0x6e, 0x65, 0x7a, 0x80,
+  0x00, 0x04, 0x75, 0x6e, 0x61, 0x73, 0x80, 0x00, 0x06, 0x6f, 0x6e, 0x69,
+  0x68, 0x63, 0x75, 0x80, 0x00, 0x00, 0x00, 0x03, 0x68, 0x6e, 0x79, 0x00,
+  0xa4, 0x78, 0x00, 0x4a, 0x42, 0x00, 0xa4, 0x80, 0x05, 0x73, 0x6f, 0x6e,
+  0x6f, 0x74, 0x80, 0x00, 0x04, 0x6f, 0x74, 0x69, 0x6d, 0x80, 0x00, 0x00,
+  0x00, 0x02, 0x73, 0x7a, 0x00, 0xa4, 0x92, 0x00, 0xa4, 0xac, 0x01, 0x74,
+  0x00, 0x02, 0x61, 0x6f, 0x00, 0xa4, 0x9e, 0x00, 0xa4, 0xa6, 0x05, 0x6d,
+  0x61, 0x6b, 0x61, 0x74, 0x80, 0x00, 0x03, 0x64, 0x61, 0x74, 0x80, 0x00,
+  0x03, 0x61, 0x74, 0x75, 0x80, 0x00, 0x02, 0x61, 0x6b, 0x80, 0x01, 0x2e,
+  0x00, 0xa4, 0xbb, 0x00, 0x00, 0x04, 0x61, 0x65, 0x69, 0x6f, 0x00, 0xa4,
+  0xce, 0x00, 0xa5, 0xa5, 0x00, 0xa5, 0xbd, 0x00, 0xa6, 0x01, 0x00, 0x40,
+  0x64, 0x16, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03,
+  0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x07, 0x00, 0x08,
+  0x00, 0x87, 0xae, 0x00, 0xa5, 0x00, 0x00, 0x23, 0x6f, 0x00, 0xa5, 0x14,
+  0x00, 0xa5, 0x1a, 0x00, 0xa5, 0x72, 0x00, 0xa5, 0x7b, 0x00, 0xa5, 0x9c,
+  0x02, 0x75, 0x73, 0x00, 0x02, 0x6f, 0x74, 0x00, 0xa2, 0x46, 0x00, 0xa5,
+  0x0d, 0x04, 0x61, 0x72, 0x69, 0x68, 0x80, 0x00, 0x03, 0x69, 0x62, 0x65,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x75, 0x00, 0xa5, 0x25, 0x00, 0xa5,
+  0x60, 0x00, 0x00, 0x03, 0x67, 0x68, 0x77, 0x00, 0xa5, 0x34, 0x00, 0xa5,
+  0x41, 0x00, 0xa5, 0x54, 0x0a, 0x69, 0x68, 0x73, 0x61, 0x69, 0x6d, 0x61,
+  0x6e, 0x69, 0x6d, 0x80, 0x00, 0x00, 0x00, 0x02, 0x65, 0x69, 0x00, 0x9c,
+  0x4d, 0x00, 0xa5, 0x4c, 0x05, 0x6d, 0x61, 0x67, 0x61, 0x73, 0x80, 0x00,
+  0x01, 0x61, 0x00, 0x02, 0x64, 0x67, 0x00, 0x02, 0x12, 0x00, 0x9f, 0x81,
+  0x00, 0x00, 0x02, 0x69, 0x6b, 0x00, 0x03, 0x40, 0x00, 0xa5, 0x6b, 0x04,
+  0x61, 0x6d, 0x61, 0x6b, 0x80, 0x00, 0x06, 0x69, 0x6b, 0x61, 0x6d, 0x61,
+  0x79, 0x80, 0x00, 0x01, 0x61, 0x00, 0x02, 0x6b, 0x73, 0x00, 0xa5, 0x87,
+  0x00, 0x8c, 0xc5, 0x00, 0x00, 0x03, 0x69, 0x6f, 0x75, 0x00, 0x02, 0xa9,
+  0x00, 0xa5, 0x96, 0x00, 0x99, 0x9d, 0x03, 0x79, 0x69, 0x6b, 0x80, 0x00,
+  0x06, 0x69, 0x6d, 0x6f, 0x6e, 0x69, 0x6e, 0x80, 0x00, 0x00, 0x00, 0x02,
+  0x6e, 0x73, 0x00, 0xa5, 0xb0, 0x00, 0xa5, 0xb7, 0x04, 0x6f, 0x6b, 0x61,
+  0x68, 0x80, 0x00, 0x03, 0x61, 0x79, 0x61, 0x80, 0x00, 0x00, 0x00, 0x07,
+  0x61, 0x65, 0x67, 0x68, 0x6b, 0x6f, 0x75, 0x00, 0x24, 0x35, 0x00, 0xa5,
+  0xdc, 0x00, 0xa5, 0xe3, 0x00, 0xa5, 0xea, 0x00, 0xa5, 0xf0, 0x00, 0x01,
+  0xed, 0x00, 0xa5, 0xfa, 0x04, 0x73, 0x69, 0x61, 0x6b, 0x80, 0x00, 0x04,
+  0x75, 0x73, 0x74, 0x61, 0x80, 0x00, 0x03, 0x73, 0x75, 0x7a, 0x80, 0x00,
+  0x07, 0x61, 0x73, 0x61, 0x67, 0x69, 0x68, 0x63, 0x80, 0x00, 0x04, 0x6b,
+  0x75, 0x73, 0x74, 0x80, 0x00, 0x00, 0x00, 0x03, 0x6e, 0x73, 0x74, 0x00,
+  0xa6, 0x10, 0x00, 0xa6, 0x17, 0x00, 0x94, 0x79, 0x04, 0x61, 0x64, 0x61,
+  0x68, 0x80, 0x00, 0x02, 0x69, 0x6f, 0x80, 0x00, 0x04, 0x69, 0x68, 0x73,
+  0x69, 0x80, 0x01, 0x2e, 0x00, 0xa6, 0x27, 0x00, 0x00, 0x05, 0x61, 0x69,
+  0x6e, 0x6f, 0x75, 0x00, 0xa6, 0x3e, 0x00, 0xa6, 0x85, 0x00, 0xa6, 0xa7,
+  0x00, 0xa6, 0xb0, 0x00, 0xa6, 0xc4, 0x00, 0x00, 0x06, 0x64, 0x67, 0x6b,
+  0x6d, 0x74, 0x77, 0x00, 0xa6, 0x59, 0x00, 0x21, 0x4a, 0x00, 0x83, 0xb0,
+  0x00, 0x98, 0x75, 0x00, 0xa6, 0x62, 0x00, 0xa6, 0x7c, 0x06, 0x61, 0x6e,
+  0x69, 0x68, 0x63, 0x75, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x69, 0x00,
+  0xa6, 0x6d, 0x00, 0xa6, 0x74, 0x04, 0x62, 0x75, 0x73, 0x74, 0x80, 0x00,
+  0x05, 0x6b, 0x61, 0x77, 0x61, 0x6b, 0x80, 0x00, 0x06, 0x61, 0x7a, 0x61,
+  0x6e, 0x61, 0x6b, 0x80, 0x00, 0x00, 0x00, 0x04, 0x67, 0x68, 0x6d, 0x75,
+  0x00, 0x9e, 0xda, 0x00, 0xa6, 0x98, 0x00, 0x67, 0x13, 0x00, 0xa6, 0xa1,
+  0x06, 0x63, 0x69, 0x6f, 0x6e, 0x6f, 0x6e, 0x80, 0x00, 0x03, 0x6b, 0x61,
+  0x68, 0x80, 0x00, 0x06, 0x61, 0x73, 0x75, 0x6b, 0x61, 0x68, 0x80, 0x00,
+  0x00, 0x00, 0x02, 0x61, 0x74, 0x00, 0x65, 0xd9, 0x00, 0xa6, 0xbb, 0x02,
+  0x6f, 0x6e, 0x80, 0x01, 0x61, 0x00, 0x24, 0x35, 0x00, 0x00, 0x03, 0x6b,
+  0x73, 0x7a, 0x00, 0xa6, 0xd3, 0x00, 0x98, 0x26, 0x00, 0xa6, 0xda, 0x04,
+  0x6f, 0x68, 0x61, 0x6b, 0x80, 0x00, 0x00, 0x00, 0x02, 0x69, 0x75, 0x00,
+  0xa6, 0xe5, 0x00, 0x03, 0x8e, 0x04, 0x6d, 0x61, 0x6e, 0x61, 0x80, 0x00,
+  0x03, 0x69, 0x6b, 0x6f, 0x80, 0x01, 0x2e, 0x00, 0xa6, 0xf6, 0x00, 0x00,
+  0x06, 0x61, 0x65, 0x69, 0x6e, 0x6f, 0x75, 0x00, 0xa7, 0x11, 0x00, 0xa7,
+  0x97, 0x00, 0xa7, 0xaf, 0x00, 0xa8, 0x2d, 0x00, 0xa8, 0x66, 0x00, 0xa8,
+  0x83, 0x00, 0x00, 0x07, 0x68, 0x6d, 0x6e, 0x72, 0x77, 0x79, 0x7a, 0x00,
+  0x3d, 0x0e, 0x00, 0xa7, 0x30, 0x00, 0xa7, 0x47, 0x00, 0xa7, 0x5d, 0x00,
+  0xa7, 0x71, 0x00, 0xa7, 0x8a, 0x00, 0xa7, 0x90, 0x00, 0x00, 0x03, 0x61,
+  0x69, 0x75, 0x00, 0x22, 0x10, 0x00, 0xa7, 0x3f, 0x00, 0x03, 0xea, 0x05,
+  0x6a, 0x65, 0x6d, 0x75, 0x6b, 0x80, 0x00, 0x00, 0x00, 0x02, 0x65, 0x6e,
+  0x00, 0xa7, 0x52, 0x00, 0x02, 0x12, 0x00, 0x00, 0x02, 0x64, 0x7a, 0x00,
+  0x21, 0x4a, 0x00, 0x02, 0x83, 0x01, 0x61, 0x00, 0x02, 0x68, 0x72, 0x00,
+  0xa7, 0x69, 0x00, 0x5e, 0xe4, 0x05, 0x69, 0x68, 0x73, 0x69, 0x6e, 0x80,
+  0x00, 0x01, 0x61, 0x00, 0x02, 0x6b, 0x6e, 0x00, 0xa7, 0x7d, 0x00, 0xa7,
+  0x84, 0x04, 0x69, 0x68, 0x73, 0x69, 0x80, 0x00, 0x03, 0x69, 0x6b, 0x6f,
+  0x80, 0x00, 0x03, 0x65, 0x68, 0x69, 0x80, 0x00, 0x04, 0x6f, 0x6e, 0x69,
+  0x67, 0x80, 0x00, 0x00, 0x00, 0x02, 0x6f, 0x73, 0x00, 0xa7, 0xa2, 0x00,
+  0xa7, 0xa9, 0x04, 0x73, 0x61, 0x72, 0x75, 0x80, 0x00, 0x03, 0x65, 0x61,
+  0x79, 0x80, 0x00, 0x00, 0x00, 0x05, 0x68, 0x6a, 0x6b, 0x6d, 0x6e, 0x00,
+  0xa7, 0xc6, 0x00, 0xa7, 0xce, 0x00, 0xa7, 0xd6, 0x00, 0xa7, 0xf5, 0x00,
+  0xa8, 0x23, 0x05, 0x73, 0x61, 0x67, 0x69, 0x68, 0x80, 0x00, 0x05, 0x6f,
+  0x6d, 0x69, 0x68, 0x73, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x69, 0x00,
+  0xa7, 0xe1, 0x00, 0xa7, 0xec, 0x00, 0x00, 0x02, 0x67, 0x6e, 0x00, 0xa7,
+  0x7d, 0x00, 0x3d, 0xa3, 0x06, 0x68, 0x73, 0x61, 0x6b, 0x6f, 0x74, 0x80,
+  0x00, 0x00, 0x00, 0x03, 0x61, 0x69, 0x6f, 0x00, 0xa8, 0x04, 0x00, 0x8b,
+  0x9e, 0x00, 0xa8, 0x1b, 0x00, 0x00, 0x03, 0x67, 0x6b, 0x6d, 0x00, 0x9a,
+  0x46, 0x00, 0xa8, 0x13, 0x00, 0x23, 0x6f, 0x05, 0x69, 0x68, 0x73, 0x75,
+  0x67, 0x80, 0x00, 0x05, 0x74, 0x65, 0x6b, 0x61, 0x74, 0x80, 0x00, 0x03,
+  0x75, 0x67, 0x61, 0x80, 0x01, 0x6e, 0x00, 0xa0, 0x59, 0x00, 0x00, 0x02,
+  0x61, 0x69, 0x00, 0xa8, 0x38, 0x00, 0xa8, 0x54, 0x00, 0x00, 0x03, 0x6d,
+  0x74, 0x77, 0x00, 0xa8, 0x47, 0x00, 0xa8, 0x4d, 0x00, 0xa7, 0x90, 0x03,
+  0x6f, 0x74, 0x69, 0x80, 0x00, 0x04, 0x69, 0x6d, 0x6f, 0x79, 0x80, 0x00,
+  0x00, 0x00, 0x02, 0x6a, 0x6b, 0x00, 0xa8, 0x5f, 0x00, 0x01, 0xed, 0x04,
+  0x69, 0x6b, 0x61, 0x6e, 0x80, 0x00, 0x00, 0x00, 0x03, 0x67, 0x6a, 0x74,
+  0x00, 0x3d, 0x0e, 0x00, 0x65, 0xd9, 0x00, 0xa8, 0x75, 0x03, 0x69, 0x61,
+  0x64, 0x00, 0x02, 0x61, 0x69, 0x00, 0xa1, 0xf6, 0x00, 0x95, 0xf8, 0x00,
+  0x00, 0x03, 0x62, 0x6b, 0x72, 0x00, 0xa8, 0x92, 0x00, 0xa8, 0x99, 0x00,
+  0xa8, 0xb2, 0x04, 0x6f, 0x74, 0x6f, 0x6d, 0x80, 0x00, 0x04, 0x75, 0x73,
+  0x75, 0x67, 0x00, 0x02, 0x61, 0x69, 0x00, 0xa8, 0xa8, 0x00, 0x83, 0xe3,
+  0x03, 0x6b, 0x61, 0x6e, 0x80, 0x01, 0x61, 0x00, 0xa1, 0xf6, 0x02, 0x61,
+  0x62, 0x00, 0x02, 0x61, 0x65, 0x00, 0x9f, 0x7b, 0x00, 0x66, 0x39, 0x04,
+  0x6f, 0x67, 0x61, 0x6e, 0x82, 0x01, 0x2e, 0x00, 0x8e, 0x3c, 0x00, 0x00,
+  0x02, 0x61, 0x65, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x00, 0x05,
+  0x62, 0x69, 0x6d, 0x6e, 0x74, 0x00, 0xa8, 0xec, 0x00, 0xa8, 0xf5, 0x00,
+  0xaa, 0x23, 0x00, 0xab, 0x1e, 0x00, 0xac, 0x34, 0x02, 0x6f, 0x6b, 0x82,
+  0x01, 0x2e, 0x00, 0x8e, 0x3c, 0x01, 0x6d, 0x80, 0x01, 0x2e, 0x00, 0xa8,
+  0xfd, 0x00, 0x00, 0x05, 0x61, 0x65, 0x69, 0x6f, 0x75, 0x00, 0xa9, 0x14,
+  0x00, 0xa9, 0x79, 0x00, 0xa9, 0x90, 0x00, 0xa9, 0xf2, 0x00, 0x93, 0x3d,
+  0x00, 0x00, 0x05, 0x62, 0x6b, 0x6d, 0x6e, 0x77, 0x00, 0x3d, 0xa3, 0x00,
+  0xa9, 0x2b, 0x00, 0xa9, 0x45, 0x00, 0xa9, 0x66, 0x00, 0xa9, 0x6d, 0x00,
+  0x00, 0x02, 0x61, 0x75, 0x00, 0xa9, 0x36, 0x00, 0xa9, 0x3f, 0x06, 0x73,
+  0x75, 0x73, 0x74, 0x61, 0x6d, 0x80, 0x00, 0x03, 0x7a, 0x75, 0x73, 0x80,
+  0x00, 0x00, 0x00, 0x02, 0x61, 0x69, 0x00, 0xa9, 0x50, 0x00, 0x24, 0xd0,
+  0x00, 0x00, 0x02, 0x68, 0x79, 0x00, 0x01, 0x7d, 0x00, 0xa9, 0x5b, 0x00,
+  0x00, 0x02, 0x65, 0x69, 0x00, 0x82, 0x39, 0x00, 0x03, 0x40, 0x04, 0x61,
+  0x77, 0x75, 0x6b, 0x80, 0x00, 0x01, 0x69, 0x00, 0x02, 0x65, 0x6b, 0x00,
+  0x03, 0x40, 0x00, 0x01, 0xed, 0x00, 0x00, 0x03, 0x62, 0x6f, 0x73, 0x00,
+  0x92, 0x9e, 0x00, 0x8f, 0xd7, 0x00, 0xa9, 0x88, 0x01, 0x69, 0x80, 0x01,
+  0x69, 0x00, 0x95, 0xf8, 0x00, 0x00, 0x05, 0x61, 0x67, 0x68, 0x6b, 0x72,
+  0x00, 0xa9, 0xa7, 0x00, 0xa9, 0xaf, 0x00, 0xa9, 0xb6, 0x00, 0xa9, 0xca,
+  0x00, 0xa9, 0xeb, 0x05, 0x72, 0x61, 0x74, 0x61, 0x77, 0x80, 0x00, 0x04,
+  0x75, 0x73, 0x69, 0x6d, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x63, 0x00,
+  0x02, 0x2e, 0x00, 0xa9, 0xc1, 0x06, 0x69, 0x61, 0x6b, 0x6b, 0x6f, 0x79,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x69, 0x00, 0xa9, 0xd5, 0x00, 0x81,
+  0x96, 0x00, 0x00, 0x03, 0x6d, 0x73, 0x74, 0x00, 0x81, 0x96, 0x00, 0xa9,
+  0xe4, 0x00, 0x01, 0xed, 0x04, 0x6f, 0x73, 0x69, 0x6b, 0x80, 0x00, 0x04,
+  0x61, 0x62, 0x61, 0x6e, 0x80, 0x00, 0x00, 0x00, 0x03, 0x64, 0x68, 0x6e,
+  0x00, 0x81, 0x96, 0x00, 0x84, 0x8d, 0x00, 0xaa, 0x01, 0x00, 0x00, 0x03,
+  0x61, 0x69, 0x6f, 0x00, 0x8f, 0x9e, 0x00, 0xaa, 0x10, 0x00, 0xaa, 0x18,
+  0x05, 0x68, 0x73, 0x65, 0x72, 0x75, 0x80, 0x00, 0x00, 0x00, 0x02, 0x64,
+  0x6d, 0x00, 0x07, 0xb6, 0x00, 0x22, 0x0b, 0x03, 0x69, 0x68, 0x65, 0x80,
+  0x01, 0x2e, 0x00, 0xaa, 0x2d, 0x00, 0x00, 0x06, 0x61, 0x65, 0x69, 0x6e,
+  0x6f, 0x75, 0x00, 0xaa, 0x48, 0x00, 0xaa, 0x97, 0x00, 0xaa, 0x9d, 0x00,
+  0xaa, 0xbb, 0x00, 0xaa, 0xda, 0x00, 0xab, 0x0c, 0x00, 0x00, 0x02, 0x6d,
+  0x74, 0x00, 0xaa, 0x53, 0x00, 0xaa, 0x8d, 0x00, 0x00, 0x02, 0x61, 0x69,
+  0x00, 0xaa, 0x5e, 0x00, 0xaa, 0x7c, 0x00, 0x00, 0x02, 0x68, 0x79, 0x00,
+  0xaa, 0x69, 0x00, 0x87, 0xae, 0x00, 0x00, 0x02, 0x61, 0x69, 0x00, 0xaa,
+  0x74, 0x00, 0x6e, 0xff, 0x05, 0x74, 0x61, 0x77, 0x61, 0x79, 0x80, 0x00,
+  0x01, 0x6a, 0x00, 0x02, 0x61, 0x69, 0x00, 0xaa, 0x88, 0x00, 0x82, 0x39,
+  0x02, 0x77, 0x75, 0x80, 0x00, 0x03, 0x61, 0x6b, 0x69, 0x80, 0x01, 0x6d,
+  0x00, 0x3d, 0x0e, 0x03, 0x62, 0x6f, 0x74, 0x80, 0x00, 0x00, 0x00, 0x03,
+  0x61, 0x6b, 0x72, 0x00, 0x90, 0xbe, 0x00, 0xaa, 0xac, 0x00, 0xaa, 0xb3,
+  0x04, 0x61, 0x73, 0x61, 0x6d, 0x80, 0x00, 0x05, 0x61, 0x62, 0x61, 0x6d,
+  0x69, 0x80, 0x00, 0x00, 0x00, 0x03, 0x61, 0x65, 0x6f, 0x00, 0xaa, 0xca,
+  0x00, 0xaa, 0xd0, 0x00, 0x3d, 0xa3, 0x03, 0x6e, 0x69, 0x61, 0x80, 0x00,
+  0x07, 0x67, 0x6f, 0x6b, 0x61, 0x6d, 0x75, 0x6b, 0x80, 0x00, 0x00, 0x00,
+  0x05, 0x6a, 0x6b, 0x6e, 0x75, 0x79, 0x00, 0x8e, 0xd7, 0x00, 0xaa, 0xf1,
+  0x00, 0x87, 0xae, 0x00, 0xaa, 0xf8, 0x00, 0xab, 0x04, 0x04, 0x69, 0x68,
+  0x63, 0x75, 0x80, 0x00, 0x09, 0x68, 0x63, 0x75, 0x6b, 0x6f, 0x6b, 0x69,
+  0x68, 0x73, 0x80, 0x00, 0x01, 0x69, 0x80, 0x01, 0x65, 0x00, 0x03, 0x8e,
+  0x00, 0x00, 0x02, 0x6b, 0x7a, 0x00, 0xab, 0x17, 0x00, 0x02, 0x12, 0x04,
+  0x6f, 0x68, 0x69, 0x6b, 0x80, 0x00, 0x00, 0x80, 0x01, 0x61, 0x00, 0xab,
+  0x25, 0x04, 0x6d, 0x69, 0x68, 0x73, 0x80, 0x01, 0x2e, 0x00, 0xab, 0x30,
+  0x00, 0x00, 0x06, 0x61, 0x65, 0x69, 0x6e, 0x6f, 0x75, 0x00, 0xab, 0x4b,
+  0x00, 0xab, 0xa3, 0x00, 0xab, 0xb6, 0x00, 0xab, 0xe6, 0x00, 0xab, 0xed,
+  0x00, 0xac, 0x23, 0x00, 0x00, 0x04, 0x64, 0x6b, 0x6d, 0x77, 0x00, 0xab,
+  0x5e, 0x00, 0xab, 0x79, 0x00, 0xab, 0x81, 0x00, 0xab, 0x9c, 0x00, 0x00,
+  0x03, 0x61, 0x68, 0x75, 0x00, 0xab, 0x6d, 0x00, 0x02, 0x12, 0x00, 0xab,
+  0x73, 0x03, 0x6d, 0x61, 0x68, 0x80, 0x00, 0x03, 0x73, 0x61, 0x6d, 0x80,
+  0x00, 0x05, 0x75, 0x73, 0x74, 0x61, 0x79, 0x80, 0x00, 0x00, 0x00, 0x02,
+  0x61, 0x69, 0x00, 0x01, 0xed, 0x00, 0xab, 0x8c, 0x05, 0x68, 0x73, 0x6f,
+  0x6e, 0x69, 0x00, 0x02, 0x68, 0x6b, 0x00, 0x9f, 0x5f, 0x00, 0x02, 0x12,
+  0x04, 0x61, 0x6b, 0x69, 0x68, 0x80, 0x00, 0x00, 0x00, 0x02, 0x6e, 0x75,
+  0x00, 0xab, 0xae, 0x00, 0x83, 0x8a, 0x05, 0x61, 0x6d, 0x69, 0x68, 0x73,
+  0x80, 0x00, 0x00, 0x00, 0x03, 0x67, 0x6b, 0x6d, 0x00, 0xab, 0xc5, 0x00,
+  0xab, 0xd6, 0x00, 0xab, 0xdf, 0x00, 0x00, 0x02, 0x61, 0x75, 0x00, 0x93,
+  0x73, 0x00, 0xab, 0xd0, 0x03, 0x73, 0x61, 0x79, 0x80, 0x00, 0x06, 0x6f,
+  0x6e, 0x69, 0x6b, 0x61, 0x6b, 0x80, 0x00, 0x04, 0x69, 0x6b, 0x69, 0x68,
+  0x80, 0x00, 0x04, 0x61, 0x6e, 0x6e, 0x75, 0x80, 0x00, 0x00, 0x00, 0x03,
+  0x6d, 0x6e, 0x74, 0x00, 0xab, 0xfc, 0x00, 0xac, 0x14, 0x00, 0xac, 0x1c,
+  0x01, 0x75, 0x00, 0x02, 0x6b, 0x7a, 0x00, 0x8a, 0x8a, 0x00, 0xac, 0x08,
+  0x01, 0x69, 0x80, 0x02, 0x69, 0x75, 0x00, 0x91, 0x49, 0x00, 0x93, 0x38,
+  0x05, 0x61, 0x77, 0x75, 0x73, 0x74, 0x80, 0x00, 0x04, 0x61, 0x73, 0x69,
+  0x6d, 0x80, 0x00, 0x00, 0x00, 0x02, 0x73, 0x79, 0x00, 0xac, 0x2e, 0x00,
+  0x9b, 0xd0, 0x03, 0x74, 0x6f, 0x67, 0x80, 0x00, 0x03, 0x61, 0x77, 0x69,
+  0x80, 0x01, 0x2e, 0x00, 0xac, 0x3e, 0x00, 0x00, 0x05, 0x61, 0x65, 0x69,
+  0x6f, 0x75, 0x00, 0xac, 0x55, 0x00, 0xac, 0xe9, 0x00, 0xad, 0x11, 0x00,
+  0xad, 0xd1, 0x00, 0xad, 0xf4, 0x00, 0x00, 0x05, 0x62, 0x64, 0x6b, 0x74,
+  0x77, 0x00, 0xac, 0x6c, 0x00, 0xac, 0x73, 0x00, 0xac, 0x7e, 0x00, 0xac,
+  0x86, 0x00, 0xac, 0xb5, 0x04, 0x61, 0x68, 0x61, 0x79, 0x80, 0x00, 0x00,
+  0x00, 0x02, 0x61, 0x6f, 0x00, 0x89, 0xe0, 0x00, 0x02, 0x03, 0x05, 0x6f,
+  0x69, 0x72, 0x6f, 0x6d, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x69, 0x00,
+  0xac, 0x91, 0x00, 0xac, 0xaf, 0x00, 0x00, 0x02, 0x68, 0x6b, 0x00, 0xac,
+  0x9c, 0x00, 0xac, 0xa3, 0x04, 0x6f, 0x6e, 0x61, 0x74, 0x80, 0x00, 0x09,
+  0x61, 0x74, 0x6e, 0x65, 0x7a, 0x75, 0x6b, 0x69, 0x72, 0x80, 0x00, 0x03,
+  0x6d, 0x75, 0x73, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x69, 0x00, 0xac,
+  0xc0, 0x00, 0x24, 0xd0, 0x00, 0x00, 0x02, 0x73, 0x7a, 0x00, 0xac, 0xcb,
+  0x00, 0xac, 0xe2, 0x00, 0x00, 0x02, 0x69, 0x75, 0x00, 0xac, 0xd6, 0x00,
+  0xac, 0xdc, 0x03, 0x6a, 0x75, 0x66, 0x80, 0x00, 0x03, 0x7a, 0x69, 0x6d,
+  0x80, 0x00, 0x04, 0x69, 0x6b, 0x61, 0x74, 0x80, 0x00, 0x00, 0x00, 0x02,
+  0x68, 0x74, 0x00, 0xac, 0xf4, 0x00, 0x8c, 0xff, 0x02, 0x6f, 0x6e, 0x00,
+  0x02, 0x69, 0x75, 0x00, 0xad, 0x01, 0x00, 0x05, 0x9d, 0x00, 0x00, 0x02,
+  0x68, 0x6e, 0x00, 0xad, 0x0c, 0x00, 0x01, 0xed, 0x02, 0x63, 0x69, 0x80,
+  0x00, 0x00, 0x00, 0x05, 0x61, 0x68, 0x6a, 0x6b, 0x6d, 0x00, 0xad, 0x28,
+  0x00, 0xad, 0x3e, 0x00, 0xad, 0x65, 0x00, 0xad, 0x76, 0x00, 0xad, 0xb0,
+  0x00, 0x00, 0x03, 0x64, 0x6d, 0x77, 0x00, 0x7d, 0x4e, 0x00, 0xad, 0x37,
+  0x00, 0x21, 0x4a, 0x04, 0x75, 0x72, 0x61, 0x6b, 0x80, 0x00, 0x00, 0x00,
+  0x02, 0x63, 0x73, 0x00, 0xad, 0x49, 0x00, 0xad, 0x50, 0x04, 0x75, 0x73,
+  0x74, 0x6f, 0x80, 0x00, 0x01, 0x69, 0x00, 0x02, 0x61, 0x75, 0x00, 0x82,
+  0x39, 0x00, 0xad, 0x5c, 0x06, 0x6b, 0x75, 0x7a, 0x69, 0x68, 0x73, 0x80,
+  0x00, 0x00, 0x00, 0x02, 0x6f, 0x75, 0x00, 0xad, 0x70, 0x00, 0x05, 0x9d,
+  0x03, 0x62, 0x6f, 0x6a, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x65, 0x00,
+  0xad, 0x81, 0x00, 0xad, 0xa6, 0x00, 0x00, 0x02, 0x6d, 0x73, 0x00, 0xad,
+  0x8c, 0x00, 0xad, 0x9d, 0x00, 0x00, 0x02, 0x61, 0x75, 0x00, 0x45, 0x0a,
+  0x00, 0xad, 0x97, 0x03, 0x7a, 0x75, 0x6b, 0x80, 0x00, 0x06, 0x61, 0x67,
+  0x65, 0x6e, 0x61, 0x6b, 0x80, 0x00, 0x07, 0x73, 0x6f, 0x6e, 0x69, 0x68,
+  0x63, 0x69, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x75, 0x00, 0xad, 0xbb,
+  0x00, 0xad, 0xc3, 0x05, 0x6b, 0x61, 0x74, 0x69, 0x6b, 0x80, 0x00, 0x03,
+  0x7a, 0x69, 0x61, 0x00, 0x02, 0x72, 0x77, 0x00, 0x5e, 0xe4, 0x00, 0x02,
+  0x83, 0x00, 0x00, 0x03, 0x6b, 0x6e, 0x74, 0x00, 0x8c, 0x16, 0x00, 0xad,
+  0xe0, 0x00, 0xad, 0xec, 0x01, 0x6f, 0x00, 0x02, 0x72, 0x74, 0x00, 0x5e,
+  0xe4, 0x00, 0x01, 0xed, 0x05, 0x61, 0x6e, 0x75, 0x66, 0x6f, 0x80, 0x00,
+  0x03, 0x68, 0x73, 0x6f, 0x80, 0x00, 0x00, 0x00, 0x06, 0x61, 0x67, 0x68,
+  0x6b, 0x72, 0x75, 0x00, 0xae, 0x15, 0x00, 0xae, 0x20, 0x00, 0xb1, 0x4e,
+  0x00, 0xb6, 0xed, 0x00, 0xbb, 0xd1, 0x00, 0xbd, 0x92, 0x04, 0x64, 0x6e,
+  0x65, 0x73, 0x82, 0x01, 0x2e, 0x00, 0x8e, 0x3c, 0x00, 0x00, 0x02, 0x61,
+  0x69, 0x00, 0xae, 0x2b, 0x00, 0xaf, 0xd6, 0x03, 0x79, 0x69, 0x6d, 0x80,
+  0x01, 0x2e, 0x00, 0xae, 0x35, 0x00, 0x00, 0x05, 0x61, 0x65, 0x69, 0x6f,
+  0x75, 0x00, 0xae, 0x4c, 0x00, 0xaf, 0x05, 0x00, 0xaf, 0x17, 0x00, 0xaf,
+  0x7d, 0x00, 0xaf, 0xa6, 0x00, 0x00, 0x06, 0x64, 0x6d, 0x72, 0x74, 0x77,
+  0x79, 0x00, 0xae, 0x67, 0x00, 0xae, 0x6e, 0x00, 0xae, 0xb5, 0x00, 0xae,
+  0xcc, 0x00, 0xae, 0xd8, 0x00, 0xae, 0xf4, 0x04, 0x75, 0x6b, 0x61, 0x6b,
+  0x80, 0x00, 0x00, 0x00, 0x03, 0x61, 0x69, 0x75, 0x00, 0xae, 0x7d, 0x00,
+  0xae, 0x8f, 0x00, 0xae, 0x9d, 0x00, 0x00, 0x02, 0x67, 0x6b, 0x00, 0xae,
+  0x88, 0x00, 0x83, 0xb0, 0x04, 0x6f, 0x69, 0x68, 0x73, 0x80, 0x00, 0x07,
+  0x68, 0x73, 0x75, 0x73, 0x74, 0x61, 0x6d, 0x80, 0x01, 0x69, 0x00, 0x91,
+  0x49, 0x01, 0x6e, 0x00, 0x02, 0x61, 0x6e, 0x00, 0xae, 0xa9, 0x00, 0xae,
+  0xae, 0x02, 0x77, 0x69, 0x80, 0x00, 0x04, 0x65, 0x73, 0x65, 0x6b, 0x80,
+  0x00, 0x00, 0x00, 0x02, 0x61, 0x69, 0x00, 0xae, 0xc0, 0x00, 0xae, 0xc7,
+  0x04, 0x77, 0x61, 0x67, 0x6f, 0x80, 0x00, 0x02, 0x68, 0x6f, 0x80, 0x00,
+  0x01, 0x61, 0x00, 0x02, 0x62, 0x72, 0x00, 0x83, 0xb0, 0x00, 0x37, 0x55,
+  0x00, 0x00, 0x02, 0x61, 0x69, 0x00, 0xae, 0xe3, 0x00, 0x81, 0x96, 0x00,
+  0x00, 0x02, 0x67, 0x6b, 0x00, 0xae, 0xee, 0x00, 0x9a, 0xa3, 0x03, 0x61,
+  0x6e, 0x6f, 0x80, 0x00, 0x00, 0x00, 0x02, 0x69, 0x75, 0x00, 0x83, 0xe3,
+  0x00, 0xae, 0xff, 0x03, 0x6b, 0x61, 0x77, 0x80, 0x00, 0x00, 0x00, 0x02,
+  0x6d, 0x6e, 0x00, 0x3d, 0xa3, 0x00, 0xaf, 0x10, 0x04, 0x69, 0x6d, 0x65,
+  0x73, 0x80, 0x00, 0x00, 0x00, 0x04, 0x68, 0x6b, 0x6d, 0x72, 0x00, 0xaf,
+  0x2a, 0x00, 0xaf, 0x34, 0x00, 0x21, 0x4a, 0x00, 0xaf, 0x5a, 0x07, 0x73,
+  0x69, 0x6f, 0x72, 0x69, 0x68, 0x73, 0x80, 0x00, 0x01, 0x61, 0x00, 0x02,
+  0x6d, 0x73, 0x00, 0xaf, 0x40, 0x00, 0xaf, 0x49, 0x06, 0x6f, 0x6e, 0x69,
+  0x68, 0x73, 0x69, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x6f, 0x00, 0xaf,
+  0x54, 0x00, 0x01, 0xed, 0x03, 0x77, 0x61, 0x6b, 0x80, 0x00, 0x00, 0x00,
+  0x02, 0x61, 0x6f, 0x00, 0xaf, 0x65, 0x00, 0xaf, 0x6b, 0x03, 0x74, 0x61,
+  0x77, 0x80, 0x00, 0x00, 0x00, 0x02, 0x6d, 0x74, 0x00, 0xaf, 0x76, 0x00,
+  0x3d, 0x0e, 0x04, 0x75, 0x72, 0x61, 0x6d, 0x80, 0x00, 0x00, 0x00, 0x03,
+  0x61, 0x6a, 0x74, 0x00, 0x25, 0xd6, 0x00, 0xaf, 0x8c, 0x00, 0xaf, 0x93,
+  0x04, 0x61, 0x67, 0x61, 0x74, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x6f,
+  0x00, 0x3a, 0x30, 0x00, 0xaf, 0x9e, 0x05, 0x6d, 0x61, 0x6d, 0x61, 0x79,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x66, 0x6b, 0x00, 0x5f, 0x53, 0x00, 0xaf,
+  0xb1, 0x00, 0x00, 0x02, 0x69, 0x75, 0x00, 0xaf, 0xbc, 0x00, 0xaf, 0xc9,
+  0x0a, 0x72, 0x6e, 0x61, 0x73, 0x69, 0x6d, 0x61, 0x6e, 0x69, 0x6d, 0x80,
+  0x00, 0x0a, 0x68, 0x73, 0x61, 0x6b, 0x69, 0x68, 0x63, 0x69, 0x68, 0x73,
+  0x80, 0x00, 0x04, 0x68, 0x63, 0x6f, 0x74, 0x80, 0x01, 0x2e, 0x00, 0xaf,
+  0xe1, 0x00, 0x00, 0x05, 0x61, 0x65, 0x69, 0x6f, 0x75, 0x00, 0xaf, 0xf8,
+  0x00, 0xb0, 0xc6, 0x00, 0xb0, 0xee, 0x00, 0xb1, 0x16, 0x00, 0xb1, 0x43,
+  0x00, 0x00, 0x07, 0x67, 0x6b, 0x6d, 0x72, 0x74, 0x77, 0x79, 0x00, 0xb0,
+  0x17, 0x00, 0x45, 0x69, 0x00, 0xb0, 0x34, 0x00, 0xb0, 0x53, 0x00, 0xb0,
+  0x7f, 0x00, 0xb0, 0x93, 0x00, 0xb0, 0xb1, 0x00, 0x00, 0x02, 0x61, 0x75,
+  0x00, 0xb0, 0x22, 0x00, 0x93, 0x3d, 0x00, 0x00, 0x02, 0x68, 0x6b, 0x00,
+  0x01, 0xed, 0x00, 0xb0, 0x2d, 0x04, 0x69, 0x68, 0x73, 0x61, 0x80, 0x00,
+  0x00, 0x00, 0x02, 0x61, 0x75, 0x00, 0xb0, 0x3f, 0x00, 0x8d, 0x80, 0x01,
+  0x79, 0x00, 0x02, 0x6f, 0x75, 0x00, 0x01, 0xed, 0x00, 0xb0, 0x4b, 0x05,
+  0x73, 0x61, 0x72, 0x61, 0x6b, 0x80, 0x00, 0x00, 0x00, 0x03, 0x61, 0x69,
+  0x75, 0x00, 0xb0, 0x62, 0x00, 0xae, 0xc7, 0x00, 0x82, 0x76, 0x00, 0x00,
+  0x02, 0x62, 0x77, 0x00, 0xb0, 0x6d, 0x00, 0xb0, 0x78, 0x08, 0x6f, 0x69,
+  0x68, 0x73, 0x75, 0x73, 0x61, 0x6e, 0x80, 0x00, 0x04, 0x61, 0x74, 0x68,
+  0x6f, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x69, 0x00, 0xb0, 0x8a, 0x00,
+  0x8a, 0x8a, 0x06, 0x6b, 0x69, 0x68, 0x73, 0x69, 0x6e, 0x80, 0x00, 0x01,
+  0x61, 0x00, 0x02, 0x6b, 0x7a, 0x00, 0xb0, 0x9f, 0x00, 0xb0, 0xa8, 0x06,
+  0x6f, 0x6e, 0x69, 0x6d, 0x61, 0x6b, 0x80, 0x00, 0x06, 0x65, 0x6e, 0x61,
+  0x6b, 0x61, 0x74, 0x80, 0x00, 0x00, 0x00, 0x02, 0x69, 0x6f, 0x00, 0xb0,
+  0xbc, 0x00, 0x83, 0xb0, 0x07, 0x6d, 0x6f, 0x6e, 0x75, 0x73, 0x74, 0x75,
+  0x80, 0x00, 0x00, 0x00, 0x03, 0x69, 0x6b, 0x6e, 0x00, 0xb0, 0xd5, 0x00,
+  0xb0, 0xdb, 0x00, 0xb0, 0xe6, 0x03, 0x69, 0x6a, 0x75, 0x80, 0x00, 0x08,
+  0x75, 0x73, 0x74, 0x6f, 0x6d, 0x69, 0x68, 0x73, 0x80, 0x00, 0x05, 0x75,
+  0x66, 0x61, 0x77, 0x69, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x67, 0x00,
+  0xb0, 0xf9, 0x00, 0xb1, 0x01, 0x05, 0x6b, 0x69, 0x68, 0x63, 0x69, 0x80,
+  0x00, 0x00, 0x00, 0x03, 0x65, 0x69, 0x6f, 0x00, 0xb1, 0x10, 0x00, 0xa1,
+  0x3c, 0x00, 0x02, 0x03, 0x03, 0x74, 0x6f, 0x6d, 0x80, 0x00, 0x00, 0x00,
+  0x04, 0x6b, 0x6e, 0x73, 0x74, 0x00, 0xb1, 0x29, 0x00, 0x22, 0x90, 0x00,
+  0xb1, 0x3b, 0x00, 0x1f, 0xfd, 0x00, 0x00, 0x02, 0x69, 0x6b, 0x00, 0xb1,
+  0x34, 0x00, 0x6e, 0xff, 0x04, 0x68, 0x73, 0x61, 0x6d, 0x80, 0x00, 0x05,
+  0x69, 0x6f, 0x72, 0x75, 0x6b, 0x80, 0x00, 0x00, 0x00, 0x02, 0x62, 0x73,
+  0x00, 0x01, 0x7d, 0x00, 0x3d, 0x0e, 0x00, 0x00, 0x02, 0x63, 0x73, 0x00,
+  0xb1, 0x59, 0x00, 0xb5, 0x73, 0x00, 0x00, 0x03, 0x69, 0x6f, 0x75, 0x00,
+  0xb1, 0x68, 0x00, 0xb3, 0x75, 0x00, 0xb4, 0xc6, 0x01, 0x61, 0x80, 0x01,
+  0x2e, 0x00, 0xb1, 0x70, 0x00, 0x00, 0x06, 0x61, 0x65, 0x69, 0x6e, 0x6f,
+  0x75, 0x00, 0xb1, 0x8b, 0x00, 0xb2, 0x36, 0x00, 0xb2, 0x6a, 0x00, 0xb2,
+  0xf4, 0x00, 0xb3, 0x19, 0x00, 0xb3, 0x3e, 0x00, 0x00, 0x06, 0x64, 0x6d,
+  0x72, 0x74, 0x77, 0x79, 0x00, 0x45, 0x0a, 0x00, 0xb1, 0xa6, 0x00, 0xb1,
+  0xda, 0x00, 0xb1, 0xff, 0x00, 0xb2, 0x15, 0x00, 0xb2, 0x21, 0x00, 0x00,
+  0x02, 0x61, 0x69, 0x00, 0xb1, 0xb1, 0x00, 0xb1, 0xcd, 0x00, 0x80, 0x02,
+  0x68, 0x79, 0x00, 0xb1, 0xbc, 0x00, 0xb1, 0xc7, 0x00, 0x00, 0x02, 0x61,
+  0x69, 0x00, 0x97, 0x33, 0x00, 0x03, 0x40, 0x03, 0x75, 0x6e, 0x69, 0x80,
+  0x00, 0x02, 0x68, 0x73, 0x00, 0x02, 0x69, 0x75, 0x00, 0xaa, 0x97, 0x00,
+  0x93, 0x3d, 0x00, 0x00, 0x03, 0x61, 0x69, 0x75, 0x00, 0xb1, 0xe9, 0x00,
+  0x05, 0x9d, 0x00, 0xb1, 0xf4, 0x00, 0x00, 0x02, 0x68, 0x74, 0x00, 0x81,
+  0x96, 0x00, 0x83, 0xb0, 0x00, 0x00, 0x02, 0x69, 0x6b, 0x00, 0x91, 0x49,
+  0x00, 0x8c, 0xff, 0x00, 0x00, 0x02, 0x69, 0x6f, 0x00, 0x82, 0xdf, 0x00,
+  0xb2, 0x0a, 0x00, 0x00, 0x02, 0x6b, 0x79, 0x00, 0x01, 0xed, 0x00, 0x3d,
+  0xa3, 0x01, 0x61, 0x00, 0x02, 0x6b, 0x7a, 0x00, 0x87, 0x40, 0x00, 0x92,
+  0x9e, 0x01, 0x69, 0x00, 0x02, 0x6d, 0x72, 0x00, 0xb2, 0x2d, 0x00, 0x21,
+  0x4a, 0x06, 0x6f, 0x6e, 0x69, 0x68, 0x63, 0x69, 0x80, 0x00, 0x00, 0x00,
+  0x05, 0x69, 0x6b, 0x6d, 0x6e, 0x74, 0x00, 0x8d, 0x80, 0x00, 0xb2, 0x4d,
+  0x00, 0xb2, 0x58, 0x00, 0x87, 0x40, 0x00, 0xb2, 0x61, 0x00, 0x00, 0x02,
+  0x61, 0x75, 0x00, 0x87, 0x40, 0x00, 0x02, 0x2e, 0x06, 0x61, 0x6e, 0x6f,
+  0x6b, 0x6f, 0x74, 0x80, 0x00, 0x06, 0x75, 0x6b, 0x61, 0x67, 0x61, 0x6e,
+  0x80, 0x00, 0x00, 0x00, 0x06, 0x61, 0x65, 0x68, 0x6b, 0x6d, 0x72, 0x00,
+  0xb2, 0x85, 0x00, 0x3d, 0xa3, 0x00, 0xb2, 0x9b, 0x00, 0xb2, 0xc7, 0x00,
+  0xb2, 0xe4, 0x00, 0xb2, 0xeb, 0x00, 0x00, 0x03, 0x67, 0x6b, 0x73, 0x00,
+  0xb2, 0x94, 0x00, 0x3d, 0xa3, 0x00, 0x0d, 0x85, 0x04, 0x75, 0x73, 0x61,
+  0x6b, 0x80, 0x00, 0x00, 0x00, 0x03, 0x61, 0x63, 0x73, 0x00, 0xb2, 0xaa,
+  0x00, 0x9f, 0xd1, 0x00, 0xb2, 0xb4, 0x07, 0x73, 0x61, 0x69, 0x72, 0x61,
+  0x77, 0x6f, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x6f, 0x00, 0xb2, 0xbf,
+  0x00, 0x90, 0x2f, 0x05, 0x68, 0x6f, 0x79, 0x6f, 0x74, 0x80, 0x00, 0x00,
+  0x00, 0x02, 0x61, 0x69, 0x00, 0xb2, 0xd2, 0x00, 0xb2, 0xdd, 0x00, 0x00,
+  0x02, 0x6d, 0x7a, 0x00, 0x22, 0x0b, 0x00, 0x8b, 0x5c, 0x04, 0x68, 0x73,
+  0x73, 0x69, 0x80, 0x00, 0x04, 0x6f, 0x74, 0x61, 0x79, 0x80, 0x00, 0x06,
+  0x6f, 0x67, 0x61, 0x6d, 0x61, 0x67, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61,
+  0x69, 0x00, 0xb2, 0xff, 0x00, 0xb3, 0x11, 0x01, 0x6e, 0x00, 0x02, 0x69,
+  0x6f, 0x00, 0xb3, 0x0b, 0x00, 0x05, 0x9d, 0x03, 0x6b, 0x65, 0x68, 0x80,
+  0x00, 0x05, 0x68, 0x73, 0x73, 0x69, 0x6e, 0x80, 0x00, 0x00, 0x00, 0x06,
+  0x67, 0x69, 0x6a, 0x72, 0x73, 0x74, 0x00, 0x3d, 0xa3, 0x00, 0x84, 0xb8,
+  0x00, 0x79, 0x4e, 0x00, 0xb3, 0x34, 0x00, 0x7d, 0x4e, 0x00, 0x06, 0x56,
+  0x07, 0x69, 0x68, 0x73, 0x6e, 0x69, 0x68, 0x73, 0x80, 0x00, 0x00, 0x00,
+  0x05, 0x62, 0x72, 0x73, 0x79, 0x7a, 0x00, 0x02, 0x12, 0x00, 0xb3, 0x55,
+  0x00, 0xb3, 0x5b, 0x00, 0xb3, 0x6e, 0x00, 0x66, 0x39, 0x03, 0x61, 0x68,
+  0x6f, 0x80, 0x00, 0x00, 0x00, 0x02, 0x6f, 0x74, 0x00, 0xa5, 0x96, 0x00,
+  0xb3, 0x66, 0x05, 0x61, 0x6b, 0x69, 0x68, 0x73, 0x80, 0x00, 0x04, 0x72,
+  0x69, 0x68, 0x63, 0x80, 0x00, 0x01, 0x6b, 0x80, 0x01, 0x2e, 0x00, 0xb3,
+  0x7d, 0x00, 0x00, 0x04, 0x61, 0x69, 0x6f, 0x75, 0x00, 0xb3, 0x90, 0x00,
+  0xb4, 0x0d, 0x00, 0xb4, 0x69, 0x00, 0xb4, 0xa7, 0x00, 0x00, 0x06, 0x64,
+  0x6b, 0x6d, 0x72, 0x73, 0x77, 0x00, 0xb3, 0xab, 0x00, 0x91, 0xdb, 0x00,
+  0xb3, 0xb2, 0x00, 0xb3, 0xbb, 0x00, 0xb3, 0xda, 0x00, 0xb3, 0xe3, 0x04,
+  0x75, 0x73, 0x61, 0x79, 0x80, 0x00, 0x06, 0x61, 0x79, 0x6f, 0x74, 0x6f,
+  0x6d, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x75, 0x00, 0xb3, 0xc6, 0x00,
+  0xb3, 0xd2, 0x01, 0x68, 0x00, 0x02, 0x69, 0x75, 0x00, 0x03, 0x40, 0x00,
+  0x96, 0x53, 0x05, 0x6d, 0x61, 0x6b, 0x61, 0x6e, 0x80, 0x00, 0x02, 0x6f,
+  0x74, 0x80, 0x01, 0x69, 0x00, 0x84, 0xb8, 0x01, 0x61, 0x00, 0x02, 0x67,
+  0x6b, 0x00, 0xb3, 0xef, 0x00, 0xb4, 0x02, 0x00, 0x00, 0x02, 0x61, 0x6f,
+  0x00, 0xa1, 0xf6, 0x00, 0xb3, 0xfa, 0x05, 0x64, 0x6f, 0x79, 0x69, 0x6e,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x6f, 0x00, 0x03, 0x8e, 0x00, 0x01,
+  0xed, 0x00, 0x00, 0x06, 0x65, 0x68, 0x6a, 0x6b, 0x6d, 0x72, 0x00, 0xb4,
+  0x28, 0x00, 0xb4, 0x2f, 0x00, 0xb4, 0x38, 0x00, 0xb4, 0x3e, 0x00, 0xb4,
+  0x56, 0x00, 0xb4, 0x62, 0x04, 0x73, 0x69, 0x65, 0x67, 0x80, 0x00, 0x02,
+  0x63, 0x6f, 0x80, 0x01, 0x6b, 0x00, 0x01, 0xed, 0x03, 0x61, 0x6d, 0x75,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x75, 0x00, 0xb4, 0x49, 0x00, 0xb4,
+  0x50, 0x00, 0x80, 0x01, 0x73, 0x00, 0x07, 0x87, 0x03, 0x73, 0x74, 0x6f,
+  0x80, 0x00, 0x01, 0x61, 0x00, 0x02, 0x67, 0x6b, 0x00, 0x21, 0x4a, 0x00,
+  0x01, 0xed, 0x04, 0x61, 0x68, 0x61, 0x6e, 0x80, 0x00, 0x00, 0x00, 0x04,
+  0x6d, 0x6e, 0x74, 0x79, 0x00, 0xb4, 0x7c, 0x00, 0xb4, 0x83, 0x00, 0xb4,
+  0x97, 0x00, 0xb4, 0x9e, 0x04, 0x75, 0x6b, 0x75, 0x73, 0x80, 0x00, 0x00,
+  0x00, 0x02, 0x69, 0x75, 0x00, 0x01, 0xed, 0x00, 0xb4, 0x8e, 0x02, 0x73,
+  0x74, 0x80, 0x01, 0x69, 0x00, 0x91, 0x49, 0x04, 0x6f, 0x72, 0x75, 0x6d,
+  0x80, 0x00, 0x02, 0x6f, 0x74, 0x80, 0x01, 0x6f, 0x00, 0x01, 0xed, 0x00,
+  0x00, 0x02, 0x6b, 0x7a, 0x00, 0xb4, 0xb2, 0x00, 0xb4, 0xba, 0x05, 0x6f,
+  0x6b, 0x6e, 0x61, 0x6e, 0x80, 0x00, 0x09, 0x69, 0x6d, 0x69, 0x68, 0x73,
+  0x61, 0x73, 0x6f, 0x74, 0x80, 0x00, 0x05, 0x67, 0x61, 0x6d, 0x61, 0x79,
+  0x80, 0x01, 0x2e, 0x00, 0xb4, 0xd2, 0x00, 0x00, 0x06, 0x61, 0x65, 0x69,
+  0x6e, 0x6f, 0x75, 0x00, 0xb4, 0xed, 0x00, 0xb5, 0x0b, 0x00, 0xb5, 0x1d,
+  0x00, 0xb5, 0x44, 0x00, 0x90, 0xfe, 0x00, 0xb5, 0x4c, 0x00, 0x00, 0x02,
+  0x6d, 0x74, 0x00, 0xb4, 0xf8, 0x00, 0x87, 0x40, 0x00, 0x00, 0x02, 0x61,
+  0x69, 0x00, 0xb5, 0x03, 0x00, 0xad, 0xf4, 0x05, 0x79, 0x75, 0x6b, 0x6f,
+  0x74, 0x80, 0x00, 0x00, 0x00, 0x02, 0x62, 0x73, 0x00, 0x07, 0xb6, 0x00,
+  0xb5, 0x16, 0x04, 0x75, 0x62, 0x61, 0x74, 0x80, 0x00, 0x00, 0x00, 0x04,
+  0x67, 0x6b, 0x6e, 0x72, 0x00, 0x66, 0x39, 0x00, 0xb5, 0x30, 0x00, 0xb5,
+  0x3c, 0x00, 0xab, 0x9c, 0x09, 0x65, 0x73, 0x6f, 0x6e, 0x6f, 0x6d, 0x69,
+  0x68, 0x73, 0x80, 0x00, 0x05, 0x75, 0x6b, 0x61, 0x77, 0x69, 0x80, 0x00,
+  0x05, 0x61, 0x6e, 0x75, 0x68, 0x73, 0x80, 0x00, 0x00, 0x00, 0x05, 0x62,
+  0x66, 0x6f, 0x73, 0x75, 0x00, 0x02, 0xa9, 0x00, 0x4e, 0xae, 0x00, 0xb5,
+  0x63, 0x00, 0xb5, 0x69, 0x00, 0x86, 0xaa, 0x03, 0x74, 0x69, 0x6d, 0x80,
+  0x00, 0x07, 0x74, 0x61, 0x6d, 0x61, 0x64, 0x75, 0x6b, 0x80, 0x00, 0x06,
+  0x61, 0x6e, 0x61, 0x6d, 0x61, 0x79, 0x80, 0x01, 0x2e, 0x00, 0xb5, 0x80,
+  0x00, 0x00, 0x06, 0x61, 0x65, 0x69, 0x6f, 0x73, 0x75, 0x00, 0xb5, 0x9b,
+  0x00, 0xb6, 0x09, 0x00, 0xb6, 0x11, 0x00, 0xb6, 0x6b, 0x00, 0xb6, 0xc2,
+  0x00, 0xb6, 0xcf, 0x00, 0x00, 0x04, 0x64, 0x6d, 0x72, 0x77, 0x00, 0xb5,
+  0xae, 0x00, 0xb5, 0xba, 0x00, 0xb5, 0xc3, 0x00, 0xb5, 0xe2, 0x09, 0x69,
+  0x68, 0x73, 0x6f, 0x79, 0x69, 0x6a, 0x75, 0x66, 0x80, 0x00, 0x06, 0x61,
+  0x79, 0x61, 0x62, 0x61, 0x74, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x75,
+  0x00, 0xb5, 0xce, 0x00, 0xb5, 0xd6, 0x05, 0x68, 0x6f, 0x6e, 0x65, 0x75,
+  0x80, 0x00, 0x09, 0x73, 0x74, 0x61, 0x6b, 0x69, 0x68, 0x73, 0x69, 0x6e,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x6f, 0x00, 0xb5, 0xed, 0x00, 0x24,
+  0xd0, 0x00, 0x00, 0x02, 0x6b, 0x73, 0x00, 0xb5, 0xf8, 0x00, 0x98, 0xb5,
+  0x00, 0x00, 0x02, 0x61, 0x69, 0x00, 0xb6, 0x03, 0x00, 0xac, 0xd6, 0x03,
+  0x79, 0x61, 0x68, 0x80, 0x00, 0x05, 0x67, 0x75, 0x73, 0x6f, 0x6b, 0x80,
+  0x00, 0x00, 0x00, 0x03, 0x61, 0x68, 0x6b, 0x00, 0x05, 0x9d, 0x00, 0xb6,
+  0x20, 0x00, 0xb6, 0x47, 0x00, 0x00, 0x02, 0x63, 0x73, 0x00, 0xb6, 0x2b,
+  0x00, 0xb6, 0x34, 0x06, 0x69, 0x6d, 0x61, 0x6b, 0x61, 0x6e, 0x80, 0x00,
+  0x00, 0x00, 0x02, 0x61, 0x6f, 0x00, 0xb6, 0x3f, 0x00, 0x46, 0xfe, 0x05,
+  0x6e, 0x61, 0x6d, 0x61, 0x79, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x75,
+  0x00, 0xb6, 0x52, 0x00, 0xb6, 0x5a, 0x05, 0x73, 0x61, 0x72, 0x69, 0x6e,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x66, 0x73, 0x00, 0xb6, 0x65, 0x00, 0x10,
+  0xc9, 0x03, 0x65, 0x75, 0x66, 0x80, 0x00, 0x00, 0x00, 0x04, 0x6b, 0x6e,
+  0x74, 0x75, 0x00, 0xb6, 0x7e, 0x00, 0xb6, 0xa2, 0x00, 0xb6, 0xa9, 0x00,
+  0x82, 0xdf, 0x00, 0x00, 0x02, 0x61, 0x69, 0x00, 0xb6, 0x89, 0x00, 0xb6,
+  0x93, 0x07, 0x6b, 0x61, 0x6e, 0x61, 0x6d, 0x61, 0x79, 0x80, 0x00, 0x0c,
+  0x68, 0x63, 0x75, 0x67, 0x61, 0x77, 0x61, 0x6b, 0x69, 0x6a, 0x75, 0x66,
+  0x80, 0x00, 0x04, 0x69, 0x68, 0x73, 0x6f, 0x80, 0x00, 0x00, 0x00, 0x02,
+  0x61, 0x75, 0x00, 0xb6, 0xb4, 0x00, 0x68, 0x57, 0x0b, 0x73, 0x69, 0x6d,
+  0x61, 0x77, 0x61, 0x6b, 0x69, 0x68, 0x63, 0x69, 0x80, 0x00, 0x0a, 0x70,
+  0x6c, 0x61, 0x2d, 0x69, 0x6d, 0x61, 0x6e, 0x69, 0x6d, 0x80, 0x00, 0x00,
+  0x00, 0x04, 0x62, 0x66, 0x68, 0x72, 0x00, 0xb6, 0xe2, 0x00, 0x22, 0x0b,
+  0x00, 0x86, 0x40, 0x00, 0x8b, 0x69, 0x00, 0x00, 0x02, 0x6e, 0x6f, 0x00,
+  0x3d, 0x0e, 0x00, 0x89, 0x4f, 0x01, 0x61, 0x00, 0x03, 0x72, 0x73, 0x7a,
+  0x00, 0xb6, 0xfd, 0x00, 0xb9, 0x3a, 0x00, 0xba, 0x69, 0x03, 0x61, 0x62,
+  0x69, 0x80, 0x01, 0x2e, 0x00, 0xb7, 0x07, 0x00, 0x00, 0x05, 0x61, 0x65,
+  0x69, 0x6f, 0x75, 0x00, 0xb7, 0x1e, 0x00, 0xb8, 0x1f, 0x00, 0xb8, 0x43,
+  0x00, 0xb8, 0xce, 0x00, 0xb9, 0x24, 0x00, 0x40, 0x62, 0x18, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x04, 0x05, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x07, 0x00, 0x00, 0x08, 0x00, 0x09, 0x00, 0xa3,
+  0x99, 0x00, 0x22, 0x0b, 0x00, 0xb7, 0x55, 0x00, 0xb7, 0x67, 0x00, 0x02,
+  0x83, 0x00, 0xb7, 0x95, 0x00, 0xb7, 0xc8, 0x00, 0xb7, 0xe9, 0x00, 0xb8,
+  0x08, 0x02, 0x61, 0x6e, 0x80, 0x01, 0x69, 0x00, 0xb7, 0x5e, 0x06, 0x68,
+  0x63, 0x61, 0x74, 0x69, 0x68, 0x80, 0x00, 0x00, 0x00, 0x03, 0x61, 0x69,
+  0x75, 0x00, 0xb7, 0x76, 0x00, 0x82, 0x47, 0x00, 0xb7, 0x8b, 0x00, 0x00,
+  0x03, 0x73, 0x74, 0x77, 0x00, 0x21, 0x4a, 0x00, 0xb7, 0x85, 0x00, 0x02,
+  0x83, 0x03, 0x69, 0x6d, 0x6f, 0x80, 0x00, 0x07, 0x73, 0x74, 0x6f, 0x6d,
+  0x69, 0x68, 0x73, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x75, 0x00, 0xb7,
+  0xa0, 0x00, 0xb7, 0xab, 0x00, 0x00, 0x02, 0x68, 0x77, 0x00, 0xaa, 0xf1,
+  0x00, 0x8a, 0x8a, 0x00, 0x00, 0x02, 0x61, 0x69, 0x00, 0xb7, 0xb6, 0x00,
+  0xb7, 0xc0, 0x07, 0x67, 0x69, 0x6d, 0x75, 0x73, 0x61, 0x6b, 0x80, 0x00,
+  0x05, 0x68, 0x63, 0x75, 0x73, 0x74, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61,
+  0x6f, 0x00, 0xb7, 0xd3, 0x00, 0xb7, 0xdf, 0x01, 0x67, 0x00, 0x02, 0x61,
+  0x65, 0x00, 0x89, 0xe0, 0x00, 0x02, 0xfe, 0x07, 0x69, 0x68, 0x63, 0x61,
+  0x74, 0x69, 0x68, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x6f, 0x00, 0xb7,
+  0xf4, 0x00, 0x03, 0x8e, 0x01, 0x67, 0x00, 0x02, 0x61, 0x6f, 0x00, 0xb8,
+  0x00, 0x00, 0x01, 0xed, 0x05, 0x72, 0x75, 0x6b, 0x61, 0x73, 0x80, 0x00,
+  0x01, 0x69, 0x00, 0x02, 0x6d, 0x72, 0x00, 0xb8, 0x14, 0x00, 0x45, 0x69,
+  0x08, 0x6f, 0x69, 0x68, 0x63, 0x61, 0x74, 0x69, 0x68, 0x80, 0x00, 0x00,
+  0x00, 0x04, 0x62, 0x64, 0x6e, 0x74, 0x00, 0xb8, 0x32, 0x00, 0x46, 0x96,
+  0x00, 0x3d, 0xa3, 0x00, 0xb8, 0x39, 0x04, 0x6f, 0x6d, 0x6f, 0x74, 0x80,
+  0x00, 0x07, 0x61, 0x64, 0x6f, 0x6d, 0x69, 0x68, 0x73, 0x80, 0x00, 0x00,
+  0x00, 0x07, 0x61, 0x65, 0x67, 0x68, 0x6b, 0x6d, 0x72, 0x00, 0xb8, 0x62,
+  0x00, 0xb8, 0x7d, 0x00, 0x93, 0xc0, 0x00, 0xb8, 0x86, 0x00, 0xb8, 0x98,
+  0x00, 0x02, 0xa9, 0x00, 0xb8, 0xc2, 0x00, 0x00, 0x02, 0x6b, 0x72, 0x00,
+  0xb8, 0x6d, 0x00, 0xb8, 0x78, 0x00, 0x00, 0x02, 0x61, 0x6f, 0x00, 0x03,
+  0x8e, 0x00, 0x03, 0x3c, 0x02, 0x61, 0x6f, 0x80, 0x00, 0x06, 0x73, 0x75,
+  0x6b, 0x69, 0x68, 0x63, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x63, 0x00,
+  0x02, 0x2e, 0x00, 0xb8, 0x91, 0x04, 0x61, 0x74, 0x69, 0x68, 0x80, 0x00,
+  0x00, 0x00, 0x03, 0x61, 0x69, 0x75, 0x00, 0xb8, 0xa7, 0x00, 0xb8, 0xba,
+  0x00, 0x86, 0xaa, 0x00, 0x00, 0x02, 0x72, 0x73, 0x00, 0x88, 0xa3, 0x00,
+  0xb8, 0xb2, 0x05, 0x61, 0x67, 0x75, 0x79, 0x72, 0x80, 0x00, 0x05, 0x68,
+  0x73, 0x61, 0x6e, 0x69, 0x80, 0x00, 0x09, 0x75, 0x6b, 0x75, 0x73, 0x74,
+  0x61, 0x6d, 0x61, 0x74, 0x80, 0x00, 0x00, 0x40, 0x64, 0x16, 0x01, 0x00,
+  0x00, 0x02, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x06, 0x07, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0xb9, 0x00, 0x00,
+  0x97, 0x3f, 0x00, 0x01, 0x7d, 0x00, 0x98, 0xaf, 0x00, 0xb9, 0x06, 0x00,
+  0x76, 0xf3, 0x00, 0xb9, 0x10, 0x00, 0x83, 0xe9, 0x03, 0x6e, 0x61, 0x62,
+  0x80, 0x00, 0x07, 0x69, 0x68, 0x73, 0x69, 0x6a, 0x75, 0x66, 0x80, 0x00,
+  0x00, 0x00, 0x02, 0x61, 0x69, 0x00, 0xb9, 0x1b, 0x00, 0x03, 0x40, 0x06,
+  0x73, 0x6f, 0x72, 0x69, 0x68, 0x73, 0x80, 0x00, 0x00, 0x00, 0x03, 0x66,
+  0x6b, 0x73, 0x00, 0x3b, 0x70, 0x00, 0xb9, 0x33, 0x00, 0xa1, 0xca, 0x04,
+  0x69, 0x68, 0x73, 0x75, 0x80, 0x00, 0x01, 0x61, 0x00, 0x02, 0x67, 0x77,
+  0x00, 0xb9, 0x46, 0x00, 0xba, 0x60, 0x02, 0x61, 0x6e, 0x80, 0x01, 0x2e,
+  0x00, 0xb9, 0x4f, 0x00, 0x00, 0x05, 0x61, 0x69, 0x6e, 0x6f, 0x75, 0x00,
+  0xb9, 0x66, 0x00, 0xb9, 0xcd, 0x00, 0xba, 0x01, 0x00, 0xba, 0x08, 0x00,
+  0xba, 0x40, 0x00, 0x00, 0x05, 0x6d, 0x6e, 0x72, 0x77, 0x79, 0x00, 0xb9,
+  0x7d, 0x00, 0xb9, 0x95, 0x00, 0xb9, 0x9e, 0x00, 0xb9, 0xbd, 0x00, 0xb9,
+  0xc5, 0x00, 0x00, 0x02, 0x61, 0x69, 0x00, 0xb9, 0x88, 0x00, 0xb9, 0x8d,
+  0x02, 0x62, 0x6f, 0x80, 0x00, 0x05, 0x68, 0x73, 0x75, 0x73, 0x74, 0x80,
+  0x00, 0x06, 0x61, 0x74, 0x61, 0x77, 0x61, 0x6b, 0x80, 0x00, 0x00, 0x00,
+  0x02, 0x61, 0x75, 0x00, 0xb9, 0xa9, 0x00, 0xb9, 0xb2, 0x06, 0x62, 0x61,
+  0x6d, 0x69, 0x68, 0x73, 0x80, 0x00, 0x00, 0x00, 0x02, 0x6d, 0x75, 0x00,
+  0x02, 0x12, 0x00, 0x83, 0x8a, 0x05, 0x69, 0x6a, 0x69, 0x68, 0x63, 0x80,
+  0x00, 0x05, 0x61, 0x68, 0x61, 0x73, 0x69, 0x80, 0x00, 0x00, 0x00, 0x04,
+  0x61, 0x68, 0x6b, 0x6d, 0x00, 0xb9, 0xe0, 0x00, 0xa1, 0x5f, 0x00, 0xb9,
+  0xe7, 0x00, 0xb9, 0xfa, 0x04, 0x6b, 0x69, 0x61, 0x73, 0x80, 0x00, 0x00,
+  0x00, 0x02, 0x61, 0x69, 0x00, 0xb9, 0xf2, 0x00, 0x01, 0xed, 0x05, 0x73,
+  0x61, 0x67, 0x61, 0x6e, 0x80, 0x00, 0x04, 0x61, 0x73, 0x61, 0x68, 0x80,
+  0x00, 0x04, 0x65, 0x7a, 0x6e, 0x75, 0x80, 0x00, 0x00, 0x00, 0x03, 0x62,
+  0x64, 0x74, 0x00, 0xba, 0x17, 0x00, 0xa5, 0x0d, 0x00, 0xba, 0x1e, 0x04,
+  0x65, 0x73, 0x61, 0x73, 0x80, 0x00, 0x00, 0x00, 0x02, 0x65, 0x6f, 0x00,
+  0xba, 0x29, 0x00, 0xba, 0x2e, 0x02, 0x73, 0x6f, 0x80, 0x00, 0x01, 0x67,
+  0x80, 0x01, 0x69, 0x00, 0xba, 0x36, 0x07, 0x6d, 0x61, 0x6b, 0x6e, 0x69,
+  0x68, 0x73, 0x80, 0x00, 0x02, 0x73, 0x74, 0x00, 0x03, 0x69, 0x6f, 0x75,
+  0x00, 0xba, 0x51, 0x00, 0xba, 0x57, 0x00, 0x1c, 0xc3, 0x03, 0x67, 0x6f,
+  0x74, 0x80, 0x00, 0x06, 0x6e, 0x69, 0x68, 0x63, 0x75, 0x6b, 0x80, 0x00,
+  0x02, 0x61, 0x6b, 0x82, 0x01, 0x2e, 0x00, 0x8e, 0x3c, 0x04, 0x61, 0x79,
+  0x69, 0x6d, 0x80, 0x01, 0x2e, 0x00, 0xba, 0x74, 0x00, 0x00, 0x06, 0x61,
+  0x65, 0x69, 0x6e, 0x6f, 0x75, 0x00, 0xba, 0x8f, 0x00, 0xbb, 0x20, 0x00,
+  0xbb, 0x3b, 0x00, 0xbb, 0x89, 0x00, 0xbb, 0x93, 0x00, 0xbb, 0xc7, 0x00,
+  0x40, 0x62, 0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00,
+  0x07, 0x00, 0x08, 0x00, 0xba, 0xc3, 0x00, 0xba, 0xca, 0x00, 0xba, 0xd0,
+  0x00, 0xba, 0xeb, 0x00, 0xba, 0xf3, 0x00, 0xbb, 0x07, 0x00, 0xbb, 0x13,
+  0x00, 0x02, 0xa9, 0x04, 0x69, 0x69, 0x68, 0x73, 0x80, 0x00, 0x03, 0x75,
+  0x79, 0x68, 0x80, 0x00, 0x00, 0x00, 0x02, 0x6f, 0x75, 0x00, 0xba, 0xdb,
+  0x00, 0xba, 0xe2, 0x04, 0x65, 0x62, 0x6f, 0x6e, 0x80, 0x00, 0x06, 0x73,
+  0x74, 0x6f, 0x72, 0x6f, 0x6d, 0x80, 0x00, 0x05, 0x69, 0x68, 0x73, 0x75,
+  0x6b, 0x80, 0x00, 0x00, 0x00, 0x02, 0x65, 0x75, 0x00, 0xba, 0xfe, 0x00,
+  0x84, 0xa8, 0x06, 0x6d, 0x69, 0x68, 0x73, 0x69, 0x6e, 0x80, 0x00, 0x01,
+  0x61, 0x00, 0x02, 0x6b, 0x6d, 0x00, 0x84, 0xa8, 0x00, 0x01, 0x7d, 0x02,
+  0x61, 0x67, 0x00, 0x02, 0x61, 0x6f, 0x00, 0xa1, 0xf6, 0x00, 0x87, 0x92,
+  0x00, 0x00, 0x02, 0x62, 0x73, 0x00, 0xbb, 0x2b, 0x00, 0xbb, 0x34, 0x06,
+  0x61, 0x6e, 0x61, 0x6b, 0x61, 0x74, 0x80, 0x00, 0x04, 0x61, 0x6b, 0x6f,
+  0x67, 0x80, 0x00, 0x00, 0x00, 0x03, 0x68, 0x6b, 0x6d, 0x00, 0xbb, 0x4a,
+  0x00, 0xbb, 0x54, 0x00, 0xbb, 0x62, 0x07, 0x73, 0x61, 0x79, 0x61, 0x62,
+  0x6f, 0x6b, 0x80, 0x00, 0x03, 0x61, 0x7a, 0x61, 0x00, 0x02, 0x6b, 0x79,
+  0x00, 0x81, 0x96, 0x00, 0x01, 0x7d, 0x00, 0x00, 0x02, 0x61, 0x6f, 0x00,
+  0xbb, 0x6d, 0x00, 0xbb, 0x77, 0x07, 0x6e, 0x69, 0x6d, 0x61, 0x77, 0x61,
+  0x6b, 0x80, 0x00, 0x01, 0x74, 0x00, 0x02, 0x69, 0x6e, 0x00, 0xbb, 0x83,
+  0x00, 0x83, 0xb0, 0x03, 0x6e, 0x75, 0x6b, 0x80, 0x00, 0x07, 0x61, 0x6e,
+  0x69, 0x68, 0x63, 0x69, 0x6e, 0x80, 0x00, 0x00, 0x00, 0x03, 0x6a, 0x6e,
+  0x74, 0x00, 0xbb, 0xa2, 0x00, 0xbb, 0xb7, 0x00, 0x8e, 0xd7, 0x00, 0x00,
+  0x02, 0x69, 0x6f, 0x00, 0x05, 0x9d, 0x00, 0xbb, 0xad, 0x07, 0x6e, 0x6f,
+  0x6b, 0x61, 0x79, 0x69, 0x6d, 0x80, 0x00, 0x00, 0x00, 0x02, 0x69, 0x75,
+  0x00, 0xbb, 0xc2, 0x00, 0x93, 0x3d, 0x02, 0x62, 0x65, 0x80, 0x00, 0x07,
+  0x72, 0x61, 0x68, 0x61, 0x6b, 0x61, 0x74, 0x80, 0x00, 0x01, 0x6f, 0x00,
+  0x02, 0x6d, 0x74, 0x00, 0xbb, 0xdd, 0x00, 0xbc, 0xf5, 0x02, 0x6f, 0x61,
+  0x80, 0x01, 0x2e, 0x00, 0xbb, 0xe6, 0x00, 0x00, 0x05, 0x61, 0x65, 0x69,
+  0x6f, 0x75, 0x00, 0xbb, 0xfd, 0x00, 0xbc, 0x13, 0x00, 0xbc, 0x4d, 0x00,
+  0xbc, 0xd1, 0x00, 0xbc, 0xdc, 0x00, 0x00, 0x03, 0x64, 0x74, 0x77, 0x00,
+  0xbc, 0x0c, 0x00, 0x9e, 0xda, 0x00, 0xac, 0x1c, 0x04, 0x61, 0x77, 0x6f,
+  0x74, 0x80, 0x00, 0x00, 0x00, 0x02, 0x68, 0x73, 0x00, 0xbc, 0x1e, 0x00,
+  0xbc, 0x46, 0x02, 0x6f, 0x6e, 0x00, 0x04, 0x69, 0x6e, 0x6f, 0x75, 0x00,
+  0xbc, 0x33, 0x00, 0x22, 0x90, 0x00, 0x0b, 0xb4, 0x00, 0xbc, 0x40, 0x02,
+  0x68, 0x63, 0x00, 0x02, 0x61, 0x69, 0x00, 0x3d, 0x0a, 0x00, 0x24, 0xd0,
+  0x03, 0x6b, 0x6f, 0x72, 0x80, 0x00, 0x04, 0x61, 0x72, 0x69, 0x6f, 0x80,
+  0x00, 0x00, 0x40, 0x61, 0x12, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x03, 0x00, 0x04, 0x05, 0x00, 0x06, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0xbc, 0x7b, 0x00, 0xbc, 0x83, 0x00, 0xbc, 0x8d, 0x00, 0xbc, 0x96, 0x00,
+  0xbc, 0x9d, 0x00, 0xbc, 0xa6, 0x00, 0xbc, 0xb0, 0x00, 0xbc, 0xb6, 0x05,
+  0x6e, 0x61, 0x72, 0x69, 0x68, 0x80, 0x00, 0x07, 0x61, 0x6e, 0x61, 0x79,
+  0x61, 0x74, 0x69, 0x80, 0x00, 0x06, 0x73, 0x69, 0x6f, 0x72, 0x75, 0x6b,
+  0x80, 0x00, 0x04, 0x65, 0x68, 0x6f, 0x6e, 0x80, 0x00, 0x06, 0x61, 0x73,
+  0x6f, 0x72, 0x69, 0x68, 0x80, 0x00, 0x07, 0x61, 0x6b, 0x69, 0x68, 0x73,
+  0x61, 0x68, 0x80, 0x00, 0x03, 0x61, 0x77, 0x6f, 0x80, 0x00, 0x00, 0x00,
+  0x02, 0x61, 0x6f, 0x00, 0xbc, 0xc1, 0x00, 0xbc, 0xcb, 0x07, 0x6d, 0x6f,
+  0x64, 0x61, 0x6b, 0x61, 0x6e, 0x80, 0x00, 0x03, 0x6d, 0x6f, 0x61, 0x80,
+  0x00, 0x00, 0x00, 0x02, 0x67, 0x6b, 0x00, 0x8c, 0x3f, 0x00, 0x97, 0x33,
+  0x00, 0x00, 0x02, 0x72, 0x73, 0x00, 0xbc, 0xe7, 0x00, 0xbc, 0xef, 0x05,
+  0x61, 0x67, 0x75, 0x73, 0x74, 0x80, 0x00, 0x03, 0x74, 0x75, 0x6d, 0x80,
+  0x00, 0x03, 0x74, 0x6f, 0x74, 0x80, 0x01, 0x2e, 0x00, 0xbc, 0xff, 0x00,
+  0x00, 0x06, 0x61, 0x65, 0x69, 0x6e, 0x6f, 0x75, 0x00, 0xbd, 0x1a, 0x00,
+  0xbd, 0x4b, 0x00, 0xbd, 0x51, 0x00, 0xbb, 0x89, 0x00, 0xbd, 0x5a, 0x00,
+  0xbd, 0x7c, 0x00, 0x00, 0x02, 0x72, 0x73, 0x00, 0xbd, 0x25, 0x00, 0xbd,
+  0x3f, 0x00, 0x00, 0x02, 0x61, 0x75, 0x00, 0xbd, 0x30, 0x00, 0xbd, 0x38,
+  0x05, 0x68, 0x61, 0x77, 0x61, 0x6b, 0x80, 0x00, 0x04, 0x6f, 0x74, 0x6f,
+  0x6b, 0x80, 0x00, 0x01, 0x61, 0x00, 0x02, 0x6b, 0x73, 0x00, 0x92, 0x0f,
+  0x00, 0x01, 0x7d, 0x03, 0x67, 0x6f, 0x6b, 0x80, 0x00, 0x06, 0x72, 0x6f,
+  0x74, 0x74, 0x6f, 0x74, 0x80, 0x00, 0x00, 0x00, 0x03, 0x67, 0x6e, 0x74,
+  0x00, 0xbd, 0x69, 0x00, 0x5e, 0xe4, 0x00, 0xbd, 0x70, 0x04, 0x61, 0x6e,
+  0x6f, 0x79, 0x80, 0x00, 0x09, 0x61, 0x6e, 0x69, 0x6d, 0x69, 0x61, 0x6b,
+  0x61, 0x73, 0x80, 0x00, 0x00, 0x00, 0x02, 0x62, 0x7a, 0x00, 0x65, 0xd9,
+  0x00, 0xbd, 0x87, 0x00, 0x00, 0x02, 0x61, 0x69, 0x00, 0x86, 0xaa, 0x00,
+  0x82, 0xdf, 0x03, 0x6b, 0x75, 0x66, 0x80, 0x01, 0x2e, 0x00, 0xbd, 0x9c,
+  0x00, 0x00, 0x05, 0x61, 0x65, 0x69, 0x6e, 0x6f, 0x00, 0xbd, 0xb3, 0x00,
+  0xbd, 0xeb, 0x00, 0xbd, 0xf2, 0x00, 0xbe, 0x0d, 0x00, 0x8c, 0x11, 0x00,
+  0x00, 0x04, 0x64, 0x67, 0x6d, 0x73, 0x00, 0xbd, 0xc6, 0x00, 0x9e, 0xda,
+  0x00, 0xbd, 0xcc, 0x00, 0xbd, 0xe4, 0x03, 0x65, 0x6b, 0x69, 0x80, 0x00,
+  0x01, 0x61, 0x00, 0x03, 0x62, 0x68, 0x79, 0x00, 0x02, 0x12, 0x00, 0xb1,
+  0xbc, 0x00, 0xbd, 0xdc, 0x05, 0x75, 0x73, 0x74, 0x61, 0x6b, 0x80, 0x00,
+  0x04, 0x61, 0x6b, 0x61, 0x77, 0x80, 0x00, 0x04, 0x61, 0x62, 0x61, 0x73,
+  0x80, 0x00, 0x00, 0x00, 0x04, 0x61, 0x68, 0x6a, 0x75, 0x00, 0x82, 0x76,
+  0x00, 0x02, 0x12, 0x00, 0xbe, 0x05, 0x00, 0x99, 0x39, 0x05, 0x69, 0x65,
+  0x68, 0x69, 0x65, 0x80, 0x00, 0x06, 0x65, 0x7a, 0x69, 0x68, 0x63, 0x65,
+  0x80, 0x01, 0x69, 0x00, 0x95, 0xf8, 0x00, 0x00, 0x07, 0x63, 0x64, 0x67,
+  0x6e, 0x72, 0x74, 0x79, 0x00, 0x01, 0xed, 0x00, 0xbe, 0x39, 0x00, 0xc4,
+  0x24, 0x00, 0xc5, 0xf4, 0x00, 0xc8, 0xee, 0x00, 0xc8, 0xfa, 0x00, 0xcb,
+  0x6e, 0x06, 0x69, 0x61, 0x6b, 0x6b, 0x6f, 0x68, 0x80, 0x01, 0x2e, 0x00,
+  0xbe, 0x46, 0x00, 0x00, 0x06, 0x61, 0x65, 0x69, 0x6e, 0x6f, 0x75, 0x00,
+  0xbe, 0x61, 0x00, 0xbf, 0xef, 0x00, 0xc0, 0x95, 0x00, 0xc1, 0xeb, 0x00,
+  0xc2, 0x1e, 0x00, 0xc2, 0xd7, 0x00, 0x40, 0x64, 0x16, 0x01, 0x00, 0x00,
+  0x02, 0x03, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x06,
+  0x07, 0x08, 0x00, 0x00, 0x09, 0x00, 0x0a, 0x00, 0xbd, 0xc6, 0x00, 0xbe,
+  0x99, 0x00, 0xbe, 0xa3, 0x00, 0xbe, 0xac, 0x00, 0xbe, 0xd0, 0x00, 0xbf,
+  0x12, 0x00, 0xbf, 0x5a, 0x00, 0xbf, 0x61, 0x00, 0xbf, 0x75, 0x00, 0x3d,
+  0xa3, 0x07, 0x61, 0x6b, 0x69, 0x68, 0x73, 0x65, 0x74, 0x80, 0x00, 0x06,
+  0x63, 0x65, 0x62, 0x69, 0x68, 0x73, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61,
+  0x75, 0x00, 0xbe, 0xb7, 0x00, 0xbe, 0xbd, 0x03, 0x64, 0x69, 0x68, 0x80,
+  0x00, 0x00, 0x00, 0x02, 0x66, 0x6e, 0x00, 0x08, 0x0c, 0x00, 0xbe, 0xc8,
+  0x05, 0x61, 0x72, 0x69, 0x68, 0x73, 0x80, 0x00, 0x00, 0x00, 0x05, 0x61,
+  0x68, 0x69, 0x6f, 0x75, 0x00, 0xbe, 0xe7, 0x00, 0x3d, 0xa3, 0x00, 0xbe,
+  0xef, 0x00, 0xbf, 0x06, 0x00, 0xbf, 0x0c, 0x05, 0x79, 0x69, 0x72, 0x75,
+  0x6b, 0x80, 0x00, 0x02, 0x68, 0x73, 0x00, 0x02, 0x6f, 0x75, 0x00, 0xbe,
+  0xfc, 0x00, 0x99, 0x39, 0x07, 0x72, 0x69, 0x68, 0x61, 0x74, 0x69, 0x6b,
+  0x80, 0x00, 0x03, 0x72, 0x61, 0x73, 0x80, 0x00, 0x03, 0x73, 0x74, 0x61,
+  0x80, 0x00, 0x00, 0x00, 0x03, 0x69, 0x6f, 0x75, 0x00, 0xbf, 0x21, 0x00,
+  0xbf, 0x3e, 0x00, 0xbf, 0x43, 0x01, 0x62, 0x00, 0x03, 0x61, 0x6f, 0x75,
+  0x00, 0xbf, 0x31, 0x00, 0x01, 0xed, 0x00, 0xbf, 0x38, 0x00, 0x80, 0x01,
+  0x6b, 0x00, 0x02, 0xa9, 0x03, 0x72, 0x75, 0x66, 0x80, 0x00, 0x02, 0x7a,
+  0x6f, 0x80, 0x00, 0x00, 0x00, 0x02, 0x67, 0x6f, 0x00, 0xbf, 0x4e, 0x00,
+  0x89, 0x3a, 0x09, 0x61, 0x6b, 0x69, 0x68, 0x73, 0x61, 0x67, 0x69, 0x68,
+  0x80, 0x00, 0x04, 0x61, 0x6b, 0x69, 0x6d, 0x80, 0x00, 0x01, 0x61, 0x00,
+  0x02, 0x67, 0x6d, 0x00, 0xbf, 0x6d, 0x00, 0x3c, 0xce, 0x05, 0x69, 0x6b,
+  0x75, 0x73, 0x74, 0x80, 0x00, 0x00, 0x00, 0x03, 0x61, 0x69, 0x6f, 0x00,
+  0xbf, 0x84, 0x00, 0x38, 0x12, 0x00, 0xa2, 0x07, 0x00, 0x00, 0x03, 0x67,
+  0x6b, 0x7a, 0x00, 0xbf, 0x93, 0x00, 0xbf, 0xb3, 0x00, 0xbf, 0xe7, 0x01,
+  0x61, 0x00, 0x02, 0x6b, 0x6e, 0x00, 0xbf, 0x9f, 0x00, 0xbf, 0xaa, 0x00,
+  0x00, 0x02, 0x61, 0x75, 0x00, 0x02, 0x03, 0x00, 0x1c, 0xc3, 0x02, 0x75,
+  0x73, 0x80, 0x01, 0x69, 0x00, 0x82, 0x39, 0x00, 0x00, 0x04, 0x61, 0x69,
+  0x6f, 0x75, 0x00, 0x03, 0xea, 0x00, 0xbf, 0xc6, 0x00, 0x8c, 0xbe, 0x00,
+  0x03, 0x40, 0x00, 0x00, 0x03, 0x68, 0x6b, 0x6d, 0x00, 0xbf, 0xd5, 0x00,
+  0x81, 0x96, 0x00, 0x21, 0x4a, 0x00, 0x00, 0x02, 0x61, 0x73, 0x00, 0x02,
+  0x2e, 0x00, 0xbf, 0xe0, 0x04, 0x61, 0x67, 0x69, 0x68, 0x80, 0x00, 0x05,
+  0x69, 0x6d, 0x61, 0x77, 0x69, 0x80, 0x00, 0x00, 0x40, 0x61, 0x15, 0x01,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00,
+  0x05, 0x00, 0x06, 0x00, 0x00, 0x07, 0x08, 0x09, 0x00, 0xc0, 0x23, 0x00,
+  0xc0, 0x2e, 0x00, 0x3d, 0x0e, 0x00, 0xc0, 0x56, 0x00, 0xc0, 0x68, 0x00,
+  0xc0, 0x70, 0x00, 0xc0, 0x7b, 0x00, 0xc0, 0x83, 0x00, 0xc0, 0x8c, 0x00,
+  0x00, 0x02, 0x6d, 0x6e, 0x00, 0x87, 0xae, 0x00, 0x3d, 0x0e, 0x00, 0x00,
+  0x02, 0x61, 0x6f, 0x00, 0xc0, 0x39, 0x00, 0xc0, 0x44, 0x00, 0x00, 0x02,
+  0x6b, 0x79, 0x00, 0x83, 0xb0, 0x00, 0x21, 0x4a, 0x00, 0x00, 0x02, 0x6e,
+  0x74, 0x00, 0xc0, 0x4f, 0x00, 0x02, 0x12, 0x04, 0x6f, 0x72, 0x6f, 0x68,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x69, 0x75, 0x00, 0xb1, 0x34, 0x00, 0xc0,
+  0x61, 0x04, 0x66, 0x6f, 0x74, 0x6f, 0x80, 0x00, 0x05, 0x61, 0x6b, 0x61,
+  0x6d, 0x69, 0x80, 0x00, 0x04, 0x70, 0x6f, 0x6b, 0x6f, 0x80, 0x01, 0x69,
+  0x00, 0x84, 0xb8, 0x05, 0x6f, 0x74, 0x69, 0x68, 0x63, 0x80, 0x00, 0x02,
+  0x61, 0x64, 0x80, 0x01, 0x6f, 0x00, 0xa6, 0xa1, 0x06, 0x6f, 0x6e, 0x69,
+  0x6b, 0x61, 0x74, 0x80, 0x00, 0x00, 0x40, 0x61, 0x12, 0x01, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x04, 0x05, 0x00, 0x06, 0x00, 0x07,
+  0x00, 0x00, 0x08, 0x00, 0xc0, 0xc3, 0x00, 0x08, 0x0c, 0x00, 0xc1, 0x2c,
+  0x00, 0xc1, 0x7f, 0x00, 0xc1, 0x8b, 0x00, 0xc1, 0xa1, 0x00, 0xc1, 0xac,
+  0x00, 0xc1, 0xb8, 0x00, 0x00, 0x03, 0x62, 0x6d, 0x6e, 0x00, 0x08, 0x0c,
+  0x00, 0xc0, 0xd2, 0x00, 0xc0, 0xdb, 0x06, 0x6f, 0x6b, 0x61, 0x6d, 0x6f,
+  0x74, 0x80, 0x00, 0x00, 0x00, 0x05, 0x61, 0x65, 0x69, 0x6f, 0x75, 0x00,
+  0xc0, 0xf2, 0x00, 0xc1, 0x08, 0x00, 0xc1, 0x0f, 0x00, 0x8d, 0x22, 0x00,
+  0xc1, 0x17, 0x00, 0x00, 0x02, 0x6b, 0x77, 0x00, 0xc0, 0xfd, 0x00, 0x02,
+  0x83, 0x00, 0x00, 0x02, 0x6b, 0x6f, 0x00, 0x92, 0x0f, 0x00, 0x6f, 0x81,
+  0x04, 0x6f, 0x6d, 0x61, 0x6b, 0x80, 0x00, 0x05, 0x68, 0x73, 0x61, 0x74,
+  0x75, 0x80, 0x00, 0x03, 0x73, 0x74, 0x61, 0x00, 0x02, 0x6d, 0x73, 0x00,
+  0x8b, 0x08, 0x00, 0xc1, 0x25, 0x04, 0x61, 0x6b, 0x61, 0x6e, 0x80, 0x00,
+  0x00, 0x00, 0x02, 0x63, 0x73, 0x00, 0xc1, 0x37, 0x00, 0xc1, 0x53, 0x00,
+  0x00, 0x02, 0x69, 0x75, 0x00, 0xa0, 0x59, 0x00, 0xc1, 0x42, 0x00, 0x00,
+  0x02, 0x62, 0x69, 0x00, 0xc1, 0x4d, 0x00, 0x82, 0xf6, 0x03, 0x6d, 0x65,
+  0x6b, 0x80, 0x00, 0x00, 0x00, 0x04, 0x61, 0x65, 0x6f, 0x75, 0x00, 0xc1,
+  0x66, 0x00, 0xc1, 0x6b, 0x00, 0xc1, 0x71, 0x00, 0xc1, 0x78, 0x02, 0x73,
+  0x65, 0x80, 0x00, 0x03, 0x6b, 0x6b, 0x61, 0x80, 0x00, 0x04, 0x6b, 0x6e,
+  0x61, 0x72, 0x80, 0x00, 0x04, 0x65, 0x73, 0x6f, 0x6d, 0x80, 0x00, 0x09,
+  0x75, 0x66, 0x69, 0x72, 0x69, 0x68, 0x73, 0x69, 0x72, 0x80, 0x00, 0x00,
+  0x00, 0x02, 0x61, 0x69, 0x00, 0x89, 0x5a, 0x00, 0xc1, 0x96, 0x00, 0x00,
+  0x02, 0x61, 0x6e, 0x00, 0x03, 0x3c, 0x00, 0x01, 0xed, 0x00, 0x00, 0x02,
+  0x61, 0x6f, 0x00, 0xa1, 0xf6, 0x00, 0x8c, 0x46, 0x01, 0x61, 0x00, 0x02,
+  0x6b, 0x72, 0x00, 0x83, 0xb0, 0x00, 0x83, 0xb0, 0x00, 0x00, 0x03, 0x61,
+  0x69, 0x6f, 0x00, 0xc1, 0xc7, 0x00, 0xc1, 0xd6, 0x00, 0xc1, 0xe3, 0x00,
+  0x00, 0x03, 0x68, 0x6b, 0x6d, 0x00, 0x03, 0x8e, 0x00, 0xa7, 0x7d, 0x00,
+  0x3d, 0xa3, 0x02, 0x68, 0x73, 0x00, 0x02, 0x61, 0x69, 0x00, 0x03, 0xa9,
+  0x00, 0x01, 0x8b, 0x05, 0x74, 0x61, 0x72, 0x69, 0x62, 0x80, 0x00, 0x00,
+  0x00, 0x02, 0x61, 0x75, 0x00, 0xc1, 0xf6, 0x00, 0xc2, 0x18, 0x00, 0x00,
+  0x04, 0x68, 0x72, 0x73, 0x74, 0x00, 0xc2, 0x09, 0x00, 0xb4, 0x97, 0x00,
+  0x22, 0x81, 0x00, 0xc2, 0x10, 0x04, 0x63, 0x74, 0x75, 0x6b, 0x80, 0x00,
+  0x05, 0x6f, 0x6b, 0x61, 0x68, 0x73, 0x80, 0x00, 0x03, 0x62, 0x65, 0x72,
+  0x80, 0x00, 0x00, 0x00, 0x06, 0x6b, 0x6d, 0x6e, 0x6f, 0x72, 0x74, 0x00,
+  0xc2, 0x39, 0x00, 0xc2, 0x40, 0x00, 0xc2, 0x56, 0x00, 0x92, 0x60, 0x00,
+  0xc2, 0x6e, 0x00, 0xc2, 0xc0, 0x04, 0x61, 0x79, 0x6f, 0x74, 0x80, 0x00,
+  0x00, 0x00, 0x02, 0x69, 0x75, 0x00, 0xc2, 0x4b, 0x00, 0xc2, 0x50, 0x02,
+  0x72, 0x65, 0x80, 0x00, 0x03, 0x6b, 0x61, 0x79, 0x80, 0x00, 0x04, 0x61,
+  0x72, 0x75, 0x66, 0x80, 0x01, 0x69, 0x00, 0xc2, 0x61, 0x02, 0x6d, 0x61,
+  0x00, 0x02, 0x6b, 0x6e, 0x00, 0x01, 0xed, 0x00, 0x01, 0x7d, 0x00, 0x00,
+  0x03, 0x69, 0x6f, 0x75, 0x00, 0xc2, 0x7d, 0x00, 0xc2, 0x89, 0x00, 0xc2,
+  0xba, 0x01, 0x68, 0x00, 0x02, 0x69, 0x73, 0x00, 0xb9, 0x88, 0x00, 0x4c,
+  0xd6, 0x00, 0x00, 0x04, 0x62, 0x68, 0x70, 0x79, 0x00, 0x66, 0x39, 0x00,
+  0xc2, 0x9c, 0x00, 0x65, 0xd9, 0x00, 0x3d, 0x0e, 0x00, 0x00, 0x02, 0x69,
+  0x73, 0x00, 0xc2, 0xa7, 0x00, 0x02, 0xa9, 0x00, 0x00, 0x02, 0x62, 0x68,
+  0x00, 0x01, 0xed, 0x00, 0xc2, 0xb2, 0x05, 0x73, 0x69, 0x6d, 0x61, 0x6b,
+  0x80, 0x00, 0x03, 0x6d, 0x65, 0x6e, 0x80, 0x00, 0x00, 0x00, 0x03, 0x61,
+  0x65, 0x75, 0x00, 0xc2, 0xcf, 0x00, 0x93, 0x38, 0x00, 0x68, 0x57, 0x05,
+  0x73, 0x6f, 0x79, 0x69, 0x6b, 0x80, 0x00, 0x00, 0x40, 0x62, 0x19, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x00,
+  0x00, 0x04, 0x00, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08,
+  0x00, 0xc3, 0x0c, 0x00, 0xc3, 0x13, 0x00, 0xc3, 0x1c, 0x00, 0xc3, 0x2e,
+  0x00, 0x97, 0x50, 0x00, 0xc3, 0x57, 0x00, 0xc4, 0x0f, 0x00, 0xc4, 0x18,
+  0x04, 0x61, 0x73, 0x73, 0x61, 0x80, 0x00, 0x06, 0x6f, 0x74, 0x6e, 0x69,
+  0x68, 0x73, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x75, 0x00, 0xc3, 0x27,
+  0x00, 0x02, 0x12, 0x04, 0x73, 0x73, 0x61, 0x77, 0x80, 0x00, 0x01, 0x70,
+  0x00, 0x03, 0x61, 0x65, 0x69, 0x00, 0xc3, 0x3e, 0x00, 0xc3, 0x45, 0x00,
+  0x01, 0xff, 0x04, 0x6b, 0x69, 0x69, 0x6e, 0x80, 0x00, 0x01, 0x6e, 0x00,
+  0x02, 0x69, 0x6e, 0x00, 0xc3, 0x51, 0x00, 0x4c, 0xd6, 0x03, 0x6f, 0x74,
+  0x6f, 0x80, 0x00, 0x00, 0x00, 0x03, 0x61, 0x74, 0x75, 0x00, 0x97, 0x33,
+  0x00, 0xc3, 0x66, 0x00, 0xc4, 0x09, 0x00, 0x00, 0x03, 0x65, 0x6f, 0x75,
+  0x00, 0xc3, 0x75, 0x00, 0xc3, 0xf6, 0x00, 0xc4, 0x01, 0x01, 0x62, 0x00,
+  0x06, 0x65, 0x69, 0x6d, 0x6e, 0x6f, 0x75, 0x00, 0x01, 0xed, 0x00, 0xc3,
+  0x91, 0x00, 0xc3, 0xaf, 0x00, 0xc3, 0xc5, 0x00, 0xc3, 0xd1, 0x00, 0xc3,
+  0xe0, 0x00, 0x00, 0x03, 0x61, 0x68, 0x72, 0x00, 0x01, 0xed, 0x00, 0xc3,
+  0xa0, 0x00, 0xc3, 0xa8, 0x01, 0x73, 0x80, 0x01, 0x61, 0x00, 0x01, 0xed,
+  0x04, 0x6f, 0x62, 0x6f, 0x6e, 0x80, 0x00, 0x00, 0x00, 0x02, 0x65, 0x6f,
+  0x00, 0x01, 0xed, 0x00, 0xc3, 0xba, 0x00, 0x00, 0x02, 0x6d, 0x74, 0x00,
+  0x01, 0xed, 0x00, 0xc1, 0x25, 0x01, 0x6f, 0x00, 0x02, 0x68, 0x74, 0x00,
+  0x01, 0xed, 0x00, 0x84, 0x86, 0x00, 0x00, 0x03, 0x6d, 0x73, 0x74, 0x00,
+  0x84, 0x8d, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x00, 0x03, 0x6b,
+  0x70, 0x73, 0x00, 0x5f, 0x53, 0x00, 0xc3, 0xef, 0x00, 0x03, 0x3c, 0x04,
+  0x70, 0x69, 0x68, 0x63, 0x80, 0x00, 0x08, 0x6e, 0x69, 0x68, 0x73, 0x6e,
+  0x69, 0x68, 0x73, 0x80, 0x00, 0x05, 0x66, 0x75, 0x72, 0x61, 0x73, 0x80,
+  0x00, 0x03, 0x61, 0x72, 0x75, 0x80, 0x00, 0x02, 0x72, 0x75, 0x80, 0x01,
+  0x6b, 0x00, 0x4e, 0xae, 0x05, 0x69, 0x6d, 0x69, 0x68, 0x73, 0x80, 0x01,
+  0x6f, 0x00, 0x05, 0x9d, 0x00, 0x80, 0x01, 0x6f, 0x00, 0xc4, 0x2b, 0x02,
+  0x79, 0x68, 0x80, 0x01, 0x2e, 0x00, 0xc4, 0x34, 0x00, 0x00, 0x05, 0x61,
+  0x69, 0x6e, 0x6f, 0x75, 0x00, 0xc4, 0x4b, 0x00, 0xc4, 0xea, 0x00, 0xc5,
+  0x7f, 0x00, 0xc5, 0x9b, 0x00, 0xc5, 0xe9, 0x00, 0x00, 0x07, 0x62, 0x64,
+  0x67, 0x6b, 0x6d, 0x77, 0x79, 0x00, 0x94, 0x20, 0x00, 0x69, 0x10, 0x00,
+  0xb2, 0x94, 0x00, 0xc4, 0x6a, 0x00, 0xc4, 0x8e, 0x00, 0xc4, 0xa7, 0x00,
+  0xc4, 0xd4, 0x00, 0x00, 0x03, 0x61, 0x6f, 0x75, 0x00, 0x03, 0x3c, 0x00,
+  0xc4, 0x79, 0x00, 0xc4, 0x84, 0x00, 0x00, 0x02, 0x6f, 0x79, 0x00, 0x89,
+  0x3a, 0x00, 0x01, 0xed, 0x07, 0x7a, 0x61, 0x72, 0x61, 0x6b, 0x61, 0x74,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x69, 0x00, 0xc4, 0x99, 0x00, 0xc4,
+  0xa1, 0x05, 0x79, 0x61, 0x73, 0x61, 0x73, 0x80, 0x00, 0x03, 0x72, 0x61,
+  0x68, 0x80, 0x00, 0x01, 0x61, 0x00, 0x02, 0x67, 0x6b, 0x00, 0xc4, 0xb3,
+  0x00, 0xc4, 0xbe, 0x00, 0x00, 0x02, 0x61, 0x6f, 0x00, 0x03, 0x21, 0x00,
+  0x8d, 0x1c, 0x00, 0x00, 0x02, 0x69, 0x6f, 0x00, 0xc4, 0xc9, 0x00, 0x86,
+  0xaa, 0x00, 0x00, 0x02, 0x68, 0x6d, 0x00, 0xad, 0x0c, 0x00, 0x21, 0x4a,
+  0x01, 0x69, 0x00, 0x02, 0x68, 0x6d, 0x00, 0x02, 0x2e, 0x00, 0xc4, 0xe0,
+  0x07, 0x6f, 0x6e, 0x69, 0x68, 0x73, 0x69, 0x6e, 0x80, 0x00, 0x00, 0x00,
+  0x07, 0x61, 0x68, 0x6a, 0x6b, 0x6d, 0x6f, 0x72, 0x00, 0x89, 0xf5, 0x00,
+  0xc5, 0x09, 0x00, 0xc5, 0x20, 0x00, 0xc5, 0x3a, 0x00, 0x98, 0xaf, 0x00,
+  0x0d, 0x85, 0x00, 0xc5, 0x76, 0x01, 0x73, 0x00, 0x02, 0x61, 0x69, 0x00,
+  0x93, 0x73, 0x00, 0xc5, 0x15, 0x00, 0x00, 0x02, 0x61, 0x6e, 0x00, 0x03,
+  0x3c, 0x00, 0x8a, 0x37, 0x00, 0x00, 0x02, 0x61, 0x65, 0x00, 0xc5, 0x2b,
+  0x00, 0xc5, 0x34, 0x02, 0x77, 0x61, 0x80, 0x01, 0x69, 0x00, 0x95, 0xf8,
+  0x03, 0x6d, 0x69, 0x68, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x69, 0x00,
+  0xc5, 0x45, 0x00, 0xc5, 0x6b, 0x00, 0x00, 0x03, 0x67, 0x73, 0x77, 0x00,
+  0xc5, 0x54, 0x00, 0xc5, 0x59, 0x00, 0xa7, 0x69, 0x02, 0x6f, 0x61, 0x80,
+  0x00, 0x00, 0x00, 0x02, 0x61, 0x75, 0x00, 0xc5, 0x64, 0x00, 0x99, 0x39,
+  0x04, 0x67, 0x61, 0x6d, 0x61, 0x80, 0x00, 0x00, 0x00, 0x02, 0x68, 0x6d,
+  0x00, 0xa1, 0x17, 0x00, 0x01, 0xed, 0x06, 0x6f, 0x67, 0x69, 0x6d, 0x61,
+  0x6b, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x65, 0x00, 0xc5, 0x8a, 0x00,
+  0xc5, 0x91, 0x04, 0x6e, 0x6e, 0x61, 0x73, 0x80, 0x00, 0x07, 0x73, 0x6e,
+  0x6f, 0x6e, 0x69, 0x68, 0x73, 0x80, 0x00, 0x00, 0x00, 0x07, 0x67, 0x6b,
+  0x6e, 0x72, 0x73, 0x74, 0x79, 0x00, 0xc5, 0xba, 0x00, 0x02, 0xa9, 0x00,
+  0xc5, 0xc4, 0x00, 0xc5, 0xda, 0x00, 0x83, 0xb0, 0x00, 0xc5, 0xe2, 0x00,
+  0x22, 0x90, 0x03, 0x61, 0x73, 0x61, 0x80, 0x01, 0x6b, 0x00, 0x81, 0x96,
+  0x00, 0x00, 0x03, 0x69, 0x6f, 0x75, 0x00, 0x97, 0x33, 0x00, 0x01, 0xed,
+  0x00, 0xc5, 0xd3, 0x04, 0x73, 0x74, 0x61, 0x74, 0x80, 0x00, 0x05, 0x69,
+  0x68, 0x73, 0x61, 0x79, 0x80, 0x00, 0x04, 0x6f, 0x6d, 0x75, 0x73, 0x80,
+  0x00, 0x00, 0x00, 0x02, 0x62, 0x67, 0x00, 0x8a, 0x8a, 0x00, 0x8c, 0x3f,
+  0x04, 0x61, 0x67, 0x61, 0x6e, 0x80, 0x01, 0x2e, 0x00, 0xc5, 0xff, 0x00,
+  0x00, 0x06, 0x61, 0x65, 0x69, 0x6e, 0x6f, 0x75, 0x00, 0xc6, 0x1a, 0x00,
+  0xc7, 0x85, 0x00, 0xc7, 0xa3, 0x00, 0xc8, 0x5a, 0x00, 0xc8, 0x71, 0x00,
+  0xc8, 0xc6, 0x00, 0x40, 0x62, 0x18, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x06, 0x07,
+  0x08, 0x00, 0x00, 0x09, 0x00, 0x0a, 0x00, 0xc6, 0x54, 0x00, 0xc6, 0x5b,
+  0x00, 0xc6, 0x80, 0x00, 0xc6, 0xac, 0x00, 0xc6, 0xde, 0x00, 0xc6, 0xf8,
+  0x00, 0xc7, 0x03, 0x00, 0xc7, 0x09, 0x00, 0xc7, 0x1c, 0x00, 0xc7, 0x79,
+  0x04, 0x75, 0x6b, 0x61, 0x68, 0x80, 0x00, 0x00, 0x00, 0x03, 0x61, 0x65,
+  0x69, 0x00, 0xc6, 0x6a, 0x00, 0xc6, 0x75, 0x00, 0x02, 0x83, 0x00, 0x00,
+  0x02, 0x77, 0x79, 0x00, 0x01, 0xed, 0x00, 0x01, 0x7d, 0x00, 0x00, 0x02,
+  0x6b, 0x75, 0x00, 0x02, 0x83, 0x00, 0x01, 0xed, 0x00, 0x00, 0x03, 0x61,
+  0x69, 0x6f, 0x00, 0xc6, 0x8f, 0x00, 0xc6, 0xa5, 0x00, 0xb3, 0xab, 0x00,
+  0x00, 0x02, 0x73, 0x7a, 0x00, 0xc6, 0x9a, 0x00, 0x07, 0x87, 0x00, 0x00,
+  0x02, 0x61, 0x75, 0x00, 0x86, 0xaa, 0x00, 0x87, 0x21, 0x04, 0x68, 0x73,
+  0x6f, 0x6f, 0x80, 0x00, 0x00, 0x00, 0x03, 0x61, 0x69, 0x75, 0x00, 0xc6,
+  0xbb, 0x00, 0xc6, 0xc7, 0x00, 0x8b, 0xff, 0x01, 0x79, 0x00, 0x02, 0x61,
+  0x69, 0x00, 0x97, 0x33, 0x00, 0x02, 0x83, 0x00, 0x00, 0x02, 0x68, 0x6a,
+  0x00, 0xc6, 0xd2, 0x00, 0x99, 0xe8, 0x09, 0x73, 0x75, 0x6b, 0x75, 0x66,
+  0x6f, 0x73, 0x69, 0x6b, 0x80, 0x00, 0x00, 0x00, 0x02, 0x69, 0x75, 0x00,
+  0xc6, 0xe9, 0x00, 0x8a, 0x14, 0x00, 0x80, 0x01, 0x68, 0x00, 0xc6, 0xf0,
+  0x05, 0x73, 0x65, 0x74, 0x61, 0x74, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61,
+  0x75, 0x00, 0x3d, 0x0a, 0x00, 0xba, 0x51, 0x03, 0x61, 0x69, 0x6d, 0x80,
+  0x00, 0x00, 0x00, 0x02, 0x61, 0x6f, 0x00, 0xc7, 0x14, 0x00, 0x90, 0x2f,
+  0x05, 0x67, 0x61, 0x6d, 0x61, 0x79, 0x80, 0x00, 0x00, 0x00, 0x03, 0x61,
+  0x6f, 0x75, 0x00, 0xc7, 0x2b, 0x00, 0xc7, 0x58, 0x00, 0xc7, 0x62, 0x00,
+  0x00, 0x03, 0x67, 0x6b, 0x7a, 0x00, 0xc7, 0x3a, 0x00, 0x87, 0xae, 0x00,
+  0xc7, 0x50, 0x00, 0x00, 0x02, 0x61, 0x6f, 0x00, 0xc7, 0x45, 0x00, 0x01,
+  0xed, 0x00, 0x00, 0x02, 0x6b, 0x6e, 0x00, 0x3d, 0x0e, 0x00, 0x01, 0xed,
+  0x05, 0x69, 0x75, 0x72, 0x61, 0x6b, 0x80, 0x00, 0x03, 0x6e, 0x69, 0x6d,
+  0x80, 0x01, 0x69, 0x00, 0x95, 0xf8, 0x00, 0x00, 0x02, 0x6b, 0x73, 0x00,
+  0xc7, 0x6d, 0x00, 0xc7, 0x72, 0x02, 0x6f, 0x6f, 0x80, 0x00, 0x00, 0x80,
+  0x01, 0x6f, 0x00, 0x8c, 0xbe, 0x01, 0x61, 0x00, 0x02, 0x6b, 0x72, 0x00,
+  0x02, 0x12, 0x00, 0x5e, 0xe4, 0x00, 0x00, 0x03, 0x61, 0x6e, 0x73, 0x00,
+  0x82, 0x76, 0x00, 0xc7, 0x94, 0x00, 0xc7, 0x9d, 0x06, 0x61, 0x67, 0x61,
+  0x6d, 0x6f, 0x6b, 0x80, 0x00, 0x03, 0x75, 0x62, 0x6f, 0x80, 0x00, 0x00,
+  0x00, 0x05, 0x67, 0x68, 0x6b, 0x6d, 0x72, 0x00, 0x9f, 0x29, 0x00, 0xc7,
+  0xba, 0x00, 0xc7, 0xf4, 0x00, 0xc8, 0x34, 0x00, 0xc8, 0x43, 0x00, 0x00,
+  0x03, 0x61, 0x63, 0x73, 0x00, 0x02, 0x2e, 0x00, 0xc7, 0xc9, 0x00, 0xc7,
+  0xeb, 0x00, 0x00, 0x02, 0x61, 0x75, 0x00, 0xc7, 0xd4, 0x00, 0x9f, 0xa3,
+  0x00, 0x80, 0x01, 0x6d, 0x00, 0xc7, 0xdb, 0x01, 0x6f, 0x80, 0x01, 0x6e,
+  0x00, 0xc7, 0xe3, 0x05, 0x61, 0x6e, 0x69, 0x68, 0x73, 0x80, 0x00, 0x06,
+  0x75, 0x6b, 0x61, 0x67, 0x6f, 0x74, 0x80, 0x00, 0x00, 0x00, 0x04, 0x61,
+  0x69, 0x6f, 0x75, 0x00, 0xc8, 0x07, 0x00, 0xc8, 0x1f, 0x00, 0x02, 0xa9,
+  0x00, 0xc8, 0x2b, 0x00, 0x00, 0x03, 0x6b, 0x6d, 0x74, 0x00, 0x22, 0x90,
+  0x00, 0xc8, 0x16, 0x00, 0x02, 0x12, 0x06, 0x69, 0x6d, 0x61, 0x6e, 0x69,
+  0x6d, 0x80, 0x00, 0x01, 0x61, 0x00, 0x02, 0x61, 0x69, 0x00, 0xa1, 0xf6,
+  0x00, 0x95, 0xf8, 0x06, 0x7a, 0x69, 0x68, 0x63, 0x6f, 0x6d, 0x80, 0x00,
+  0x00, 0x00, 0x03, 0x61, 0x69, 0x6f, 0x00, 0xa6, 0x74, 0x00, 0xac, 0xd6,
+  0x00, 0x0f, 0x63, 0x00, 0x00, 0x03, 0x61, 0x69, 0x6f, 0x00, 0x10, 0xc9,
+  0x00, 0xc8, 0x52, 0x00, 0xa4, 0x9e, 0x05, 0x6a, 0x6f, 0x69, 0x68, 0x73,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x65, 0x00, 0x79, 0x4e, 0x00, 0xc8,
+  0x65, 0x09, 0x73, 0x6e, 0x6f, 0x61, 0x77, 0x61, 0x7a, 0x6f, 0x6e, 0x80,
+  0x00, 0x00, 0x00, 0x05, 0x68, 0x6e, 0x72, 0x73, 0x74, 0x00, 0x9d, 0xd4,
+  0x00, 0xc8, 0x88, 0x00, 0xc8, 0xb3, 0x00, 0xc8, 0xba, 0x00, 0x96, 0x74,
+  0x00, 0x00, 0x03, 0x61, 0x69, 0x75, 0x00, 0xc8, 0x97, 0x00, 0xc8, 0xa2,
+  0x00, 0xc5, 0xd3, 0x00, 0x00, 0x02, 0x67, 0x6b, 0x00, 0x3d, 0x0e, 0x00,
+  0x3d, 0x0e, 0x00, 0x00, 0x02, 0x68, 0x6d, 0x00, 0x01, 0x87, 0x00, 0xc8,
+  0xad, 0x03, 0x75, 0x7a, 0x61, 0x80, 0x00, 0x04, 0x6f, 0x6d, 0x6f, 0x6b,
+  0x80, 0x00, 0x01, 0x69, 0x00, 0x02, 0x67, 0x6b, 0x00, 0x3d, 0x0e, 0x00,
+  0x01, 0xed, 0x00, 0x00, 0x02, 0x6b, 0x73, 0x00, 0xc8, 0xd1, 0x00, 0xc8,
+  0xe5, 0x00, 0x00, 0x02, 0x61, 0x6f, 0x00, 0x03, 0x8e, 0x00, 0xc8, 0xdc,
+  0x06, 0x68, 0x75, 0x6b, 0x69, 0x68, 0x63, 0x80, 0x00, 0x06, 0x74, 0x61,
+  0x6d, 0x65, 0x67, 0x61, 0x80, 0x00, 0x05, 0x6f, 0x70, 0x70, 0x61, 0x73,
+  0x82, 0x01, 0x2e, 0x00, 0x8e, 0x3c, 0x01, 0x6f, 0x00, 0x02, 0x6d, 0x79,
+  0x00, 0xc9, 0x06, 0x00, 0xca, 0x17, 0x04, 0x61, 0x6d, 0x75, 0x6b, 0x80,
+  0x01, 0x2e, 0x00, 0xc9, 0x11, 0x00, 0x00, 0x05, 0x61, 0x65, 0x69, 0x6f,
+  0x75, 0x00, 0xc9, 0x28, 0x00, 0xc9, 0x68, 0x00, 0xc9, 0x70, 0x00, 0xc9,
+  0xbc, 0x00, 0xca, 0x0c, 0x00, 0x00, 0x05, 0x67, 0x6d, 0x72, 0x73, 0x74,
+  0x00, 0x94, 0x79, 0x00, 0x87, 0xb6, 0x00, 0xc9, 0x3f, 0x00, 0xc9, 0x49,
+  0x00, 0xc9, 0x5f, 0x07, 0x61, 0x68, 0x69, 0x68, 0x73, 0x69, 0x6e, 0x80,
+  0x00, 0x00, 0x00, 0x02, 0x6f, 0x75, 0x00, 0x05, 0x9d, 0x00, 0xc9, 0x54,
+  0x04, 0x6b, 0x61, 0x6d, 0x61, 0x80, 0x01, 0x69, 0x00, 0x82, 0x39, 0x06,
+  0x61, 0x6d, 0x61, 0x6e, 0x69, 0x6d, 0x80, 0x00, 0x05, 0x6e, 0x75, 0x66,
+  0x69, 0x6d, 0x80, 0x00, 0x00, 0x00, 0x04, 0x68, 0x6b, 0x6e, 0x72, 0x00,
+  0xc9, 0x83, 0x00, 0xc9, 0x9e, 0x00, 0xc9, 0xa9, 0x00, 0xc9, 0xb3, 0x00,
+  0x00, 0x02, 0x63, 0x73, 0x00, 0xc9, 0x8e, 0x00, 0xc9, 0x95, 0x04, 0x75,
+  0x6b, 0x69, 0x6b, 0x80, 0x00, 0x06, 0x6f, 0x79, 0x6f, 0x74, 0x69, 0x68,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x69, 0x75, 0x00, 0xb1, 0x34, 0x00, 0x01,
+  0xed, 0x03, 0x75, 0x67, 0x6f, 0x80, 0x01, 0x69, 0x00, 0x95, 0xf8, 0x06,
+  0x6f, 0x6d, 0x61, 0x6b, 0x61, 0x74, 0x80, 0x00, 0x00, 0x00, 0x05, 0x61,
+  0x72, 0x73, 0x74, 0x79, 0x00, 0x44, 0x3d, 0x00, 0xc9, 0xd3, 0x00, 0x02,
+  0xa9, 0x00, 0xc9, 0xde, 0x00, 0xca, 0x06, 0x08, 0x69, 0x68, 0x73, 0x75,
+  0x73, 0x74, 0x61, 0x79, 0x80, 0x00, 0x00, 0x00, 0x03, 0x61, 0x6f, 0x75,
+  0x00, 0x89, 0xe0, 0x00, 0xc9, 0xed, 0x00, 0xc9, 0xf9, 0x01, 0x6d, 0x00,
+  0x02, 0x61, 0x75, 0x00, 0x8f, 0x9e, 0x00, 0x03, 0x8e, 0x00, 0x80, 0x01,
+  0x6b, 0x00, 0xca, 0x00, 0x03, 0x6f, 0x79, 0x67, 0x80, 0x00, 0x03, 0x6f,
+  0x68, 0x63, 0x80, 0x00, 0x00, 0x00, 0x02, 0x73, 0x7a, 0x00, 0x81, 0x8f,
+  0x00, 0x02, 0x12, 0x01, 0x6b, 0x80, 0x01, 0x2e, 0x00, 0xca, 0x1f, 0x00,
+  0x00, 0x06, 0x61, 0x65, 0x69, 0x6e, 0x6f, 0x75, 0x00, 0xca, 0x3a, 0x00,
+  0xca, 0xb8, 0x00, 0xca, 0xdc, 0x00, 0xca, 0xf5, 0x00, 0xca, 0xfd, 0x00,
+  0xcb, 0x50, 0x00, 0x00, 0x06, 0x62, 0x6b, 0x6d, 0x6e, 0x72, 0x74, 0x00,
+  0xca, 0x55, 0x00, 0xca, 0x5e, 0x00, 0xca, 0x7a, 0x00, 0xca, 0x93, 0x00,
+  0xca, 0x9d, 0x00, 0xca, 0xa7, 0x06, 0x6d, 0x61, 0x74, 0x6f, 0x79, 0x6b,
+  0x80, 0x00, 0x00, 0x00, 0x03, 0x69, 0x6f, 0x75, 0x00, 0x06, 0x56, 0x00,
+  0xca, 0x6d, 0x00, 0xca, 0x74, 0x04, 0x65, 0x6d, 0x61, 0x6b, 0x80, 0x00,
+  0x03, 0x7a, 0x61, 0x77, 0x80, 0x00, 0x03, 0x61, 0x79, 0x69, 0x00, 0x02,
+  0x68, 0x6d, 0x00, 0xca, 0x88, 0x00, 0x4c, 0xd6, 0x00, 0x00, 0x02, 0x63,
+  0x73, 0x00, 0x8b, 0x1a, 0x00, 0xbf, 0xe0, 0x07, 0x69, 0x68, 0x73, 0x61,
+  0x6d, 0x61, 0x79, 0x80, 0x00, 0x07, 0x61, 0x77, 0x61, 0x74, 0x69, 0x6a,
+  0x75, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x69, 0x00, 0xca, 0xb2, 0x00,
+  0x05, 0x9d, 0x03, 0x77, 0x61, 0x79, 0x80, 0x00, 0x00, 0x00, 0x03, 0x62,
+  0x64, 0x6e, 0x00, 0xca, 0xc7, 0x00, 0x02, 0x83, 0x00, 0x02, 0x83, 0x01,
+  0x61, 0x00, 0x02, 0x6e, 0x79, 0x00, 0xca, 0xd3, 0x00, 0x02, 0xa9, 0x02,
+  0x61, 0x74, 0x80, 0x01, 0x6f, 0x00, 0xa2, 0x07, 0x00, 0x00, 0x03, 0x6a,
+  0x6b, 0x6d, 0x00, 0x07, 0xb6, 0x00, 0xca, 0xeb, 0x00, 0x8e, 0x0c, 0x07,
+  0x61, 0x7a, 0x61, 0x6d, 0x61, 0x79, 0x6f, 0x80, 0x00, 0x05, 0x61, 0x74,
+  0x6e, 0x61, 0x6e, 0x80, 0x00, 0x00, 0x00, 0x05, 0x67, 0x6b, 0x6d, 0x72,
+  0x79, 0x00, 0xcb, 0x14, 0x00, 0x37, 0x55, 0x00, 0x21, 0x4a, 0x00, 0xcb,
+  0x1d, 0x00, 0xcb, 0x2d, 0x06, 0x6e, 0x61, 0x74, 0x6f, 0x79, 0x6b, 0x80,
+  0x00, 0x0d, 0x69, 0x68, 0x73, 0x61, 0x6d, 0x61, 0x79, 0x69, 0x6d, 0x61,
+  0x6e, 0x69, 0x6d, 0x80, 0x00, 0x00, 0x00, 0x03, 0x67, 0x6b, 0x6f, 0x00,
+  0xc1, 0x25, 0x00, 0xcb, 0x3c, 0x00, 0x3e, 0xd7, 0x01, 0x61, 0x00, 0x02,
+  0x6b, 0x73, 0x00, 0xcb, 0x48, 0x00, 0x01, 0xed, 0x05, 0x6f, 0x61, 0x67,
+  0x61, 0x6e, 0x80, 0x00, 0x00, 0x00, 0x02, 0x72, 0x7a, 0x00, 0xcb, 0x5b,
+  0x00, 0xcb, 0x63, 0x05, 0x75, 0x7a, 0x69, 0x61, 0x6d, 0x80, 0x00, 0x00,
+  0x00, 0x02, 0x61, 0x69, 0x00, 0x90, 0x2f, 0x00, 0x05, 0x9d, 0x03, 0x6b,
+  0x6f, 0x74, 0x80, 0x01, 0x2e, 0x00, 0xcb, 0x78, 0x00, 0x00, 0x05, 0x61,
+  0x65, 0x69, 0x6f, 0x75, 0x00, 0xcb, 0x8f, 0x00, 0xcc, 0xd9, 0x00, 0xcd,
+  0x11, 0x00, 0xcd, 0x6c, 0x00, 0xcd, 0xe4, 0x00, 0x40, 0x64, 0x16, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0x05, 0x06, 0x00, 0x00, 0x07, 0x00, 0x08, 0x00, 0xcb, 0xc1,
+  0x00, 0xcb, 0xe4, 0x00, 0xcb, 0xf9, 0x00, 0xcc, 0x55, 0x00, 0xcc, 0x85,
+  0x00, 0xcc, 0x8b, 0x00, 0xcc, 0x96, 0x00, 0xcc, 0xbf, 0x00, 0x00, 0x02,
+  0x69, 0x6f, 0x00, 0xcb, 0xcc, 0x00, 0xcb, 0xdd, 0x00, 0x00, 0x02, 0x68,
+  0x6d, 0x00, 0xcb, 0xd7, 0x00, 0x07, 0x87, 0x03, 0x63, 0x61, 0x6d, 0x80,
+  0x00, 0x04, 0x79, 0x69, 0x68, 0x63, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61,
+  0x69, 0x00, 0xb5, 0x63, 0x00, 0xcb, 0xef, 0x07, 0x68, 0x73, 0x75, 0x73,
+  0x74, 0x61, 0x6b, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x69, 0x00, 0xcc,
+  0x04, 0x00, 0xcc, 0x29, 0x00, 0x00, 0x02, 0x74, 0x79, 0x00, 0xcc, 0x0f,
+  0x00, 0xcc, 0x16, 0x00, 0x80, 0x01, 0x75, 0x00, 0x93, 0x38, 0x08, 0x61,
+  0x72, 0x75, 0x6d, 0x69, 0x68, 0x73, 0x61, 0x00, 0x02, 0x67, 0x73, 0x00,
+  0x5e, 0xe4, 0x00, 0x37, 0x55, 0x00, 0x00, 0x02, 0x68, 0x72, 0x00, 0xcc,
+  0x34, 0x00, 0x01, 0x8f, 0x01, 0x73, 0x00, 0x04, 0x61, 0x69, 0x6f, 0x75,
+  0x00, 0xcc, 0x48, 0x00, 0x93, 0x73, 0x00, 0x0f, 0x63, 0x00, 0xcc, 0x4e,
+  0x03, 0x67, 0x6f, 0x61, 0x80, 0x00, 0x04, 0x7a, 0x75, 0x6f, 0x6b, 0x80,
+  0x00, 0x00, 0x00, 0x03, 0x61, 0x69, 0x75, 0x00, 0xcc, 0x64, 0x00, 0xcc,
+  0x7e, 0x00, 0xab, 0x6d, 0x00, 0x00, 0x02, 0x68, 0x77, 0x00, 0xcc, 0x6f,
+  0x00, 0xcc, 0x76, 0x04, 0x6f, 0x6e, 0x69, 0x68, 0x80, 0x00, 0x05, 0x61,
+  0x73, 0x61, 0x67, 0x6f, 0x80, 0x00, 0x04, 0x61, 0x64, 0x6f, 0x6b, 0x80,
+  0x00, 0x03, 0x73, 0x75, 0x66, 0x80, 0x00, 0x00, 0x00, 0x02, 0x69, 0x6f,
+  0x00, 0x05, 0x9d, 0x00, 0x01, 0xed, 0x01, 0x61, 0x00, 0x02, 0x67, 0x6b,
+  0x00, 0xcc, 0xa2, 0x00, 0xcc, 0xad, 0x00, 0x00, 0x02, 0x61, 0x6f, 0x00,
+  0x8c, 0x3f, 0x00, 0x01, 0x94, 0x00, 0x00, 0x02, 0x61, 0x69, 0x00, 0x44,
+  0x3d, 0x00, 0xcc, 0xb8, 0x04, 0x68, 0x63, 0x61, 0x74, 0x80, 0x00, 0x00,
+  0x00, 0x02, 0x61, 0x75, 0x00, 0xcc, 0xca, 0x00, 0xcc, 0xd2, 0x05, 0x67,
+  0x61, 0x74, 0x65, 0x73, 0x80, 0x00, 0x04, 0x62, 0x69, 0x68, 0x73, 0x80,
+  0x00, 0x00, 0x00, 0x04, 0x61, 0x64, 0x6d, 0x73, 0x00, 0xcc, 0xec, 0x00,
+  0xcc, 0x6f, 0x00, 0xcc, 0xf2, 0x00, 0xcd, 0x0a, 0x03, 0x6d, 0x6f, 0x6b,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x6f, 0x75, 0x00, 0x01, 0xed, 0x00, 0xcc,
+  0xfd, 0x0a, 0x72, 0x75, 0x6b, 0x69, 0x68, 0x73, 0x61, 0x67, 0x69, 0x68,
+  0x80, 0x00, 0x04, 0x6f, 0x79, 0x69, 0x6b, 0x80, 0x00, 0x00, 0x00, 0x05,
+  0x65, 0x67, 0x68, 0x6a, 0x6d, 0x00, 0xcd, 0x28, 0x00, 0x92, 0x9e, 0x00,
+  0xcd, 0x30, 0x00, 0xcd, 0x4f, 0x00, 0xcd, 0x63, 0x05, 0x6e, 0x61, 0x67,
+  0x6f, 0x6b, 0x80, 0x00, 0x00, 0x00, 0x02, 0x63, 0x73, 0x00, 0xcd, 0x3b,
+  0x00, 0xcd, 0x47, 0x01, 0x61, 0x00, 0x02, 0x64, 0x74, 0x00, 0x02, 0xa9,
+  0x00, 0x9a, 0x46, 0x05, 0x61, 0x62, 0x61, 0x74, 0x69, 0x80, 0x00, 0x00,
+  0x00, 0x02, 0x6e, 0x6f, 0x00, 0xcd, 0x5a, 0x00, 0xa1, 0xe5, 0x06, 0x75,
+  0x62, 0x75, 0x6b, 0x6f, 0x6b, 0x80, 0x00, 0x06, 0x61, 0x6e, 0x69, 0x67,
+  0x75, 0x73, 0x80, 0x00, 0x00, 0x00, 0x07, 0x68, 0x6a, 0x6e, 0x72, 0x74,
+  0x75, 0x79, 0x00, 0x8b, 0x62, 0x00, 0xa1, 0xe5, 0x00, 0xcd, 0x8b, 0x00,
+  0xcd, 0xb0, 0x00, 0xcd, 0xb7, 0x00, 0x82, 0xdf, 0x00, 0xcd, 0xdd, 0x00,
+  0x00, 0x03, 0x61, 0x69, 0x75, 0x00, 0x24, 0x35, 0x00, 0xcd, 0x9a, 0x00,
+  0xcd, 0xa9, 0x01, 0x68, 0x80, 0x01, 0x73, 0x00, 0xcd, 0xa2, 0x04, 0x61,
+  0x73, 0x75, 0x6d, 0x80, 0x00, 0x04, 0x72, 0x69, 0x6b, 0x61, 0x80, 0x00,
+  0x04, 0x75, 0x67, 0x65, 0x6d, 0x80, 0x00, 0x00, 0x00, 0x03, 0x61, 0x69,
+  0x6f, 0x00, 0xcd, 0xc6, 0x00, 0x81, 0x96, 0x00, 0x05, 0x9d, 0x00, 0x00,
+  0x02, 0x6d, 0x6e, 0x00, 0xcd, 0xd1, 0x00, 0x01, 0x7d, 0x09, 0x61, 0x79,
+  0x69, 0x68, 0x73, 0x61, 0x67, 0x69, 0x68, 0x80, 0x00, 0x04, 0x6b, 0x6e,
+  0x75, 0x62, 0x80, 0x00, 0x00, 0x00, 0x03, 0x66, 0x68, 0x6b, 0x00, 0xca,
+  0x06, 0x00, 0x95, 0x3c, 0x00, 0xcd, 0xf3, 0x06, 0x75, 0x6a, 0x6e, 0x69,
+  0x68, 0x73, 0x80, 0x00, 0x00, 0x00, 0x02, 0x67, 0x6f, 0x00, 0x01, 0xed,
+  0x00, 0x01, 0xed, 0x00, 0x00, 0x02, 0x66, 0x68, 0x00, 0xce, 0x12, 0x00,
+  0xcf, 0xa4, 0x02, 0x69, 0x67, 0x80, 0x01, 0x2e, 0x00, 0xce, 0x1b, 0x00,
+  0x00, 0x06, 0x61, 0x65, 0x69, 0x6e, 0x6f, 0x75, 0x00, 0xce, 0x36, 0x00,
+  0xce, 0xd4, 0x00, 0xce, 0xdf, 0x00, 0xcf, 0x3e, 0x00, 0xcf, 0x45, 0x00,
+  0xcf, 0x76, 0x00, 0x00, 0x07, 0x64, 0x6b, 0x6d, 0x6e, 0x72, 0x74, 0x77,
+  0x00, 0xce, 0x55, 0x00, 0xce, 0x60, 0x00, 0xce, 0x67, 0x00, 0x22, 0x81,
+  0x00, 0xce, 0x79, 0x00, 0xce, 0x9a, 0x00, 0xce, 0xa8, 0x00, 0x00, 0x02,
+  0x65, 0x69, 0x00, 0x87, 0x21, 0x00, 0x3d, 0x0a, 0x04, 0x69, 0x6d, 0x6f,
+  0x74, 0x80, 0x00, 0x00, 0x00, 0x02, 0x61, 0x69, 0x00, 0x9b, 0x7d, 0x00,
+  0xce, 0x72, 0x04, 0x68, 0x73, 0x61, 0x68, 0x80, 0x00, 0x03, 0x61, 0x68,
+  0x61, 0x00, 0x02, 0x67, 0x73, 0x00, 0xce, 0x87, 0x00, 0x21, 0x4a, 0x01,
+  0x69, 0x00, 0x02, 0x6b, 0x6d, 0x00, 0x06, 0x56, 0x00, 0xce, 0x93, 0x04,
+  0x61, 0x6b, 0x61, 0x6b, 0x80, 0x00, 0x03, 0x61, 0x67, 0x61, 0x00, 0x02,
+  0x6d, 0x74, 0x00, 0x8a, 0x8a, 0x00, 0x84, 0x8d, 0x01, 0x61, 0x00, 0x02,
+  0x67, 0x6b, 0x00, 0xce, 0xb4, 0x00, 0xce, 0xc8, 0x00, 0x00, 0x02, 0x69,
+  0x75, 0x00, 0x93, 0x56, 0x00, 0xce, 0xbf, 0x06, 0x73, 0x74, 0x61, 0x6b,
+  0x61, 0x6e, 0x80, 0x00, 0x05, 0x61, 0x72, 0x69, 0x68, 0x73, 0x80, 0x01,
+  0x69, 0x00, 0x91, 0x49, 0x00, 0x00, 0x02, 0x6b, 0x75, 0x00, 0xa2, 0x26,
+  0x00, 0x8a, 0x37, 0x00, 0x00, 0x06, 0x67, 0x68, 0x6b, 0x6d, 0x6e, 0x75,
+  0x00, 0xce, 0xfa, 0x00, 0xcf, 0x03, 0x00, 0xcf, 0x1c, 0x00, 0xcf, 0x2b,
+  0x00, 0x21, 0x4a, 0x00, 0x22, 0x10, 0x06, 0x6f, 0x68, 0x61, 0x6b, 0x61,
+  0x73, 0x80, 0x00, 0x01, 0x63, 0x00, 0x02, 0x61, 0x75, 0x00, 0xcf, 0x0f,
+  0x00, 0xcf, 0x15, 0x03, 0x70, 0x6e, 0x61, 0x80, 0x00, 0x04, 0x6f, 0x6e,
+  0x61, 0x77, 0x80, 0x00, 0x00, 0x00, 0x03, 0x61, 0x65, 0x6f, 0x00, 0x8b,
+  0x9e, 0x00, 0x03, 0x8e, 0x00, 0x03, 0x3c, 0x00, 0x00, 0x02, 0x61, 0x69,
+  0x00, 0xcf, 0x36, 0x00, 0x88, 0xc3, 0x05, 0x6e, 0x75, 0x7a, 0x69, 0x6d,
+  0x80, 0x00, 0x04, 0x61, 0x6e, 0x69, 0x67, 0x80, 0x00, 0x00, 0x00, 0x06,
+  0x64, 0x6a, 0x6d, 0x6e, 0x72, 0x73, 0x00, 0x01, 0x99, 0x00, 0xcf, 0x60,
+  0x00, 0xcf, 0x65, 0x00, 0x01, 0x7d, 0x00, 0xa0, 0x59, 0x00, 0xcf, 0x6e,
+  0x02, 0x75, 0x67, 0x80, 0x00, 0x06, 0x61, 0x6b, 0x6f, 0x6e, 0x69, 0x6d,
+  0x80, 0x00, 0x05, 0x69, 0x68, 0x63, 0x69, 0x68, 0x80, 0x00, 0x00, 0x00,
+  0x02, 0x66, 0x73, 0x00, 0xcf, 0x81, 0x00, 0xcf, 0x86, 0x02, 0x69, 0x67,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x6f, 0x74, 0x00, 0xb1, 0x10, 0x00, 0xcf,
+  0x91, 0x00, 0x00, 0x02, 0x61, 0x6f, 0x00, 0xcf, 0x9c, 0x00, 0x8a, 0x8a,
+  0x05, 0x6d, 0x61, 0x73, 0x61, 0x6b, 0x80, 0x00, 0x08, 0x73, 0x75, 0x79,
+  0x6b, 0x61, 0x74, 0x69, 0x6b, 0x82, 0x01, 0x2e, 0x00, 0x8e, 0x3c, 0x00,
+  0x80, 0x01, 0x2e, 0x00, 0xcf, 0xba, 0x00, 0x00, 0x06, 0x61, 0x67, 0x6d,
+  0x70, 0x75, 0x76, 0x00, 0x4c, 0xf9, 0x00, 0x01, 0x72, 0x00, 0x01, 0x82,
+  0x00, 0x10, 0xad, 0x00, 0x01, 0x94, 0x00, 0x01, 0x99, 0x00, 0x00, 0x04,
+  0x61, 0x67, 0x69, 0x6d, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x0a,
+  0x66, 0x00, 0x01, 0xed, 0x00, 0x40, 0x61, 0x14, 0x01, 0x02, 0x03, 0x00,
+  0x04, 0x05, 0x06, 0x07, 0x08, 0x00, 0x09, 0x0a, 0x0b, 0x0c, 0x00, 0x0d,
+  0x00, 0x00, 0x0e, 0x0f, 0x00, 0xd0, 0x2d, 0x00, 0xd0, 0xd8, 0x00, 0xd2,
+  0xdc, 0x00, 0x07, 0xba, 0x00, 0xd2, 0xfe, 0x00, 0xd4, 0x38, 0x00, 0xd4,
+  0x56, 0x00, 0xd4, 0x78, 0x00, 0xd4, 0xcc, 0x00, 0x08, 0x11, 0x00, 0x0d,
+  0xb7, 0x00, 0x19, 0x64, 0x00, 0xd5, 0xd9, 0x00, 0x01, 0xed, 0x00, 0xd6,
+  0x36, 0x00, 0x82, 0x02, 0x2e, 0x34, 0x00, 0xd0, 0x38, 0x00, 0xd0, 0xc7,
+  0x00, 0x00, 0x06, 0x33, 0x61, 0x63, 0x6d, 0x6e, 0x6f, 0x00, 0xd0, 0x53,
+  0x00, 0xd0, 0x68, 0x00, 0xd0, 0x7e, 0x00, 0x1e, 0x13, 0x00, 0xd0, 0x8e,
+  0x00, 0xd0, 0xb2, 0x12, 0x61, 0x75, 0x67, 0x6e, 0x65, 0x6c, 0x61, 0x6c,
+  0x65, 0x64, 0x6f, 0x73, 0x65, 0x72, 0x67, 0x6e, 0x6f, 0x63, 0x81, 0x00,
+  0x00, 0x00, 0x02, 0x62, 0x6e, 0x00, 0xd0, 0x73, 0x00, 0xd0, 0x77, 0x01,
+  0x75, 0x81, 0x00, 0x04, 0x69, 0x74, 0x65, 0x72, 0x81, 0x00, 0x00, 0x00,
+  0x02, 0x69, 0x75, 0x00, 0x1d, 0x42, 0x00, 0xd0, 0x89, 0x02, 0x64, 0x65,
+  0x81, 0x00, 0x01, 0x6f, 0x00, 0x02, 0x63, 0x69, 0x00, 0xd0, 0x9a, 0x00,
+  0xd0, 0x9f, 0x02, 0x65, 0x6d, 0x81, 0x00, 0x01, 0x63, 0x00, 0x02, 0x61,
+  0x6f, 0x00, 0x1d, 0x42, 0x00, 0xd0, 0xab, 0x04, 0x6d, 0x6f, 0x72, 0x70,
+  0x81, 0x00, 0x12, 0x63, 0x69, 0x6e, 0x6f, 0x72, 0x74, 0x63, 0x65, 0x6c,
+  0x65, 0x6f, 0x6e, 0x72, 0x65, 0x69, 0x62, 0x6f, 0x67, 0x81, 0x00, 0x0e,
+  0x64, 0x35, 0x61, 0x34, 0x70, 0x72, 0x65, 0x62, 0x67, 0x6d, 0x2d, 0x2d,
+  0x6e, 0x78, 0x80, 0x00, 0x00, 0x80, 0x01, 0x2e, 0x00, 0xd0, 0xdf, 0x00,
+  0x40, 0x32, 0x45, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x03, 0x04, 0x00, 0x05, 0x06, 0x00, 0x07, 0x00,
+  0x00, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12,
+  0x00, 0xd1, 0x5e, 0x00, 0xd1, 0x63, 0x00, 0xd1, 0x6a, 0x00, 0xd1, 0x79,
+  0x00, 0xd1, 0x97, 0x00, 0xd1, 0xa2, 0x00, 0xd1, 0xe3, 0x00, 0xd1, 0xfb,
+  0x00, 0xd2, 0x0e, 0x00, 0xd2, 0x30, 0x00, 0xd2, 0x35, 0x00, 0xd2, 0x5b,
+  0x00, 0x44, 0x3d, 0x00, 0xd2, 0x75, 0x00, 0xd2, 0x8c, 0x00, 0xd2, 0x98,
+  0x00, 0x01, 0x94, 0x00, 0xd2, 0xc9, 0x02, 0x31, 0x67, 0x80, 0x00, 0x00,
+  0x80, 0x01, 0x6d, 0x00, 0x02, 0x83, 0x00, 0x00, 0x03, 0x65, 0x73, 0x74,
+  0x00, 0x01, 0x8b, 0x00, 0x01, 0xff, 0x00, 0x22, 0x81, 0x00, 0x00, 0x04,
+  0x65, 0x6d, 0x6e, 0x72, 0x00, 0x03, 0x40, 0x00, 0x1e, 0x64, 0x00, 0xd1,
+  0x8c, 0x00, 0x03, 0x3c, 0x00, 0x00, 0x02, 0x66, 0x69, 0x00, 0x01, 0xed,
+  0x00, 0x01, 0xed, 0x00, 0x00, 0x02, 0x67, 0x6e, 0x00, 0x0b, 0xb4, 0x00,
+  0x02, 0x83, 0x00, 0x00, 0x06, 0x65, 0x6c, 0x6e, 0x6f, 0x70, 0x72, 0x00,
+  0x05, 0xfa, 0x00, 0xd1, 0xbd, 0x00, 0xd1, 0xc8, 0x00, 0xd1, 0xd3, 0x00,
+  0x01, 0xff, 0x00, 0x02, 0x12, 0x00, 0x00, 0x02, 0x73, 0x7a, 0x00, 0x01,
+  0xed, 0x00, 0x01, 0xed, 0x00, 0x00, 0x02, 0x63, 0x65, 0x00, 0x01, 0xed,
+  0x00, 0x01, 0xed, 0x01, 0x6c, 0x00, 0x03, 0x62, 0x66, 0x76, 0x00, 0x01,
+  0xed, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x00, 0x04, 0x6b, 0x73,
+  0x74, 0x78, 0x00, 0xd1, 0xf6, 0x00, 0x01, 0xff, 0x00, 0x22, 0x81, 0x00,
+  0x81, 0x96, 0x02, 0x69, 0x77, 0x80, 0x00, 0x00, 0x00, 0x03, 0x65, 0x69,
+  0x73, 0x00, 0x05, 0xfa, 0x00, 0x03, 0x40, 0x00, 0xd2, 0x0a, 0x01, 0x71,
+  0x80, 0x00, 0x00, 0x00, 0x05, 0x61, 0x64, 0x66, 0x69, 0x6f, 0x00, 0x01,
+  0xed, 0x00, 0x02, 0xa9, 0x00, 0x01, 0xed, 0x00, 0x01, 0x87, 0x00, 0xd2,
+  0x25, 0x00, 0x00, 0x02, 0x63, 0x6e, 0x00, 0x0b, 0xb8, 0x00, 0x01, 0xed,
+  0x02, 0x63, 0x65, 0x80, 0x00, 0x00, 0x00, 0x06, 0x63, 0x64, 0x65, 0x69,
+  0x72, 0x74, 0x00, 0x22, 0x81, 0x00, 0x02, 0x12, 0x00, 0x03, 0x3c, 0x00,
+  0xd2, 0x50, 0x00, 0x01, 0xff, 0x00, 0x02, 0xa9, 0x00, 0x00, 0x02, 0x62,
+  0x64, 0x00, 0x01, 0xed, 0x00, 0x23, 0x35, 0x00, 0x00, 0x03, 0x6d, 0x6f,
+  0x73, 0x00, 0xd2, 0x6a, 0x00, 0x01, 0x82, 0x00, 0x22, 0x81, 0x00, 0x00,
+  0x02, 0x65, 0x74, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x00, 0x05,
+  0x61, 0x67, 0x6f, 0x74, 0x75, 0x00, 0x1c, 0xc3, 0x00, 0x02, 0xa9, 0x00,
+  0x3e, 0xd7, 0x00, 0x02, 0x03, 0x00, 0x03, 0x3c, 0x01, 0x75, 0x00, 0x02,
+  0x6a, 0x6d, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x00, 0x06, 0x61,
+  0x65, 0x6e, 0x6f, 0x72, 0x73, 0x00, 0x03, 0x40, 0x00, 0xd2, 0xb3, 0x00,
+  0x01, 0x87, 0x00, 0xd2, 0xbe, 0x00, 0x02, 0xa9, 0x00, 0x1c, 0xc3, 0x00,
+  0x00, 0x02, 0x6e, 0x76, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x00,
+  0x02, 0x66, 0x6e, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x00, 0x04,
+  0x64, 0x6f, 0x72, 0x74, 0x00, 0x02, 0xa9, 0x00, 0x0b, 0xb4, 0x00, 0x03,
+  0x8e, 0x00, 0x01, 0xed, 0x00, 0x80, 0x01, 0x2e, 0x00, 0xd2, 0xe3, 0x00,
+  0x00, 0x06, 0x61, 0x63, 0x64, 0x69, 0x6f, 0x72, 0x00, 0x03, 0x8e, 0x00,
+  0x02, 0xa9, 0x00, 0x22, 0x81, 0x00, 0x1c, 0xc3, 0x00, 0x0b, 0x78, 0x00,
+  0x02, 0x12, 0x00, 0x80, 0x02, 0x2e, 0x61, 0x00, 0xd3, 0x09, 0x00, 0xd4,
+  0x28, 0x00, 0x40, 0x61, 0x16, 0x01, 0x00, 0x02, 0x03, 0x04, 0x00, 0x00,
+  0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x07, 0x08, 0x00, 0x00, 0x00, 0x09,
+  0x0a, 0x00, 0x0b, 0x00, 0xd3, 0x44, 0x00, 0xd3, 0x4b, 0x00, 0x0d, 0x7a,
+  0x00, 0xd3, 0x54, 0x00, 0xd3, 0x74, 0x00, 0x12, 0xd3, 0x00, 0xd3, 0x89,
+  0x00, 0x0a, 0x52, 0x00, 0xd3, 0xa7, 0x00, 0xd3, 0xf0, 0x00, 0x19, 0x13,
+  0x04, 0x74, 0x65, 0x72, 0x67, 0x80, 0x00, 0x06, 0x69, 0x64, 0x65, 0x73,
+  0x73, 0x61, 0x80, 0x00, 0x00, 0x00, 0x03, 0x63, 0x72, 0x73, 0x00, 0xd3,
+  0x63, 0x00, 0x27, 0xdd, 0x00, 0x02, 0xad, 0x0e, 0x69, 0x74, 0x73, 0x75,
+  0x6a, 0x2d, 0x72, 0x65, 0x69, 0x73, 0x73, 0x69, 0x75, 0x68, 0x80, 0x00,
+  0x00, 0x00, 0x02, 0x63, 0x72, 0x00, 0x01, 0x87, 0x00, 0xd3, 0x7f, 0x07,
+  0x67, 0x61, 0x62, 0x6d, 0x61, 0x68, 0x63, 0x80, 0x00, 0x00, 0x00, 0x02,
+  0x65, 0x69, 0x00, 0xd3, 0x94, 0x00, 0xd3, 0x9f, 0x08, 0x69, 0x63, 0x61,
+  0x6d, 0x72, 0x61, 0x68, 0x70, 0x80, 0x00, 0x05, 0x63, 0x65, 0x64, 0x65,
+  0x6d, 0x80, 0x00, 0x01, 0x65, 0x00, 0x04, 0x6c, 0x72, 0x74, 0x75, 0x00,
+  0xd3, 0xbb, 0x00, 0xd3, 0xcd, 0x00, 0xd3, 0xd5, 0x00, 0xd3, 0xea, 0x0f,
+  0x62, 0x61, 0x74, 0x70, 0x6d, 0x6f, 0x63, 0x2d, 0x73, 0x74, 0x72, 0x65,
+  0x70, 0x78, 0x65, 0x80, 0x00, 0x05, 0x69, 0x61, 0x74, 0x6f, 0x6e, 0x80,
+  0x00, 0x12, 0x73, 0x69, 0x74, 0x6e, 0x65, 0x64, 0x2d, 0x73, 0x6e, 0x65,
+  0x69, 0x67, 0x72, 0x75, 0x72, 0x69, 0x68, 0x63, 0x80, 0x00, 0x03, 0x6f,
+  0x76, 0x61, 0x80, 0x00, 0x00, 0x00, 0x03, 0x61, 0x6f, 0x72, 0x00, 0xd3,
+  0xff, 0x00, 0x02, 0x25, 0x00, 0xd4, 0x06, 0x04, 0x63, 0x6f, 0x76, 0x61,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x65, 0x6f, 0x00, 0xd4, 0x11, 0x00, 0xd4,
+  0x20, 0x0c, 0x70, 0x78, 0x65, 0x2d, 0x65, 0x72, 0x74, 0x65, 0x6d, 0x6f,
+  0x65, 0x67, 0x80, 0x00, 0x01, 0x70, 0x80, 0x01, 0x6f, 0x00, 0x7b, 0xb6,
+  0x0d, 0x76, 0x63, 0x37, 0x79, 0x6c, 0x71, 0x62, 0x67, 0x6d, 0x2d, 0x2d,
+  0x6e, 0x78, 0x80, 0x00, 0x00, 0x80, 0x01, 0x2e, 0x00, 0xd4, 0x3f, 0x00,
+  0x00, 0x05, 0x67, 0x6d, 0x74, 0x75, 0x76, 0x00, 0x01, 0x72, 0x00, 0x01,
+  0x82, 0x00, 0x16, 0x96, 0x00, 0x01, 0x94, 0x00, 0x01, 0x99, 0x00, 0x80,
+  0x01, 0x2e, 0x00, 0xd4, 0x5d, 0x00, 0x00, 0x03, 0x65, 0x6d, 0x7a, 0x00,
+  0x02, 0xfe, 0x00, 0xd4, 0x6c, 0x00, 0x02, 0x83, 0x01, 0x6f, 0x00, 0x02,
+  0x63, 0x72, 0x00, 0x01, 0xed, 0x00, 0x1c, 0xc3, 0x00, 0x80, 0x01, 0x2e,
+  0x00, 0xd4, 0x7f, 0x00, 0x40, 0x61, 0x16, 0x01, 0x00, 0x02, 0x03, 0x00,
+  0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x08, 0x00, 0xd4, 0xb1, 0x00, 0x02, 0xa9, 0x00,
+  0x02, 0x83, 0x00, 0x01, 0x72, 0x00, 0x04, 0x33, 0x00, 0x01, 0x87, 0x00,
+  0x01, 0x8f, 0x00, 0x01, 0x99, 0x00, 0x00, 0x02, 0x36, 0x72, 0x00, 0xd4,
+  0xbc, 0x00, 0x01, 0x08, 0x0d, 0x31, 0x66, 0x34, 0x61, 0x33, 0x61, 0x62,
+  0x67, 0x6d, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x00, 0x80, 0x01, 0x2e,
+  0x00, 0xd4, 0xd3, 0x00, 0x40, 0x63, 0x13, 0x01, 0x00, 0x02, 0x00, 0x03,
+  0x00, 0x04, 0x00, 0x05, 0x06, 0x07, 0x08, 0x09, 0x00, 0x00, 0x0a, 0x0b,
+  0x0c, 0x0d, 0x00, 0x16, 0xc3, 0x00, 0xd5, 0x11, 0x00, 0x05, 0x9d, 0x00,
+  0xd5, 0x20, 0x00, 0xd5, 0x2a, 0x00, 0xd5, 0x4f, 0x00, 0xd5, 0x60, 0x00,
+  0xd5, 0x6d, 0x00, 0x0b, 0x78, 0x00, 0x02, 0x12, 0x00, 0xd5, 0xad, 0x00,
+  0x0c, 0x9e, 0x00, 0xd5, 0xbc, 0x00, 0x00, 0x03, 0x6e, 0x70, 0x72, 0x00,
+  0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x07, 0x67, 0x67, 0x6e,
+  0x6f, 0x65, 0x79, 0x67, 0x80, 0x00, 0x02, 0x75, 0x62, 0x00, 0x02, 0x67,
+  0x6e, 0x00, 0xd5, 0x37, 0x00, 0xd5, 0x49, 0x01, 0x6e, 0x00, 0x02, 0x6f,
+  0x75, 0x00, 0xd5, 0x43, 0x00, 0x82, 0xdf, 0x03, 0x65, 0x79, 0x67, 0x80,
+  0x00, 0x03, 0x6f, 0x65, 0x6a, 0x80, 0x00, 0x00, 0x00, 0x02, 0x69, 0x75,
+  0x00, 0x03, 0x40, 0x00, 0xd5, 0x5a, 0x03, 0x6f, 0x65, 0x73, 0x80, 0x00,
+  0x02, 0x61, 0x6e, 0x00, 0x02, 0x67, 0x6e, 0x00, 0xd5, 0x37, 0x00, 0xd5,
+  0x49, 0x00, 0x00, 0x02, 0x61, 0x6f, 0x00, 0xd5, 0x78, 0x00, 0xd5, 0x84,
+  0x01, 0x73, 0x00, 0x02, 0x6c, 0x75, 0x00, 0x07, 0xb6, 0x00, 0x1e, 0x64,
+  0x00, 0x00, 0x02, 0x65, 0x77, 0x00, 0xd5, 0x8f, 0x00, 0xd5, 0xa6, 0x00,
+  0x00, 0x02, 0x68, 0x6a, 0x00, 0xd5, 0x9a, 0x00, 0xd5, 0xa0, 0x03, 0x63,
+  0x6e, 0x69, 0x80, 0x00, 0x03, 0x65, 0x61, 0x64, 0x80, 0x00, 0x04, 0x67,
+  0x6e, 0x61, 0x67, 0x80, 0x00, 0x00, 0x00, 0x03, 0x65, 0x68, 0x6d, 0x00,
+  0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x00, 0x02, 0x67,
+  0x6a, 0x00, 0xd5, 0xa0, 0x00, 0xd5, 0xc7, 0x00, 0x00, 0x02, 0x65, 0x67,
+  0x00, 0x3e, 0xd7, 0x00, 0xd5, 0xd2, 0x04, 0x6e, 0x61, 0x77, 0x67, 0x80,
+  0x00, 0x00, 0x80, 0x01, 0x2e, 0x00, 0xd5, 0xe0, 0x00, 0x40, 0x61, 0x1a,
+  0x01, 0x00, 0x02, 0x00, 0x03, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x08, 0x09, 0x0a, 0x00, 0x00,
+  0x00, 0x0b, 0x00, 0xd6, 0x1f, 0x00, 0x02, 0xa9, 0x00, 0x02, 0xfe, 0x00,
+  0xd6, 0x25, 0x00, 0x01, 0x72, 0x00, 0x01, 0x82, 0x00, 0x0a, 0x13, 0x00,
+  0xd6, 0x2b, 0x00, 0x01, 0x94, 0x00, 0x01, 0x99, 0x00, 0x08, 0x0c, 0x03,
+  0x6c, 0x73, 0x69, 0x80, 0x00, 0x03, 0x6f, 0x72, 0x70, 0x80, 0x00, 0x00,
+  0x00, 0x02, 0x65, 0x73, 0x00, 0x02, 0x03, 0x00, 0x22, 0x81, 0x00, 0x82,
+  0x01, 0x2e, 0x00, 0xd6, 0x3d, 0x01, 0x63, 0x00, 0x02, 0x69, 0x6e, 0x00,
+  0x1d, 0x42, 0x00, 0xd6, 0x49, 0x04, 0x2e, 0x76, 0x6f, 0x67, 0x80, 0x00,
+  0x00, 0x40, 0x38, 0x40, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x00,
+  0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x00, 0x08, 0x09, 0x00, 0x00,
+  0x0a, 0x00, 0x0b, 0x00, 0x00, 0x0c, 0x00, 0x0d, 0x00, 0xd6, 0xbb, 0x00,
+  0xd6, 0xc6, 0x00, 0x27, 0x05, 0x00, 0xd6, 0xd1, 0x00, 0xd6, 0xdc, 0x00,
+  0x01, 0xed, 0x00, 0xd7, 0x12, 0x00, 0xd7, 0x30, 0x00, 0x01, 0xed, 0x00,
+  0xd7, 0x42, 0x00, 0xd7, 0x68, 0x00, 0xd7, 0x8a, 0x00, 0xd9, 0xaf, 0x08,
+  0x73, 0x71, 0x69, 0x66, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x08, 0x7a,
+  0x71, 0x69, 0x66, 0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x00, 0x80, 0x02,
+  0x2e, 0x6f, 0x00, 0x08, 0x18, 0x00, 0x3e, 0xd7, 0x00, 0x80, 0x02, 0x2e,
+  0x64, 0x00, 0xd6, 0xe7, 0x00, 0xd7, 0x06, 0x00, 0x00, 0x04, 0x62, 0x67,
+  0x6d, 0x75, 0x00, 0x01, 0x99, 0x00, 0x01, 0x72, 0x00, 0xd6, 0xfa, 0x00,
+  0x01, 0x94, 0x01, 0x6f, 0x00, 0x02, 0x63, 0x6e, 0x00, 0x0b, 0xb8, 0x00,
+  0x01, 0xed, 0x09, 0x64, 0x32, 0x62, 0x67, 0x6d, 0x2d, 0x2d, 0x6e, 0x78,
+  0x80, 0x00, 0x00, 0x80, 0x01, 0x2e, 0x00, 0xd7, 0x19, 0x00, 0x00, 0x05,
+  0x67, 0x6d, 0x74, 0x75, 0x76, 0x00, 0x01, 0x72, 0x00, 0x01, 0x82, 0x00,
+  0x02, 0x78, 0x00, 0x01, 0x94, 0x00, 0x01, 0x99, 0x00, 0x80, 0x01, 0x2e,
+  0x00, 0xd7, 0x37, 0x00, 0x00, 0x02, 0x67, 0x6f, 0x00, 0x01, 0x72, 0x00,
+  0x01, 0x87, 0x00, 0x80, 0x01, 0x2e, 0x00, 0xd7, 0x49, 0x00, 0x00, 0x07,
+  0x63, 0x67, 0x6d, 0x6f, 0x74, 0x75, 0x76, 0x00, 0x06, 0x56, 0x00, 0x01,
+  0x72, 0x00, 0x01, 0x82, 0x00, 0x27, 0x8e, 0x00, 0x01, 0x8f, 0x00, 0x01,
+  0x94, 0x00, 0x01, 0x99, 0x00, 0x80, 0x01, 0x2e, 0x00, 0xd7, 0x6f, 0x00,
+  0x00, 0x06, 0x63, 0x67, 0x6e, 0x6f, 0x75, 0x76, 0x00, 0x02, 0xa9, 0x00,
+  0x01, 0x72, 0x00, 0x02, 0x83, 0x00, 0x01, 0x87, 0x00, 0x01, 0x94, 0x00,
+  0x01, 0x99, 0x00, 0x80, 0x01, 0x2e, 0x00, 0xd7, 0x91, 0x00, 0x40, 0x61,
+  0x1a, 0x01, 0x00, 0x02, 0x03, 0x04, 0x00, 0x00, 0x05, 0x06, 0x07, 0x08,
+  0x09, 0x0a, 0x0b, 0x0c, 0x00, 0x00, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x00,
+  0x12, 0x13, 0x14, 0x00, 0xd7, 0xeb, 0x00, 0xd8, 0x76, 0x00, 0xd8, 0x85,
+  0x00, 0xd8, 0x9c, 0x00, 0xd8, 0xcc, 0x00, 0xd8, 0xd7, 0x00, 0xd9, 0x04,
+  0x00, 0xd9, 0x0c, 0x00, 0xd9, 0x17, 0x00, 0xd9, 0x04, 0x00, 0xd9, 0x26,
+  0x00, 0xd9, 0x39, 0x00, 0xd9, 0x44, 0x00, 0xd9, 0x53, 0x00, 0xd9, 0x66,
+  0x00, 0xd9, 0x79, 0x00, 0xd9, 0x81, 0x00, 0xd9, 0x8c, 0x00, 0xd9, 0x94,
+  0x00, 0xd9, 0xa7, 0x00, 0x40, 0x63, 0x15, 0x01, 0x00, 0x00, 0x00, 0x02,
+  0x00, 0x03, 0x00, 0x00, 0x04, 0x05, 0x00, 0x00, 0x06, 0x00, 0x00, 0x07,
+  0x00, 0x00, 0x08, 0x09, 0x00, 0xd8, 0x1f, 0x00, 0xd8, 0x1f, 0x00, 0xd8,
+  0x1f, 0x00, 0xd8, 0x1f, 0x00, 0xd8, 0x35, 0x00, 0xd8, 0x1f, 0x00, 0x02,
+  0x83, 0x00, 0xd8, 0x1f, 0x00, 0xd8, 0x1f, 0x00, 0x80, 0x01, 0x2e, 0x00,
+  0xd8, 0x26, 0x00, 0x00, 0x03, 0x32, 0x62, 0x63, 0x00, 0x0a, 0x09, 0x00,
+  0x0d, 0x75, 0x00, 0x01, 0x87, 0x00, 0x80, 0x01, 0x2e, 0x00, 0xd8, 0x3c,
+  0x00, 0x00, 0x03, 0x32, 0x62, 0x63, 0x00, 0xd8, 0x4b, 0x00, 0x0d, 0x75,
+  0x00, 0x01, 0x87, 0x02, 0x31, 0x6b, 0x80, 0x01, 0x2e, 0x00, 0xd8, 0x54,
+  0x00, 0x00, 0x03, 0x68, 0x72, 0x74, 0x00, 0xd8, 0x63, 0x00, 0xd8, 0x6b,
+  0x00, 0xd8, 0x71, 0x05, 0x63, 0x6f, 0x72, 0x61, 0x70, 0x80, 0x00, 0x03,
+  0x74, 0x68, 0x63, 0x80, 0x00, 0x02, 0x76, 0x70, 0x80, 0x00, 0x00, 0x00,
+  0x03, 0x64, 0x6e, 0x73, 0x00, 0xd8, 0x1f, 0x00, 0xd8, 0x1f, 0x00, 0xd8,
+  0x1f, 0x00, 0x00, 0x05, 0x65, 0x69, 0x6d, 0x6e, 0x73, 0x00, 0x1c, 0xc3,
+  0x00, 0xd8, 0x1f, 0x00, 0xd8, 0x1f, 0x00, 0xd8, 0x1f, 0x00, 0xd8, 0x1f,
+  0x00, 0x00, 0x04, 0x64, 0x6c, 0x6d, 0x6e, 0x00, 0xd8, 0x1f, 0x00, 0xd8,
+  0xaf, 0x00, 0xd8, 0x1f, 0x00, 0xd8, 0x1f, 0x05, 0x61, 0x73, 0x2d, 0x34,
+  0x2d, 0x00, 0x02, 0x64, 0x66, 0x00, 0xd8, 0xbf, 0x00, 0xd8, 0xc5, 0x03,
+  0x6e, 0x61, 0x6c, 0x84, 0x00, 0x04, 0x66, 0x75, 0x74, 0x73, 0x84, 0x00,
+  0x00, 0x00, 0x02, 0x6e, 0x6f, 0x00, 0xd8, 0x1f, 0x00, 0xd8, 0x1f, 0x00,
+  0x00, 0x06, 0x68, 0x6d, 0x6e, 0x72, 0x76, 0x77, 0x00, 0xd8, 0xf2, 0x00,
+  0xd8, 0x1f, 0x00, 0x46, 0xfe, 0x00, 0xd8, 0x1f, 0x00, 0xd8, 0x1f, 0x00,
+  0xd8, 0x1f, 0x00, 0x80, 0x01, 0x2e, 0x00, 0xd8, 0xf9, 0x00, 0x00, 0x02,
+  0x62, 0x63, 0x00, 0x0d, 0x75, 0x00, 0x01, 0x87, 0x01, 0x6e, 0x80, 0x01,
+  0x2e, 0x00, 0xd8, 0x26, 0x00, 0x00, 0x02, 0x61, 0x6f, 0x00, 0xd8, 0x1f,
+  0x00, 0xd8, 0x1f, 0x00, 0x00, 0x03, 0x61, 0x66, 0x69, 0x00, 0xd8, 0x1f,
+  0x00, 0xd8, 0x1f, 0x00, 0xd8, 0x1f, 0x00, 0x00, 0x04, 0x69, 0x6d, 0x73,
+  0x74, 0x00, 0xd8, 0x1f, 0x00, 0xd8, 0x1f, 0x00, 0x02, 0x03, 0x00, 0xd8,
+  0x1f, 0x00, 0x00, 0x02, 0x63, 0x6d, 0x00, 0xd8, 0x1f, 0x00, 0xd8, 0x1f,
+  0x00, 0x00, 0x03, 0x61, 0x6f, 0x70, 0x00, 0xd8, 0x1f, 0x00, 0xd8, 0x1f,
+  0x00, 0xd8, 0x1f, 0x00, 0x00, 0x04, 0x61, 0x64, 0x6b, 0x6d, 0x00, 0xd8,
+  0x1f, 0x00, 0x84, 0x8d, 0x00, 0xd8, 0x1f, 0x00, 0xd8, 0x1f, 0x00, 0x00,
+  0x04, 0x63, 0x6d, 0x75, 0x76, 0x00, 0xd8, 0x1f, 0x00, 0xd8, 0x1f, 0x00,
+  0xd8, 0x1f, 0x00, 0xd8, 0x1f, 0x01, 0x67, 0x80, 0x01, 0x2e, 0x00, 0xd8,
+  0x26, 0x00, 0x00, 0x02, 0x6e, 0x77, 0x00, 0xd8, 0x1f, 0x00, 0xd8, 0x1f,
+  0x01, 0x74, 0x80, 0x01, 0x2e, 0x00, 0xd8, 0x26, 0x00, 0x00, 0x04, 0x62,
+  0x6b, 0x6e, 0x77, 0x00, 0x16, 0x50, 0x00, 0xd8, 0x1f, 0x00, 0xd8, 0x1f,
+  0x00, 0xd8, 0x1f, 0x01, 0x61, 0x80, 0x01, 0x2e, 0x00, 0xd8, 0x26, 0x00,
+  0x80, 0x01, 0x2e, 0x00, 0xd9, 0xb6, 0x00, 0x00, 0x06, 0x67, 0x6d, 0x73,
+  0x74, 0x75, 0x76, 0x00, 0x01, 0x72, 0x00, 0x01, 0x82, 0x00, 0xd9, 0xd1,
+  0x00, 0x01, 0x8f, 0x00, 0x01, 0x94, 0x00, 0x01, 0x99, 0x00, 0x00, 0x02,
+  0x6e, 0x74, 0x00, 0x55, 0xa6, 0x00, 0xd9, 0xdc, 0x04, 0x65, 0x70, 0x79,
+  0x6d, 0x84, 0x00, 0x00, 0x40, 0x61, 0x19, 0x01, 0x02, 0x00, 0x00, 0x03,
+  0x00, 0x04, 0x05, 0x06, 0x00, 0x00, 0x07, 0x08, 0x09, 0x00, 0x0a, 0x00,
+  0x00, 0x0b, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0xda, 0x27, 0x00,
+  0x08, 0x11, 0x00, 0xda, 0x6e, 0x00, 0xdc, 0x21, 0x00, 0xdc, 0x47, 0x00,
+  0xdc, 0xc6, 0x00, 0x27, 0x05, 0x00, 0x07, 0xba, 0x00, 0xe7, 0xbf, 0x00,
+  0xe7, 0xc7, 0x00, 0xe7, 0xfc, 0x00, 0xe8, 0x82, 0x00, 0x01, 0xed, 0x00,
+  0x80, 0x02, 0x2e, 0x63, 0x00, 0xda, 0x32, 0x00, 0x01, 0xed, 0x00, 0x00,
+  0x05, 0x63, 0x6f, 0x72, 0x76, 0x7a, 0x00, 0x02, 0xa9, 0x00, 0xda, 0x49,
+  0x00, 0x02, 0x12, 0x00, 0xda, 0x59, 0x00, 0xda, 0x69, 0x00, 0x00, 0x02,
+  0x63, 0x66, 0x00, 0x0b, 0xb8, 0x00, 0xda, 0x54, 0x02, 0x6e, 0x69, 0x84,
+  0x00, 0x00, 0x00, 0x02, 0x67, 0x69, 0x00, 0x01, 0xed, 0x00, 0xda, 0x64,
+  0x02, 0x72, 0x70, 0x84, 0x00, 0x02, 0x69, 0x62, 0x84, 0x00, 0x00, 0x82,
+  0x01, 0x6e, 0x00, 0xda, 0x75, 0x00, 0x80, 0x01, 0x2e, 0x00, 0xda, 0x7c,
+  0x00, 0x40, 0x61, 0x1a, 0x01, 0x02, 0x00, 0x03, 0x04, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x08, 0x00, 0x00, 0x09, 0x0a,
+  0x0b, 0x00, 0x00, 0x0c, 0x0d, 0x0e, 0x00, 0xda, 0xc4, 0x00, 0x15, 0xad,
+  0x00, 0xda, 0xcf, 0x00, 0xda, 0xdc, 0x00, 0x14, 0x63, 0x00, 0xdb, 0x26,
+  0x00, 0xdb, 0x31, 0x00, 0xdb, 0x3c, 0x00, 0xdb, 0x88, 0x00, 0xdb, 0xb2,
+  0x00, 0xdc, 0x14, 0x00, 0x16, 0x56, 0x00, 0x2b, 0xee, 0x00, 0xdc, 0x18,
+  0x00, 0x00, 0x02, 0x6c, 0x7a, 0x00, 0x29, 0x7b, 0x00, 0x02, 0x6a, 0x0a,
+  0x6e, 0x61, 0x62, 0x2d, 0x65, 0x68, 0x74, 0x2d, 0x6e, 0x69, 0x84, 0x00,
+  0x00, 0x00, 0x06, 0x68, 0x6d, 0x6e, 0x72, 0x73, 0x74, 0x00, 0xda, 0xf7,
+  0x00, 0xdb, 0x05, 0x00, 0x14, 0x15, 0x00, 0xdb, 0x0f, 0x00, 0x02, 0x6a,
+  0x00, 0xdb, 0x18, 0x0b, 0x74, 0x2d, 0x6e, 0x6f, 0x2d, 0x65, 0x63, 0x69,
+  0x66, 0x66, 0x6f, 0x84, 0x00, 0x07, 0x6f, 0x68, 0x74, 0x61, 0x6e, 0x79,
+  0x64, 0x84, 0x00, 0x06, 0x65, 0x68, 0x75, 0x72, 0x68, 0x74, 0x84, 0x00,
+  0x0b, 0x69, 0x73, 0x2d, 0x72, 0x65, 0x70, 0x70, 0x61, 0x72, 0x63, 0x73,
+  0x84, 0x00, 0x00, 0x00, 0x02, 0x65, 0x75, 0x00, 0x2c, 0x1f, 0x00, 0x02,
+  0x6a, 0x00, 0x00, 0x02, 0x63, 0x6a, 0x00, 0x29, 0x7b, 0x00, 0x2d, 0x99,
+  0x00, 0x00, 0x05, 0x69, 0x6a, 0x6d, 0x6f, 0x74, 0x00, 0xdb, 0x53, 0x00,
+  0x02, 0x6a, 0x00, 0xdb, 0x5e, 0x00, 0xdb, 0x6b, 0x00, 0x15, 0x10, 0x00,
+  0x00, 0x02, 0x65, 0x66, 0x00, 0x15, 0x8d, 0x00, 0x2d, 0xb1, 0x0a, 0x61,
+  0x63, 0x2d, 0x64, 0x6e, 0x61, 0x62, 0x2d, 0x74, 0x61, 0x84, 0x00, 0x00,
+  0x00, 0x02, 0x2d, 0x68, 0x00, 0xdb, 0x76, 0x00, 0xdb, 0x82, 0x09, 0x6f,
+  0x69, 0x64, 0x61, 0x72, 0x2d, 0x6d, 0x61, 0x68, 0x84, 0x00, 0x03, 0x62,
+  0x65, 0x77, 0x84, 0x00, 0x00, 0x00, 0x05, 0x61, 0x62, 0x65, 0x6e, 0x73,
+  0x00, 0x15, 0x50, 0x00, 0x15, 0x68, 0x00, 0xdb, 0x9f, 0x00, 0xdb, 0xaa,
+  0x00, 0x15, 0xbb, 0x08, 0x73, 0x75, 0x6f, 0x68, 0x73, 0x79, 0x75, 0x62,
+  0x84, 0x00, 0x05, 0x64, 0x67, 0x6f, 0x6c, 0x62, 0x84, 0x00, 0x00, 0x00,
+  0x04, 0x65, 0x69, 0x6e, 0x73, 0x00, 0xdb, 0xc5, 0x00, 0xdb, 0xd3, 0x00,
+  0xdb, 0xff, 0x00, 0xdc, 0x0a, 0x0b, 0x6e, 0x72, 0x65, 0x74, 0x6e, 0x69,
+  0x66, 0x6f, 0x64, 0x6e, 0x65, 0x84, 0x00, 0x01, 0x2d, 0x00, 0x02, 0x65,
+  0x73, 0x00, 0xdb, 0xdf, 0x00, 0xdb, 0xe6, 0x04, 0x6b, 0x6f, 0x72, 0x62,
+  0x84, 0x00, 0x00, 0x00, 0x03, 0x65, 0x6c, 0x74, 0x00, 0xdb, 0xf5, 0x00,
+  0x2d, 0xb1, 0x00, 0xdb, 0xfa, 0x02, 0x6f, 0x64, 0x84, 0x00, 0x02, 0x65,
+  0x67, 0x84, 0x00, 0x08, 0x6f, 0x72, 0x66, 0x64, 0x75, 0x6f, 0x6c, 0x63,
+  0x84, 0x00, 0x07, 0x69, 0x78, 0x65, 0x74, 0x6e, 0x6f, 0x64, 0x84, 0x00,
+  0x01, 0x68, 0x84, 0x00, 0x06, 0x61, 0x2d, 0x6d, 0x6f, 0x72, 0x66, 0x84,
+  0x00, 0x00, 0x80, 0x01, 0x2e, 0x00, 0xdc, 0x28, 0x00, 0x00, 0x07, 0x62,
+  0x64, 0x67, 0x6c, 0x6d, 0x74, 0x75, 0x00, 0x01, 0x99, 0x00, 0x03, 0x21,
+  0x00, 0x01, 0x72, 0x00, 0x01, 0x7d, 0x00, 0x01, 0x82, 0x00, 0x01, 0x8f,
+  0x00, 0x01, 0x94, 0x00, 0x80, 0x01, 0x2e, 0x00, 0xdc, 0x4e, 0x00, 0x40,
+  0x64, 0x13, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04,
+  0x00, 0x05, 0x06, 0x00, 0x00, 0x00, 0x07, 0x08, 0x09, 0x00, 0x04, 0x75,
+  0x00, 0x01, 0x72, 0x00, 0xdc, 0x80, 0x00, 0x10, 0xb2, 0x00, 0xdc, 0x8b,
+  0x00, 0xdc, 0xa5, 0x00, 0xdc, 0xb1, 0x00, 0x01, 0x94, 0x00, 0x19, 0x13,
+  0x00, 0x00, 0x02, 0x65, 0x6f, 0x00, 0x01, 0x8b, 0x00, 0x01, 0xff, 0x00,
+  0x00, 0x03, 0x66, 0x72, 0x73, 0x00, 0x03, 0x21, 0x00, 0x01, 0xff, 0x00,
+  0xdc, 0x9a, 0x00, 0x00, 0x02, 0x72, 0x73, 0x00, 0x02, 0x73, 0x00, 0x02,
+  0xa9, 0x01, 0x6f, 0x00, 0x02, 0x68, 0x6f, 0x00, 0x03, 0x8e, 0x00, 0x01,
+  0x87, 0x00, 0x00, 0x03, 0x65, 0x6c, 0x72, 0x00, 0x02, 0x03, 0x00, 0xdc,
+  0xc0, 0x00, 0x02, 0xa9, 0x03, 0x75, 0x64, 0x61, 0x80, 0x00, 0x00, 0x80,
+  0x01, 0x2e, 0x00, 0xdc, 0xcd, 0x00, 0x40, 0x61, 0x1a, 0x01, 0x02, 0x03,
+  0x04, 0x05, 0x00, 0x06, 0x07, 0x08, 0x00, 0x00, 0x09, 0x0a, 0x0b, 0x0c,
+  0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0xdd, 0x27, 0x00, 0xe1, 0x90, 0x00, 0xe1, 0x9f, 0x00, 0xe1, 0xba, 0x00,
+  0xe1, 0xc5, 0x00, 0xe2, 0xab, 0x00, 0x01, 0x87, 0x00, 0xe2, 0xc6, 0x00,
+  0xe3, 0xd5, 0x00, 0xe3, 0xf2, 0x00, 0xe4, 0x01, 0x00, 0xe4, 0x4c, 0x00,
+  0xe6, 0x9d, 0x00, 0x02, 0xa9, 0x00, 0xe6, 0xac, 0x00, 0xe6, 0xe7, 0x00,
+  0xe7, 0x49, 0x00, 0xe7, 0x82, 0x00, 0xe7, 0x95, 0x00, 0xe7, 0xb0, 0x00,
+  0x40, 0x62, 0x19, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+  0x00, 0x04, 0x05, 0x06, 0x07, 0x08, 0x00, 0x09, 0x0a, 0x0b, 0x0c, 0x0d,
+  0x00, 0x00, 0x00, 0x0e, 0x00, 0x01, 0xed, 0x00, 0xdd, 0x6e, 0x00, 0xdd,
+  0x75, 0x00, 0xdf, 0x17, 0x00, 0xdf, 0x32, 0x00, 0xdf, 0x3d, 0x00, 0xdf,
+  0xb8, 0x00, 0x01, 0xed, 0x00, 0xdf, 0xbe, 0x00, 0xe0, 0x2d, 0x00, 0xe0,
+  0x6e, 0x00, 0xe0, 0xfa, 0x00, 0xe1, 0x00, 0x00, 0xe1, 0x16, 0x00, 0x80,
+  0x01, 0x63, 0x00, 0x23, 0x91, 0x00, 0x40, 0x62, 0x19, 0x01, 0x02, 0x00,
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x06, 0x00,
+  0x00, 0x07, 0x00, 0x08, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0a, 0x00, 0xdd,
+  0xb0, 0x00, 0xdd, 0xce, 0x00, 0xdd, 0xd5, 0x00, 0xdd, 0xe0, 0x00, 0xdd,
+  0xff, 0x00, 0xde, 0x48, 0x00, 0xde, 0x4f, 0x00, 0xde, 0xd8, 0x00, 0x36,
+  0x49, 0x00, 0xde, 0xf5, 0x02, 0x6c, 0x6f, 0x00, 0x02, 0x2d, 0x6f, 0x00,
+  0xdd, 0xbd, 0x00, 0xdd, 0xc6, 0x06, 0x6f, 0x69, 0x70, 0x6d, 0x65, 0x74,
+  0x80, 0x00, 0x05, 0x69, 0x70, 0x6d, 0x65, 0x74, 0x80, 0x00, 0x04, 0x73,
+  0x65, 0x72, 0x62, 0x80, 0x00, 0x00, 0x00, 0x02, 0x67, 0x75, 0x00, 0x39,
+  0x4e, 0x00, 0x53, 0x37, 0x03, 0x69, 0x6d, 0x65, 0x00, 0x02, 0x2d, 0x6f,
+  0x00, 0xdd, 0xee, 0x00, 0xdd, 0xf7, 0x06, 0x6f, 0x69, 0x67, 0x67, 0x65,
+  0x72, 0x80, 0x00, 0x05, 0x69, 0x67, 0x67, 0x65, 0x72, 0x80, 0x00, 0x00,
+  0x00, 0x03, 0x61, 0x6f, 0x72, 0x00, 0xde, 0x0e, 0x00, 0xde, 0x24, 0x00,
+  0x96, 0x59, 0x00, 0x00, 0x02, 0x62, 0x74, 0x00, 0xde, 0x19, 0x00, 0xde,
+  0x1f, 0x03, 0x72, 0x65, 0x76, 0x80, 0x00, 0x02, 0x61, 0x63, 0x80, 0x00,
+  0x04, 0x62, 0x72, 0x61, 0x63, 0x00, 0x02, 0x2d, 0x73, 0x00, 0xde, 0x33,
+  0x00, 0xde, 0x3e, 0x08, 0x73, 0x61, 0x69, 0x73, 0x65, 0x6c, 0x67, 0x69,
+  0x80, 0x00, 0x07, 0x61, 0x69, 0x73, 0x65, 0x6c, 0x67, 0x69, 0x80, 0x00,
+  0x04, 0x74, 0x73, 0x69, 0x70, 0x80, 0x00, 0x00, 0x00, 0x03, 0x62, 0x64,
+  0x65, 0x00, 0xde, 0x5e, 0x00, 0xde, 0x6d, 0x00, 0xde, 0xd2, 0x04, 0x61,
+  0x6c, 0x61, 0x63, 0x00, 0x02, 0x2d, 0x6f, 0x00, 0xdd, 0xee, 0x00, 0xdd,
+  0xf7, 0x02, 0x6e, 0x61, 0x00, 0x04, 0x2d, 0x61, 0x69, 0x73, 0x00, 0xde,
+  0x82, 0x00, 0xde, 0xad, 0x00, 0xde, 0xbc, 0x00, 0xde, 0xcb, 0x00, 0x00,
+  0x02, 0x61, 0x69, 0x00, 0xde, 0x8d, 0x00, 0xde, 0x9d, 0x0d, 0x74, 0x74,
+  0x65, 0x6c, 0x72, 0x61, 0x62, 0x2d, 0x69, 0x6e, 0x61, 0x72, 0x74, 0x80,
+  0x00, 0x0d, 0x6e, 0x61, 0x72, 0x74, 0x2d, 0x61, 0x74, 0x74, 0x65, 0x6c,
+  0x72, 0x61, 0x62, 0x80, 0x00, 0x0c, 0x74, 0x74, 0x65, 0x6c, 0x72, 0x61,
+  0x62, 0x69, 0x6e, 0x61, 0x72, 0x74, 0x80, 0x00, 0x0c, 0x6e, 0x61, 0x72,
+  0x74, 0x61, 0x74, 0x74, 0x65, 0x6c, 0x72, 0x61, 0x62, 0x80, 0x00, 0x04,
+  0x73, 0x65, 0x6c, 0x61, 0x80, 0x00, 0x03, 0x70, 0x6d, 0x69, 0x80, 0x00,
+  0x05, 0x6e, 0x65, 0x6c, 0x61, 0x76, 0x00, 0x02, 0x2d, 0x6f, 0x00, 0xde,
+  0xe8, 0x00, 0xde, 0xef, 0x04, 0x6f, 0x62, 0x69, 0x76, 0x80, 0x00, 0x03,
+  0x62, 0x69, 0x76, 0x80, 0x00, 0x00, 0x00, 0x02, 0x65, 0x69, 0x00, 0xdf,
+  0x00, 0x00, 0x21, 0x0c, 0x00, 0x00, 0x02, 0x6e, 0x70, 0x00, 0x72, 0x12,
+  0x00, 0xdf, 0x0b, 0x01, 0x73, 0x00, 0x02, 0x2d, 0x61, 0x00, 0x26, 0x72,
+  0x00, 0x05, 0xfa, 0x00, 0x00, 0x02, 0x69, 0x6c, 0x00, 0xdf, 0x22, 0x00,
+  0xdf, 0x2c, 0x03, 0x75, 0x71, 0x61, 0x80, 0x01, 0x6c, 0x00, 0x01, 0xed,
+  0x03, 0x65, 0x69, 0x62, 0x80, 0x00, 0x00, 0x00, 0x02, 0x6f, 0x72, 0x00,
+  0x01, 0x8b, 0x00, 0x36, 0x49, 0x00, 0x80, 0x05, 0x65, 0x67, 0x69, 0x6e,
+  0x6f, 0x00, 0xdf, 0x54, 0x00, 0xdf, 0x7f, 0x00, 0xdf, 0x86, 0x00, 0xdf,
+  0x97, 0x00, 0xdf, 0x9f, 0x00, 0x00, 0x03, 0x64, 0x69, 0x73, 0x00, 0x45,
+  0x69, 0x00, 0x03, 0x8e, 0x00, 0xdf, 0x63, 0x02, 0x65, 0x63, 0x00, 0x02,
+  0x2d, 0x69, 0x00, 0xdf, 0x70, 0x00, 0xdf, 0x78, 0x05, 0x69, 0x6c, 0x72,
+  0x6f, 0x66, 0x80, 0x00, 0x04, 0x6c, 0x72, 0x6f, 0x66, 0x80, 0x00, 0x04,
+  0x6f, 0x6c, 0x6f, 0x62, 0x80, 0x00, 0x00, 0x00, 0x02, 0x73, 0x74, 0x00,
+  0xdf, 0x91, 0x00, 0x26, 0x72, 0x03, 0x73, 0x65, 0x6d, 0x80, 0x00, 0x01,
+  0x65, 0x80, 0x01, 0x76, 0x00, 0x23, 0x35, 0x00, 0x00, 0x04, 0x63, 0x6d,
+  0x72, 0x76, 0x00, 0x79, 0x4e, 0x00, 0xdf, 0xb2, 0x00, 0x72, 0x12, 0x00,
+  0x22, 0x90, 0x03, 0x65, 0x72, 0x63, 0x80, 0x00, 0x03, 0x6e, 0x65, 0x67,
+  0x80, 0x00, 0x00, 0x80, 0x03, 0x61, 0x65, 0x74, 0x00, 0xdf, 0xcd, 0x00,
+  0xe0, 0x09, 0x00, 0xe0, 0x0f, 0x00, 0x00, 0x03, 0x63, 0x72, 0x76, 0x00,
+  0xdf, 0xdc, 0x00, 0xdf, 0xe2, 0x00, 0x67, 0x13, 0x03, 0x73, 0x65, 0x70,
+  0x80, 0x00, 0x01, 0x72, 0x00, 0x02, 0x61, 0x65, 0x00, 0xdf, 0xee, 0x00,
+  0x1c, 0xc3, 0x01, 0x63, 0x00, 0x02, 0x2d, 0x61, 0x00, 0xdf, 0xfa, 0x00,
+  0xe0, 0x02, 0x05, 0x61, 0x73, 0x73, 0x61, 0x6d, 0x80, 0x00, 0x04, 0x73,
+  0x73, 0x61, 0x6d, 0x80, 0x00, 0x03, 0x74, 0x61, 0x6d, 0x80, 0x00, 0x06,
+  0x73, 0x61, 0x69, 0x6c, 0x67, 0x6f, 0x80, 0x02, 0x2d, 0x6c, 0x00, 0xe0,
+  0x20, 0x00, 0xe0, 0x27, 0x04, 0x6c, 0x6c, 0x65, 0x64, 0x80, 0x00, 0x03,
+  0x6c, 0x65, 0x64, 0x80, 0x00, 0x00, 0x80, 0x03, 0x69, 0x73, 0x75, 0x00,
+  0x01, 0xff, 0x00, 0xe0, 0x3c, 0x00, 0xe0, 0x5c, 0x02, 0x61, 0x6d, 0x00,
+  0x02, 0x2d, 0x61, 0x00, 0xe0, 0x49, 0x00, 0xe0, 0x53, 0x07, 0x61, 0x72,
+  0x61, 0x72, 0x72, 0x61, 0x63, 0x80, 0x00, 0x06, 0x72, 0x61, 0x72, 0x72,
+  0x61, 0x63, 0x80, 0x00, 0x00, 0x00, 0x02, 0x63, 0x67, 0x00, 0xe0, 0x67,
+  0x00, 0x23, 0x35, 0x04, 0x61, 0x72, 0x69, 0x73, 0x80, 0x00, 0x00, 0x80,
+  0x04, 0x61, 0x72, 0x73, 0x74, 0x00, 0xe0, 0x81, 0x00, 0xe0, 0x89, 0x00,
+  0xc5, 0x54, 0x00, 0xe0, 0x90, 0x05, 0x72, 0x65, 0x63, 0x61, 0x6d, 0x80,
+  0x00, 0x04, 0x65, 0x73, 0x61, 0x63, 0x80, 0x00, 0x01, 0x65, 0x00, 0x02,
+  0x6c, 0x73, 0x00, 0xe0, 0x9c, 0x00, 0xe0, 0xef, 0x03, 0x72, 0x61, 0x62,
+  0x00, 0x03, 0x2d, 0x61, 0x69, 0x00, 0xe0, 0xae, 0x00, 0xe0, 0xd5, 0x00,
+  0xe0, 0xe2, 0x00, 0x00, 0x02, 0x61, 0x69, 0x00, 0xe0, 0xb9, 0x00, 0xe0,
+  0xc7, 0x0b, 0x69, 0x72, 0x64, 0x6e, 0x61, 0x2d, 0x69, 0x6e, 0x61, 0x72,
+  0x74, 0x80, 0x00, 0x0b, 0x6e, 0x61, 0x72, 0x74, 0x2d, 0x61, 0x69, 0x72,
+  0x64, 0x6e, 0x61, 0x80, 0x00, 0x0a, 0x69, 0x72, 0x64, 0x6e, 0x61, 0x69,
+  0x6e, 0x61, 0x72, 0x74, 0x80, 0x00, 0x0a, 0x6e, 0x61, 0x72, 0x74, 0x61,
+  0x69, 0x72, 0x64, 0x6e, 0x61, 0x80, 0x00, 0x08, 0x73, 0x69, 0x6e, 0x61,
+  0x74, 0x6c, 0x61, 0x63, 0x80, 0x00, 0x03, 0x64, 0x61, 0x70, 0x80, 0x00,
+  0x00, 0x80, 0x01, 0x6f, 0x00, 0xe1, 0x07, 0x00, 0x00, 0x03, 0x64, 0x6e,
+  0x74, 0x00, 0x36, 0x49, 0x00, 0x3f, 0xb7, 0x00, 0x4a, 0x42, 0x01, 0x6e,
+  0x00, 0x03, 0x61, 0x65, 0x6f, 0x00, 0xe1, 0x26, 0x00, 0xe1, 0x71, 0x00,
+  0x03, 0x40, 0x03, 0x69, 0x72, 0x62, 0x00, 0x03, 0x2d, 0x61, 0x65, 0x00,
+  0xe1, 0x38, 0x00, 0xe1, 0x52, 0x00, 0xe1, 0x69, 0x01, 0x61, 0x00, 0x02,
+  0x6c, 0x7a, 0x00, 0xe1, 0x44, 0x00, 0x3e, 0x12, 0x0b, 0x6c, 0x65, 0x64,
+  0x2d, 0x65, 0x2d, 0x61, 0x7a, 0x6e, 0x6f, 0x6d, 0x80, 0x00, 0x00, 0x00,
+  0x02, 0x6c, 0x7a, 0x00, 0xe1, 0x5d, 0x00, 0x3e, 0x12, 0x09, 0x6c, 0x65,
+  0x64, 0x65, 0x61, 0x7a, 0x6e, 0x6f, 0x6d, 0x80, 0x00, 0x05, 0x61, 0x7a,
+  0x6e, 0x6f, 0x6d, 0x80, 0x00, 0x00, 0x00, 0x03, 0x63, 0x73, 0x74, 0x00,
+  0xe1, 0x80, 0x00, 0x01, 0x82, 0x00, 0x38, 0x2b, 0x00, 0x00, 0x02, 0x61,
+  0x69, 0x00, 0xe1, 0x8b, 0x00, 0x59, 0xcd, 0x02, 0x69, 0x70, 0x80, 0x00,
+  0x00, 0x00, 0x03, 0x63, 0x6d, 0x76, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed,
+  0x00, 0x01, 0xed, 0x00, 0x00, 0x06, 0x66, 0x6c, 0x6d, 0x70, 0x72, 0x76,
+  0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed,
+  0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x00, 0x02, 0x70, 0x75, 0x00,
+  0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x40, 0x63, 0x18, 0x01, 0x00, 0x00,
+  0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x06, 0x00, 0x07, 0x00,
+  0x08, 0x09, 0x0a, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0xe2, 0x05,
+  0x00, 0x01, 0xed, 0x00, 0xe2, 0x22, 0x00, 0x01, 0xed, 0x00, 0xe2, 0x43,
+  0x00, 0xe2, 0x4a, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0xe2, 0x84,
+  0x00, 0xe2, 0x8b, 0x00, 0x01, 0xed, 0x00, 0xe2, 0xa3, 0x00, 0x80, 0x03,
+  0x63, 0x69, 0x6e, 0x00, 0x1f, 0x1f, 0x00, 0xe2, 0x14, 0x00, 0xe2, 0x1a,
+  0x03, 0x6e, 0x65, 0x76, 0x80, 0x00, 0x05, 0x65, 0x72, 0x6f, 0x6c, 0x66,
+  0x80, 0x00, 0x00, 0x80, 0x01, 0x69, 0x00, 0xe2, 0x29, 0x02, 0x64, 0x61,
+  0x00, 0x02, 0x2d, 0x6f, 0x00, 0xe2, 0x36, 0x00, 0xe2, 0x3d, 0x04, 0x6f,
+  0x74, 0x6c, 0x61, 0x80, 0x00, 0x03, 0x74, 0x6c, 0x61, 0x80, 0x00, 0x00,
+  0x80, 0x01, 0x6f, 0x00, 0x01, 0x8b, 0x00, 0x00, 0x02, 0x69, 0x6f, 0x00,
+  0xe2, 0x55, 0x00, 0xe2, 0x5a, 0x02, 0x64, 0x75, 0x80, 0x00, 0x00, 0x00,
+  0x02, 0x6e, 0x74, 0x00, 0xe2, 0x65, 0x00, 0xe2, 0x7e, 0x00, 0x00, 0x02,
+  0x65, 0x69, 0x00, 0xe2, 0x70, 0x00, 0xe2, 0x77, 0x04, 0x64, 0x72, 0x6f,
+  0x70, 0x80, 0x00, 0x04, 0x73, 0x6f, 0x72, 0x66, 0x80, 0x00, 0x03, 0x6f,
+  0x72, 0x63, 0x80, 0x00, 0x04, 0x65, 0x72, 0x61, 0x76, 0x80, 0x00, 0x00,
+  0x80, 0x01, 0x73, 0x00, 0xe2, 0x92, 0x00, 0x00, 0x02, 0x65, 0x6f, 0x00,
+  0xe2, 0x9d, 0x00, 0x02, 0xa9, 0x03, 0x69, 0x72, 0x74, 0x80, 0x00, 0x05,
+  0x6e, 0x65, 0x72, 0x69, 0x66, 0x80, 0x00, 0x00, 0x00, 0x06, 0x61, 0x62,
+  0x66, 0x6f, 0x70, 0x72, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x01,
+  0xed, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x40,
+  0x62, 0x15, 0x01, 0x02, 0x03, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x06, 0x07, 0x00, 0x08, 0x00, 0x09, 0x0a, 0x0b, 0x00, 0x0c, 0x00,
+  0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x20, 0x5e, 0x00, 0x01, 0xed, 0x00,
+  0xe3, 0x03, 0x00, 0x01, 0xed, 0x00, 0xe3, 0x3e, 0x00, 0x01, 0xed, 0x00,
+  0xe3, 0x8c, 0x00, 0xe3, 0xaf, 0x00, 0xe3, 0xbe, 0x00, 0x01, 0xed, 0x00,
+  0x80, 0x03, 0x6c, 0x6f, 0x72, 0x00, 0xe3, 0x12, 0x00, 0xe3, 0x1a, 0x00,
+  0xe3, 0x20, 0x05, 0x65, 0x63, 0x72, 0x65, 0x76, 0x80, 0x00, 0x03, 0x70,
+  0x61, 0x6e, 0x80, 0x00, 0x02, 0x6f, 0x66, 0x00, 0x02, 0x2d, 0x61, 0x00,
+  0xe3, 0x2d, 0x00, 0xe3, 0x36, 0x06, 0x61, 0x6e, 0x65, 0x73, 0x65, 0x63,
+  0x80, 0x00, 0x05, 0x6e, 0x65, 0x73, 0x65, 0x63, 0x80, 0x00, 0x00, 0x00,
+  0x03, 0x61, 0x69, 0x72, 0x00, 0xe3, 0x4d, 0x00, 0xe3, 0x86, 0x00, 0x1a,
+  0x51, 0x00, 0x00, 0x02, 0x70, 0x72, 0x00, 0x1d, 0xe1, 0x00, 0xe3, 0x58,
+  0x01, 0x74, 0x00, 0x02, 0x2d, 0x61, 0x00, 0xe3, 0x64, 0x00, 0xe3, 0x76,
+  0x0f, 0x61, 0x74, 0x74, 0x65, 0x6c, 0x72, 0x61, 0x62, 0x2d, 0x61, 0x69,
+  0x72, 0x64, 0x6e, 0x61, 0x80, 0x00, 0x0d, 0x74, 0x74, 0x65, 0x6c, 0x72,
+  0x61, 0x62, 0x61, 0x69, 0x72, 0x64, 0x6e, 0x61, 0x80, 0x00, 0x03, 0x6d,
+  0x69, 0x72, 0x80, 0x00, 0x00, 0x80, 0x01, 0x61, 0x00, 0xe3, 0x93, 0x00,
+  0x00, 0x03, 0x62, 0x69, 0x73, 0x00, 0x01, 0xed, 0x00, 0xe3, 0xa2, 0x00,
+  0xe3, 0xa9, 0x04, 0x6c, 0x67, 0x61, 0x63, 0x80, 0x00, 0x03, 0x73, 0x61,
+  0x73, 0x80, 0x00, 0x00, 0x80, 0x01, 0x69, 0x00, 0xe3, 0xb6, 0x05, 0x64,
+  0x6e, 0x69, 0x72, 0x62, 0x80, 0x00, 0x00, 0x00, 0x02, 0x65, 0x73, 0x00,
+  0xe3, 0xc9, 0x00, 0x02, 0xa9, 0x01, 0x69, 0x00, 0x02, 0x68, 0x72, 0x00,
+  0x01, 0x87, 0x00, 0x01, 0xed, 0x00, 0x00, 0x04, 0x61, 0x62, 0x63, 0x6f,
+  0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0xe3, 0xe8,
+  0x07, 0x72, 0x69, 0x74, 0x64, 0x65, 0x75, 0x73, 0x80, 0x00, 0x00, 0x00,
+  0x03, 0x66, 0x69, 0x72, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x01,
+  0xed, 0x00, 0x40, 0x61, 0x14, 0x01, 0x02, 0x03, 0x00, 0x04, 0x00, 0x00,
+  0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x07, 0x00, 0x08, 0x00,
+  0x09, 0x00, 0xe4, 0x34, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0xe4,
+  0x45, 0x00, 0x53, 0x26, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x01,
+  0xed, 0x00, 0x01, 0xed, 0x00, 0x80, 0x02, 0x6c, 0x73, 0x00, 0x01, 0x7d,
+  0x00, 0xe4, 0x3f, 0x03, 0x6c, 0x61, 0x62, 0x80, 0x00, 0x00, 0x80, 0x01,
+  0x7a, 0x00, 0x45, 0x42, 0x00, 0x40, 0x61, 0x1a, 0x01, 0x02, 0x03, 0x00,
+  0x04, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x07, 0x08, 0x09, 0x00, 0x0a,
+  0x00, 0x0b, 0x0c, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x01,
+  0xed, 0x00, 0xe4, 0x94, 0x00, 0xe4, 0xa2, 0x00, 0xe4, 0xa9, 0x00, 0xe4,
+  0xaf, 0x00, 0xe4, 0xb6, 0x00, 0x01, 0xed, 0x00, 0xe5, 0x0d, 0x00, 0xe5,
+  0x33, 0x00, 0x01, 0xed, 0x00, 0xe5, 0xff, 0x00, 0xe6, 0x3b, 0x00, 0xe6,
+  0x57, 0x00, 0xe6, 0x96, 0x00, 0x80, 0x01, 0x72, 0x00, 0xe4, 0x9b, 0x04,
+  0x65, 0x74, 0x69, 0x76, 0x80, 0x00, 0x00, 0x80, 0x01, 0x63, 0x00, 0x1f,
+  0x1f, 0x03, 0x6e, 0x75, 0x63, 0x80, 0x00, 0x00, 0x80, 0x01, 0x69, 0x00,
+  0x06, 0xa7, 0x00, 0x00, 0x03, 0x64, 0x70, 0x72, 0x00, 0xe4, 0xc5, 0x00,
+  0xe4, 0xe9, 0x00, 0xe5, 0x06, 0x02, 0x65, 0x6d, 0x00, 0x02, 0x2d, 0x6f,
+  0x00, 0xe4, 0xd2, 0x00, 0xe4, 0xde, 0x09, 0x6f, 0x6e, 0x61, 0x64, 0x69,
+  0x70, 0x6d, 0x61, 0x63, 0x80, 0x00, 0x08, 0x6e, 0x61, 0x64, 0x69, 0x70,
+  0x6d, 0x61, 0x63, 0x80, 0x00, 0x03, 0x6d, 0x65, 0x74, 0x00, 0x02, 0x2d,
+  0x61, 0x00, 0xe4, 0xf7, 0x00, 0xe4, 0xff, 0x05, 0x61, 0x69, 0x62, 0x6c,
+  0x6f, 0x80, 0x00, 0x04, 0x69, 0x62, 0x6c, 0x6f, 0x80, 0x00, 0x04, 0x64,
+  0x6e, 0x6f, 0x73, 0x80, 0x00, 0x00, 0x80, 0x03, 0x61, 0x6f, 0x72, 0x00,
+  0xe5, 0x1c, 0x00, 0x01, 0x87, 0x00, 0xe5, 0x27, 0x00, 0x00, 0x02, 0x67,
+  0x72, 0x00, 0x43, 0x47, 0x00, 0x1a, 0x51, 0x01, 0x65, 0x00, 0x02, 0x66,
+  0x6c, 0x00, 0x01, 0xed, 0x00, 0x36, 0x49, 0x00, 0x80, 0x05, 0x61, 0x65,
+  0x69, 0x72, 0x75, 0x00, 0xe5, 0x4a, 0x00, 0xe5, 0x89, 0x00, 0xe5, 0xa8,
+  0x00, 0xe5, 0xe7, 0x00, 0xe5, 0xf8, 0x00, 0x00, 0x04, 0x64, 0x6c, 0x74,
+  0x7a, 0x00, 0xe5, 0x5d, 0x00, 0x01, 0x7d, 0x00, 0xe5, 0x7c, 0x00, 0xe5,
+  0x83, 0x05, 0x69, 0x70, 0x6d, 0x61, 0x63, 0x00, 0x02, 0x2d, 0x6f, 0x00,
+  0xe5, 0x6d, 0x00, 0xe5, 0x75, 0x05, 0x6f, 0x69, 0x64, 0x65, 0x6d, 0x80,
+  0x00, 0x04, 0x69, 0x64, 0x65, 0x6d, 0x80, 0x00, 0x04, 0x73, 0x69, 0x72,
+  0x6f, 0x80, 0x00, 0x03, 0x6c, 0x6f, 0x62, 0x80, 0x00, 0x03, 0x63, 0x69,
+  0x70, 0x00, 0x02, 0x2d, 0x69, 0x00, 0xe5, 0x97, 0x00, 0xe5, 0xa0, 0x06,
+  0x69, 0x6c, 0x6f, 0x63, 0x73, 0x61, 0x80, 0x00, 0x05, 0x6c, 0x6f, 0x63,
+  0x73, 0x61, 0x80, 0x00, 0x00, 0x00, 0x04, 0x62, 0x6c, 0x72, 0x74, 0x00,
+  0xe5, 0xbb, 0x00, 0xe5, 0xd9, 0x00, 0x3d, 0xa3, 0x00, 0xe5, 0xe0, 0x02,
+  0x72, 0x75, 0x00, 0x02, 0x2d, 0x6f, 0x00, 0xe5, 0xc8, 0x00, 0xe5, 0xd1,
+  0x06, 0x6f, 0x72, 0x61, 0x73, 0x65, 0x70, 0x80, 0x00, 0x05, 0x72, 0x61,
+  0x73, 0x65, 0x70, 0x80, 0x00, 0x04, 0x6c, 0x65, 0x76, 0x61, 0x80, 0x00,
+  0x04, 0x6e, 0x65, 0x72, 0x74, 0x80, 0x00, 0x00, 0x00, 0x02, 0x65, 0x6f,
+  0x00, 0x3d, 0x4d, 0x00, 0xe5, 0xf2, 0x03, 0x76, 0x69, 0x6c, 0x80, 0x00,
+  0x04, 0x6c, 0x6c, 0x65, 0x62, 0x80, 0x00, 0x00, 0x80, 0x02, 0x61, 0x6f,
+  0x00, 0xe6, 0x0a, 0x00, 0x3c, 0xce, 0x00, 0x00, 0x02, 0x73, 0x7a, 0x00,
+  0xe6, 0x15, 0x00, 0xe6, 0x33, 0x02, 0x65, 0x70, 0x00, 0x02, 0x2d, 0x6f,
+  0x00, 0xe6, 0x22, 0x00, 0xe6, 0x2b, 0x06, 0x6f, 0x6e, 0x69, 0x62, 0x72,
+  0x75, 0x80, 0x00, 0x05, 0x6e, 0x69, 0x62, 0x72, 0x75, 0x80, 0x00, 0x05,
+  0x6e, 0x61, 0x74, 0x61, 0x63, 0x80, 0x00, 0x00, 0x80, 0x02, 0x69, 0x73,
+  0x00, 0xe6, 0x46, 0x00, 0xe6, 0x4d, 0x04, 0x76, 0x65, 0x72, 0x74, 0x80,
+  0x00, 0x07, 0x61, 0x62, 0x6f, 0x70, 0x6d, 0x61, 0x63, 0x80, 0x00, 0x00,
+  0x80, 0x03, 0x61, 0x65, 0x6e, 0x00, 0x0d, 0x7a, 0x00, 0xe6, 0x66, 0x00,
+  0xe6, 0x6e, 0x05, 0x73, 0x73, 0x6f, 0x72, 0x67, 0x80, 0x00, 0x00, 0x00,
+  0x02, 0x61, 0x65, 0x00, 0x22, 0x10, 0x00, 0xe6, 0x79, 0x00, 0x00, 0x03,
+  0x67, 0x72, 0x76, 0x00, 0xe6, 0x88, 0x00, 0x03, 0x3c, 0x00, 0xe6, 0x8f,
+  0x04, 0x69, 0x72, 0x67, 0x61, 0x80, 0x00, 0x04, 0x65, 0x6e, 0x65, 0x62,
+  0x80, 0x00, 0x04, 0x7a, 0x65, 0x72, 0x61, 0x80, 0x00, 0x00, 0x00, 0x03,
+  0x61, 0x73, 0x74, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed,
+  0x00, 0x40, 0x61, 0x16, 0x01, 0x02, 0x03, 0x00, 0x00, 0x04, 0x05, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x08, 0x00, 0x00, 0x09, 0x0a,
+  0x00, 0x0b, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00,
+  0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00,
+  0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00,
+  0x40, 0x61, 0x16, 0x01, 0x02, 0x03, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05,
+  0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x00,
+  0x09, 0x00, 0xe7, 0x1c, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0xe7,
+  0x42, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x01,
+  0xed, 0x00, 0x01, 0xed, 0x06, 0x69, 0x73, 0x65, 0x6c, 0x67, 0x69, 0x00,
+  0x02, 0x2d, 0x61, 0x00, 0xe7, 0x2d, 0x00, 0xe7, 0x38, 0x08, 0x61, 0x69,
+  0x6e, 0x6f, 0x62, 0x72, 0x61, 0x63, 0x80, 0x00, 0x07, 0x69, 0x6e, 0x6f,
+  0x62, 0x72, 0x61, 0x63, 0x80, 0x00, 0x04, 0x6c, 0x70, 0x61, 0x6e, 0x80,
+  0x00, 0x00, 0x40, 0x61, 0x16, 0x01, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 0x06, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed,
+  0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0xe7, 0x7b, 0x00, 0x01, 0xed,
+  0x00, 0x01, 0xed, 0x00, 0x80, 0x01, 0x70, 0x00, 0x78, 0xe9, 0x00, 0x00,
+  0x04, 0x64, 0x6c, 0x6e, 0x70, 0x00, 0x22, 0x81, 0x00, 0x01, 0xed, 0x00,
+  0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x00, 0x06, 0x61, 0x6f, 0x70, 0x73,
+  0x74, 0x76, 0x00, 0x01, 0xed, 0x00, 0x0b, 0xb4, 0x00, 0x01, 0xed, 0x00,
+  0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x00, 0x03, 0x62,
+  0x63, 0x70, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x01,
+  0x69, 0x80, 0x01, 0x2e, 0x00, 0x12, 0xac, 0x00, 0x80, 0x01, 0x2e, 0x00,
+  0xe7, 0xce, 0x00, 0x00, 0x07, 0x65, 0x67, 0x6c, 0x6d, 0x74, 0x75, 0x76,
+  0x00, 0x0b, 0x07, 0x00, 0x01, 0x72, 0x00, 0x37, 0x4f, 0x00, 0x01, 0x82,
+  0x00, 0xe7, 0xed, 0x00, 0x01, 0x94, 0x00, 0x01, 0x99, 0x00, 0x00, 0x03,
+  0x65, 0x6e, 0x6f, 0x00, 0x02, 0x03, 0x00, 0x02, 0x83, 0x00, 0x02, 0x25,
+  0x00, 0x80, 0x02, 0x2e, 0x6f, 0x00, 0xe8, 0x07, 0x00, 0x01, 0xff, 0x00,
+  0x40, 0x61, 0x16, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08,
+  0x09, 0x00, 0xe8, 0x3c, 0x00, 0xe8, 0x47, 0x00, 0x01, 0x72, 0x00, 0x01,
+  0x7d, 0x00, 0x01, 0x82, 0x00, 0xe8, 0x6d, 0x00, 0x01, 0x8f, 0x00, 0x01,
+  0x94, 0x00, 0x01, 0x99, 0x08, 0x64, 0x61, 0x78, 0x69, 0x61, 0x62, 0x6d,
+  0x65, 0x80, 0x00, 0x00, 0x00, 0x03, 0x6d, 0x70, 0x72, 0x00, 0xe8, 0x56,
+  0x00, 0xe8, 0x5e, 0x00, 0xe8, 0x67, 0x05, 0x6f, 0x74, 0x6f, 0x61, 0x73,
+  0x80, 0x00, 0x06, 0x69, 0x63, 0x6e, 0x69, 0x72, 0x70, 0x80, 0x00, 0x03,
+  0x6f, 0x74, 0x73, 0x80, 0x00, 0x00, 0x00, 0x02, 0x63, 0x64, 0x00, 0x01,
+  0xed, 0x00, 0xe8, 0x78, 0x07, 0x61, 0x6c, 0x75, 0x73, 0x6e, 0x6f, 0x63,
+  0x80, 0x00, 0x00, 0x80, 0x01, 0x2e, 0x00, 0xe8, 0x89, 0x00, 0x40, 0x65,
+  0x16, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x04, 0x05, 0x00, 0x06,
+  0x07, 0x00, 0x00, 0x08, 0x09, 0x0a, 0x0b, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x02, 0xfe, 0x00, 0x01, 0x72, 0x00, 0x03, 0x04, 0x00, 0xe8, 0xc7, 0x00,
+  0xe8, 0xcf, 0x00, 0xe8, 0xe1, 0x00, 0x27, 0xf2, 0x00, 0xad, 0x70, 0x00,
+  0x02, 0x78, 0x00, 0x01, 0x94, 0x00, 0x01, 0x99, 0x00, 0x08, 0x0c, 0x05,
+  0x65, 0x76, 0x61, 0x72, 0x74, 0x80, 0x00, 0x00, 0x00, 0x02, 0x6f, 0x75,
+  0x00, 0x01, 0x87, 0x00, 0xe8, 0xda, 0x04, 0x65, 0x73, 0x75, 0x6d, 0x80,
+  0x00, 0x00, 0x00, 0x03, 0x63, 0x66, 0x72, 0x00, 0x01, 0xed, 0x00, 0x03,
+  0x21, 0x00, 0xe8, 0xf0, 0x00, 0x00, 0x02, 0x65, 0x70, 0x00, 0x02, 0xa9,
+  0x00, 0x01, 0xed, 0x00, 0x40, 0x61, 0x16, 0x01, 0x00, 0x02, 0x03, 0x04,
+  0x00, 0x05, 0x06, 0x00, 0x00, 0x00, 0x07, 0x08, 0x09, 0x00, 0x00, 0x00,
+  0x0a, 0x0b, 0x00, 0x00, 0x0c, 0x00, 0xe9, 0x39, 0x00, 0xea, 0x0f, 0x00,
+  0x22, 0x81, 0x00, 0x01, 0xed, 0x00, 0x07, 0xba, 0x00, 0xea, 0x31, 0x00,
+  0x01, 0xed, 0x00, 0xeb, 0x92, 0x00, 0xeb, 0xb8, 0x00, 0xeb, 0xe8, 0x00,
+  0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x80, 0x01, 0x2e, 0x00, 0xe9, 0x40,
+  0x00, 0x40, 0x61, 0x1a, 0x01, 0x00, 0x02, 0x03, 0x00, 0x04, 0x05, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x07, 0x08, 0x00, 0x00, 0x00, 0x09, 0x0a,
+  0x0b, 0x0c, 0x0d, 0x00, 0x00, 0x0e, 0x00, 0xe9, 0x88, 0x00, 0x3c, 0x78,
+  0x00, 0xe9, 0x93, 0x00, 0x4b, 0xcf, 0x00, 0x01, 0x72, 0x00, 0xe9, 0x9e,
+  0x00, 0x02, 0x2e, 0x00, 0x02, 0x6d, 0x00, 0x81, 0x96, 0x00, 0xe9, 0xa7,
+  0x00, 0xe9, 0xb6, 0x00, 0xe9, 0xef, 0x00, 0xe9, 0xea, 0x00, 0x02, 0x12,
+  0x00, 0x00, 0x02, 0x73, 0x77, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00,
+  0x00, 0x02, 0x69, 0x6c, 0x00, 0x01, 0xed, 0x00, 0xd2, 0x0a, 0x02, 0x6f,
+  0x63, 0x80, 0x01, 0x2e, 0x00, 0x0b, 0xbf, 0x00, 0x00, 0x03, 0x63, 0x65,
+  0x6e, 0x00, 0x02, 0xa9, 0x00, 0x02, 0x03, 0x00, 0x01, 0xed, 0x02, 0x64,
+  0x65, 0x80, 0x01, 0x2e, 0x00, 0xe9, 0xbf, 0x00, 0x00, 0x06, 0x61, 0x63,
+  0x64, 0x73, 0x74, 0x77, 0x00, 0xe9, 0x88, 0x00, 0x3c, 0x78, 0x00, 0xe9,
+  0xda, 0x00, 0x81, 0x96, 0x00, 0xe9, 0xdf, 0x00, 0xe9, 0xea, 0x02, 0x6c,
+  0x71, 0x80, 0x00, 0x00, 0x00, 0x02, 0x63, 0x6e, 0x00, 0x02, 0xa9, 0x00,
+  0x01, 0xed, 0x02, 0x73, 0x6e, 0x80, 0x00, 0x02, 0x6f, 0x67, 0x80, 0x01,
+  0x2e, 0x00, 0xe9, 0xf8, 0x00, 0x00, 0x05, 0x61, 0x63, 0x64, 0x73, 0x74,
+  0x00, 0xe9, 0x88, 0x00, 0x3c, 0x78, 0x00, 0xe9, 0xda, 0x00, 0x81, 0x96,
+  0x00, 0xe9, 0xdf, 0x00, 0x80, 0x01, 0x2e, 0x00, 0xea, 0x16, 0x00, 0x00,
+  0x06, 0x66, 0x67, 0x6d, 0x74, 0x75, 0x76, 0x00, 0x03, 0x21, 0x00, 0x01,
+  0x72, 0x00, 0x01, 0x82, 0x00, 0x01, 0x8f, 0x00, 0x01, 0x94, 0x00, 0x01,
+  0x99, 0x00, 0x80, 0x01, 0x2e, 0x00, 0xea, 0x38, 0x00, 0x40, 0x30, 0x4b,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00,
+  0x06, 0x07, 0x08, 0x09, 0x0a, 0x00, 0x0b, 0x0c, 0x0d, 0x00, 0x0e, 0x00,
+  0x0f, 0x10, 0x11, 0x00, 0xea, 0xba, 0x00, 0xea, 0xc0, 0x00, 0xea, 0xd7,
+  0x00, 0x01, 0x72, 0x00, 0xea, 0xdf, 0x00, 0x1c, 0x2f, 0x00, 0xea, 0xe5,
+  0x00, 0xea, 0xff, 0x00, 0xeb, 0x09, 0x00, 0x8a, 0xf9, 0x00, 0xeb, 0x36,
+  0x00, 0xeb, 0x3d, 0x00, 0xeb, 0x5d, 0x00, 0xeb, 0x72, 0x00, 0xeb, 0x78,
+  0x00, 0xeb, 0x84, 0x00, 0xeb, 0x8a, 0x03, 0x30, 0x30, 0x32, 0x80, 0x00,
+  0x00, 0x00, 0x03, 0x63, 0x69, 0x6b, 0x00, 0xea, 0xcf, 0x00, 0x7b, 0xa6,
+  0x00, 0xea, 0xcf, 0x05, 0x69, 0x74, 0x6f, 0x72, 0x65, 0x80, 0x00, 0x05,
+  0x64, 0x73, 0x7a, 0x6f, 0x74, 0x80, 0x00, 0x03, 0x6c, 0x75, 0x73, 0x80,
+  0x00, 0x00, 0x00, 0x04, 0x61, 0x6c, 0x74, 0x75, 0x00, 0xea, 0xf8, 0x00,
+  0x0a, 0x0e, 0x00, 0x01, 0xed, 0x00, 0x36, 0x23, 0x04, 0x6c, 0x6b, 0x65,
+  0x72, 0x80, 0x00, 0x07, 0x61, 0x6c, 0x74, 0x61, 0x67, 0x6e, 0x69, 0x80,
+  0x00, 0x00, 0x00, 0x05, 0x63, 0x65, 0x66, 0x6c, 0x6e, 0x00, 0x01, 0xed,
+  0x00, 0xeb, 0x20, 0x00, 0x03, 0x21, 0x00, 0xeb, 0x26, 0x00, 0xeb, 0x2f,
+  0x03, 0x64, 0x69, 0x76, 0x80, 0x00, 0x06, 0x65, 0x76, 0x79, 0x6e, 0x6f,
+  0x6b, 0x80, 0x00, 0x04, 0x69, 0x73, 0x61, 0x63, 0x80, 0x00, 0x04, 0x61,
+  0x72, 0x67, 0x61, 0x80, 0x00, 0x00, 0x00, 0x03, 0x61, 0x65, 0x77, 0x00,
+  0xeb, 0x4c, 0x00, 0xeb, 0x57, 0x00, 0x01, 0x8f, 0x00, 0x00, 0x02, 0x6b,
+  0x7a, 0x00, 0x26, 0x72, 0x00, 0xa4, 0xac, 0x03, 0x6d, 0x61, 0x67, 0x80,
+  0x00, 0x00, 0x00, 0x03, 0x6c, 0x6f, 0x72, 0x00, 0x45, 0x42, 0x00, 0x02,
+  0x25, 0x00, 0xeb, 0x6c, 0x03, 0x6f, 0x70, 0x73, 0x80, 0x00, 0x03, 0x69,
+  0x72, 0x70, 0x80, 0x00, 0x01, 0x65, 0x00, 0x02, 0x73, 0x7a, 0x00, 0x01,
+  0xed, 0x00, 0x03, 0x8e, 0x03, 0x74, 0x69, 0x63, 0x80, 0x00, 0x05, 0x73,
+  0x61, 0x67, 0x6f, 0x6a, 0x80, 0x00, 0x00, 0x80, 0x01, 0x2e, 0x00, 0xeb,
+  0x99, 0x00, 0x00, 0x07, 0x63, 0x67, 0x6d, 0x6f, 0x72, 0x74, 0x76, 0x00,
+  0x02, 0xa9, 0x00, 0x01, 0x72, 0x00, 0x01, 0x82, 0x00, 0x01, 0x87, 0x00,
+  0x02, 0x12, 0x00, 0x01, 0x8f, 0x00, 0x01, 0x99, 0x00, 0x80, 0x01, 0x2e,
+  0x00, 0xeb, 0xbf, 0x00, 0x00, 0x02, 0x65, 0x74, 0x00, 0xeb, 0xca, 0x00,
+  0xeb, 0xde, 0x02, 0x6e, 0x69, 0x00, 0x02, 0x65, 0x6d, 0x00, 0xeb, 0xd7,
+  0x00, 0x02, 0x6a, 0x04, 0x73, 0x72, 0x65, 0x6d, 0x84, 0x00, 0x07, 0x65,
+  0x6e, 0x6b, 0x63, 0x61, 0x68, 0x73, 0x84, 0x00, 0x00, 0x80, 0x01, 0x2e,
+  0x00, 0xeb, 0xef, 0x00, 0x40, 0x61, 0x1a, 0x01, 0x02, 0x03, 0x04, 0x05,
+  0x00, 0x06, 0x07, 0x08, 0x00, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x00,
+  0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x00, 0x15, 0x16, 0x00, 0xec, 0x4f,
+  0x00, 0xed, 0x93, 0x00, 0x02, 0xa9, 0x00, 0xed, 0x98, 0x00, 0xed, 0xc4,
+  0x00, 0xed, 0xdf, 0x00, 0xee, 0x2c, 0x00, 0xee, 0x36, 0x00, 0xee, 0x5d,
+  0x00, 0xef, 0xa1, 0x00, 0xf0, 0x02, 0x00, 0xf0, 0x1c, 0x00, 0xf0, 0xa0,
+  0x00, 0x01, 0xff, 0x00, 0xf0, 0xba, 0x00, 0xf0, 0xee, 0x00, 0xf1, 0x0b,
+  0x00, 0x01, 0x94, 0x00, 0xf1, 0x37, 0x00, 0xf1, 0x74, 0x00, 0xf1, 0x79,
+  0x00, 0xf1, 0x81, 0x00, 0x40, 0x64, 0x17, 0x01, 0x00, 0x00, 0x02, 0x00,
+  0x03, 0x00, 0x04, 0x05, 0x06, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x09,
+  0x00, 0x0a, 0x00, 0x00, 0x0b, 0x0c, 0x00, 0xec, 0x8e, 0x00, 0xec, 0x96,
+  0x00, 0xec, 0x9d, 0x00, 0xed, 0x0b, 0x00, 0xed, 0x58, 0x00, 0xed, 0x6e,
+  0x00, 0xed, 0x77, 0x00, 0xed, 0x7e, 0x00, 0x46, 0x4e, 0x00, 0x22, 0x6c,
+  0x00, 0xed, 0x85, 0x00, 0xed, 0x8d, 0x05, 0x67, 0x6f, 0x6c, 0x6f, 0x76,
+  0x80, 0x00, 0x04, 0x75, 0x6c, 0x61, 0x6b, 0x80, 0x00, 0x00, 0x00, 0x07,
+  0x68, 0x6b, 0x6c, 0x72, 0x73, 0x74, 0x76, 0x00, 0xec, 0xbc, 0x00, 0xec,
+  0xc5, 0x00, 0xec, 0xcd, 0x00, 0xec, 0xd4, 0x00, 0xec, 0xdd, 0x00, 0xec,
+  0xe6, 0x00, 0xed, 0x03, 0x06, 0x73, 0x61, 0x76, 0x75, 0x68, 0x63, 0x80,
+  0x00, 0x05, 0x79, 0x6d, 0x6c, 0x61, 0x6b, 0x80, 0x00, 0x04, 0x65, 0x72,
+  0x61, 0x6b, 0x80, 0x00, 0x06, 0x69, 0x6b, 0x68, 0x73, 0x61, 0x62, 0x80,
+  0x00, 0x06, 0x73, 0x61, 0x6b, 0x61, 0x68, 0x6b, 0x80, 0x00, 0x00, 0x00,
+  0x03, 0x61, 0x72, 0x75, 0x00, 0xec, 0xf5, 0x00, 0xec, 0xfc, 0x00, 0xc2,
+  0x50, 0x04, 0x79, 0x72, 0x75, 0x62, 0x80, 0x00, 0x04, 0x75, 0x6d, 0x64,
+  0x75, 0x80, 0x00, 0x05, 0x6f, 0x64, 0x72, 0x6f, 0x6d, 0x80, 0x00, 0x00,
+  0x00, 0x03, 0x64, 0x6e, 0x74, 0x00, 0xed, 0x1a, 0x00, 0xed, 0x22, 0x00,
+  0xed, 0x29, 0x05, 0x6f, 0x68, 0x6b, 0x61, 0x6e, 0x80, 0x00, 0x04, 0x69,
+  0x64, 0x75, 0x64, 0x80, 0x00, 0x00, 0x00, 0x03, 0x61, 0x69, 0x6f, 0x00,
+  0xed, 0x38, 0x00, 0xed, 0x4a, 0x00, 0xed, 0x51, 0x00, 0x00, 0x02, 0x68,
+  0x79, 0x00, 0xed, 0x43, 0x00, 0x59, 0xcd, 0x04, 0x63, 0x6d, 0x61, 0x6b,
+  0x80, 0x00, 0x04, 0x6e, 0x67, 0x61, 0x6d, 0x80, 0x00, 0x04, 0x6b, 0x75,
+  0x68, 0x63, 0x80, 0x00, 0x00, 0x00, 0x02, 0x6f, 0x75, 0x00, 0xed, 0x63,
+  0x00, 0x03, 0x3c, 0x08, 0x2d, 0x72, 0x61, 0x6b, 0x68, 0x73, 0x6f, 0x6a,
+  0x80, 0x00, 0x06, 0x6f, 0x72, 0x74, 0x73, 0x6f, 0x6b, 0x80, 0x00, 0x04,
+  0x61, 0x6c, 0x61, 0x70, 0x80, 0x00, 0x04, 0x61, 0x6d, 0x61, 0x73, 0x80,
+  0x00, 0x05, 0x65, 0x67, 0x79, 0x64, 0x61, 0x80, 0x00, 0x03, 0x6e, 0x65,
+  0x70, 0x80, 0x00, 0x02, 0x70, 0x73, 0x80, 0x00, 0x00, 0x00, 0x03, 0x61,
+  0x6e, 0x6f, 0x00, 0xed, 0xa7, 0x00, 0x01, 0x8b, 0x00, 0xed, 0xbb, 0x02,
+  0x72, 0x67, 0x00, 0x02, 0x6f, 0x7a, 0x00, 0xed, 0xb4, 0x00, 0x01, 0xed,
+  0x04, 0x67, 0x6c, 0x6f, 0x76, 0x80, 0x00, 0x06, 0x72, 0x6f, 0x67, 0x6c,
+  0x65, 0x62, 0x80, 0x00, 0x00, 0x00, 0x02, 0x64, 0x6e, 0x00, 0xed, 0xcf,
+  0x00, 0xed, 0xd8, 0x06, 0x75, 0x2d, 0x6e, 0x61, 0x6c, 0x75, 0x80, 0x00,
+  0x04, 0x69, 0x72, 0x61, 0x6d, 0x80, 0x00, 0x00, 0x00, 0x04, 0x62, 0x65,
+  0x69, 0x72, 0x00, 0x01, 0x87, 0x00, 0xed, 0xf2, 0x00, 0xed, 0xf9, 0x00,
+  0xee, 0x00, 0x04, 0x72, 0x73, 0x6f, 0x6d, 0x80, 0x00, 0x04, 0x6e, 0x65,
+  0x6f, 0x6b, 0x80, 0x00, 0x00, 0x00, 0x02, 0x6f, 0x75, 0x00, 0x01, 0xed,
+  0x00, 0xee, 0x0b, 0x01, 0x62, 0x00, 0x02, 0x2d, 0x6e, 0x00, 0x22, 0x81,
+  0x00, 0xee, 0x17, 0x00, 0x00, 0x02, 0x65, 0x69, 0x00, 0x01, 0x72, 0x00,
+  0xee, 0x22, 0x07, 0x72, 0x65, 0x74, 0x61, 0x6b, 0x65, 0x79, 0x80, 0x00,
+  0x07, 0x7a, 0x65, 0x6e, 0x6f, 0x72, 0x6f, 0x76, 0x80, 0x00, 0x00, 0x00,
+  0x03, 0x61, 0x6d, 0x72, 0x00, 0xee, 0x45, 0x00, 0x22, 0x0b, 0x00, 0x22,
+  0xab, 0x00, 0x00, 0x02, 0x6e, 0x74, 0x00, 0xee, 0x50, 0x00, 0xee, 0x58,
+  0x05, 0x61, 0x74, 0x73, 0x75, 0x6b, 0x80, 0x00, 0x02, 0x6c, 0x61, 0x80,
+  0x00, 0x00, 0x00, 0x03, 0x69, 0x6f, 0x73, 0x00, 0xee, 0x6c, 0x00, 0xee,
+  0x74, 0x00, 0xee, 0x80, 0x05, 0x68, 0x63, 0x6c, 0x61, 0x6e, 0x80, 0x00,
+  0x09, 0x74, 0x73, 0x6f, 0x76, 0x69, 0x64, 0x61, 0x6c, 0x76, 0x80, 0x00,
+  0x00, 0x00, 0x06, 0x6c, 0x6d, 0x6e, 0x72, 0x74, 0x76, 0x00, 0xee, 0x9b,
+  0x00, 0xee, 0xbb, 0x00, 0xee, 0xc2, 0x00, 0xef, 0x15, 0x00, 0xef, 0x5f,
+  0x00, 0xef, 0x76, 0x00, 0x00, 0x03, 0x61, 0x65, 0x69, 0x00, 0xee, 0xaa,
+  0x00, 0xee, 0xb1, 0x00, 0x5f, 0x38, 0x04, 0x72, 0x75, 0x2d, 0x6b, 0x80,
+  0x00, 0x07, 0x67, 0x6e, 0x61, 0x68, 0x6b, 0x72, 0x61, 0x80, 0x00, 0x00,
+  0x80, 0x01, 0x6f, 0x00, 0x0f, 0x63, 0x00, 0x80, 0x04, 0x61, 0x65, 0x69,
+  0x6f, 0x00, 0xee, 0xd5, 0x00, 0xee, 0xe6, 0x00, 0xee, 0xed, 0x00, 0xef,
+  0x10, 0x00, 0x00, 0x02, 0x6d, 0x79, 0x00, 0xee, 0xe0, 0x00, 0x0f, 0x28,
+  0x03, 0x72, 0x75, 0x6d, 0x80, 0x00, 0x04, 0x6c, 0x6f, 0x6d, 0x73, 0x80,
+  0x00, 0x00, 0x00, 0x02, 0x62, 0x6c, 0x00, 0xee, 0xf8, 0x00, 0xef, 0x01,
+  0x06, 0x61, 0x79, 0x6c, 0x65, 0x68, 0x63, 0x80, 0x00, 0x0c, 0x61, 0x68,
+  0x6b, 0x61, 0x73, 0x2d, 0x6f, 0x6e, 0x68, 0x7a, 0x75, 0x79, 0x80, 0x00,
+  0x02, 0x64, 0x76, 0x80, 0x00, 0x00, 0x00, 0x04, 0x61, 0x69, 0x6f, 0x75,
+  0x00, 0xef, 0x28, 0x00, 0xef, 0x32, 0x00, 0xef, 0x4b, 0x00, 0xef, 0x54,
+  0x07, 0x79, 0x6f, 0x6e, 0x73, 0x61, 0x72, 0x6b, 0x80, 0x00, 0x01, 0x62,
+  0x00, 0x02, 0x69, 0x6d, 0x00, 0xef, 0x3e, 0x00, 0xef, 0x46, 0x05, 0x73,
+  0x6f, 0x76, 0x6f, 0x6e, 0x80, 0x00, 0x02, 0x69, 0x73, 0x80, 0x00, 0x06,
+  0x67, 0x69, 0x74, 0x61, 0x79, 0x70, 0x80, 0x00, 0x00, 0x00, 0x02, 0x6b,
+  0x6d, 0x00, 0x01, 0xed, 0x00, 0x02, 0xa9, 0x00, 0x80, 0x02, 0x65, 0x75,
+  0x00, 0xef, 0x6a, 0x00, 0xef, 0x70, 0x03, 0x70, 0x69, 0x6c, 0x80, 0x00,
+  0x03, 0x6b, 0x72, 0x69, 0x80, 0x00, 0x00, 0x00, 0x02, 0x65, 0x6f, 0x00,
+  0xef, 0x81, 0x00, 0xef, 0x87, 0x03, 0x68, 0x7a, 0x69, 0x80, 0x00, 0x00,
+  0x00, 0x02, 0x72, 0x73, 0x00, 0xef, 0x92, 0x00, 0xef, 0x9a, 0x05, 0x61,
+  0x62, 0x61, 0x68, 0x6b, 0x80, 0x00, 0x04, 0x74, 0x62, 0x75, 0x72, 0x80,
+  0x00, 0x00, 0x00, 0x05, 0x61, 0x65, 0x69, 0x6f, 0x76, 0x00, 0xef, 0xb8,
+  0x00, 0xef, 0xd5, 0x00, 0x03, 0x40, 0x00, 0xef, 0xe0, 0x00, 0xef, 0xf8,
+  0x00, 0x00, 0x02, 0x6b, 0x6d, 0x00, 0xef, 0xc3, 0x00, 0xef, 0xc9, 0x03,
+  0x69, 0x61, 0x62, 0x80, 0x00, 0x01, 0x61, 0x00, 0x02, 0x6a, 0x79, 0x00,
+  0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x00, 0x02, 0x2d, 0x68, 0x00, 0xed,
+  0xd8, 0x00, 0x01, 0x87, 0x00, 0x00, 0x03, 0x6b, 0x70, 0x79, 0x00, 0xba,
+  0x29, 0x00, 0xef, 0xef, 0x00, 0x01, 0x72, 0x06, 0x6f, 0x72, 0x76, 0x61,
+  0x74, 0x73, 0x80, 0x00, 0x07, 0x61, 0x6c, 0x73, 0x6f, 0x72, 0x61, 0x79,
+  0x80, 0x00, 0x00, 0x00, 0x03, 0x64, 0x6f, 0x72, 0x00, 0x07, 0xb6, 0x00,
+  0xf0, 0x11, 0x00, 0x02, 0x73, 0x00, 0x00, 0x02, 0x63, 0x74, 0x00, 0x01,
+  0xed, 0x00, 0x01, 0xed, 0x00, 0x00, 0x05, 0x61, 0x65, 0x69, 0x72, 0x79,
+  0x00, 0xf0, 0x33, 0x00, 0xf0, 0x86, 0x00, 0xf0, 0x8d, 0x00, 0x59, 0xcd,
+  0x00, 0xf0, 0x96, 0x00, 0x00, 0x07, 0x62, 0x64, 0x67, 0x68, 0x72, 0x74,
+  0x7a, 0x00, 0x4c, 0xd6, 0x00, 0x7c, 0x82, 0x00, 0x8a, 0xc2, 0x00, 0xf0,
+  0x52, 0x00, 0xf0, 0x5b, 0x00, 0xf0, 0x61, 0x00, 0xf0, 0x7a, 0x06, 0x6b,
+  0x61, 0x72, 0x74, 0x73, 0x61, 0x80, 0x00, 0x03, 0x7a, 0x79, 0x73, 0x80,
+  0x00, 0x01, 0x73, 0x00, 0x02, 0x65, 0x72, 0x00, 0xf0, 0x6d, 0x00, 0xf0,
+  0x73, 0x03, 0x67, 0x61, 0x64, 0x80, 0x00, 0x04, 0x61, 0x74, 0x61, 0x74,
+  0x80, 0x00, 0x01, 0x61, 0x00, 0x02, 0x6b, 0x79, 0x00, 0x01, 0xed, 0x00,
+  0x01, 0x8b, 0x04, 0x6d, 0x75, 0x79, 0x74, 0x80, 0x00, 0x06, 0x6c, 0x61,
+  0x68, 0x6b, 0x61, 0x73, 0x80, 0x00, 0x07, 0x73, 0x74, 0x69, 0x72, 0x61,
+  0x73, 0x74, 0x80, 0x00, 0x02, 0x76, 0x6f, 0x00, 0x02, 0x6e, 0x72, 0x00,
+  0xf0, 0xad, 0x00, 0xf0, 0xb3, 0x03, 0x61, 0x76, 0x69, 0x80, 0x00, 0x04,
+  0x65, 0x6d, 0x65, 0x6b, 0x80, 0x00, 0x00, 0x00, 0x05, 0x61, 0x65, 0x68,
+  0x69, 0x75, 0x00, 0x3e, 0xd7, 0x00, 0xf0, 0xd1, 0x00, 0xf0, 0xd6, 0x00,
+  0xf0, 0xdb, 0x00, 0x6c, 0xcb, 0x02, 0x76, 0x74, 0x80, 0x00, 0x02, 0x63,
+  0x6b, 0x80, 0x00, 0x00, 0x00, 0x02, 0x62, 0x6d, 0x00, 0x01, 0xed, 0x00,
+  0xf0, 0xe6, 0x05, 0x69, 0x64, 0x61, 0x6c, 0x76, 0x80, 0x00, 0x00, 0x00,
+  0x03, 0x69, 0x6d, 0x73, 0x00, 0xf0, 0xfd, 0x00, 0x05, 0x9d, 0x00, 0xf1,
+  0x03, 0x03, 0x74, 0x79, 0x6d, 0x80, 0x00, 0x05, 0x61, 0x62, 0x7a, 0x75,
+  0x6b, 0x80, 0x00, 0x00, 0x00, 0x04, 0x65, 0x6e, 0x73, 0x75, 0x00, 0x02,
+  0x03, 0x00, 0x02, 0x83, 0x00, 0xf1, 0x1e, 0x00, 0xf1, 0x30, 0x00, 0x00,
+  0x02, 0x61, 0x65, 0x00, 0xf1, 0x29, 0x00, 0x03, 0x3c, 0x04, 0x65, 0x72,
+  0x61, 0x66, 0x80, 0x00, 0x04, 0x67, 0x72, 0x75, 0x73, 0x80, 0x00, 0x00,
+  0x00, 0x03, 0x68, 0x6f, 0x74, 0x00, 0x05, 0x9d, 0x00, 0xf1, 0x46, 0x00,
+  0x03, 0x8e, 0x00, 0x00, 0x06, 0x62, 0x67, 0x6b, 0x6e, 0x72, 0x74, 0x00,
+  0x94, 0x20, 0x00, 0x01, 0xed, 0x00, 0xf1, 0x61, 0x00, 0xf1, 0x66, 0x00,
+  0x84, 0x8d, 0x00, 0xf1, 0x6d, 0x02, 0x73, 0x70, 0x80, 0x00, 0x00, 0x80,
+  0x01, 0x6e, 0x00, 0x01, 0xed, 0x04, 0x61, 0x72, 0x61, 0x73, 0x80, 0x00,
+  0x02, 0x6d, 0x63, 0x80, 0x00, 0x05, 0x6e, 0x7a, 0x6f, 0x72, 0x67, 0x80,
+  0x00, 0x00, 0x00, 0x04, 0x61, 0x6b, 0x6e, 0x74, 0x00, 0xf1, 0x94, 0x00,
+  0x02, 0x03, 0x00, 0x03, 0x8e, 0x00, 0x01, 0xff, 0x09, 0x6b, 0x76, 0x61,
+  0x6b, 0x69, 0x64, 0x61, 0x6c, 0x76, 0x80, 0x00, 0x00, 0x00, 0x06, 0x63,
+  0x6c, 0x6d, 0x6f, 0x73, 0x74, 0x00, 0x0b, 0xb8, 0x00, 0xf1, 0xbb, 0x00,
+  0xf1, 0xf4, 0x00, 0x0b, 0xb4, 0x00, 0x07, 0xba, 0x00, 0xf2, 0x3e, 0x00,
+  0x80, 0x01, 0x2e, 0x00, 0xf1, 0xc2, 0x00, 0x40, 0x64, 0x13, 0x01, 0x00,
+  0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x08, 0x09, 0x00, 0x02, 0x83, 0x00, 0x4b, 0xcf, 0x00,
+  0x01, 0x72, 0x00, 0x01, 0x7d, 0x00, 0x01, 0x82, 0x00, 0x02, 0x2e, 0x00,
+  0x01, 0x8f, 0x00, 0x01, 0x94, 0x00, 0x01, 0x99, 0x00, 0x80, 0x01, 0x2e,
+  0x00, 0xf1, 0xfb, 0x00, 0x40, 0x65, 0x16, 0x01, 0x00, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0x04, 0x00, 0x05, 0x06, 0x00, 0x00, 0x00, 0x07, 0x08,
+  0x09, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x02, 0xfe, 0x00, 0x01, 0x72, 0x00,
+  0x01, 0x7d, 0x00, 0xe8, 0xcf, 0x00, 0xf2, 0x33, 0x00, 0x27, 0xf2, 0x00,
+  0x02, 0x78, 0x00, 0x01, 0x94, 0x00, 0x01, 0x99, 0x00, 0x08, 0x0c, 0x00,
+  0x00, 0x02, 0x66, 0x72, 0x00, 0x03, 0x21, 0x00, 0xe8, 0xf0, 0x00, 0x80,
+  0x01, 0x2e, 0x00, 0xf2, 0x45, 0x00, 0x00, 0x03, 0x62, 0x6e, 0x73, 0x00,
+  0xf2, 0x54, 0x00, 0xf2, 0x60, 0x00, 0x2a, 0xfc, 0x09, 0x65, 0x77, 0x2d,
+  0x65, 0x68, 0x74, 0x2d, 0x6e, 0x6f, 0x84, 0x00, 0x04, 0x61, 0x68, 0x74,
+  0x2d, 0x00, 0x02, 0x65, 0x72, 0x00, 0xf2, 0x6f, 0x00, 0xf2, 0x76, 0x04,
+  0x73, 0x72, 0x6f, 0x77, 0x84, 0x00, 0x05, 0x65, 0x74, 0x74, 0x65, 0x62,
+  0x84, 0x00, 0x00, 0x40, 0x61, 0x1a, 0x01, 0x02, 0x03, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x07, 0x00, 0x08,
+  0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0xf2, 0xba, 0x00,
+  0xd7, 0x30, 0x00, 0x50, 0x98, 0x00, 0x01, 0xed, 0x00, 0x07, 0xba, 0x00,
+  0xf2, 0xc7, 0x00, 0xf3, 0x05, 0x00, 0xf3, 0x2a, 0x00, 0xf3, 0x50, 0x00,
+  0x07, 0xba, 0x00, 0x80, 0x01, 0x2e, 0x00, 0xf2, 0xc1, 0x03, 0x6d, 0x6f,
+  0x63, 0x80, 0x00, 0x00, 0x80, 0x01, 0x2e, 0x00, 0xf2, 0xce, 0x00, 0x40,
+  0x63, 0x18, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x06, 0x07, 0x08, 0x00, 0x00,
+  0x00, 0x09, 0x00, 0x02, 0xa9, 0x00, 0x01, 0x72, 0x00, 0xe8, 0xcf, 0x00,
+  0x01, 0x87, 0x00, 0x27, 0xf2, 0x00, 0x02, 0x78, 0x00, 0x01, 0x94, 0x00,
+  0x01, 0x99, 0x00, 0x08, 0x0c, 0x00, 0x80, 0x01, 0x2e, 0x00, 0xf3, 0x0c,
+  0x00, 0x00, 0x05, 0x64, 0x65, 0x6f, 0x72, 0x75, 0x00, 0x22, 0x81, 0x00,
+  0x02, 0x03, 0x00, 0x0b, 0x78, 0x00, 0x02, 0x12, 0x00, 0xf3, 0x23, 0x04,
+  0x61, 0x6c, 0x65, 0x62, 0x80, 0x00, 0x00, 0x80, 0x01, 0x2e, 0x00, 0xf3,
+  0x31, 0x00, 0x00, 0x07, 0x63, 0x6c, 0x6d, 0x6f, 0x74, 0x75, 0x76, 0x00,
+  0x02, 0xa9, 0x00, 0x01, 0x7d, 0x00, 0x01, 0x82, 0x00, 0x01, 0x87, 0x00,
+  0x02, 0x78, 0x00, 0x01, 0x94, 0x00, 0x1e, 0x43, 0x00, 0x80, 0x01, 0x2e,
+  0x00, 0xf3, 0x57, 0x00, 0x40, 0x61, 0x1a, 0x01, 0x02, 0x00, 0x00, 0x03,
+  0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x08, 0x09, 0x00, 0x00, 0x00, 0x0a, 0x00, 0xf3, 0x93,
+  0x00, 0xf3, 0xa1, 0x00, 0xeb, 0x57, 0x00, 0x01, 0x72, 0x00, 0x01, 0x7d,
+  0x00, 0x01, 0x82, 0x00, 0x16, 0x96, 0x00, 0x01, 0x94, 0x00, 0x1b, 0xb8,
+  0x00, 0xa5, 0x14, 0x0b, 0x34, 0x36, 0x6f, 0x61, 0x30, 0x66, 0x7a, 0x2d,
+  0x2d, 0x6e, 0x78, 0x80, 0x00, 0x00, 0x00, 0x02, 0x38, 0x75, 0x00, 0xf3,
+  0xac, 0x00, 0xf3, 0xb8, 0x09, 0x32, 0x77, 0x72, 0x7a, 0x63, 0x2d, 0x2d,
+  0x6e, 0x78, 0x80, 0x00, 0x02, 0x6c, 0x63, 0x80, 0x00, 0x00, 0x00, 0x05,
+  0x61, 0x63, 0x6d, 0x73, 0x78, 0x00, 0x01, 0xed, 0x00, 0xf3, 0xd4, 0x00,
+  0xf3, 0xeb, 0x00, 0x27, 0x05, 0x00, 0xf4, 0x1a, 0x00, 0x80, 0x01, 0x2e,
+  0x00, 0xf3, 0xdb, 0x00, 0x00, 0x02, 0x68, 0x76, 0x00, 0xf3, 0xe6, 0x00,
+  0x01, 0x99, 0x02, 0x74, 0x61, 0x84, 0x00, 0x00, 0x80, 0x02, 0x2e, 0x6d,
+  0x00, 0xf3, 0xf6, 0x00, 0xf4, 0x0d, 0x00, 0x00, 0x05, 0x62, 0x67, 0x6d,
+  0x74, 0x75, 0x00, 0x01, 0x99, 0x00, 0x01, 0x72, 0x00, 0x01, 0x82, 0x00,
+  0x16, 0x96, 0x00, 0x01, 0x94, 0x0a, 0x61, 0x32, 0x69, 0x62, 0x67, 0x79,
+  0x2d, 0x2d, 0x6e, 0x78, 0x80, 0x00, 0x01, 0x78, 0x80, 0x00, 0x00, 0x40,
+  0x62, 0x14, 0x01, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04,
+  0x05, 0x06, 0x00, 0x00, 0x07, 0x00, 0x00, 0x08, 0x00, 0x09, 0x00, 0xf4,
+  0x51, 0x00, 0x07, 0xba, 0x00, 0xf4, 0x6b, 0x00, 0x08, 0x11, 0x00, 0xf4,
+  0x81, 0x00, 0xf4, 0xc3, 0x00, 0xf4, 0xe9, 0x00, 0x0a, 0x66, 0x00, 0xf5,
+  0x0f, 0x00, 0x80, 0x01, 0x2e, 0x00, 0xf4, 0x58, 0x00, 0x00, 0x04, 0x66,
+  0x6c, 0x6d, 0x76, 0x00, 0x02, 0x12, 0x00, 0x01, 0x7d, 0x00, 0x01, 0x82,
+  0x00, 0x01, 0x99, 0x00, 0x80, 0x01, 0x2e, 0x00, 0xf4, 0x72, 0x00, 0x00,
+  0x03, 0x6d, 0x6f, 0x74, 0x00, 0x01, 0x82, 0x00, 0x01, 0x87, 0x00, 0x01,
+  0x8f, 0x00, 0x80, 0x01, 0x2e, 0x00, 0xf4, 0x88, 0x00, 0x40, 0x63, 0x14,
+  0x01, 0x02, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x07, 0x08, 0x00, 0x27, 0x8e, 0x00,
+  0xf4, 0xb8, 0x00, 0x01, 0x72, 0x00, 0x04, 0x33, 0x00, 0x01, 0x82, 0x00,
+  0x01, 0x8f, 0x00, 0x01, 0x94, 0x00, 0x01, 0x99, 0x00, 0x00, 0x02, 0x65,
+  0x69, 0x00, 0x03, 0x40, 0x00, 0x01, 0xed, 0x00, 0x80, 0x01, 0x2e, 0x00,
+  0xf4, 0xca, 0x00, 0x00, 0x07, 0x65, 0x67, 0x6c, 0x6d, 0x74, 0x75, 0x76,
+  0x00, 0x02, 0xfe, 0x00, 0x01, 0x72, 0x00, 0x01, 0x7d, 0x00, 0x01, 0x82,
+  0x00, 0x01, 0x8f, 0x00, 0x01, 0x94, 0x00, 0x01, 0x99, 0x00, 0x80, 0x01,
+  0x2e, 0x00, 0xf4, 0xf0, 0x00, 0x00, 0x07, 0x67, 0x6c, 0x6d, 0x70, 0x74,
+  0x75, 0x76, 0x00, 0x01, 0x72, 0x00, 0x01, 0x7d, 0x00, 0x01, 0x82, 0x00,
+  0x27, 0xf2, 0x00, 0x01, 0x8f, 0x00, 0x01, 0x94, 0x00, 0x01, 0x99, 0x00,
+  0x80, 0x01, 0x2e, 0x00, 0xf5, 0x16, 0x00, 0x00, 0x06, 0x62, 0x67, 0x6c,
+  0x6d, 0x74, 0x75, 0x00, 0xcf, 0x60, 0x00, 0x01, 0x72, 0x00, 0x01, 0x7d,
+  0x00, 0x01, 0x82, 0x00, 0x01, 0x8f, 0x00, 0x01, 0x94, 0x00, 0x40, 0x61,
+  0x15, 0x01, 0x02, 0x03, 0x04, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06,
+  0x00, 0x07, 0x08, 0x00, 0x00, 0x00, 0x00, 0x09, 0x0a, 0x0b, 0x00, 0xf5,
+  0x6b, 0x00, 0x08, 0x11, 0x00, 0x0b, 0xb8, 0x00, 0xf5, 0xaa, 0x00, 0xf5,
+  0xd0, 0x00, 0x0a, 0x66, 0x00, 0xf6, 0x20, 0x00, 0xf6, 0x32, 0x00, 0xf6,
+  0x39, 0x00, 0xf6, 0x4f, 0x00, 0xf6, 0xa0, 0x00, 0x80, 0x01, 0x2e, 0x00,
+  0xf5, 0x72, 0x00, 0x40, 0x65, 0x16, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x04, 0x00, 0x05, 0x06, 0x00, 0x00, 0x00, 0x07, 0x08, 0x09,
+  0x00, 0x00, 0x00, 0x0a, 0x00, 0x02, 0xfe, 0x00, 0x01, 0x72, 0x00, 0x01,
+  0x7d, 0x00, 0x01, 0x82, 0x00, 0x0a, 0x13, 0x00, 0x01, 0xff, 0x00, 0x02,
+  0x78, 0x00, 0x01, 0x94, 0x00, 0x01, 0x99, 0x00, 0x08, 0x0c, 0x00, 0x80,
+  0x01, 0x2e, 0x00, 0xf5, 0xb1, 0x00, 0x00, 0x07, 0x67, 0x6c, 0x6d, 0x6f,
+  0x74, 0x75, 0x76, 0x00, 0x01, 0x72, 0x00, 0x38, 0x2b, 0x00, 0x01, 0x82,
+  0x00, 0x0a, 0x52, 0x00, 0x54, 0xf2, 0x00, 0x01, 0x94, 0x00, 0x01, 0x99,
+  0x01, 0x62, 0x80, 0x01, 0x2e, 0x00, 0xf5, 0xd8, 0x00, 0x00, 0x04, 0x65,
+  0x70, 0x72, 0x73, 0x00, 0xf5, 0xeb, 0x00, 0x55, 0x7c, 0x00, 0xf6, 0x14,
+  0x00, 0x2a, 0xfc, 0x00, 0x00, 0x03, 0x68, 0x6d, 0x72, 0x00, 0xf5, 0xfa,
+  0x00, 0xf6, 0x02, 0x00, 0xf6, 0x0b, 0x05, 0x74, 0x2d, 0x72, 0x6f, 0x66,
+  0x84, 0x00, 0x06, 0x6f, 0x73, 0x2d, 0x72, 0x6f, 0x66, 0x84, 0x00, 0x06,
+  0x6f, 0x6d, 0x2d, 0x72, 0x6f, 0x66, 0x84, 0x00, 0x09, 0x65, 0x74, 0x74,
+  0x65, 0x62, 0x2d, 0x72, 0x6f, 0x66, 0x84, 0x00, 0x00, 0x82, 0x01, 0x2e,
+  0x00, 0xf6, 0x27, 0x08, 0x61, 0x74, 0x61, 0x64, 0x65, 0x6c, 0x65, 0x74,
+  0x81, 0x00, 0x00, 0x82, 0x01, 0x2e, 0x00, 0x1e, 0x13, 0x00, 0x80, 0x01,
+  0x2e, 0x00, 0xf6, 0x40, 0x00, 0x00, 0x03, 0x63, 0x67, 0x6f, 0x00, 0x02,
+  0xa9, 0x00, 0x01, 0x72, 0x00, 0x01, 0x87, 0x00, 0x80, 0x01, 0x2e, 0x00,
+  0xf6, 0x56, 0x00, 0x00, 0x07, 0x63, 0x65, 0x69, 0x6c, 0x6f, 0x72, 0x76,
+  0x00, 0x16, 0xc3, 0x00, 0xf6, 0x75, 0x00, 0x03, 0x04, 0x00, 0xf6, 0x80,
+  0x00, 0xf6, 0x91, 0x00, 0x02, 0x12, 0x00, 0x03, 0x3c, 0x00, 0x00, 0x02,
+  0x6d, 0x6e, 0x00, 0x01, 0xed, 0x00, 0x01, 0xed, 0x00, 0x00, 0x02, 0x65,
+  0x69, 0x00, 0xf6, 0x8b, 0x00, 0x03, 0x40, 0x03, 0x74, 0x6f, 0x68, 0x80,
+  0x00, 0x00, 0x00, 0x03, 0x63, 0x66, 0x67, 0x00, 0x01, 0xed, 0x00, 0x03,
+  0x21, 0x00, 0x01, 0xed, 0x00, 0x80, 0x01, 0x2e, 0x00, 0xf6, 0xa7, 0x00,
+  0x00, 0x04, 0x67, 0x6d, 0x6f, 0x74, 0x00, 0x01, 0x72, 0x00, 0x01, 0x82,
+  0x00, 0x01, 0x87, 0x00, 0x01, 0x8f,
+};
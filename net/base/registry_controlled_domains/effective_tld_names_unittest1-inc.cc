@@ -0,0 +1,16 @@
+/* This file is generated by net/tools/dafsa/make_dafsa.py.
+   DO NOT EDIT! */
+
+const unsigned char kDafsa[125] = {
+  0x00, 0x00, 0x05, 0x63, 0x65, 0x6d, 0x6f, 0x70, 0x00, 0x00, 0x17, 0x00,
+  0x00, 0x22, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x38, 0x00, 0x00, 0x47, 0x00,
+  0x82, 0x01, 0x2e, 0x00, 0x00, 0x1e, 0x01, 0x62, 0x81, 0x00, 0x06, 0x74,
+  0x61, 0x76, 0x69, 0x72, 0x70, 0x84, 0x00, 0x0a, 0x6f, 0x63, 0x2e, 0x7a,
+  0x61, 0x62, 0x2e, 0x72, 0x61, 0x62, 0x80, 0x00, 0x01, 0x6e, 0x80, 0x01,
+  0x2e, 0x00, 0x00, 0x40, 0x04, 0x76, 0x69, 0x72, 0x70, 0x84, 0x00, 0x01,
+  0x6a, 0x80, 0x01, 0x2e, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x02, 0x63, 0x72,
+  0x00, 0x00, 0x5a, 0x00, 0x00, 0x5e, 0x01, 0x61, 0x80, 0x00, 0x02, 0x61,
+  0x62, 0x82, 0x01, 0x2e, 0x00, 0x00, 0x67, 0x00, 0x00, 0x02, 0x66, 0x7a,
+  0x00, 0x00, 0x72, 0x00, 0x00, 0x78, 0x03, 0x65, 0x72, 0x70, 0x81, 0x00,
+  0x02, 0x61, 0x62, 0x82, 0x00,
+};
@@ -0,0 +1,7 @@
+/* This file is generated by net/tools/dafsa/make_dafsa.py.
+   DO NOT EDIT! */
+
+const unsigned char kDafsa[15] = {
+  0x02, 0x70, 0x6a, 0x80, 0x01, 0x2e, 0x00, 0x00, 0x09, 0x03, 0x72, 0x61,
+  0x62, 0x80, 0x00,
+};
@@ -53,7 +53,7 @@
 #include "url/gurl.h"
 #include "url/url_parse.h"
 
-#include "effective_tld_names.cc"
+#include "effective_tld_names-inc.cc"
 
 namespace net {
 namespace registry_controlled_domains {
@@ -64,15 +64,76 @@ const int kExceptionRule = 1;
 const int kWildcardRule = 2;
 const int kPrivateRule = 4;
 
-const FindDomainPtr kDefaultFindDomainFunction = Perfect_Hash::FindDomain;
-
-// 'stringpool' is defined as a macro by the gperf-generated
-// "effective_tld_names.cc". Provide a real constant value for it instead.
-const char* const kDefaultStringPool = stringpool;
-#undef stringpool
-
-FindDomainPtr g_find_domain_function = kDefaultFindDomainFunction;
-const char* g_stringpool = kDefaultStringPool;
+// Node headers in the graph. See net/tools/dafsa/make_dafsa.py for the
+// encoding.
+const unsigned char kRuleEndFlag = 0x80;
+const unsigned char kChildTableFlag = 0x40;
+const unsigned char kRuleTypeMask = 0x07;
+
+const unsigned char* g_graph = kDafsa;
+size_t g_graph_length = sizeof(kDafsa);
+
+// Walks the graph over the characters in [|begin|, |end|), last one first.
+// Returns the start of the longest suffix which starts a label and matches a
+// rule, and stores the type of the rule in |*type|. Returns NULL if there is
+// no such suffix. Private rules are skipped unless |private_filter| says
+// otherwise.
+const char* FindLongestRule(const char* begin,
+                            const char* end,
+                            PrivateRegistryFilter private_filter,
+                            int* type) {
+  const unsigned char* pos = g_graph;
+  const char* key = end;
+  const char* match = NULL;
+  while (true) {
+    DCHECK_LT(pos, g_graph + g_graph_length);
+    const size_t tail_length = *pos++;
+    if (tail_length > static_cast<size_t>(key - begin))
+      return match;
+    for (size_t i = 0; i < tail_length; ++i) {
+      if (pos[i] != static_cast<unsigned char>(*(key - 1 - i)))
+        return match;
+    }
+    pos += tail_length;
+    key -= tail_length;
+
+    const unsigned char header = *pos++;
+    if ((header & kRuleEndFlag) && (key == begin || key[-1] == '.')) {
+      const int rule_type = header & kRuleTypeMask;
+      if (!(rule_type & kPrivateRule) ||
+          private_filter == INCLUDE_PRIVATE_REGISTRIES) {
+        match = key;
+        *type = rule_type;
+      }
+    }
+    if (key == begin)
+      return match;
+
+    // Find the child reached by the next character, either in the table of
+    // a node with many children, or by scanning the few characters listed.
+    const unsigned char c = static_cast<unsigned char>(*--key);
+    size_t index;
+    const unsigned char* positions;
+    if (header & kChildTableFlag) {
+      const size_t table_index = static_cast<unsigned char>(c - pos[0]);
+      const size_t table_length = pos[1];
+      if (table_index >= table_length || !pos[2 + table_index])
+        return match;
+      index = pos[2 + table_index] - 1;
+      positions = pos + 2 + table_length;
+    } else {
+      const size_t num_children = *pos++;
+      index = 0;
+      while (index < num_children && pos[index] != c)
+        ++index;
+      if (index == num_children)
+        return match;
+      positions = pos + num_children;
+    }
+    const unsigned char* child = positions + 3 * index;
+    pos = g_graph + ((child[0] << 16) | (child[1] << 8) | child[2]);
+  }
+}
 
 size_t GetRegistryLengthImpl(
     const std::string& host,
@@ -96,70 +157,55 @@ size_t GetRegistryLengthImpl(
       return 0;  // Multiple trailing dots.
   }
 
-  // Walk up the domain tree, most specific to least specific,
-  // looking for matches at each level.
-  size_t prev_start = std::string::npos;
-  size_t curr_start = host_check_begin;
-  size_t next_dot = host.find('.', curr_start);
-  if (next_dot >= host_check_len)  // Catches std::string::npos as well.
-    return 0;  // This can't have a registry + domain.
-  while (1) {
-    const char* domain_str = host.data() + curr_start;
-    int domain_length = host_check_len - curr_start;
-    const DomainRule* rule = g_find_domain_function(domain_str, domain_length);
-
-    // We need to compare the string after finding a match because the
-    // no-collisions of perfect hashing only refers to items in the set.  Since
-    // we're searching for arbitrary domains, there could be collisions.
-    // Furthermore, if the apparent match is a private registry and we're not
-    // including those, it can't be an actual match.
-    if (rule) {
-      bool do_check = !(rule->type & kPrivateRule) ||
-                      private_filter == INCLUDE_PRIVATE_REGISTRIES;
-      if (do_check && base::strncasecmp(domain_str,
-                                        g_stringpool + rule->name_offset,
-                                        domain_length) == 0) {
-        // Exception rules override wildcard rules when the domain is an exact
-        // match, but wildcards take precedence when there's a subdomain.
-        if (rule->type & kWildcardRule && (prev_start != std::string::npos)) {
-          // If prev_start == host_check_begin, then the host is the registry
-          // itself, so return 0.
-          return (prev_start == host_check_begin) ?
-              0 : (host.length() - prev_start);
-        }
-
-        if (rule->type & kExceptionRule) {
-          if (next_dot == std::string::npos) {
-            // If we get here, we had an exception rule with no dots (e.g.
-            // "!foo").  This would only be valid if we had a corresponding
-            // wildcard rule, which would have to be "*".  But we explicitly
-            // disallow that case, so this kind of rule is invalid.
-            NOTREACHED() << "Invalid exception rule";
-            return 0;
-          }
-          return host.length() - next_dot - 1;
-        }
-
-        // If curr_start == host_check_begin, then the host is the registry
-        // itself, so return 0.
-        return (curr_start == host_check_begin) ?
-            0 : (host.length() - curr_start);
-      }
+  // A host without a dot can't have a registry + domain.
+  const size_t last_dot = host.rfind('.', host_check_len - 1);
+  if (last_dot == std::string::npos || last_dot < host_check_begin)
+    return 0;
+
+  // Find the most specific rule which matches the host. Unlike a lookup of
+  // each subdomain in turn, this reads every character of the host once.
+  int type = 0;
+  const char* match = FindLongestRule(host.data() + host_check_begin,
+                                      host.data() + host_check_len,
+                                      private_filter, &type);
+  if (match) {
+    const size_t curr_start = match - host.data();
+
+    // Exception rules override wildcard rules when the domain is an exact
+    // match, but wildcards take precedence when there's a subdomain.
+    if ((type & kWildcardRule) && curr_start != host_check_begin) {
+      // The label before the match is part of the registry. If it starts the
+      // host, then the host is the registry itself, so return 0.
+      const size_t prev_dot = host.rfind('.', curr_start - 2);
+      const size_t prev_start =
+          (prev_dot == std::string::npos) ? 0 : prev_dot + 1;
+      return (prev_start == host_check_begin) ?
+          0 : (host.length() - prev_start);
     }
 
-    if (next_dot >= host_check_len)  // Catches std::string::npos as well.
-      break;
+    if (type & kExceptionRule) {
+      const size_t next_dot = host.find('.', curr_start);
+      if (next_dot == std::string::npos) {
+        // If we get here, we had an exception rule with no dots (e.g.
+        // "!foo").  This would only be valid if we had a corresponding
+        // wildcard rule, which would have to be "*".  But we explicitly
+        // disallow that case, so this kind of rule is invalid.
+        NOTREACHED() << "Invalid exception rule";
+        return 0;
+      }
+      return host.length() - next_dot - 1;
+    }
 
-    prev_start = curr_start;
-    curr_start = next_dot + 1;
-    next_dot = host.find('.', curr_start);
+    // If curr_start == host_check_begin, then the host is the registry
+    // itself, so return 0.
+    return (curr_start == host_check_begin) ?
+        0 : (host.length() - curr_start);
   }
 
-  // No rule found in the registry.  curr_start now points to the first
-  // character of the last subcomponent of the host, so if we allow unknown
-  // registries, return the length of this subcomponent.
+  // No rule found in the registry.  If we allow unknown registries, return
+  // the length of the last subcomponent of the host.
   return unknown_filter == INCLUDE_UNKNOWN_REGISTRIES ?
-      (host.length() - curr_start) : 0;
+      (host.length() - last_dot - 1) : 0;
 }
 
 std::string GetDomainAndRegistryImpl(
@@ -264,10 +310,9 @@ size_t GetRegistryLength(
   return GetRegistryLengthImpl(canon_host, unknown_filter, private_filter);
 }
 
-void SetFindDomainFunctionAndStringPoolForTesting(FindDomainPtr function,
-                                                  const char* stringpool) {
-  g_find_domain_function = function ? function : kDefaultFindDomainFunction;
-  g_stringpool = stringpool ? stringpool : kDefaultStringPool;
+void SetFindDomainGraphForTesting(const unsigned char* graph, size_t length) {
+  g_graph = graph ? graph : kDafsa;
+  g_graph_length = graph ? length : sizeof(kDafsa);
 }
 
 }  // namespace registry_controlled_domains
@@ -224,12 +224,11 @@ NET_EXPORT size_t GetRegistryLength(const std::string& host,
                                     UnknownRegistryFilter unknown_filter,
                                     PrivateRegistryFilter private_filter);
 
-typedef const struct DomainRule* (*FindDomainPtr)(const char *, unsigned int);
-
-// Used for unit tests, so that a different perfect hash map from the full
-// list is used. Set to NULL to use the Default function.
-NET_EXPORT_PRIVATE void SetFindDomainFunctionAndStringPoolForTesting(
-    FindDomainPtr fn, const char* stringpool);
+// Used for unit tests, so that a different graph, generated by
+// net/tools/dafsa/make_dafsa.py, is used instead of the full list. Set to NULL
+// to use the default graph.
+NET_EXPORT_PRIVATE void SetFindDomainGraphForTesting(const unsigned char* graph,
+                                                     size_t length);
 
 }  // namespace registry_controlled_domains
 }  // namespace net
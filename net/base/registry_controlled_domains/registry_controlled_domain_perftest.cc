@@ -0,0 +1,234 @@
+// Copyright 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <string>
+#include <vector>
+
+#include "base/containers/hash_tables.h"
+#include "base/file_util.h"
+#include "base/files/file_path.h"
+#include "base/path_service.h"
+#include "base/perftimer.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/string_piece.h"
+#include "net/base/registry_controlled_domains/registry_controlled_domain.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+#include "url/url_parse.h"
+
+namespace net {
+namespace registry_controlled_domains {
+
+namespace {
+
+const int kIterations = 20000;
+
+// A mix of hosts that match plain, wildcard, exception and private rules,
+// and of hosts that match no rule at all.
+const char* const kHosts[] = {
+  "www.google.com",
+  "mail.google.com",
+  "www.bbc.co.uk",
+  "news.bbc.co.uk",
+  "a.b.c.d.e.example.co.uk",
+  "www.city.kobe.jp",
+  "foo.bar.kobe.jp",
+  "www.example.ck",
+  "example.appspot.com",
+  "myblog.blogspot.com",
+  "en.wikipedia.org",
+  "www.amazon.de",
+  "static.ak.fbcdn.net",
+  "ssl.gstatic.com",
+  "www.example.com.au",
+  "intranet",
+  "build.corp.example.internal",
+  "www.example.notatld",
+};
+
+// The lookup of the registry before the DAFSA, with the perfect hash that
+// gperf generated replaced by a hash table of the rules, which is built from
+// effective_tld_names.gperf when the test runs: every dot-separated suffix of
+// a host is looked up, from the longest to the shortest.
+class HashedRules {
+ public:
+  HashedRules() {}
+
+  // Reads the rules. Returns false if the file can't be read or parsed.
+  bool Init() {
+    base::FilePath path;
+    PathService::Get(base::DIR_SOURCE_ROOT, &path);
+    path = path.AppendASCII("net")
+               .AppendASCII("base")
+               .AppendASCII("registry_controlled_domains")
+               .AppendASCII("effective_tld_names.gperf");
+    if (!file_util::ReadFileToString(path, &text_))
+      return false;
+
+    // The rules are the "name, type" lines between the two "%%" lines, as
+    // net/tools/tld_cleanup writes them. The table refers to the names in
+    // |text_|.
+    bool in_rules = false;
+    size_t line_begin = 0;
+    while (line_begin < text_.size()) {
+      size_t line_end = text_.find('\n', line_begin);
+      if (line_end == std::string::npos)
+        line_end = text_.size();
+      const base::StringPiece line(text_.data() + line_begin,
+                                   line_end - line_begin);
+      line_begin = line_end + 1;
+      if (line == "%%") {
+        if (in_rules)
+          return !rules_.empty();
+        in_rules = true;
+        continue;
+      }
+      if (!in_rules || line.empty())
+        continue;
+      const size_t separator = line.find(", ");
+      int type = 0;
+      if (separator == base::StringPiece::npos ||
+          !base::StringToInt(line.substr(separator + 2), &type)) {
+        return false;
+      }
+      rules_[line.substr(0, separator)] = type;
+    }
+    return false;
+  }
+
+  size_t GetRegistryLength(const std::string& host,
+                           UnknownRegistryFilter unknown_filter,
+                           PrivateRegistryFilter private_filter) const {
+    const int kExceptionRule = 1;
+    const int kWildcardRule = 2;
+    const int kPrivateRule = 4;
+
+    const size_t host_check_begin = host.find_first_not_of('.');
+    if (host_check_begin == std::string::npos)
+      return 0;
+    size_t host_check_len = host.length();
+    if (host[host_check_len - 1] == '.') {
+      --host_check_len;
+      if (host[host_check_len - 1] == '.')
+        return 0;
+    }
+
+    size_t prev_start = std::string::npos;
+    size_t curr_start = host_check_begin;
+    size_t next_dot = host.find('.', curr_start);
+    if (next_dot >= host_check_len)
+      return 0;
+    while (1) {
+      const RuleMap::const_iterator rule = rules_.find(base::StringPiece(
+          host.data() + curr_start, host_check_len - curr_start));
+      if (rule != rules_.end() &&
+          (!(rule->second & kPrivateRule) ||
+           private_filter == INCLUDE_PRIVATE_REGISTRIES)) {
+        if (rule->second & kWildcardRule &&
+            (prev_start != std::string::npos)) {
+          return (prev_start == host_check_begin) ?
+              0 : (host.length() - prev_start);
+        }
+        if (rule->second & kExceptionRule)
+          return host.length() - next_dot - 1;
+        return (curr_start == host_check_begin) ?
+            0 : (host.length() - curr_start);
+      }
+
+      if (next_dot >= host_check_len)
+        break;
+
+      prev_start = curr_start;
+      curr_start = next_dot + 1;
+      next_dot = host.find('.', curr_start);
+    }
+
+    return unknown_filter == INCLUDE_UNKNOWN_REGISTRIES ?
+        (host.length() - curr_start) : 0;
+  }
+
+  // Like GetRegistryLength(const GURL&, ...), which takes the host as the URL
+  // canonicalized it.
+  size_t GetRegistryLength(const GURL& gurl,
+                           UnknownRegistryFilter unknown_filter,
+                           PrivateRegistryFilter private_filter) const {
+    const url_parse::Component host =
+        gurl.parsed_for_possibly_invalid_spec().host;
+    if (host.len <= 0)
+      return std::string::npos;
+    if (gurl.HostIsIPAddress())
+      return 0;
+    return GetRegistryLength(
+        std::string(gurl.possibly_invalid_spec().data() + host.begin,
+                    host.len),
+        unknown_filter,
+        private_filter);
+  }
+
+ private:
+  typedef base::hash_map<base::StringPiece, int> RuleMap;
+
+  std::string text_;
+  RuleMap rules_;
+
+  DISALLOW_COPY_AND_ASSIGN(HashedRules);
+};
+
+TEST(RegistryControlledDomainPerfTest, GetRegistryLength) {
+  HashedRules hashed_rules;
+  ASSERT_TRUE(hashed_rules.Init());
+
+  std::vector<GURL> urls;
+  for (size_t i = 0; i < arraysize(kHosts); ++i) {
+    urls.push_back(GURL(std::string("http://") + kHosts[i] + "/"));
+    // Both lookups see the same rules for these hosts.
+    EXPECT_EQ(hashed_rules.GetRegistryLength(urls[i],
+                                             EXCLUDE_UNKNOWN_REGISTRIES,
+                                             INCLUDE_PRIVATE_REGISTRIES),
+              GetRegistryLength(urls[i], EXCLUDE_UNKNOWN_REGISTRIES,
+                                INCLUDE_PRIVATE_REGISTRIES)) << kHosts[i];
+  }
+
+  // Both sides check whether the host is an IP address first, which takes
+  // longer than the lookups themselves. It is timed on its own, so that it
+  // can be subtracted from the times below.
+  size_t ip_address_count = 0;
+  PerfTimeLogger ip_address_timer("RegistryControlledDomain_HostIsIPAddress");
+  for (int i = 0; i < kIterations; ++i) {
+    for (size_t j = 0; j < urls.size(); ++j) {
+      if (urls[j].HostIsIPAddress())
+        ++ip_address_count;
+    }
+  }
+  ip_address_timer.Done();
+  EXPECT_EQ(0u, ip_address_count);
+
+  // Accumulated so that the lookups are not optimized away.
+  size_t hash_total = 0;
+  PerfTimeLogger hash_timer("RegistryControlledDomain_Hash");
+  for (int i = 0; i < kIterations; ++i) {
+    for (size_t j = 0; j < urls.size(); ++j) {
+      hash_total += hashed_rules.GetRegistryLength(
+          urls[j], EXCLUDE_UNKNOWN_REGISTRIES, INCLUDE_PRIVATE_REGISTRIES);
+    }
+  }
+  hash_timer.Done();
+
+  size_t dafsa_total = 0;
+  PerfTimeLogger dafsa_timer("RegistryControlledDomain_Dafsa");
+  for (int i = 0; i < kIterations; ++i) {
+    for (size_t j = 0; j < urls.size(); ++j) {
+      dafsa_total += GetRegistryLength(
+          urls[j], EXCLUDE_UNKNOWN_REGISTRIES, INCLUDE_PRIVATE_REGISTRIES);
+    }
+  }
+  dafsa_timer.Done();
+
+  EXPECT_EQ(hash_total, dafsa_total);
+}
+
+}  // namespace
+
+}  // namespace registry_controlled_domains
+}  // namespace net
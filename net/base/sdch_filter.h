@@ -90,9 +90,9 @@ class NET_EXPORT_PRIVATE SdchFilter : public Filter {
   // attempted.
   bool dictionary_hash_is_plausible_;
 
-  // We hold an in-memory copy of the dictionary during the entire decoding, as
-  // it is used directly by the VC-DIFF decoding system.
-  // That char* data is part of the dictionary_ we hold a reference to.
+  // We hold a reference to the dictionary during the entire decoding, as its
+  // text (in memory, or memory mapped from disk) is used directly by the
+  // VC-DIFF decoding system.
   scoped_refptr<SdchManager::Dictionary> dictionary_;
 
   // The decoder may demand a larger output buffer than the target of
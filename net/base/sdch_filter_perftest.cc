@@ -0,0 +1,172 @@
+// Copyright 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "base/memory/scoped_ptr.h"
+#include "base/perftimer.h"
+#include "base/strings/stringprintf.h"
+#include "net/base/filter.h"
+#include "net/base/io_buffer.h"
+#include "net/base/mock_filter_context.h"
+#include "net/base/sdch_manager.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+namespace net {
+
+namespace {
+
+const char kDomain[] = "sdchperf.com";
+
+// Size of the VCDIFF part of the dictionary.
+const size_t kDictionarySize = 64 * 1024;
+
+// Every COPY from the dictionary in a response is followed by an ADD of this
+// many literal bytes.
+const size_t kAddSize = 64;
+
+const int kLargeResponses = 50;
+const int kSmallResponses = 20000;
+
+// Appends |value| as a VCDIFF integer: base 128, most significant digit first.
+void AppendVarint(size_t value, std::string* output) {
+  char digits[16];
+  size_t count = 0;
+  do {
+    digits[count++] = static_cast<char>(value & 0x7f);
+    value >>= 7;
+  } while (value);
+  while (count > 1)
+    output->push_back(digits[--count] | 0x80);
+  output->push_back(digits[0]);
+}
+
+// Returns a VCDIFF delta (RFC 3284) whose target is |copies| times the first
+// |copy_size| bytes of the dictionary, each followed by kAddSize literal bytes.
+// It is encoded by hand since only the decoder is built.
+std::string MakeVcdiffDelta(size_t copy_size, size_t copies) {
+  std::string data;
+  std::string instructions;
+  std::string addresses;
+  for (size_t i = 0; i < copies; ++i) {
+    // Instruction 19 of the default code table is COPY in VCD_SELF mode, with
+    // the size following it; instruction 1 is ADD, also with the size.
+    instructions.push_back(19);
+    AppendVarint(copy_size, &instructions);
+    AppendVarint(0, &addresses);
+    instructions.push_back(1);
+    AppendVarint(kAddSize, &instructions);
+    data.append(kAddSize, static_cast<char>('a' + i % 26));
+  }
+
+  std::string delta;
+  AppendVarint(copies * (copy_size + kAddSize), &delta);
+  delta.push_back(0);  // Delta_Indicator: no compressed sections.
+  AppendVarint(data.size(), &delta);
+  AppendVarint(instructions.size(), &delta);
+  AppendVarint(addresses.size(), &delta);
+  delta.append(data + instructions + addresses);
+
+  // Header, without secondary compressor nor custom code table.
+  std::string vcdiff("\xd6\xc3\xc4\x00\x00", 5);
+  vcdiff.push_back(1);  // Win_Indicator: VCD_SOURCE.
+  AppendVarint(kDictionarySize, &vcdiff);
+  AppendVarint(0, &vcdiff);
+  AppendVarint(delta.size(), &vcdiff);
+  vcdiff.append(delta);
+  return vcdiff;
+}
+
+class SdchFilterPerfTest : public testing::Test {
+ public:
+  SdchFilterPerfTest() : url_(std::string("http://") + kDomain + "/") {}
+
+  virtual void SetUp() {
+    std::string dictionary =
+        base::StringPrintf("Domain: %s\n\n", kDomain);
+    for (size_t i = 0; i < kDictionarySize; ++i)
+      dictionary.push_back(static_cast<char>(' ' + (i * 7919) % 95));
+    ASSERT_TRUE(sdch_manager_.AddSdchDictionary(dictionary, url_));
+
+    std::string client_hash;
+    SdchManager::GenerateHash(dictionary, &client_hash, &server_hash_);
+    filter_context_.SetURL(url_);
+  }
+
+ protected:
+  // Returns an SDCH response whose body is |vcdiff|.
+  std::string MakeResponse(const std::string& vcdiff) const {
+    return server_hash_ + std::string("\0", 1) + vcdiff;
+  }
+
+  // Decodes |response| with a new SDCH filter, the way URLRequestJob does,
+  // and returns the number of bytes decoded.
+  size_t Decode(const std::string& response) {
+    std::vector<Filter::FilterType> filter_types;
+    filter_types.push_back(Filter::FILTER_TYPE_SDCH);
+    scoped_ptr<Filter> filter(Filter::Factory(filter_types, filter_context_));
+
+    size_t decoded = 0;
+    size_t offset = 0;
+    char output[32 * 1024];
+    Filter::FilterStatus status = Filter::FILTER_NEED_MORE_DATA;
+    while (status != Filter::FILTER_DONE && status != Filter::FILTER_ERROR) {
+      if (status == Filter::FILTER_NEED_MORE_DATA) {
+        if (offset == response.size())
+          break;
+        size_t length = std::min(
+            response.size() - offset,
+            static_cast<size_t>(filter->stream_buffer_size()));
+        memcpy(filter->stream_buffer()->data(), response.data() + offset,
+               length);
+        filter->FlushStreamBuffer(length);
+        offset += length;
+      }
+      int output_length = sizeof(output);
+      status = filter->ReadData(output, &output_length);
+      decoded += output_length;
+      if (status == Filter::FILTER_OK && output_length == 0)
+        break;
+    }
+    EXPECT_NE(Filter::FILTER_ERROR, status);
+    return decoded;
+  }
+
+  const GURL url_;
+  SdchManager sdch_manager_;
+  std::string server_hash_;
+  MockFilterContext filter_context_;
+};
+
+// Measures decode throughput on responses of about 1MB.
+TEST_F(SdchFilterPerfTest, LargeResponses) {
+  const size_t kCopies = 16;
+  std::string response =
+      MakeResponse(MakeVcdiffDelta(kDictionarySize, kCopies));
+  const size_t expected_size = kCopies * (kDictionarySize + kAddSize);
+  ASSERT_EQ(expected_size, Decode(response));
+
+  PerfTimeLogger timer("SdchFilter_Decode_1MB_Responses");
+  for (int i = 0; i < kLargeResponses; ++i)
+    Decode(response);
+  timer.Done();
+}
+
+// Measures the setup cost of each response, which dominates small ones.
+TEST_F(SdchFilterPerfTest, SmallResponses) {
+  std::string response = MakeResponse(MakeVcdiffDelta(256, 1));
+  ASSERT_EQ(256 + kAddSize, Decode(response));
+
+  PerfTimeLogger timer("SdchFilter_Decode_Small_Responses");
+  for (int i = 0; i < kSmallResponses; ++i)
+    Decode(response);
+  timer.Done();
+}
+
+}  // namespace
+
+}  // namespace net
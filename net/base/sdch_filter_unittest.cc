@@ -8,8 +8,12 @@
 #include <string>
 #include <vector>
 
+#include "base/file_util.h"
+#include "base/files/scoped_temp_dir.h"
 #include "base/logging.h"
 #include "base/memory/scoped_ptr.h"
+#include "base/message_loop/message_loop.h"
+#include "base/run_loop.h"
 #include "net/base/filter.h"
 #include "net/base/io_buffer.h"
 #include "net/base/mock_filter_context.h"
@@ -1284,21 +1288,205 @@ TEST_F(SdchFilterTest, CanStillSetExactMatchDictionary) {
               GURL("http://" + dictionary_domain)));
 }
 
-// Make sure the DOS protection precludes the addition of too many dictionaries.
+// Make sure the DOS protection bounds the number of dictionaries, evicting the
+// least recently used one.
 TEST_F(SdchFilterTest, TooManyDictionaries) {
   std::string dictionary_domain(".google.com");
   std::string dictionary_text(NewSdchDictionary(dictionary_domain));
+  GURL url("http://www.google.com");
 
-  size_t count = 0;
-  while (count <= SdchManager::kMaxDictionaryCount + 1) {
-    if (!sdch_manager_->AddSdchDictionary(dictionary_text,
-                                          GURL("http://www.google.com")))
-      break;
+  std::vector<std::string> server_hashes;
+  while (server_hashes.size() < SdchManager::kMaxDictionaryCount) {
+    ASSERT_TRUE(sdch_manager_->AddSdchDictionary(dictionary_text, url));
+    std::string client_hash;
+    std::string server_hash;
+    SdchManager::GenerateHash(dictionary_text, &client_hash, &server_hash);
+    server_hashes.push_back(server_hash);
 
     dictionary_text += " ";  // Create dictionary with different SHA signature.
-    ++count;
   }
-  EXPECT_EQ(SdchManager::kMaxDictionaryCount, count);
+
+  // Using the oldest dictionary makes the second one the least recently used.
+  SdchManager::Dictionary* dictionary = NULL;
+  sdch_manager_->GetVcdiffDictionary(server_hashes[0], url, &dictionary);
+  EXPECT_TRUE(dictionary);
+
+  EXPECT_TRUE(sdch_manager_->AddSdchDictionary(dictionary_text, url));
+  EXPECT_EQ(SdchManager::kMaxDictionaryCount,
+            sdch_manager_->dictionary_count());
+  sdch_manager_->GetVcdiffDictionary(server_hashes[1], url, &dictionary);
+  EXPECT_FALSE(dictionary);
+  sdch_manager_->GetVcdiffDictionary(server_hashes[0], url, &dictionary);
+  EXPECT_TRUE(dictionary);
+}
+
+TEST_F(SdchFilterTest, TotalDictionarySizeIsBounded) {
+  std::string dictionary_domain(".google.com");
+  std::string dictionary_text(NewSdchDictionary(dictionary_domain));
+  dictionary_text.append(
+      SdchManager::kMaxDictionarySize - dictionary_text.size(), ' ');
+
+  size_t max_count =
+      SdchManager::kMaxTotalDictionarySize / SdchManager::kMaxDictionarySize;
+  for (size_t i = 0; i <= max_count; ++i) {
+    // Create dictionary with different SHA signature.
+    dictionary_text[dictionary_text.size() - 1] = 'a' + i;
+    EXPECT_TRUE(sdch_manager_->AddSdchDictionary(
+        dictionary_text, GURL("http://www.google.com")));
+    EXPECT_GE(SdchManager::kMaxTotalDictionarySize,
+              sdch_manager_->total_dictionary_size());
+  }
+  EXPECT_EQ(max_count, sdch_manager_->dictionary_count());
+}
+
+TEST_F(SdchFilterTest, PersistedDictionariesAreReloaded) {
+  base::MessageLoop message_loop;
+  base::ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+  base::FilePath path = temp_dir.path().AppendASCII("SDCH");
+  GURL url("http://www.google.com");
+  std::string dictionary_text(NewSdchDictionary("www.google.com"));
+  std::string client_hash;
+  std::string server_hash;
+  SdchManager::GenerateHash(dictionary_text, &client_hash, &server_hash);
+
+  sdch_manager_->EnablePersistence(path, message_loop.message_loop_proxy());
+  base::RunLoop().RunUntilIdle();
+  EXPECT_TRUE(sdch_manager_->AddSdchDictionary(dictionary_text, url));
+  base::RunLoop().RunUntilIdle();
+
+  // A corrupt file is ignored, and deleted.
+  base::FilePath corrupt_path = path.AppendASCII("corrupt.sdch");
+  ASSERT_EQ(7, file_util::WriteFile(corrupt_path, "corrupt", 7));
+
+  sdch_manager_.reset();
+  sdch_manager_.reset(new SdchManager);
+  sdch_manager_->EnablePersistence(path, message_loop.message_loop_proxy());
+  base::RunLoop().RunUntilIdle();
+  EXPECT_EQ(1U, sdch_manager_->dictionary_count());
+  EXPECT_FALSE(base::PathExists(corrupt_path));
+
+  SdchManager::Dictionary* dictionary = NULL;
+  sdch_manager_->GetVcdiffDictionary(server_hash, url, &dictionary);
+  ASSERT_TRUE(dictionary);
+  EXPECT_EQ(test_vcdiff_dictionary_, dictionary->text().as_string());
+
+  sdch_manager_.reset();
+  base::RunLoop().RunUntilIdle();
+}
+
+TEST_F(SdchFilterTest, ClearData) {
+  base::MessageLoop message_loop;
+  base::ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+  base::FilePath path = temp_dir.path().AppendASCII("SDCH");
+  GURL url("http://www.google.com");
+  std::string dictionary_text(NewSdchDictionary("www.google.com"));
+  std::string client_hash;
+  std::string server_hash;
+  SdchManager::GenerateHash(dictionary_text, &client_hash, &server_hash);
+
+  sdch_manager_->EnablePersistence(path, message_loop.message_loop_proxy());
+  base::RunLoop().RunUntilIdle();
+  EXPECT_TRUE(sdch_manager_->AddSdchDictionary(dictionary_text, url));
+  base::RunLoop().RunUntilIdle();
+  EXPECT_TRUE(base::PathExists(path.AppendASCII(server_hash + ".sdch")));
+
+  sdch_manager_->ClearData();
+  base::RunLoop().RunUntilIdle();
+  EXPECT_EQ(0U, sdch_manager_->dictionary_count());
+  SdchManager::Dictionary* dictionary = NULL;
+  sdch_manager_->GetVcdiffDictionary(server_hash, url, &dictionary);
+  EXPECT_FALSE(dictionary);
+  EXPECT_FALSE(base::PathExists(path.AppendASCII(server_hash + ".sdch")));
+
+  // Nothing is loaded by later runs either.
+  sdch_manager_.reset();
+  sdch_manager_.reset(new SdchManager);
+  sdch_manager_->EnablePersistence(path, message_loop.message_loop_proxy());
+  base::RunLoop().RunUntilIdle();
+  EXPECT_EQ(0U, sdch_manager_->dictionary_count());
+
+  sdch_manager_.reset();
+  base::RunLoop().RunUntilIdle();
+}
+
+// Dictionaries still being loaded when the data is cleared are dropped.
+TEST_F(SdchFilterTest, ClearDataWhileLoading) {
+  base::MessageLoop message_loop;
+  base::ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+  base::FilePath path = temp_dir.path().AppendASCII("SDCH");
+  GURL url("http://www.google.com");
+  std::string dictionary_text(NewSdchDictionary("www.google.com"));
+
+  sdch_manager_->EnablePersistence(path, message_loop.message_loop_proxy());
+  base::RunLoop().RunUntilIdle();
+  EXPECT_TRUE(sdch_manager_->AddSdchDictionary(dictionary_text, url));
+  base::RunLoop().RunUntilIdle();
+
+  sdch_manager_.reset();
+  sdch_manager_.reset(new SdchManager);
+  sdch_manager_->EnablePersistence(path, message_loop.message_loop_proxy());
+  sdch_manager_->ClearData();
+  base::RunLoop().RunUntilIdle();
+  EXPECT_EQ(0U, sdch_manager_->dictionary_count());
+
+  sdch_manager_.reset();
+  base::RunLoop().RunUntilIdle();
+}
+
+namespace {
+
+// Adds the dictionary it is given as soon as it is scheduled.
+class ImmediateSdchFetcher : public SdchFetcher {
+ public:
+  explicit ImmediateSdchFetcher(const std::string& dictionary_text)
+      : dictionary_text_(dictionary_text) {}
+
+  virtual void Schedule(const GURL& dictionary_url) OVERRIDE {
+    SdchManager::Global()->AddSdchDictionary(dictionary_text_, dictionary_url);
+  }
+
+ private:
+  const std::string dictionary_text_;
+
+  DISALLOW_COPY_AND_ASSIGN(ImmediateSdchFetcher);
+};
+
+}  // namespace
+
+// Dictionaries fetched for off the record requests are not persisted.
+TEST_F(SdchFilterTest, UnpersistedDictionaryIsNotWritten) {
+  base::MessageLoop message_loop;
+  base::ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+  base::FilePath path = temp_dir.path().AppendASCII("SDCH");
+  GURL url("http://www.google.com");
+  GURL dictionary_url("http://www.google.com/dictionary");
+  std::string dictionary_text(NewSdchDictionary("www.google.com"));
+  std::string client_hash;
+  std::string server_hash;
+  SdchManager::GenerateHash(dictionary_text, &client_hash, &server_hash);
+
+  sdch_manager_->EnablePersistence(path, message_loop.message_loop_proxy());
+  sdch_manager_->set_sdch_fetcher(new ImmediateSdchFetcher(dictionary_text));
+  base::RunLoop().RunUntilIdle();
+  sdch_manager_->FetchDictionary(url, dictionary_url, false);
+  base::RunLoop().RunUntilIdle();
+  EXPECT_EQ(1U, sdch_manager_->dictionary_count());
+  EXPECT_FALSE(base::PathExists(path.AppendASCII(server_hash + ".sdch")));
+
+  // Once added, the same dictionary is persisted when fetched again for a
+  // regular request.
+  sdch_manager_->ClearData();
+  sdch_manager_->FetchDictionary(url, dictionary_url, true);
+  base::RunLoop().RunUntilIdle();
+  EXPECT_EQ(1U, sdch_manager_->dictionary_count());
+  EXPECT_TRUE(base::PathExists(path.AppendASCII(server_hash + ".sdch")));
+
+  sdch_manager_.reset();
+  base::RunLoop().RunUntilIdle();
 }
 
 TEST_F(SdchFilterTest, DictionaryNotTooLarge) {
@@ -5,16 +5,67 @@
 #include "net/base/sdch_manager.h"
 
 #include "base/base64.h"
+#include "base/bind.h"
+#include "base/file_util.h"
+#include "base/files/file_enumerator.h"
+#include "base/files/important_file_writer.h"
+#include "base/files/memory_mapped_file.h"
 #include "base/logging.h"
 #include "base/metrics/histogram.h"
+#include "base/sequenced_task_runner.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/string_util.h"
 #include "crypto/sha2.h"
 #include "net/base/registry_controlled_domains/registry_controlled_domain.h"
 #include "net/url_request/url_request_http_job.h"
 
+namespace {
+
+// Persisted dictionaries are stored in files named after their server hash,
+// with this extension.
+const char kDictionaryFileExtension[] = ".sdch";
+const base::FilePath::CharType kDictionaryFilePattern[] =
+    FILE_PATH_LITERAL("*.sdch");
+
+// Writes |dictionary_text| to |path|, preceded by a line with the URL it was
+// fetched from and a line with its expiration time.
+void WriteDictionaryFile(const base::FilePath& path,
+                         const std::string& url_spec,
+                         const base::Time& expiration,
+                         const std::string& dictionary_text) {
+  std::string data = url_spec + "\n" +
+      base::Int64ToString(expiration.ToInternalValue()) + "\n" +
+      dictionary_text;
+  base::ImportantFileWriter::WriteFileAtomically(path, data);
+}
+
+// Deletes all the dictionary files in |path|.
+void DeleteDictionaryFiles(const base::FilePath& path) {
+  base::FileEnumerator enumerator(path, false, base::FileEnumerator::FILES,
+                                  kDictionaryFilePattern);
+  for (base::FilePath file_path = enumerator.Next(); !file_path.empty();
+       file_path = enumerator.Next()) {
+    base::DeleteFile(file_path, false);
+  }
+}
+
+}  // namespace
+
 namespace net {
 
+// A dictionary read by LoadPersistedDictionaries().
+struct SdchManager::PersistedDictionary {
+  PersistedDictionary() {}
+  ~PersistedDictionary() {}
+
+  base::FilePath path;
+  GURL url;
+  base::Time expiration;
+  scoped_ptr<base::MemoryMappedFile> file;
+  // The dictionary text, including its headers, in |file|.
+  base::StringPiece text;
+};
+
 //------------------------------------------------------------------------------
 // static
 const size_t SdchManager::kMaxDictionarySize = 1000000;
@@ -22,6 +73,9 @@ const size_t SdchManager::kMaxDictionarySize = 1000000;
 // static
 const size_t SdchManager::kMaxDictionaryCount = 20;
 
+// static
+const size_t SdchManager::kMaxTotalDictionarySize = 5000000;
+
 // static
 SdchManager* SdchManager::global_ = NULL;
 
@@ -29,24 +83,38 @@ SdchManager* SdchManager::global_ = NULL;
 bool SdchManager::g_sdch_enabled_ = true;
 
 //------------------------------------------------------------------------------
-SdchManager::Dictionary::Dictionary(const std::string& dictionary_text,
-                                    size_t offset,
-                                    const std::string& client_hash,
-                                    const GURL& gurl,
-                                    const std::string& domain,
-                                    const std::string& path,
-                                    const base::Time& expiration,
-                                    const std::set<int>& ports)
-    : text_(dictionary_text, offset),
+SdchManager::Dictionary::Dictionary(
+    const base::StringPiece& dictionary_text,
+    size_t offset,
+    const std::string& client_hash,
+    const GURL& gurl,
+    const std::string& domain,
+    const std::string& path,
+    const base::Time& expiration,
+    const std::set<int>& ports,
+    base::MemoryMappedFile* mapped_file,
+    base::SequencedTaskRunner* file_task_runner)
+    : mapped_file_(mapped_file),
+      file_task_runner_(file_task_runner),
       client_hash_(client_hash),
       url_(gurl),
       domain_(domain),
       path_(path),
       expiration_(expiration),
       ports_(ports) {
+  if (mapped_file_) {
+    DCHECK(file_task_runner_.get());
+    text_ = dictionary_text.substr(offset);
+  } else {
+    dictionary_text.substr(offset).CopyToString(&owned_text_);
+    text_ = owned_text_;
+  }
 }
 
 SdchManager::Dictionary::~Dictionary() {
+  // Unmapping may block, so it is done on the file thread.
+  if (mapped_file_)
+    file_task_runner_->DeleteSoon(FROM_HERE, mapped_file_.release());
 }
 
 bool SdchManager::Dictionary::CanAdvertise(const GURL& target_url) {
@@ -206,7 +274,10 @@ bool SdchManager::Dictionary::DomainMatch(const GURL& gurl,
 }
 
 //------------------------------------------------------------------------------
-SdchManager::SdchManager() {
+SdchManager::SdchManager()
+    : dictionaries_(DictionaryMap::NO_AUTO_EVICT),
+      total_dictionary_size_(0),
+      weak_factory_(this) {
   DCHECK(!global_);
   DCHECK(CalledOnValidThread());
   global_ = this;
@@ -218,7 +289,7 @@ SdchManager::~SdchManager() {
   while (!dictionaries_.empty()) {
     DictionaryMap::iterator it = dictionaries_.begin();
     it->second->Release();
-    dictionaries_.erase(it->first);
+    dictionaries_.Erase(it);
   }
   global_ = NULL;
 }
@@ -246,6 +317,37 @@ void SdchManager::set_sdch_fetcher(SdchFetcher* fetcher) {
   fetcher_.reset(fetcher);
 }
 
+void SdchManager::EnablePersistence(
+    const base::FilePath& path,
+    const scoped_refptr<base::SequencedTaskRunner>& file_task_runner) {
+  DCHECK(CalledOnValidThread());
+  DCHECK(persistence_path_.empty());
+  persistence_path_ = path;
+  file_task_runner_ = file_task_runner;
+
+  ScopedVector<PersistedDictionary>* dictionaries =
+      new ScopedVector<PersistedDictionary>;
+  file_task_runner_->PostTaskAndReply(
+      FROM_HERE,
+      base::Bind(&SdchManager::LoadPersistedDictionaries, path, dictionaries),
+      base::Bind(&SdchManager::OnPersistedDictionariesLoaded,
+                 weak_factory_.GetWeakPtr(), file_task_runner_,
+                 base::Owned(dictionaries)));
+}
+
+void SdchManager::ClearData() {
+  DCHECK(CalledOnValidThread());
+  // Dictionaries still being loaded from disk are dropped as well.
+  weak_factory_.InvalidateWeakPtrs();
+  while (!dictionaries_.empty())
+    EraseDictionary(dictionaries_.begin());
+  allow_latency_experiment_.clear();
+  if (!persistence_path_.empty()) {
+    file_task_runner_->PostTask(
+        FROM_HERE, base::Bind(&DeleteDictionaryFiles, persistence_path_));
+  }
+}
+
 // static
 void SdchManager::EnableSdchSupport(bool enabled) {
   g_sdch_enabled_ = enabled;
@@ -332,11 +434,15 @@ bool SdchManager::IsInSupportedDomain(const GURL& url) {
 }
 
 void SdchManager::FetchDictionary(const GURL& request_url,
-                                  const GURL& dictionary_url) {
+                                  const GURL& dictionary_url,
+                                  bool persist) {
   DCHECK(CalledOnValidThread());
   if (SdchManager::Global()->CanFetchDictionary(request_url, dictionary_url) &&
-      fetcher_.get())
+      fetcher_.get()) {
+    if (!persist)
+      unpersisted_dictionary_urls_.insert(dictionary_url);
     fetcher_->Schedule(dictionary_url);
+  }
 }
 
 bool SdchManager::CanFetchDictionary(const GURL& referring_url,
@@ -375,17 +481,39 @@ bool SdchManager::CanFetchDictionary(const GURL& referring_url,
 bool SdchManager::AddSdchDictionary(const std::string& dictionary_text,
     const GURL& dictionary_url) {
   DCHECK(CalledOnValidThread());
-  std::string client_hash;
+  bool persist = unpersisted_dictionary_urls_.erase(dictionary_url) == 0;
   std::string server_hash;
-  GenerateHash(dictionary_text, &client_hash, &server_hash);
-  if (dictionaries_.find(server_hash) != dictionaries_.end()) {
+  base::Time expiration;
+  if (!AddDictionaryInternal(dictionary_text, dictionary_url, base::Time(),
+                             NULL, &server_hash, &expiration)) {
+    return false;
+  }
+  if (persist && !persistence_path_.empty()) {
+    file_task_runner_->PostTask(
+        FROM_HERE,
+        base::Bind(&WriteDictionaryFile, GetDictionaryPath(server_hash),
+                   dictionary_url.spec(), expiration, dictionary_text));
+  }
+  return true;
+}
+
+bool SdchManager::AddDictionaryInternal(
+    const base::StringPiece& dictionary_text,
+    const GURL& dictionary_url,
+    const base::Time& persisted_expiration,
+    scoped_ptr<base::MemoryMappedFile>* mapped_file,
+    std::string* server_hash,
+    base::Time* expiration) {
+  std::string client_hash;
+  GenerateHash(dictionary_text, &client_hash, server_hash);
+  if (dictionaries_.Peek(*server_hash) != dictionaries_.end()) {
     SdchErrorRecovery(DICTIONARY_ALREADY_LOADED);
     return false;  // Already loaded.
   }
 
   std::string domain, path;
   std::set<int> ports;
-  base::Time expiration(base::Time::Now() + base::TimeDelta::FromDays(30));
+  *expiration = base::Time::Now() + base::TimeDelta::FromDays(30);
 
   if (dictionary_text.empty()) {
     SdchErrorRecovery(DICTIONARY_HAS_NO_TEXT);
@@ -393,18 +521,18 @@ bool SdchManager::AddSdchDictionary(const std::string& dictionary_text,
   }
 
   size_t header_end = dictionary_text.find("\n\n");
-  if (std::string::npos == header_end) {
+  if (base::StringPiece::npos == header_end) {
     SdchErrorRecovery(DICTIONARY_HAS_NO_HEADER);
     return false;  // Missing header.
   }
   size_t line_start = 0;  // Start of line being parsed.
   while (1) {
     size_t line_end = dictionary_text.find('\n', line_start);
-    DCHECK(std::string::npos != line_end);
+    DCHECK(base::StringPiece::npos != line_end);
     DCHECK_LE(line_end, header_end);
 
     size_t colon_index = dictionary_text.find(':', line_start);
-    if (std::string::npos == colon_index) {
+    if (base::StringPiece::npos == colon_index) {
       SdchErrorRecovery(DICTIONARY_HEADER_LINE_MISSING_COLON);
       return false;  // Illegal line missing a colon.
     }
@@ -414,11 +542,13 @@ bool SdchManager::AddSdchDictionary(const std::string& dictionary_text,
 
     size_t value_start = dictionary_text.find_first_not_of(" \t",
                                                            colon_index + 1);
-    if (std::string::npos != value_start) {
+    if (base::StringPiece::npos != value_start) {
       if (value_start >= line_end)
         break;
-      std::string name(dictionary_text, line_start, colon_index - line_start);
-      std::string value(dictionary_text, value_start, line_end - value_start);
+      std::string name = dictionary_text.substr(
+          line_start, colon_index - line_start).as_string();
+      std::string value = dictionary_text.substr(
+          value_start, line_end - value_start).as_string();
       name = StringToLowerASCII(name);
       if (name == "domain") {
         domain = value;
@@ -430,7 +560,8 @@ bool SdchManager::AddSdchDictionary(const std::string& dictionary_text,
       } else if (name == "max-age") {
         int64 seconds;
         base::StringToInt64(value, &seconds);
-        expiration = base::Time::Now() + base::TimeDelta::FromSeconds(seconds);
+        *expiration =
+            base::Time::Now() + base::TimeDelta::FromSeconds(seconds);
       } else if (name == "port") {
         int port;
         base::StringToInt(value, &port);
@@ -447,41 +578,164 @@ bool SdchManager::AddSdchDictionary(const std::string& dictionary_text,
   if (!Dictionary::CanSet(domain, path, ports, dictionary_url))
     return false;
 
-  // TODO(jar): Remove these hacks to preclude a DOS attack involving piles of
-  // useless dictionaries.  We should probably have a cache eviction plan,
-  // instead of just blocking additions.  For now, with the spec in flux, it
-  // is probably not worth doing eviction handling.
+  // Refuse huge dictionaries, which would otherwise evict all others.
   if (kMaxDictionarySize < dictionary_text.size()) {
     SdchErrorRecovery(DICTIONARY_IS_TOO_LARGE);
     return false;
   }
-  if (kMaxDictionaryCount <= dictionaries_.size()) {
-    SdchErrorRecovery(DICTIONARY_COUNT_EXCEEDED);
-    return false;
-  }
+
+  // A persisted dictionary keeps the expiration it was fetched with.
+  if (!persisted_expiration.is_null())
+    *expiration = persisted_expiration;
 
   UMA_HISTOGRAM_COUNTS("Sdch3.Dictionary size loaded", dictionary_text.size());
   DVLOG(1) << "Loaded dictionary with client hash " << client_hash
-           << " and server hash " << server_hash;
+           << " and server hash " << *server_hash;
+  base::MemoryMappedFile* file = mapped_file ? mapped_file->release() : NULL;
   Dictionary* dictionary =
       new Dictionary(dictionary_text, header_end + 2, client_hash,
-                     dictionary_url, domain, path, expiration, ports);
+                     dictionary_url, domain, path, *expiration, ports, file,
+                     file ? file_task_runner_.get() : NULL);
+  EvictDictionariesFor(dictionary->text().size());
   dictionary->AddRef();
-  dictionaries_[server_hash] = dictionary;
+  dictionaries_.Put(*server_hash, dictionary);
+  total_dictionary_size_ += dictionary->text().size();
   return true;
 }
 
+void SdchManager::EvictDictionariesFor(size_t size) {
+  while (!dictionaries_.empty() &&
+         (dictionaries_.size() >= kMaxDictionaryCount ||
+          total_dictionary_size_ + size > kMaxTotalDictionarySize)) {
+    DictionaryMap::iterator oldest = dictionaries_.end();
+    --oldest;
+    DVLOG(1) << "Evicting dictionary with server hash " << oldest->first;
+    SdchErrorRecovery(DICTIONARY_EVICTED);
+    EraseDictionary(oldest);
+  }
+}
+
+void SdchManager::EraseDictionary(DictionaryMap::iterator it) {
+  if (!persistence_path_.empty()) {
+    file_task_runner_->PostTask(
+        FROM_HERE,
+        base::Bind(base::IgnoreResult(&base::DeleteFile),
+                   GetDictionaryPath(it->first), false));
+  }
+  total_dictionary_size_ -= it->second->text().size();
+  it->second->Release();
+  dictionaries_.Erase(it);
+}
+
+base::FilePath SdchManager::GetDictionaryPath(
+    const std::string& server_hash) const {
+  return persistence_path_.AppendASCII(server_hash + kDictionaryFileExtension);
+}
+
+// static
+void SdchManager::LoadPersistedDictionaries(
+    const base::FilePath& path,
+    ScopedVector<PersistedDictionary>* dictionaries) {
+  if (!file_util::CreateDirectory(path))
+    return;
+  base::FileEnumerator enumerator(
+      path, false, base::FileEnumerator::FILES,
+      kDictionaryFilePattern);
+  for (base::FilePath file_path = enumerator.Next(); !file_path.empty();
+       file_path = enumerator.Next()) {
+    scoped_ptr<PersistedDictionary> dictionary(new PersistedDictionary);
+    dictionary->path = file_path;
+    dictionary->file.reset(new base::MemoryMappedFile);
+    bool valid = dictionary->file->Initialize(file_path);
+    base::StringPiece data;
+    if (valid) {
+      data.set(reinterpret_cast<const char*>(dictionary->file->data()),
+               dictionary->file->length());
+    }
+
+    // The file starts with a line with the URL, and one with the expiration.
+    size_t url_end = data.find('\n');
+    size_t expiration_end = valid && url_end != base::StringPiece::npos ?
+        data.find('\n', url_end + 1) : base::StringPiece::npos;
+    int64 expiration = 0;
+    if (expiration_end == base::StringPiece::npos ||
+        !base::StringToInt64(
+            data.substr(url_end + 1, expiration_end - url_end - 1),
+            &expiration)) {
+      valid = false;
+    }
+    if (valid) {
+      dictionary->url = GURL(data.substr(0, url_end).as_string());
+      dictionary->expiration = base::Time::FromInternalValue(expiration);
+      dictionary->text = data.substr(expiration_end + 1);
+      valid = dictionary->url.is_valid() &&
+          dictionary->expiration > base::Time::Now();
+    }
+
+    if (!valid) {
+      dictionary.reset();
+      base::DeleteFile(file_path, false);
+      continue;
+    }
+    dictionaries->push_back(dictionary.release());
+  }
+}
+
+// static
+void SdchManager::OnPersistedDictionariesLoaded(
+    base::WeakPtr<SdchManager> manager,
+    scoped_refptr<base::SequencedTaskRunner> file_task_runner,
+    ScopedVector<PersistedDictionary>* dictionaries) {
+  for (size_t i = 0; manager && i < dictionaries->size(); ++i) {
+    PersistedDictionary* dictionary = (*dictionaries)[i];
+    // Dictionaries fetched since startup take precedence.
+    if (manager->dictionaries_.size() >= kMaxDictionaryCount ||
+        manager->total_dictionary_size_ + dictionary->text.size() >
+            kMaxTotalDictionarySize) {
+      file_task_runner->PostTask(
+          FROM_HERE, base::Bind(base::IgnoreResult(&base::DeleteFile),
+                                dictionary->path, false));
+      continue;
+    }
+    std::string server_hash;
+    base::Time expiration;
+    if (manager->AddDictionaryInternal(dictionary->text, dictionary->url,
+                                       dictionary->expiration,
+                                       &dictionary->file, &server_hash,
+                                       &expiration)) {
+      continue;
+    }
+    // Keep the file of a dictionary that was fetched again since startup.
+    if (manager->GetDictionaryPath(server_hash) != dictionary->path ||
+        manager->dictionaries_.Peek(server_hash) ==
+            manager->dictionaries_.end()) {
+      file_task_runner->PostTask(
+          FROM_HERE, base::Bind(base::IgnoreResult(&base::DeleteFile),
+                                dictionary->path, false));
+    }
+  }
+
+  // Mapped files that were not handed to a dictionary are closed on the file
+  // thread.
+  for (size_t i = 0; i < dictionaries->size(); ++i) {
+    if ((*dictionaries)[i]->file)
+      file_task_runner->DeleteSoon(FROM_HERE,
+                                   (*dictionaries)[i]->file.release());
+  }
+}
+
 void SdchManager::GetVcdiffDictionary(const std::string& server_hash,
     const GURL& referring_url, Dictionary** dictionary) {
   DCHECK(CalledOnValidThread());
   *dictionary = NULL;
-  DictionaryMap::iterator it = dictionaries_.find(server_hash);
+  DictionaryMap::iterator it = dictionaries_.Peek(server_hash);
   if (it == dictionaries_.end()) {
     return;
   }
   Dictionary* matching_dictionary = it->second;
   if (!matching_dictionary->CanUse(referring_url))
     return;
+  dictionaries_.Get(server_hash);  // Mark as most recently used.
   *dictionary = matching_dictionary;
 }
 
@@ -507,7 +761,7 @@ void SdchManager::GetAvailDictionaryList(const GURL& target_url,
 }
 
 // static
-void SdchManager::GenerateHash(const std::string& dictionary_text,
+void SdchManager::GenerateHash(const base::StringPiece& dictionary_text,
     std::string* client_hash, std::string* server_hash) {
   char binary_hash[32];
   crypto::SHA256HashString(dictionary_text, binary_hash, sizeof(binary_hash));
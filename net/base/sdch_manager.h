@@ -11,7 +11,10 @@
 // The SdchManager maintains a collection of memory resident dictionaries.  It
 // can find a dictionary (based on a server specification of a hash), store a
 // dictionary, and make judgements about what URLs can use, set, etc. a
-// dictionary.
+// dictionary.  The collection is bounded in count and total size, and the
+// least recently used dictionaries are evicted to make room for new ones.
+// Optionally, dictionaries are persisted as files, which are memory mapped
+// when loaded by the next run.
 
 // These dictionaries are acquired over the net, and include a header
 // (containing metadata) as well as a VCDIFF dictionary (for use by a VCDIFF
@@ -24,14 +27,24 @@
 #include <set>
 #include <string>
 
+#include "base/containers/mru_cache.h"
+#include "base/files/file_path.h"
 #include "base/gtest_prod_util.h"
 #include "base/memory/ref_counted.h"
 #include "base/memory/scoped_ptr.h"
+#include "base/memory/scoped_vector.h"
+#include "base/memory/weak_ptr.h"
+#include "base/strings/string_piece.h"
 #include "base/threading/non_thread_safe.h"
 #include "base/time/time.h"
 #include "net/base/net_export.h"
 #include "url/gurl.h"
 
+namespace base {
+class MemoryMappedFile;
+class SequencedTaskRunner;
+}
+
 namespace net {
 
 //------------------------------------------------------------------------------
@@ -103,7 +116,7 @@ class NET_EXPORT SdchManager : public NON_EXPORTED_BASE(base::NonThreadSafe) {
     DICTIONARY_ALREADY_LOADED = 32,
     DICTIONARY_SELECTED_FROM_NON_HTTP = 33,
     DICTIONARY_IS_TOO_LARGE= 34,
-    DICTIONARY_COUNT_EXCEEDED = 35,
+    // defunct = 35,  // DICTIONARY_COUNT_EXCEEDED (LRU dictionary is evicted).
     DICTIONARY_ALREADY_SCHEDULED_TO_DOWNLOAD = 36,
     DICTIONARY_ALREADY_TRIED_TO_DOWNLOAD = 37,
 
@@ -117,6 +130,7 @@ class NET_EXPORT SdchManager : public NON_EXPORTED_BASE(base::NonThreadSafe) {
 
     // Dictionary manager issues.
     DOMAIN_BLACKLIST_INCLUDES_TARGET = 61,
+    DICTIONARY_EVICTED = 62,  // To make room for a new dictionary.
 
     // Problematic decode recovery methods.
     META_REFRESH_RECOVERY = 70,            // Dictionary not found.
@@ -155,17 +169,19 @@ class NET_EXPORT SdchManager : public NON_EXPORTED_BASE(base::NonThreadSafe) {
     MAX_PROBLEM_CODE  // Used to bound histogram.
   };
 
-  // Use the following static limits to block DOS attacks until we implement
-  // a cached dictionary evicition strategy.
+  // Dictionaries larger than kMaxDictionarySize are refused. Once there are
+  // kMaxDictionaryCount dictionaries, or their total size would exceed
+  // kMaxTotalDictionarySize, the least recently used ones are evicted.
   static const size_t kMaxDictionarySize;
   static const size_t kMaxDictionaryCount;
+  static const size_t kMaxTotalDictionarySize;
 
   // There is one instance of |Dictionary| for each memory-cached SDCH
   // dictionary.
   class NET_EXPORT_PRIVATE Dictionary : public base::RefCounted<Dictionary> {
    public:
     // Sdch filters can get our text to use in decoding compressed data.
-    const std::string& text() const { return text_; }
+    const base::StringPiece& text() const { return text_; }
 
    private:
     friend class base::RefCounted<Dictionary>;
@@ -175,14 +191,19 @@ class NET_EXPORT SdchManager : public NON_EXPORTED_BASE(base::NonThreadSafe) {
     // Construct a vc-diff usable dictionary from the dictionary_text starting
     // at the given offset.  The supplied client_hash should be used to
     // advertise the dictionary's availability relative to the suppplied URL.
-    Dictionary(const std::string& dictionary_text,
+    // If |mapped_file| is NULL the text is copied. Otherwise |dictionary_text|
+    // points into |mapped_file|, which the dictionary takes ownership of, and
+    // which is released on |file_task_runner|.
+    Dictionary(const base::StringPiece& dictionary_text,
                size_t offset,
                const std::string& client_hash,
                const GURL& url,
                const std::string& domain,
                const std::string& path,
                const base::Time& expiration,
-               const std::set<int>& ports);
+               const std::set<int>& ports,
+               base::MemoryMappedFile* mapped_file,
+               base::SequencedTaskRunner* file_task_runner);
     ~Dictionary();
 
     const GURL& url() const { return url_; }
@@ -209,8 +230,11 @@ class NET_EXPORT SdchManager : public NON_EXPORTED_BASE(base::NonThreadSafe) {
     static bool DomainMatch(const GURL& url, const std::string& restriction);
 
 
-    // The actual text of the dictionary.
-    std::string text_;
+    // The actual text of the dictionary, in |owned_text_| or |mapped_file_|.
+    base::StringPiece text_;
+    std::string owned_text_;
+    scoped_ptr<base::MemoryMappedFile> mapped_file_;
+    scoped_refptr<base::SequencedTaskRunner> file_task_runner_;
 
     // Part of the hash of text_ that the client uses to advertise the fact that
     // it has a specific dictionary pre-cached.
@@ -246,6 +270,21 @@ class NET_EXPORT SdchManager : public NON_EXPORTED_BASE(base::NonThreadSafe) {
   // Register a fetcher that this class can use to obtain dictionaries.
   void set_sdch_fetcher(SdchFetcher* fetcher);
 
+  // Persists the dictionaries added from now on as files in the directory
+  // |path|, and starts loading the dictionaries persisted there by earlier
+  // runs. Loaded dictionaries are memory mapped rather than read into memory.
+  // All file operations are done on |file_task_runner|.
+  // The manager is shared by all URLRequestContexts, so dictionaries that
+  // were fetched with |persist| false, i.e. for off the record requests, are
+  // kept in memory only: the files record the sites that were visited.
+  void EnablePersistence(
+      const base::FilePath& path,
+      const scoped_refptr<base::SequencedTaskRunner>& file_task_runner);
+
+  // Removes all dictionaries, including their files if they were persisted,
+  // and forgets the domains allowed to run the latency experiment.
+  void ClearData();
+
   // Enables or disables SDCH compression.
   static void EnableSdchSupport(bool enabled);
 
@@ -286,8 +325,11 @@ class NET_EXPORT SdchManager : public NON_EXPORTED_BASE(base::NonThreadSafe) {
   // Schedule the URL fetching to load a dictionary. This will always return
   // before the dictionary is actually loaded and added.
   // After the implied task does completes, the dictionary will have been
-  // cached in memory.
-  void FetchDictionary(const GURL& request_url, const GURL& dictionary_url);
+  // cached in memory. If |persist| is false, the dictionary is not written to
+  // disk even when persistence is enabled.
+  void FetchDictionary(const GURL& request_url,
+                       const GURL& dictionary_url,
+                       bool persist);
 
   // Security test function used before initiating a FetchDictionary.
   // Return true if fetch is legal.
@@ -304,7 +346,8 @@ class NET_EXPORT SdchManager : public NON_EXPORTED_BASE(base::NonThreadSafe) {
   // after the meta-data headers like Domain:...) with the given |server_hash|
   // to use to decompreses data that arrived as SDCH encoded content.  Check to
   // be sure the returned |dictionary| can be used for decoding content supplied
-  // in response to a request for |referring_url|.
+  // in response to a request for |referring_url|.  A returned dictionary
+  // becomes the most recently used one.
   // Caller is responsible for AddRef()ing the dictionary, and Release()ing it
   // when done.
   // Return null in |dictionary| if there is no matching legal dictionary.
@@ -320,9 +363,13 @@ class NET_EXPORT SdchManager : public NON_EXPORTED_BASE(base::NonThreadSafe) {
   // Construct the pair of hashes for client and server to identify an SDCH
   // dictionary.  This is only made public to facilitate unit testing, but is
   // otherwise private
-  static void GenerateHash(const std::string& dictionary_text,
+  static void GenerateHash(const base::StringPiece& dictionary_text,
                            std::string* client_hash, std::string* server_hash);
 
+  // The number of dictionaries held, and the total size of their text.
+  size_t dictionary_count() const { return dictionaries_.size(); }
+  size_t total_dictionary_size() const { return total_dictionary_size_; }
+
   // For Latency testing only, we need to know if we've succeeded in doing a
   // round trip before starting our comparative tests.  If ever we encounter
   // problems with SDCH, we opt-out of the test unless/until we perform a
@@ -332,11 +379,14 @@ class NET_EXPORT SdchManager : public NON_EXPORTED_BASE(base::NonThreadSafe) {
   void SetAllowLatencyExperiment(const GURL& url, bool enable);
 
  private:
+  struct PersistedDictionary;
+
   typedef std::map<std::string, int> DomainCounter;
   typedef std::set<std::string> ExperimentSet;
 
-  // A map of dictionaries info indexed by the hash that the server provides.
-  typedef std::map<std::string, Dictionary*> DictionaryMap;
+  // A map of dictionaries info indexed by the hash that the server provides,
+  // ordered by recency of use.
+  typedef base::MRUCache<std::string, Dictionary*> DictionaryMap;
 
   // The one global instance of that holds all the data.
   static SdchManager* global_;
@@ -347,8 +397,57 @@ class NET_EXPORT SdchManager : public NON_EXPORTED_BASE(base::NonThreadSafe) {
   // A simple implementation of a RFC 3548 "URL safe" base64 encoder.
   static void UrlSafeBase64Encode(const std::string& input,
                                   std::string* output);
+
+  // Validates the headers of |dictionary_text| against |dictionary_url| and
+  // adds the dictionary, setting |server_hash| and |expiration|. A non-null
+  // |persisted_expiration| overrides the max-age header. If |mapped_file| is
+  // set, |dictionary_text| points into it, and on success the dictionary
+  // takes ownership of it.
+  bool AddDictionaryInternal(const base::StringPiece& dictionary_text,
+                             const GURL& dictionary_url,
+                             const base::Time& persisted_expiration,
+                             scoped_ptr<base::MemoryMappedFile>* mapped_file,
+                             std::string* server_hash,
+                             base::Time* expiration);
+
+  // Evicts the least recently used dictionaries until one of |size| bytes
+  // fits within the limits.
+  void EvictDictionariesFor(size_t size);
+
+  // Removes the dictionary at |it|, and its file if it was persisted.
+  void EraseDictionary(DictionaryMap::iterator it);
+
+  // Returns the file in which the dictionary of |server_hash| is persisted.
+  base::FilePath GetDictionaryPath(const std::string& server_hash) const;
+
+  // Reads the dictionaries persisted in |path| into |dictionaries|, deleting
+  // the files that are expired or corrupt. Runs on the file task runner.
+  static void LoadPersistedDictionaries(
+      const base::FilePath& path,
+      ScopedVector<PersistedDictionary>* dictionaries);
+
+  // Adds the dictionaries read by LoadPersistedDictionaries(), and releases
+  // the files of those that were not added on |file_task_runner|.
+  static void OnPersistedDictionariesLoaded(
+      base::WeakPtr<SdchManager> manager,
+      scoped_refptr<base::SequencedTaskRunner> file_task_runner,
+      ScopedVector<PersistedDictionary>* dictionaries);
+
   DictionaryMap dictionaries_;
 
+  // The total size of the text of |dictionaries_|.
+  size_t total_dictionary_size_;
+
+  // The directory dictionaries are persisted in, and the task runner for the
+  // file operations on it. Empty unless EnablePersistence() was called.
+  base::FilePath persistence_path_;
+  scoped_refptr<base::SequencedTaskRunner> file_task_runner_;
+
+  // The dictionaries scheduled to be fetched that must not be persisted. A
+  // fetch for one of them with |persist| true does not remove it, so that a
+  // dictionary is never written once an off the record request asked for it.
+  std::set<GURL> unpersisted_dictionary_urls_;
+
   // An instance that can fetch a dictionary given a URL.
   scoped_ptr<SdchFetcher> fetcher_;
 
@@ -364,6 +463,8 @@ class NET_EXPORT SdchManager : public NON_EXPORTED_BASE(base::NonThreadSafe) {
   // round trip test has recently passed).
   ExperimentSet allow_latency_experiment_;
 
+  base::WeakPtrFactory<SdchManager> weak_factory_;
+
   DISALLOW_COPY_AND_ASSIGN(SdchManager);
 };
 
@@ -0,0 +1,75 @@
+// Copyright 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <vector>
+
+#include "base/file_util.h"
+#include "base/files/scoped_temp_dir.h"
+#include "base/memory/scoped_vector.h"
+#include "base/message_loop/message_loop.h"
+#include "base/perftimer.h"
+#include "base/threading/thread.h"
+#include "base/time/time.h"
+#include "net/base/io_buffer.h"
+#include "net/base/net_errors.h"
+#include "net/base/test_completion_callback.h"
+#include "net/base/upload_data_stream.h"
+#include "net/base/upload_file_element_reader.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace net {
+
+namespace {
+
+const int kFiles = 8;
+const int kFileSize = 4 * 1024 * 1024;
+const int kUploads = 8;
+
+// The size of the buffer HttpStreamParser reads the request body into.
+const int kReadSize = 16 * 1024;
+
+// Measures how fast a POST of several files is read, with the file
+// operations performed on a separate thread like in the browser.
+TEST(UploadDataStreamPerfTest, ReadFiles) {
+  base::MessageLoopForIO message_loop;
+  base::Thread file_thread("UploadFileThread");
+  ASSERT_TRUE(file_thread.Start());
+
+  base::ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+  const std::vector<char> data(kFileSize, 'x');
+  std::vector<base::FilePath> paths;
+  for (int i = 0; i < kFiles; ++i) {
+    base::FilePath path;
+    ASSERT_TRUE(file_util::CreateTemporaryFileInDir(temp_dir.path(), &path));
+    ASSERT_EQ(kFileSize, file_util::WriteFile(path, &data[0], data.size()));
+    paths.push_back(path);
+  }
+
+  scoped_refptr<IOBuffer> buf(new IOBuffer(kReadSize));
+  PerfTimeLogger timer("UploadDataStream_ReadFiles");
+  for (int i = 0; i < kUploads; ++i) {
+    ScopedVector<UploadElementReader> element_readers;
+    for (size_t j = 0; j < paths.size(); ++j) {
+      element_readers.push_back(new UploadFileElementReader(
+          file_thread.message_loop_proxy().get(), paths[j], 0, kuint64max,
+          base::Time()));
+    }
+    UploadDataStream stream(&element_readers, 0);
+    TestCompletionCallback init_callback;
+    ASSERT_EQ(OK, init_callback.GetResult(
+        stream.Init(init_callback.callback())));
+
+    while (!stream.IsEOF()) {
+      TestCompletionCallback read_callback;
+      ASSERT_LT(0, read_callback.GetResult(
+          stream.Read(buf.get(), kReadSize, read_callback.callback())));
+    }
+  }
+  timer.Done();
+}
+
+}  // namespace
+
+}  // namespace net
@@ -7,6 +7,7 @@
 #include "base/bind.h"
 #include "base/file_util.h"
 #include "base/location.h"
+#include "base/message_loop/message_loop.h"
 #include "base/task_runner_util.h"
 #include "net/base/file_stream.h"
 #include "net/base/io_buffer.h"
@@ -92,6 +93,12 @@ int ReadInternal(scoped_refptr<IOBuffer> buf,
 
 }  // namespace
 
+// static
+const int UploadFileElementReader::kReadAheadChunkSize = 64 * 1024;
+
+// static
+const uint64 UploadFileElementReader::kMaxReadAheadSize = 256 * 1024;
+
 UploadFileElementReader::FileStreamDeleter::FileStreamDeleter(
     base::TaskRunner* task_runner) : task_runner_(task_runner) {
   DCHECK(task_runner_.get());
@@ -122,6 +129,11 @@ UploadFileElementReader::UploadFileElementReader(
       file_stream_(NULL, FileStreamDeleter(task_runner_.get())),
       content_length_(0),
       bytes_remaining_(0),
+      read_ahead_size_(0),
+      bytes_to_read_ahead_(0),
+      is_reading_ahead_(false),
+      read_ahead_error_(OK),
+      pending_read_buf_length_(0),
       weak_ptr_factory_(this) {
   DCHECK(task_runner_.get());
 }
@@ -173,27 +185,26 @@ int UploadFileElementReader::Read(IOBuffer* buf,
                                   int buf_length,
                                   const CompletionCallback& callback) {
   DCHECK(!callback.is_null());
+  DCHECK_LT(0, buf_length);
+  DCHECK(pending_read_callback_.is_null());
 
   if (BytesRemaining() == 0)
     return 0;
 
-  // Save the value of file_stream_.get() before base::Passed() invalidates it.
-  FileStream* file_stream_ptr = file_stream_.get();
-  // Pass the ownership of file_stream_ to the worker pool to safely perform
-  // operation even when |this| is destructed before the read completes.
-  const bool posted = base::PostTaskAndReplyWithResult(
-      task_runner_.get(),
-      FROM_HERE,
-      base::Bind(&ReadInternal,
-                 scoped_refptr<IOBuffer>(buf),
-                 buf_length,
-                 BytesRemaining(),
-                 file_stream_ptr),
-      base::Bind(&UploadFileElementReader::OnReadCompleted,
-                 weak_ptr_factory_.GetWeakPtr(),
-                 base::Passed(&file_stream_),
-                 callback));
-  DCHECK(posted);
+  pending_read_buf_ = buf;
+  pending_read_buf_length_ = buf_length;
+  pending_read_callback_ = callback;
+
+  if (read_ahead_size_ > 0 || read_ahead_error_ != OK) {
+    // The result is already known, so complete the read without going
+    // through |task_runner_|. It still completes asynchronously, like the
+    // reads that have to wait for the file.
+    base::MessageLoop::current()->PostTask(
+        FROM_HERE,
+        base::Bind(&UploadFileElementReader::CompletePendingRead,
+                   weak_ptr_factory_.GetWeakPtr()));
+  }
+  ReadAheadIfNecessary();
   return ERR_IO_PENDING;
 }
 
@@ -202,6 +213,14 @@ void UploadFileElementReader::Reset() {
   bytes_remaining_ = 0;
   content_length_ = 0;
   file_stream_.reset();
+  read_ahead_buffers_.clear();
+  read_ahead_size_ = 0;
+  bytes_to_read_ahead_ = 0;
+  is_reading_ahead_ = false;
+  read_ahead_error_ = OK;
+  pending_read_buf_ = NULL;
+  pending_read_buf_length_ = 0;
+  pending_read_callback_.Reset();
 }
 
 void UploadFileElementReader::OnInitCompleted(
@@ -212,21 +231,101 @@ void UploadFileElementReader::OnInitCompleted(
   file_stream_.swap(*file_stream);
   content_length_ = *content_length;
   bytes_remaining_ = GetContentLength();
+  bytes_to_read_ahead_ = bytes_remaining_;
   if (!callback.is_null())
     callback.Run(result);
 }
 
-void UploadFileElementReader::OnReadCompleted(
+void UploadFileElementReader::ReadAheadIfNecessary() {
+  if (is_reading_ahead_ || read_ahead_error_ != OK ||
+      bytes_to_read_ahead_ == 0 || read_ahead_size_ >= kMaxReadAheadSize) {
+    return;
+  }
+
+  const int buf_length = static_cast<int>(std::min(
+      bytes_to_read_ahead_, static_cast<uint64>(kReadAheadChunkSize)));
+  scoped_refptr<IOBuffer> buf(new IOBuffer(buf_length));
+  is_reading_ahead_ = true;
+
+  // Save the value of file_stream_.get() before base::Passed() invalidates it.
+  FileStream* file_stream_ptr = file_stream_.get();
+  // Pass the ownership of file_stream_ to the worker pool to safely perform
+  // operation even when |this| is destructed before the read completes.
+  const bool posted = base::PostTaskAndReplyWithResult(
+      task_runner_.get(),
+      FROM_HERE,
+      base::Bind(&ReadInternal,
+                 buf,
+                 buf_length,
+                 bytes_to_read_ahead_,
+                 file_stream_ptr),
+      base::Bind(&UploadFileElementReader::OnReadAheadCompleted,
+                 weak_ptr_factory_.GetWeakPtr(),
+                 buf,
+                 base::Passed(&file_stream_)));
+  DCHECK(posted);
+}
+
+void UploadFileElementReader::OnReadAheadCompleted(
+    scoped_refptr<IOBuffer> buf,
     ScopedFileStreamPtr file_stream,
-    const CompletionCallback& callback,
     int result) {
+  DCHECK(is_reading_ahead_);
   file_stream_.swap(file_stream);
+  is_reading_ahead_ = false;
+
+  // ReadInternal() never returns 0 for a non-empty read.
+  DCHECK_NE(0, result);
   if (result > 0) {
+    DCHECK_GE(bytes_to_read_ahead_, static_cast<uint64>(result));
+    bytes_to_read_ahead_ -= result;
+    read_ahead_buffers_.push_back(new DrainableIOBuffer(buf.get(), result));
+    read_ahead_size_ += result;
+  } else {
+    read_ahead_error_ = result;
+  }
+
+  ReadAheadIfNecessary();
+  CompletePendingRead();
+}
+
+void UploadFileElementReader::CompletePendingRead() {
+  if (pending_read_callback_.is_null())
+    return;
+
+  int result = 0;
+  if (read_ahead_size_ > 0) {
+    while (result < pending_read_buf_length_ && !read_ahead_buffers_.empty()) {
+      DrainableIOBuffer* read_ahead_buf = read_ahead_buffers_.front().get();
+      const int num_bytes = std::min(pending_read_buf_length_ - result,
+                                     read_ahead_buf->BytesRemaining());
+      memcpy(pending_read_buf_->data() + result, read_ahead_buf->data(),
+             num_bytes);
+      read_ahead_buf->DidConsume(num_bytes);
+      if (read_ahead_buf->BytesRemaining() == 0)
+        read_ahead_buffers_.pop_front();
+      result += num_bytes;
+    }
+    DCHECK_GE(read_ahead_size_, static_cast<uint64>(result));
+    read_ahead_size_ -= result;
     DCHECK_GE(bytes_remaining_, static_cast<uint64>(result));
     bytes_remaining_ -= result;
+  } else if (read_ahead_error_ != OK) {
+    result = read_ahead_error_;
+  } else {
+    // Wait for the read in flight.
+    DCHECK(is_reading_ahead_);
+    return;
   }
-  if (!callback.is_null())
-    callback.Run(result);
+
+  CompletionCallback callback = pending_read_callback_;
+  pending_read_callback_.Reset();
+  pending_read_buf_ = NULL;
+  pending_read_buf_length_ = 0;
+
+  // Keep reading ahead while the caller consumes |result|.
+  ReadAheadIfNecessary();
+  callback.Run(result);
 }
 
 UploadFileElementReader::ScopedOverridingContentLengthForTests::
@@ -5,6 +5,8 @@
 #ifndef NET_BASE_UPLOAD_FILE_ELEMENT_READER_H_
 #define NET_BASE_UPLOAD_FILE_ELEMENT_READER_H_
 
+#include <deque>
+
 #include "base/compiler_specific.h"
 #include "base/files/file_path.h"
 #include "base/gtest_prod_util.h"
@@ -20,9 +22,16 @@ class TaskRunner;
 
 namespace net {
 
+class DrainableIOBuffer;
 class FileStream;
 
 // An UploadElementReader implementation for file.
+//
+// The file is read ahead on |task_runner| in chunks of kReadAheadChunkSize
+// bytes, one at a time, while previously read data is being consumed, so
+// that uploading a large file doesn't wait for a file thread round trip on
+// each Read(). At most kMaxReadAheadSize bytes are buffered; reading ahead
+// resumes once the consumer has caught up.
 class NET_EXPORT UploadFileElementReader : public UploadElementReader {
  public:
   // |task_runner| is used to perform file operations. It must not be NULL.
@@ -40,6 +49,12 @@ class NET_EXPORT UploadFileElementReader : public UploadElementReader {
     return expected_modification_time_;
   }
 
+  // Size of each read performed on the task runner.
+  static const int kReadAheadChunkSize;
+
+  // Maximum number of bytes read ahead of the consumer.
+  static const uint64 kMaxReadAheadSize;
+
   // UploadElementReader overrides:
   virtual const UploadFileElementReader* AsFileReader() const OVERRIDE;
   virtual int Init(const CompletionCallback& callback) OVERRIDE;
@@ -81,10 +96,21 @@ class NET_EXPORT UploadFileElementReader : public UploadElementReader {
                        const CompletionCallback& callback,
                        int result);
 
-  // This method is used to implement Read().
-  void OnReadCompleted(ScopedFileStreamPtr file_stream,
-                       const CompletionCallback& callback,
-                       int result);
+  // Starts reading the next chunk of the file on |task_runner_|, unless a
+  // read is already in flight, the file has been read entirely, an error
+  // occurred or enough data is buffered.
+  void ReadAheadIfNecessary();
+
+  // Called when a read started by ReadAheadIfNecessary() completes.
+  void OnReadAheadCompleted(scoped_refptr<IOBuffer> buf,
+                            ScopedFileStreamPtr file_stream,
+                            int result);
+
+  // Completes the pending Read() with the buffered data or the read ahead
+  // error, if any. Does nothing if there is no pending Read() or if it must
+  // wait for the read in flight. The callback is run last, as it may delete
+  // |this|.
+  void CompletePendingRead();
 
   // Sets an value to override the result for GetContentLength().
   // Used for tests.
@@ -101,6 +127,25 @@ class NET_EXPORT UploadFileElementReader : public UploadElementReader {
   ScopedFileStreamPtr file_stream_;
   uint64 content_length_;
   uint64 bytes_remaining_;
+
+  // Data read ahead of the consumer, in file order.
+  std::deque<scoped_refptr<DrainableIOBuffer> > read_ahead_buffers_;
+  // Total number of bytes remaining in |read_ahead_buffers_|.
+  uint64 read_ahead_size_;
+  // Number of bytes of the element which have not been read from the file.
+  uint64 bytes_to_read_ahead_;
+  // True while a read is in flight on |task_runner_|. |file_stream_| is NULL
+  // meanwhile.
+  bool is_reading_ahead_;
+  // The error of the last read ahead, returned once the buffered data has
+  // been consumed. OK if there was none.
+  int read_ahead_error_;
+
+  // The Read() waiting for data, if any.
+  scoped_refptr<IOBuffer> pending_read_buf_;
+  int pending_read_buf_length_;
+  CompletionCallback pending_read_callback_;
+
   base::WeakPtrFactory<UploadFileElementReader> weak_ptr_factory_;
 
   DISALLOW_COPY_AND_ASSIGN(UploadFileElementReader);
@@ -4,6 +4,8 @@
 
 #include "net/base/upload_file_element_reader.h"
 
+#include <algorithm>
+
 #include "base/file_util.h"
 #include "base/files/scoped_temp_dir.h"
 #include "base/message_loop/message_loop_proxy.h"
@@ -196,6 +198,44 @@ TEST_F(UploadFileElementReaderTest, Range) {
   EXPECT_EQ(expected, buf);
 }
 
+// Reads a file larger than the read ahead window in pieces which do not line
+// up with the read ahead chunks.
+TEST_F(UploadFileElementReaderTest, ReadLargeFile) {
+  const size_t kFileSize = UploadFileElementReader::kMaxReadAheadSize * 2 +
+      UploadFileElementReader::kReadAheadChunkSize / 2 + 3;
+  std::vector<char> bytes(kFileSize);
+  for (size_t i = 0; i < bytes.size(); ++i)
+    bytes[i] = static_cast<char>(i % 251);
+  ASSERT_EQ(static_cast<int>(bytes.size()),
+            file_util::WriteFile(temp_file_path_, &bytes[0], bytes.size()));
+
+  reader_.reset(
+      new UploadFileElementReader(base::MessageLoopProxy::current().get(),
+                                  temp_file_path_,
+                                  0,
+                                  kuint64max,
+                                  base::Time()));
+  TestCompletionCallback init_callback;
+  ASSERT_EQ(ERR_IO_PENDING, reader_->Init(init_callback.callback()));
+  EXPECT_EQ(OK, init_callback.WaitForResult());
+  EXPECT_EQ(kFileSize, reader_->GetContentLength());
+
+  const int kBufferSize = 16 * 1024 - 1;
+  scoped_refptr<IOBuffer> buf = new IOBuffer(kBufferSize);
+  std::vector<char> read_bytes;
+  while (reader_->BytesRemaining() > 0) {
+    const size_t expected_size =
+        std::min(static_cast<uint64>(kBufferSize), reader_->BytesRemaining());
+    TestCompletionCallback read_callback;
+    ASSERT_EQ(ERR_IO_PENDING,
+              reader_->Read(buf.get(), kBufferSize, read_callback.callback()));
+    ASSERT_EQ(static_cast<int>(expected_size), read_callback.WaitForResult());
+    read_bytes.insert(read_bytes.end(), buf->data(),
+                      buf->data() + expected_size);
+  }
+  EXPECT_EQ(bytes, read_bytes);
+}
+
 TEST_F(UploadFileElementReaderTest, FileChanged) {
   base::PlatformFileInfo info;
   ASSERT_TRUE(file_util::GetFileInfo(temp_file_path_, &info));
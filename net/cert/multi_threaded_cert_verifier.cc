@@ -11,6 +11,7 @@
 #include "base/compiler_specific.h"
 #include "base/message_loop/message_loop.h"
 #include "base/metrics/histogram.h"
+#include "base/pickle.h"
 #include "base/stl_util.h"
 #include "base/synchronization/lock.h"
 #include "base/threading/worker_pool.h"
@@ -72,15 +73,26 @@ namespace net {
 
 namespace {
 
-// The default value of max_cache_entries_.
-const unsigned kMaxCacheEntries = 256;
+// The default value of max_cache_entries_. Large enough to hold the hosts
+// of a browsing session, since the cache is persisted across restarts.
+const unsigned kMaxCacheEntries = 1024;
 
 // The number of seconds for which we'll cache a cache entry.
 const unsigned kTTLSecs = 1800;  // 30 minutes.
 
+// The version of the pickles written by PersistCache(). Pickles of another
+// version are ignored.
+const int kCachePickleVersion = 1;
+
+uint32 GetCRLSetSequence(const CRLSet* crl_set) {
+  return crl_set ? crl_set->sequence() : 0;
+}
+
 }  // namespace
 
-MultiThreadedCertVerifier::CachedResult::CachedResult() : error(ERR_FAILED) {}
+MultiThreadedCertVerifier::CachedResult::CachedResult()
+    : error(ERR_FAILED),
+      crl_set_sequence(0) {}
 
 MultiThreadedCertVerifier::CachedResult::~CachedResult() {}
 
@@ -258,6 +270,7 @@ class CertVerifierWorker {
                                      hostname_,
                                      flags_,
                                      additional_trust_anchors_,
+                                     GetCRLSetSequence(crl_set_.get()),
                                      error_,
                                      verify_result_);
       }
@@ -395,7 +408,8 @@ MultiThreadedCertVerifier::MultiThreadedCertVerifier(
       cache_hits_(0),
       inflight_joins_(0),
       verify_proc_(verify_proc),
-      trust_anchor_provider_(NULL) {
+      trust_anchor_provider_(NULL),
+      delegate_(NULL) {
   CertDatabase::GetInstance()->AddObserver(this);
 }
 
@@ -410,6 +424,134 @@ void MultiThreadedCertVerifier::SetCertTrustAnchorProvider(
   trust_anchor_provider_ = trust_anchor_provider;
 }
 
+void MultiThreadedCertVerifier::SetDelegate(Delegate* delegate) {
+  DCHECK(CalledOnValidThread());
+  delegate_ = delegate;
+}
+
+void MultiThreadedCertVerifier::PersistCache(Pickle* pickle) const {
+  DCHECK(CalledOnValidThread());
+
+  const CacheValidityPeriod now(base::Time::Now());
+  uint64 count = 0;
+  for (CertVerifierCache::Iterator it(cache_); it.HasNext(); it.Advance()) {
+    if (ShouldPersist(it, now))
+      ++count;
+  }
+
+  pickle->WriteInt(kCachePickleVersion);
+  pickle->WriteUInt64(count);
+  for (CertVerifierCache::Iterator it(cache_); it.HasNext(); it.Advance()) {
+    if (!ShouldPersist(it, now))
+      continue;
+    const RequestParams& key = it.key();
+    const CachedResult& cached_result = it.value();
+    const CacheValidityPeriod& expiration = it.expiration();
+
+    pickle->WriteString(key.hostname);
+    pickle->WriteInt(key.flags);
+    for (size_t j = 0; j < key.hash_values.size(); ++j) {
+      pickle->WriteBytes(key.hash_values[j].data,
+                         sizeof(key.hash_values[j].data));
+    }
+    pickle->WriteInt64(expiration.verification_time.ToInternalValue());
+    pickle->WriteInt64(expiration.expiration_time.ToInternalValue());
+
+    const CertVerifyResult& result = cached_result.result;
+    pickle->WriteInt(cached_result.error);
+    pickle->WriteUInt32(cached_result.crl_set_sequence);
+    result.verified_cert->Persist(pickle);
+    pickle->WriteUInt32(result.cert_status);
+    pickle->WriteBool(result.has_md5);
+    pickle->WriteBool(result.has_md2);
+    pickle->WriteBool(result.has_md4);
+    pickle->WriteBool(result.is_issued_by_known_root);
+    pickle->WriteBool(result.is_issued_by_additional_trust_anchor);
+    pickle->WriteUInt64(result.public_key_hashes.size());
+    for (size_t j = 0; j < result.public_key_hashes.size(); ++j)
+      pickle->WriteString(result.public_key_hashes[j].ToString());
+  }
+}
+
+bool MultiThreadedCertVerifier::LoadCache(const Pickle& pickle) {
+  DCHECK(CalledOnValidThread());
+
+  PickleIterator iter(pickle);
+  int version;
+  uint64 count;
+  if (!pickle.ReadInt(&iter, &version) || version != kCachePickleVersion ||
+      !pickle.ReadUInt64(&iter, &count)) {
+    return false;
+  }
+
+  const CacheValidityPeriod now(base::Time::Now());
+  const CacheExpirationFunctor expiration_functor;
+  const CertificateList empty_cert_list;
+  for (uint64 i = 0; i < count; ++i) {
+    std::string hostname;
+    int flags;
+    SHA1HashValue cert_fingerprint;
+    SHA1HashValue ca_fingerprint;
+    const char* cert_fingerprint_data;
+    const char* ca_fingerprint_data;
+    int64 verification_time;
+    int64 expiration_time;
+    if (!pickle.ReadString(&iter, &hostname) ||
+        !pickle.ReadInt(&iter, &flags) ||
+        !pickle.ReadBytes(&iter, &cert_fingerprint_data,
+                          sizeof(cert_fingerprint.data)) ||
+        !pickle.ReadBytes(&iter, &ca_fingerprint_data,
+                          sizeof(ca_fingerprint.data)) ||
+        !pickle.ReadInt64(&iter, &verification_time) ||
+        !pickle.ReadInt64(&iter, &expiration_time)) {
+      return false;
+    }
+    memcpy(cert_fingerprint.data, cert_fingerprint_data,
+           sizeof(cert_fingerprint.data));
+    memcpy(ca_fingerprint.data, ca_fingerprint_data,
+           sizeof(ca_fingerprint.data));
+
+    CachedResult cached_result;
+    CertVerifyResult& result = cached_result.result;
+    uint64 public_key_hash_count;
+    if (!pickle.ReadInt(&iter, &cached_result.error) ||
+        !pickle.ReadUInt32(&iter, &cached_result.crl_set_sequence)) {
+      return false;
+    }
+    result.verified_cert = X509Certificate::CreateFromPickle(
+        pickle, &iter, X509Certificate::PICKLETYPE_CERTIFICATE_CHAIN_V3);
+    if (!result.verified_cert.get() ||
+        !pickle.ReadUInt32(&iter, &result.cert_status) ||
+        !pickle.ReadBool(&iter, &result.has_md5) ||
+        !pickle.ReadBool(&iter, &result.has_md2) ||
+        !pickle.ReadBool(&iter, &result.has_md4) ||
+        !pickle.ReadBool(&iter, &result.is_issued_by_known_root) ||
+        !pickle.ReadBool(&iter, &result.is_issued_by_additional_trust_anchor) ||
+        !pickle.ReadUInt64(&iter, &public_key_hash_count)) {
+      return false;
+    }
+    for (uint64 j = 0; j < public_key_hash_count; ++j) {
+      std::string hash_string;
+      HashValue hash;
+      if (!pickle.ReadString(&iter, &hash_string) ||
+          !hash.FromString(hash_string)) {
+        return false;
+      }
+      result.public_key_hashes.push_back(hash);
+    }
+
+    const RequestParams key(cert_fingerprint, ca_fingerprint, hostname, flags,
+                            empty_cert_list);
+    const CacheValidityPeriod expiration(
+        base::Time::FromInternalValue(verification_time),
+        base::Time::FromInternalValue(expiration_time));
+    if (!expiration_functor(now, expiration) || cache_.Get(key, now))
+      continue;
+    cache_.Put(key, cached_result, now, expiration);
+  }
+  return true;
+}
+
 int MultiThreadedCertVerifier::Verify(X509Certificate* cert,
                                       const std::string& hostname,
                                       int flags,
@@ -436,7 +578,10 @@ int MultiThreadedCertVerifier::Verify(X509Certificate* cert,
                           hostname, flags, additional_trust_anchors);
   const CertVerifierCache::value_type* cached_entry =
       cache_.Get(key, CacheValidityPeriod(base::Time::Now()));
-  if (cached_entry) {
+  // A result verified with another CRLSet may miss revocations; it is
+  // replaced by the result of a new verification.
+  if (cached_entry &&
+      cached_entry->crl_set_sequence == GetCRLSetSequence(crl_set)) {
     ++cache_hits_;
     *out_req = NULL;
     *verify_result = cached_entry->result;
@@ -521,6 +666,16 @@ bool MultiThreadedCertVerifier::RequestParams::operator<(
       net::SHA1HashValueLessThan());
 }
 
+// static
+bool MultiThreadedCertVerifier::ShouldPersist(
+    const CertVerifierCache::Iterator& it,
+    const CacheValidityPeriod& now) {
+  // Keys with more hash values were verified with additional trust anchors.
+  return it.key().hash_values.size() == 2 &&
+         it.value().result.verified_cert.get() &&
+         CacheExpirationFunctor()(now, it.expiration());
+}
+
 // HandleResult is called by CertVerifierWorker on the origin message loop.
 // It deletes CertVerifierJob.
 void MultiThreadedCertVerifier::HandleResult(
@@ -528,6 +683,7 @@ void MultiThreadedCertVerifier::HandleResult(
     const std::string& hostname,
     int flags,
     const CertificateList& additional_trust_anchors,
+    uint32 crl_set_sequence,
     int error,
     const CertVerifyResult& verify_result) {
   DCHECK(CalledOnValidThread());
@@ -538,10 +694,13 @@ void MultiThreadedCertVerifier::HandleResult(
   CachedResult cached_result;
   cached_result.error = error;
   cached_result.result = verify_result;
+  cached_result.crl_set_sequence = crl_set_sequence;
   base::Time now = base::Time::Now();
   cache_.Put(
       key, cached_result, CacheValidityPeriod(now),
       CacheValidityPeriod(now, now + base::TimeDelta::FromSeconds(kTTLSecs)));
+  if (delegate_)
+    delegate_->CacheIsDirty(this);
 
   std::map<RequestParams, CertVerifierJob*>::iterator j;
   j = inflight_.find(key);
@@ -561,6 +720,8 @@ void MultiThreadedCertVerifier::OnCertTrustChanged(
   DCHECK(CalledOnValidThread());
 
   ClearCache();
+  if (delegate_)
+    delegate_->CacheIsDirty(this);
 }
 
 }  // namespace net
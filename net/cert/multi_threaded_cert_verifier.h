@@ -22,6 +22,8 @@
 #include "net/cert/cert_verify_result.h"
 #include "net/cert/x509_cert_types.h"
 
+class Pickle;
+
 namespace net {
 
 class CertTrustAnchorProvider;
@@ -37,6 +39,16 @@ class NET_EXPORT_PRIVATE MultiThreadedCertVerifier
       NON_EXPORTED_BASE(public base::NonThreadSafe),
       public CertDatabase::Observer {
  public:
+  class NET_EXPORT_PRIVATE Delegate {
+   public:
+    // Called when verification results have been added to the cache, so
+    // that the delegate can persist it with PersistCache().
+    virtual void CacheIsDirty(MultiThreadedCertVerifier* verifier) = 0;
+
+   protected:
+    virtual ~Delegate() {}
+  };
+
   explicit MultiThreadedCertVerifier(CertVerifyProc* verify_proc);
 
   // When the verifier is destroyed, all certificate verifications requests are
@@ -53,6 +65,24 @@ class NET_EXPORT_PRIVATE MultiThreadedCertVerifier
   void SetCertTrustAnchorProvider(
       CertTrustAnchorProvider* trust_anchor_provider);
 
+  // |delegate| is notified of changes to the cache. It may be NULL, and
+  // must outlive the MultiThreadedCertVerifier otherwise.
+  void SetDelegate(Delegate* delegate);
+
+  // Writes the unexpired verification results of the cache to |pickle|,
+  // so that they survive restarts. Results verified with additional trust
+  // anchors are not written, as the anchors are configured at runtime.
+  void PersistCache(Pickle* pickle) const;
+
+  // Adds the unexpired results of a pickle written by PersistCache() to the
+  // cache, without replacing results that are already cached. Returns false
+  // if |pickle| could not be read, in which case part of it may have been
+  // added.
+  bool LoadCache(const Pickle& pickle);
+
+  // Removes all verification results from the cache.
+  void ClearCache() { cache_.Clear(); }
+
   // CertVerifier implementation
   virtual int Verify(X509Certificate* cert,
                      const std::string& hostname,
@@ -78,6 +108,9 @@ class NET_EXPORT_PRIVATE MultiThreadedCertVerifier
                            RequestParamsComparators);
   FRIEND_TEST_ALL_PREFIXES(MultiThreadedCertVerifierTest,
                            CertTrustAnchorProvider);
+  FRIEND_TEST_ALL_PREFIXES(MultiThreadedCertVerifierTest,
+                           CRLSetSequenceChange);
+  FRIEND_TEST_ALL_PREFIXES(MultiThreadedCertVerifierTest, PersistCache);
 
   // Input parameters of a certificate verification request.
   struct NET_EXPORT_PRIVATE RequestParams {
@@ -102,6 +135,9 @@ class NET_EXPORT_PRIVATE MultiThreadedCertVerifier
 
     int error;  // The return value of CertVerifier::Verify.
     CertVerifyResult result;  // The output of CertVerifier::Verify.
+    // The sequence number of the CRLSet used to verify, or 0 if none was.
+    // The result is only used with the same CRLSet sequence.
+    uint32 crl_set_sequence;
   };
 
   // Rather than having a single validity point along a monotonically increasing
@@ -133,14 +169,18 @@ class NET_EXPORT_PRIVATE MultiThreadedCertVerifier
                     const std::string& hostname,
                     int flags,
                     const CertificateList& additional_trust_anchors,
+                    uint32 crl_set_sequence,
                     int error,
                     const CertVerifyResult& verify_result);
 
+  // Returns true if the cache entry at |it| is written by PersistCache().
+  static bool ShouldPersist(const CertVerifierCache::Iterator& it,
+                            const CacheValidityPeriod& now);
+
   // CertDatabase::Observer methods:
   virtual void OnCertTrustChanged(const X509Certificate* cert) OVERRIDE;
 
   // For unit testing.
-  void ClearCache() { cache_.Clear(); }
   size_t GetCacheSize() const { return cache_.size(); }
   uint64 cache_hits() const { return cache_hits_; }
   uint64 requests() const { return requests_; }
@@ -161,6 +201,8 @@ class NET_EXPORT_PRIVATE MultiThreadedCertVerifier
 
   CertTrustAnchorProvider* trust_anchor_provider_;
 
+  Delegate* delegate_;
+
   DISALLOW_COPY_AND_ASSIGN(MultiThreadedCertVerifier);
 };
 
@@ -7,6 +7,7 @@
 #include "base/bind.h"
 #include "base/files/file_path.h"
 #include "base/format_macros.h"
+#include "base/pickle.h"
 #include "base/strings/stringprintf.h"
 #include "net/base/net_errors.h"
 #include "net/base/net_log.h"
@@ -15,6 +16,7 @@
 #include "net/cert/cert_trust_anchor_provider.h"
 #include "net/cert/cert_verify_proc.h"
 #include "net/cert/cert_verify_result.h"
+#include "net/cert/crl_set.h"
 #include "net/cert/x509_certificate.h"
 #include "net/test/cert_test_util.h"
 #include "testing/gmock/include/gmock/gmock.h"
@@ -56,6 +58,21 @@ class MockCertVerifyProc : public CertVerifyProc {
   }
 };
 
+// Returns an empty CRLSet with the given sequence number.
+scoped_refptr<CRLSet> CreateCRLSet(int sequence) {
+  std::string header = base::StringPrintf(
+      "{\"Version\":0,\"ContentType\":\"CRLSet\",\"Sequence\":%d,"
+      "\"DeltaFrom\":0,\"NumParents\":0,\"BlockedSPKIs\":[]}",
+      sequence);
+  std::string data;
+  data.push_back(static_cast<char>(header.size() & 0xff));
+  data.push_back(static_cast<char>(header.size() >> 8));
+  data.append(header);
+  scoped_refptr<CRLSet> crl_set;
+  EXPECT_TRUE(CRLSet::Parse(data, &crl_set));
+  return crl_set;
+}
+
 class MockCertTrustAnchorProvider : public CertTrustAnchorProvider {
  public:
   MockCertTrustAnchorProvider() {}
@@ -476,4 +493,96 @@ TEST_F(MultiThreadedCertVerifierTest, CertTrustAnchorProvider) {
   ASSERT_EQ(1u, verifier_.cache_hits());
 }
 
+// Tests that results verified with another CRLSet are not used.
+TEST_F(MultiThreadedCertVerifierTest, CRLSetSequenceChange) {
+  scoped_refptr<X509Certificate> test_cert(
+      ImportCertFromFile(GetTestCertsDirectory(), "ok_cert.pem"));
+  ASSERT_TRUE(test_cert.get());
+  scoped_refptr<CRLSet> crl_set1(CreateCRLSet(1));
+  scoped_refptr<CRLSet> crl_set2(CreateCRLSet(2));
+  ASSERT_TRUE(crl_set1.get());
+  ASSERT_TRUE(crl_set2.get());
+
+  int error;
+  CertVerifyResult verify_result;
+  TestCompletionCallback callback;
+  CertVerifier::RequestHandle request_handle;
+
+  error = verifier_.Verify(test_cert.get(), "www.example.com", 0,
+                           crl_set1.get(), &verify_result, callback.callback(),
+                           &request_handle, BoundNetLog());
+  ASSERT_EQ(ERR_IO_PENDING, error);
+  EXPECT_EQ(ERR_CERT_COMMON_NAME_INVALID, callback.WaitForResult());
+
+  error = verifier_.Verify(test_cert.get(), "www.example.com", 0,
+                           crl_set1.get(), &verify_result, callback.callback(),
+                           &request_handle, BoundNetLog());
+  EXPECT_EQ(ERR_CERT_COMMON_NAME_INVALID, error);
+  ASSERT_EQ(1u, verifier_.cache_hits());
+
+  // A new CRLSet requires a new verification, whose result replaces the
+  // cached one.
+  error = verifier_.Verify(test_cert.get(), "www.example.com", 0,
+                           crl_set2.get(), &verify_result, callback.callback(),
+                           &request_handle, BoundNetLog());
+  ASSERT_EQ(ERR_IO_PENDING, error);
+  EXPECT_EQ(ERR_CERT_COMMON_NAME_INVALID, callback.WaitForResult());
+  ASSERT_EQ(1u, verifier_.cache_hits());
+  ASSERT_EQ(1u, verifier_.GetCacheSize());
+
+  error = verifier_.Verify(test_cert.get(), "www.example.com", 0,
+                           crl_set2.get(), &verify_result, callback.callback(),
+                           &request_handle, BoundNetLog());
+  EXPECT_EQ(ERR_CERT_COMMON_NAME_INVALID, error);
+  ASSERT_EQ(4u, verifier_.requests());
+  ASSERT_EQ(2u, verifier_.cache_hits());
+}
+
+TEST_F(MultiThreadedCertVerifierTest, PersistCache) {
+  scoped_refptr<X509Certificate> test_cert(
+      ImportCertFromFile(GetTestCertsDirectory(), "ok_cert.pem"));
+  ASSERT_TRUE(test_cert.get());
+  scoped_refptr<CRLSet> crl_set(CreateCRLSet(1));
+  ASSERT_TRUE(crl_set.get());
+
+  int error;
+  CertVerifyResult verify_result;
+  TestCompletionCallback callback;
+  CertVerifier::RequestHandle request_handle;
+
+  error = verifier_.Verify(test_cert.get(), "www.example.com", 0,
+                           crl_set.get(), &verify_result, callback.callback(),
+                           &request_handle, BoundNetLog());
+  ASSERT_EQ(ERR_IO_PENDING, error);
+  EXPECT_EQ(ERR_CERT_COMMON_NAME_INVALID, callback.WaitForResult());
+
+  Pickle pickle;
+  verifier_.PersistCache(&pickle);
+
+  // A verifier that loads the pickle verifies from its cache.
+  MultiThreadedCertVerifier verifier(new MockCertVerifyProc());
+  EXPECT_TRUE(verifier.LoadCache(pickle));
+  ASSERT_EQ(1u, verifier.GetCacheSize());
+  verify_result.Reset();
+  error = verifier.Verify(test_cert.get(), "www.example.com", 0,
+                          crl_set.get(), &verify_result, callback.callback(),
+                          &request_handle, BoundNetLog());
+  EXPECT_EQ(ERR_CERT_COMMON_NAME_INVALID, error);
+  EXPECT_FALSE(request_handle);
+  EXPECT_EQ(1u, verifier.cache_hits());
+  EXPECT_EQ(CERT_STATUS_COMMON_NAME_INVALID, verify_result.cert_status);
+  ASSERT_TRUE(verify_result.verified_cert.get());
+  EXPECT_TRUE(verify_result.verified_cert->Equals(test_cert.get()));
+
+  // Loading the pickle again does not add entries.
+  EXPECT_TRUE(verifier.LoadCache(pickle));
+  EXPECT_EQ(1u, verifier.GetCacheSize());
+
+  // Truncated pickles are rejected.
+  Pickle truncated(static_cast<const char*>(pickle.data()),
+                   pickle.size() - 4);
+  MultiThreadedCertVerifier other_verifier(new MockCertVerifyProc());
+  EXPECT_FALSE(other_verifier.LoadCache(truncated));
+}
+
 }  // namespace net
@@ -312,7 +312,7 @@ bool CanonicalCookie::IsOnPath(const std::string& url_path) const {
   // Make sure the cookie path is a prefix of the url path.  If the
   // url path is shorter than the cookie path, then the cookie path
   // can't be a prefix.
-  if (url_path.find(path_) != 0)
+  if (url_path.compare(0, path_.length(), path_) != 0)
     return false;
 
   // Now we know that url_path is >= cookie_path, and that cookie_path
@@ -110,6 +110,8 @@ const size_t CookieMonster::kDomainCookiesQuotaHigh   =
 
 const int CookieMonster::kSafeFromGlobalPurgeDays       = 30;
 
+const size_t CookieMonster::kMaxKeyCacheSize = 1000;
+
 namespace {
 
 typedef std::vector<CanonicalCookie*> CanonicalCookieVector;
@@ -1675,6 +1677,7 @@ void CookieMonster::FindCookiesForKey(const std::string& key,
                                       std::vector<CanonicalCookie*>* cookies) {
   lock_.AssertAcquired();
 
+  const std::string host(url.host());
   for (CookieMapItPair its = cookies_.equal_range(key);
        its.first != its.second; ) {
     CookieMap::iterator curit = its.first;
@@ -1687,6 +1690,11 @@ void CookieMonster::FindCookiesForKey(const std::string& key,
       continue;
     }
 
+    // Most cookies under a key belong to other hosts. Rule those out without
+    // building the host and path strings of |url| for each cookie.
+    if (!cc->IsDomainMatch(host))
+      continue;
+
     // Filter out cookies that should not be included for a request to the
     // given |url|. HTTP only cookies are filtered depending on the passed
     // cookie |options|.
@@ -2049,6 +2057,13 @@ int CookieMonster::GarbageCollectDeleteRange(
 // be worth it, but is still too much trouble to solve what is currently a
 // non-problem).
 std::string CookieMonster::GetKey(const std::string& domain) const {
+  lock_.AssertAcquired();
+
+  base::hash_map<std::string, std::string>::const_iterator it =
+      key_cache_.find(domain);
+  if (it != key_cache_.end())
+    return it->second;
+
   std::string effective_domain(
       registry_controlled_domains::GetDomainAndRegistry(
           domain, registry_controlled_domains::EXCLUDE_PRIVATE_REGISTRIES));
@@ -2056,7 +2071,11 @@ std::string CookieMonster::GetKey(const std::string& domain) const {
     effective_domain = domain;
 
   if (!effective_domain.empty() && effective_domain[0] == '.')
-    return effective_domain.substr(1);
+    effective_domain.erase(0, 1);
+
+  if (key_cache_.size() >= kMaxKeyCacheSize)
+    key_cache_.clear();
+  key_cache_[domain] = effective_domain;
   return effective_domain;
 }
 
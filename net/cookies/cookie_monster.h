@@ -17,6 +17,7 @@
 
 #include "base/basictypes.h"
 #include "base/callback_forward.h"
+#include "base/containers/hash_tables.h"
 #include "base/gtest_prod_util.h"
 #include "base/memory/ref_counted.h"
 #include "base/memory/scoped_ptr.h"
@@ -343,6 +344,7 @@ class NET_EXPORT CookieMonster : public CookieStore {
   FRIEND_TEST_ALL_PREFIXES(CookieMonsterTest, TestDomainTree);
   FRIEND_TEST_ALL_PREFIXES(CookieMonsterTest, TestImport);
   FRIEND_TEST_ALL_PREFIXES(CookieMonsterTest, GetKey);
+  FRIEND_TEST_ALL_PREFIXES(CookieMonsterTest, GetKeyCache);
   FRIEND_TEST_ALL_PREFIXES(CookieMonsterTest, TestGetKey);
 
   // For FindCookiesForKey.
@@ -389,6 +391,9 @@ class NET_EXPORT CookieMonster : public CookieStore {
   // Record statistics every kRecordStatisticsIntervalSeconds of uptime.
   static const int kRecordStatisticsIntervalSeconds = 10 * 60;
 
+  // Maximum number of domains whose key is cached by GetKey().
+  static const size_t kMaxKeyCacheSize;
+
   virtual ~CookieMonster();
 
   // The following are synchronous calls to which the asynchronous methods
@@ -569,7 +574,8 @@ class NET_EXPORT CookieMonster : public CookieStore {
                                 CookieItVector::iterator cookie_its_end);
 
   // Find the key (for lookup in cookies_) based on the given domain.
-  // See comment on keys before the CookieMap typedef.
+  // See comment on keys before the CookieMap typedef. The result is cached in
+  // |key_cache_|, so |lock_| must be held.
   std::string GetKey(const std::string& domain) const;
 
   bool HasCookieableScheme(const GURL& url);
@@ -660,6 +666,12 @@ class NET_EXPORT CookieMonster : public CookieStore {
   // to call while it's in that state.
   std::set<int64> creation_times_;
 
+  // Keys previously computed by GetKey(), by domain. Looking up the eTLD+1 of
+  // a host is comparatively expensive, and the same hosts are looked up over
+  // and over. The cache is cleared when it reaches kMaxKeyCacheSize. Guarded
+  // by |lock_|.
+  mutable base::hash_map<std::string, std::string> key_cache_;
+
   std::vector<std::string> cookieable_schemes_;
 
   scoped_refptr<Delegate> delegate_;
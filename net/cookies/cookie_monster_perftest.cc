@@ -182,6 +182,44 @@ TEST_F(CookieMonsterTest, TestAddCookieOnManyHosts) {
   timer3.Done();
 }
 
+// Sets and looks up cookies on a store which holds about as many cookies as
+// CookieMonster keeps under normal use, and on a much larger one.
+TEST_F(CookieMonsterTest, TestSetAndQueryAtScale) {
+  const int kStoreSizes[] = { 3000, 100000 };
+  const int kCookiesPerHost = 50;
+  SetCookieCallback setCookieCallback;
+  GetCookiesCallback getCookiesCallback;
+
+  for (size_t i = 0; i < arraysize(kStoreSizes); ++i) {
+    const int num_cookies = kStoreSizes[i];
+    const int num_hosts = num_cookies / kCookiesPerHost;
+    scoped_refptr<CookieMonster> cm(new CookieMonster(NULL, NULL));
+    std::vector<GURL> gurls;
+    for (int host = 0; host < num_hosts; ++host) {
+      gurls.push_back(
+          GURL(base::StringPrintf("https://www.host%d.com/", host)));
+    }
+
+    PerfTimeLogger timer(
+        base::StringPrintf("Cookie_monster_set_%d", num_cookies).c_str());
+    for (int cookie = 0; cookie < kCookiesPerHost; ++cookie) {
+      const std::string cookie_line(base::StringPrintf("a%02d=b", cookie));
+      for (int host = 0; host < num_hosts; ++host)
+        setCookieCallback.SetCookie(cm.get(), gurls[host], cookie_line);
+    }
+    timer.Done();
+
+    PerfTimeLogger timer2(
+        base::StringPrintf("Cookie_monster_query_%d", num_cookies).c_str());
+    for (int query = 0; query < kNumCookies; ++query) {
+      const std::string& cookie_line =
+          getCookiesCallback.GetCookies(cm.get(), gurls[query % num_hosts]);
+      EXPECT_EQ(kCookiesPerHost, CountInString(cookie_line, '='));
+    }
+    timer2.Done();
+  }
+}
+
 TEST_F(CookieMonsterTest, TestDomainTree) {
   scoped_refptr<CookieMonster> cm(new CookieMonster(NULL, NULL));
   GetCookiesCallback getCookiesCallback;
@@ -192,23 +230,26 @@ TEST_F(CookieMonsterTest, TestDomainTree) {
   std::vector<std::string> domain_list;
 
   // Create a balanced binary tree of domains on which the cookie is set.
-  domain_list.push_back(domain_base);
-  for (int i1 = 0; i1 < 2; i1++) {
-    std::string domain_base_1((i1 ? "a." : "b.") + domain_base);
-    EXPECT_EQ("top.com", cm->GetKey(domain_base_1));
-    domain_list.push_back(domain_base_1);
-    for (int i2 = 0; i2 < 2; i2++) {
-      std::string domain_base_2((i2 ? "a." : "b.") + domain_base_1);
-      EXPECT_EQ("top.com", cm->GetKey(domain_base_2));
-      domain_list.push_back(domain_base_2);
-      for (int i3 = 0; i3 < 2; i3++) {
-        std::string domain_base_3((i3 ? "a." : "b.") + domain_base_2);
-        EXPECT_EQ("top.com", cm->GetKey(domain_base_3));
-        domain_list.push_back(domain_base_3);
-        for (int i4 = 0; i4 < 2; i4++) {
-          std::string domain_base_4((i4 ? "a." : "b.") + domain_base_3);
-          EXPECT_EQ("top.com", cm->GetKey(domain_base_4));
-          domain_list.push_back(domain_base_4);
+  {
+    base::AutoLock autolock(cm->lock_);
+    domain_list.push_back(domain_base);
+    for (int i1 = 0; i1 < 2; i1++) {
+      std::string domain_base_1((i1 ? "a." : "b.") + domain_base);
+      EXPECT_EQ("top.com", cm->GetKey(domain_base_1));
+      domain_list.push_back(domain_base_1);
+      for (int i2 = 0; i2 < 2; i2++) {
+        std::string domain_base_2((i2 ? "a." : "b.") + domain_base_1);
+        EXPECT_EQ("top.com", cm->GetKey(domain_base_2));
+        domain_list.push_back(domain_base_2);
+        for (int i3 = 0; i3 < 2; i3++) {
+          std::string domain_base_3((i3 ? "a." : "b.") + domain_base_2);
+          EXPECT_EQ("top.com", cm->GetKey(domain_base_3));
+          domain_list.push_back(domain_base_3);
+          for (int i4 = 0; i4 < 2; i4++) {
+            std::string domain_base_4((i4 ? "a." : "b.") + domain_base_3);
+            EXPECT_EQ("top.com", cm->GetKey(domain_base_4));
+            domain_list.push_back(domain_base_4);
+          }
         }
       }
     }
@@ -309,11 +350,13 @@ TEST_F(CookieMonsterTest, TestImport) {
   timer.Done();
 
   // Just confirm keys were set as expected.
+  base::AutoLock autolock(cm->lock_);
   EXPECT_EQ("domain_1.com", cm->GetKey("www.Domain_1.com"));
 }
 
 TEST_F(CookieMonsterTest, TestGetKey) {
   scoped_refptr<CookieMonster> cm(new CookieMonster(NULL, NULL));
+  base::AutoLock autolock(cm->lock_);
   PerfTimeLogger timer("Cookie_monster_get_key");
   for (int i = 0; i < kNumCookies; i++)
     cm->GetKey("www.google.com");
@@ -10,6 +10,7 @@
 
 #include "base/basictypes.h"
 #include "base/bind.h"
+#include "base/format_macros.h"
 #include "base/memory/ref_counted.h"
 #include "base/memory/scoped_ptr.h"
 #include "base/message_loop/message_loop.h"
@@ -1908,6 +1909,7 @@ TEST_F(CookieMonsterTest, UniqueCreationTime) {
 // expected behavior of GetEffectiveDomain within the CookieMonster.
 TEST_F(CookieMonsterTest, GetKey) {
   scoped_refptr<CookieMonster> cm(new CookieMonster(NULL, NULL));
+  base::AutoLock autolock(cm->lock_);
 
   // This test is really only interesting if GetKey() actually does something.
   EXPECT_EQ("google.com", cm->GetKey("www.google.com"));
@@ -1928,6 +1930,35 @@ TEST_F(CookieMonsterTest, GetKey) {
   EXPECT_EQ("localhost", cm->GetKey("localhost"));
 }
 
+TEST_F(CookieMonsterTest, GetKeyCache) {
+  scoped_refptr<CookieMonster> cm(new CookieMonster(NULL, NULL));
+  base::AutoLock autolock(cm->lock_);
+
+  // Keys are cached by domain, and cached keys are returned unchanged.
+  EXPECT_EQ("google.com", cm->GetKey("www.google.com"));
+  EXPECT_EQ(1u, cm->key_cache_.size());
+  EXPECT_EQ("google.com", cm->key_cache_["www.google.com"]);
+  EXPECT_EQ("google.com", cm->GetKey("www.google.com"));
+  EXPECT_EQ(1u, cm->key_cache_.size());
+  EXPECT_EQ("google.com", cm->GetKey(".google.com"));
+  EXPECT_EQ(2u, cm->key_cache_.size());
+
+  // The cache is cleared once it is full.
+  for (size_t i = cm->key_cache_.size();
+       i < CookieMonster::kMaxKeyCacheSize; ++i) {
+    std::string domain(base::StringPrintf("www%" PRIuS ".example.com", i));
+    EXPECT_EQ("example.com", cm->GetKey(domain));
+  }
+  EXPECT_EQ(CookieMonster::kMaxKeyCacheSize, cm->key_cache_.size());
+  EXPECT_EQ("bbc.co.uk", cm->GetKey("www.bbc.co.uk"));
+  EXPECT_EQ(1u, cm->key_cache_.size());
+  EXPECT_EQ("bbc.co.uk", cm->key_cache_["www.bbc.co.uk"]);
+
+  // Keys computed after the cache was cleared are still right.
+  EXPECT_EQ("google.com", cm->GetKey("www.google.com"));
+  EXPECT_EQ(2u, cm->key_cache_.size());
+}
+
 // Test that cookies transfer from/to the backing store correctly.
 TEST_F(CookieMonsterTest, BackingStoreCommunication) {
   // Store details for cookies transforming through the backing store interface.
@@ -16,6 +16,7 @@ namespace net {
 DnsConfig::DnsConfig()
     : append_to_multi_label_name(true),
       randomize_ports(false),
+      race_count(1),
       ndots(1),
       timeout(base::TimeDelta::FromSeconds(kDnsTimeoutSeconds)),
       attempts(2),
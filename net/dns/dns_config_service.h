@@ -67,6 +67,10 @@ struct NET_EXPORT_PRIVATE DnsConfig {
   // resources on some platforms.
   bool randomize_ports;
 
+  // Number of servers, fastest first, to which the first attempt at each name
+  // is sent in parallel. The first usable response wins. 1 disables racing.
+  int race_count;
+
   // Resolver options; see man resolv.conf.
 
   // Minimum number of dots before global resolution precedes |search|.
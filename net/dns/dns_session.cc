@@ -4,6 +4,9 @@
 
 #include "net/dns/dns_session.h"
 
+#include <algorithm>
+#include <utility>
+
 #include "base/basictypes.h"
 #include "base/bind.h"
 #include "base/lazy_instance.h"
@@ -137,6 +140,31 @@ unsigned DnsSession::NextGoodServerIndex(unsigned server_index) {
   return oldest_server_failure_index;
 }
 
+void DnsSession::GetFastestServers(unsigned first_server_index,
+                                   unsigned count,
+                                   std::vector<unsigned>* servers) {
+  DCHECK(servers);
+  const unsigned num_servers = config_.nameservers.size();
+  DCHECK_LT(first_server_index, num_servers);
+
+  // Sort by (has failed, RTT estimate, position after |first_server_index|).
+  typedef std::pair<std::pair<bool, int64>, unsigned> ServerRank;
+  std::vector<ServerRank> ranks;
+  for (unsigned position = 0; position < num_servers; ++position) {
+    const ServerStats* stats =
+        server_stats_[(first_server_index + position) % num_servers];
+    bool failed = stats->last_failure_count >= config_.attempts;
+    ranks.push_back(ServerRank(
+        std::make_pair(failed, stats->rtt_estimate.ToInternalValue()),
+        position));
+  }
+  std::sort(ranks.begin(), ranks.end());
+
+  servers->clear();
+  for (unsigned i = 0; i < std::min(count, num_servers); ++i)
+    servers->push_back((first_server_index + ranks[i].second) % num_servers);
+}
+
 void DnsSession::RecordServerFailure(unsigned server_index) {
   UMA_HISTOGRAM_CUSTOM_COUNTS(
       "AsyncDNS.ServerFailureIndex", server_index, 0, 10, 10);
@@ -238,6 +266,10 @@ scoped_ptr<StreamSocket> DnsSession::CreateTCPSocket(
   return socket_pool_->CreateTCPSocket(server_index, source);
 }
 
+DnsTCPConnection* DnsSession::GetTCPConnection(unsigned server_index) {
+  return socket_pool_->GetTCPConnection(server_index);
+}
+
 // Release a socket.
 void DnsSession::FreeSocket(unsigned server_index,
                             scoped_ptr<DatagramClientSocket> socket) {
@@ -27,6 +27,7 @@ namespace net {
 
 class ClientSocketFactory;
 class DatagramClientSocket;
+class DnsTCPConnection;
 class NetLog;
 class StreamSocket;
 
@@ -77,6 +78,14 @@ class NET_EXPORT_PRIVATE DnsSession
   // or have failed longer time ago.
   unsigned NextGoodServerIndex(unsigned server_index);
 
+  // Fills |servers| with the indices of up to |count| servers to query in
+  // parallel, fastest first by RTT estimate. Servers that have failed as many
+  // times in a row as there are allowed attempts come last. Ties keep the
+  // configured order, starting from |first_server_index|.
+  void GetFastestServers(unsigned first_server_index,
+                         unsigned count,
+                         std::vector<unsigned>* servers);
+
   // Record that server failed to respond (due to SRV_FAIL or timeout).
   void RecordServerFailure(unsigned server_index);
 
@@ -106,6 +115,10 @@ class NET_EXPORT_PRIVATE DnsSession
   scoped_ptr<StreamSocket> CreateTCPSocket(unsigned server_index,
                                            const NetLog::Source& source);
 
+  // Returns the persistent TCP connection to the server, which is shared by
+  // all transactions of this session.
+  DnsTCPConnection* GetTCPConnection(unsigned server_index);
+
  private:
   friend class base::RefCounted<DnsSession>;
   ~DnsSession();
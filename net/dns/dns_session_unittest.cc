@@ -243,6 +243,38 @@ TEST_F(DnsSessionTest, HistogramTimeoutLong) {
   EXPECT_EQ(config_.timeout.InMilliseconds(), timeout.InMilliseconds());
 }
 
+// Servers are ranked by RTT estimate, with failed servers last.
+TEST_F(DnsSessionTest, FastestServers) {
+  config_.attempts = 2;
+  Initialize(4);
+
+  // Ties keep the configured order, from the first server index.
+  std::vector<unsigned> servers;
+  session_->GetFastestServers(1, 4, &servers);
+  ASSERT_EQ(4u, servers.size());
+  EXPECT_EQ(1u, servers[0]);
+  EXPECT_EQ(2u, servers[1]);
+  EXPECT_EQ(3u, servers[2]);
+  EXPECT_EQ(0u, servers[3]);
+
+  session_->RecordRTT(1, base::TimeDelta::FromSeconds(10));
+  session_->RecordRTT(3, base::TimeDelta::FromMilliseconds(1));
+  session_->RecordServerFailure(0);
+  session_->RecordServerFailure(0);
+
+  session_->GetFastestServers(0, 4, &servers);
+  ASSERT_EQ(4u, servers.size());
+  EXPECT_EQ(3u, servers[0]);
+  EXPECT_EQ(2u, servers[1]);
+  EXPECT_EQ(1u, servers[2]);
+  EXPECT_EQ(0u, servers[3]);
+
+  session_->GetFastestServers(0, 2, &servers);
+  ASSERT_EQ(2u, servers.size());
+  EXPECT_EQ(3u, servers[0]);
+  EXPECT_EQ(2u, servers[1]);
+}
+
 }  // namespace
 
 } // namespace net
@@ -11,6 +11,7 @@
 #include "net/base/ip_endpoint.h"
 #include "net/base/net_errors.h"
 #include "net/base/rand_callback.h"
+#include "net/dns/dns_tcp_connection.h"
 #include "net/socket/client_socket_factory.h"
 #include "net/socket/stream_socket.h"
 #include "net/udp/datagram_client_socket.h"
@@ -48,6 +49,9 @@ DnsSocketPool::DnsSocketPool(ClientSocketFactory* socket_factory)
       initialized_(false) {
 }
 
+DnsSocketPool::~DnsSocketPool() {
+}
+
 void DnsSocketPool::InitializeInternal(
     const std::vector<IPEndPoint>* nameservers,
     NetLog* net_log) {
@@ -57,6 +61,7 @@ void DnsSocketPool::InitializeInternal(
   net_log_ = net_log;
   nameservers_ = nameservers;
   initialized_ = true;
+  tcp_connections_.resize(nameservers->size());
 }
 
 scoped_ptr<StreamSocket> DnsSocketPool::CreateTCPSocket(
@@ -69,6 +74,14 @@ scoped_ptr<StreamSocket> DnsSocketPool::CreateTCPSocket(
           AddressList((*nameservers_)[server_index]), net_log_, source));
 }
 
+DnsTCPConnection* DnsSocketPool::GetTCPConnection(unsigned server_index) {
+  DCHECK_LT(server_index, tcp_connections_.size());
+
+  if (!tcp_connections_[server_index])
+    tcp_connections_[server_index] = new DnsTCPConnection(this, server_index);
+  return tcp_connections_[server_index];
+}
+
 scoped_ptr<DatagramClientSocket> DnsSocketPool::CreateConnectedSocket(
     unsigned server_index) {
   DCHECK_LT(server_index, nameservers_->size());
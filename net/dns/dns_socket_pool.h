@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "base/memory/scoped_ptr.h"
+#include "base/memory/scoped_vector.h"
 #include "net/base/net_export.h"
 #include "net/base/net_log.h"
 
@@ -15,6 +16,7 @@ namespace net {
 
 class ClientSocketFactory;
 class DatagramClientSocket;
+class DnsTCPConnection;
 class IPEndPoint;
 class NetLog;
 class StreamSocket;
@@ -24,7 +26,7 @@ class StreamSocket;
 // to DNS servers.
 class NET_EXPORT_PRIVATE DnsSocketPool {
  public:
-  virtual ~DnsSocketPool() { }
+  virtual ~DnsSocketPool();
 
   // Creates a DnsSocketPool that implements the default strategy for managing
   // sockets.  (This varies by platform; see DnsSocketPoolImpl in
@@ -67,6 +69,11 @@ class NET_EXPORT_PRIVATE DnsSocketPool {
       unsigned server_index,
       const NetLog::Source& source);
 
+  // Returns the persistent TCP connection to the nameserver referenced by
+  // |server_index|, creating it on first use. Queries from all transactions
+  // are pipelined over it. The connection is owned by the pool.
+  DnsTCPConnection* GetTCPConnection(unsigned server_index);
+
  protected:
   DnsSocketPool(ClientSocketFactory* socket_factory);
 
@@ -83,6 +90,9 @@ class NET_EXPORT_PRIVATE DnsSocketPool {
   const std::vector<IPEndPoint>* nameservers_;
   bool initialized_;
 
+  // Indexed by server; entries are NULL until first used.
+  ScopedVector<DnsTCPConnection> tcp_connections_;
+
   DISALLOW_COPY_AND_ASSIGN(DnsSocketPool);
 };
 
@@ -0,0 +1,328 @@
+// Copyright 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "net/dns/dns_tcp_connection.h"
+
+#include <string.h>
+
+#include <vector>
+
+#include "base/bind.h"
+#include "base/location.h"
+#include "base/logging.h"
+#include "base/message_loop/message_loop.h"
+#include "base/metrics/histogram.h"
+#include "net/base/big_endian.h"
+#include "net/base/io_buffer.h"
+#include "net/base/net_errors.h"
+#include "net/dns/dns_protocol.h"
+#include "net/dns/dns_query.h"
+#include "net/dns/dns_response.h"
+#include "net/dns/dns_socket_pool.h"
+#include "net/socket/stream_socket.h"
+
+namespace net {
+
+namespace {
+
+// Servers are free to close idle connections, so do not hold on to them for
+// long. RFC 5966 suggests servers wait at least a few seconds.
+const int kIdleTimeoutSeconds = 10;
+
+}  // namespace
+
+struct DnsTCPConnection::PendingQuery {
+  PendingQuery() : response(NULL), retried(false) {}
+
+  // The query, prefixed with its length.
+  scoped_refptr<IOBufferWithSize> buffer;
+  scoped_ptr<DnsResponse>* response;
+  CompletionCallback callback;
+  // True if the query has already been resent on a new connection.
+  bool retried;
+  // The source of the net log of the transaction that sent the query.
+  NetLog::Source source;
+};
+
+DnsTCPConnection::DnsTCPConnection(DnsSocketPool* pool, unsigned server_index)
+    : pool_(pool),
+      server_index_(server_index),
+      state_(STATE_DISCONNECTED),
+      responses_received_(0),
+      write_pending_(false),
+      read_length_buffer_(new IOBufferWithSize(sizeof(uint16))),
+      reading_length_(false),
+      weak_factory_(this) {
+  DCHECK(pool_);
+}
+
+DnsTCPConnection::~DnsTCPConnection() {
+  DCHECK(CalledOnValidThread());
+}
+
+int DnsTCPConnection::Query(const DnsQuery& query,
+                            scoped_ptr<DnsResponse>* response,
+                            const CompletionCallback& callback,
+                            const BoundNetLog& net_log) {
+  DCHECK(CalledOnValidThread());
+  DCHECK(response);
+  DCHECK(!callback.is_null());
+
+  // The response would be ambiguous.
+  if (pending_queries_.count(query.id()))
+    return ERR_INSUFFICIENT_RESOURCES;
+
+  PendingQuery& pending = pending_queries_[query.id()];
+  int query_size = query.io_buffer()->size();
+  pending.buffer = new IOBufferWithSize(sizeof(uint16) + query_size);
+  WriteBigEndian<uint16>(pending.buffer->data(), query_size);
+  memcpy(pending.buffer->data() + sizeof(uint16), query.io_buffer()->data(),
+         query_size);
+  pending.response = response;
+  pending.callback = callback;
+  pending.source = net_log.source();
+  write_queue_.push_back(query.id());
+  idle_timer_.Stop();
+
+  UMA_HISTOGRAM_BOOLEAN("AsyncDNS.TCPConnectionReused",
+                        state_ == STATE_CONNECTED);
+
+  switch (state_) {
+    case STATE_DISCONNECTED:
+      Connect(net_log.source());
+      break;
+    case STATE_CONNECTING:
+      break;
+    case STATE_CONNECTED:
+      // Completions must not be reported from within this call.
+      if (!write_pending_) {
+        base::MessageLoop::current()->PostTask(
+            FROM_HERE,
+            base::Bind(&DnsTCPConnection::DoWrite,
+                       weak_factory_.GetWeakPtr()));
+      }
+      break;
+  }
+  return ERR_IO_PENDING;
+}
+
+void DnsTCPConnection::CancelQuery(uint16 id) {
+  DCHECK(CalledOnValidThread());
+  // A query which is being written stays in |write_buffer_|, since the server
+  // would not understand the rest of the stream otherwise.
+  pending_queries_.erase(id);
+  StartIdleTimerIfIdle();
+}
+
+void DnsTCPConnection::Connect(const NetLog::Source& source) {
+  DCHECK_EQ(STATE_DISCONNECTED, state_);
+  socket_ = pool_->CreateTCPSocket(server_index_, source);
+  socket_net_log_ = socket_->NetLog();
+  responses_received_ = 0;
+  state_ = STATE_CONNECTING;
+  base::MessageLoop::current()->PostTask(
+      FROM_HERE,
+      base::Bind(&DnsTCPConnection::DoConnect, weak_factory_.GetWeakPtr()));
+}
+
+void DnsTCPConnection::DoConnect() {
+  DCHECK_EQ(STATE_CONNECTING, state_);
+  int rv = socket_->Connect(base::Bind(&DnsTCPConnection::OnConnectComplete,
+                                       base::Unretained(this)));
+  if (rv != ERR_IO_PENDING)
+    OnConnectComplete(rv);
+}
+
+void DnsTCPConnection::OnConnectComplete(int rv) {
+  DCHECK_EQ(STATE_CONNECTING, state_);
+  if (rv != OK) {
+    OnConnectionError(rv);
+    return;
+  }
+  state_ = STATE_CONNECTED;
+  StartIdleTimerIfIdle();
+
+  base::WeakPtr<DnsTCPConnection> self = weak_factory_.GetWeakPtr();
+  DoWrite();
+  if (!self.get() || state_ != STATE_CONNECTED)
+    return;
+  DoRead();
+}
+
+void DnsTCPConnection::DoWrite() {
+  while (state_ == STATE_CONNECTED && !write_pending_) {
+    if (!write_buffer_.get()) {
+      // Skip the queries cancelled before they were sent.
+      while (!write_queue_.empty() &&
+             !pending_queries_.count(write_queue_.front())) {
+        write_queue_.pop_front();
+      }
+      if (write_queue_.empty())
+        return;
+      IOBufferWithSize* buffer =
+          pending_queries_[write_queue_.front()].buffer.get();
+      write_queue_.pop_front();
+      write_buffer_ = new DrainableIOBuffer(buffer, buffer->size());
+    }
+
+    int rv = socket_->Write(write_buffer_.get(),
+                            write_buffer_->BytesRemaining(),
+                            base::Bind(&DnsTCPConnection::OnWriteComplete,
+                                       base::Unretained(this)));
+    if (rv == ERR_IO_PENDING) {
+      write_pending_ = true;
+      return;
+    }
+    if (!DidWrite(rv))
+      return;
+  }
+}
+
+void DnsTCPConnection::OnWriteComplete(int rv) {
+  DCHECK(write_pending_);
+  write_pending_ = false;
+  if (DidWrite(rv))
+    DoWrite();
+}
+
+bool DnsTCPConnection::DidWrite(int rv) {
+  DCHECK_NE(ERR_IO_PENDING, rv);
+  if (rv < 0) {
+    OnConnectionError(rv);
+    return false;
+  }
+  write_buffer_->DidConsume(rv);
+  if (write_buffer_->BytesRemaining() == 0)
+    write_buffer_ = NULL;
+  return true;
+}
+
+void DnsTCPConnection::DoRead() {
+  while (true) {
+    if (!read_buffer_.get()) {
+      reading_length_ = true;
+      read_buffer_ = new DrainableIOBuffer(read_length_buffer_.get(),
+                                           read_length_buffer_->size());
+    }
+    int rv = socket_->Read(read_buffer_.get(),
+                           read_buffer_->BytesRemaining(),
+                           base::Bind(&DnsTCPConnection::OnReadComplete,
+                                      base::Unretained(this)));
+    if (rv == ERR_IO_PENDING)
+      return;
+    if (!DidRead(rv))
+      return;
+  }
+}
+
+void DnsTCPConnection::OnReadComplete(int rv) {
+  if (DidRead(rv))
+    DoRead();
+}
+
+bool DnsTCPConnection::DidRead(int rv) {
+  DCHECK_NE(ERR_IO_PENDING, rv);
+  if (rv == 0)
+    rv = ERR_CONNECTION_CLOSED;
+  if (rv < 0) {
+    OnConnectionError(rv);
+    return false;
+  }
+
+  read_buffer_->DidConsume(rv);
+  if (read_buffer_->BytesRemaining() > 0)
+    return true;
+
+  if (reading_length_) {
+    uint16 length;
+    ReadBigEndian<uint16>(read_length_buffer_->data(), &length);
+    // Without an ID, there is no telling which query this would answer.
+    if (length < sizeof(dns_protocol::Header)) {
+      OnConnectionError(ERR_DNS_MALFORMED_RESPONSE);
+      return false;
+    }
+    reading_length_ = false;
+    // Allocate more space so that DnsResponse::InitParse sanity check passes.
+    read_response_.reset(new DnsResponse(length + 1));
+    read_buffer_ = new DrainableIOBuffer(read_response_->io_buffer(), length);
+    return true;
+  }
+  return DispatchResponse();
+}
+
+bool DnsTCPConnection::DispatchResponse() {
+  int size = read_buffer_->BytesConsumed();
+  read_buffer_ = NULL;
+  ++responses_received_;
+
+  uint16 id;
+  ReadBigEndian<uint16>(read_response_->io_buffer()->data(), &id);
+  PendingQueryMap::iterator it = pending_queries_.find(id);
+  if (it == pending_queries_.end()) {
+    // The query was cancelled, or the server is confused.
+    read_response_.reset();
+    return true;
+  }
+
+  CompletionCallback callback = it->second.callback;
+  it->second.response->reset(read_response_.release());
+  CancelQuery(id);
+
+  base::WeakPtr<DnsTCPConnection> self = weak_factory_.GetWeakPtr();
+  callback.Run(size);
+  return self.get() != NULL && state_ == STATE_CONNECTED;
+}
+
+void DnsTCPConnection::OnConnectionError(int rv) {
+  DCHECK_NE(OK, rv);
+  bool retry = responses_received_ > 0 &&
+      (rv == ERR_CONNECTION_CLOSED || rv == ERR_CONNECTION_RESET);
+  Disconnect();
+
+  std::vector<CompletionCallback> callbacks;
+  for (PendingQueryMap::iterator it = pending_queries_.begin();
+       it != pending_queries_.end();) {
+    if (retry && !it->second.retried) {
+      it->second.retried = true;
+      write_queue_.push_back(it->first);
+      ++it;
+    } else {
+      callbacks.push_back(it->second.callback);
+      pending_queries_.erase(it++);
+    }
+  }
+  // The new socket is logged under the first query that will be resent.
+  if (!write_queue_.empty())
+    Connect(pending_queries_[write_queue_.front()].source);
+
+  base::WeakPtr<DnsTCPConnection> self = weak_factory_.GetWeakPtr();
+  for (size_t i = 0; i < callbacks.size() && self.get(); ++i)
+    callbacks[i].Run(rv);
+}
+
+void DnsTCPConnection::StartIdleTimerIfIdle() {
+  if (pending_queries_.empty() && state_ == STATE_CONNECTED) {
+    idle_timer_.Start(FROM_HERE,
+                      base::TimeDelta::FromSeconds(kIdleTimeoutSeconds),
+                      this, &DnsTCPConnection::CloseIfIdle);
+  }
+}
+
+void DnsTCPConnection::CloseIfIdle() {
+  if (pending_queries_.empty())
+    Disconnect();
+}
+
+void DnsTCPConnection::Disconnect() {
+  idle_timer_.Stop();
+  socket_.reset();
+  state_ = STATE_DISCONNECTED;
+  write_queue_.clear();
+  write_buffer_ = NULL;
+  write_pending_ = false;
+  read_buffer_ = NULL;
+  read_response_.reset();
+}
+
+}  // namespace net
@@ -0,0 +1,137 @@
+// Copyright 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef NET_DNS_DNS_TCP_CONNECTION_H_
+#define NET_DNS_DNS_TCP_CONNECTION_H_
+
+#include <deque>
+#include <map>
+
+#include "base/basictypes.h"
+#include "base/memory/ref_counted.h"
+#include "base/memory/scoped_ptr.h"
+#include "base/memory/weak_ptr.h"
+#include "base/threading/non_thread_safe.h"
+#include "base/timer/timer.h"
+#include "net/base/completion_callback.h"
+#include "net/base/net_export.h"
+#include "net/base/net_log.h"
+
+namespace net {
+
+class DnsQuery;
+class DnsResponse;
+class DnsSocketPool;
+class DrainableIOBuffer;
+class IOBufferWithSize;
+class StreamSocket;
+
+// A persistent TCP connection to a single DNS server, over which queries are
+// pipelined as described in RFC 5966: each query is written as soon as the
+// previous one is, and responses, which may arrive in any order, are matched
+// to queries by ID.
+//
+// The connection is established on the first query and closed after it has
+// been idle for a while. If the server closes it while queries are
+// outstanding, after having answered on it, each of those queries is retried
+// once on a new connection.
+class NET_EXPORT_PRIVATE DnsTCPConnection
+    : NON_EXPORTED_BASE(public base::NonThreadSafe) {
+ public:
+  // |pool| creates the sockets and must outlive the connection.
+  DnsTCPConnection(DnsSocketPool* pool, unsigned server_index);
+  ~DnsTCPConnection();
+
+  // Sends |query| and stores the matching response, which may not be valid
+  // yet, in |response|. Returns ERR_IO_PENDING and runs |callback| with the
+  // size of the response or a net error, never from within this call.
+  // Fails synchronously if a query with the same ID is outstanding. If the
+  // query opens a connection, the socket is logged as a child of |net_log|.
+  int Query(const DnsQuery& query,
+            scoped_ptr<DnsResponse>* response,
+            const CompletionCallback& callback,
+            const BoundNetLog& net_log);
+
+  // Cancels the outstanding query with |id|. Its response will be discarded.
+  void CancelQuery(uint16 id);
+
+  // Returns the net log bound to the source of the current socket.
+  const BoundNetLog& socket_net_log() const { return socket_net_log_; }
+
+ private:
+  struct PendingQuery;
+  typedef std::map<uint16, PendingQuery> PendingQueryMap;
+
+  enum State {
+    STATE_DISCONNECTED,
+    STATE_CONNECTING,
+    STATE_CONNECTED,
+  };
+
+  // Creates a socket logged as a child of |source| and posts a task to
+  // connect it.
+  void Connect(const NetLog::Source& source);
+  void DoConnect();
+  void OnConnectComplete(int rv);
+
+  // Writes queued queries until the socket blocks.
+  void DoWrite();
+  void OnWriteComplete(int rv);
+  // Returns false if the connection failed, in which case |this| may have
+  // been deleted.
+  bool DidWrite(int rv);
+
+  // Reads responses until the socket blocks.
+  void DoRead();
+  void OnReadComplete(int rv);
+  // Returns false if reading should stop, in which case |this| may have been
+  // deleted.
+  bool DidRead(int rv);
+
+  // Hands the response just read to its query. Returns false if |this| was
+  // deleted by the callback.
+  bool DispatchResponse();
+
+  // Closes the socket and retries or fails all outstanding queries with |rv|.
+  // |this| may be deleted by the callbacks.
+  void OnConnectionError(int rv);
+
+  // Closes the socket after the connection has been idle for a while.
+  void StartIdleTimerIfIdle();
+  void CloseIfIdle();
+  void Disconnect();
+
+  DnsSocketPool* pool_;
+  const unsigned server_index_;
+
+  State state_;
+  scoped_ptr<StreamSocket> socket_;
+  BoundNetLog socket_net_log_;
+  // Number of responses received on the current socket.
+  int responses_received_;
+
+  PendingQueryMap pending_queries_;
+  // IDs of the queries which have not been written yet.
+  std::deque<uint16> write_queue_;
+
+  // The query being written, with its length prefix.
+  scoped_refptr<DrainableIOBuffer> write_buffer_;
+  bool write_pending_;
+
+  // The length prefix or the response being read.
+  scoped_refptr<IOBufferWithSize> read_length_buffer_;
+  scoped_refptr<DrainableIOBuffer> read_buffer_;
+  scoped_ptr<DnsResponse> read_response_;
+  bool reading_length_;
+
+  base::OneShotTimer<DnsTCPConnection> idle_timer_;
+
+  base::WeakPtrFactory<DnsTCPConnection> weak_factory_;
+
+  DISALLOW_COPY_AND_ASSIGN(DnsTCPConnection);
+};
+
+}  // namespace net
+
+#endif  // NET_DNS_DNS_TCP_CONNECTION_H_
@@ -4,6 +4,7 @@
 
 #include "net/dns/dns_transaction.h"
 
+#include <algorithm>
 #include <deque>
 #include <string>
 #include <vector>
@@ -21,7 +22,6 @@
 #include "base/threading/non_thread_safe.h"
 #include "base/timer/timer.h"
 #include "base/values.h"
-#include "net/base/big_endian.h"
 #include "net/base/completion_callback.h"
 #include "net/base/dns_util.h"
 #include "net/base/io_buffer.h"
@@ -32,7 +32,7 @@
 #include "net/dns/dns_query.h"
 #include "net/dns/dns_response.h"
 #include "net/dns/dns_session.h"
-#include "net/socket/stream_socket.h"
+#include "net/dns/dns_tcp_connection.h"
 #include "net/udp/datagram_client_socket.h"
 
 namespace net {
@@ -293,31 +293,34 @@ class DnsUDPAttempt : public DnsAttempt {
   DISALLOW_COPY_AND_ASSIGN(DnsUDPAttempt);
 };
 
+// Sends its query over the persistent TCP connection to the server, which
+// may be carrying queries of other transactions at the same time.
 class DnsTCPAttempt : public DnsAttempt {
  public:
   DnsTCPAttempt(unsigned server_index,
-                scoped_ptr<StreamSocket> socket,
-                scoped_ptr<DnsQuery> query)
+                DnsTCPConnection* connection,
+                scoped_ptr<DnsQuery> query,
+                const BoundNetLog& net_log)
       : DnsAttempt(server_index),
-        next_state_(STATE_NONE),
-        socket_(socket.Pass()),
+        connection_(connection),
         query_(query.Pass()),
-        length_buffer_(new IOBufferWithSize(sizeof(uint16))),
-        response_length_(0) {}
+        net_log_(net_log) {}
+
+  virtual ~DnsTCPAttempt() {
+    if (is_pending())
+      connection_->CancelQuery(query_->id());
+  }
 
   // DnsAttempt:
   virtual int Start(const CompletionCallback& callback) OVERRIDE {
-    DCHECK_EQ(STATE_NONE, next_state_);
     callback_ = callback;
     start_time_ = base::TimeTicks::Now();
-    next_state_ = STATE_CONNECT_COMPLETE;
-    int rv = socket_->Connect(base::Bind(&DnsTCPAttempt::OnIOComplete,
-                                         base::Unretained(this)));
-    if (rv == ERR_IO_PENDING) {
-      set_result(rv);
-      return rv;
-    }
-    return DoLoop(rv);
+    int rv = connection_->Query(*query_, &response_,
+                                base::Bind(&DnsTCPAttempt::OnQueryComplete,
+                                           base::Unretained(this)),
+                                net_log_);
+    set_result(rv);
+    return rv;
   }
 
   virtual const DnsQuery* GetQuery() const OVERRIDE {
@@ -330,147 +333,17 @@ class DnsTCPAttempt : public DnsAttempt {
   }
 
   virtual const BoundNetLog& GetSocketNetLog() const OVERRIDE {
-    return socket_->NetLog();
+    return connection_->socket_net_log();
   }
 
  private:
-  enum State {
-    STATE_CONNECT_COMPLETE,
-    STATE_SEND_LENGTH,
-    STATE_SEND_QUERY,
-    STATE_READ_LENGTH,
-    STATE_READ_RESPONSE,
-    STATE_NONE,
-  };
-
-  int DoLoop(int result) {
-    CHECK_NE(STATE_NONE, next_state_);
-    int rv = result;
-    do {
-      State state = next_state_;
-      next_state_ = STATE_NONE;
-      switch (state) {
-        case STATE_CONNECT_COMPLETE:
-          rv = DoConnectComplete(rv);
-          break;
-        case STATE_SEND_LENGTH:
-          rv = DoSendLength(rv);
-          break;
-        case STATE_SEND_QUERY:
-          rv = DoSendQuery(rv);
-          break;
-        case STATE_READ_LENGTH:
-          rv = DoReadLength(rv);
-          break;
-        case STATE_READ_RESPONSE:
-          rv = DoReadResponse(rv);
-          break;
-        default:
-          NOTREACHED();
-          break;
-      }
-    } while (rv != ERR_IO_PENDING && next_state_ != STATE_NONE);
-
-    set_result(rv);
-    if (rv == OK) {
-      DCHECK_EQ(STATE_NONE, next_state_);
-      DNS_HISTOGRAM("AsyncDNS.TCPAttemptSuccess",
-                    base::TimeTicks::Now() - start_time_);
-    } else if (rv != ERR_IO_PENDING) {
-      DNS_HISTOGRAM("AsyncDNS.TCPAttemptFail",
-                    base::TimeTicks::Now() - start_time_);
-    }
-    return rv;
-  }
-
-  int DoConnectComplete(int rv) {
-    DCHECK_NE(ERR_IO_PENDING, rv);
-    if (rv < 0)
-      return rv;
-
-    WriteBigEndian<uint16>(length_buffer_->data(), query_->io_buffer()->size());
-    buffer_ =
-        new DrainableIOBuffer(length_buffer_.get(), length_buffer_->size());
-    next_state_ = STATE_SEND_LENGTH;
-    return OK;
-  }
-
-  int DoSendLength(int rv) {
-    DCHECK_NE(ERR_IO_PENDING, rv);
-    if (rv < 0)
-      return rv;
-
-    buffer_->DidConsume(rv);
-    if (buffer_->BytesRemaining() > 0) {
-      next_state_ = STATE_SEND_LENGTH;
-      return socket_->Write(
-          buffer_.get(),
-          buffer_->BytesRemaining(),
-          base::Bind(&DnsTCPAttempt::OnIOComplete, base::Unretained(this)));
-    }
-    buffer_ = new DrainableIOBuffer(query_->io_buffer(),
-                                    query_->io_buffer()->size());
-    next_state_ = STATE_SEND_QUERY;
-    return OK;
-  }
-
-  int DoSendQuery(int rv) {
-    DCHECK_NE(ERR_IO_PENDING, rv);
-    if (rv < 0)
-      return rv;
-
-    buffer_->DidConsume(rv);
-    if (buffer_->BytesRemaining() > 0) {
-      next_state_ = STATE_SEND_QUERY;
-      return socket_->Write(
-          buffer_.get(),
-          buffer_->BytesRemaining(),
-          base::Bind(&DnsTCPAttempt::OnIOComplete, base::Unretained(this)));
-    }
-    buffer_ =
-        new DrainableIOBuffer(length_buffer_.get(), length_buffer_->size());
-    next_state_ = STATE_READ_LENGTH;
-    return OK;
-  }
-
-  int DoReadLength(int rv) {
+  // |rv| is the size of the response or a net error.
+  int ProcessResponse(int rv) {
     DCHECK_NE(ERR_IO_PENDING, rv);
     if (rv < 0)
       return rv;
 
-    buffer_->DidConsume(rv);
-    if (buffer_->BytesRemaining() > 0) {
-      next_state_ = STATE_READ_LENGTH;
-      return socket_->Read(
-          buffer_.get(),
-          buffer_->BytesRemaining(),
-          base::Bind(&DnsTCPAttempt::OnIOComplete, base::Unretained(this)));
-    }
-    ReadBigEndian<uint16>(length_buffer_->data(), &response_length_);
-    // Check if advertised response is too short. (Optimization only.)
-    if (response_length_ < query_->io_buffer()->size())
-      return ERR_DNS_MALFORMED_RESPONSE;
-    // Allocate more space so that DnsResponse::InitParse sanity check passes.
-    response_.reset(new DnsResponse(response_length_ + 1));
-    buffer_ = new DrainableIOBuffer(response_->io_buffer(), response_length_);
-    next_state_ = STATE_READ_RESPONSE;
-    return OK;
-  }
-
-  int DoReadResponse(int rv) {
-    DCHECK_NE(ERR_IO_PENDING, rv);
-    if (rv < 0)
-      return rv;
-
-    buffer_->DidConsume(rv);
-    if (buffer_->BytesRemaining() > 0) {
-      next_state_ = STATE_READ_RESPONSE;
-      return socket_->Read(
-          buffer_.get(),
-          buffer_->BytesRemaining(),
-          base::Bind(&DnsTCPAttempt::OnIOComplete, base::Unretained(this)));
-    }
-    if (!response_->InitParse(buffer_->BytesConsumed(), *query_))
+    if (!response_->InitParse(rv, *query_))
       return ERR_DNS_MALFORMED_RESPONSE;
     if (response_->flags() & dns_protocol::kFlagTC)
       return ERR_UNEXPECTED;
@@ -483,22 +356,26 @@ class DnsTCPAttempt : public DnsAttempt {
     return OK;
   }
 
-  void OnIOComplete(int rv) {
-    rv = DoLoop(rv);
-    if (rv != ERR_IO_PENDING)
-      callback_.Run(rv);
+  void OnQueryComplete(int rv) {
+    rv = ProcessResponse(rv);
+    set_result(rv);
+    if (rv == OK) {
+      DNS_HISTOGRAM("AsyncDNS.TCPAttemptSuccess",
+                    base::TimeTicks::Now() - start_time_);
+    } else {
+      DNS_HISTOGRAM("AsyncDNS.TCPAttemptFail",
+                    base::TimeTicks::Now() - start_time_);
+    }
+    callback_.Run(rv);
   }
 
-  State next_state_;
   base::TimeTicks start_time_;
 
-  scoped_ptr<StreamSocket> socket_;
+  DnsTCPConnection* connection_;
   scoped_ptr<DnsQuery> query_;
-  scoped_refptr<IOBufferWithSize> length_buffer_;
-  scoped_refptr<DrainableIOBuffer> buffer_;
-
-  uint16 response_length_;
   scoped_ptr<DnsResponse> response_;
+  // The net log of the transaction, under which a new socket is logged.
+  BoundNetLog net_log_;
 
   CompletionCallback callback_;
 
@@ -512,7 +389,12 @@ class DnsTCPAttempt : public DnsAttempt {
 // The timeout for each DnsUDPAttempt is given by DnsSession::NextTimeout.
 // The first server to attempt on each query is given by
 // DnsSession::NextFirstServerIndex, and the order is round-robin afterwards.
+// If DnsConfig::race_count is greater than 1, the first attempt goes to that
+// many servers at once, fastest first, as given by DnsSession. A server which
+// fails loses the race, and the race ends when the others fail too or time
+// out. The servers which did not race are attempted next.
 // Each server is attempted DnsConfig::attempts times.
+// Queries over TCP are pipelined on the session's connection to the server.
 class DnsTransactionImpl : public DnsTransaction,
                            public base::NonThreadSafe,
                            public base::SupportsWeakPtr<DnsTransactionImpl> {
@@ -663,6 +545,95 @@ class DnsTransactionImpl : public DnsTransaction,
   // Makes another attempt at the current name, |qnames_.front()|, using the
   // next nameserver.
   AttemptResult MakeAttempt() {
+    return MakeUDPAttempt(NextServerIndex(attempts_.size()));
+  }
+
+  // Returns the server for attempt |attempt_number| at the current name.
+  // After a race, the servers which did not race are tried first.
+  unsigned NextServerIndex(unsigned attempt_number) const {
+    const unsigned num_servers = session_->config().nameservers.size();
+    unsigned position = attempt_number;
+    if (!raced_servers_.empty()) {
+      DCHECK_GE(attempt_number, raced_servers_.size());
+      position -= raced_servers_.size();
+      for (unsigned i = 0; i < num_servers; ++i) {
+        unsigned server_index = (first_server_index_ + i) % num_servers;
+        if (std::find(raced_servers_.begin(), raced_servers_.end(),
+                      server_index) != raced_servers_.end()) {
+          continue;
+        }
+        if (position == 0)
+          return server_index;
+        --position;
+      }
+    }
+    // Skip over known failed servers.
+    return session_->NextGoodServerIndex(
+        (first_server_index_ + position) % num_servers);
+  }
+
+  // Makes the first attempt at the current name to each of the fastest
+  // servers at once, and waits for the first of them to respond.
+  AttemptResult MakeRacingAttempts() {
+    const DnsConfig& config = session_->config();
+    session_->GetFastestServers(first_server_index_, config.race_count,
+                                &raced_servers_);
+
+    base::TimeDelta timeout;
+    AttemptResult lost_result(ERR_IO_PENDING, NULL);
+    for (size_t i = 0; i < raced_servers_.size(); ++i) {
+      AttemptResult result = MakeUDPAttempt(raced_servers_[i]);
+      if (result.rv == ERR_IO_PENDING) {
+        timeout = std::max(timeout, session_->NextTimeout(raced_servers_[i],
+                                                          0));
+        continue;
+      }
+      if (!IsServerFailure(result.rv))
+        return result;
+      // A server which failed at once lost the race, but the others may
+      // still respond.
+      if (lost_result.rv != ERR_IO_PENDING)
+        RecordLostRacer(lost_result);
+      lost_result = result;
+    }
+    if (lost_result.rv != ERR_IO_PENDING) {
+      // If every server failed at once, fall back to the next one.
+      if (!OtherRacersPending(NULL))
+        return lost_result;
+      RecordLostRacer(lost_result);
+    }
+    // Give the slowest of them a chance before moving on.
+    timer_.Start(FROM_HERE, timeout, this, &DnsTransactionImpl::OnTimeout);
+    return AttemptResult(ERR_IO_PENDING, NULL);
+  }
+
+  // True if |rv| only tells that a server failed, so that another server
+  // may still answer the query.
+  static bool IsServerFailure(int rv) {
+    DCHECK_NE(ERR_IO_PENDING, rv);
+    return rv != OK && rv != ERR_NAME_NOT_RESOLVED &&
+        rv != ERR_DNS_SERVER_REQUIRES_TCP;
+  }
+
+  // True if an attempt of the current race other than |attempt| is pending.
+  bool OtherRacersPending(const DnsAttempt* attempt) const {
+    size_t num_racers = std::min(raced_servers_.size(), attempts_.size());
+    for (size_t i = 0; i < num_racers; ++i) {
+      if (attempts_[i] != attempt && attempts_[i]->is_pending())
+        return true;
+    }
+    return false;
+  }
+
+  // Records the failure of a server which lost the race.
+  void RecordLostRacer(const AttemptResult& result) {
+    LogResponse(result.attempt);
+    if (result.attempt)
+      session_->RecordServerFailure(result.attempt->server_index());
+  }
+
+  // Makes an attempt at the current name using the server at |server_index|.
+  AttemptResult MakeUDPAttempt(unsigned server_index) {
     unsigned attempt_number = attempts_.size();
 
     uint16 id = session_->NextQueryId();
@@ -673,13 +644,6 @@ class DnsTransactionImpl : public DnsTransaction,
       query.reset(attempts_[0]->GetQuery()->CloneWithNewId(id));
     }
 
-    const DnsConfig& config = session_->config();
-
-    unsigned server_index =
-        (first_server_index_ + attempt_number) % config.nameservers.size();
-    // Skip over known failed servers.
-    server_index = session_->NextGoodServerIndex(server_index);
-
     scoped_ptr<DnsSession::SocketLease> lease =
         session_->AllocateSocket(server_index, net_log_.source());
 
@@ -716,9 +680,6 @@ class DnsTransactionImpl : public DnsTransaction,
 
     unsigned server_index = previous_attempt->server_index();
 
-    scoped_ptr<StreamSocket> socket(
-        session_->CreateTCPSocket(server_index, net_log_.source()));
-
     // TODO(szym): Reuse the same id to help the server?
     uint16 id = session_->NextQueryId();
     scoped_ptr<DnsQuery> query(
@@ -727,23 +688,26 @@ class DnsTransactionImpl : public DnsTransaction,
     RecordLostPacketsIfAny();
     // Cancel all other attempts, no point waiting on them.
     attempts_.clear();
+    raced_servers_.clear();
 
     unsigned attempt_number = attempts_.size();
 
-    DnsTCPAttempt* attempt = new DnsTCPAttempt(server_index, socket.Pass(),
-                                               query.Pass());
+    DnsTCPAttempt* attempt = new DnsTCPAttempt(
+        server_index, session_->GetTCPConnection(server_index), query.Pass(),
+        net_log_);
 
     attempts_.push_back(attempt);
     ++attempts_count_;
     had_tcp_attempt_ = true;
 
-    net_log_.AddEvent(
-        NetLog::TYPE_DNS_TRANSACTION_TCP_ATTEMPT,
-        attempt->GetSocketNetLog().source().ToEventParametersCallback());
-
     int rv = attempt->Start(base::Bind(&DnsTransactionImpl::OnAttemptComplete,
                                        base::Unretained(this),
                                        attempt_number));
+
+    // The connection has a socket once the query is started.
+    net_log_.AddEvent(
+        NetLog::TYPE_DNS_TRANSACTION_TCP_ATTEMPT,
+        attempt->GetSocketNetLog().source().ToEventParametersCallback());
     if (rv == ERR_IO_PENDING) {
       // Custom timeout for TCP attempt.
       base::TimeDelta timeout = timer_.GetCurrentDelay() * 2;
@@ -762,6 +726,9 @@ class DnsTransactionImpl : public DnsTransaction,
     RecordLostPacketsIfAny();
     attempts_.clear();
     had_tcp_attempt_ = false;
+    raced_servers_.clear();
+    if (session_->config().race_count > 1)
+      return MakeRacingAttempts();
     return MakeAttempt();
   }
 
@@ -800,6 +767,9 @@ class DnsTransactionImpl : public DnsTransaction,
     // record any attempts as lost packets.
     if (first_completed == attempts_.size())
       return;
+    // The servers which lost a race were not expected to respond first.
+    if (first_completed < raced_servers_.size())
+      return;
 
     size_t num_servers = session_->config().nameservers.size();
     std::vector<int> server_attempts(num_servers);
@@ -859,6 +829,11 @@ class DnsTransactionImpl : public DnsTransaction,
         case ERR_DNS_TIMED_OUT:
           if (result.attempt)
             session_->RecordServerFailure(result.attempt->server_index());
+          // A server which lost the race does not end it.
+          if (result.rv != ERR_DNS_TIMED_OUT &&
+              OtherRacersPending(result.attempt)) {
+            return AttemptResult(ERR_IO_PENDING, NULL);
+          }
           if (MoreAttemptsAllowed()) {
             result = MakeAttempt();
           } else {
@@ -871,8 +846,9 @@ class DnsTransactionImpl : public DnsTransaction,
         default:
           // Server failure.
           DCHECK(result.attempt);
-          if (result.attempt != attempts_.back()) {
-            // This attempt already timed out. Ignore it.
+          if (result.attempt != attempts_.back() ||
+              OtherRacersPending(result.attempt)) {
+            // This attempt already timed out or lost the race. Ignore it.
             session_->RecordServerFailure(result.attempt->server_index());
             return AttemptResult(ERR_IO_PENDING, NULL);
           }
@@ -919,6 +895,9 @@ class DnsTransactionImpl : public DnsTransaction,
   // Count of attempts, not reset when |attempts_| vector is cleared.
   int  attempts_count_;
   bool had_tcp_attempt_;
+  // Servers of the attempts at the start of |attempts_| that raced each
+  // other, fastest first.
+  std::vector<unsigned> raced_servers_;
 
   // Index of the first server to try on each search query.
   int first_server_index_;
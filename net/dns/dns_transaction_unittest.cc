@@ -18,6 +18,8 @@
 #include "net/dns/dns_response.h"
 #include "net/dns/dns_session.h"
 #include "net/dns/dns_test_util.h"
+#include "net/dns/test_dns_server.h"
+#include "net/socket/client_socket_factory.h"
 #include "net/socket/socket_test_util.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -43,16 +45,17 @@ class DnsSocketData {
       : query_(new DnsQuery(id, DomainFromDot(dotted_name), qtype)),
         use_tcp_(use_tcp) {
     if (use_tcp_) {
-      scoped_ptr<uint16> length(new uint16);
-      *length = base::HostToNet16(query_->io_buffer()->size());
+      // The length prefix and the query go out in a single write.
+      uint16 length = base::HostToNet16(query_->io_buffer()->size());
+      tcp_query_.assign(reinterpret_cast<const char*>(&length), sizeof(length));
+      tcp_query_.append(query_->io_buffer()->data(),
+                        query_->io_buffer()->size());
+      writes_.push_back(MockWrite(mode, tcp_query_.data(), tcp_query_.size()));
+    } else {
       writes_.push_back(MockWrite(mode,
-                                  reinterpret_cast<const char*>(length.get()),
-                                  sizeof(uint16)));
-      lengths_.push_back(length.release());
+                                  query_->io_buffer()->data(),
+                                  query_->io_buffer()->size()));
     }
-    writes_.push_back(MockWrite(mode,
-                                query_->io_buffer()->data(),
-                                query_->io_buffer()->size()));
   }
   ~DnsSocketData() {}
 
@@ -130,6 +133,7 @@ class DnsSocketData {
  private:
   scoped_ptr<DnsQuery> query_;
   bool use_tcp_;
+  std::string tcp_query_;
   ScopedVector<uint16> lengths_;
   ScopedVector<DnsResponse> responses_;
   std::vector<MockWrite> writes_;
@@ -658,6 +662,84 @@ TEST_F(DnsTransactionTest, ServerFallbackAndRotate) {
   CheckServerOrder(kOrder, arraysize(kOrder));
 }
 
+TEST_F(DnsTransactionTest, RaceServers) {
+  config_.race_count = 2;
+  ConfigureNumServers(3);
+  ConfigureFactory();
+
+  // The first server does not respond, but the second one does, so there is
+  // no need to wait for a timeout.
+  AddQueryAndTimeout(kT0HostName, kT0Qtype);
+  AddAsyncQueryAndResponse(0 /* id */, kT0HostName, kT0Qtype,
+                           kT0ResponseDatagram, arraysize(kT0ResponseDatagram));
+
+  TransactionHelper helper0(kT0HostName, kT0Qtype, kT0RecordCount);
+  EXPECT_TRUE(helper0.Run(transaction_factory_.get()));
+
+  unsigned kOrder[] = { 0, 1 };
+  CheckServerOrder(kOrder, arraysize(kOrder));
+}
+
+TEST_F(DnsTransactionTest, RaceFastestServers) {
+  config_.race_count = 2;
+  ConfigureNumServers(3);
+  ConfigureFactory();
+
+  // The last server has been the fastest.
+  session_->RecordRTT(2, base::TimeDelta::FromMilliseconds(1));
+
+  AddAsyncQueryAndRcode(kT0HostName, kT0Qtype, dns_protocol::kRcodeNXDOMAIN);
+  AddQueryAndTimeout(kT0HostName, kT0Qtype);
+
+  TransactionHelper helper0(kT0HostName, kT0Qtype, ERR_NAME_NOT_RESOLVED);
+  EXPECT_TRUE(helper0.Run(transaction_factory_.get()));
+
+  unsigned kOrder[] = { 2, 0 };
+  CheckServerOrder(kOrder, arraysize(kOrder));
+}
+
+TEST_F(DnsTransactionTest, RaceServersSyncFailure) {
+  config_.race_count = 2;
+  ConfigureNumServers(3);
+  ConfigureFactory();
+
+  // The second server has been the fastest, but it cannot be connected to.
+  // The first server still races, and there is no need to try another one.
+  session_->RecordRTT(1, base::TimeDelta::FromMilliseconds(1));
+  transaction_ids_.push_back(0);  // Needed to make a DnsUDPAttempt.
+  socket_factory_->fail_next_socket_ = true;
+  AddAsyncQueryAndResponse(0 /* id */, kT0HostName, kT0Qtype,
+                           kT0ResponseDatagram, arraysize(kT0ResponseDatagram));
+
+  TransactionHelper helper0(kT0HostName, kT0Qtype, kT0RecordCount);
+  EXPECT_TRUE(helper0.Run(transaction_factory_.get()));
+
+  unsigned kOrder[] = { 0 };
+  CheckServerOrder(kOrder, arraysize(kOrder));
+}
+
+TEST_F(DnsTransactionTest, RaceServersFallBackToServerNotRaced) {
+  config_.race_count = 2;
+  ConfigureNumServers(3);
+  // Use short timeout to speed up the test.
+  config_.timeout = TestTimeouts::tiny_timeout();
+  ConfigureFactory();
+
+  // The last server has been the fastest, so the race is between the last
+  // and the first server. Neither responds, so the second one is next.
+  session_->RecordRTT(2, base::TimeDelta::FromMilliseconds(1));
+  AddQueryAndTimeout(kT0HostName, kT0Qtype);
+  AddQueryAndTimeout(kT0HostName, kT0Qtype);
+  AddAsyncQueryAndResponse(0 /* id */, kT0HostName, kT0Qtype,
+                           kT0ResponseDatagram, arraysize(kT0ResponseDatagram));
+
+  TransactionHelper helper0(kT0HostName, kT0Qtype, kT0RecordCount);
+  EXPECT_TRUE(helper0.RunUntilDone(transaction_factory_.get()));
+
+  unsigned kOrder[] = { 2, 0, 1 };
+  CheckServerOrder(kOrder, arraysize(kOrder));
+}
+
 TEST_F(DnsTransactionTest, SuffixSearchAboveNdots) {
   config_.ndots = 2;
   config_.search.push_back("a");
@@ -935,6 +1017,70 @@ TEST_F(DnsTransactionTest, InvalidQuery) {
   EXPECT_TRUE(helper0.Run(transaction_factory_.get()));
 }
 
+// Uses TestDnsServer and real sockets.
+class DnsTransactionServerTest : public testing::Test {
+ protected:
+  virtual void SetUp() OVERRIDE {
+    config_.attempts = 1;
+    // Long enough that waiting for a timeout fails the test.
+    config_.timeout = TestTimeouts::action_timeout();
+  }
+
+  // Called after fully configuring |config|.
+  void ConfigureFactory() {
+    session_ = new DnsSession(
+        config_,
+        DnsSocketPool::CreateNull(ClientSocketFactory::GetDefaultFactory()),
+        base::Bind(&base::RandInt),
+        NULL /* NetLog */);
+    transaction_factory_ = DnsTransactionFactory::CreateFactory(session_.get());
+  }
+
+  DnsConfig config_;
+  scoped_refptr<DnsSession> session_;
+  scoped_ptr<DnsTransactionFactory> transaction_factory_;
+};
+
+TEST_F(DnsTransactionServerTest, RaceLossyServer) {
+  TestDnsServer lossy_server;
+  ASSERT_TRUE(lossy_server.Start());
+  lossy_server.set_loss_percent(100);
+  TestDnsServer server;
+  ASSERT_TRUE(server.Start());
+
+  config_.nameservers.push_back(lossy_server.endpoint());
+  config_.nameservers.push_back(server.endpoint());
+  config_.race_count = 2;
+  ConfigureFactory();
+
+  TransactionHelper helper0("www.example.com", dns_protocol::kTypeA, 1);
+  EXPECT_TRUE(helper0.RunUntilDone(transaction_factory_.get()));
+  EXPECT_EQ(1, server.udp_queries());
+}
+
+TEST_F(DnsTransactionServerTest, PipelineTCPQueries) {
+  TestDnsServer server;
+  ASSERT_TRUE(server.Start());
+  server.set_truncate_udp(true);
+
+  config_.nameservers.push_back(server.endpoint());
+  ConfigureFactory();
+
+  TransactionHelper helper0("a.example.com", dns_protocol::kTypeA, 1);
+  helper0.set_quit_in_callback();
+  helper0.StartTransaction(transaction_factory_.get());
+  TransactionHelper helper1("b.example.com", dns_protocol::kTypeA, 1);
+  helper1.set_quit_in_callback();
+  helper1.StartTransaction(transaction_factory_.get());
+  while (!helper0.has_completed() || !helper1.has_completed())
+    base::MessageLoop::current()->Run();
+
+  // Both transactions fell back to the same TCP connection.
+  EXPECT_EQ(2, server.udp_queries());
+  EXPECT_EQ(2, server.tcp_queries());
+  EXPECT_EQ(1, server.tcp_connections());
+}
+
 }  // namespace
 
 }  // namespace net
@@ -4,28 +4,46 @@
 
 #include "net/dns/host_cache.h"
 
+#include <algorithm>
+
 #include "base/logging.h"
 #include "base/metrics/field_trial.h"
 #include "base/metrics/histogram.h"
 #include "base/strings/string_number_conversions.h"
+#include "base/values.h"
 #include "net/base/net_errors.h"
+#include "net/base/net_util.h"
 
 namespace net {
 
+namespace {
+
+// Keys of the dictionaries produced by GetAsListValue().
+const char kHostnameKey[] = "hostname";
+const char kAddressFamilyKey[] = "address_family";
+const char kFlagsKey[] = "flags";
+const char kExpirationKey[] = "expiration";
+const char kAddressesKey[] = "addresses";
+const char kCanonicalNameKey[] = "canonical_name";
+
+}  // namespace
+
 //-----------------------------------------------------------------------------
 
 HostCache::Entry::Entry(int error, const AddressList& addrlist,
                         base::TimeDelta ttl)
     : error(error),
       addrlist(addrlist),
-      ttl(ttl) {
+      ttl(ttl),
+      hits(0) {
   DCHECK(ttl >= base::TimeDelta());
 }
 
 HostCache::Entry::Entry(int error, const AddressList& addrlist)
     : error(error),
       addrlist(addrlist),
-      ttl(base::TimeDelta::FromSeconds(-1)) {
+      ttl(base::TimeDelta::FromSeconds(-1)),
+      hits(0) {
 }
 
 HostCache::Entry::~Entry() {
@@ -34,7 +52,15 @@ HostCache::Entry::~Entry() {
 //-----------------------------------------------------------------------------
 
 HostCache::HostCache(size_t max_entries)
-    : entries_(max_entries) {
+    : entries_(max_entries),
+      delegate_(NULL) {
+}
+
+HostCache::HostCache(size_t max_entries, base::TimeDelta max_staleness)
+    : entries_(max_entries),
+      max_staleness_(max_staleness),
+      delegate_(NULL) {
+  DCHECK(max_staleness >= base::TimeDelta());
 }
 
 HostCache::~HostCache() {
@@ -42,11 +68,25 @@ HostCache::~HostCache() {
 
 const HostCache::Entry* HostCache::Lookup(const Key& key,
                                           base::TimeTicks now) {
-  DCHECK(CalledOnValidThread());
-  if (caching_is_disabled())
+  Entry* entry = LookupInternal(key, now);
+  if (!entry || entry->expires <= now)
     return NULL;
 
-  return entries_.Get(key, now);
+  ++entry->hits;
+  return entry;
+}
+
+const HostCache::Entry* HostCache::LookupStale(const Key& key,
+                                               base::TimeTicks now,
+                                               EntryStaleness* staleness) {
+  DCHECK(staleness);
+  Entry* entry = LookupInternal(key, now);
+  if (!entry)
+    return NULL;
+
+  staleness->expired_by = now - entry->expires;
+  ++entry->hits;
+  return entry;
 }
 
 void HostCache::Set(const Key& key,
@@ -57,12 +97,133 @@ void HostCache::Set(const Key& key,
   if (caching_is_disabled())
     return;
 
-  entries_.Put(key, entry, now, now + ttl);
+  Entry new_entry(entry);
+  new_entry.expires = now + ttl;
+  new_entry.hits = 0;
+  // Only successful results are worth serving after they expire.
+  base::TimeTicks expiration = new_entry.expires;
+  if (entry.error == OK)
+    expiration += max_staleness_;
+  entries_.Put(key, new_entry, now, expiration);
+
+  if (delegate_ && entry.error == OK)
+    delegate_->ScheduleWrite();
 }
 
 void HostCache::clear() {
   DCHECK(CalledOnValidThread());
+  if (entries_.empty())
+    return;
   entries_.Clear();
+  if (delegate_)
+    delegate_->ScheduleWrite();
+}
+
+base::ListValue* HostCache::GetAsListValue() const {
+  DCHECK(CalledOnValidThread());
+  // Expiration times are persisted as wall clock times, since TimeTicks are
+  // meaningless after a restart.
+  base::TimeTicks now_ticks = base::TimeTicks::Now();
+  base::Time now = base::Time::Now();
+
+  base::ListValue* entry_list = new base::ListValue();
+  for (EntryMap::Iterator it(entries_); it.HasNext(); it.Advance()) {
+    const Key& key = it.key();
+    const Entry& entry = it.value();
+    if (entry.error != OK)
+      continue;
+
+    base::DictionaryValue* entry_dict = new base::DictionaryValue();
+    entry_dict->SetString(kHostnameKey, key.hostname);
+    entry_dict->SetInteger(kAddressFamilyKey,
+                           static_cast<int>(key.address_family));
+    entry_dict->SetInteger(kFlagsKey, key.host_resolver_flags);
+    base::Time expiration = now + (entry.expires - now_ticks);
+    entry_dict->SetString(kExpirationKey,
+                          base::Int64ToString(expiration.ToInternalValue()));
+
+    base::ListValue* addresses = new base::ListValue();
+    for (size_t i = 0; i < entry.addrlist.size(); ++i)
+      addresses->AppendString(entry.addrlist[i].ToStringWithoutPort());
+    entry_dict->Set(kAddressesKey, addresses);
+    if (!entry.addrlist.canonical_name().empty()) {
+      entry_dict->SetString(kCanonicalNameKey,
+                            entry.addrlist.canonical_name());
+    }
+
+    entry_list->Append(entry_dict);
+  }
+  return entry_list;
+}
+
+bool HostCache::RestoreFromListValue(const base::ListValue& old_cache) {
+  DCHECK(CalledOnValidThread());
+  if (caching_is_disabled())
+    return true;
+
+  base::TimeTicks now_ticks = base::TimeTicks::Now();
+  base::Time now = base::Time::Now();
+
+  int restored = 0;
+  bool success = true;
+  for (size_t i = 0; i < old_cache.GetSize(); ++i) {
+    const base::DictionaryValue* entry_dict = NULL;
+    std::string hostname;
+    int address_family;
+    int flags;
+    std::string expiration_string;
+    int64 expiration_value;
+    const base::ListValue* addresses = NULL;
+    if (!old_cache.GetDictionary(i, &entry_dict) ||
+        !entry_dict->GetString(kHostnameKey, &hostname) ||
+        !entry_dict->GetInteger(kAddressFamilyKey, &address_family) ||
+        !entry_dict->GetInteger(kFlagsKey, &flags) ||
+        !entry_dict->GetString(kExpirationKey, &expiration_string) ||
+        !base::StringToInt64(expiration_string, &expiration_value) ||
+        !entry_dict->GetList(kAddressesKey, &addresses) ||
+        address_family < ADDRESS_FAMILY_UNSPECIFIED ||
+        address_family > ADDRESS_FAMILY_IPV6) {
+      success = false;
+      break;
+    }
+
+    AddressList address_list;
+    for (size_t j = 0; success && j < addresses->GetSize(); ++j) {
+      std::string address_string;
+      IPAddressNumber address;
+      if (!addresses->GetString(j, &address_string) ||
+          !ParseIPLiteralToNumber(address_string, &address)) {
+        success = false;
+      } else {
+        address_list.push_back(IPEndPoint(address, 0));
+      }
+    }
+    if (!success)
+      break;
+    std::string canonical_name;
+    if (entry_dict->GetString(kCanonicalNameKey, &canonical_name))
+      address_list.set_canonical_name(canonical_name);
+
+    base::TimeTicks expires = now_ticks +
+        (base::Time::FromInternalValue(expiration_value) - now);
+    // Whatever was resolved before the restart might not hold on the current
+    // network, so restored entries are never fresh.
+    expires = std::min(expires, now_ticks);
+    if (expires + max_staleness_ <= now_ticks)
+      continue;
+
+    Key key(hostname, static_cast<AddressFamily>(address_family), flags);
+    if (entries_.Get(key, now_ticks))
+      continue;
+
+    Entry entry(OK, address_list);
+    entry.expires = expires;
+    entries_.Put(key, entry, now_ticks, expires + max_staleness_);
+    ++restored;
+  }
+
+  UMA_HISTOGRAM_COUNTS_10000("DNS.CacheRestored", restored);
+  return success;
 }
 
 size_t HostCache::size() const {
@@ -81,6 +242,15 @@ const HostCache::EntryMap& HostCache::entries() const {
   return entries_;
 }
 
+HostCache::Entry* HostCache::LookupInternal(const Key& key,
+                                            base::TimeTicks now) {
+  DCHECK(CalledOnValidThread());
+  if (caching_is_disabled())
+    return NULL;
+
+  return entries_.GetMutable(key, now);
+}
+
 // static
 scoped_ptr<HostCache> HostCache::CreateDefaultCache() {
   // Cache capacity is determined by the field trial.
@@ -95,7 +265,18 @@ scoped_ptr<HostCache> HostCache::CreateDefaultCache() {
                       &max_entries);
   if ((max_entries == 0) || (max_entries > kSaneMaxEntries))
     max_entries = kDefaultMaxEntries;
-  return make_scoped_ptr(new HostCache(max_entries));
+
+  // Expired entries are only served while they are refreshed if the field
+  // trial says for how long.
+  int max_staleness_seconds = 0;
+  if (!base::StringToInt(
+          base::FieldTrialList::FindFullName("HostCacheMaxStaleness"),
+          &max_staleness_seconds) ||
+      max_staleness_seconds < 0) {
+    max_staleness_seconds = 0;
+  }
+  return make_scoped_ptr(new HostCache(
+      max_entries, base::TimeDelta::FromSeconds(max_staleness_seconds)));
 }
 
 void HostCache::EvictionHandler::Handle(
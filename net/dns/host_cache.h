@@ -17,6 +17,10 @@
 #include "net/base/expiring_cache.h"
 #include "net/base/net_export.h"
 
+namespace base {
+class ListValue;
+}
+
 namespace net {
 
 // Cache used by HostResolver to map hostnames to their resolved result.
@@ -36,6 +40,32 @@ class NET_EXPORT HostCache : NON_EXPORTED_BASE(public base::NonThreadSafe) {
     AddressList addrlist;
     // TTL obtained from the nameserver. Negative if unknown.
     base::TimeDelta ttl;
+
+    // Following are set by the HostCache.
+    // Time at which the entry stops being fresh. Successful entries are kept
+    // for up to max_staleness() past this time, see LookupStale().
+    base::TimeTicks expires;
+    // Number of lookups that returned this entry since it was last set.
+    int hits;
+  };
+
+  // Describes the freshness of an entry returned by LookupStale().
+  struct EntryStaleness {
+    bool is_stale() const { return expired_by >= base::TimeDelta(); }
+
+    // How long ago the entry stopped being fresh. Negative while it is still
+    // fresh, in which case this is minus the time left.
+    base::TimeDelta expired_by;
+  };
+
+  // Notified when the contents of the cache change in a way that is worth
+  // persisting. See GetAsListValue() and RestoreFromListValue().
+  class NET_EXPORT PersistenceDelegate {
+   public:
+    virtual void ScheduleWrite() = 0;
+
+   protected:
+    virtual ~PersistenceDelegate() {}
   };
 
   struct Key {
@@ -73,15 +103,27 @@ class NET_EXPORT HostCache : NON_EXPORTED_BASE(public base::NonThreadSafe) {
                         std::less<base::TimeTicks>,
                         EvictionHandler> EntryMap;
 
-  // Constructs a HostCache that stores up to |max_entries|.
+  // Constructs a HostCache that stores up to |max_entries|. Expired entries
+  // are dropped immediately.
   explicit HostCache(size_t max_entries);
 
+  // Constructs a HostCache that stores up to |max_entries|, and keeps
+  // successful entries for up to |max_staleness| after they expire, so that
+  // they can be served by LookupStale() while they are being refreshed.
+  HostCache(size_t max_entries, base::TimeDelta max_staleness);
+
   ~HostCache();
 
   // Returns a pointer to the entry for |key|, which is valid at time
   // |now|. If there is no such entry, returns NULL.
   const Entry* Lookup(const Key& key, base::TimeTicks now);
 
+  // Like Lookup(), but also returns a successful entry that has expired less
+  // than max_staleness() ago. Sets |staleness| to describe the entry.
+  const Entry* LookupStale(const Key& key,
+                           base::TimeTicks now,
+                           EntryStaleness* staleness);
+
   // Overwrites or creates an entry for |key|.
   // |entry| is the value to set, |now| is the current time
   // |ttl| is the "time to live".
@@ -93,20 +135,45 @@ class NET_EXPORT HostCache : NON_EXPORTED_BASE(public base::NonThreadSafe) {
   // Empties the cache
   void clear();
 
+  // Sets the delegate to notify of changes. May be NULL.
+  void set_persistence_delegate(PersistenceDelegate* delegate) {
+    delegate_ = delegate;
+  }
+
+  // Returns the successful entries of the cache, as a list of dictionaries
+  // that can be handed to RestoreFromListValue() after a restart. The caller
+  // takes ownership of the returned list.
+  base::ListValue* GetAsListValue() const;
+
+  // Adds the entries in |old_cache|, as returned by GetAsListValue(), that are
+  // not yet in the cache and could still be served by LookupStale(). Restored
+  // entries are treated as expired, so they are refreshed when first used;
+  // consequently nothing is restored if max_staleness() is zero. Returns
+  // false if |old_cache| is malformed; entries preceding the malformed one
+  // are still added.
+  bool RestoreFromListValue(const base::ListValue& old_cache);
+
   // Returns the number of entries in the cache.
   size_t size() const;
 
   // Following are used by net_internals UI.
   size_t max_entries() const;
 
+  base::TimeDelta max_staleness() const { return max_staleness_; }
+
   const EntryMap& entries() const;
 
-  // Creates a default cache.
+  // Creates a default cache. It keeps no expired entries, unless the
+  // HostCacheMaxStaleness field trial sets max_staleness().
   static scoped_ptr<HostCache> CreateDefaultCache();
 
  private:
   FRIEND_TEST_ALL_PREFIXES(HostCacheTest, NoCache);
 
+  // Returns the entry for |key|, including an expired entry that is still in
+  // the cache.
+  Entry* LookupInternal(const Key& key, base::TimeTicks now);
+
   // Returns true if this HostCache can contain no entries.
   bool caching_is_disabled() const {
     return entries_.max_entries() == 0;
@@ -116,6 +183,11 @@ class NET_EXPORT HostCache : NON_EXPORTED_BASE(public base::NonThreadSafe) {
   // a resolved result entry.
   EntryMap entries_;
 
+  // How long successful entries are kept after they expire.
+  const base::TimeDelta max_staleness_;
+
+  PersistenceDelegate* delegate_;
+
   DISALLOW_COPY_AND_ASSIGN(HostCache);
 };
 
@@ -0,0 +1,85 @@
+// Copyright 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "net/dns/host_cache_persistence_manager.h"
+
+#include "base/bind.h"
+#include "base/file_util.h"
+#include "base/json/json_reader.h"
+#include "base/json/json_writer.h"
+#include "base/location.h"
+#include "base/logging.h"
+#include "base/memory/scoped_ptr.h"
+#include "base/sequenced_task_runner.h"
+#include "base/values.h"
+
+namespace net {
+
+namespace {
+
+// The cache changes with nearly every resolution, so batch the writes.
+const int kCommitIntervalSeconds = 60;
+
+void ReadFile(const base::FilePath& path, std::string* data) {
+  if (!file_util::ReadFileToString(path, data))
+    data->clear();
+}
+
+}  // namespace
+
+HostCachePersistenceManager::HostCachePersistenceManager(
+    HostCache* cache,
+    const base::FilePath& path,
+    base::SequencedTaskRunner* file_task_runner)
+    : cache_(cache),
+      writer_(path, file_task_runner),
+      weak_factory_(this) {
+  DCHECK(cache_);
+  writer_.set_commit_interval(
+      base::TimeDelta::FromSeconds(kCommitIntervalSeconds));
+  cache_->set_persistence_delegate(this);
+
+  std::string* data = new std::string();
+  file_task_runner->PostTaskAndReply(
+      FROM_HERE,
+      base::Bind(&ReadFile, path, data),
+      base::Bind(&HostCachePersistenceManager::OnFileRead,
+                 weak_factory_.GetWeakPtr(), base::Owned(data)));
+}
+
+HostCachePersistenceManager::~HostCachePersistenceManager() {
+  DCHECK(CalledOnValidThread());
+  cache_->set_persistence_delegate(NULL);
+  if (writer_.HasPendingWrite())
+    writer_.DoScheduledWrite();
+}
+
+void HostCachePersistenceManager::ScheduleWrite() {
+  DCHECK(CalledOnValidThread());
+  writer_.ScheduleWrite(this);
+}
+
+bool HostCachePersistenceManager::SerializeData(std::string* data) {
+  DCHECK(CalledOnValidThread());
+  scoped_ptr<base::ListValue> entries(cache_->GetAsListValue());
+  base::JSONWriter::Write(entries.get(), data);
+  return true;
+}
+
+void HostCachePersistenceManager::OnFileRead(const std::string* data) {
+  DCHECK(CalledOnValidThread());
+  if (data->empty())
+    return;
+
+  scoped_ptr<base::Value> value(base::JSONReader::Read(*data));
+  base::ListValue* entries = NULL;
+  if (!value.get() || !value->GetAsList(&entries)) {
+    LOG(WARNING) << "Malformed host cache in " << writer_.path().value();
+    return;
+  }
+  if (!cache_->RestoreFromListValue(*entries))
+    LOG(WARNING) << "Malformed host cache entry in " << writer_.path().value();
+}
+
+}  // namespace net
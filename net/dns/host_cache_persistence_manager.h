@@ -0,0 +1,69 @@
+// Copyright 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef NET_DNS_HOST_CACHE_PERSISTENCE_MANAGER_H_
+#define NET_DNS_HOST_CACHE_PERSISTENCE_MANAGER_H_
+
+#include <string>
+
+#include "base/basictypes.h"
+#include "base/compiler_specific.h"
+#include "base/files/file_path.h"
+#include "base/files/important_file_writer.h"
+#include "base/memory/weak_ptr.h"
+#include "base/threading/non_thread_safe.h"
+#include "net/base/net_export.h"
+#include "net/dns/host_cache.h"
+
+namespace base {
+class SequencedTaskRunner;
+}
+
+namespace net {
+
+// Keeps a copy of a HostCache in a file, so that it survives restarts.
+//
+// On construction, the file is read on |file_task_runner| and its entries are
+// restored into the cache. From then on, changes to the cache are written
+// back at most once per commit interval, and a pending write is flushed when
+// the manager is destroyed. Since restored entries are only served while they
+// are refreshed, this is of use only for a cache with a non-zero
+// max_staleness().
+//
+// Note that the file reveals which hosts were resolved, so a cache shared with
+// off-the-record browsing should not be persisted.
+class NET_EXPORT HostCachePersistenceManager
+    : public HostCache::PersistenceDelegate,
+      public base::ImportantFileWriter::DataSerializer,
+      NON_EXPORTED_BASE(public base::NonThreadSafe) {
+ public:
+  // |cache| must outlive the manager.
+  HostCachePersistenceManager(HostCache* cache,
+                              const base::FilePath& path,
+                              base::SequencedTaskRunner* file_task_runner);
+  virtual ~HostCachePersistenceManager();
+
+  // HostCache::PersistenceDelegate implementation:
+  virtual void ScheduleWrite() OVERRIDE;
+
+  // base::ImportantFileWriter::DataSerializer implementation:
+  virtual bool SerializeData(std::string* data) OVERRIDE;
+
+ private:
+  // Called with the contents of the file, which are empty if it could not be
+  // read.
+  void OnFileRead(const std::string* data);
+
+  HostCache* const cache_;
+
+  base::ImportantFileWriter writer_;
+
+  base::WeakPtrFactory<HostCachePersistenceManager> weak_factory_;
+
+  DISALLOW_COPY_AND_ASSIGN(HostCachePersistenceManager);
+};
+
+}  // namespace net
+
+#endif  // NET_DNS_HOST_CACHE_PERSISTENCE_MANAGER_H_
@@ -0,0 +1,92 @@
+// Copyright 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "net/dns/host_cache_persistence_manager.h"
+
+#include "base/file_util.h"
+#include "base/files/scoped_temp_dir.h"
+#include "base/message_loop/message_loop.h"
+#include "base/message_loop/message_loop_proxy.h"
+#include "base/time/time.h"
+#include "net/base/address_list.h"
+#include "net/base/net_errors.h"
+#include "net/base/net_util.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace net {
+
+namespace {
+
+const int kMaxCacheEntries = 10;
+
+HostCache::Key Key(const std::string& hostname) {
+  return HostCache::Key(hostname, ADDRESS_FAMILY_UNSPECIFIED, 0);
+}
+
+class HostCachePersistenceManagerTest : public testing::Test {
+ protected:
+  virtual void SetUp() OVERRIDE {
+    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
+    path_ = temp_dir_.path().AppendASCII("HostCache");
+  }
+
+  scoped_ptr<HostCachePersistenceManager> CreateManager(HostCache* cache) {
+    return scoped_ptr<HostCachePersistenceManager>(
+        new HostCachePersistenceManager(
+            cache, path_, base::MessageLoopProxy::current().get()));
+  }
+
+  base::MessageLoop message_loop_;
+  base::ScopedTempDir temp_dir_;
+  base::FilePath path_;
+};
+
+TEST_F(HostCachePersistenceManagerTest, WritesOnDestruction) {
+  const base::TimeDelta kMaxStaleness = base::TimeDelta::FromHours(1);
+  HostCache cache(kMaxCacheEntries, kMaxStaleness);
+  scoped_ptr<HostCachePersistenceManager> manager(CreateManager(&cache));
+  base::MessageLoop::current()->RunUntilIdle();
+  EXPECT_FALSE(base::PathExists(path_));
+
+  IPAddressNumber address;
+  ASSERT_TRUE(ParseIPLiteralToNumber("1.2.3.4", &address));
+  cache.Set(Key("foobar.com"),
+            HostCache::Entry(OK, AddressList::CreateFromIPAddress(address, 0)),
+            base::TimeTicks::Now(), base::TimeDelta::FromSeconds(60));
+
+  // The write is batched until the manager goes away.
+  base::MessageLoop::current()->RunUntilIdle();
+  EXPECT_FALSE(base::PathExists(path_));
+  manager.reset();
+  base::MessageLoop::current()->RunUntilIdle();
+  EXPECT_TRUE(base::PathExists(path_));
+
+  // Entries are restored into a new cache.
+  HostCache restored_cache(kMaxCacheEntries, kMaxStaleness);
+  manager = CreateManager(&restored_cache);
+  base::MessageLoop::current()->RunUntilIdle();
+  ASSERT_EQ(1U, restored_cache.size());
+
+  HostCache::EntryStaleness staleness;
+  const HostCache::Entry* entry = restored_cache.LookupStale(
+      Key("foobar.com"), base::TimeTicks::Now(), &staleness);
+  ASSERT_TRUE(entry);
+  ASSERT_EQ(1U, entry->addrlist.size());
+  EXPECT_EQ("1.2.3.4", entry->addrlist[0].ToStringWithoutPort());
+}
+
+TEST_F(HostCachePersistenceManagerTest, IgnoresMalformedFile) {
+  const char kData[] = "{\"not\": \"a list\"}";
+  ASSERT_EQ(static_cast<int>(sizeof(kData) - 1),
+            file_util::WriteFile(path_, kData, sizeof(kData) - 1));
+
+  HostCache cache(kMaxCacheEntries, base::TimeDelta::FromHours(1));
+  scoped_ptr<HostCachePersistenceManager> manager(CreateManager(&cache));
+  base::MessageLoop::current()->RunUntilIdle();
+  EXPECT_EQ(0U, cache.size());
+}
+
+}  // namespace
+
+}  // namespace net
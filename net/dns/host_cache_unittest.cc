@@ -8,7 +8,9 @@
 #include "base/stl_util.h"
 #include "base/strings/string_util.h"
 #include "base/strings/stringprintf.h"
+#include "base/values.h"
 #include "net/base/net_errors.h"
+#include "net/base/net_util.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
 namespace net {
@@ -22,6 +24,26 @@ HostCache::Key Key(const std::string& hostname) {
   return HostCache::Key(hostname, ADDRESS_FAMILY_UNSPECIFIED, 0);
 }
 
+// Builds an address list holding the single IP literal |address|.
+AddressList MakeAddressList(const std::string& address) {
+  IPAddressNumber number;
+  EXPECT_TRUE(ParseIPLiteralToNumber(address, &number));
+  return AddressList::CreateFromIPAddress(number, 0);
+}
+
+class CountingPersistenceDelegate : public HostCache::PersistenceDelegate {
+ public:
+  CountingPersistenceDelegate() : num_writes_(0) {}
+  virtual ~CountingPersistenceDelegate() {}
+
+  virtual void ScheduleWrite() OVERRIDE { ++num_writes_; }
+
+  int num_writes() const { return num_writes_; }
+
+ private:
+  int num_writes_;
+};
+
 }  // namespace
 
 TEST(HostCacheTest, Basic) {
@@ -297,6 +319,166 @@ TEST(HostCacheTest, Clear) {
 }
 
 // Tests the less than and equal operators for HostCache::Key work.
+TEST(HostCacheTest, StaleEntries) {
+  const base::TimeDelta kTTL = base::TimeDelta::FromSeconds(10);
+  const base::TimeDelta kMaxStaleness = base::TimeDelta::FromSeconds(30);
+
+  HostCache cache(kMaxCacheEntries, kMaxStaleness);
+
+  // Start at t=0.
+  base::TimeTicks now;
+  HostCache::EntryStaleness staleness;
+
+  HostCache::Key key1 = Key("foobar.com");
+  HostCache::Key key2 = Key("foobar2.com");
+  cache.Set(key1, HostCache::Entry(OK, MakeAddressList("1.2.3.4")), now, kTTL);
+  cache.Set(key2, HostCache::Entry(ERR_NAME_NOT_RESOLVED, AddressList()), now,
+            kTTL);
+
+  ASSERT_TRUE(cache.LookupStale(key1, now, &staleness));
+  EXPECT_FALSE(staleness.is_stale());
+  EXPECT_EQ(-kTTL, staleness.expired_by);
+
+  // Advance to t=10; both entries expired.
+  now += kTTL;
+  EXPECT_FALSE(cache.Lookup(key1, now));
+  const HostCache::Entry* entry = cache.LookupStale(key1, now, &staleness);
+  ASSERT_TRUE(entry);
+  EXPECT_EQ(OK, entry->error);
+  EXPECT_TRUE(staleness.is_stale());
+  EXPECT_EQ(base::TimeDelta(), staleness.expired_by);
+
+  // Negative entries are not served stale.
+  EXPECT_FALSE(cache.LookupStale(key2, now, &staleness));
+  EXPECT_EQ(1U, cache.size());
+
+  // Advance to t=39; the entry is still available.
+  now += kMaxStaleness - base::TimeDelta::FromSeconds(1);
+  ASSERT_TRUE(cache.LookupStale(key1, now, &staleness));
+  EXPECT_EQ(base::TimeDelta::FromSeconds(29), staleness.expired_by);
+
+  // Advance to t=40; the entry is gone.
+  now += base::TimeDelta::FromSeconds(1);
+  EXPECT_FALSE(cache.LookupStale(key1, now, &staleness));
+  EXPECT_EQ(0U, cache.size());
+}
+
+TEST(HostCacheTest, CountsHits) {
+  const base::TimeDelta kTTL = base::TimeDelta::FromSeconds(10);
+
+  HostCache cache(kMaxCacheEntries, kTTL);
+
+  // Start at t=0.
+  base::TimeTicks now;
+  HostCache::EntryStaleness staleness;
+
+  HostCache::Key key1 = Key("foobar.com");
+  cache.Set(key1, HostCache::Entry(OK, AddressList()), now, kTTL);
+  EXPECT_EQ(1, cache.Lookup(key1, now)->hits);
+  EXPECT_EQ(2, cache.LookupStale(key1, now, &staleness)->hits);
+
+  // Expired entries are only counted when they are returned.
+  now += kTTL;
+  EXPECT_FALSE(cache.Lookup(key1, now));
+  EXPECT_EQ(3, cache.LookupStale(key1, now, &staleness)->hits);
+
+  // Setting the entry resets the count.
+  cache.Set(key1, HostCache::Entry(OK, AddressList()), now, kTTL);
+  EXPECT_EQ(1, cache.Lookup(key1, now)->hits);
+}
+
+TEST(HostCacheTest, NotifiesPersistenceDelegate) {
+  const base::TimeDelta kTTL = base::TimeDelta::FromSeconds(10);
+
+  HostCache cache(kMaxCacheEntries);
+  CountingPersistenceDelegate delegate;
+  cache.set_persistence_delegate(&delegate);
+
+  // Start at t=0.
+  base::TimeTicks now;
+
+  cache.Set(Key("foobar.com"), HostCache::Entry(OK, AddressList()), now, kTTL);
+  EXPECT_EQ(1, delegate.num_writes());
+
+  // Negative entries are not persisted.
+  cache.Set(Key("foobar2.com"),
+            HostCache::Entry(ERR_NAME_NOT_RESOLVED, AddressList()), now, kTTL);
+  EXPECT_EQ(1, delegate.num_writes());
+
+  cache.clear();
+  EXPECT_EQ(2, delegate.num_writes());
+  cache.clear();
+  EXPECT_EQ(2, delegate.num_writes());
+}
+
+TEST(HostCacheTest, PersistAndRestore) {
+  const base::TimeDelta kTTL = base::TimeDelta::FromSeconds(60);
+  const base::TimeDelta kMaxStaleness = base::TimeDelta::FromHours(1);
+
+  HostCache cache(kMaxCacheEntries, kMaxStaleness);
+  base::TimeTicks now = base::TimeTicks::Now();
+
+  HostCache::Key key1 = Key("foobar.com");
+  HostCache::Key key2("foobar2.com", ADDRESS_FAMILY_IPV6,
+                      HOST_RESOLVER_CANONNAME);
+  HostCache::Key key3 = Key("foobar3.com");
+  HostCache::Key key4 = Key("foobar4.com");
+  AddressList addresses1 = MakeAddressList("1.2.3.4");
+  addresses1.push_back(IPEndPoint(MakeAddressList("::1").front().address(),
+                                  0));
+  AddressList addresses2 = MakeAddressList("::2");
+  addresses2.set_canonical_name("canonical.foobar2.com");
+  cache.Set(key1, HostCache::Entry(OK, addresses1), now, kTTL);
+  cache.Set(key2, HostCache::Entry(OK, addresses2), now, kTTL);
+  cache.Set(key3, HostCache::Entry(ERR_NAME_NOT_RESOLVED, AddressList()), now,
+            kTTL);
+  // Expired too long ago to be served.
+  cache.Set(key4, HostCache::Entry(OK, MakeAddressList("4.3.2.1")),
+            now - kMaxStaleness - 2 * kTTL, kTTL);
+
+  scoped_ptr<base::ListValue> old_cache(cache.GetAsListValue());
+  EXPECT_EQ(3U, old_cache->GetSize());
+
+  HostCache restored_cache(kMaxCacheEntries, kMaxStaleness);
+  // An entry already in the cache is not overwritten.
+  AddressList addresses1_new = MakeAddressList("5.6.7.8");
+  restored_cache.Set(key1, HostCache::Entry(OK, addresses1_new),
+                     base::TimeTicks::Now(), kTTL);
+  EXPECT_TRUE(restored_cache.RestoreFromListValue(*old_cache));
+  EXPECT_EQ(2U, restored_cache.size());
+
+  now = base::TimeTicks::Now();
+  HostCache::EntryStaleness staleness;
+  const HostCache::Entry* entry =
+      restored_cache.LookupStale(key1, now, &staleness);
+  ASSERT_TRUE(entry);
+  EXPECT_FALSE(staleness.is_stale());
+  EXPECT_TRUE(entry->addrlist.size() == 1 &&
+              entry->addrlist[0] == addresses1_new[0]);
+
+  // Restored entries are stale, so they are refreshed when used.
+  EXPECT_FALSE(restored_cache.Lookup(key2, now));
+  entry = restored_cache.LookupStale(key2, now, &staleness);
+  ASSERT_TRUE(entry);
+  EXPECT_TRUE(staleness.is_stale());
+  EXPECT_EQ(OK, entry->error);
+  ASSERT_EQ(1U, entry->addrlist.size());
+  EXPECT_TRUE(entry->addrlist[0] == addresses2[0]);
+  EXPECT_EQ("canonical.foobar2.com", entry->addrlist.canonical_name());
+
+  EXPECT_FALSE(restored_cache.LookupStale(key3, now, &staleness));
+  EXPECT_FALSE(restored_cache.LookupStale(key4, now, &staleness));
+}
+
+TEST(HostCacheTest, RestoreMalformed) {
+  HostCache cache(kMaxCacheEntries, base::TimeDelta::FromHours(1));
+
+  base::ListValue old_cache;
+  old_cache.Append(new base::StringValue("foobar.com"));
+  EXPECT_FALSE(cache.RestoreFromListValue(old_cache));
+  EXPECT_EQ(0U, cache.size());
+}
+
 TEST(HostCacheTest, KeyComparators) {
   struct {
     // Inputs.
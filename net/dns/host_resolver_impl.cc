@@ -73,6 +73,26 @@ const unsigned kMinimumTTLSeconds = kCacheEntryTTLSeconds;
 // the DnsClient is disabled until the next DNS change.
 const unsigned kMaximumDnsFailures = 16;
 
+// A cache entry that was looked up at least |kCacheRefreshMinHits| times is
+// refreshed in the background when it is looked up during the last
+// |kCacheRefreshWindowSeconds| before it expires, so it never goes stale.
+const int kCacheRefreshMinHits = 3;
+const unsigned kCacheRefreshWindowSeconds = 10;
+
+// Outcome of a HostCache lookup. These values are written to logs. New enum
+// values can be added, but existing enums must never be renumbered or deleted
+// and reused.
+enum CacheLookupResult {
+  CACHE_LOOKUP_MISS = 0,
+  CACHE_LOOKUP_HIT = 1,
+  // The entry was fresh, but popular and about to expire, so it was
+  // refreshed.
+  CACHE_LOOKUP_HIT_AND_REFRESH = 2,
+  // The entry had expired. It was served anyway and refreshed.
+  CACHE_LOOKUP_STALE_HIT = 3,
+  CACHE_LOOKUP_MAX
+};
+
 // We use a separate histogram name for each platform to facilitate the
 // display of error codes by their symbolic name (since each platform has
 // different mappings).
@@ -1145,13 +1165,17 @@ class HostResolverImpl::DnsTask : public base::SupportsWeakPtr<DnsTask> {
 class HostResolverImpl::Job : public PrioritizedDispatcher::Job {
  public:
   // Creates new job for |key| where |request_net_log| is bound to the
-  // request that spawned it.
+  // request that spawned it. A refresh Job updates the cache entry for |key|
+  // in the background, and runs to completion even if no Request is attached
+  // to it.
   Job(const base::WeakPtr<HostResolverImpl>& resolver,
       const Key& key,
       RequestPriority priority,
+      bool is_refresh,
       const BoundNetLog& request_net_log)
       : resolver_(resolver),
         key_(key),
+        is_refresh_(is_refresh),
         priority_tracker_(priority),
         had_non_speculative_request_(false),
         had_dns_config_(false),
@@ -1252,7 +1276,7 @@ class HostResolverImpl::Job : public PrioritizedDispatcher::Job {
                    req->request_net_log().source(),
                    priority()));
 
-    if (num_active_requests() > 0) {
+    if (num_active_requests() > 0 || is_refresh_) {
       UpdatePriority();
     } else {
       // If we were called from a Request's callback within CompleteRequests,
@@ -1294,7 +1318,11 @@ class HostResolverImpl::Job : public PrioritizedDispatcher::Job {
   // Attempts to serve the job from HOSTS. Returns true if succeeded and
   // this Job was destroyed.
   bool ServeFromHosts() {
-    DCHECK_GT(num_active_requests(), 0u);
+    // There is nobody to serve if no Request joined a refresh.
+    if (num_active_requests() == 0) {
+      DCHECK(is_refresh_);
+      return false;
+    }
     AddressList addr_list;
     if (resolver_->ServeFromHosts(key(),
                                   requests_.front()->info(),
@@ -1547,6 +1575,15 @@ class HostResolverImpl::Job : public PrioritizedDispatcher::Job {
     }
 
     if (num_active_requests() == 0) {
+      if (is_refresh_) {
+        // A refresh updates the cache even though nobody is waiting for it,
+        // but a failure keeps serving the stale entry rather than the error.
+        net_log_.EndEventWithNetErrorCode(NetLog::TYPE_HOST_RESOLVER_IMPL_JOB,
+                                          entry.error);
+        if (entry.error == OK)
+          resolver_->CacheResult(key_, entry, ttl);
+        return;
+      }
       net_log_.AddEvent(NetLog::TYPE_CANCELLED);
       net_log_.EndEventWithNetErrorCode(NetLog::TYPE_HOST_RESOLVER_IMPL_JOB,
                                         OK);
@@ -1623,6 +1660,8 @@ class HostResolverImpl::Job : public PrioritizedDispatcher::Job {
 
   Key key_;
 
+  const bool is_refresh_;
+
   // Tracks the highest priority across |requests_|.
   PriorityTracker priority_tracker_;
 
@@ -1755,8 +1794,11 @@ int HostResolverImpl::Resolve(const RequestInfo& info,
   // outstanding jobs map.
   Key key = GetEffectiveKeyForRequest(info, request_net_log);
 
-  int rv = ResolveHelper(key, info, addresses, request_net_log);
+  bool refresh = false;
+  int rv = ResolveHelper(key, info, addresses, request_net_log, &refresh);
   if (rv != ERR_DNS_CACHE_MISS) {
+    if (refresh)
+      RefreshCacheEntry(key, request_net_log);
     LogFinishRequest(source_net_log, request_net_log, info, rv);
     RecordTotalTime(HaveDnsConfig(), info.is_speculative(), base::TimeDelta());
     return rv;
@@ -1769,7 +1811,7 @@ int HostResolverImpl::Resolve(const RequestInfo& info,
   Job* job;
   if (jobit == jobs_.end()) {
     job = new Job(weak_ptr_factory_.GetWeakPtr(), key, info.priority(),
-                  request_net_log);
+                  false, request_net_log);
     job->Schedule();
 
     // Check for queue overflow.
@@ -1805,7 +1847,8 @@ int HostResolverImpl::Resolve(const RequestInfo& info,
 int HostResolverImpl::ResolveHelper(const Key& key,
                                     const RequestInfo& info,
                                     AddressList* addresses,
-                                    const BoundNetLog& request_net_log) {
+                                    const BoundNetLog& request_net_log,
+                                    bool* refresh) {
   // The result of |getaddrinfo| for empty hosts is inconsistent across systems.
   // On Windows it gives the default interface's address, whereas on Linux it
   // gives an error. We will make it fail on all platforms for consistency.
@@ -1815,8 +1858,16 @@ int HostResolverImpl::ResolveHelper(const Key& key,
   int net_error = ERR_UNEXPECTED;
   if (ResolveAsIP(key, info, &net_error, addresses))
     return net_error;
-  if (ServeFromCache(key, info, &net_error, addresses)) {
-    request_net_log.AddEvent(NetLog::TYPE_HOST_RESOLVER_IMPL_CACHE_HIT);
+  HostCache::EntryStaleness staleness;
+  if (ServeFromCache(key, info, &net_error, addresses, &staleness, refresh)) {
+    if (staleness.is_stale()) {
+      request_net_log.AddEvent(
+          NetLog::TYPE_HOST_RESOLVER_IMPL_STALE_CACHE_HIT,
+          NetLog::Int64Callback("expired_by_ms",
+                                staleness.expired_by.InMilliseconds()));
+    } else {
+      request_net_log.AddEvent(NetLog::TYPE_HOST_RESOLVER_IMPL_CACHE_HIT);
+    }
     return net_error;
   }
   // TODO(szym): Do not do this if nsswitch.conf instructs not to.
@@ -1843,7 +1894,8 @@ int HostResolverImpl::ResolveFromCache(const RequestInfo& info,
 
   Key key = GetEffectiveKeyForRequest(info, request_net_log);
 
-  int rv = ResolveHelper(key, info, addresses, request_net_log);
+  // Only fresh entries are served, so that nothing needs to be refreshed.
+  int rv = ResolveHelper(key, info, addresses, request_net_log, NULL);
   LogFinishRequest(source_net_log, request_net_log, info, rv);
   return rv;
 }
@@ -1926,16 +1978,29 @@ bool HostResolverImpl::ResolveAsIP(const Key& key,
 bool HostResolverImpl::ServeFromCache(const Key& key,
                                       const RequestInfo& info,
                                       int* net_error,
-                                      AddressList* addresses) {
+                                      AddressList* addresses,
+                                      HostCache::EntryStaleness* staleness,
+                                      bool* refresh) {
   DCHECK(addresses);
   DCHECK(net_error);
+  DCHECK(staleness);
   if (!info.allow_cached_response() || !cache_.get())
     return false;
 
-  const HostCache::Entry* cache_entry = cache_->Lookup(
-      key, base::TimeTicks::Now());
-  if (!cache_entry)
+  const base::TimeTicks now = base::TimeTicks::Now();
+  const HostCache::Entry* cache_entry = NULL;
+  if (refresh) {
+    cache_entry = cache_->LookupStale(key, now, staleness);
+  } else {
+    cache_entry = cache_->Lookup(key, now);
+    if (cache_entry)
+      staleness->expired_by = now - cache_entry->expires;
+  }
+  if (!cache_entry) {
+    UMA_HISTOGRAM_ENUMERATION("DNS.CacheLookup", CACHE_LOOKUP_MISS,
+                              CACHE_LOOKUP_MAX);
     return false;
+  }
 
   *net_error = cache_entry->error;
   if (*net_error == OK) {
@@ -1943,6 +2008,25 @@ bool HostResolverImpl::ServeFromCache(const Key& key,
       RecordTTL(cache_entry->ttl);
     *addresses = EnsurePortOnAddressList(cache_entry->addrlist, info.port());
   }
+
+  CacheLookupResult result = CACHE_LOOKUP_HIT;
+  if (staleness->is_stale()) {
+    // Only successful entries are kept past their expiration.
+    DCHECK_EQ(OK, *net_error);
+    UMA_HISTOGRAM_CUSTOM_TIMES("DNS.CacheStaleHitExpiredBy",
+                               staleness->expired_by,
+                               base::TimeDelta::FromSeconds(1),
+                               base::TimeDelta::FromDays(1), 100);
+    result = CACHE_LOOKUP_STALE_HIT;
+    *refresh = true;
+  } else if (refresh && *net_error == OK &&
+             cache_entry->hits >= kCacheRefreshMinHits &&
+             -staleness->expired_by <=
+                 base::TimeDelta::FromSeconds(kCacheRefreshWindowSeconds)) {
+    result = CACHE_LOOKUP_HIT_AND_REFRESH;
+    *refresh = true;
+  }
+  UMA_HISTOGRAM_ENUMERATION("DNS.CacheLookup", result, CACHE_LOOKUP_MAX);
   return true;
 }
 
@@ -1994,6 +2078,29 @@ bool HostResolverImpl::ServeFromHosts(const Key& key,
   return !addresses->empty();
 }
 
+void HostResolverImpl::RefreshCacheEntry(const Key& key,
+                                         const BoundNetLog& request_net_log) {
+  // The entry is refreshed anyway if |key| is already being resolved.
+  JobMap::iterator jobit = jobs_.find(key);
+  if (jobit != jobs_.end())
+    return;
+
+  request_net_log.AddEvent(NetLog::TYPE_HOST_RESOLVER_IMPL_CACHE_REFRESH);
+  Job* job = new Job(weak_ptr_factory_.GetWeakPtr(), key, IDLE, true,
+                     request_net_log);
+  job->Schedule();
+
+  // Check for queue overflow.
+  if (dispatcher_.num_queued_jobs() > max_queued_jobs_) {
+    Job* evicted = static_cast<Job*>(dispatcher_.EvictOldestLowest());
+    DCHECK(evicted);
+    evicted->OnEvicted();  // Deletes |evicted|.
+    if (evicted == job)
+      return;
+  }
+  jobs_.insert(jobit, std::make_pair(key, job));
+}
+
 void HostResolverImpl::CacheResult(const Key& key,
                                    const HostCache::Entry& entry,
                                    base::TimeDelta ttl) {
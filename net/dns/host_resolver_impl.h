@@ -160,10 +160,13 @@ class NET_EXPORT HostResolverImpl
   // literal, cache and HOSTS lookup (if enabled), returns OK if successful,
   // ERR_NAME_NOT_RESOLVED if either hostname is invalid or IP literal is
   // incompatible, ERR_DNS_CACHE_MISS if entry was not found in cache and HOSTS.
+  // Expired cache entries are only served if |refresh| is not NULL, in which
+  // case |*refresh| is set if the cache entry should be refreshed.
   int ResolveHelper(const Key& key,
                     const RequestInfo& info,
                     AddressList* addresses,
-                    const BoundNetLog& request_net_log);
+                    const BoundNetLog& request_net_log,
+                    bool* refresh);
 
   // Tries to resolve |key| as an IP, returns true and sets |net_error| if
   // succeeds, returns false otherwise.
@@ -174,11 +177,16 @@ class NET_EXPORT HostResolverImpl
 
   // If |key| is not found in cache returns false, otherwise returns
   // true, sets |net_error| to the cached error code and fills |addresses|
-  // if it is a positive entry.
+  // if it is a positive entry. If |refresh| is not NULL, positive entries are
+  // served for a while after they expire, as described by |staleness|, and
+  // |*refresh| is set if the entry should be refreshed in the background,
+  // because it is stale, or popular and about to expire.
   bool ServeFromCache(const Key& key,
                       const RequestInfo& info,
                       int* net_error,
-                      AddressList* addresses);
+                      AddressList* addresses,
+                      HostCache::EntryStaleness* staleness,
+                      bool* refresh);
 
   // If we have a DnsClient with a valid DnsConfig, and |key| is found in the
   // HOSTS file, returns true and fills |addresses|. Otherwise returns false.
@@ -195,6 +203,11 @@ class NET_EXPORT HostResolverImpl
   Key GetEffectiveKeyForRequest(const RequestInfo& info,
                                 const BoundNetLog& net_log) const;
 
+  // Starts a Job to refresh the cache entry for |key|, unless |key| is
+  // already being resolved. |request_net_log| is bound to the request that
+  // hit the entry.
+  void RefreshCacheEntry(const Key& key, const BoundNetLog& request_net_log);
+
   // Records the result in cache if cache is present.
   void CacheResult(const Key& key,
                    const HostCache::Entry& entry,
@@ -33,6 +33,7 @@ namespace {
 
 const size_t kMaxJobs = 10u;
 const size_t kMaxRetryAttempts = 4u;
+const size_t kMaxCacheEntries = 100u;
 
 PrioritizedDispatcher::Limits DefaultLimits() {
   PrioritizedDispatcher::Limits limits(NUM_PRIORITIES, kMaxJobs);
@@ -436,7 +437,11 @@ class HostResolverImplTest : public testing::Test {
   };
 
   void CreateResolver() {
-    resolver_.reset(new HostResolverImpl(HostCache::CreateDefaultCache(),
+    CreateResolverWithCache(HostCache::CreateDefaultCache());
+  }
+
+  void CreateResolverWithCache(scoped_ptr<HostCache> cache) {
+    resolver_.reset(new HostResolverImpl(cache.Pass(),
                                          DefaultLimits(),
                                          DefaultParams(proc_.get()),
                                          NULL));
@@ -1200,6 +1205,116 @@ TEST_F(HostResolverImplTest, ResolveFromCache) {
   EXPECT_TRUE(requests_[2]->HasOneAddress("192.168.1.42", 80));
 }
 
+// Test that an expired cache entry is served while it is refreshed.
+TEST_F(HostResolverImplTest, ServeStaleCacheEntry) {
+  CreateResolverWithCache(make_scoped_ptr(
+      new HostCache(kMaxCacheEntries, base::TimeDelta::FromHours(1))));
+  proc_->AddRuleForAllFamilies("just.testing", "192.168.1.42");
+  proc_->SignalMultiple(1u);
+
+  EXPECT_EQ(ERR_IO_PENDING, CreateRequest("just.testing", 80)->Resolve());
+  EXPECT_EQ(OK, requests_[0]->WaitForResult());
+
+  // Expire the entry, and change what it resolves to.
+  HostCache* cache = resolver_->GetHostCache();
+  ASSERT_EQ(1u, cache->size());
+  HostCache::EntryMap::Iterator it(cache->entries());
+  HostCache::Key key = it.key();
+  HostCache::Entry entry = it.value();
+  const base::TimeDelta kTTL = base::TimeDelta::FromSeconds(60);
+  cache->Set(key, entry, base::TimeTicks::Now() - 2 * kTTL, kTTL);
+  proc_->AddRuleForAllFamilies("just.testing", "192.168.1.43");
+
+  // ResolveFromCache() neither serves nor refreshes the stale entry.
+  EXPECT_EQ(ERR_DNS_CACHE_MISS,
+            CreateRequest("just.testing", 80)->ResolveFromCache());
+  EXPECT_EQ(0u, num_running_jobs());
+
+  // The stale entry is served right away, and a refresh is started.
+  EXPECT_EQ(OK, CreateRequest("just.testing", 80)->Resolve());
+  EXPECT_TRUE(requests_[2]->HasOneAddress("192.168.1.42", 80));
+  EXPECT_TRUE(proc_->WaitFor(1u));
+  EXPECT_EQ(1u, num_running_jobs());
+
+  // A request that bypasses the cache joins the refresh.
+  HostResolver::RequestInfo info(HostPortPair("just.testing", 80));
+  info.set_allow_cached_response(false);
+  EXPECT_EQ(ERR_IO_PENDING, CreateRequest(info)->Resolve());
+  proc_->SignalMultiple(1u);
+  EXPECT_EQ(OK, requests_[3]->WaitForResult());
+  EXPECT_TRUE(requests_[3]->HasOneAddress("192.168.1.43", 80));
+  EXPECT_EQ(2u, proc_->GetCaptureList().size());
+
+  // The refreshed entry is fresh.
+  EXPECT_EQ(OK, CreateRequest("just.testing", 80)->ResolveFromCache());
+  EXPECT_TRUE(requests_[4]->HasOneAddress("192.168.1.43", 80));
+}
+
+// Test that the default cache does not serve expired entries.
+TEST_F(HostResolverImplTest, DefaultCacheDoesNotServeStaleEntries) {
+  proc_->AddRuleForAllFamilies("just.testing", "192.168.1.42");
+  proc_->SignalMultiple(2u);
+
+  EXPECT_EQ(ERR_IO_PENDING, CreateRequest("just.testing", 80)->Resolve());
+  EXPECT_EQ(OK, requests_[0]->WaitForResult());
+
+  HostCache* cache = resolver_->GetHostCache();
+  ASSERT_EQ(1u, cache->size());
+  HostCache::EntryMap::Iterator it(cache->entries());
+  HostCache::Key key = it.key();
+  HostCache::Entry entry = it.value();
+  const base::TimeDelta kTTL = base::TimeDelta::FromSeconds(60);
+  cache->Set(key, entry, base::TimeTicks::Now() - 2 * kTTL, kTTL);
+
+  EXPECT_EQ(ERR_IO_PENDING, CreateRequest("just.testing", 80)->Resolve());
+  EXPECT_EQ(OK, requests_[1]->WaitForResult());
+  EXPECT_EQ(2u, proc_->GetCaptureList().size());
+}
+
+// Test that a popular cache entry is refreshed before it expires.
+TEST_F(HostResolverImplTest, RefreshPopularCacheEntry) {
+  proc_->AddRuleForAllFamilies("just.testing", "192.168.1.42");
+  proc_->SignalMultiple(1u);
+
+  EXPECT_EQ(ERR_IO_PENDING, CreateRequest("just.testing", 80)->Resolve());
+  EXPECT_EQ(OK, requests_[0]->WaitForResult());
+
+  // Leave the entry a few seconds to live.
+  HostCache* cache = resolver_->GetHostCache();
+  ASSERT_EQ(1u, cache->size());
+  HostCache::EntryMap::Iterator it(cache->entries());
+  HostCache::Key key = it.key();
+  HostCache::Entry entry = it.value();
+  const base::TimeDelta kTTL = base::TimeDelta::FromSeconds(60);
+  cache->Set(key, entry,
+             base::TimeTicks::Now() - kTTL + base::TimeDelta::FromSeconds(5),
+             kTTL);
+  proc_->AddRuleForAllFamilies("just.testing", "192.168.1.43");
+
+  // The first hits do not make the entry popular enough.
+  EXPECT_EQ(OK, CreateRequest("just.testing", 80)->Resolve());
+  EXPECT_EQ(OK, CreateRequest("just.testing", 80)->Resolve());
+  EXPECT_EQ(0u, num_running_jobs());
+
+  // ResolveFromCache() counts as a hit, but does not start a refresh.
+  EXPECT_EQ(OK, CreateRequest("just.testing", 80)->ResolveFromCache());
+  EXPECT_EQ(0u, num_running_jobs());
+
+  EXPECT_EQ(OK, CreateRequest("just.testing", 80)->Resolve());
+  EXPECT_TRUE(requests_[4]->HasOneAddress("192.168.1.42", 80));
+  EXPECT_TRUE(proc_->WaitFor(1u));
+  EXPECT_EQ(1u, num_running_jobs());
+
+  HostResolver::RequestInfo info(HostPortPair("just.testing", 80));
+  info.set_allow_cached_response(false);
+  EXPECT_EQ(ERR_IO_PENDING, CreateRequest(info)->Resolve());
+  proc_->SignalMultiple(1u);
+  EXPECT_EQ(OK, requests_[5]->WaitForResult());
+
+  EXPECT_EQ(OK, CreateRequest("just.testing", 80)->ResolveFromCache());
+  EXPECT_TRUE(requests_[6]->HasOneAddress("192.168.1.43", 80));
+}
+
 // Test the retry attempts simulating host resolver proc that takes too long.
 TEST_F(HostResolverImplTest, MultipleAttempts) {
   // Total number of attempts would be 3 and we want the 3rd attempt to resolve
@@ -1271,7 +1386,11 @@ class HostResolverImplDnsTest : public HostResolverImplTest {
   }
 
   void CreateResolver() {
-    resolver_.reset(new HostResolverImpl(HostCache::CreateDefaultCache(),
+    CreateResolverWithCache(HostCache::CreateDefaultCache());
+  }
+
+  void CreateResolverWithCache(scoped_ptr<HostCache> cache) {
+    resolver_.reset(new HostResolverImpl(cache.Pass(),
                                          DefaultLimits(),
                                          DefaultParams(proc_.get()),
                                          NULL));
@@ -1433,6 +1552,38 @@ TEST_F(HostResolverImplDnsTest, DnsTaskUnspec) {
   EXPECT_TRUE(requests_[3]->HasAddress("192.168.1.101", 80));
 }
 
+// Test that a stale entry survives a failed refresh.
+TEST_F(HostResolverImplDnsTest, StaleCacheEntryOutlivesFailedRefresh) {
+  CreateResolverWithCache(make_scoped_ptr(
+      new HostCache(kMaxCacheEntries, base::TimeDelta::FromHours(1))));
+  resolver_->SetDefaultAddressFamily(ADDRESS_FAMILY_IPV4);
+  set_fallback_to_proctask(false);
+  ChangeDnsConfig(CreateValidDnsConfig());
+
+  EXPECT_EQ(ERR_IO_PENDING, CreateRequest("ok", 80)->Resolve());
+  EXPECT_EQ(OK, requests_[0]->WaitForResult());
+
+  // Plant an expired entry for a name that fails to resolve.
+  HostCache* cache = resolver_->GetHostCache();
+  ASSERT_EQ(1u, cache->size());
+  HostCache::EntryMap::Iterator it(cache->entries());
+  HostCache::Key key = it.key();
+  HostCache::Entry entry = it.value();
+  key.hostname = "nx";
+  const base::TimeDelta kTTL = base::TimeDelta::FromSeconds(60);
+  cache->Set(key, entry, base::TimeTicks::Now() - 2 * kTTL, kTTL);
+
+  EXPECT_EQ(OK, CreateRequest("nx", 80)->Resolve());
+  EXPECT_TRUE(requests_[1]->HasOneAddress("127.0.0.1", 80));
+  // Let the refresh fail.
+  base::MessageLoop::current()->RunUntilIdle();
+  EXPECT_EQ(0u, num_running_jobs());
+
+  EXPECT_EQ(OK, CreateRequest("nx", 80)->Resolve());
+  EXPECT_TRUE(requests_[2]->HasOneAddress("127.0.0.1", 80));
+  base::MessageLoop::current()->RunUntilIdle();
+}
+
 TEST_F(HostResolverImplDnsTest, ServeFromHosts) {
   // Initially, use empty HOSTS file.
   DnsConfig config = CreateValidDnsConfig();
@@ -0,0 +1,319 @@
+// Copyright 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "net/dns/test_dns_server.h"
+
+#include <string.h>
+
+#include "base/bind.h"
+#include "base/location.h"
+#include "base/logging.h"
+#include "base/message_loop/message_loop.h"
+#include "base/rand_util.h"
+#include "base/sys_byteorder.h"
+#include "net/base/big_endian.h"
+#include "net/base/io_buffer.h"
+#include "net/base/net_errors.h"
+#include "net/base/net_log.h"
+#include "net/dns/dns_protocol.h"
+#include "net/socket/stream_socket.h"
+#include "net/socket/tcp_server_socket.h"
+#include "net/udp/udp_server_socket.h"
+
+namespace net {
+
+namespace {
+
+const int kMaxUDPSize = 512;
+const int kReadBufferSize = 4096;
+const uint32 kTTLSeconds = 60;
+// Tries to find a port which is free for both UDP and TCP.
+const int kMaxStartAttempts = 10;
+
+}  // namespace
+
+// Serves the queries read from an accepted socket until the client closes it.
+class TestDnsServer::TCPConnection {
+ public:
+  TCPConnection(TestDnsServer* server, scoped_ptr<StreamSocket> socket)
+      : server_(server),
+        socket_(socket.Pass()),
+        read_buffer_(new IOBufferWithSize(kReadBufferSize)),
+        weak_factory_(this) {}
+
+  void Start() {
+    DoRead();
+  }
+
+ private:
+  void DoRead() {
+    while (socket_.get()) {
+      int rv = socket_->Read(read_buffer_.get(), read_buffer_->size(),
+                             base::Bind(&TCPConnection::OnReadComplete,
+                                        base::Unretained(this)));
+      if (rv == ERR_IO_PENDING)
+        return;
+      DidRead(rv);
+    }
+  }
+
+  void OnReadComplete(int rv) {
+    DidRead(rv);
+    DoRead();
+  }
+
+  void DidRead(int rv) {
+    if (rv <= 0) {
+      socket_.reset();
+      return;
+    }
+    read_data_.append(read_buffer_->data(), rv);
+
+    // Answer each complete query.
+    while (read_data_.size() >= sizeof(uint16)) {
+      uint16 length;
+      ReadBigEndian<uint16>(read_data_.data(), &length);
+      if (read_data_.size() < sizeof(uint16) + length)
+        break;
+      ++server_->tcp_queries_;
+      std::string response =
+          server_->MakeResponse(read_data_.data() + sizeof(uint16), length,
+                                false);
+      read_data_.erase(0, sizeof(uint16) + length);
+      if (response.empty())
+        continue;
+      base::MessageLoop::current()->PostDelayedTask(
+          FROM_HERE,
+          base::Bind(&TCPConnection::SendResponse, weak_factory_.GetWeakPtr(),
+                     response),
+          server_->delay_);
+    }
+  }
+
+  void SendResponse(const std::string& response) {
+    char length[sizeof(uint16)];
+    WriteBigEndian<uint16>(length, response.size());
+    write_data_.append(length, sizeof(length));
+    write_data_.append(response);
+    if (!write_buffer_.get())
+      DoWrite();
+  }
+
+  void DoWrite() {
+    while (socket_.get()) {
+      if (!write_buffer_.get()) {
+        if (write_data_.empty())
+          return;
+        scoped_refptr<StringIOBuffer> data(new StringIOBuffer(write_data_));
+        write_buffer_ = new DrainableIOBuffer(data.get(), data->size());
+        write_data_.clear();
+      }
+      int rv = socket_->Write(write_buffer_.get(),
+                              write_buffer_->BytesRemaining(),
+                              base::Bind(&TCPConnection::OnWriteComplete,
+                                         base::Unretained(this)));
+      if (rv == ERR_IO_PENDING)
+        return;
+      DidWrite(rv);
+    }
+  }
+
+  void OnWriteComplete(int rv) {
+    DidWrite(rv);
+    DoWrite();
+  }
+
+  void DidWrite(int rv) {
+    if (rv < 0) {
+      socket_.reset();
+      return;
+    }
+    write_buffer_->DidConsume(rv);
+    if (write_buffer_->BytesRemaining() == 0)
+      write_buffer_ = NULL;
+  }
+
+  TestDnsServer* server_;
+  // Reset when the connection is closed.
+  scoped_ptr<StreamSocket> socket_;
+
+  scoped_refptr<IOBufferWithSize> read_buffer_;
+  // Received data which does not make a complete query yet.
+  std::string read_data_;
+
+  scoped_refptr<DrainableIOBuffer> write_buffer_;
+  // Responses waiting for |write_buffer_| to be written.
+  std::string write_data_;
+
+  base::WeakPtrFactory<TCPConnection> weak_factory_;
+
+  DISALLOW_COPY_AND_ASSIGN(TCPConnection);
+};
+
+TestDnsServer::TestDnsServer()
+    : loss_percent_(0),
+      truncate_udp_(false),
+      udp_queries_(0),
+      tcp_queries_(0),
+      receive_buffer_(new IOBufferWithSize(kMaxUDPSize)),
+      weak_factory_(this) {
+  bool rv = ParseIPLiteralToNumber("127.0.0.1", &address_);
+  DCHECK(rv);
+}
+
+TestDnsServer::~TestDnsServer() {}
+
+bool TestDnsServer::Start() {
+  IPAddressNumber localhost;
+  if (!ParseIPLiteralToNumber("127.0.0.1", &localhost))
+    return false;
+
+  for (int i = 0; i < kMaxStartAttempts; ++i) {
+    udp_socket_.reset(new UDPServerSocket(NULL, NetLog::Source()));
+    if (udp_socket_->Listen(IPEndPoint(localhost, 0)) != OK ||
+        udp_socket_->GetLocalAddress(&endpoint_) != OK) {
+      return false;
+    }
+    tcp_socket_.reset(new TCPServerSocket(NULL, NetLog::Source()));
+    if (tcp_socket_->Listen(endpoint_, 5) == OK) {
+      DoReceive();
+      DoAccept();
+      return true;
+    }
+  }
+  udp_socket_.reset();
+  tcp_socket_.reset();
+  return false;
+}
+
+std::string TestDnsServer::MakeResponse(const char* query,
+                                        int size,
+                                        bool truncate) const {
+  // Find the end of the question.
+  int offset = sizeof(dns_protocol::Header);
+  while (offset < size && query[offset])
+    offset += static_cast<uint8>(query[offset]) + 1;
+  offset += 1 + 2 * sizeof(uint16);
+  if (offset > size)
+    return std::string();
+
+  uint16 qtype;
+  ReadBigEndian<uint16>(query + offset - 2 * sizeof(uint16), &qtype);
+  bool answer = !truncate && qtype == dns_protocol::kTypeA &&
+      address_.size() == kIPv4AddressSize;
+
+  std::string response(query, offset);
+  dns_protocol::Header* header =
+      reinterpret_cast<dns_protocol::Header*>(&response[0]);
+  uint16 flags = dns_protocol::kFlagResponse | dns_protocol::kFlagRA |
+      (base::NetToHost16(header->flags) & dns_protocol::kFlagRD);
+  if (truncate)
+    flags |= dns_protocol::kFlagTC;
+  header->flags = base::HostToNet16(flags);
+  header->ancount = base::HostToNet16(answer ? 1 : 0);
+  header->nscount = 0;
+  header->arcount = 0;
+
+  if (answer) {
+    char record[2 * sizeof(uint16) + 2 * sizeof(uint16) + sizeof(uint32) +
+                sizeof(uint16) + kIPv4AddressSize];
+    BigEndianWriter writer(record, sizeof(record));
+    // Pointer to the name in the question.
+    writer.WriteU16(0xc000 | sizeof(dns_protocol::Header));
+    writer.WriteU16(dns_protocol::kTypeA);
+    writer.WriteU16(dns_protocol::kClassIN);
+    writer.WriteU32(kTTLSeconds);
+    writer.WriteU16(kIPv4AddressSize);
+    writer.WriteBytes(&address_[0], kIPv4AddressSize);
+    response.append(record, sizeof(record));
+  }
+  return response;
+}
+
+void TestDnsServer::DoReceive() {
+  while (true) {
+    int rv = udp_socket_->RecvFrom(
+        receive_buffer_.get(), receive_buffer_->size(), &receive_address_,
+        base::Bind(&TestDnsServer::OnReceiveComplete, base::Unretained(this)));
+    // Stop on errors, or wait for the next query.
+    if (rv < 0)
+      return;
+    OnQueryReceived(rv);
+  }
+}
+
+void TestDnsServer::OnReceiveComplete(int rv) {
+  if (rv < 0)
+    return;
+  OnQueryReceived(rv);
+  DoReceive();
+}
+
+void TestDnsServer::OnQueryReceived(int size) {
+  ++udp_queries_;
+  if (base::RandInt(0, 99) < loss_percent_)
+    return;
+  std::string response =
+      MakeResponse(receive_buffer_->data(), size, truncate_udp_);
+  if (response.empty())
+    return;
+  base::MessageLoop::current()->PostDelayedTask(
+      FROM_HERE,
+      base::Bind(&TestDnsServer::SendResponse, weak_factory_.GetWeakPtr(),
+                 response, receive_address_),
+      delay_);
+}
+
+void TestDnsServer::SendResponse(const std::string& response,
+                                 const IPEndPoint& address) {
+  send_queue_.push_back(std::make_pair(response, address));
+  if (!send_buffer_.get())
+    DoSend();
+}
+
+void TestDnsServer::DoSend() {
+  while (!send_queue_.empty()) {
+    const std::string& response = send_queue_.front().first;
+    send_buffer_ = new IOBufferWithSize(response.size());
+    memcpy(send_buffer_->data(), response.data(), response.size());
+    int rv = udp_socket_->SendTo(
+        send_buffer_.get(), send_buffer_->size(), send_queue_.front().second,
+        base::Bind(&TestDnsServer::OnSendComplete, base::Unretained(this)));
+    send_queue_.pop_front();
+    if (rv == ERR_IO_PENDING)
+      return;
+  }
+  send_buffer_ = NULL;
+}
+
+void TestDnsServer::OnSendComplete(int rv) {
+  DoSend();
+}
+
+void TestDnsServer::DoAccept() {
+  while (true) {
+    int rv = tcp_socket_->Accept(
+        &accepted_socket_,
+        base::Bind(&TestDnsServer::OnAcceptComplete, base::Unretained(this)));
+    if (rv == ERR_IO_PENDING)
+      return;
+    if (rv != OK)
+      return;
+    TCPConnection* connection =
+        new TCPConnection(this, accepted_socket_.Pass());
+    tcp_connections_.push_back(connection);
+    connection->Start();
+  }
+}
+
+void TestDnsServer::OnAcceptComplete(int rv) {
+  if (rv != OK)
+    return;
+  TCPConnection* connection = new TCPConnection(this, accepted_socket_.Pass());
+  tcp_connections_.push_back(connection);
+  connection->Start();
+  DoAccept();
+}
+
+}  // namespace net
@@ -0,0 +1,108 @@
+// Copyright 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef NET_DNS_TEST_DNS_SERVER_H_
+#define NET_DNS_TEST_DNS_SERVER_H_
+
+#include <deque>
+#include <string>
+#include <utility>
+
+#include "base/basictypes.h"
+#include "base/memory/ref_counted.h"
+#include "base/memory/scoped_ptr.h"
+#include "base/memory/scoped_vector.h"
+#include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
+#include "net/base/ip_endpoint.h"
+#include "net/base/net_util.h"
+
+namespace net {
+
+class DatagramServerSocket;
+class IOBufferWithSize;
+class ServerSocket;
+class StreamSocket;
+
+// A DNS server on a loopback port, for tests of DnsTransaction and for
+// experiments with latency and packet loss. It answers every A query with
+// address(), and other queries with no records. UDP and TCP are served on the
+// same port, as DnsSession expects, and queries over TCP may be pipelined.
+//
+// Must be used on a thread with a MessageLoopForIO.
+class TestDnsServer {
+ public:
+  TestDnsServer();
+  ~TestDnsServer();
+
+  // Starts listening on 127.0.0.1. Returns false on failure.
+  bool Start();
+
+  // The address to put in DnsConfig::nameservers.
+  const IPEndPoint& endpoint() const { return endpoint_; }
+
+  const IPAddressNumber& address() const { return address_; }
+  void set_address(const IPAddressNumber& address) { address_ = address; }
+
+  // Every response is sent this long after the query is received.
+  void set_delay(base::TimeDelta delay) { delay_ = delay; }
+
+  // Percentage of the queries over UDP which are dropped.
+  void set_loss_percent(int loss_percent) { loss_percent_ = loss_percent; }
+
+  // If true, responses over UDP are truncated, so that the client retries
+  // over TCP.
+  void set_truncate_udp(bool truncate_udp) { truncate_udp_ = truncate_udp; }
+
+  int udp_queries() const { return udp_queries_; }
+  int tcp_connections() const { return tcp_connections_.size(); }
+  int tcp_queries() const { return tcp_queries_; }
+
+ private:
+  class TCPConnection;
+
+  // Returns the response to the |size| bytes of |query|, or an empty string
+  // if the query is malformed.
+  std::string MakeResponse(const char* query, int size, bool truncate) const;
+
+  void DoReceive();
+  void OnReceiveComplete(int rv);
+  // Answers the |size| bytes in |receive_buffer_|, unless they are lost.
+  void OnQueryReceived(int size);
+
+  // Queues |response| to be sent to |address|.
+  void SendResponse(const std::string& response, const IPEndPoint& address);
+  void DoSend();
+  void OnSendComplete(int rv);
+
+  void DoAccept();
+  void OnAcceptComplete(int rv);
+
+  IPEndPoint endpoint_;
+  IPAddressNumber address_;
+  base::TimeDelta delay_;
+  int loss_percent_;
+  bool truncate_udp_;
+
+  int udp_queries_;
+  int tcp_queries_;
+
+  scoped_ptr<DatagramServerSocket> udp_socket_;
+  scoped_refptr<IOBufferWithSize> receive_buffer_;
+  IPEndPoint receive_address_;
+  std::deque<std::pair<std::string, IPEndPoint> > send_queue_;
+  scoped_refptr<IOBufferWithSize> send_buffer_;
+
+  scoped_ptr<ServerSocket> tcp_socket_;
+  scoped_ptr<StreamSocket> accepted_socket_;
+  ScopedVector<TCPConnection> tcp_connections_;
+
+  base::WeakPtrFactory<TestDnsServer> weak_factory_;
+
+  DISALLOW_COPY_AND_ASSIGN(TestDnsServer);
+};
+
+}  // namespace net
+
+#endif  // NET_DNS_TEST_DNS_SERVER_H_
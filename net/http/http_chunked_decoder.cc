@@ -44,6 +44,10 @@
 
 #include "net/http/http_chunked_decoder.h"
 
+#include <string.h>
+
+#include <algorithm>
+
 #include "base/logging.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/string_piece.h"
@@ -65,34 +69,43 @@ HttpChunkedDecoder::HttpChunkedDecoder()
 }
 
 int HttpChunkedDecoder::FilterBuf(char* buf, int buf_len) {
+  // Data is moved down over the chunk markers which precede it as it is
+  // scanned, so each byte is moved at most once, however many chunks the
+  // buffer holds.  |read| is the first byte not scanned yet, and the decoded
+  // data ends at |buf| + |result|.
   int result = 0;
+  const char* read = buf;
 
   while (buf_len) {
     if (chunk_remaining_) {
       int num = std::min(chunk_remaining_, buf_len);
+      if (read != buf + result)
+        memmove(buf + result, read, num);
 
       buf_len -= num;
       chunk_remaining_ -= num;
 
       result += num;
-      buf += num;
+      read += num;
 
       // After each chunk's data there should be a CRLF
       if (!chunk_remaining_)
         chunk_terminator_remaining_ = true;
       continue;
     } else if (reached_eof_) {
+      // The bytes after the final CRLF are expected right after the data.
+      if (read != buf + result)
+        memmove(buf + result, read, buf_len);
       bytes_after_eof_ += buf_len;
       break;  // Done!
     }
 
-    int bytes_consumed = ScanForChunkRemaining(buf, buf_len);
+    int bytes_consumed = ScanForChunkRemaining(read, buf_len);
     if (bytes_consumed < 0)
       return bytes_consumed; // Error
 
     buf_len -= bytes_consumed;
-    if (buf_len)
-      memmove(buf, buf + bytes_consumed, buf_len);
+    read += bytes_consumed;
   }
 
   return result;
@@ -104,8 +117,9 @@ int HttpChunkedDecoder::ScanForChunkRemaining(const char* buf, int buf_len) {
 
   int bytes_consumed = 0;
 
-  size_t index_of_lf = base::StringPiece(buf, buf_len).find('\n');
-  if (index_of_lf != base::StringPiece::npos) {
+  const char* lf = static_cast<const char*>(memchr(buf, '\n', buf_len));
+  if (lf) {
+    size_t index_of_lf = lf - buf;
     buf_len = static_cast<int>(index_of_lf);
     if (buf_len && buf[buf_len - 1] == '\r')  // Eliminate a preceding CR.
       buf_len--;
@@ -131,9 +145,10 @@ int HttpChunkedDecoder::ScanForChunkRemaining(const char* buf, int buf_len) {
       chunk_terminator_remaining_ = false;
     } else if (buf_len) {
       // Ignore any chunk-extensions.
-      size_t index_of_semicolon = base::StringPiece(buf, buf_len).find(';');
-      if (index_of_semicolon != base::StringPiece::npos)
-        buf_len = static_cast<int>(index_of_semicolon);
+      const char* semicolon =
+          static_cast<const char*>(memchr(buf, ';', buf_len));
+      if (semicolon)
+        buf_len = static_cast<int>(semicolon - buf);
 
       if (!ParseChunkSize(buf, buf_len, &chunk_remaining_)) {
         DLOG(ERROR) << "Failed parsing HEX from: " <<
@@ -196,11 +211,11 @@ bool HttpChunkedDecoder::ParseChunkSize(const char* start, int len, int* out) {
 
   // Be more restrictive than HexStringToInt;
   // don't allow inputs with leading "-", "+", "0x", "0X"
-  base::StringPiece chunk_size(start, len);
-  if (chunk_size.find_first_not_of("0123456789abcdefABCDEF")
-      != base::StringPiece::npos) {
-    return false;
+  for (int i = 0; i < len; ++i) {
+    if (!IsHexDigit(start[i]))
+      return false;
   }
+  base::StringPiece chunk_size(start, len);
 
   int parsed_number;
   bool ok = base::HexStringToInt(chunk_size, &parsed_number);
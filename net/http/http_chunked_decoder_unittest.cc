@@ -324,6 +324,26 @@ TEST(HttpChunkedDecoderTest, MultipleExtraDataBlocks) {
   RunTest(inputs, arraysize(inputs), "hello", true, 11);
 }
 
+// The data after the final CRLF must directly follow the decoded data, since
+// HttpStreamParser saves it from there.
+TEST(HttpChunkedDecoderTest, ExtraDataFollowsDecodedData) {
+  std::string input;
+  std::string expected;
+  for (int i = 0; i < 100; ++i) {
+    input.append("3;ext=1\r\nabc\r\n");
+    expected.append("abc");
+  }
+  input.append("0\r\n\r\nHTTP/1.1 200 OK");
+
+  HttpChunkedDecoder decoder;
+  int n = decoder.FilterBuf(&input[0], static_cast<int>(input.size()));
+  ASSERT_EQ(static_cast<int>(expected.size()), n);
+  EXPECT_EQ(expected, input.substr(0, n));
+  EXPECT_TRUE(decoder.reached_eof());
+  ASSERT_EQ(15, decoder.bytes_after_eof());
+  EXPECT_EQ("HTTP/1.1 200 OK", input.substr(n, decoder.bytes_after_eof()));
+}
+
 // Test when the line with the chunk length is too long.
 TEST(HttpChunkedDecoderTest, LongChunkLengthLine) {
   int big_chunk_length = HttpChunkedDecoder::kMaxLineBufLen;
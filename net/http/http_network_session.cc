@@ -45,6 +45,7 @@ net::ClientSocketPoolManager* CreateSocketPoolManager(
       params.ssl_session_cache_shard,
       params.proxy_service,
       params.ssl_config_service,
+      params.http_server_properties,
       pool_type);
 }
 
@@ -106,6 +106,40 @@ bool ShouldUpdateHeader(const std::string::const_iterator& name_begin,
   return true;
 }
 
+// The names of the headers which HttpResponseHeaders indexes directly, in the
+// order of HttpResponseHeaders::KnownHeader.
+struct KnownHeaderName {
+  const char* name;
+  size_t length;
+};
+
+const KnownHeaderName kKnownHeaders[] = {
+#define KNOWN_HEADER(name) { name, sizeof(name) - 1 }
+  KNOWN_HEADER("age"),
+  KNOWN_HEADER("cache-control"),
+  KNOWN_HEADER("connection"),
+  KNOWN_HEADER("content-disposition"),
+  KNOWN_HEADER("content-encoding"),
+  KNOWN_HEADER("content-length"),
+  KNOWN_HEADER("content-range"),
+  KNOWN_HEADER("content-type"),
+  KNOWN_HEADER("date"),
+  KNOWN_HEADER("etag"),
+  KNOWN_HEADER("expires"),
+  KNOWN_HEADER("keep-alive"),
+  KNOWN_HEADER("last-modified"),
+  KNOWN_HEADER("location"),
+  KNOWN_HEADER("pragma"),
+  KNOWN_HEADER("proxy-authenticate"),
+  KNOWN_HEADER("proxy-connection"),
+  KNOWN_HEADER("set-cookie"),
+  KNOWN_HEADER("strict-transport-security"),
+  KNOWN_HEADER("transfer-encoding"),
+  KNOWN_HEADER("vary"),
+  KNOWN_HEADER("www-authenticate"),
+#undef KNOWN_HEADER
+};
+
 void CheckDoesNotHaveEmbededNulls(const std::string& str) {
   // Care needs to be taken when adding values to the raw headers string to
   // make sure it does not contain embeded NULLs. Any embeded '\0' may be
@@ -124,6 +158,10 @@ struct HttpResponseHeaders::ParsedHeader {
   std::string::const_iterator name_end;
   std::string::const_iterator value_begin;
   std::string::const_iterator value_end;
+
+  // The index in parsed_ of the next line with the same name, or
+  // std::string::npos.  Not used for continuations.
+  size_t next_with_same_name;
 };
 
 //-----------------------------------------------------------------------------
@@ -154,14 +192,69 @@ HttpResponseHeaders::HttpResponseHeaders(const std::string& raw_input)
 HttpResponseHeaders::HttpResponseHeaders(const Pickle& pickle,
                                          PickleIterator* iter)
     : response_code_(-1) {
+  BuildIndex();
   std::string raw_input;
   if (pickle.ReadString(iter, &raw_input))
     Parse(raw_input);
 }
 
+HttpResponseHeaders::HttpResponseHeaders(const Pickle& pickle,
+                                         PickleIterator* iter,
+                                         PersistFormat format)
+    : response_code_(-1) {
+  BuildIndex();
+  std::string raw_input;
+  if (!pickle.ReadString(iter, &raw_input))
+    return;
+  if (format == PERSIST_FORMAT_TEXT) {
+    Parse(raw_input);
+    return;
+  }
+
+  int count;
+  const char* data;
+  int length;
+  if (!pickle.ReadInt(iter, &count) || count < 0 ||
+      !pickle.ReadData(iter, &data, &length) || length < 0)
+    return;
+  // Each header has four offsets.  The entry may be corrupt, so the count is
+  // checked against the length without any arithmetic that can overflow.
+  const size_t kHeaderIndexSize = 4 * sizeof(uint32);
+  const size_t index_size = static_cast<size_t>(length);
+  if (index_size % kHeaderIndexSize != 0 ||
+      static_cast<size_t>(count) != index_size / kHeaderIndexSize)
+    return;
+
+  // The data is not necessarily aligned for uint32 reads.
+  std::vector<uint32> offsets(index_size / sizeof(uint32));
+  if (index_size)
+    memcpy(&offsets[0], data, index_size);
+  if (!InitFromIndex(raw_input, count ? &offsets[0] : NULL, count)) {
+    DVLOG(1) << "inconsistent header index; parsing the headers instead";
+    raw_headers_.clear();
+    parsed_.clear();
+    Parse(raw_input);
+  }
+}
+
 void HttpResponseHeaders::Persist(Pickle* pickle, PersistOptions options) {
+  Persist(pickle, options, PERSIST_FORMAT_TEXT);
+}
+
+void HttpResponseHeaders::Persist(Pickle* pickle,
+                                  PersistOptions options,
+                                  PersistFormat format) {
+  std::vector<uint32> offsets;
   if (options == PERSIST_RAW) {
     pickle->WriteString(raw_headers_);
+    if (format == PERSIST_FORMAT_INDEXED) {
+      offsets.reserve(parsed_.size() * 4);
+      AppendOffsets(0, parsed_.size(), 0, &offsets);
+      pickle->WriteInt(static_cast<int>(parsed_.size()));
+      pickle->WriteData(reinterpret_cast<const char*>(
+                            offsets.empty() ? NULL : &offsets[0]),
+                        offsets.size() * sizeof(uint32));
+    }
     return;  // Done.
   }
 
@@ -206,6 +299,14 @@ void HttpResponseHeaders::Persist(Pickle* pickle, PersistOptions options) {
     StringToLowerASCII(&header_name);
 
     if (filter_headers.find(header_name) == filter_headers.end()) {
+      // The lines keep their positions relative to each other.
+      if (format == PERSIST_FORMAT_INDEXED) {
+        AppendOffsets(i, k + 1,
+                      blob.size() - (parsed_[i].name_begin -
+                                     raw_headers_.begin()),
+                      &offsets);
+      }
+
       // Make sure there is a null after the value.
       blob.append(parsed_[i].name_begin, parsed_[k].value_end);
       blob.push_back('\0');
@@ -216,6 +317,12 @@ void HttpResponseHeaders::Persist(Pickle* pickle, PersistOptions options) {
   blob.push_back('\0');
 
   pickle->WriteString(blob);
+  if (format == PERSIST_FORMAT_INDEXED) {
+    pickle->WriteInt(static_cast<int>(offsets.size() / 4));
+    pickle->WriteData(reinterpret_cast<const char*>(
+                          offsets.empty() ? NULL : &offsets[0]),
+                      offsets.size() * sizeof(uint32));
+  }
 }
 
 void HttpResponseHeaders::Update(const HttpResponseHeaders& new_headers) {
@@ -384,6 +491,7 @@ void HttpResponseHeaders::Parse(const std::string& raw_input) {
 
     DCHECK_EQ('\0', raw_headers_[raw_headers_.size() - 2]);
     DCHECK_EQ('\0', raw_headers_[raw_headers_.size() - 1]);
+    BuildIndex();
     return;
   }
 
@@ -412,11 +520,125 @@ void HttpResponseHeaders::Parse(const std::string& raw_input) {
               headers.values_begin(),
               headers.values_end());
   }
+  BuildIndex();
 
   DCHECK_EQ('\0', raw_headers_[raw_headers_.size() - 2]);
   DCHECK_EQ('\0', raw_headers_[raw_headers_.size() - 1]);
 }
 
+bool HttpResponseHeaders::InitFromIndex(const std::string& headers,
+                                        const uint32* offsets,
+                                        size_t count) {
+  // The status line was normalized before it was persisted, so parsing it
+  // again must give the same line.
+  std::string::const_iterator line_end =
+      std::find(headers.begin(), headers.end(), '\0');
+  if (line_end == headers.end())
+    return false;
+  ParseStatusLine(headers.begin(), line_end,
+                  line_end + 1 != headers.end() && line_end[1] != '\0');
+  const size_t status_line_len = line_end - headers.begin();
+  if (raw_headers_.size() != status_line_len ||
+      headers.compare(0, status_line_len, raw_headers_) != 0)
+    return false;
+
+  // Check the offsets before making iterators out of them.
+  const size_t size = headers.size();
+  if (size < status_line_len + 2 || headers[size - 2] != '\0' ||
+      headers[size - 1] != '\0')
+    return false;
+  for (size_t i = 0; i < count; ++i) {
+    const uint32* header = offsets + 4 * i;
+    const bool is_continuation = header[0] == header[1];
+    if (is_continuation && i == 0)
+      return false;
+    if (!is_continuation &&
+        (header[0] <= status_line_len || header[0] > header[1] ||
+         header[1] > header[2]))
+      return false;
+    if (header[2] <= status_line_len || header[2] > header[3] ||
+        header[3] > size)
+      return false;
+  }
+
+  raw_headers_ = headers;
+  parsed_.reserve(count);
+  const std::string::const_iterator begin = raw_headers_.begin();
+  for (size_t i = 0; i < count; ++i) {
+    const uint32* header = offsets + 4 * i;
+    if (header[0] == header[1]) {
+      AddToParsed(raw_headers_.end(), raw_headers_.end(),
+                  begin + header[2], begin + header[3]);
+    } else {
+      AddToParsed(begin + header[0], begin + header[1],
+                  begin + header[2], begin + header[3]);
+    }
+  }
+  BuildIndex();
+  return true;
+}
+
+void HttpResponseHeaders::AppendOffsets(size_t begin,
+                                        size_t end,
+                                        size_t shift,
+                                        std::vector<uint32>* offsets) const {
+  const std::string::const_iterator raw_begin = raw_headers_.begin();
+  for (size_t i = begin; i < end; ++i) {
+    const ParsedHeader& header = parsed_[i];
+    // Continuations are marked by an empty name at offset 0.
+    if (header.is_continuation()) {
+      offsets->push_back(0);
+      offsets->push_back(0);
+    } else {
+      offsets->push_back(header.name_begin - raw_begin + shift);
+      offsets->push_back(header.name_end - raw_begin + shift);
+    }
+    offsets->push_back(header.value_begin - raw_begin + shift);
+    offsets->push_back(header.value_end - raw_begin + shift);
+  }
+}
+
+void HttpResponseHeaders::BuildIndex() {
+  std::fill(known_headers_, known_headers_ + KNOWN_HEADER_COUNT,
+            std::string::npos);
+  other_headers_.clear();
+
+  // Walk backwards, so that each line is linked to the one after it.
+  for (size_t i = parsed_.size(); i-- > 0;) {
+    ParsedHeader& header = parsed_[i];
+    if (header.is_continuation())
+      continue;
+    StringPiece name(&*header.name_begin, header.name_end - header.name_begin);
+    KnownHeader known_header = GetKnownHeader(name);
+    size_t* first;
+    if (known_header != KNOWN_HEADER_COUNT) {
+      first = &known_headers_[known_header];
+    } else {
+      std::string lower_name(name.data(), name.size());
+      StringToLowerASCII(&lower_name);
+      first = &other_headers_.insert(
+          HeaderIndex::value_type(lower_name, std::string::npos)).first->second;
+    }
+    header.next_with_same_name = *first;
+    *first = i;
+  }
+}
+
+// static
+HttpResponseHeaders::KnownHeader HttpResponseHeaders::GetKnownHeader(
+    const StringPiece& name) {
+  COMPILE_ASSERT(arraysize(kKnownHeaders) == KNOWN_HEADER_COUNT,
+                 known_headers_mismatch);
+
+  // Most names are rejected by their length.
+  for (size_t i = 0; i < arraysize(kKnownHeaders); ++i) {
+    if (name.size() == kKnownHeaders[i].length &&
+        LowerCaseEqualsASCII(name.begin(), name.end(), kKnownHeaders[i].name))
+      return static_cast<KnownHeader>(i);
+  }
+  return KNOWN_HEADER_COUNT;
+}
+
 // Append all of our headers to the final output string.
 void HttpResponseHeaders::GetNormalizedHeaders(std::string* output) const {
   // copy up to the null byte.  this just copies the status line.
@@ -568,13 +790,18 @@ bool HttpResponseHeaders::HasHeaderValue(const base::StringPiece& name,
                                          const base::StringPiece& value) const {
   // The value has to be an exact match.  This is important since
   // 'cache-control: no-cache' != 'cache-control: no-cache="foo"'
-  void* iter = NULL;
-  std::string temp;
-  while (EnumerateHeader(&iter, name, &temp)) {
-    if (value.size() == temp.size() &&
-        std::equal(temp.begin(), temp.end(), value.begin(),
-                   base::CaseInsensitiveCompare<char>()))
-      return true;
+  for (size_t i = FindHeader(0, name); i != std::string::npos;
+       i = parsed_[i].next_with_same_name) {
+    // Check the values of the line, including its continuations.
+    size_t j = i;
+    do {
+      const ParsedHeader& header = parsed_[j];
+      if (static_cast<size_t>(header.value_end - header.value_begin) ==
+              value.size() &&
+          std::equal(header.value_begin, header.value_end, value.begin(),
+                     base::CaseInsensitiveCompare<char>()))
+        return true;
+    } while (++j < parsed_.size() && parsed_[j].is_continuation());
   }
   return false;
 }
@@ -584,6 +811,7 @@ bool HttpResponseHeaders::HasHeader(const base::StringPiece& name) const {
 }
 
 HttpResponseHeaders::HttpResponseHeaders() : response_code_(-1) {
+  BuildIndex();
 }
 
 HttpResponseHeaders::~HttpResponseHeaders() {
@@ -708,18 +936,22 @@ void HttpResponseHeaders::ParseStatusLine(
 
 size_t HttpResponseHeaders::FindHeader(size_t from,
                                        const base::StringPiece& search) const {
-  for (size_t i = from; i < parsed_.size(); ++i) {
-    if (parsed_[i].is_continuation())
-      continue;
-    const std::string::const_iterator& name_begin = parsed_[i].name_begin;
-    const std::string::const_iterator& name_end = parsed_[i].name_end;
-    if (static_cast<size_t>(name_end - name_begin) == search.size() &&
-        std::equal(name_begin, name_end, search.begin(),
-                   base::CaseInsensitiveCompare<char>()))
-      return i;
+  size_t i;
+  KnownHeader known_header = GetKnownHeader(search);
+  if (known_header != KNOWN_HEADER_COUNT) {
+    i = known_headers_[known_header];
+  } else {
+    std::string lower_search(search.data(), search.size());
+    StringToLowerASCII(&lower_search);
+    HeaderIndex::const_iterator it = other_headers_.find(lower_search);
+    if (it == other_headers_.end())
+      return std::string::npos;
+    i = it->second;
   }
 
-  return std::string::npos;
+  while (i < from)
+    i = parsed_[i].next_with_same_name;
+  return i;
 }
 
 void HttpResponseHeaders::AddHeader(std::string::const_iterator name_begin,
@@ -749,6 +981,7 @@ void HttpResponseHeaders::AddToParsed(std::string::const_iterator name_begin,
   header.name_end = name_end;
   header.value_begin = value_begin;
   header.value_end = value_end;
+  header.next_with_same_name = std::string::npos;
   parsed_.push_back(header);
 }
 
@@ -41,6 +41,14 @@ class NET_EXPORT HttpResponseHeaders
   static const PersistOptions PERSIST_SANS_RANGES = 1 << 4;
   static const PersistOptions PERSIST_SANS_SECURITY_STATE = 1 << 5;
 
+  // Persist formats.  PERSIST_FORMAT_INDEXED appends the offsets of the parsed
+  // headers to the text, so that they can be restored without parsing the
+  // text again.  A pickle must be read with the format it was written with.
+  enum PersistFormat {
+    PERSIST_FORMAT_TEXT,
+    PERSIST_FORMAT_INDEXED,
+  };
+
   // Parses the given raw_headers.  raw_headers should be formatted thus:
   // includes the http status response line, each line is \0-terminated, and
   // it's terminated by an empty line (ie, 2 \0s in a row).
@@ -55,10 +63,14 @@ class NET_EXPORT HttpResponseHeaders
   // for this object is found relative to the given pickle_iter, which should
   // be passed to the pickle's various Read* methods.
   HttpResponseHeaders(const Pickle& pickle, PickleIterator* pickle_iter);
+  HttpResponseHeaders(const Pickle& pickle,
+                      PickleIterator* pickle_iter,
+                      PersistFormat format);
 
   // Appends a representation of this object to the given pickle.
   // The options argument can be a combination of PersistOptions.
   void Persist(Pickle* pickle, PersistOptions options);
+  void Persist(Pickle* pickle, PersistOptions options, PersistFormat format);
 
   // Performs header merging as described in 13.5.3 of RFC 2616.
   void Update(const HttpResponseHeaders& new_headers);
@@ -279,12 +291,66 @@ class NET_EXPORT HttpResponseHeaders
   struct ParsedHeader;
   typedef std::vector<ParsedHeader> HeaderList;
 
+  // Headers which are looked up for most responses.  Each of them has a slot
+  // in known_headers_, so that finding them needs no hash table lookup.
+  enum KnownHeader {
+    KNOWN_HEADER_AGE,
+    KNOWN_HEADER_CACHE_CONTROL,
+    KNOWN_HEADER_CONNECTION,
+    KNOWN_HEADER_CONTENT_DISPOSITION,
+    KNOWN_HEADER_CONTENT_ENCODING,
+    KNOWN_HEADER_CONTENT_LENGTH,
+    KNOWN_HEADER_CONTENT_RANGE,
+    KNOWN_HEADER_CONTENT_TYPE,
+    KNOWN_HEADER_DATE,
+    KNOWN_HEADER_ETAG,
+    KNOWN_HEADER_EXPIRES,
+    KNOWN_HEADER_KEEP_ALIVE,
+    KNOWN_HEADER_LAST_MODIFIED,
+    KNOWN_HEADER_LOCATION,
+    KNOWN_HEADER_PRAGMA,
+    KNOWN_HEADER_PROXY_AUTHENTICATE,
+    KNOWN_HEADER_PROXY_CONNECTION,
+    KNOWN_HEADER_SET_COOKIE,
+    KNOWN_HEADER_STRICT_TRANSPORT_SECURITY,
+    KNOWN_HEADER_TRANSFER_ENCODING,
+    KNOWN_HEADER_VARY,
+    KNOWN_HEADER_WWW_AUTHENTICATE,
+    KNOWN_HEADER_COUNT,
+  };
+
+  // Maps the lower case names of the other headers to the index in parsed_ of
+  // their first line.
+  typedef base::hash_map<std::string, size_t> HeaderIndex;
+
   HttpResponseHeaders();
   ~HttpResponseHeaders();
 
   // Initializes from the given raw headers.
   void Parse(const std::string& raw_input);
 
+  // Initializes from headers in raw_headers_ form and the offsets of their
+  // parsed lines, as written by Persist().  Returns false if the offsets are
+  // not consistent with the headers.
+  bool InitFromIndex(const std::string& headers,
+                     const uint32* offsets,
+                     size_t count);
+
+  // Appends the offsets of parsed_[begin, end) to |offsets|.  The offsets are
+  // relative to the start of raw_headers_, plus |shift|.
+  void AppendOffsets(size_t begin,
+                     size_t end,
+                     size_t shift,
+                     std::vector<uint32>* offsets) const;
+
+  // Builds known_headers_, other_headers_ and the links between the lines with
+  // the same name from parsed_.
+  void BuildIndex();
+
+  // Returns the KnownHeader matching |name| case-insensitively, or
+  // KNOWN_HEADER_COUNT if there is none.
+  static KnownHeader GetKnownHeader(const base::StringPiece& name);
+
   // Helper function for ParseStatusLine.
   // Tries to extract the "HTTP/X.Y" from a status line formatted like:
   //    HTTP/1.1 200 OK
@@ -304,7 +370,8 @@ class NET_EXPORT HttpResponseHeaders
                        bool has_headers);
 
   // Find the header in our list (case-insensitive) starting with parsed_ at
-  // index |from|.  Returns string::npos if not found.
+  // index |from|.  Returns string::npos if not found.  This follows the index,
+  // so it does not look at the lines with other names.
   size_t FindHeader(size_t from, const base::StringPiece& name) const;
 
   // Add a header->value pair to our list.  If we already have header in our
@@ -352,6 +419,12 @@ class NET_EXPORT HttpResponseHeaders
   // header-value pairs within raw_headers_.
   HeaderList parsed_;
 
+  // The index in parsed_ of the first line of each known header, or
+  // std::string::npos.  Together with other_headers_ and the links in
+  // ParsedHeader, this indexes parsed_ by header name.
+  size_t known_headers_[KNOWN_HEADER_COUNT];
+  HeaderIndex other_headers_;
+
   // The raw_headers_ consists of the normalized status line (terminated with a
   // null byte) and then followed by the raw null-terminated headers from the
   // input that was passed to our constructor.  We preserve the input [*] to
@@ -0,0 +1,125 @@
+// Copyright 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <algorithm>
+#include <string>
+
+#include "base/perftimer.h"
+#include "base/pickle.h"
+#include "base/time/time.h"
+#include "net/http/http_response_headers.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace net {
+
+namespace {
+
+const int kIterations = 20000;
+
+// The headers of a typical cacheable response from a large site.
+const char kHeaders[] =
+    "HTTP/1.1 200 OK\n"
+    "Date: Mon, 21 Oct 2013 18:00:00 GMT\n"
+    "Server: Apache\n"
+    "Cache-Control: public, max-age=3600\n"
+    "Expires: Mon, 21 Oct 2013 19:00:00 GMT\n"
+    "Last-Modified: Fri, 18 Oct 2013 10:00:00 GMT\n"
+    "ETag: \"5a3c-4e8f2d3c5a1c0\"\n"
+    "Accept-Ranges: bytes\n"
+    "Content-Length: 23100\n"
+    "Vary: Accept-Encoding\n"
+    "Content-Encoding: gzip\n"
+    "Content-Type: text/html; charset=utf-8\n"
+    "X-Frame-Options: SAMEORIGIN\n"
+    "X-XSS-Protection: 1; mode=block\n"
+    "X-Content-Type-Options: nosniff\n"
+    "Set-Cookie: id=a3fWa; Expires=Wed, 21 Oct 2015 07:28:00 GMT\n"
+    "Set-Cookie: session=1234; Path=/; HttpOnly\n"
+    "P3P: CP=\"This is not a P3P policy!\"\n"
+    "Alternate-Protocol: 443:npn-spdy/3\n"
+    "Keep-Alive: timeout=5, max=100\n"
+    "Connection: Keep-Alive\n";
+
+std::string RawHeaders() {
+  std::string headers(kHeaders);
+  std::replace(headers.begin(), headers.end(), '\n', '\0');
+  return headers;
+}
+
+// Makes about as many lookups as the cache and the job make per response.
+void LookUpHeaders(const HttpResponseHeaders& headers) {
+  std::string value;
+  base::Time time;
+  base::TimeDelta delta;
+  headers.GetNormalizedHeader("content-encoding", &value);
+  headers.GetNormalizedHeader("vary", &value);
+  headers.GetMimeType(&value);
+  headers.GetCharset(&value);
+  headers.GetContentLength();
+  headers.IsKeepAlive();
+  headers.IsRedirect(NULL);
+  headers.HasStrongValidators();
+  headers.HasHeaderValue("cache-control", "no-store");
+  headers.HasHeaderValue("pragma", "no-cache");
+  headers.HasHeader("content-range");
+  headers.EnumerateHeader(NULL, "Alternate-Protocol", &value);
+  headers.EnumerateHeader(NULL, "X-Frame-Options", &value);
+  headers.GetMaxAgeValue(&delta);
+  headers.GetDateValue(&time);
+  headers.GetExpiresValue(&time);
+  headers.GetLastModifiedValue(&time);
+  void* iter = NULL;
+  while (headers.EnumerateHeader(&iter, "set-cookie", &value)) {}
+}
+
+TEST(HttpResponseHeadersPerfTest, Parse) {
+  const std::string raw_headers = RawHeaders();
+  PerfTimeLogger timer("Http_ResponseHeaders_Parse");
+  for (int i = 0; i < kIterations; ++i) {
+    scoped_refptr<HttpResponseHeaders> headers(
+        new HttpResponseHeaders(raw_headers));
+  }
+  timer.Done();
+}
+
+TEST(HttpResponseHeadersPerfTest, LookUp) {
+  scoped_refptr<HttpResponseHeaders> headers(
+      new HttpResponseHeaders(RawHeaders()));
+  PerfTimeLogger timer("Http_ResponseHeaders_LookUp");
+  for (int i = 0; i < kIterations; ++i)
+    LookUpHeaders(*headers.get());
+  timer.Done();
+}
+
+// Measures restoring cached headers from both persist formats.
+TEST(HttpResponseHeadersPerfTest, Unpickle) {
+  scoped_refptr<HttpResponseHeaders> headers(
+      new HttpResponseHeaders(RawHeaders()));
+
+  Pickle text_pickle;
+  headers->Persist(&text_pickle, HttpResponseHeaders::PERSIST_RAW,
+                   HttpResponseHeaders::PERSIST_FORMAT_TEXT);
+  PerfTimeLogger text_timer("Http_ResponseHeaders_Unpickle_Text");
+  for (int i = 0; i < kIterations; ++i) {
+    PickleIterator iter(text_pickle);
+    scoped_refptr<HttpResponseHeaders> restored(new HttpResponseHeaders(
+        text_pickle, &iter, HttpResponseHeaders::PERSIST_FORMAT_TEXT));
+  }
+  text_timer.Done();
+
+  Pickle indexed_pickle;
+  headers->Persist(&indexed_pickle, HttpResponseHeaders::PERSIST_RAW,
+                   HttpResponseHeaders::PERSIST_FORMAT_INDEXED);
+  PerfTimeLogger indexed_timer("Http_ResponseHeaders_Unpickle_Indexed");
+  for (int i = 0; i < kIterations; ++i) {
+    PickleIterator iter(indexed_pickle);
+    scoped_refptr<HttpResponseHeaders> restored(new HttpResponseHeaders(
+        indexed_pickle, &iter, HttpResponseHeaders::PERSIST_FORMAT_INDEXED));
+  }
+  indexed_timer.Done();
+}
+
+}  // namespace
+
+}  // namespace net
@@ -484,6 +484,127 @@ TEST(HttpResponseHeadersTest, Persist) {
     std::string h2;
     parsed2->GetNormalizedHeaders(&h2);
     EXPECT_EQ(std::string(tests[i].expected_headers), h2);
+
+    // The indexed format must restore the same headers.
+    Pickle indexed_pickle;
+    parsed1->Persist(&indexed_pickle, tests[i].options,
+                     net::HttpResponseHeaders::PERSIST_FORMAT_INDEXED);
+
+    PickleIterator indexed_iter(indexed_pickle);
+    scoped_refptr<net::HttpResponseHeaders> parsed3(
+        new net::HttpResponseHeaders(
+            indexed_pickle, &indexed_iter,
+            net::HttpResponseHeaders::PERSIST_FORMAT_INDEXED));
+
+    std::string h3;
+    parsed3->GetNormalizedHeaders(&h3);
+    EXPECT_EQ(h2, h3);
+    EXPECT_EQ(parsed2->raw_headers(), parsed3->raw_headers());
+  }
+}
+
+TEST(HttpResponseHeadersTest, PersistIndexed) {
+  std::string headers =
+      "HTTP/1.1 200 OK\n"
+      "Cache-Control: private, max-age=0\n"
+      "X-Foo: a, b\n"
+      "set-cookie: a=b\n"
+      "cache-control: no-store\n"
+      "x-foo: c\n"
+      "Empty:\n";
+  HeadersToRaw(&headers);
+  scoped_refptr<net::HttpResponseHeaders> parsed1(
+      new net::HttpResponseHeaders(headers));
+
+  Pickle pickle;
+  parsed1->Persist(&pickle, net::HttpResponseHeaders::PERSIST_RAW,
+                   net::HttpResponseHeaders::PERSIST_FORMAT_INDEXED);
+  PickleIterator iter(pickle);
+  scoped_refptr<net::HttpResponseHeaders> parsed2(
+      new net::HttpResponseHeaders(
+          pickle, &iter, net::HttpResponseHeaders::PERSIST_FORMAT_INDEXED));
+
+  EXPECT_EQ(parsed1->raw_headers(), parsed2->raw_headers());
+  EXPECT_EQ(200, parsed2->response_code());
+
+  void* iter1 = NULL;
+  void* iter2 = NULL;
+  std::string name1, value1, name2, value2;
+  while (parsed1->EnumerateHeaderLines(&iter1, &name1, &value1)) {
+    ASSERT_TRUE(parsed2->EnumerateHeaderLines(&iter2, &name2, &value2));
+    EXPECT_EQ(name1, name2);
+    EXPECT_EQ(value1, value2);
+  }
+  EXPECT_FALSE(parsed2->EnumerateHeaderLines(&iter2, &name2, &value2));
+
+  EXPECT_TRUE(parsed2->HasHeaderValue("cache-control", "MAX-AGE=0"));
+  EXPECT_TRUE(parsed2->HasHeaderValue("Cache-Control", "no-store"));
+  EXPECT_TRUE(parsed2->HasHeaderValue("X-FOO", "c"));
+  EXPECT_TRUE(parsed2->HasHeader("empty"));
+  std::string value;
+  EXPECT_TRUE(parsed2->GetNormalizedHeader("x-foo", &value));
+  EXPECT_EQ("a, b, c", value);
+}
+
+// A pickle with offsets which don't match the headers is parsed as text.
+TEST(HttpResponseHeadersTest, PersistIndexedInconsistent) {
+  std::string headers =
+      "HTTP/1.1 200 OK\n"
+      "Content-Type: text/html\n";
+  HeadersToRaw(&headers);
+  scoped_refptr<net::HttpResponseHeaders> parsed1(
+      new net::HttpResponseHeaders(headers));
+
+  Pickle pickle;
+  pickle.WriteString(parsed1->raw_headers());
+  const uint32 offsets[] = { 16, 1000, 1001, 1010 };
+  pickle.WriteInt(1);
+  pickle.WriteData(reinterpret_cast<const char*>(offsets), sizeof(offsets));
+
+  PickleIterator iter(pickle);
+  scoped_refptr<net::HttpResponseHeaders> parsed2(
+      new net::HttpResponseHeaders(
+          pickle, &iter, net::HttpResponseHeaders::PERSIST_FORMAT_INDEXED));
+  EXPECT_EQ(parsed1->raw_headers(), parsed2->raw_headers());
+  std::string value;
+  EXPECT_TRUE(parsed2->GetNormalizedHeader("content-type", &value));
+  EXPECT_EQ("text/html", value);
+}
+
+// A corrupt index whose header count doesn't match its size is rejected,
+// even when multiplying the count out overflows.
+TEST(HttpResponseHeadersTest, PersistIndexedCorruptCount) {
+  std::string headers =
+      "HTTP/1.1 200 OK\n"
+      "Content-Type: text/html\n";
+  HeadersToRaw(&headers);
+  scoped_refptr<net::HttpResponseHeaders> parsed1(
+      new net::HttpResponseHeaders(headers));
+
+  const uint32 offsets[] = { 16, 28, 30, 39 };
+  const struct {
+    int count;
+    int length;
+  } tests[] = {
+    { 0x40000001, sizeof(offsets) },
+    { 0x10000001, sizeof(offsets) },
+    { 2, sizeof(offsets) },
+    { 0, sizeof(offsets) },
+    { 1, sizeof(offsets) - 1 },
+  };
+  for (size_t i = 0; i < arraysize(tests); ++i) {
+    SCOPED_TRACE(i);
+    Pickle pickle;
+    pickle.WriteString(parsed1->raw_headers());
+    pickle.WriteInt(tests[i].count);
+    pickle.WriteData(reinterpret_cast<const char*>(offsets), tests[i].length);
+
+    PickleIterator iter(pickle);
+    scoped_refptr<net::HttpResponseHeaders> parsed2(
+        new net::HttpResponseHeaders(
+            pickle, &iter, net::HttpResponseHeaders::PERSIST_FORMAT_INDEXED));
+    EXPECT_EQ(-1, parsed2->response_code());
+    EXPECT_FALSE(parsed2->HasHeader("content-type"));
   }
 }
 
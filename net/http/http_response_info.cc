@@ -27,6 +27,7 @@ X509Certificate::PickleType GetPickleTypeForVersion(int version) {
     case 2:
       return X509Certificate::PICKLETYPE_CERTIFICATE_CHAIN_V2;
     case 3:
+    case 4:
     default:
       return X509Certificate::PICKLETYPE_CERTIFICATE_CHAIN_V3;
   }
@@ -38,7 +39,7 @@ X509Certificate::PickleType GetPickleTypeForVersion(int version) {
 // serialized HttpResponseInfo.
 enum {
   // The version of the response info used when persisting response info.
-  RESPONSE_INFO_VERSION = 3,
+  RESPONSE_INFO_VERSION = 4,
 
   // The minimum version supported for deserializing response info.
   RESPONSE_INFO_MINIMUM_VERSION = 1,
@@ -87,6 +88,10 @@ enum {
   // This bit is set if the request has http authentication.
   RESPONSE_INFO_USE_HTTP_AUTHENTICATION = 1 << 19,
 
+  // This bit is set if the response headers are followed by the offsets of
+  // their parsed lines.  Older versions can't read these, hence version 4.
+  RESPONSE_INFO_HAS_HEADER_INDEX = 1 << 20,
+
   // TODO(darin): Add other bits to indicate alternate request methods.
   // For now, we don't support storing those.
 };
@@ -176,7 +181,11 @@ bool HttpResponseInfo::InitFromPickle(const Pickle& pickle,
   response_time = Time::FromInternalValue(time_val);
 
   // Read response-headers
-  headers = new HttpResponseHeaders(pickle, &iter);
+  headers = new HttpResponseHeaders(
+      pickle, &iter,
+      (flags & RESPONSE_INFO_HAS_HEADER_INDEX) ?
+          HttpResponseHeaders::PERSIST_FORMAT_INDEXED :
+          HttpResponseHeaders::PERSIST_FORMAT_TEXT);
   if (headers->response_code() == -1)
     return false;
 
@@ -261,7 +270,7 @@ bool HttpResponseInfo::InitFromPickle(const Pickle& pickle,
 void HttpResponseInfo::Persist(Pickle* pickle,
                                bool skip_transient_headers,
                                bool response_truncated) const {
-  int flags = RESPONSE_INFO_VERSION;
+  int flags = RESPONSE_INFO_VERSION | RESPONSE_INFO_HAS_HEADER_INDEX;
   if (ssl_info.is_valid()) {
     flags |= RESPONSE_INFO_HAS_CERT;
     flags |= RESPONSE_INFO_HAS_CERT_STATUS;
@@ -304,7 +313,8 @@ void HttpResponseInfo::Persist(Pickle* pickle,
         net::HttpResponseHeaders::PERSIST_SANS_SECURITY_STATE;
   }
 
-  headers->Persist(pickle, persist_options);
+  headers->Persist(pickle, persist_options,
+                   HttpResponseHeaders::PERSIST_FORMAT_INDEXED);
 
   if (ssl_info.is_valid()) {
     ssl_info.cert->Persist(pickle);
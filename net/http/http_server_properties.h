@@ -9,6 +9,7 @@
 #include <string>
 #include "base/basictypes.h"
 #include "base/memory/weak_ptr.h"
+#include "net/base/address_family.h"
 #include "net/base/host_port_pair.h"
 #include "net/base/net_export.h"
 #include "net/http/http_pipelined_host_capability.h"
@@ -62,6 +63,7 @@ extern const char kAlternateProtocolHeader[];
 // * SPDY support (based on NPN results)
 // * Alternate-Protocol support
 // * Spdy Settings (like CWND ID field)
+// * The address family that last connected first when racing IPv6 and IPv4
 class NET_EXPORT HttpServerProperties {
  public:
   HttpServerProperties() {}
@@ -132,6 +134,16 @@ class NET_EXPORT HttpServerProperties {
 
   virtual PipelineCapabilityMap GetPipelineCapabilityMap() const = 0;
 
+  // Returns the address family whose connect() won the last race to |server|,
+  // or ADDRESS_FAMILY_UNSPECIFIED if it is not known.
+  virtual AddressFamily GetPreferredAddressFamily(
+      const HostPortPair& server) = 0;
+
+  // Records that a connect() to an address in |address_family| won the race
+  // to |server|, so that the next connection tries that family first.
+  virtual void SetPreferredAddressFamily(const HostPortPair& server,
+                                         AddressFamily address_family) = 0;
+
  private:
   DISALLOW_COPY_AND_ASSIGN(HttpServerProperties);
 };
@@ -17,10 +17,14 @@ namespace net {
 // then, this is just a bad guess.
 static const int kDefaultNumHostsToRemember = 200;
 
+// Number of hosts whose preferred address family is remembered.
+static const int kNumAddressFamilyHostsToRemember = 1000;
+
 HttpServerPropertiesImpl::HttpServerPropertiesImpl()
     : weak_ptr_factory_(this),
       pipeline_capability_map_(
-        new CachedPipelineCapabilityMap(kDefaultNumHostsToRemember)) {
+        new CachedPipelineCapabilityMap(kDefaultNumHostsToRemember)),
+      preferred_address_family_map_(kNumAddressFamilyHostsToRemember) {
 }
 
 HttpServerPropertiesImpl::~HttpServerPropertiesImpl() {
@@ -123,6 +127,7 @@ void HttpServerPropertiesImpl::Clear() {
   alternate_protocol_map_.clear();
   spdy_settings_map_.clear();
   pipeline_capability_map_->Clear();
+  preferred_address_family_map_.Clear();
 }
 
 bool HttpServerPropertiesImpl::SupportsSpdy(
@@ -300,4 +305,27 @@ HttpServerPropertiesImpl::GetPipelineCapabilityMap() const {
   return result;
 }
 
+AddressFamily HttpServerPropertiesImpl::GetPreferredAddressFamily(
+    const HostPortPair& server) {
+  DCHECK(CalledOnValidThread());
+  AddressFamilyMap::const_iterator it =
+      preferred_address_family_map_.Get(server);
+  if (it == preferred_address_family_map_.end())
+    return ADDRESS_FAMILY_UNSPECIFIED;
+  return it->second;
+}
+
+void HttpServerPropertiesImpl::SetPreferredAddressFamily(
+    const HostPortPair& server,
+    AddressFamily address_family) {
+  DCHECK(CalledOnValidThread());
+  if (address_family == ADDRESS_FAMILY_UNSPECIFIED) {
+    AddressFamilyMap::iterator it = preferred_address_family_map_.Peek(server);
+    if (it != preferred_address_family_map_.end())
+      preferred_address_family_map_.Erase(it);
+    return;
+  }
+  preferred_address_family_map_.Put(server, address_family);
+}
+
 }  // namespace net
@@ -138,9 +138,17 @@ class NET_EXPORT HttpServerPropertiesImpl
 
   virtual PipelineCapabilityMap GetPipelineCapabilityMap() const OVERRIDE;
 
+  virtual AddressFamily GetPreferredAddressFamily(
+      const HostPortPair& server) OVERRIDE;
+
+  virtual void SetPreferredAddressFamily(
+      const HostPortPair& server,
+      AddressFamily address_family) OVERRIDE;
+
  private:
   typedef base::MRUCache<
       HostPortPair, HttpPipelinedHostCapability> CachedPipelineCapabilityMap;
+  typedef base::MRUCache<HostPortPair, AddressFamily> AddressFamilyMap;
   // |spdy_servers_table_| has flattened representation of servers (host/port
   // pair) that either support or not support SPDY protocol.
   typedef base::hash_map<std::string, bool> SpdyServerHostPortTable;
@@ -152,6 +160,8 @@ class NET_EXPORT HttpServerPropertiesImpl
   AlternateProtocolMap alternate_protocol_map_;
   SpdySettingsMap spdy_settings_map_;
   scoped_ptr<CachedPipelineCapabilityMap> pipeline_capability_map_;
+  // Not persisted; networks change too often for it to be worth it.
+  AddressFamilyMap preferred_address_family_map_;
 
   DISALLOW_COPY_AND_ASSIGN(HttpServerPropertiesImpl);
 };
@@ -411,6 +411,37 @@ TEST_F(SpdySettingsServerPropertiesTest, Clear) {
   EXPECT_EQ(0U, impl_.GetSpdySettings(spdy_server_docs).size());
 }
 
+typedef HttpServerPropertiesImplTest PreferredAddressFamilyServerPropertiesTest;
+
+TEST_F(PreferredAddressFamilyServerPropertiesTest, Basic) {
+  HostPortPair test_host_port_pair("foo", 80);
+  EXPECT_EQ(ADDRESS_FAMILY_UNSPECIFIED,
+            impl_.GetPreferredAddressFamily(test_host_port_pair));
+
+  impl_.SetPreferredAddressFamily(test_host_port_pair, ADDRESS_FAMILY_IPV4);
+  EXPECT_EQ(ADDRESS_FAMILY_IPV4,
+            impl_.GetPreferredAddressFamily(test_host_port_pair));
+  EXPECT_EQ(ADDRESS_FAMILY_UNSPECIFIED,
+            impl_.GetPreferredAddressFamily(HostPortPair("foo", 443)));
+
+  impl_.SetPreferredAddressFamily(test_host_port_pair, ADDRESS_FAMILY_IPV6);
+  EXPECT_EQ(ADDRESS_FAMILY_IPV6,
+            impl_.GetPreferredAddressFamily(test_host_port_pair));
+
+  impl_.SetPreferredAddressFamily(test_host_port_pair,
+                                  ADDRESS_FAMILY_UNSPECIFIED);
+  EXPECT_EQ(ADDRESS_FAMILY_UNSPECIFIED,
+            impl_.GetPreferredAddressFamily(test_host_port_pair));
+}
+
+TEST_F(PreferredAddressFamilyServerPropertiesTest, Clear) {
+  HostPortPair test_host_port_pair("foo", 80);
+  impl_.SetPreferredAddressFamily(test_host_port_pair, ADDRESS_FAMILY_IPV4);
+  impl_.Clear();
+  EXPECT_EQ(ADDRESS_FAMILY_UNSPECIFIED,
+            impl_.GetPreferredAddressFamily(test_host_port_pair));
+}
+
 }  // namespace
 
 }  // namespace net
@@ -9,6 +9,7 @@
 #include "base/strings/string_util.h"
 #include "base/values.h"
 #include "net/base/io_buffer.h"
+#include "net/base/io_buffer_pool.h"
 #include "net/base/ip_endpoint.h"
 #include "net/base/upload_data_stream.h"
 #include "net/http/http_chunked_decoder.h"
@@ -179,6 +180,7 @@ HttpStreamParser::HttpStreamParser(ClientSocketHandle* connection,
       read_buf_(read_buffer),
       read_buf_unused_offset_(0),
       response_header_start_offset_(-1),
+      response_header_search_offset_(0),
       response_body_length_(-1),
       response_body_read_(0),
       user_read_buf_(NULL),
@@ -244,7 +246,7 @@ int HttpStreamParser::SendRequest(const std::string& request_line,
   if (ShouldMergeRequestHeadersAndBody(request, request_->upload_data_stream)) {
     size_t merged_size = request.size() + request_->upload_data_stream->size();
     scoped_refptr<IOBuffer> merged_request_headers_and_body(
-        new IOBuffer(merged_size));
+        new PooledIOBuffer(merged_size));
     // We'll repurpose |request_headers_| to store the merged headers and
     // body.
     request_headers_ = new DrainableIOBuffer(
@@ -609,6 +611,7 @@ int HttpStreamParser::DoReadHeadersComplete(int result) {
         // response and reject it in the event that we're setting up a CONNECT
         // tunnel.
         response_header_start_offset_ = -1;
+        response_header_search_offset_ = 0;
         response_body_length_ = -1;
         io_state_ = STATE_REQUEST_SENT;
       } else {
@@ -765,9 +768,14 @@ int HttpStreamParser::ParseResponseHeaders() {
   }
 
   if (response_header_start_offset_ >= 0) {
+    // The end-of-headers marker is at most 3 bytes long, so a marker which
+    // ends in the new data starts at most 2 bytes before it.
+    int search_offset = std::max(response_header_start_offset_,
+                                 response_header_search_offset_ - 2);
     end_offset = HttpUtil::LocateEndOfHeaders(read_buf_->StartOfBuffer(),
                                               read_buf_->offset(),
-                                              response_header_start_offset_);
+                                              search_offset);
+    response_header_search_offset_ = read_buf_->offset();
   } else if (read_buf_->offset() >= 8) {
     // Enough data to decide that this is an HTTP/0.9 response.
     // 8 bytes = (4 bytes of junk) + "http".length()
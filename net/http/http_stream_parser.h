@@ -186,6 +186,11 @@ class NET_EXPORT_PRIVATE HttpStreamParser {
   // -1 if not found yet.
   int response_header_start_offset_;
 
+  // The offset from the start of |read_buf_| up to which the data has been
+  // searched for the end of the headers, so that each read only searches the
+  // new data. |read_buf_unused_offset_| is zero while reading headers.
+  int response_header_search_offset_;
+
   // The parsed response headers.  Owned by the caller.
   HttpResponseInfo* response_;
 
@@ -0,0 +1,148 @@
+// Copyright 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "base/memory/ref_counted.h"
+#include "base/memory/scoped_ptr.h"
+#include "base/message_loop/message_loop.h"
+#include "base/perftimer.h"
+#include "base/strings/stringprintf.h"
+#include "net/base/address_list.h"
+#include "net/base/io_buffer.h"
+#include "net/base/net_errors.h"
+#include "net/base/test_completion_callback.h"
+#include "net/http/http_chunked_decoder.h"
+#include "net/http/http_request_headers.h"
+#include "net/http/http_request_info.h"
+#include "net/http/http_response_info.h"
+#include "net/http/http_stream_parser.h"
+#include "net/http/http_util.h"
+#include "net/socket/client_socket_handle.h"
+#include "net/socket/socket_test_util.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+namespace net {
+
+namespace {
+
+const int kResponses = 2000;
+const int kReadSize = 1400;
+
+// A response with typical headers and a body of small chunks, like the ones
+// streamed by many dynamic sites.
+std::string ChunkedResponse() {
+  std::string response =
+      "HTTP/1.1 200 OK\r\n"
+      "Date: Mon, 21 Oct 2013 18:00:00 GMT\r\n"
+      "Server: Apache\r\n"
+      "Cache-Control: private, max-age=0\r\n"
+      "Expires: -1\r\n"
+      "Content-Type: text/html; charset=UTF-8\r\n"
+      "Set-Cookie: PREF=ID=1234567890abcdef:FF=0:TM=1382378400; "
+      "expires=Wed, 21-Oct-2015 18:00:00 GMT; path=/; domain=.example.com\r\n"
+      "X-Frame-Options: SAMEORIGIN\r\n"
+      "X-XSS-Protection: 1; mode=block\r\n"
+      "Transfer-Encoding: chunked\r\n"
+      "\r\n";
+  const std::string chunk(100, 'x');
+  for (int i = 0; i < 100; ++i)
+    response.append(base::StringPrintf("%x\r\n", 100) + chunk + "\r\n");
+  response.append("0\r\n\r\n");
+  return response;
+}
+
+// Splits |data| into reads of at most kReadSize bytes, as a socket would.
+std::vector<MockRead> SplitIntoReads(const std::string& data) {
+  std::vector<MockRead> reads;
+  for (size_t i = 0; i < data.size(); i += kReadSize) {
+    int length = std::min(static_cast<int>(data.size() - i), kReadSize);
+    reads.push_back(MockRead(SYNCHRONOUS, data.data() + i, length));
+  }
+  reads.push_back(MockRead(SYNCHRONOUS, OK));
+  return reads;
+}
+
+// Runs a GET request through an HttpStreamParser over a mock socket, and
+// reads the whole response.
+void ParseResponse(std::vector<MockRead>* reads) {
+  MockWrite writes[] = {
+    MockWrite(SYNCHRONOUS, "GET / HTTP/1.1\r\n\r\n"),
+  };
+  StaticSocketDataProvider data(&(*reads)[0], reads->size(),
+                                writes, arraysize(writes));
+  data.set_connect_data(MockConnect(SYNCHRONOUS, OK));
+
+  scoped_ptr<MockTCPClientSocket> transport(
+      new MockTCPClientSocket(AddressList(), NULL, &data));
+  TestCompletionCallback callback;
+  ASSERT_EQ(OK, transport->Connect(callback.callback()));
+
+  ClientSocketHandle socket_handle;
+  socket_handle.set_socket(transport.release());
+
+  HttpRequestInfo request_info;
+  request_info.method = "GET";
+  request_info.url = GURL("http://localhost");
+
+  scoped_refptr<GrowableIOBuffer> read_buffer(new GrowableIOBuffer);
+  HttpStreamParser parser(
+      &socket_handle, &request_info, read_buffer.get(), BoundNetLog());
+
+  HttpRequestHeaders request_headers;
+  HttpResponseInfo response_info;
+  ASSERT_EQ(OK, parser.SendRequest("GET / HTTP/1.1\r\n", request_headers,
+                                   &response_info, callback.callback()));
+  ASSERT_EQ(OK, parser.ReadResponseHeaders(callback.callback()));
+
+  scoped_refptr<IOBuffer> body_buffer(new IOBuffer(kReadSize));
+  while (!parser.IsResponseBodyComplete()) {
+    ASSERT_LE(0, parser.ReadResponseBody(body_buffer.get(), kReadSize,
+                                         callback.callback()));
+  }
+}
+
+TEST(HttpStreamParserPerfTest, ChunkedResponses) {
+  base::MessageLoopForIO message_loop;
+  const std::string response = ChunkedResponse();
+  std::vector<MockRead> reads = SplitIntoReads(response);
+
+  PerfTimeLogger timer("Http_StreamParser_ChunkedResponses");
+  for (int i = 0; i < kResponses; ++i)
+    ParseResponse(&reads);
+  timer.Done();
+}
+
+// Measures the two scans the parser makes over the data it reads.
+TEST(HttpStreamParserPerfTest, Scanners) {
+  const std::string response = ChunkedResponse();
+  const int end_of_headers =
+      HttpUtil::LocateEndOfHeaders(response.data(), response.size());
+  ASSERT_GT(end_of_headers, 0);
+
+  PerfTimeLogger headers_timer("Http_LocateEndOfHeaders");
+  for (int i = 0; i < kResponses * 10; ++i) {
+    EXPECT_EQ(end_of_headers,
+              HttpUtil::LocateEndOfHeaders(response.data(), response.size()));
+  }
+  headers_timer.Done();
+
+  const std::string body = response.substr(end_of_headers);
+  std::string buffer;
+  PerfTimeLogger chunked_timer("Http_ChunkedDecoder");
+  for (int i = 0; i < kResponses * 10; ++i) {
+    HttpChunkedDecoder decoder;
+    buffer = body;
+    EXPECT_EQ(100 * 100,
+              decoder.FilterBuf(&buffer[0], static_cast<int>(buffer.size())));
+  }
+  chunked_timer.Done();
+}
+
+}  // namespace
+
+}  // namespace net
@@ -271,6 +271,10 @@ TEST(HttpUtilTest, LocateEndOfHeaders) {
     { "foo\nbar\n\njunk", 9 },
     { "foo\nbar\n\r\njunk", 10 },
     { "foo\nbar\r\n\njunk", 10 },
+    { "foo\nbar\n\r\r\n", -1 },
+    { "foo\nbar\r\n\r", -1 },
+    { "foo\nbar\n", -1 },
+    { "", -1 },
   };
   for (size_t i = 0; i < ARRAYSIZE_UNSAFE(tests); ++i) {
     int input_len = static_cast<int>(strlen(tests[i].input));
@@ -279,6 +283,16 @@ TEST(HttpUtilTest, LocateEndOfHeaders) {
   }
 }
 
+// A search which starts right after a LF doesn't see that LF.
+TEST(HttpUtilTest, LocateEndOfHeadersFromOffset) {
+  const char kInput[] = "foo\r\nbar\r\n\r\njunk";
+  const int input_len = static_cast<int>(strlen(kInput));
+  EXPECT_EQ(12, HttpUtil::LocateEndOfHeaders(kInput, input_len, 8));
+  EXPECT_EQ(12, HttpUtil::LocateEndOfHeaders(kInput, input_len, 9));
+  EXPECT_EQ(-1, HttpUtil::LocateEndOfHeaders(kInput, input_len, 10));
+  EXPECT_EQ(-1, HttpUtil::LocateEndOfHeaders(kInput, input_len, input_len));
+}
+
 TEST(HttpUtilTest, AssembleRawHeaders) {
   struct {
     const char* input;  // with '|' representing '\0'
@@ -138,6 +138,8 @@
         'base/host_port_pair.h',
         'base/io_buffer.cc',
         'base/io_buffer.h',
+        'base/io_buffer_pool.cc',
+        'base/io_buffer_pool.h',
         'base/iovec.h',
         'base/ip_endpoint.cc',
         'base/ip_endpoint.h',
@@ -166,6 +168,8 @@
         'base/net_export.h',
         'base/net_log.cc',
         'base/net_log.h',
+        'base/net_log_binary_logger.cc',
+        'base/net_log_binary_logger.h',
         'base/net_log_logger.cc',
         'base/net_log_logger.h',
         'base/net_log_event_type_list.h',
@@ -444,10 +448,14 @@
         'dns/dns_session.h',
         'dns/dns_socket_pool.cc',
         'dns/dns_socket_pool.h',
+        'dns/dns_tcp_connection.cc',
+        'dns/dns_tcp_connection.h',
         'dns/dns_transaction.cc',
         'dns/dns_transaction.h',
         'dns/host_cache.cc',
         'dns/host_cache.h',
+        'dns/host_cache_persistence_manager.cc',
+        'dns/host_cache_persistence_manager.h',
         'dns/host_resolver.cc',
         'dns/host_resolver.h',
         'dns/host_resolver_impl.cc',
@@ -627,6 +635,8 @@
         'http/url_security_manager_win.cc',
         'ocsp/nss_ocsp.cc',
         'ocsp/nss_ocsp.h',
+        'proxy/caching_proxy_resolver.cc',
+        'proxy/caching_proxy_resolver.h',
         'proxy/dhcp_proxy_script_adapter_fetcher_win.cc',
         'proxy/dhcp_proxy_script_adapter_fetcher_win.h',
         'proxy/dhcp_proxy_script_fetcher.cc',
@@ -689,6 +699,8 @@
         'quic/blocked_list.h',
         'quic/congestion_control/available_channel_estimator.cc',
         'quic/congestion_control/available_channel_estimator.h',
+        'quic/congestion_control/bbr_sender.cc',
+        'quic/congestion_control/bbr_sender.h',
         'quic/congestion_control/channel_estimator.cc',
         'quic/congestion_control/channel_estimator.h',
         'quic/congestion_control/cube_root.cc',
@@ -893,6 +905,8 @@
         'socket/ssl_server_socket_nss.cc',
         'socket/ssl_server_socket_nss.h',
         'socket/ssl_server_socket_openssl.cc',
+        'socket/ssl_session_cache_openssl.cc',
+        'socket/ssl_session_cache_openssl.h',
         'socket/ssl_socket.h',
         'socket/stream_listen_socket.cc',
         'socket/stream_listen_socket.h',
@@ -953,6 +967,8 @@
         'spdy/spdy_proxy_client_socket.h',
         'spdy/spdy_read_queue.cc',
         'spdy/spdy_read_queue.h',
+        'spdy/spdy_recv_window_autotuner.cc',
+        'spdy/spdy_recv_window_autotuner.h',
         'spdy/spdy_session.cc',
         'spdy/spdy_session.h',
         'spdy/spdy_session_key.cc',
@@ -1089,6 +1105,10 @@
         'url_request/view_cache_helper.h',
         'websockets/websocket_channel.cc',
         'websockets/websocket_channel.h',
+        'websockets/websocket_deflate_stream.cc',
+        'websockets/websocket_deflate_stream.h',
+        'websockets/websocket_deflater.cc',
+        'websockets/websocket_deflater.h',
         'websockets/websocket_errors.cc',
         'websockets/websocket_errors.h',
         'websockets/websocket_frame.cc',
@@ -1097,6 +1117,8 @@
         'websockets/websocket_frame_parser.h',
         'websockets/websocket_handshake_handler.cc',
         'websockets/websocket_handshake_handler.h',
+        'websockets/websocket_inflater.cc',
+        'websockets/websocket_inflater.h',
         'websockets/websocket_job.cc',
         'websockets/websocket_job.h',
         'websockets/websocket_mux.h',
@@ -1260,6 +1282,8 @@
               'socket/ssl_client_socket_openssl.cc',
               'socket/ssl_client_socket_openssl.h',
               'socket/ssl_server_socket_openssl.cc',
+              'socket/ssl_session_cache_openssl.cc',
+              'socket/ssl_session_cache_openssl.h',
               'ssl/openssl_client_key_store.cc',
               'ssl/openssl_client_key_store.h',
             ],
@@ -1511,12 +1535,14 @@
         'base/gzip_filter_unittest.cc',
         'base/host_mapping_rules_unittest.cc',
         'base/host_port_pair_unittest.cc',
+        'base/io_buffer_pool_unittest.cc',
         'base/ip_endpoint_unittest.cc',
         'base/keygen_handler_unittest.cc',
         'base/mime_sniffer_unittest.cc',
         'base/mime_util_unittest.cc',
         'base/mock_filter_context.cc',
         'base/mock_filter_context.h',
+        'base/net_log_binary_logger_unittest.cc',
         'base/net_log_logger_unittest.cc',
         'base/net_log_unittest.cc',
         'base/net_log_unittest.h',
@@ -1578,6 +1604,7 @@
         'dns/dns_response_unittest.cc',
         'dns/dns_session_unittest.cc',
         'dns/dns_transaction_unittest.cc',
+        'dns/host_cache_persistence_manager_unittest.cc',
         'dns/host_cache_unittest.cc',
         'dns/host_resolver_impl_unittest.cc',
         'dns/mapped_host_resolver_unittest.cc',
@@ -1650,6 +1677,7 @@
         'http/transport_security_state_unittest.cc',
         'http/url_security_manager_unittest.cc',
         'ocsp/nss_ocsp_unittest.cc',
+        'proxy/caching_proxy_resolver_unittest.cc',
         'proxy/dhcp_proxy_script_adapter_fetcher_win_unittest.cc',
         'proxy/dhcp_proxy_script_fetcher_factory_unittest.cc',
         'proxy/dhcp_proxy_script_fetcher_win_unittest.cc',
@@ -1670,6 +1698,7 @@
         'proxy/proxy_service_unittest.cc',
         'quic/blocked_list_test.cc',
         'quic/congestion_control/available_channel_estimator_test.cc',
+        'quic/congestion_control/bbr_sender_test.cc',
         'quic/congestion_control/channel_estimator_test.cc',
         'quic/congestion_control/cube_root_test.cc',
         'quic/congestion_control/cubic_test.cc',
@@ -1686,6 +1715,9 @@
         'quic/congestion_control/quic_congestion_control_test.cc',
         'quic/congestion_control/quic_congestion_manager_test.cc',
         'quic/congestion_control/quic_max_sized_map_test.cc',
+        'quic/congestion_control/send_algorithm_simulator.cc',
+        'quic/congestion_control/send_algorithm_simulator.h',
+        'quic/congestion_control/send_algorithm_simulator_test.cc',
         'quic/congestion_control/tcp_cubic_sender_test.cc',
         'quic/congestion_control/tcp_receiver_test.cc',
         'quic/crypto/aes_128_gcm_12_decrypter_test.cc',
@@ -1781,6 +1813,7 @@
         'socket/ssl_client_socket_pool_unittest.cc',
         'socket/ssl_client_socket_unittest.cc',
         'socket/ssl_server_socket_unittest.cc',
+        'socket/ssl_session_cache_openssl_unittest.cc',
         'socket/tcp_client_socket_unittest.cc',
         'socket/tcp_listen_socket_unittest.cc',
         'socket/tcp_listen_socket_unittest.h',
@@ -1805,6 +1838,7 @@
         'spdy/spdy_protocol_test.cc',
         'spdy/spdy_proxy_client_socket_unittest.cc',
         'spdy/spdy_read_queue_unittest.cc',
+        'spdy/spdy_recv_window_autotuner_unittest.cc',
         'spdy/spdy_session_pool_unittest.cc',
         'spdy/spdy_session_test_util.cc',
         'spdy/spdy_session_test_util.h',
@@ -1855,11 +1889,14 @@
         'url_request/url_request_unittest.cc',
         'url_request/view_cache_helper_unittest.cc',
         'websockets/websocket_channel_test.cc',
+        'websockets/websocket_deflate_stream_unittest.cc',
+        'websockets/websocket_deflater_unittest.cc',
         'websockets/websocket_errors_unittest.cc',
         'websockets/websocket_frame_parser_unittest.cc',
         'websockets/websocket_frame_unittest.cc',
         'websockets/websocket_handshake_handler_unittest.cc',
         'websockets/websocket_handshake_handler_spdy_unittest.cc',
+        'websockets/websocket_inflater_unittest.cc',
         'websockets/websocket_job_unittest.cc',
         'websockets/websocket_net_log_params_unittest.cc',
         'websockets/websocket_throttle_unittest.cc',
@@ -1980,6 +2017,7 @@
               'cert/x509_util_openssl_unittest.cc',
               'quic/test_tools/crypto_test_utils_openssl.cc',
               'socket/ssl_client_socket_openssl_unittest.cc',
+              'socket/ssl_session_cache_openssl_unittest.cc',
               'ssl/openssl_client_key_store_unittest.cc',
             ],
           },
@@ -2150,14 +2188,25 @@
         '../base/base.gyp:base_i18n',
         '../base/base.gyp:test_support_perf',
         '../testing/gtest.gyp:gtest',
+        '../third_party/zlib/zlib.gyp:zlib',
         '../url/url.gyp:url_lib',
         'net',
         'net_test_support',
       ],
       'sources': [
+        'base/gzip_filter_perftest.cc',
+        'base/net_log_perftest.cc',
+        'base/registry_controlled_domains/registry_controlled_domain_perftest.cc',
+        'base/sdch_filter_perftest.cc',
+        'base/upload_data_stream_perftest.cc',
         'cookies/cookie_monster_perftest.cc',
         'disk_cache/disk_cache_perftest.cc',
+        'http/http_response_headers_perftest.cc',
+        'http/http_stream_parser_perftest.cc',
         'proxy/proxy_resolver_perftest.cc',
+        'socket/client_socket_pool_base_perftest.cc',
+        'spdy/spdy_write_queue_perftest.cc',
+        'websockets/websocket_frame_perftest.cc',
       ],
       'conditions': [
         [ 'use_v8_in_net==1', {
@@ -2231,6 +2280,8 @@
         'dns/mock_host_resolver.h',
         'dns/mock_mdns_socket_factory.cc',
         'dns/mock_mdns_socket_factory.h',
+        'dns/test_dns_server.cc',
+        'dns/test_dns_server.h',
         'proxy/mock_proxy_resolver.cc',
         'proxy/mock_proxy_resolver.h',
         'proxy/mock_proxy_script_fetcher.cc',
@@ -2536,6 +2587,17 @@
           # TODO(jschuh): crbug.com/167187 fix size_t to int truncations.
           'msvs_disabled_warnings': [4267, ],
         },
+        {
+          'target_name': 'net_log_binary_to_json',
+          'type': 'executable',
+          'dependencies': [
+            '../base/base.gyp:base',
+            'net',
+          ],
+          'sources': [
+            'tools/net_log_binary_to_json/net_log_binary_to_json.cc',
+          ],
+        },
         {
           'target_name': 'net_watcher',
           'type': 'executable',
@@ -61,6 +61,7 @@ LOCAL_SRC_FILES := \
 	net/base/host_mapping_rules.cc \
 	net/base/host_port_pair.cc \
 	net/base/io_buffer.cc \
+	net/base/io_buffer_pool.cc \
 	net/base/ip_endpoint.cc \
 	net/base/keygen_handler.cc \
 	net/base/keygen_handler_openssl.cc \
@@ -70,6 +71,7 @@ LOCAL_SRC_FILES := \
 	net/base/net_errors.cc \
 	net/base/net_errors_posix.cc \
 	net/base/net_log.cc \
+	net/base/net_log_binary_logger.cc \
 	net/base/net_log_logger.cc \
 	net/base/net_module.cc \
 	net/base/net_util.cc \
@@ -172,8 +174,10 @@ LOCAL_SRC_FILES := \
 	net/dns/dns_response.cc \
 	net/dns/dns_session.cc \
 	net/dns/dns_socket_pool.cc \
+	net/dns/dns_tcp_connection.cc \
 	net/dns/dns_transaction.cc \
 	net/dns/host_cache.cc \
+	net/dns/host_cache_persistence_manager.cc \
 	net/dns/host_resolver.cc \
 	net/dns/host_resolver_impl.cc \
 	net/dns/host_resolver_proc.cc \
@@ -247,6 +251,7 @@ LOCAL_SRC_FILES := \
 	net/http/transport_security_state.cc \
 	net/http/url_security_manager.cc \
 	net/http/url_security_manager_posix.cc \
+	net/proxy/caching_proxy_resolver.cc \
 	net/proxy/dhcp_proxy_script_fetcher.cc \
 	net/proxy/dhcp_proxy_script_fetcher_factory.cc \
 	net/proxy/multi_threaded_proxy_resolver.cc \
@@ -265,6 +270,7 @@ LOCAL_SRC_FILES := \
 	net/proxy/proxy_server.cc \
 	net/proxy/proxy_service.cc \
 	net/quic/congestion_control/available_channel_estimator.cc \
+	net/quic/congestion_control/bbr_sender.cc \
 	net/quic/congestion_control/channel_estimator.cc \
 	net/quic/congestion_control/cube_root.cc \
 	net/quic/congestion_control/cubic.cc \
@@ -358,6 +364,7 @@ LOCAL_SRC_FILES := \
 	net/socket/ssl_client_socket_pool.cc \
 	net/socket/ssl_error_params.cc \
 	net/socket/ssl_server_socket_openssl.cc \
+	net/socket/ssl_session_cache_openssl.cc \
 	net/socket/stream_listen_socket.cc \
 	net/socket/stream_socket.cc \
 	net/socket/tcp_client_socket.cc \
@@ -384,6 +391,7 @@ LOCAL_SRC_FILES := \
 	net/spdy/spdy_protocol.cc \
 	net/spdy/spdy_proxy_client_socket.cc \
 	net/spdy/spdy_read_queue.cc \
+	net/spdy/spdy_recv_window_autotuner.cc \
 	net/spdy/spdy_session.cc \
 	net/spdy/spdy_session_key.cc \
 	net/spdy/spdy_session_pool.cc \
@@ -440,10 +448,13 @@ LOCAL_SRC_FILES := \
 	net/url_request/url_request_throttler_manager.cc \
 	net/url_request/view_cache_helper.cc \
 	net/websockets/websocket_channel.cc \
+	net/websockets/websocket_deflate_stream.cc \
+	net/websockets/websocket_deflater.cc \
 	net/websockets/websocket_errors.cc \
 	net/websockets/websocket_frame.cc \
 	net/websockets/websocket_frame_parser.cc \
 	net/websockets/websocket_handshake_handler.cc \
+	net/websockets/websocket_inflater.cc \
 	net/websockets/websocket_job.cc \
 	net/websockets/websocket_net_log_params.cc \
 	net/websockets/websocket_stream.cc \
@@ -0,0 +1,154 @@
+// Copyright 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "net/proxy/caching_proxy_resolver.h"
+
+#include "base/bind.h"
+#include "base/metrics/histogram.h"
+#include "base/stl_util.h"
+#include "base/strings/string_number_conversions.h"
+#include "net/base/net_errors.h"
+
+namespace net {
+
+// A request outstanding in the wrapped resolver.
+struct CachingProxyResolver::Request {
+  Request(const std::string& cache_key,
+          ProxyInfo* results,
+          const CompletionCallback& callback)
+      : cache_key(cache_key),
+        results(results),
+        callback(callback),
+        handle(NULL),
+        cacheable(!cache_key.empty()) {}
+
+  const std::string cache_key;
+  ProxyInfo* const results;
+  const CompletionCallback callback;
+  RequestHandle handle;
+  // False if the results for the URL are not cached, or once the PAC script
+  // the request runs has been replaced.
+  bool cacheable;
+};
+
+CachingProxyResolver::CachingProxyResolver(ProxyResolver* resolver,
+                                           size_t max_entries,
+                                           base::TimeDelta ttl)
+    : ProxyResolver(resolver->expects_pac_bytes()),
+      resolver_(resolver),
+      ttl_(ttl),
+      cache_(max_entries) {
+}
+
+CachingProxyResolver::~CachingProxyResolver() {
+  // Destroying |resolver_| cancels its requests.
+  resolver_.reset();
+  STLDeleteElements(&pending_requests_);
+}
+
+int CachingProxyResolver::GetProxyForURL(const GURL& url,
+                                         ProxyInfo* results,
+                                         const CompletionCallback& callback,
+                                         RequestHandle* request,
+                                         const BoundNetLog& net_log) {
+  DCHECK(CalledOnValidThread());
+
+  const std::string cache_key = GetCacheKey(url);
+  if (!cache_key.empty()) {
+    const ProxyInfo* cached_results =
+        cache_.Get(cache_key, base::TimeTicks::Now());
+    UMA_HISTOGRAM_BOOLEAN("Net.ProxyResolver.ResultCacheHit",
+                          cached_results != NULL);
+    if (cached_results) {
+      *results = *cached_results;
+      return OK;
+    }
+  }
+
+  Request* pending_request = new Request(cache_key, results, callback);
+  int rv = resolver_->GetProxyForURL(
+      url, results,
+      base::Bind(&CachingProxyResolver::OnRequestComplete,
+                 base::Unretained(this), pending_request),
+      &pending_request->handle, net_log);
+  if (rv != ERR_IO_PENDING) {
+    if (rv == OK && pending_request->cacheable)
+      SaveResults(cache_key, *results);
+    delete pending_request;
+    return rv;
+  }
+
+  pending_requests_.insert(pending_request);
+  if (request)
+    *request = pending_request;
+  return ERR_IO_PENDING;
+}
+
+void CachingProxyResolver::CancelRequest(RequestHandle request) {
+  DCHECK(CalledOnValidThread());
+  Request* pending_request = reinterpret_cast<Request*>(request);
+  DCHECK_EQ(1U, pending_requests_.count(pending_request));
+  resolver_->CancelRequest(pending_request->handle);
+  pending_requests_.erase(pending_request);
+  delete pending_request;
+}
+
+LoadState CachingProxyResolver::GetLoadState(RequestHandle request) const {
+  DCHECK(CalledOnValidThread());
+  Request* pending_request = reinterpret_cast<Request*>(request);
+  return resolver_->GetLoadState(pending_request->handle);
+}
+
+void CachingProxyResolver::CancelSetPacScript() {
+  DCHECK(CalledOnValidThread());
+  resolver_->CancelSetPacScript();
+}
+
+void CachingProxyResolver::PurgeMemory() {
+  DCHECK(CalledOnValidThread());
+  cache_.Clear();
+  resolver_->PurgeMemory();
+}
+
+int CachingProxyResolver::SetPacScript(
+    const scoped_refptr<ProxyResolverScriptData>& script_data,
+    const CompletionCallback& callback) {
+  DCHECK(CalledOnValidThread());
+  cache_.Clear();
+  for (std::set<Request*>::iterator it = pending_requests_.begin();
+       it != pending_requests_.end(); ++it) {
+    (*it)->cacheable = false;
+  }
+  return resolver_->SetPacScript(script_data, callback);
+}
+
+// static
+std::string CachingProxyResolver::GetCacheKey(const GURL& url) {
+  // The scheme, host and port, which PAC scripts commonly look at, but not
+  // the path.  Invalid URLs, and URLs without a standard host, would all get
+  // the same key, so their results are not cached.
+  if (!url.is_valid() || !url.IsStandard() || !url.has_host())
+    return std::string();
+  return url.scheme() + "://" + url.host() + ":" +
+      base::IntToString(url.EffectiveIntPort());
+}
+
+void CachingProxyResolver::OnRequestComplete(Request* request, int result) {
+  DCHECK(CalledOnValidThread());
+  DCHECK_EQ(1U, pending_requests_.count(request));
+  pending_requests_.erase(request);
+  scoped_ptr<Request> scoped_request(request);
+
+  if (result == OK && request->cacheable)
+    SaveResults(request->cache_key, *request->results);
+  request->callback.Run(result);
+}
+
+void CachingProxyResolver::SaveResults(const std::string& cache_key,
+                                       const ProxyInfo& results) {
+  base::TimeTicks now = base::TimeTicks::Now();
+  cache_.Put(cache_key, results, now, now + ttl_);
+}
+
+}  // namespace net
@@ -0,0 +1,84 @@
+// Copyright 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef NET_PROXY_CACHING_PROXY_RESOLVER_H_
+#define NET_PROXY_CACHING_PROXY_RESOLVER_H_
+
+#include <functional>
+#include <set>
+#include <string>
+
+#include "base/basictypes.h"
+#include "base/compiler_specific.h"
+#include "base/memory/scoped_ptr.h"
+#include "base/threading/non_thread_safe.h"
+#include "base/time/time.h"
+#include "net/base/expiring_cache.h"
+#include "net/base/net_export.h"
+#include "net/proxy/proxy_info.h"
+#include "net/proxy/proxy_resolver.h"
+
+namespace net {
+
+// CachingProxyResolver is a ProxyResolver that remembers the results of
+// another ProxyResolver per scheme, host and port, so that the PAC script is
+// not executed again for further URLs of a host it already resolved.
+//
+// This is only correct for PAC scripts that are deterministic per host: their
+// FindProxyForURL() must not look at the path of the URL, nor depend on state
+// that changes between calls. Since results may depend on DNS, they are
+// forgotten after a time to live, and whenever the PAC script is set. Errors
+// are not cached.
+class NET_EXPORT_PRIVATE CachingProxyResolver
+    : public ProxyResolver,
+      NON_EXPORTED_BASE(public base::NonThreadSafe) {
+ public:
+  // Takes ownership of |resolver|. Holds up to |max_entries| results, each for
+  // |ttl|.
+  CachingProxyResolver(ProxyResolver* resolver,
+                       size_t max_entries,
+                       base::TimeDelta ttl);
+  virtual ~CachingProxyResolver();
+
+  // ProxyResolver implementation:
+  virtual int GetProxyForURL(const GURL& url,
+                             ProxyInfo* results,
+                             const CompletionCallback& callback,
+                             RequestHandle* request,
+                             const BoundNetLog& net_log) OVERRIDE;
+  virtual void CancelRequest(RequestHandle request) OVERRIDE;
+  virtual LoadState GetLoadState(RequestHandle request) const OVERRIDE;
+  virtual void CancelSetPacScript() OVERRIDE;
+  virtual void PurgeMemory() OVERRIDE;
+  virtual int SetPacScript(
+      const scoped_refptr<ProxyResolverScriptData>& script_data,
+      const CompletionCallback& callback) OVERRIDE;
+
+ private:
+  struct Request;
+  typedef ExpiringCache<std::string, ProxyInfo, base::TimeTicks,
+                        std::less<base::TimeTicks> > ResultCache;
+
+  // Returns the key of the results for |url| in |cache_|, or an empty string
+  // if the results for |url| are not cached.
+  static std::string GetCacheKey(const GURL& url);
+
+  void OnRequestComplete(Request* request, int result);
+
+  // Adds |results| to |cache_| under |cache_key|.
+  void SaveResults(const std::string& cache_key, const ProxyInfo& results);
+
+  scoped_ptr<ProxyResolver> resolver_;
+  const base::TimeDelta ttl_;
+  ResultCache cache_;
+
+  // The requests outstanding in |resolver_|. Owned.
+  std::set<Request*> pending_requests_;
+
+  DISALLOW_COPY_AND_ASSIGN(CachingProxyResolver);
+};
+
+}  // namespace net
+
+#endif  // NET_PROXY_CACHING_PROXY_RESOLVER_H_
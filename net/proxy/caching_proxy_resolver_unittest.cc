@@ -0,0 +1,159 @@
+// Copyright 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "net/proxy/caching_proxy_resolver.h"
+
+#include "base/strings/utf_string_conversions.h"
+#include "net/base/net_errors.h"
+#include "net/base/net_log.h"
+#include "net/base/test_completion_callback.h"
+#include "net/proxy/mock_proxy_resolver.h"
+#include "net/proxy/proxy_info.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+namespace net {
+
+namespace {
+
+const size_t kMaxEntries = 2;
+
+class CachingProxyResolverTest : public testing::Test {
+ public:
+  CachingProxyResolverTest()
+      : mock_(new MockAsyncProxyResolver),
+        resolver_(mock_, kMaxEntries, base::TimeDelta::FromHours(1)) {}
+
+ protected:
+  // Starts a request for |url|, which must miss the cache, and completes it
+  // in the mock resolver with |pac_string| as the result.
+  void ResolveInMock(const char* url, const char* pac_string) {
+    ProxyInfo results;
+    TestCompletionCallback callback;
+    ProxyResolver::RequestHandle request;
+    EXPECT_EQ(ERR_IO_PENDING,
+              resolver_.GetProxyForURL(GURL(url), &results,
+                                       callback.callback(), &request,
+                                       BoundNetLog()));
+    ASSERT_EQ(1U, mock_->pending_requests().size());
+    mock_->pending_requests()[0]->results()->UsePacString(pac_string);
+    mock_->pending_requests()[0]->CompleteNow(OK);
+    EXPECT_EQ(OK, callback.WaitForResult());
+    EXPECT_EQ(pac_string, results.ToPacString());
+  }
+
+  MockAsyncProxyResolver* mock_;  // Owned by |resolver_|.
+  CachingProxyResolver resolver_;
+};
+
+TEST_F(CachingProxyResolverTest, ReusesResultsOfSameOrigin) {
+  ResolveInMock("http://www.google.com/", "PROXY foopy:80");
+
+  // A different path of the same origin is served from the cache.
+  ProxyInfo results;
+  TestCompletionCallback callback;
+  EXPECT_EQ(OK, resolver_.GetProxyForURL(GURL("http://www.google.com/a?b"),
+                                         &results, callback.callback(), NULL,
+                                         BoundNetLog()));
+  EXPECT_EQ("PROXY foopy:80", results.ToPacString());
+  EXPECT_TRUE(mock_->pending_requests().empty());
+
+  // Another scheme, or another port, is a different origin.
+  ResolveInMock("https://www.google.com/", "DIRECT");
+  ResolveInMock("http://www.google.com:8080/", "PROXY foopy:8080");
+}
+
+TEST_F(CachingProxyResolverTest, DoesNotCacheURLsWithoutStandardHost) {
+  // These URLs have no origin, and must not share results.
+  const char* const kUrls[] = {
+    "not a url",
+    "data:text/plain,foo",
+    "file:///etc/hosts",
+  };
+  for (size_t i = 0; i < arraysize(kUrls); ++i) {
+    ResolveInMock(kUrls[i], "PROXY foopy:80");
+    ResolveInMock(kUrls[i], "DIRECT");
+  }
+}
+
+TEST_F(CachingProxyResolverTest, DoesNotCacheErrors) {
+  ProxyInfo results;
+  TestCompletionCallback callback;
+  ProxyResolver::RequestHandle request;
+  EXPECT_EQ(ERR_IO_PENDING,
+            resolver_.GetProxyForURL(GURL("http://www.google.com/"), &results,
+                                     callback.callback(), &request,
+                                     BoundNetLog()));
+  ASSERT_EQ(1U, mock_->pending_requests().size());
+  mock_->pending_requests()[0]->CompleteNow(ERR_PAC_SCRIPT_FAILED);
+  EXPECT_EQ(ERR_PAC_SCRIPT_FAILED, callback.WaitForResult());
+
+  ResolveInMock("http://www.google.com/", "DIRECT");
+}
+
+TEST_F(CachingProxyResolverTest, CancelRequest) {
+  ProxyInfo results;
+  TestCompletionCallback callback;
+  ProxyResolver::RequestHandle request;
+  EXPECT_EQ(ERR_IO_PENDING,
+            resolver_.GetProxyForURL(GURL("http://www.google.com/"), &results,
+                                     callback.callback(), &request,
+                                     BoundNetLog()));
+  EXPECT_EQ(LOAD_STATE_RESOLVING_PROXY_FOR_URL,
+            resolver_.GetLoadState(request));
+  resolver_.CancelRequest(request);
+  EXPECT_TRUE(mock_->pending_requests().empty());
+  EXPECT_EQ(1U, mock_->cancelled_requests().size());
+  EXPECT_FALSE(callback.have_result());
+
+  ResolveInMock("http://www.google.com/", "DIRECT");
+}
+
+TEST_F(CachingProxyResolverTest, BoundsNumberOfEntries) {
+  ResolveInMock("http://a.com/", "PROXY a:80");
+  ResolveInMock("http://b.com/", "PROXY b:80");
+  ResolveInMock("http://c.com/", "PROXY c:80");
+
+  ProxyInfo results;
+  TestCompletionCallback callback;
+  EXPECT_EQ(OK, resolver_.GetProxyForURL(GURL("http://c.com/"), &results,
+                                         callback.callback(), NULL,
+                                         BoundNetLog()));
+  EXPECT_EQ("PROXY c:80", results.ToPacString());
+  // Making room for "c" evicted "a".
+  ResolveInMock("http://a.com/", "PROXY a:80");
+}
+
+TEST_F(CachingProxyResolverTest, SetPacScriptClearsCache) {
+  ResolveInMock("http://www.google.com/", "PROXY foopy:80");
+
+  // A request that is outstanding while the script changes is not cached.
+  ProxyInfo results;
+  TestCompletionCallback callback;
+  ProxyResolver::RequestHandle request;
+  EXPECT_EQ(ERR_IO_PENDING,
+            resolver_.GetProxyForURL(GURL("http://www.example.com/"),
+                                     &results, callback.callback(), &request,
+                                     BoundNetLog()));
+
+  TestCompletionCallback set_script_callback;
+  EXPECT_EQ(ERR_IO_PENDING,
+            resolver_.SetPacScript(
+                ProxyResolverScriptData::FromUTF16(ASCIIToUTF16("script")),
+                set_script_callback.callback()));
+  mock_->pending_set_pac_script_request()->CompleteNow(OK);
+  EXPECT_EQ(OK, set_script_callback.WaitForResult());
+
+  ASSERT_EQ(1U, mock_->pending_requests().size());
+  mock_->pending_requests()[0]->results()->UseDirect();
+  mock_->pending_requests()[0]->CompleteNow(OK);
+  EXPECT_EQ(OK, callback.WaitForResult());
+
+  ResolveInMock("http://www.google.com/", "DIRECT");
+  ResolveInMock("http://www.example.com/", "DIRECT");
+}
+
+}  // namespace
+
+}  // namespace net
@@ -2,14 +2,19 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <string>
+#include <vector>
+
 #include "base/base_paths.h"
 #include "base/compiler_specific.h"
 #include "base/file_util.h"
 #include "base/path_service.h"
 #include "base/perftimer.h"
 #include "base/strings/string_util.h"
+#include "base/strings/stringprintf.h"
 #include "net/base/net_errors.h"
 #include "net/dns/mock_host_resolver.h"
+#include "net/proxy/caching_proxy_resolver.h"
 #include "net/proxy/proxy_info.h"
 #include "net/proxy/proxy_resolver_v8.h"
 #include "net/test/spawned_test_server/spawned_test_server.h"
@@ -76,6 +81,24 @@ int PacPerfTest::NumQueries() const {
 // The number of URLs to resolve when testing a PAC script.
 const int kNumIterations = 500;
 
+// Reads the PAC script |script_name| from disk into |file_contents|.
+void ReadPacScript(const std::string& script_name,
+                   std::string* file_contents) {
+  base::FilePath path;
+  PathService::Get(base::DIR_SOURCE_ROOT, &path);
+  path = path.AppendASCII("net");
+  path = path.AppendASCII("data");
+  path = path.AppendASCII("proxy_resolver_perftest");
+  path = path.AppendASCII(script_name);
+
+  // Try to read the file from disk.
+  bool ok = file_util::ReadFileToString(path, file_contents);
+
+  // If we can't load the file from disk, something is misconfigured.
+  LOG_IF(ERROR, !ok) << "Failed to read file: " << path.value();
+  ASSERT_TRUE(ok);
+}
+
 // Helper class to run through all the performance tests using the specified
 // proxy resolver implementation.
 class PacPerfSuiteRunner {
@@ -154,20 +177,8 @@ class PacPerfSuiteRunner {
 
   // Read the PAC script from disk and initialize the proxy resolver with it.
   void LoadPacScriptIntoResolver(const std::string& script_name) {
-    base::FilePath path;
-    PathService::Get(base::DIR_SOURCE_ROOT, &path);
-    path = path.AppendASCII("net");
-    path = path.AppendASCII("data");
-    path = path.AppendASCII("proxy_resolver_perftest");
-    path = path.AppendASCII(script_name);
-
-    // Try to read the file from disk.
     std::string file_contents;
-    bool ok = file_util::ReadFileToString(path, &file_contents);
-
-    // If we can't load the file from disk, something is misconfigured.
-    LOG_IF(ERROR, !ok) << "Failed to read file: " << path.value();
-    ASSERT_TRUE(ok);
+    ASSERT_NO_FATAL_FAILURE(ReadPacScript(script_name, &file_contents));
 
     // Load the PAC script into the ProxyResolver.
     int rv = resolver_->SetPacScript(
@@ -227,3 +238,91 @@ TEST(ProxyResolverPerfTest, ProxyResolverV8) {
   PacPerfSuiteRunner runner(&resolver, "ProxyResolverV8");
   runner.RunAllTests();
 }
+
+// The number of URLs, and of distinct hosts among them, resolved by the
+// large URL set test. A page load typically fetches many resources from a
+// few hosts.
+const int kNumLargeSetUrls = 5000;
+const int kNumLargeSetHosts = 250;
+
+// The hosts of the large URL set are "<prefix><number><suffix>", using these
+// patterns in turn so that every branch of per-host.pac is taken.
+struct HostPattern {
+  const char* prefix;
+  const char* suffix;
+};
+
+const HostPattern kHostPatterns[] = {
+  {"server", ""},
+  {"www.host", ".intranet.example"},
+  {"static", ".example.com"},
+  {"www", ".example.com"},
+  {"www.site", ".org"},
+};
+
+// Fills |urls| with |kNumLargeSetUrls| URLs spread over |kNumLargeSetHosts|
+// hosts.
+void GenerateLargeUrlSet(std::vector<GURL>* urls) {
+  for (int i = 0; i < kNumLargeSetUrls; ++i) {
+    int host = i % kNumLargeSetHosts;
+    int pattern = host % arraysize(kHostPatterns);
+    urls->push_back(GURL(base::StringPrintf(
+        "http://%s%d%s/path/%d/resource.js?q=%d",
+        kHostPatterns[pattern].prefix, host, kHostPatterns[pattern].suffix,
+        i / kNumLargeSetHosts, i)));
+  }
+}
+
+// Resolves each of |urls| with |resolver|, logging the time taken as
+// |perf_test_name|, and appends the results to |results|.
+void ResolveUrls(net::ProxyResolver* resolver,
+                 const std::string& perf_test_name,
+                 const std::vector<GURL>& urls,
+                 std::vector<std::string>* results) {
+  PerfTimeLogger timer(perf_test_name.c_str());
+  for (size_t i = 0; i < urls.size(); ++i) {
+    net::ProxyInfo proxy_info;
+    int result = resolver->GetProxyForURL(
+        urls[i], &proxy_info, net::CompletionCallback(), NULL,
+        net::BoundNetLog());
+    ASSERT_EQ(net::OK, result);
+    results->push_back(proxy_info.ToPacString());
+  }
+  timer.Done();
+}
+
+// Compares executing the PAC script for every URL of a large set with
+// remembering its results per origin.
+TEST(ProxyResolverPerfTest, ProxyResolverV8LargeUrlSet) {
+  // This has to be done on the main thread.
+  net::ProxyResolverV8::RememberDefaultIsolate();
+
+  std::string file_contents;
+  ASSERT_NO_FATAL_FAILURE(ReadPacScript("per-host.pac", &file_contents));
+  scoped_refptr<net::ProxyResolverScriptData> script_data =
+      net::ProxyResolverScriptData::FromUTF8(file_contents);
+
+  std::vector<GURL> urls;
+  GenerateLargeUrlSet(&urls);
+
+  MockJSBindings js_bindings;
+  net::ProxyResolverV8 resolver;
+  resolver.set_js_bindings(&js_bindings);
+  EXPECT_EQ(net::OK,
+            resolver.SetPacScript(script_data, net::CompletionCallback()));
+  std::vector<std::string> expected_results;
+  ResolveUrls(&resolver, "ProxyResolverV8_per-host.pac", urls,
+              &expected_results);
+
+  net::ProxyResolverV8* caching_v8_resolver = new net::ProxyResolverV8;
+  caching_v8_resolver->set_js_bindings(&js_bindings);
+  net::CachingProxyResolver caching_resolver(
+      caching_v8_resolver, kNumLargeSetHosts, base::TimeDelta::FromMinutes(5));
+  EXPECT_EQ(net::OK, caching_resolver.SetPacScript(script_data,
+                                                   net::CompletionCallback()));
+  std::vector<std::string> results;
+  ResolveUrls(&caching_resolver, "CachingProxyResolverV8_per-host.pac", urls,
+              &results);
+
+  EXPECT_EQ(expected_results, results);
+}
@@ -4,7 +4,10 @@
 
 #include "net/proxy/proxy_resolver_v8_tracing.h"
 
+#include <algorithm>
+
 #include "base/bind.h"
+#include "base/memory/scoped_vector.h"
 #include "base/message_loop/message_loop_proxy.h"
 #include "base/metrics/histogram.h"
 #include "base/strings/stringprintf.h"
@@ -38,6 +41,11 @@
 // issues a dnsResolve() for a yet unresolved hostname, the Javascript
 // execution is "aborted", and then re-started once the DNS result is
 // known.
+//
+// To avoid paying one restart per DNS dependency on every request, the DNS
+// operations of the last successful execution for a host are remembered.
+// The next request for that host resolves all of them in parallel before the
+// script is first executed, so that it usually runs to completion at once.
 namespace net {
 
 namespace {
@@ -54,6 +62,9 @@ const size_t kMaxUniqueResolveDnsPerExec = 20;
 // hit this. (In fact normal scripts should not even have alerts() or errors).
 const size_t kMaxAlertsAndErrorsBytes = 2048;
 
+// Number of hosts for which the DNS trace of the script is remembered.
+const size_t kMaxDnsTraces = 100;
+
 // Returns event parameters for a PAC error message (line number + message).
 base::Value* NetLogErrorCallback(int line_number,
                                  const base::string16* message,
@@ -125,6 +136,19 @@ class ProxyResolverV8Tracing::Job
     base::string16 message;
   };
 
+  // A DNS operation of the previous execution for the same host, resolved
+  // before executing the script.
+  struct DnsPrefetch {
+    DnsPrefetch(const std::string& host, ResolveDnsOperation op)
+        : host(host), op(op), request(NULL) {}
+
+    const std::string host;
+    const ResolveDnsOperation op;
+    AddressList addresses;
+    // The outstanding request in the HostResolver, or NULL.
+    HostResolver::RequestHandle request;
+  };
+
   virtual ~Job();
 
   void CheckIsOnWorkerThread() const;
@@ -148,6 +172,11 @@ class ProxyResolverV8Tracing::Job
   void Start(Operation op, bool blocking_dns,
              const CompletionCallback& callback);
 
+  // Starts resolving the DNS trace saved for the host of |url_|. Returns true
+  // if the execution must wait for OnDnsPrefetchComplete().
+  bool StartDnsPrefetches();
+  void OnDnsPrefetchComplete(DnsPrefetch* prefetch, int result);
+
   void ExecuteBlocking();
   void ExecuteNonBlocking();
   int ExecuteProxyResolver();
@@ -274,6 +303,10 @@ class ProxyResolverV8Tracing::Job
   // Number of calls made to ResolveDns() by the PREVIOUS execution.
   int last_num_dns_;
 
+  // The unique DNS operations made by this execution. Once the job completes
+  // it is read on the origin thread.
+  DnsTrace dns_trace_;
+
   // Whether the current execution needs to be restarted in blocking mode.
   bool should_restart_with_blocking_dns_;
 
@@ -299,6 +332,14 @@ class ProxyResolverV8Tracing::Job
   // Used exclusively on the origin thread.
   AddressList pending_dns_addresses_;
 
+  // ---------------------------------------------------------------------------
+  // State for DNS prefetches.
+  // ---------------------------------------------------------------------------
+  // Used exclusively on the origin thread, before the first execution.
+
+  ScopedVector<DnsPrefetch> dns_prefetches_;
+  size_t num_pending_dns_prefetches_;
+
   // ---------------------------------------------------------------------------
   // Metrics for histograms
   // ---------------------------------------------------------------------------
@@ -356,6 +397,7 @@ ProxyResolverV8Tracing::Job::Job(ProxyResolverV8Tracing* parent)
       event_(true, false),
       last_num_dns_(0),
       pending_dns_(NULL),
+      num_pending_dns_prefetches_(0),
       metrics_num_executions_(0),
       metrics_num_unique_dns_(0),
       metrics_num_alerts_(0),
@@ -420,6 +462,14 @@ void ProxyResolverV8Tracing::Job::Cancel() {
     pending_dns_ = NULL;
   }
 
+  for (size_t i = 0; i < dns_prefetches_.size(); ++i) {
+    if (dns_prefetches_[i]->request) {
+      host_resolver()->CancelRequest(dns_prefetches_[i]->request);
+      dns_prefetches_[i]->request = NULL;
+    }
+  }
+  num_pending_dns_prefetches_ = 0;
+
   // The worker thread might be blocked waiting for DNS.
   event_.Signal();
 
@@ -429,7 +479,7 @@ void ProxyResolverV8Tracing::Job::Cancel() {
 LoadState ProxyResolverV8Tracing::Job::GetLoadState() const {
   CheckIsOnOriginThread();
 
-  if (pending_dns_)
+  if (pending_dns_ || num_pending_dns_prefetches_ > 0)
     return LOAD_STATE_RESOLVING_HOST_IN_PROXY_SCRIPT;
 
   return LOAD_STATE_RESOLVING_PROXY_FOR_URL;
@@ -437,6 +487,7 @@ LoadState ProxyResolverV8Tracing::Job::GetLoadState() const {
 
 ProxyResolverV8Tracing::Job::~Job() {
   DCHECK(!pending_dns_);
+  DCHECK_EQ(0U, num_pending_dns_prefetches_);
   DCHECK(callback_.is_null());
 }
 
@@ -509,6 +560,11 @@ void ProxyResolverV8Tracing::Job::NotifyCallerOnOriginLoop(int result) {
   if (operation_ == GET_PROXY_FOR_URL) {
     RecordMetrics();
     *user_results_ = results_;
+
+    // The DNS trace of an execution that fell back to blocking mode may be
+    // wrong, so only that of a successful non-blocking execution is kept.
+    if (!blocking_dns_ && result == OK && !dns_trace_.empty())
+      parent_->dns_traces_.Put(url_.host(), dns_trace_);
   }
 
   // There is only ever 1 outstanding SET_PAC_SCRIPT job. It needs to be
@@ -614,11 +670,82 @@ void ProxyResolverV8Tracing::Job::Start(Operation op, bool blocking_dns,
 
   owned_self_reference_ = this;
 
+  if (op == GET_PROXY_FOR_URL && !blocking_dns_ && StartDnsPrefetches())
+    return;  // Execution is posted once the prefetches complete.
+
   worker_loop()->PostTask(FROM_HERE,
       blocking_dns_ ? base::Bind(&Job::ExecuteBlocking, this) :
                       base::Bind(&Job::ExecuteNonBlocking, this));
 }
 
+bool ProxyResolverV8Tracing::Job::StartDnsPrefetches() {
+  CheckIsOnOriginThread();
+  DCHECK(dns_prefetches_.empty());
+
+  DnsTraceCache::iterator it = parent_->dns_traces_.Get(url_.host());
+  if (it == parent_->dns_traces_.end())
+    return false;
+
+  const DnsTrace& trace = it->second;
+  for (size_t i = 0; i < trace.size(); ++i) {
+    DnsPrefetch* prefetch = new DnsPrefetch(
+        trace[i].second, static_cast<ResolveDnsOperation>(trace[i].first));
+    dns_prefetches_.push_back(prefetch);
+
+    HostResolver::RequestHandle dns_request = NULL;
+    int result = host_resolver()->Resolve(
+        MakeDnsRequestInfo(prefetch->host, prefetch->op),
+        &prefetch->addresses,
+        base::Bind(&Job::OnDnsPrefetchComplete, this, prefetch),
+        &dns_request,
+        bound_net_log_);
+
+    // As in DoDnsOperation(), the request may have been cancelled as a
+    // side-effect of calling into the HostResolver.
+    if (cancelled_.IsSet()) {
+      if (result == ERR_IO_PENDING)
+        host_resolver()->CancelRequest(dns_request);
+      return true;
+    }
+
+    if (result == ERR_IO_PENDING) {
+      DCHECK(dns_request);
+      prefetch->request = dns_request;
+      num_pending_dns_prefetches_++;
+    } else {
+      SaveDnsToLocalCache(prefetch->host, prefetch->op, result,
+                          prefetch->addresses);
+    }
+  }
+
+  if (num_pending_dns_prefetches_ > 0)
+    return true;
+  dns_prefetches_.clear();
+  return false;
+}
+
+void ProxyResolverV8Tracing::Job::OnDnsPrefetchComplete(DnsPrefetch* prefetch,
+                                                        int result) {
+  CheckIsOnOriginThread();
+  DCHECK(!cancelled_.IsSet());
+  DCHECK(prefetch->request);
+  DCHECK_GT(num_pending_dns_prefetches_, 0U);
+
+  prefetch->request = NULL;
+  // The script has not started executing yet, so the worker thread does not
+  // read |dns_cache_| concurrently.
+  SaveDnsToLocalCache(prefetch->host, prefetch->op, result,
+                      prefetch->addresses);
+
+  if (--num_pending_dns_prefetches_ > 0)
+    return;
+
+  dns_prefetches_.clear();
+  metrics_dns_total_time_ += base::TimeTicks::Now() - metrics_start_time_;
+  worker_loop()->PostTask(FROM_HERE,
+                          base::Bind(&Job::ExecuteNonBlocking, this));
+}
+
 void ProxyResolverV8Tracing::Job::ExecuteBlocking() {
   CheckIsOnWorkerThread();
   DCHECK(blocking_dns_);
@@ -642,6 +769,7 @@ void ProxyResolverV8Tracing::Job::ExecuteNonBlocking() {
   alerts_and_errors_.clear();
   alerts_and_errors_byte_cost_ = 0;
   should_restart_with_blocking_dns_ = false;
+  dns_trace_.clear();
 
   int result = ExecuteProxyResolver();
 
@@ -769,6 +897,13 @@ bool ProxyResolverV8Tracing::Job::ResolveDnsNonBlocking(const std::string& host,
 
   num_dns_ += 1;
 
+  DnsTrace::value_type trace_entry(op, host);
+  if (dns_trace_.size() < kMaxUniqueResolveDnsPerExec &&
+      std::find(dns_trace_.begin(), dns_trace_.end(), trace_entry) ==
+          dns_trace_.end()) {
+    dns_trace_.push_back(trace_entry);
+  }
+
   // Check if the DNS result for this host has already been cached.
   bool rv;
   if (GetDnsFromLocalCache(host, op, output, &rv)) {
@@ -1096,7 +1231,8 @@ ProxyResolverV8Tracing::ProxyResolverV8Tracing(
       host_resolver_(host_resolver),
       error_observer_(error_observer),
       net_log_(net_log),
-      num_outstanding_callbacks_(0) {
+      num_outstanding_callbacks_(0),
+      dns_traces_(kMaxDnsTraces) {
   DCHECK(host_resolver);
   // Start up the thread.
   thread_.reset(new base::Thread("Proxy resolver"));
@@ -1172,6 +1308,9 @@ int ProxyResolverV8Tracing::SetPacScript(
   DCHECK(!set_pac_script_job_.get());
   CHECK_EQ(0, num_outstanding_callbacks_);
 
+  // The traces of the previous script do not predict the DNS of this one.
+  dns_traces_.Clear();
+
   set_pac_script_job_ = new Job(this);
   set_pac_script_job_->StartSetPacScript(script_data, callback);
 
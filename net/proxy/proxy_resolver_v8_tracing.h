@@ -5,7 +5,12 @@
 #ifndef NET_PROXY_PROXY_RESOLVER_V8_TRACING_H_
 #define NET_PROXY_PROXY_RESOLVER_V8_TRACING_H_
 
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "base/basictypes.h"
+#include "base/containers/mru_cache.h"
 #include "base/memory/ref_counted.h"
 #include "base/memory/scoped_ptr.h"
 #include "base/threading/non_thread_safe.h"
@@ -61,6 +66,11 @@ class NET_EXPORT_PRIVATE ProxyResolverV8Tracing
  private:
   class Job;
 
+  // The DNS operations made by an execution of the script, as pairs of
+  // ResolveDnsOperation and host, in the order they were first made.
+  typedef std::vector<std::pair<int, std::string> > DnsTrace;
+  typedef base::MRUCache<std::string, DnsTrace> DnsTraceCache;
+
   // The worker thread on which the ProxyResolverV8 will be run.
   scoped_ptr<base::Thread> thread_;
   scoped_ptr<ProxyResolverV8> v8_resolver_;
@@ -77,6 +87,13 @@ class NET_EXPORT_PRIVATE ProxyResolverV8Tracing
   // The number of outstanding (non-cancelled) jobs.
   int num_outstanding_callbacks_;
 
+  // The DNS trace of the last successful non-blocking execution of the script
+  // for each URL host. Since the script is modeled as deterministic, the next
+  // request of the same host is likely to need the same DNS results, so they
+  // are all resolved in parallel before executing it, rather than one per
+  // restart. Used exclusively on the origin thread.
+  DnsTraceCache dns_traces_;
+
   DISALLOW_COPY_AND_ASSIGN(ProxyResolverV8Tracing);
 };
 
@@ -404,6 +404,63 @@ TEST_F(ProxyResolverV8TracingTest, DnsChecksCache) {
   EXPECT_EQ(0u, request_log.GetSize());
 }
 
+// Tests that the DNS dependencies seen for a host are resolved in parallel
+// before executing the script for the next request of that host, so that it
+// completes without restarts even though the results are no longer cached.
+TEST_F(ProxyResolverV8TracingTest, PrefetchesDnsOfPreviousExecution) {
+  CapturingNetLog log;
+  MockCachingHostResolver host_resolver;
+  MockErrorObserver* error_observer = new MockErrorObserver;
+  ProxyResolverV8Tracing resolver(&host_resolver, error_observer, &log);
+
+  host_resolver.rules()->AddRule("foopy", "166.155.144.11");
+  host_resolver.rules()->AddRule("*", "122.133.144.155");
+
+  InitResolver(&resolver, "simple_dns.js");
+
+  TestCompletionCallback callback1;
+  ProxyInfo proxy_info;
+  int rv = resolver.GetProxyForURL(
+      GURL("http://foopy/req1"), &proxy_info, callback1.callback(), NULL,
+      BoundNetLog());
+  EXPECT_EQ(ERR_IO_PENDING, rv);
+  EXPECT_EQ(OK, callback1.WaitForResult());
+  EXPECT_EQ(2u, host_resolver.num_resolve());
+  // The first request took 2 restarts, hence on g_iteration=3.
+  EXPECT_EQ("166.155.144.11:3", proxy_info.proxy_server().ToURI());
+
+  // Make the next DNS resolutions asynchronous.
+  host_resolver.GetHostCache()->clear();
+
+  TestCompletionCallback callback2;
+  ProxyResolver::RequestHandle request;
+  rv = resolver.GetProxyForURL(
+      GURL("http://foopy/req2"), &proxy_info, callback2.callback(), &request,
+      BoundNetLog());
+  EXPECT_EQ(ERR_IO_PENDING, rv);
+  EXPECT_EQ(LOAD_STATE_RESOLVING_HOST_IN_PROXY_SCRIPT,
+            resolver.GetLoadState(request));
+  EXPECT_EQ(OK, callback2.WaitForResult());
+  EXPECT_EQ(4u, host_resolver.num_resolve());
+
+  // No restarts were required, so g_iteration incremented by 1.
+  EXPECT_EQ("166.155.144.11:4", proxy_info.proxy_server().ToURI());
+
+  // A request for another host did not have its DNS prefetched.
+  TestCompletionCallback callback3;
+  rv = resolver.GetProxyForURL(
+      GURL("http://foo/req3"), &proxy_info, callback3.callback(), NULL,
+      BoundNetLog());
+  EXPECT_EQ(ERR_IO_PENDING, rv);
+  EXPECT_EQ(OK, callback3.WaitForResult());
+  EXPECT_EQ(6u, host_resolver.num_resolve());
+  // myIpAddress() was in the host cache, but dnsResolve("foo") took 1 restart.
+  EXPECT_EQ("122.133.144.155:6", proxy_info.proxy_server().ToURI());
+
+  EXPECT_EQ("", error_observer->GetOutput());
+  EXPECT_EQ(0u, log.GetSize());
+}
+
 // This test runs a weird PAC script that was designed to defeat the DNS tracing
 // optimization. The proxy resolver should detect the inconsistency and
 // fall-back to synchronous mode execution.
@@ -0,0 +1,390 @@
+// Copyright (c) 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "net/quic/congestion_control/bbr_sender.h"
+
+#include <algorithm>
+
+#include "base/logging.h"
+
+namespace net {
+
+namespace {
+const QuicByteCount kDefaultReceiveWindow = 64000;
+const int64 kInitialCongestionWindow = 10;
+// The window never drops below this number of packets, which is also the
+// window used while in PROBE_RTT.
+const int64 kMinCongestionWindow = 4;
+const int kInitialRttMs = 60;  // At a typical RTT 60 ms.
+// 2/ln(2), the smallest gain that doubles the delivery rate every round.
+const float kHighGain = 2.885f;
+const float kDrainGain = 1.0f / kHighGain;
+// Congestion window gain in steady state. Allows for delayed and aggregated
+// acks without starving the pipe.
+const float kCongestionWindowGain = 2.0f;
+// Pacing gains cycled through in PROBE_BW, one phase per min RTT.
+const float kPacingGainCycle[] = { 1.25f, 0.75f, 1, 1, 1, 1, 1, 1 };
+const int kGainCycleLength = arraysize(kPacingGainCycle);
+// The bandwidth filter holds samples from this many round trips.
+const int64 kBandwidthWindowRounds = kGainCycleLength + 2;
+// STARTUP ends when the bandwidth has grown by less than 25% for three
+// consecutive round trips.
+const float kStartupGrowthTarget = 1.25f;
+const int kRoundTripsWithoutGrowthBeforeExitingStartup = 3;
+const int kMinRttExpirySeconds = 10;
+const int kProbeRttTimeMs = 200;
+// Packets are allowed to be sent this long before their pacing deadline, to
+// account for timer granularity.
+const int64 kPacingGranularityUs = 1000;
+const float kAlpha = 0.125f;
+const float kOneMinusAlpha = (1 - kAlpha);
+const float kBeta = 0.25f;
+const float kOneMinusBeta = (1 - kBeta);
+}  // namespace
+
+BbrSender::BbrSender(const QuicClock* clock)
+    : clock_(clock),
+      mode_(STARTUP),
+      bytes_in_flight_(0),
+      receiver_congestion_window_(kDefaultReceiveWindow),
+      last_received_accumulated_number_of_lost_packets_(0),
+      delivered_(0),
+      delivered_time_(QuicTime::Zero()),
+      round_trip_count_(0),
+      next_round_delivered_(0),
+      min_rtt_(QuicTime::Delta::Zero()),
+      min_rtt_timestamp_(QuicTime::Zero()),
+      smoothed_rtt_(QuicTime::Delta::Zero()),
+      mean_deviation_(QuicTime::Delta::Zero()),
+      pacing_gain_(kHighGain),
+      congestion_window_gain_(kHighGain),
+      next_send_time_(QuicTime::Zero()),
+      is_at_full_bandwidth_(false),
+      bandwidth_at_last_round_(QuicBandwidth::Zero()),
+      rounds_without_bandwidth_gain_(0),
+      cycle_index_(0),
+      cycle_start_time_(QuicTime::Zero()),
+      loss_in_cycle_(false),
+      exit_probe_rtt_at_(QuicTime::Zero()),
+      probe_rtt_round_passed_(false) {
+}
+
+BbrSender::~BbrSender() {
+}
+
+void BbrSender::OnIncomingQuicCongestionFeedbackFrame(
+    const QuicCongestionFeedbackFrame& feedback,
+    QuicTime feedback_receive_time,
+    const SentPacketsMap& /*sent_packets*/) {
+  if (feedback.type != kTCP) {
+    // The model is built from acks alone; only the receive window is used.
+    return;
+  }
+  if (last_received_accumulated_number_of_lost_packets_ !=
+      feedback.tcp.accumulated_number_of_lost_packets) {
+    last_received_accumulated_number_of_lost_packets_ =
+        feedback.tcp.accumulated_number_of_lost_packets;
+    OnIncomingLoss(feedback_receive_time);
+  }
+  receiver_congestion_window_ = feedback.tcp.receive_window;
+}
+
+void BbrSender::OnIncomingAck(QuicPacketSequenceNumber acked_sequence_number,
+                              QuicByteCount acked_bytes,
+                              QuicTime::Delta rtt) {
+  const QuicTime now = clock_->Now();
+  bytes_in_flight_ -= std::min(bytes_in_flight_, acked_bytes);
+  delivered_ += acked_bytes;
+  delivered_time_ = now;
+
+  bool is_round_start = false;
+  PacketStateMap::iterator it =
+      packet_state_map_.find(acked_sequence_number);
+  if (it != packet_state_map_.end()) {
+    const PacketState& state = it->second;
+    if (state.delivered >= next_round_delivered_) {
+      next_round_delivered_ = delivered_;
+      ++round_trip_count_;
+      is_round_start = true;
+    }
+    QuicTime::Delta interval = now.Subtract(state.delivered_time);
+    if (interval > QuicTime::Delta::Zero()) {
+      UpdateMaxBandwidth(QuicBandwidth::FromBytesAndTimeDelta(
+          delivered_ - state.delivered, interval));
+    }
+    packet_state_map_.erase(it);
+  }
+
+  bool min_rtt_expired = false;
+  if (!rtt.IsInfinite() && !rtt.IsZero()) {
+    min_rtt_expired = UpdateMinRtt(now, rtt);
+    UpdateSmoothedRtt(rtt);
+  }
+
+  if (is_round_start && mode_ == STARTUP) {
+    CheckIfFullBandwidthReached();
+  }
+  MaybeExitStartupOrDrain(now);
+  if (mode_ == PROBE_BW) {
+    UpdateGainCycle(now);
+  }
+  MaybeEnterOrExitProbeRtt(now, is_round_start, min_rtt_expired);
+}
+
+void BbrSender::OnIncomingLoss(QuicTime /*ack_receive_time*/) {
+  // Loss is not treated as a congestion signal; the window is bounded by the
+  // bandwidth-delay product instead. A loss does end a probing phase early,
+  // since it means the extra data is not fitting in the bottleneck buffer.
+  loss_in_cycle_ = true;
+  DLOG(INFO) << "Incoming loss; mode:" << mode_;
+}
+
+void BbrSender::SentPacket(QuicTime sent_time,
+                           QuicPacketSequenceNumber sequence_number,
+                           QuicByteCount bytes,
+                           Retransmission /*is_retransmission*/) {
+  if (bytes_in_flight_ == 0) {
+    // Restart the delivery clock after an idle period, otherwise the idle time
+    // would be counted against the next bandwidth sample.
+    delivered_time_ = sent_time;
+  }
+  packet_state_map_.insert(std::make_pair(
+      sequence_number, PacketState(bytes, delivered_, delivered_time_)));
+  bytes_in_flight_ += bytes;
+
+  // Schedule the next packet |bytes| / pacing rate after this one.
+  int64 pacing_rate = std::max<int64>(1, PacingRate().ToBytesPerSecond());
+  QuicTime::Delta transfer_time = QuicTime::Delta::FromMicroseconds(
+      bytes * kNumMicrosPerSecond / pacing_rate);
+  next_send_time_ = std::max(next_send_time_, sent_time).Add(transfer_time);
+}
+
+void BbrSender::AbandoningPacket(QuicPacketSequenceNumber sequence_number,
+                                 QuicByteCount abandoned_bytes) {
+  bytes_in_flight_ -= std::min(bytes_in_flight_, abandoned_bytes);
+  packet_state_map_.erase(sequence_number);
+}
+
+QuicTime::Delta BbrSender::TimeUntilSend(
+    QuicTime now,
+    Retransmission is_retransmission,
+    HasRetransmittableData has_retransmittable_data,
+    IsHandshake handshake) {
+  if (has_retransmittable_data == NO_RETRANSMITTABLE_DATA ||
+      handshake == IS_HANDSHAKE) {
+    // Acks and handshake packets are sent immediately, as in TcpCubicSender.
+    return QuicTime::Delta::Zero();
+  }
+  if (is_retransmission == NOT_RETRANSMISSION &&
+      bytes_in_flight_ >= CongestionWindow()) {
+    return QuicTime::Delta::Infinite();
+  }
+  QuicTime::Delta delay = next_send_time_.Subtract(now);
+  if (next_send_time_ <= now ||
+      delay.ToMicroseconds() <= kPacingGranularityUs) {
+    return QuicTime::Delta::Zero();
+  }
+  return delay;
+}
+
+QuicBandwidth BbrSender::BandwidthEstimate() {
+  return MaxBandwidth();
+}
+
+QuicTime::Delta BbrSender::SmoothedRtt() {
+  if (smoothed_rtt_.IsZero()) {
+    return QuicTime::Delta::FromMilliseconds(kInitialRttMs);
+  }
+  return smoothed_rtt_;
+}
+
+QuicTime::Delta BbrSender::RetransmissionDelay() {
+  return QuicTime::Delta::FromMicroseconds(
+      smoothed_rtt_.ToMicroseconds() + 4 * mean_deviation_.ToMicroseconds());
+}
+
+QuicBandwidth BbrSender::PacingRate() const {
+  QuicBandwidth bandwidth = MaxBandwidth();
+  if (bandwidth.IsZero()) {
+    // No estimate yet; pace the initial window out over one RTT.
+    QuicTime::Delta rtt = min_rtt_.IsZero() ?
+        QuicTime::Delta::FromMilliseconds(kInitialRttMs) : min_rtt_;
+    bandwidth = QuicBandwidth::FromBytesAndTimeDelta(
+        kInitialCongestionWindow * kMaxPacketSize, rtt);
+  }
+  return bandwidth.Scale(pacing_gain_);
+}
+
+QuicByteCount BbrSender::CongestionWindow() const {
+  QuicByteCount congestion_window;
+  if (mode_ == PROBE_RTT) {
+    congestion_window = kMinCongestionWindow * kMaxPacketSize;
+  } else if (MaxBandwidth().IsZero() || min_rtt_.IsZero()) {
+    congestion_window = kInitialCongestionWindow * kMaxPacketSize;
+  } else {
+    // Early bandwidth samples are low, so the window is not allowed to drop
+    // below the initial window until STARTUP has found the full bandwidth.
+    QuicByteCount min_congestion_window = is_at_full_bandwidth_ ?
+        kMinCongestionWindow * kMaxPacketSize :
+        kInitialCongestionWindow * kMaxPacketSize;
+    congestion_window = std::max(
+        GetTargetCongestionWindow(congestion_window_gain_),
+        min_congestion_window);
+  }
+  return std::min(receiver_congestion_window_, congestion_window);
+}
+
+void BbrSender::UpdateMaxBandwidth(QuicBandwidth sample) {
+  // Samples that are not larger than the new one can never become the max
+  // again, since they would also expire earlier.
+  while (!max_bandwidth_filter_.empty() &&
+         max_bandwidth_filter_.back().second <= sample) {
+    max_bandwidth_filter_.pop_back();
+  }
+  max_bandwidth_filter_.push_back(
+      BandwidthSample(round_trip_count_, sample));
+  while (max_bandwidth_filter_.front().first + kBandwidthWindowRounds <=
+         round_trip_count_) {
+    max_bandwidth_filter_.pop_front();
+  }
+}
+
+bool BbrSender::UpdateMinRtt(QuicTime now, QuicTime::Delta rtt) {
+  bool min_rtt_expired = !min_rtt_.IsZero() && now > min_rtt_timestamp_.Add(
+      QuicTime::Delta::FromSeconds(kMinRttExpirySeconds));
+  if (min_rtt_.IsZero() || rtt <= min_rtt_ || min_rtt_expired) {
+    min_rtt_ = rtt;
+    min_rtt_timestamp_ = now;
+  }
+  return min_rtt_expired;
+}
+
+void BbrSender::UpdateSmoothedRtt(QuicTime::Delta rtt) {
+  if (smoothed_rtt_.IsZero()) {
+    smoothed_rtt_ = rtt;
+    mean_deviation_ = QuicTime::Delta::FromMicroseconds(
+        rtt.ToMicroseconds() / 2);
+    return;
+  }
+  mean_deviation_ = QuicTime::Delta::FromMicroseconds(
+      kOneMinusBeta * mean_deviation_.ToMicroseconds() +
+      kBeta * abs(smoothed_rtt_.ToMicroseconds() - rtt.ToMicroseconds()));
+  smoothed_rtt_ = QuicTime::Delta::FromMicroseconds(
+      kOneMinusAlpha * smoothed_rtt_.ToMicroseconds() +
+      kAlpha * rtt.ToMicroseconds());
+}
+
+void BbrSender::CheckIfFullBandwidthReached() {
+  QuicBandwidth target =
+      bandwidth_at_last_round_.Scale(kStartupGrowthTarget);
+  QuicBandwidth bandwidth = MaxBandwidth();
+  if (bandwidth >= target) {
+    bandwidth_at_last_round_ = bandwidth;
+    rounds_without_bandwidth_gain_ = 0;
+    return;
+  }
+  if (++rounds_without_bandwidth_gain_ >=
+      kRoundTripsWithoutGrowthBeforeExitingStartup) {
+    DLOG(INFO) << "Full bandwidth reached:" << bandwidth.ToKBitsPerSecond()
+               << " kbit/s";
+    is_at_full_bandwidth_ = true;
+  }
+}
+
+void BbrSender::MaybeExitStartupOrDrain(QuicTime now) {
+  if (mode_ == STARTUP && is_at_full_bandwidth_) {
+    mode_ = DRAIN;
+    pacing_gain_ = kDrainGain;
+    congestion_window_gain_ = kHighGain;
+  }
+  if (mode_ == DRAIN &&
+      bytes_in_flight_ <= GetTargetCongestionWindow(1)) {
+    EnterProbeBandwidthMode(now);
+  }
+}
+
+void BbrSender::UpdateGainCycle(QuicTime now) {
+  bool should_advance = now.Subtract(cycle_start_time_) > min_rtt_;
+  if (pacing_gain_ > 1 && !loss_in_cycle_ &&
+      bytes_in_flight_ < GetTargetCongestionWindow(pacing_gain_)) {
+    // Keep probing until the extra data actually made it into the network.
+    should_advance = false;
+  }
+  if (pacing_gain_ < 1 && bytes_in_flight_ <= GetTargetCongestionWindow(1)) {
+    // The queue created by the probe has drained; no need to wait a full RTT.
+    should_advance = true;
+  }
+  if (should_advance) {
+    cycle_index_ = (cycle_index_ + 1) % kGainCycleLength;
+    cycle_start_time_ = now;
+    loss_in_cycle_ = false;
+    pacing_gain_ = kPacingGainCycle[cycle_index_];
+  }
+}
+
+void BbrSender::MaybeEnterOrExitProbeRtt(QuicTime now,
+                                         bool is_round_start,
+                                         bool min_rtt_expired) {
+  if (min_rtt_expired && mode_ != PROBE_RTT) {
+    DLOG(INFO) << "Min RTT expired; entering PROBE_RTT";
+    mode_ = PROBE_RTT;
+    pacing_gain_ = 1;
+    exit_probe_rtt_at_ = QuicTime::Zero();
+  }
+  if (mode_ != PROBE_RTT) {
+    return;
+  }
+  if (!exit_probe_rtt_at_.IsInitialized()) {
+    if (bytes_in_flight_ <= CongestionWindow()) {
+      exit_probe_rtt_at_ = now.Add(
+          QuicTime::Delta::FromMilliseconds(kProbeRttTimeMs));
+      probe_rtt_round_passed_ = false;
+      next_round_delivered_ = delivered_;
+    }
+    return;
+  }
+  if (is_round_start) {
+    probe_rtt_round_passed_ = true;
+  }
+  if (now >= exit_probe_rtt_at_ && probe_rtt_round_passed_) {
+    min_rtt_timestamp_ = now;
+    if (is_at_full_bandwidth_) {
+      EnterProbeBandwidthMode(now);
+    } else {
+      EnterStartupMode();
+    }
+  }
+}
+
+void BbrSender::EnterProbeBandwidthMode(QuicTime now) {
+  mode_ = PROBE_BW;
+  congestion_window_gain_ = kCongestionWindowGain;
+  // Start in one of the cruising phases rather than probing right away, since
+  // the bottleneck queue has only just been drained.
+  cycle_index_ = kGainCycleLength - 1;
+  cycle_start_time_ = now;
+  loss_in_cycle_ = false;
+  pacing_gain_ = kPacingGainCycle[cycle_index_];
+}
+
+void BbrSender::EnterStartupMode() {
+  mode_ = STARTUP;
+  pacing_gain_ = kHighGain;
+  congestion_window_gain_ = kHighGain;
+}
+
+QuicBandwidth BbrSender::MaxBandwidth() const {
+  if (max_bandwidth_filter_.empty()) {
+    return QuicBandwidth::Zero();
+  }
+  return max_bandwidth_filter_.front().second;
+}
+
+QuicByteCount BbrSender::GetTargetCongestionWindow(float gain) const {
+  QuicTime::Delta rtt = min_rtt_.IsZero() ?
+      QuicTime::Delta::FromMilliseconds(kInitialRttMs) : min_rtt_;
+  return MaxBandwidth().Scale(gain).ToBytesPerPeriod(rtt);
+}
+
+}  // namespace net
@@ -0,0 +1,179 @@
+// Copyright (c) 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Model based send side congestion control. Instead of reacting to packet
+// loss, the sender keeps a windowed max of the delivery rate (the bottleneck
+// bandwidth) and a windowed min of the RTT (the propagation delay), paces
+// packets at a gain applied to the bandwidth estimate and caps the data in
+// flight at a small multiple of the estimated bandwidth-delay product.
+
+#ifndef NET_QUIC_CONGESTION_CONTROL_BBR_SENDER_H_
+#define NET_QUIC_CONGESTION_CONTROL_BBR_SENDER_H_
+
+#include <deque>
+#include <map>
+
+#include "base/basictypes.h"
+#include "base/compiler_specific.h"
+#include "net/base/net_export.h"
+#include "net/quic/congestion_control/send_algorithm_interface.h"
+#include "net/quic/quic_bandwidth.h"
+#include "net/quic/quic_clock.h"
+#include "net/quic/quic_protocol.h"
+#include "net/quic/quic_time.h"
+
+namespace net {
+
+namespace test {
+class BbrSenderPeer;
+}  // namespace test
+
+class NET_EXPORT_PRIVATE BbrSender : public SendAlgorithmInterface {
+ public:
+  enum Mode {
+    // Grow the sending rate exponentially until the bandwidth estimate stops
+    // increasing.
+    STARTUP,
+    // Drain the queue built up at the bottleneck during STARTUP.
+    DRAIN,
+    // Steady state; cycle the pacing gain around the estimated bandwidth to
+    // probe for more capacity.
+    PROBE_BW,
+    // Shrink the window to a few packets to refresh the min RTT estimate.
+    PROBE_RTT,
+  };
+
+  explicit BbrSender(const QuicClock* clock);
+  virtual ~BbrSender();
+
+  // Start implementation of SendAlgorithmInterface.
+  virtual void OnIncomingQuicCongestionFeedbackFrame(
+      const QuicCongestionFeedbackFrame& feedback,
+      QuicTime feedback_receive_time,
+      const SentPacketsMap& sent_packets) OVERRIDE;
+  virtual void OnIncomingAck(QuicPacketSequenceNumber acked_sequence_number,
+                             QuicByteCount acked_bytes,
+                             QuicTime::Delta rtt) OVERRIDE;
+  virtual void OnIncomingLoss(QuicTime ack_receive_time) OVERRIDE;
+  virtual void SentPacket(QuicTime sent_time,
+                          QuicPacketSequenceNumber sequence_number,
+                          QuicByteCount bytes,
+                          Retransmission is_retransmission) OVERRIDE;
+  virtual void AbandoningPacket(QuicPacketSequenceNumber sequence_number,
+                                QuicByteCount abandoned_bytes) OVERRIDE;
+  virtual QuicTime::Delta TimeUntilSend(
+      QuicTime now,
+      Retransmission is_retransmission,
+      HasRetransmittableData has_retransmittable_data,
+      IsHandshake handshake) OVERRIDE;
+  virtual QuicBandwidth BandwidthEstimate() OVERRIDE;
+  virtual QuicTime::Delta SmoothedRtt() OVERRIDE;
+  virtual QuicTime::Delta RetransmissionDelay() OVERRIDE;
+  // End implementation of SendAlgorithmInterface.
+
+  Mode mode() const { return mode_; }
+
+  // The minimum RTT observed within the last 10 seconds, or zero when no RTT
+  // sample has been taken yet.
+  QuicTime::Delta min_rtt() const { return min_rtt_; }
+
+  // The rate at which packets are currently released to the wire.
+  QuicBandwidth PacingRate() const;
+
+  // The maximum number of bytes allowed in flight.
+  QuicByteCount CongestionWindow() const;
+
+ private:
+  friend class test::BbrSenderPeer;
+
+  // Sender side state recorded for every packet, used to compute a delivery
+  // rate sample when the packet is acked.
+  struct PacketState {
+    PacketState(QuicByteCount bytes,
+                QuicByteCount delivered,
+                QuicTime delivered_time)
+        : bytes(bytes),
+          delivered(delivered),
+          delivered_time(delivered_time) {
+    }
+    QuicByteCount bytes;
+    // Value of |delivered_| when the packet was sent.
+    QuicByteCount delivered;
+    // Value of |delivered_time_| when the packet was sent.
+    QuicTime delivered_time;
+  };
+  typedef std::map<QuicPacketSequenceNumber, PacketState> PacketStateMap;
+
+  // A delivery rate sample and the round trip it was taken in.
+  typedef std::pair<int64, QuicBandwidth> BandwidthSample;
+
+  // Adds |sample| to the windowed max filter of the bottleneck bandwidth.
+  void UpdateMaxBandwidth(QuicBandwidth sample);
+  // Returns true if the min RTT estimate had expired before |rtt| was added.
+  bool UpdateMinRtt(QuicTime now, QuicTime::Delta rtt);
+  void UpdateSmoothedRtt(QuicTime::Delta rtt);
+  void CheckIfFullBandwidthReached();
+  void MaybeExitStartupOrDrain(QuicTime now);
+  void UpdateGainCycle(QuicTime now);
+  void MaybeEnterOrExitProbeRtt(QuicTime now,
+                                bool is_round_start,
+                                bool min_rtt_expired);
+  void EnterProbeBandwidthMode(QuicTime now);
+  void EnterStartupMode();
+
+  QuicBandwidth MaxBandwidth() const;
+  // Returns |gain| times the estimated bandwidth-delay product.
+  QuicByteCount GetTargetCongestionWindow(float gain) const;
+
+  const QuicClock* clock_;
+  Mode mode_;
+
+  PacketStateMap packet_state_map_;
+  QuicByteCount bytes_in_flight_;
+  QuicByteCount receiver_congestion_window_;
+  uint16 last_received_accumulated_number_of_lost_packets_;
+
+  // Total number of bytes acked, and the time of the latest ack.
+  QuicByteCount delivered_;
+  QuicTime delivered_time_;
+
+  // Round trips are counted in packets; a round ends when a packet sent after
+  // the previous round ended is acked.
+  int64 round_trip_count_;
+  QuicByteCount next_round_delivered_;
+
+  // Windowed max of the delivery rate over the last few round trips. The
+  // samples are kept in decreasing order of bandwidth.
+  std::deque<BandwidthSample> max_bandwidth_filter_;
+
+  QuicTime::Delta min_rtt_;
+  QuicTime min_rtt_timestamp_;
+  QuicTime::Delta smoothed_rtt_;
+  QuicTime::Delta mean_deviation_;
+
+  float pacing_gain_;
+  float congestion_window_gain_;
+  QuicTime next_send_time_;
+
+  // Full bandwidth detection used to leave STARTUP.
+  bool is_at_full_bandwidth_;
+  QuicBandwidth bandwidth_at_last_round_;
+  int rounds_without_bandwidth_gain_;
+
+  // PROBE_BW gain cycling.
+  int cycle_index_;
+  QuicTime cycle_start_time_;
+  bool loss_in_cycle_;
+
+  // PROBE_RTT bookkeeping; |exit_probe_rtt_at_| is not initialized until the
+  // data in flight has drained to the minimum window.
+  QuicTime exit_probe_rtt_at_;
+  bool probe_rtt_round_passed_;
+
+  DISALLOW_COPY_AND_ASSIGN(BbrSender);
+};
+
+}  // namespace net
+
+#endif  // NET_QUIC_CONGESTION_CONTROL_BBR_SENDER_H_
@@ -0,0 +1,141 @@
+// Copyright (c) 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "base/logging.h"
+#include "base/memory/scoped_ptr.h"
+#include "net/quic/congestion_control/bbr_sender.h"
+#include "net/quic/congestion_control/quic_congestion_manager.h"
+#include "net/quic/congestion_control/send_algorithm_simulator.h"
+#include "net/quic/congestion_control/tcp_receiver.h"
+#include "net/quic/crypto/crypto_protocol.h"
+#include "net/quic/quic_config.h"
+#include "net/quic/test_tools/mock_clock.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace net {
+namespace test {
+
+class BbrSenderTest : public ::testing::Test {
+ protected:
+  BbrSenderTest()
+      : sender_(new BbrSender(&clock_)),
+        receiver_(new TcpReceiver()) {
+    // Make sure clock does not start at 0.
+    clock_.AdvanceTime(QuicTime::Delta::FromMilliseconds(2));
+  }
+
+  QuicTime::Delta TimeUntilSend() {
+    return sender_->TimeUntilSend(clock_.Now(), NOT_RETRANSMISSION,
+                                  HAS_RETRANSMITTABLE_DATA, NOT_HANDSHAKE);
+  }
+
+  MockClock clock_;
+  scoped_ptr<BbrSender> sender_;
+  scoped_ptr<TcpReceiver> receiver_;
+};
+
+TEST_F(BbrSenderTest, PacesInitialWindow) {
+  EXPECT_EQ(BbrSender::STARTUP, sender_->mode());
+  EXPECT_TRUE(sender_->BandwidthEstimate().IsZero());
+  EXPECT_EQ(10 * kMaxPacketSize, sender_->CongestionWindow());
+
+  EXPECT_TRUE(TimeUntilSend().IsZero());
+  sender_->SentPacket(clock_.Now(), 1, kMaxPacketSize, NOT_RETRANSMISSION);
+  // The initial window is paced out over the default RTT, at the startup
+  // gain, so the next packet is due a couple of milliseconds later.
+  QuicTime::Delta delay = TimeUntilSend();
+  EXPECT_LT(QuicTime::Delta::Zero(), delay);
+  EXPECT_GE(QuicTime::Delta::FromMilliseconds(3), delay);
+
+  // Acks, retransmissions and handshake packets are not paced.
+  EXPECT_TRUE(sender_->TimeUntilSend(clock_.Now(), NOT_RETRANSMISSION,
+      NO_RETRANSMITTABLE_DATA, NOT_HANDSHAKE).IsZero());
+  EXPECT_TRUE(sender_->TimeUntilSend(clock_.Now(), NOT_RETRANSMISSION,
+      HAS_RETRANSMITTABLE_DATA, IS_HANDSHAKE).IsZero());
+
+  clock_.AdvanceTime(delay);
+  EXPECT_TRUE(TimeUntilSend().IsZero());
+}
+
+TEST_F(BbrSenderTest, CongestionWindowLimitsInitialFlight) {
+  QuicPacketSequenceNumber sequence_number = 1;
+  while (!TimeUntilSend().IsInfinite()) {
+    clock_.AdvanceTime(TimeUntilSend());
+    sender_->SentPacket(clock_.Now(), sequence_number++, kMaxPacketSize,
+                        NOT_RETRANSMISSION);
+  }
+  EXPECT_EQ(11u, sequence_number);
+
+  clock_.AdvanceTime(QuicTime::Delta::FromMilliseconds(100));
+  sender_->OnIncomingAck(1, kMaxPacketSize,
+                         QuicTime::Delta::FromMilliseconds(100));
+  EXPECT_EQ(QuicTime::Delta::FromMilliseconds(100), sender_->min_rtt());
+  EXPECT_FALSE(sender_->BandwidthEstimate().IsZero());
+  EXPECT_FALSE(TimeUntilSend().IsInfinite());
+}
+
+TEST_F(BbrSenderTest, ConvergesToLinkBandwidth) {
+  SendAlgorithmSimulator::Link link;
+  link.bandwidth = QuicBandwidth::FromKBitsPerSecond(5000);
+  link.rtt = QuicTime::Delta::FromMilliseconds(60);
+  link.buffer_size = 200 * 1000;
+  SendAlgorithmSimulator simulator(&clock_, sender_.get(), receiver_.get(),
+                                   link);
+  simulator.Run(QuicTime::Delta::FromSeconds(5));
+
+  EXPECT_EQ(BbrSender::PROBE_BW, sender_->mode());
+  EXPECT_LE(link.bandwidth.Scale(0.9f), sender_->BandwidthEstimate());
+  EXPECT_GE(link.bandwidth.Scale(1.1f), sender_->BandwidthEstimate());
+  EXPECT_LE(link.rtt, sender_->min_rtt());
+  EXPECT_GE(link.rtt.Add(QuicTime::Delta::FromMilliseconds(5)),
+            sender_->min_rtt());
+
+  // In steady state the bottleneck queue stays short.
+  SendAlgorithmSimulator::Results results =
+      simulator.Run(QuicTime::Delta::FromSeconds(10));
+  EXPECT_LE(link.bandwidth.Scale(0.9f), results.goodput);
+  EXPECT_GE(QuicTime::Delta::FromMilliseconds(20),
+            results.average_queueing_delay);
+  EXPECT_EQ(0u, results.packets_lost);
+}
+
+TEST_F(BbrSenderTest, ProbesMinRttPeriodically) {
+  SendAlgorithmSimulator::Link link;
+  link.bandwidth = QuicBandwidth::FromKBitsPerSecond(2000);
+  link.rtt = QuicTime::Delta::FromMilliseconds(40);
+  SendAlgorithmSimulator simulator(&clock_, sender_.get(), receiver_.get(),
+                                   link);
+  simulator.Run(QuicTime::Delta::FromSeconds(5));
+  ASSERT_EQ(BbrSender::PROBE_BW, sender_->mode());
+
+  // The min RTT estimate expires after 10 seconds.
+  bool probed_rtt = false;
+  for (int i = 0; i < 150 && !probed_rtt; ++i) {
+    simulator.Run(QuicTime::Delta::FromMilliseconds(50));
+    probed_rtt = sender_->mode() == BbrSender::PROBE_RTT;
+  }
+  EXPECT_TRUE(probed_rtt);
+  simulator.Run(QuicTime::Delta::FromSeconds(1));
+  EXPECT_EQ(BbrSender::PROBE_BW, sender_->mode());
+}
+
+TEST_F(BbrSenderTest, SelectedThroughConfig) {
+  QuicCongestionManager manager(&clock_, kTCP);
+  QuicConfig config;
+  config.SetDefaults();
+  manager.SetFromConfig(config);
+  manager.SentPacket(1, clock_.Now(), kMaxPacketSize, NOT_RETRANSMISSION);
+  // TcpCubicSender does not pace.
+  EXPECT_TRUE(manager.TimeUntilSend(clock_.Now(), NOT_RETRANSMISSION,
+      HAS_RETRANSMITTABLE_DATA, NOT_HANDSHAKE).IsZero());
+
+  config.set_congestion_control(QuicTagVector(1, kTBBR), kTBBR);
+  manager.SetFromConfig(config);
+  manager.SentPacket(2, clock_.Now(), kMaxPacketSize, NOT_RETRANSMISSION);
+  EXPECT_FALSE(manager.TimeUntilSend(clock_.Now(), NOT_RETRANSMISSION,
+      HAS_RETRANSMITTABLE_DATA, NOT_HANDSHAKE).IsZero());
+}
+
+}  // namespace test
+}  // namespace net
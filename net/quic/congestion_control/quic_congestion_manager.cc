@@ -8,8 +8,11 @@
 #include <map>
 
 #include "base/stl_util.h"
+#include "net/quic/congestion_control/bbr_sender.h"
 #include "net/quic/congestion_control/receive_algorithm_interface.h"
 #include "net/quic/congestion_control/send_algorithm_interface.h"
+#include "net/quic/crypto/crypto_protocol.h"
+#include "net/quic/quic_config.h"
 
 namespace {
 static const int kBitrateSmoothingPeriodMs = 1000;
@@ -48,6 +51,24 @@ QuicCongestionManager::~QuicCongestionManager() {
   STLDeleteValues(&packet_history_map_);
 }
 
+void QuicCongestionManager::SetFromConfig(const QuicConfig& config) {
+  if (config.congestion_control() != kTBBR) {
+    return;
+  }
+  // The bandwidth model is built from acks and TCP style feedback, so the
+  // receive algorithm is kept as is.
+  send_algorithm_.reset(new BbrSender(clock_));
+  for (PendingPacketsMap::const_iterator it = pending_packets_.begin();
+       it != pending_packets_.end(); ++it) {
+    SendAlgorithmInterface::SentPacketsMap::const_iterator history_it =
+        packet_history_map_.find(it->first);
+    QuicTime sent_time = history_it != packet_history_map_.end() ?
+        history_it->second->SendTimestamp() : clock_->ApproximateNow();
+    send_algorithm_->SentPacket(sent_time, it->first, it->second,
+                                NOT_RETRANSMISSION);
+  }
+}
+
 void QuicCongestionManager::SentPacket(QuicPacketSequenceNumber sequence_number,
                                        QuicTime sent_time,
                                        QuicByteCount bytes,
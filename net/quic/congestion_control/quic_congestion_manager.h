@@ -28,6 +28,7 @@ class QuicCongestionManagerPeer;
 }  // namespace test
 
 class QuicClock;
+class QuicConfig;
 class ReceiveAlgorithmInterface;
 
 class NET_EXPORT_PRIVATE QuicCongestionManager {
@@ -36,6 +37,10 @@ class NET_EXPORT_PRIVATE QuicCongestionManager {
                         CongestionFeedbackType congestion_type);
   virtual ~QuicCongestionManager();
 
+  // Switches to the send algorithm negotiated in |config|. Packets already in
+  // flight are handed over to the new algorithm.
+  virtual void SetFromConfig(const QuicConfig& config);
+
   // Called when we have received an ack frame from peer.
   virtual void OnIncomingAckFrame(const QuicAckFrame& frame,
                                   QuicTime ack_receive_time);
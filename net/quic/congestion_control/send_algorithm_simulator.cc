@@ -0,0 +1,240 @@
+// Copyright (c) 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "net/quic/congestion_control/send_algorithm_simulator.h"
+
+#include <algorithm>
+
+#include "base/logging.h"
+#include "base/stl_util.h"
+
+namespace net {
+
+namespace {
+// Used for the retransmission timer until the sender has an RTT estimate.
+const int kDefaultRetransmissionTimeMs = 500;
+const int kMinRetransmissionTimeMs = 200;
+// Sent packets are remembered this long, for the congestion feedback.
+const int kHistoryPeriodMs = 5000;
+// Upper bound on packets sent back to back, to catch senders that never
+// block.
+const size_t kMaxBurstPackets = 10000;
+}  // namespace
+
+SendAlgorithmSimulator::Link::Link()
+    : bandwidth(QuicBandwidth::FromKBitsPerSecond(1000)),
+      rtt(QuicTime::Delta::FromMilliseconds(100)),
+      loss_rate(0),
+      buffer_size(64 * 1024),
+      random_seed(1) {
+}
+
+SendAlgorithmSimulator::Results::Results()
+    : bytes_delivered(0),
+      goodput(QuicBandwidth::Zero()),
+      average_queueing_delay(QuicTime::Delta::Zero()),
+      max_queueing_delay(QuicTime::Delta::Zero()),
+      packets_sent(0),
+      packets_lost(0) {
+}
+
+SendAlgorithmSimulator::SendAlgorithmSimulator(
+    MockClock* clock,
+    SendAlgorithmInterface* sender,
+    ReceiveAlgorithmInterface* receiver,
+    const Link& link)
+    : clock_(clock),
+      sender_(sender),
+      receiver_(receiver),
+      link_(link),
+      random_state_(link.random_seed),
+      next_sequence_number_(1),
+      link_free_time_(QuicTime::Zero()),
+      pending_retransmissions_(0),
+      total_queueing_delay_us_(0),
+      packets_delivered_(0) {
+}
+
+SendAlgorithmSimulator::~SendAlgorithmSimulator() {
+  STLDeleteValues(&sent_packets_);
+}
+
+SendAlgorithmSimulator::Results SendAlgorithmSimulator::Run(
+    QuicTime::Delta duration) {
+  const QuicTime end_time = clock_->Now().Add(duration);
+  results_ = Results();
+  total_queueing_delay_us_ = 0;
+  packets_delivered_ = 0;
+
+  while (clock_->Now() < end_time) {
+    QuicTime now = clock_->Now();
+    while (!acks_.empty() && acks_.front().event_time <= now) {
+      ProcessAck(acks_.front());
+      acks_.pop_front();
+    }
+    bool timed_out = false;
+    while (!drops_.empty() && drops_.front().event_time <= now) {
+      ProcessLoss(drops_.front());
+      drops_.pop_front();
+      timed_out = true;
+    }
+    if (timed_out) {
+      sender_->OnIncomingLoss(now);
+    }
+
+    QuicTime::Delta time_until_send = QuicTime::Delta::Zero();
+    QuicTime next_event = NextEventTime(&time_until_send);
+    if (!next_event.IsInitialized()) {
+      LOG(ERROR) << "Sender is blocked with nothing in flight.";
+      break;
+    }
+    clock_->AdvanceTime(std::min(next_event, end_time).Subtract(now));
+  }
+
+  if (packets_delivered_ > 0) {
+    results_.average_queueing_delay = QuicTime::Delta::FromMicroseconds(
+        total_queueing_delay_us_ / packets_delivered_);
+  }
+  results_.goodput = QuicBandwidth::FromBytesAndTimeDelta(
+      results_.bytes_delivered, duration);
+  return results_;
+}
+
+QuicTime SendAlgorithmSimulator::NextEventTime(
+    QuicTime::Delta* time_until_send) {
+  const QuicTime now = clock_->Now();
+  for (size_t i = 0; i < kMaxBurstPackets; ++i) {
+    Retransmission retransmission = pending_retransmissions_ > 0 ?
+        IS_RETRANSMISSION : NOT_RETRANSMISSION;
+    *time_until_send = sender_->TimeUntilSend(
+        now, retransmission, HAS_RETRANSMITTABLE_DATA, NOT_HANDSHAKE);
+    if (!time_until_send->IsZero()) {
+      break;
+    }
+    SendPacket(retransmission);
+  }
+  DCHECK(!time_until_send->IsZero()) << "Sender never blocks.";
+
+  QuicTime next_event = QuicTime::Zero();
+  if (!time_until_send->IsInfinite()) {
+    next_event = now.Add(*time_until_send);
+  }
+  if (!acks_.empty() && (!next_event.IsInitialized() ||
+                         acks_.front().event_time < next_event)) {
+    next_event = acks_.front().event_time;
+  }
+  if (!drops_.empty() && (!next_event.IsInitialized() ||
+                          drops_.front().event_time < next_event)) {
+    next_event = drops_.front().event_time;
+  }
+  return next_event;
+}
+
+void SendAlgorithmSimulator::SendPacket(Retransmission retransmission) {
+  const QuicTime now = clock_->Now();
+  const QuicByteCount bytes = kMaxPacketSize;
+  QuicPacketSequenceNumber sequence_number = next_sequence_number_++;
+  sender_->SentPacket(now, sequence_number, bytes, retransmission);
+  sent_packets_[sequence_number] =
+      new class SendAlgorithmInterface::SentPacket(bytes, now);
+  CleanupPacketHistory();
+  if (retransmission == IS_RETRANSMISSION) {
+    --pending_retransmissions_;
+  }
+  ++results_.packets_sent;
+
+  QuicTime::Delta queueing_delay = link_free_time_ > now ?
+      link_free_time_.Subtract(now) : QuicTime::Delta::Zero();
+  QuicByteCount queued_bytes = link_.bandwidth.ToBytesPerPeriod(
+      queueing_delay);
+  if (queued_bytes + bytes > link_.buffer_size || RandomDrop()) {
+    QuicTime::Delta retransmission_delay = sender_->RetransmissionDelay();
+    if (retransmission_delay.IsZero()) {
+      retransmission_delay = QuicTime::Delta::FromMilliseconds(
+          kDefaultRetransmissionTimeMs);
+    }
+    retransmission_delay = std::max(
+        retransmission_delay,
+        QuicTime::Delta::FromMilliseconds(kMinRetransmissionTimeMs));
+    drops_.push_back(InFlightPacket(sequence_number, bytes, now,
+                                    now.Add(retransmission_delay)));
+    return;
+  }
+
+  QuicTime::Delta transfer_time = QuicTime::Delta::FromMicroseconds(
+      bytes * kNumMicrosPerSecond / link_.bandwidth.ToBytesPerSecond());
+  link_free_time_ = std::max(link_free_time_, now).Add(transfer_time);
+  QuicTime::Delta one_way_delay = QuicTime::Delta::FromMicroseconds(
+      link_.rtt.ToMicroseconds() / 2);
+  QuicTime arrival_time = link_free_time_.Add(one_way_delay);
+
+  InFlightPacket packet(sequence_number, bytes, now,
+                        arrival_time.Add(one_way_delay));
+  packet.queueing_delay = queueing_delay;
+  if (receiver_ != NULL) {
+    receiver_->RecordIncomingPacket(bytes, sequence_number, arrival_time,
+                                    false);
+    packet.has_feedback =
+        receiver_->GenerateCongestionFeedback(&packet.feedback);
+  }
+  acks_.push_back(packet);
+}
+
+void SendAlgorithmSimulator::ProcessAck(const InFlightPacket& packet) {
+  const QuicTime now = clock_->Now();
+  if (packet.has_feedback) {
+    sender_->OnIncomingQuicCongestionFeedbackFrame(packet.feedback, now,
+                                                   sent_packets_);
+  }
+  sender_->OnIncomingAck(packet.sequence_number, packet.bytes,
+                         now.Subtract(packet.sent_time));
+  results_.bytes_delivered += packet.bytes;
+  ++packets_delivered_;
+  total_queueing_delay_us_ += packet.queueing_delay.ToMicroseconds();
+  results_.max_queueing_delay =
+      std::max(results_.max_queueing_delay, packet.queueing_delay);
+
+  // Any dropped packet sent before this one is now known to be lost.
+  bool new_packet_loss_reported = false;
+  while (!drops_.empty() &&
+         drops_.front().sequence_number < packet.sequence_number) {
+    ProcessLoss(drops_.front());
+    drops_.pop_front();
+    new_packet_loss_reported = true;
+  }
+  if (new_packet_loss_reported) {
+    sender_->OnIncomingLoss(now);
+  }
+}
+
+void SendAlgorithmSimulator::ProcessLoss(const InFlightPacket& packet) {
+  sender_->AbandoningPacket(packet.sequence_number, packet.bytes);
+  ++results_.packets_lost;
+  ++pending_retransmissions_;
+}
+
+void SendAlgorithmSimulator::CleanupPacketHistory() {
+  const QuicTime::Delta kHistoryPeriod =
+      QuicTime::Delta::FromMilliseconds(kHistoryPeriodMs);
+  QuicTime now = clock_->Now();
+  while (!sent_packets_.empty() &&
+         now.Subtract(sent_packets_.begin()->second->SendTimestamp()) >
+             kHistoryPeriod) {
+    delete sent_packets_.begin()->second;
+    sent_packets_.erase(sent_packets_.begin());
+  }
+}
+
+bool SendAlgorithmSimulator::RandomDrop() {
+  if (link_.loss_rate <= 0) {
+    return false;
+  }
+  // Linear congruential generator; quality is not important here, only that
+  // the sequence is the same from run to run.
+  random_state_ = random_state_ * 1103515245 + 12345;
+  float sample = ((random_state_ >> 16) & 0x7fff) / 32768.0f;
+  return sample < link_.loss_rate;
+}
+
+}  // namespace net
@@ -0,0 +1,128 @@
+// Copyright (c) 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// A discrete event simulation of a single bottleneck link, used to compare
+// send algorithms. Packets leave the sender as fast as the send algorithm
+// allows and enter a drop-tail queue that is drained at the link bandwidth.
+// After the one way delay they reach the receive algorithm, and the ack
+// (carrying any congestion feedback) reaches the sender half an RTT later.
+// A lost packet is detected once a later packet is acked, or after a
+// retransmission timeout, and its data is retransmitted in a new packet.
+
+#ifndef NET_QUIC_CONGESTION_CONTROL_SEND_ALGORITHM_SIMULATOR_H_
+#define NET_QUIC_CONGESTION_CONTROL_SEND_ALGORITHM_SIMULATOR_H_
+
+#include <deque>
+
+#include "base/basictypes.h"
+#include "net/quic/congestion_control/receive_algorithm_interface.h"
+#include "net/quic/congestion_control/send_algorithm_interface.h"
+#include "net/quic/quic_bandwidth.h"
+#include "net/quic/quic_protocol.h"
+#include "net/quic/quic_time.h"
+#include "net/quic/test_tools/mock_clock.h"
+
+namespace net {
+
+class SendAlgorithmSimulator {
+ public:
+  struct Link {
+    Link();
+
+    // Rate at which the bottleneck queue is drained.
+    QuicBandwidth bandwidth;
+    // Round trip propagation delay, excluding any queueing.
+    QuicTime::Delta rtt;
+    // Probability in [0, 1) that a packet is dropped at random.
+    float loss_rate;
+    // Bytes the bottleneck queue holds; packets arriving at a full queue are
+    // dropped.
+    QuicByteCount buffer_size;
+    // Seed for the random loss, so that runs are repeatable.
+    uint32 random_seed;
+  };
+
+  struct Results {
+    Results();
+
+    QuicByteCount bytes_delivered;
+    QuicBandwidth goodput;
+    QuicTime::Delta average_queueing_delay;
+    QuicTime::Delta max_queueing_delay;
+    size_t packets_sent;
+    size_t packets_lost;
+  };
+
+  // Neither |clock|, |sender| nor |receiver| are owned. |receiver| may be
+  // NULL, in which case no congestion feedback is sent.
+  SendAlgorithmSimulator(MockClock* clock,
+                         SendAlgorithmInterface* sender,
+                         ReceiveAlgorithmInterface* receiver,
+                         const Link& link);
+  ~SendAlgorithmSimulator();
+
+  // Sends an unlimited amount of data for |duration| and returns the
+  // statistics gathered over that period.
+  Results Run(QuicTime::Delta duration);
+
+ private:
+  struct InFlightPacket {
+    InFlightPacket(QuicPacketSequenceNumber sequence_number,
+                   QuicByteCount bytes,
+                   QuicTime sent_time,
+                   QuicTime event_time)
+        : sequence_number(sequence_number),
+          bytes(bytes),
+          sent_time(sent_time),
+          event_time(event_time),
+          queueing_delay(QuicTime::Delta::Zero()),
+          has_feedback(false) {
+    }
+    QuicPacketSequenceNumber sequence_number;
+    QuicByteCount bytes;
+    QuicTime sent_time;
+    // The time the ack reaches the sender, or for a dropped packet the time
+    // its retransmission timer fires.
+    QuicTime event_time;
+    // Time spent in the bottleneck queue.
+    QuicTime::Delta queueing_delay;
+    QuicCongestionFeedbackFrame feedback;
+    bool has_feedback;
+  };
+
+  void SendPacket(Retransmission retransmission);
+  void ProcessAck(const InFlightPacket& packet);
+  void ProcessLoss(const InFlightPacket& packet);
+  void CleanupPacketHistory();
+  // Returns the next event time, or an uninitialized time if there is none.
+  QuicTime NextEventTime(QuicTime::Delta* time_until_send);
+  bool RandomDrop();
+
+  MockClock* clock_;
+  SendAlgorithmInterface* sender_;
+  ReceiveAlgorithmInterface* receiver_;
+  const Link link_;
+  uint32 random_state_;
+
+  QuicPacketSequenceNumber next_sequence_number_;
+  // Time at which the bottleneck has sent all queued bytes.
+  QuicTime link_free_time_;
+  // Packets that will be acked, and dropped packets not yet detected as lost,
+  // both in sequence number order.
+  std::deque<InFlightPacket> acks_;
+  std::deque<InFlightPacket> drops_;
+  // Number of lost packets whose data still has to be retransmitted.
+  size_t pending_retransmissions_;
+  SendAlgorithmInterface::SentPacketsMap sent_packets_;
+
+  Results results_;
+  int64 total_queueing_delay_us_;
+  size_t packets_delivered_;
+
+  DISALLOW_COPY_AND_ASSIGN(SendAlgorithmSimulator);
+};
+
+}  // namespace net
+
+#endif  // NET_QUIC_CONGESTION_CONTROL_SEND_ALGORITHM_SIMULATOR_H_
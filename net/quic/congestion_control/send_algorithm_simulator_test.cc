@@ -0,0 +1,164 @@
+// Copyright (c) 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Runs every send algorithm over the same simulated links and compares the
+// goodput and queueing delay they achieve.
+
+#include "base/logging.h"
+#include "base/memory/scoped_ptr.h"
+#include "net/quic/congestion_control/bbr_sender.h"
+#include "net/quic/congestion_control/fix_rate_sender.h"
+#include "net/quic/congestion_control/inter_arrival_receiver.h"
+#include "net/quic/congestion_control/inter_arrival_sender.h"
+#include "net/quic/congestion_control/send_algorithm_simulator.h"
+#include "net/quic/congestion_control/tcp_cubic_sender.h"
+#include "net/quic/congestion_control/tcp_receiver.h"
+#include "net/quic/test_tools/mock_clock.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace net {
+namespace test {
+namespace {
+
+const int64 kLinkBandwidthKbps = 5000;
+const int kLinkRttMs = 60;
+const int kSimulationSeconds = 20;
+
+enum SenderType {
+  TCP_CUBIC,
+  TCP_RENO,
+  FIX_RATE,
+  INTER_ARRIVAL,
+  BBR,
+};
+
+const char* SenderTypeToString(SenderType type) {
+  switch (type) {
+    case TCP_CUBIC:
+      return "TcpCubic";
+    case TCP_RENO:
+      return "TcpReno";
+    case FIX_RATE:
+      return "FixRate";
+    case INTER_ARRIVAL:
+      return "InterArrival";
+    case BBR:
+      return "Bbr";
+  }
+  return "";
+}
+
+SendAlgorithmSimulator::Link DefaultLink() {
+  SendAlgorithmSimulator::Link link;
+  link.bandwidth = QuicBandwidth::FromKBitsPerSecond(kLinkBandwidthKbps);
+  link.rtt = QuicTime::Delta::FromMilliseconds(kLinkRttMs);
+  // One bandwidth-delay product of buffering.
+  link.buffer_size = link.bandwidth.ToBytesPerPeriod(link.rtt);
+  return link;
+}
+
+}  // namespace
+
+class SendAlgorithmSimulatorTest : public ::testing::Test {
+ protected:
+  SendAlgorithmSimulator::Results Simulate(
+      SendAlgorithmSimulator::Link link,
+      SenderType type) {
+    MockClock clock;
+    clock.AdvanceTime(QuicTime::Delta::FromMilliseconds(1));
+    scoped_ptr<SendAlgorithmInterface> sender;
+    scoped_ptr<ReceiveAlgorithmInterface> receiver;
+    switch (type) {
+      case TCP_CUBIC:
+      case TCP_RENO:
+        // The window cap matches the one used in production.
+        sender.reset(new TcpCubicSender(&clock, type == TCP_RENO, 50));
+        receiver.reset(new TcpReceiver());
+        break;
+      case FIX_RATE: {
+        // Configured once at 90% of the link rate, without further feedback.
+        sender.reset(new FixRateSender(&clock));
+        QuicCongestionFeedbackFrame feedback;
+        feedback.type = kFixRate;
+        feedback.fix_rate.bitrate = link.bandwidth.Scale(0.9f);
+        sender->OnIncomingQuicCongestionFeedbackFrame(
+            feedback, clock.Now(), SendAlgorithmInterface::SentPacketsMap());
+        break;
+      }
+      case INTER_ARRIVAL:
+        sender.reset(new InterArrivalSender(&clock));
+        receiver.reset(new InterArrivalReceiver());
+        break;
+      case BBR:
+        sender.reset(new BbrSender(&clock));
+        receiver.reset(new TcpReceiver());
+        break;
+    }
+    SendAlgorithmSimulator simulator(&clock, sender.get(), receiver.get(),
+                                     link);
+    SendAlgorithmSimulator::Results results =
+        simulator.Run(QuicTime::Delta::FromSeconds(kSimulationSeconds));
+    LOG(INFO) << SenderTypeToString(type)
+              << " goodput:" << results.goodput.ToKBitsPerSecond() << "kbps"
+              << " avg queueing delay:"
+              << results.average_queueing_delay.ToMilliseconds() << "ms"
+              << " max queueing delay:"
+              << results.max_queueing_delay.ToMilliseconds() << "ms"
+              << " lost:" << results.packets_lost
+              << "/" << results.packets_sent;
+    return results;
+  }
+
+  void CompareAllSenders(const SendAlgorithmSimulator::Link& link) {
+    for (int type = TCP_CUBIC; type <= BBR; ++type) {
+      results_[type] = Simulate(link, static_cast<SenderType>(type));
+      EXPECT_LT(0u, results_[type].bytes_delivered)
+          << SenderTypeToString(static_cast<SenderType>(type));
+      EXPECT_GE(link.bandwidth.Scale(1.01f), results_[type].goodput);
+    }
+  }
+
+  SendAlgorithmSimulator::Results results_[BBR + 1];
+};
+
+TEST_F(SendAlgorithmSimulatorTest, DeepBuffer) {
+  SendAlgorithmSimulator::Link link = DefaultLink();
+  link.buffer_size *= 4;
+  CompareAllSenders(link);
+
+  EXPECT_LE(link.bandwidth.Scale(0.9f), results_[BBR].goodput);
+  // The loss based senders fill whatever buffer there is.
+  EXPECT_GT(results_[TCP_CUBIC].average_queueing_delay,
+            results_[BBR].average_queueing_delay);
+}
+
+TEST_F(SendAlgorithmSimulatorTest, ShallowBuffer) {
+  SendAlgorithmSimulator::Link link = DefaultLink();
+  link.buffer_size /= 4;
+  CompareAllSenders(link);
+
+  EXPECT_LE(link.bandwidth.Scale(0.8f), results_[BBR].goodput);
+}
+
+TEST_F(SendAlgorithmSimulatorTest, RandomLoss) {
+  SendAlgorithmSimulator::Link link = DefaultLink();
+  link.loss_rate = 0.01f;
+  CompareAllSenders(link);
+
+  // Random loss is not mistaken for congestion by the bandwidth model.
+  EXPECT_LE(link.bandwidth.Scale(0.8f), results_[BBR].goodput);
+  EXPECT_LT(results_[TCP_CUBIC].goodput, results_[BBR].goodput);
+}
+
+TEST_F(SendAlgorithmSimulatorTest, LongRtt) {
+  SendAlgorithmSimulator::Link link = DefaultLink();
+  link.rtt = QuicTime::Delta::FromMilliseconds(300);
+  link.buffer_size = link.bandwidth.ToBytesPerPeriod(link.rtt);
+  CompareAllSenders(link);
+
+  EXPECT_LE(link.bandwidth.Scale(0.8f), results_[BBR].goodput);
+}
+
+}  // namespace test
+}  // namespace net
@@ -46,6 +46,7 @@ const QuicTag kAESG = TAG('A', 'E', 'S', 'G');  // AES128 + GCM-12
 // Congestion control feedback types
 const QuicTag kQBIC = TAG('Q', 'B', 'I', 'C');  // TCP cubic
 const QuicTag kINAR = TAG('I', 'N', 'A', 'R');  // Inter arrival
+const QuicTag kTBBR = TAG('T', 'B', 'B', 'R');  // Bandwidth and min RTT model
 
 // Proof types (i.e. certificate types)
 // NOTE: although it would be silly to do so, specifying both kX509 and kX59R
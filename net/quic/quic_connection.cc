@@ -1597,6 +1597,10 @@ void QuicConnection::SetIdleNetworkTimeout(QuicTime::Delta timeout) {
   }
 }
 
+void QuicConnection::SetFromConfig(const QuicConfig& config) {
+  congestion_manager_.SetFromConfig(config);
+}
+
 void QuicConnection::SetOverallConnectionTimeout(QuicTime::Delta timeout) {
   if (timeout < overall_connection_timeout_) {
     overall_connection_timeout_ = timeout;
@@ -40,6 +40,7 @@
 namespace net {
 
 class QuicClock;
+class QuicConfig;
 class QuicConnection;
 class QuicFecGroup;
 class QuicRandom;
@@ -332,6 +333,9 @@ class NET_EXPORT_PRIVATE QuicConnection
   // handshake finishes.
   void SetOverallConnectionTimeout(QuicTime::Delta timeout);
 
+  // Applies the congestion control parameters negotiated in |config|.
+  void SetFromConfig(const QuicConfig& config);
+
   // If the connection has timed out, this will close the connection and return
   // true.  Otherwise, it will return false and will reset the timeout alarm.
   bool CheckForTimeout();
@@ -275,6 +275,7 @@ void QuicSession::OnCryptoHandshakeEvent(CryptoHandshakeEvent event) {
       connection_->SetIdleNetworkTimeout(
           config_.idle_connection_state_lifetime());
       connection_->SetOverallConnectionTimeout(QuicTime::Delta::Infinite());
+      connection_->SetFromConfig(config_);
       max_open_streams_ = config_.max_streams_per_connection();
       break;
 
@@ -31,7 +31,10 @@ void HttpConnection::Send(const HttpServerResponseInfo& response) {
 
 HttpConnection::HttpConnection(HttpServer* server, StreamListenSocket* sock)
     : server_(server),
-      socket_(sock) {
+      socket_(sock),
+      parse_state_(0),
+      parse_pos_(0),
+      headers_complete_(false) {
   id_ = last_id_++;
 }
 
@@ -45,7 +48,14 @@ void HttpConnection::DetachSocket() {
 }
 
 void HttpConnection::Shift(int num_bytes) {
-  recv_data_ = recv_data_.substr(num_bytes);
+  recv_data_.erase(0, num_bytes);
+
+  request_ = HttpServerRequestInfo();
+  parse_state_ = 0;
+  parse_pos_ = 0;
+  parse_buffer_.clear();
+  parse_header_name_.clear();
+  headers_complete_ = false;
 }
 
 }  // namespace net
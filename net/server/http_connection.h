@@ -11,6 +11,7 @@
 #include "base/memory/ref_counted.h"
 #include "base/memory/scoped_ptr.h"
 #include "net/http/http_status_code.h"
+#include "net/server/http_server_request_info.h"
 
 namespace net {
 
@@ -27,6 +28,8 @@ class HttpConnection {
   void Send(const char* bytes, int len);
   void Send(const HttpServerResponseInfo& response);
 
+  // Drops the first |num_bytes| of the received data, which also restarts
+  // request parsing at the new start of the data.
   void Shift(int num_bytes);
 
   const std::string& recv_data() const { return recv_data_; }
@@ -44,6 +47,17 @@ class HttpConnection {
   scoped_refptr<StreamListenSocket> socket_;
   scoped_ptr<WebSocket> web_socket_;
   std::string recv_data_;
+
+  // State of HttpServer's parser for the request at the start of
+  // |recv_data_|. It is kept across reads so that received data is scanned
+  // once, however many packets the headers are split into.
+  HttpServerRequestInfo request_;
+  int parse_state_;
+  size_t parse_pos_;
+  std::string parse_buffer_;
+  std::string parse_header_name_;
+  bool headers_complete_;
+
   int id_;
   DISALLOW_COPY_AND_ASSIGN(HttpConnection);
 };
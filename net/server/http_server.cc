@@ -24,7 +24,8 @@ namespace net {
 HttpServer::HttpServer(const StreamListenSocketFactory& factory,
                        HttpServer::Delegate* delegate)
     : delegate_(delegate),
-      server_(factory.CreateAndListen(this)) {
+      server_(factory.CreateAndListen(this)),
+      max_connections_(0) {
 }
 
 void HttpServer::AcceptWebSocket(
@@ -96,6 +97,14 @@ int HttpServer::GetLocalAddress(IPEndPoint* address) {
 
 void HttpServer::DidAccept(StreamListenSocket* server,
                            StreamListenSocket* socket) {
+  if (max_connections_ && id_to_connection_.size() >= max_connections_) {
+    HttpServerResponseInfo response(HTTP_SERVICE_UNAVAILABLE);
+    response.SetBody(std::string(), "text/html");
+    socket->Send(response.Serialize());
+    // Not keeping a reference to |socket| closes it.
+    return;
+  }
+
   HttpConnection* connection = new HttpConnection(this, socket);
   id_to_connection_[connection->id()] = connection;
   socket_to_connection_[socket] = connection;
@@ -126,11 +135,12 @@ void HttpServer::DidRead(StreamListenSocket* socket,
       continue;
     }
 
-    HttpServerRequestInfo request;
-    size_t pos = 0;
-    if (!ParseHeaders(connection, &request, &pos))
+    if (!ParseHeaders(connection))
       break;
 
+    HttpServerRequestInfo& request = connection->request_;
+    size_t pos = connection->parse_pos_;
+
     std::string connection_header = request.GetHeaderValue("connection");
     if (connection_header == "Upgrade") {
       connection->web_socket_.reset(WebSocket::CreateWebSocket(connection,
@@ -203,7 +213,7 @@ enum header_parse_inputs {
   MAX_INPUTS,
 };
 
-// Parser states.
+// Parser states. HttpConnection starts out in state 0, ST_METHOD.
 enum header_parse_states {
   ST_METHOD,     // Receiving the method
   ST_URL,        // Receiving the URL
@@ -245,15 +255,17 @@ int charToInput(char ch) {
   return INPUT_DEFAULT;
 }
 
-bool HttpServer::ParseHeaders(HttpConnection* connection,
-                              HttpServerRequestInfo* info,
-                              size_t* ppos) {
-  size_t& pos = *ppos;
-  size_t data_len = connection->recv_data_.length();
-  int state = ST_METHOD;
-  std::string buffer;
-  std::string header_name;
+bool HttpServer::ParseHeaders(HttpConnection* connection) {
+  if (connection->headers_complete_)
+    return true;
+
+  HttpServerRequestInfo* info = &connection->request_;
+  size_t& pos = connection->parse_pos_;
+  int& state = connection->parse_state_;
+  std::string& buffer = connection->parse_buffer_;
+  std::string& header_name = connection->parse_header_name_;
   std::string header_value;
+  size_t data_len = connection->recv_data_.length();
   while (pos < data_len) {
     char ch = connection->recv_data_[pos++];
     int input = charToInput(ch);
@@ -303,6 +315,7 @@ bool HttpServer::ParseHeaders(HttpConnection* connection,
           break;
         case ST_DONE:
           DCHECK(input == INPUT_LF);
+          connection->headers_complete_ = true;
           return true;
         case ST_ERR:
           return false;
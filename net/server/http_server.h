@@ -60,6 +60,13 @@ class HttpServer : public StreamListenSocket::Delegate,
 
   void Close(int connection_id);
 
+  // Sets the number of connections that are served at once. Connections
+  // beyond it are answered with a 503 and closed. 0, the default, means no
+  // limit.
+  void set_max_connections(size_t max_connections) {
+    max_connections_ = max_connections;
+  }
+
   // Copies the local address to |address|. Returns a network error code.
   int GetLocalAddress(IPEndPoint* address);
 
@@ -78,12 +85,10 @@ class HttpServer : public StreamListenSocket::Delegate,
   friend class base::RefCountedThreadSafe<HttpServer>;
   friend class HttpConnection;
 
-  // Expects the raw data to be stored in recv_data_. If parsing is successful,
-  // will remove the data parsed from recv_data_, leaving only the unused
-  // recv data.
-  bool ParseHeaders(HttpConnection* connection,
-                    HttpServerRequestInfo* info,
-                    size_t* pos);
+  // Parses the headers of the request at the start of the connection's
+  // recv_data_, resuming where the previous call stopped. Returns true once
+  // they are complete, with the connection's parse_pos_ pointing past them.
+  bool ParseHeaders(HttpConnection* connection);
 
   HttpConnection* FindConnection(int connection_id);
   HttpConnection* FindConnection(StreamListenSocket* socket);
@@ -94,6 +99,7 @@ class HttpServer : public StreamListenSocket::Delegate,
   IdToConnectionMap id_to_connection_;
   typedef std::map<StreamListenSocket*, HttpConnection*> SocketToConnectionMap;
   SocketToConnectionMap socket_to_connection_;
+  size_t max_connections_;
 
   DISALLOW_COPY_AND_ASSIGN(HttpServer);
 };
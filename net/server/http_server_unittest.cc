@@ -10,6 +10,7 @@
 #include "base/format_macros.h"
 #include "base/memory/ref_counted.h"
 #include "base/memory/scoped_ptr.h"
+#include "base/memory/scoped_vector.h"
 #include "base/memory/weak_ptr.h"
 #include "base/message_loop/message_loop.h"
 #include "base/message_loop/message_loop_proxy.h"
@@ -23,8 +24,10 @@
 #include "net/base/ip_endpoint.h"
 #include "net/base/net_errors.h"
 #include "net/base/net_log.h"
+#include "net/base/test_completion_callback.h"
 #include "net/server/http_server.h"
 #include "net/server/http_server_request_info.h"
+#include "net/server/http_server_response_info.h"
 #include "net/socket/tcp_client_socket.h"
 #include "net/socket/tcp_listen_socket.h"
 #include "net/url_request/url_fetcher.h"
@@ -86,6 +89,25 @@ class TestHttpClient {
     Write();
   }
 
+  // Reads until |expected_bytes| were received or the server closed the
+  // connection.
+  bool Read(std::string* message, size_t expected_bytes) {
+    message->clear();
+    scoped_refptr<IOBufferWithSize> read_buffer(
+        new IOBufferWithSize(64 * 1024));
+    while (message->length() < expected_bytes) {
+      TestCompletionCallback callback;
+      int rv = callback.GetResult(socket_->Read(
+          read_buffer.get(), read_buffer->size(), callback.callback()));
+      if (rv < 0)
+        return false;
+      if (rv == 0)
+        break;
+      message->append(read_buffer->data(), rv);
+    }
+    return true;
+  }
+
  private:
   void OnConnect(const base::Closure& quit_loop, int result) {
     connect_result_ = result;
@@ -129,6 +151,7 @@ class HttpServerTest : public testing::Test,
   virtual void OnHttpRequest(int connection_id,
                              const HttpServerRequestInfo& info) OVERRIDE {
     requests_.push_back(info);
+    connection_ids_.push_back(connection_id);
     if (requests_.size() == quit_after_request_count_)
       run_loop_quit_func_.Run();
   }
@@ -162,6 +185,7 @@ class HttpServerTest : public testing::Test,
   IPEndPoint server_address_;
   base::Closure run_loop_quit_func_;
   std::vector<HttpServerRequestInfo> requests_;
+  std::vector<int> connection_ids_;
 
  private:
   size_t quit_after_request_count_;
@@ -293,6 +317,143 @@ TEST_F(HttpServerTest, RequestWithBodySplitAcrossPackets) {
   ASSERT_EQ(body, requests_[0].data);
 }
 
+TEST_F(HttpServerTest, RequestSplitIntoSingleBytes) {
+  scoped_refptr<StreamListenSocket> socket(
+      new MockStreamListenSocket(server_.get()));
+  server_->DidAccept(NULL, socket.get());
+  std::string request(
+      "POST /test HTTP/1.1\r\n"
+      "Header: value\r\n"
+      "Content-Length: 4\r\n\r\n"
+      "body"
+      "GET /test2 HTTP/1.1\r\n\r\n");
+  for (size_t i = 0; i < request.length(); ++i)
+    server_->DidRead(socket.get(), request.data() + i, 1);
+  ASSERT_EQ(2u, requests_.size());
+  EXPECT_EQ("POST", requests_[0].method);
+  EXPECT_EQ("value", requests_[0].GetHeaderValue("header"));
+  EXPECT_EQ("body", requests_[0].data);
+  EXPECT_EQ("/test2", requests_[1].path);
+}
+
+TEST_F(HttpServerTest, PipelinedRequests) {
+  TestHttpClient client;
+  ASSERT_EQ(OK, client.ConnectAndWait(server_address_));
+  client.Send("GET /test1 HTTP/1.1\r\n\r\n"
+              "POST /test2 HTTP/1.1\r\n"
+              "Content-Length: 4\r\n\r\n"
+              "body"
+              "GET /test3 HTTP/1.1\r\n\r\n");
+  ASSERT_TRUE(RunUntilRequestsReceived(3));
+  EXPECT_EQ("/test1", requests_[0].path);
+  EXPECT_EQ("/test2", requests_[1].path);
+  EXPECT_EQ("body", requests_[1].data);
+  EXPECT_EQ("/test3", requests_[2].path);
+
+  for (size_t i = 0; i < requests_.size(); ++i)
+    server_->Send200(connection_ids_[i], requests_[i].path, "text/plain");
+  std::string expected_response;
+  for (size_t i = 0; i < requests_.size(); ++i) {
+    HttpServerResponseInfo response(HTTP_OK);
+    response.SetBody(requests_[i].path, "text/plain");
+    expected_response += response.Serialize();
+  }
+  std::string response;
+  ASSERT_TRUE(client.Read(&response, expected_response.length()));
+  EXPECT_EQ(expected_response, response);
+}
+
+TEST_F(HttpServerTest, ManyConcurrentClients) {
+  // Each client takes two file descriptors in this process, so this stays
+  // well below the usual limit of 1024.
+  const size_t kClients = 400;
+  ScopedVector<TestHttpClient> clients;
+  for (size_t i = 0; i < kClients; ++i) {
+    clients.push_back(new TestHttpClient);
+    ASSERT_EQ(OK, clients.back()->ConnectAndWait(server_address_));
+  }
+  for (size_t i = 0; i < kClients; ++i) {
+    clients[i]->Send(base::StringPrintf(
+        "GET /test%" PRIuS " HTTP/1.1\r\n\r\n", i));
+  }
+  ASSERT_TRUE(RunUntilRequestsReceived(kClients));
+
+  for (size_t i = 0; i < kClients; ++i)
+    server_->Send200(connection_ids_[i], requests_[i].path, "text/plain");
+  for (size_t i = 0; i < kClients; ++i) {
+    HttpServerResponseInfo expected_response(HTTP_OK);
+    std::string path = base::StringPrintf("/test%" PRIuS, i);
+    expected_response.SetBody(path, "text/plain");
+    std::string response;
+    ASSERT_TRUE(clients[i]->Read(&response,
+                                 expected_response.Serialize().length()));
+    EXPECT_EQ(expected_response.Serialize(), response);
+  }
+}
+
+TEST_F(HttpServerTest, ConnectionLimit) {
+  server_->set_max_connections(1);
+  TestHttpClient client;
+  ASSERT_EQ(OK, client.ConnectAndWait(server_address_));
+  client.Send("GET /test HTTP/1.1\r\n\r\n");
+  ASSERT_TRUE(RunUntilRequestsReceived(1));
+
+  // The second client is turned away and disconnected.
+  TestHttpClient refused_client;
+  ASSERT_EQ(OK, refused_client.ConnectAndWait(server_address_));
+  std::string response;
+  ASSERT_TRUE(refused_client.Read(&response, std::string::npos));
+  EXPECT_TRUE(StartsWithASCII(response, "HTTP/1.1 503", true)) << response;
+
+  // The first one is still served.
+  client.Send("GET /test2 HTTP/1.1\r\n\r\n");
+  ASSERT_TRUE(RunUntilRequestsReceived(2));
+  EXPECT_EQ("/test2", requests_[1].path);
+}
+
+TEST_F(HttpServerTest, SlowClientDoesNotBlockOthers) {
+  TestHttpClient slow_client;
+  ASSERT_EQ(OK, slow_client.ConnectAndWait(server_address_));
+  slow_client.Send("GET /large HTTP/1.1\r\n\r\n");
+  ASSERT_TRUE(RunUntilRequestsReceived(1));
+
+  // Far more than the socket buffers hold, so most of it has to wait until
+  // the client reads.
+  HttpServerResponseInfo large_response(HTTP_OK);
+  large_response.SetBody(std::string(32 * 1024 * 1024, 'a'), "text/plain");
+  server_->SendResponse(connection_ids_[0], large_response);
+
+  TestHttpClient client;
+  ASSERT_EQ(OK, client.ConnectAndWait(server_address_));
+  client.Send("GET /test HTTP/1.1\r\n\r\n");
+  ASSERT_TRUE(RunUntilRequestsReceived(2));
+  EXPECT_EQ("/test", requests_[1].path);
+
+  std::string response;
+  ASSERT_TRUE(slow_client.Read(&response,
+                               large_response.Serialize().length()));
+  EXPECT_TRUE(response == large_response.Serialize());
+}
+
+TEST_F(HttpServerTest, CloseRightAfterLargeResponse) {
+  TestHttpClient client;
+  ASSERT_EQ(OK, client.ConnectAndWait(server_address_));
+  client.Send("GET /large HTTP/1.1\r\n\r\n");
+  ASSERT_TRUE(RunUntilRequestsReceived(1));
+
+  // The connection is released while most of the response is still queued,
+  // and all of it still has to arrive before the socket is closed.
+  HttpServerResponseInfo large_response(HTTP_OK);
+  large_response.SetBody(std::string(8 * 1024 * 1024, 'a'), "text/plain");
+  server_->SendResponse(connection_ids_[0], large_response);
+  server_->Close(connection_ids_[0]);
+
+  std::string response;
+  ASSERT_TRUE(client.Read(&response, std::string::npos));
+  EXPECT_EQ(large_response.Serialize().length(), response.length());
+  EXPECT_TRUE(response == large_response.Serialize());
+}
+
 TEST_F(HttpServerTest, MultipleRequestsOnSameConnection) {
   // The idea behind this test is that requests with or without bodies should
   // not break parsing of the next request.
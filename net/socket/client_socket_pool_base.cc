@@ -39,27 +39,9 @@ const int kCleanupInterval = 10;  // DO NOT INCREASE THIS TIMEOUT.
 // after a certain timeout has passed without receiving an ACK.
 bool g_connect_backup_jobs_enabled = true;
 
-// Compares the effective priority of two results, and returns 1 if |request1|
-// has greater effective priority than |request2|, 0 if they have the same
-// effective priority, and -1 if |request2| has the greater effective priority.
-// Requests with |ignore_limits| set have higher effective priority than those
-// without.  If both requests have |ignore_limits| set/unset, then the request
-// with the highest Pririoty has the highest effective priority.  Does not take
-// into account the fact that Requests are serviced in FIFO order if they would
-// otherwise have the same priority.
-int CompareEffectiveRequestPriority(
-    const internal::ClientSocketPoolBaseHelper::Request& request1,
-    const internal::ClientSocketPoolBaseHelper::Request& request2) {
-  if (request1.ignore_limits() && !request2.ignore_limits())
-    return 1;
-  if (!request1.ignore_limits() && request2.ignore_limits())
-    return -1;
-  if (request1.priority() > request2.priority())
-    return 1;
-  if (request1.priority() < request2.priority())
-    return -1;
-  return 0;
-}
+// The RequestQueue has a second set of levels, above the levels for the
+// RequestPriorities, for requests which ignore the socket pool limits.
+const uint32 kIgnoreLimitsPriorityOffset = NUM_PRIORITIES;
 
 }  // namespace
 
@@ -209,29 +191,11 @@ ClientSocketPoolBaseHelper::CallbackResultPair::CallbackResultPair(
 
 ClientSocketPoolBaseHelper::CallbackResultPair::~CallbackResultPair() {}
 
-// static
-void ClientSocketPoolBaseHelper::InsertRequestIntoQueue(
-    const Request* r, RequestQueue* pending_requests) {
-  RequestQueue::iterator it = pending_requests->begin();
-  // TODO(mmenke):  Should the network stack require requests with
-  //                |ignore_limits| have the highest priority?
-  while (it != pending_requests->end() &&
-         CompareEffectiveRequestPriority(*r, *(*it)) <= 0) {
-    ++it;
-  }
-  pending_requests->insert(it, r);
-}
-
-// static
-const ClientSocketPoolBaseHelper::Request*
-ClientSocketPoolBaseHelper::RemoveRequestFromQueue(
-    const RequestQueue::iterator& it, Group* group) {
-  const Request* req = *it;
-  group->mutable_pending_requests()->erase(it);
-  // If there are no more requests, we kill the backup timer.
-  if (group->pending_requests().empty())
-    group->CleanupBackupJob();
-  return req;
+bool ClientSocketPoolBaseHelper::StalledGroupLess::operator()(
+    const Group* a, const Group* b) const {
+  if (a->indexed_stalled_priority() != b->indexed_stalled_priority())
+    return a->indexed_stalled_priority() > b->indexed_stalled_priority();
+  return a->group_name() < b->group_name();
 }
 
 void ClientSocketPoolBaseHelper::AddLayeredPool(LayeredPool* pool) {
@@ -265,7 +229,8 @@ int ClientSocketPoolBaseHelper::RequestSocket(
     CHECK(!request->handle()->is_initialized());
     delete request;
   } else {
-    InsertRequestIntoQueue(request, group->mutable_pending_requests());
+    group->InsertPendingRequest(request);
+    UpdateStalledGroup(group);
     // Have to do this asynchronously, as closing sockets in higher level pools
     // call back in to |this|, which will cause all sorts of fun and exciting
     // re-entrancy issues if the socket pool is doing something else at the
@@ -410,6 +375,7 @@ int ClientSocketPoolBaseHelper::RequestSocketInternal(
     connecting_socket_count_++;
 
     group->AddJob(connect_job.release(), preconnecting);
+    UpdateStalledGroup(group);
   } else {
     LogBoundConnectJobToRequest(connect_job->net_log().source(), request);
     StreamSocket* error_socket = NULL;
@@ -455,6 +421,7 @@ bool ClientSocketPoolBaseHelper::AssignIdleSocketToRequest(
 
     ++it;
   }
+  UpdateStalledGroup(group);
 
   // If we haven't found an idle socket, that means there are no used idle
   // sockets.  Pick the oldest (first) idle socket (FIFO).
@@ -509,22 +476,19 @@ void ClientSocketPoolBaseHelper::CancelRequest(
   Group* group = GetOrCreateGroup(group_name);
 
   // Search pending_requests for matching handle.
-  RequestQueue::iterator it = group->mutable_pending_requests()->begin();
-  for (; it != group->pending_requests().end(); ++it) {
-    if ((*it)->handle() == handle) {
-      scoped_ptr<const Request> req(RemoveRequestFromQueue(it, group));
-      req->net_log().AddEvent(NetLog::TYPE_CANCELLED);
-      req->net_log().EndEvent(NetLog::TYPE_SOCKET_POOL);
-
-      // We let the job run, unless we're at the socket limit and there is
-      // not another request waiting on the job.
-      if (group->jobs().size() > group->pending_requests().size() &&
-          ReachedMaxSocketsLimit()) {
-        RemoveConnectJob(*group->jobs().begin(), group);
-        CheckForStalledSocketGroups();
-      }
-      break;
-    }
+  scoped_ptr<const Request> req(group->FindAndRemovePendingRequest(handle));
+  if (!req)
+    return;
+  UpdateStalledGroup(group);
+  req->net_log().AddEvent(NetLog::TYPE_CANCELLED);
+  req->net_log().EndEvent(NetLog::TYPE_SOCKET_POOL);
+
+  // We let the job run, unless we're at the socket limit and there is
+  // not another request waiting on the job.
+  if (group->jobs().size() > group->pending_request_count() &&
+      ReachedMaxSocketsLimit()) {
+    RemoveConnectJob(*group->jobs().begin(), group);
+    CheckForStalledSocketGroups();
   }
 }
 
@@ -558,29 +522,22 @@ LoadState ClientSocketPoolBaseHelper::GetLoadState(
   }
 
   // Can't use operator[] since it is non-const.
-  const Group& group = *group_map_.find(group_name)->second;
-
-  // Search the first group.jobs().size() |pending_requests| for |handle|.
-  // If it's farther back in the deque than that, it doesn't have a
-  // corresponding ConnectJob.
-  size_t connect_jobs = group.jobs().size();
-  RequestQueue::const_iterator it = group.pending_requests().begin();
-  for (size_t i = 0; it != group.pending_requests().end() && i < connect_jobs;
-       ++it, ++i) {
-    if ((*it)->handle() != handle)
-      continue;
+  Group* group = group_map_.find(group_name)->second;
 
+  // If |handle| is farther back in the queue than the first
+  // group->jobs().size() requests, it doesn't have a corresponding ConnectJob.
+  if (group->HasConnectJobForHandle(handle)) {
     // Just return the state  of the farthest along ConnectJob for the first
-    // group.jobs().size() pending requests.
+    // group->jobs().size() pending requests.
     LoadState max_state = LOAD_STATE_IDLE;
-    for (ConnectJobSet::const_iterator job_it = group.jobs().begin();
-         job_it != group.jobs().end(); ++job_it) {
+    for (ConnectJobSet::const_iterator job_it = group->jobs().begin();
+         job_it != group->jobs().end(); ++job_it) {
       max_state = std::max(max_state, (*job_it)->GetLoadState());
     }
     return max_state;
   }
 
-  if (group.IsStalledOnPoolMaxSockets(max_sockets_per_group_))
+  if (group->IsStalledOnPoolMaxSockets(max_sockets_per_group_))
     return LOAD_STATE_WAITING_FOR_STALLED_SOCKET_POOL;
   return LOAD_STATE_WAITING_FOR_AVAILABLE_SOCKET;
 }
@@ -603,12 +560,12 @@ base::DictionaryValue* ClientSocketPoolBaseHelper::GetInfoAsValue(
   base::DictionaryValue* all_groups_dict = new base::DictionaryValue();
   for (GroupMap::const_iterator it = group_map_.begin();
        it != group_map_.end(); it++) {
-    const Group* group = it->second;
+    Group* group = it->second;
     base::DictionaryValue* group_dict = new base::DictionaryValue();
 
     group_dict->SetInteger("pending_request_count",
-                           group->pending_requests().size());
-    if (!group->pending_requests().empty()) {
+                           group->pending_request_count());
+    if (group->has_pending_requests()) {
       group_dict->SetInteger("top_pending_priority",
                              group->TopPendingPriority());
     }
@@ -680,6 +637,7 @@ void ClientSocketPoolBaseHelper::CleanupIdleSockets(bool force) {
         ++j;
       }
     }
+    UpdateStalledGroup(group);
 
     // Delete group if no longer needed.
     if (group->IsEmpty()) {
@@ -695,7 +653,7 @@ ClientSocketPoolBaseHelper::Group* ClientSocketPoolBaseHelper::GetOrCreateGroup(
   GroupMap::iterator it = group_map_.find(group_name);
   if (it != group_map_.end())
     return it->second;
-  Group* group = new Group;
+  Group* group = new Group(group_name);
   group_map_[group_name] = group;
   return group;
 }
@@ -708,6 +666,8 @@ void ClientSocketPoolBaseHelper::RemoveGroup(const std::string& group_name) {
 }
 
 void ClientSocketPoolBaseHelper::RemoveGroup(GroupMap::iterator it) {
+  if (it->second->is_indexed_as_stalled())
+    stalled_groups_.erase(it->second);
   delete it->second;
   group_map_.erase(it);
 }
@@ -768,6 +728,7 @@ void ClientSocketPoolBaseHelper::ReleaseSocket(const std::string& group_name,
 
   CHECK_GT(group->active_socket_count(), 0);
   group->DecrementActiveSocketCount();
+  UpdateStalledGroup(group);
 
   const bool can_reuse = socket->IsConnectedAndIdle() &&
       id == pool_generation_number_;
@@ -806,44 +767,54 @@ void ClientSocketPoolBaseHelper::CheckForStalledSocketGroups() {
   OnAvailableSocketSlot(top_group_name, top_group);
 }
 
-// Search for the highest priority pending request, amongst the groups that
-// are not at the |max_sockets_per_group_| limit. Note: for requests with
-// the same priority, the winner is based on group hash ordering (and not
-// insertion order).
+// The highest priority pending request, amongst the groups that are not at the
+// |max_sockets_per_group_| limit, is at the front of |stalled_groups_|.  Note:
+// for requests with the same priority, the winner is based on group name
+// ordering (and not insertion order).
 bool ClientSocketPoolBaseHelper::FindTopStalledGroup(
     Group** group,
     std::string* group_name) const {
   CHECK((group && group_name) || (!group && !group_name));
+  DCHECK(FindTopStalledGroupByScan() ==
+         (stalled_groups_.empty() ? NULL : *stalled_groups_.begin()));
+  if (stalled_groups_.empty())
+    return false;
+
+  if (group) {
+    Group* top_group = *stalled_groups_.begin();
+    DCHECK(top_group->IsStalledOnPoolMaxSockets(max_sockets_per_group_));
+    *group = top_group;
+    *group_name = top_group->group_name();
+  }
+  return true;
+}
+
+ClientSocketPoolBaseHelper::Group*
+ClientSocketPoolBaseHelper::FindTopStalledGroupByScan() const {
   Group* top_group = NULL;
-  const std::string* top_group_name = NULL;
-  bool has_stalled_group = false;
   for (GroupMap::const_iterator i = group_map_.begin();
        i != group_map_.end(); ++i) {
     Group* curr_group = i->second;
-    const RequestQueue& queue = curr_group->pending_requests();
-    if (queue.empty())
+    if (!curr_group->IsStalledOnPoolMaxSockets(max_sockets_per_group_))
       continue;
-    if (curr_group->IsStalledOnPoolMaxSockets(max_sockets_per_group_)) {
-      if (!group)
-        return true;
-      has_stalled_group = true;
-      bool has_higher_priority = !top_group ||
-          curr_group->TopPendingPriority() > top_group->TopPendingPriority();
-      if (has_higher_priority) {
-        top_group = curr_group;
-        top_group_name = &i->first;
-      }
+    // Groups are visited in name order, so ties go to the first name.
+    if (!top_group ||
+        curr_group->TopPendingPriority() > top_group->TopPendingPriority()) {
+      top_group = curr_group;
     }
   }
+  return top_group;
+}
 
-  if (top_group) {
-    CHECK(group);
-    *group = top_group;
-    *group_name = *top_group_name;
-  } else {
-    CHECK(!has_stalled_group);
+void ClientSocketPoolBaseHelper::UpdateStalledGroup(Group* group) {
+  if (group->is_indexed_as_stalled()) {
+    stalled_groups_.erase(group);
+    group->set_indexed_as_stalled(false, IDLE);
+  }
+  if (group->IsStalledOnPoolMaxSockets(max_sockets_per_group_)) {
+    group->set_indexed_as_stalled(true, group->TopPendingPriority());
+    stalled_groups_.insert(group);
   }
-  return has_stalled_group;
 }
 
 void ClientSocketPoolBaseHelper::OnConnectJobComplete(
@@ -864,9 +835,9 @@ void ClientSocketPoolBaseHelper::OnConnectJobComplete(
   if (result == OK) {
     DCHECK(socket.get());
     RemoveConnectJob(job, group);
-    if (!group->pending_requests().empty()) {
-      scoped_ptr<const Request> r(RemoveRequestFromQueue(
-          group->mutable_pending_requests()->begin(), group));
+    if (group->has_pending_requests()) {
+      scoped_ptr<const Request> r(group->PopNextPendingRequest());
+      UpdateStalledGroup(group);
       LogBoundConnectJobToRequest(job_log.source(), r.get());
       HandOutSocket(
           socket.release(), false /* unused socket */, connect_timing,
@@ -882,9 +853,9 @@ void ClientSocketPoolBaseHelper::OnConnectJobComplete(
     // If we got a socket, it must contain error information so pass that
     // up so that the caller can retrieve it.
     bool handed_out_socket = false;
-    if (!group->pending_requests().empty()) {
-      scoped_ptr<const Request> r(RemoveRequestFromQueue(
-          group->mutable_pending_requests()->begin(), group));
+    if (group->has_pending_requests()) {
+      scoped_ptr<const Request> r(group->PopNextPendingRequest());
+      UpdateStalledGroup(group);
       LogBoundConnectJobToRequest(job_log.source(), r.get());
       job->GetAdditionalErrorState(r->handle());
       RemoveConnectJob(job, group);
@@ -928,12 +899,7 @@ bool ClientSocketPoolBaseHelper::IsStalled() const {
   // than |max_sockets_per_group_|.  (If the number of jobs is equal to
   // |max_sockets_per_group_|, then the request is stalled on the group,
   // which does not count.)
-  for (GroupMap::const_iterator it = group_map_.begin();
-       it != group_map_.end(); ++it) {
-    if (it->second->IsStalledOnPoolMaxSockets(max_sockets_per_group_))
-      return true;
-  }
-  return false;
+  return FindTopStalledGroup(NULL, NULL);
 }
 
 void ClientSocketPoolBaseHelper::RemoveConnectJob(ConnectJob* job,
@@ -944,6 +910,7 @@ void ClientSocketPoolBaseHelper::RemoveConnectJob(ConnectJob* job,
   DCHECK(group);
   DCHECK(ContainsKey(group->jobs(), job));
   group->RemoveJob(job);
+  UpdateStalledGroup(group);
 
   // If we've got no more jobs for this group, then we no longer need a
   // backup job either.
@@ -959,17 +926,16 @@ void ClientSocketPoolBaseHelper::OnAvailableSocketSlot(
   DCHECK(ContainsKey(group_map_, group_name));
   if (group->IsEmpty())
     RemoveGroup(group_name);
-  else if (!group->pending_requests().empty())
+  else if (group->has_pending_requests())
     ProcessPendingRequest(group_name, group);
 }
 
 void ClientSocketPoolBaseHelper::ProcessPendingRequest(
     const std::string& group_name, Group* group) {
-  int rv = RequestSocketInternal(group_name,
-                                 *group->pending_requests().begin());
+  int rv = RequestSocketInternal(group_name, group->GetNextPendingRequest());
   if (rv != ERR_IO_PENDING) {
-    scoped_ptr<const Request> request(RemoveRequestFromQueue(
-          group->mutable_pending_requests()->begin(), group));
+    scoped_ptr<const Request> request(group->PopNextPendingRequest());
+    UpdateStalledGroup(group);
     if (group->IsEmpty())
       RemoveGroup(group_name);
 
@@ -1005,6 +971,7 @@ void ClientSocketPoolBaseHelper::HandOutSocket(
 
   handed_out_socket_count_++;
   group->IncrementActiveSocketCount();
+  UpdateStalledGroup(group);
 }
 
 void ClientSocketPoolBaseHelper::AddIdleSocket(
@@ -1016,6 +983,7 @@ void ClientSocketPoolBaseHelper::AddIdleSocket(
 
   group->mutable_idle_sockets()->push_back(idle_socket);
   IncrementIdleCount();
+  UpdateStalledGroup(group);
 }
 
 void ClientSocketPoolBaseHelper::CancelAllConnectJobs() {
@@ -1023,6 +991,7 @@ void ClientSocketPoolBaseHelper::CancelAllConnectJobs() {
     Group* group = i->second;
     connecting_socket_count_ -= group->jobs().size();
     group->RemoveAllJobs();
+    UpdateStalledGroup(group);
 
     // Delete group if no longer needed.
     if (group->IsEmpty()) {
@@ -1041,14 +1010,12 @@ void ClientSocketPoolBaseHelper::CancelAllRequestsWithError(int error) {
   for (GroupMap::iterator i = group_map_.begin(); i != group_map_.end();) {
     Group* group = i->second;
 
-    RequestQueue pending_requests;
-    pending_requests.swap(*group->mutable_pending_requests());
-    for (RequestQueue::iterator it2 = pending_requests.begin();
-         it2 != pending_requests.end(); ++it2) {
-      scoped_ptr<const Request> request(*it2);
+    while (group->has_pending_requests()) {
+      scoped_ptr<const Request> request(group->PopNextPendingRequest());
       InvokeUserCallbackLater(
           request->handle(), request->callback(), error);
     }
+    UpdateStalledGroup(group);
 
     // Delete group if no longer needed.
     if (group->IsEmpty()) {
@@ -1093,6 +1060,7 @@ bool ClientSocketPoolBaseHelper::CloseOneIdleSocketExceptInGroup(
       delete idle_sockets->front().socket;
       idle_sockets->pop_front();
       DecrementIdleCount();
+      UpdateStalledGroup(group);
       if (group->IsEmpty())
         RemoveGroup(i);
 
@@ -1149,9 +1117,13 @@ void ClientSocketPoolBaseHelper::TryToCloseSocketsInLayeredPools() {
   }
 }
 
-ClientSocketPoolBaseHelper::Group::Group()
-    : unassigned_job_count_(0),
+ClientSocketPoolBaseHelper::Group::Group(const std::string& group_name)
+    : group_name_(group_name),
+      unassigned_job_count_(0),
+      pending_requests_(kIgnoreLimitsPriorityOffset + NUM_PRIORITIES),
       active_socket_count_(0),
+      is_indexed_as_stalled_(false),
+      indexed_stalled_priority_(IDLE),
       weak_factory_(this) {}
 
 ClientSocketPoolBaseHelper::Group::~Group() {
@@ -1219,16 +1191,17 @@ void ClientSocketPoolBaseHelper::Group::OnBackupSocketTimerFired(
     return;
   }
 
-  if (pending_requests_.empty())
+  if (!has_pending_requests())
     return;
 
   ConnectJob* backup_job = pool->connect_job_factory_->NewConnectJob(
-      group_name, **pending_requests_.begin(), pool);
+      group_name, *GetNextPendingRequest(), pool);
   backup_job->net_log().AddEvent(NetLog::TYPE_SOCKET_BACKUP_CREATED);
   SIMPLE_STATS_COUNTER("socket.backup_created");
   int rv = backup_job->Connect();
   pool->connecting_socket_count_++;
   AddJob(backup_job, false);
+  pool->UpdateStalledGroup(this);
   if (rv != ERR_IO_PENDING)
     pool->OnConnectJobComplete(rv, backup_job);
 }
@@ -1237,6 +1210,64 @@ void ClientSocketPoolBaseHelper::Group::SanityCheck() {
   DCHECK_LE(unassigned_job_count_, jobs_.size());
 }
 
+const ClientSocketPoolBaseHelper::Request*
+ClientSocketPoolBaseHelper::Group::GetNextPendingRequest() {
+  RequestQueue::Pointer pointer = pending_requests_.FirstMax();
+  return pointer.is_null() ? NULL : pointer.value();
+}
+
+bool ClientSocketPoolBaseHelper::Group::HasConnectJobForHandle(
+    const ClientSocketHandle* handle) {
+  size_t i = 0;
+  for (RequestQueue::Pointer pointer = pending_requests_.FirstMax();
+       !pointer.is_null() && i < jobs_.size();
+       pointer = pending_requests_.GetNextTowardsLastMin(pointer), ++i) {
+    if (pointer.value()->handle() == handle)
+      return true;
+  }
+  return false;
+}
+
+void ClientSocketPoolBaseHelper::Group::InsertPendingRequest(
+    const Request* request) {
+  // TODO(mmenke):  Should the network stack require requests with
+  //                |ignore_limits| have the highest priority?
+  pending_requests_.Insert(
+      request,
+      request->ignore_limits() ?
+          kIgnoreLimitsPriorityOffset + request->priority() :
+          request->priority());
+}
+
+const ClientSocketPoolBaseHelper::Request*
+ClientSocketPoolBaseHelper::Group::PopNextPendingRequest() {
+  DCHECK(has_pending_requests());
+  return RemovePendingRequest(pending_requests_.FirstMax());
+}
+
+const ClientSocketPoolBaseHelper::Request*
+ClientSocketPoolBaseHelper::Group::FindAndRemovePendingRequest(
+    ClientSocketHandle* handle) {
+  for (RequestQueue::Pointer pointer = pending_requests_.FirstMax();
+       !pointer.is_null();
+       pointer = pending_requests_.GetNextTowardsLastMin(pointer)) {
+    if (pointer.value()->handle() == handle)
+      return RemovePendingRequest(pointer);
+  }
+  return NULL;
+}
+
+const ClientSocketPoolBaseHelper::Request*
+ClientSocketPoolBaseHelper::Group::RemovePendingRequest(
+    const RequestQueue::Pointer& pointer) {
+  const Request* request = pointer.value();
+  pending_requests_.Erase(pointer);
+  // If there are no more requests, we kill the backup timer.
+  if (!has_pending_requests())
+    CleanupBackupJob();
+  return request;
+}
+
 void ClientSocketPoolBaseHelper::Group::RemoveAllJobs() {
   SanityCheck();
 
@@ -43,6 +43,7 @@
 #include "net/base/net_export.h"
 #include "net/base/net_log.h"
 #include "net/base/network_change_notifier.h"
+#include "net/base/priority_queue.h"
 #include "net/base/request_priority.h"
 #include "net/socket/client_socket_pool.h"
 #include "net/socket/stream_socket.h"
@@ -337,7 +338,10 @@ class NET_EXPORT_PRIVATE ClientSocketPoolBaseHelper
     base::TimeTicks start_time;
   };
 
-  typedef std::deque<const Request* > RequestQueue;
+  // Pending requests are kept in FirstMax() order of a PriorityQueue with one
+  // level per RequestPriority, plus one level per RequestPriority above those
+  // for requests which ignore the socket pool limits.
+  typedef PriorityQueue<const Request*> RequestQueue;
   typedef std::map<const ClientSocketHandle*, const Request*> RequestMap;
 
   // A Group is allocated per group_name when there are idle sockets or pending
@@ -345,12 +349,14 @@ class NET_EXPORT_PRIVATE ClientSocketPoolBaseHelper
   // |active_socket_count| tracks the number of sockets held by clients.
   class Group {
    public:
-    Group();
+    explicit Group(const std::string& group_name);
     ~Group();
 
+    const std::string& group_name() const { return group_name_; }
+
     bool IsEmpty() const {
       return active_socket_count_ == 0 && idle_sockets_.empty() &&
-          jobs_.empty() && pending_requests_.empty();
+          jobs_.empty() && !has_pending_requests();
     }
 
     bool HasAvailableSocketSlot(int max_sockets_per_group) const {
@@ -367,8 +373,49 @@ class NET_EXPORT_PRIVATE ClientSocketPoolBaseHelper
           pending_requests_.size() > jobs_.size();
     }
 
-    RequestPriority TopPendingPriority() const {
-      return pending_requests_.front()->priority();
+    bool has_pending_requests() const {
+      return pending_requests_.size() > 0u;
+    }
+
+    size_t pending_request_count() const {
+      return pending_requests_.size();
+    }
+
+    // Returns the request that will be served next, or NULL if there are no
+    // pending requests.
+    const Request* GetNextPendingRequest();
+
+    // Returns true if |handle| is among the first jobs().size() pending
+    // requests, that is, if there is a ConnectJob that will serve it.
+    bool HasConnectJobForHandle(const ClientSocketHandle* handle);
+
+    // Inserts |request| into the queue based on the order in which requests
+    // will receive sockets.  Requests which ignore the socket pool limits are
+    // first.  Then requests are ordered by priority, with older requests
+    // served before newer requests of the same priority.
+    void InsertPendingRequest(const Request* request);
+
+    // Removes and returns the request that would be served next.  The queue
+    // must not be empty.
+    const Request* PopNextPendingRequest();
+
+    // Removes and returns the request for |handle|, or returns NULL if there
+    // is none.
+    const Request* FindAndRemovePendingRequest(ClientSocketHandle* handle);
+
+    RequestPriority TopPendingPriority() {
+      return GetNextPendingRequest()->priority();
+    }
+
+    // Whether the group is in the pool's |stalled_groups_| index, and the
+    // priority it was indexed with.  Only the pool should modify these.
+    bool is_indexed_as_stalled() const { return is_indexed_as_stalled_; }
+    RequestPriority indexed_stalled_priority() const {
+      return indexed_stalled_priority_;
+    }
+    void set_indexed_as_stalled(bool indexed, RequestPriority priority) {
+      is_indexed_as_stalled_ = indexed;
+      indexed_stalled_priority_ = priority;
     }
 
     bool HasBackupJob() const { return weak_factory_.HasWeakPtrs(); }
@@ -396,9 +443,7 @@ class NET_EXPORT_PRIVATE ClientSocketPoolBaseHelper
     int unassigned_job_count() const { return unassigned_job_count_; }
     const std::set<ConnectJob*>& jobs() const { return jobs_; }
     const std::list<IdleSocket>& idle_sockets() const { return idle_sockets_; }
-    const RequestQueue& pending_requests() const { return pending_requests_; }
     int active_socket_count() const { return active_socket_count_; }
-    RequestQueue* mutable_pending_requests() { return &pending_requests_; }
     std::list<IdleSocket>* mutable_idle_sockets() { return &idle_sockets_; }
 
    private:
@@ -411,6 +456,12 @@ class NET_EXPORT_PRIVATE ClientSocketPoolBaseHelper
     // ConnectJobs.
     void SanityCheck();
 
+    // Removes the request at |pointer| from the queue, and cancels the backup
+    // job if no requests remain.
+    const Request* RemovePendingRequest(const RequestQueue::Pointer& pointer);
+
+    const std::string group_name_;
+
     // Total number of ConnectJobs that have never been assigned to a Request.
     // Since jobs use late binding to requests, which ConnectJobs have or have
     // not been assigned to a request are not tracked.  This is incremented on
@@ -423,12 +474,21 @@ class NET_EXPORT_PRIVATE ClientSocketPoolBaseHelper
     std::set<ConnectJob*> jobs_;
     RequestQueue pending_requests_;
     int active_socket_count_;  // number of active sockets used by clients
+    bool is_indexed_as_stalled_;
+    RequestPriority indexed_stalled_priority_;
     // A factory to pin the backup_job tasks.
     base::WeakPtrFactory<Group> weak_factory_;
   };
 
   typedef std::map<std::string, Group*> GroupMap;
 
+  // Orders groups by the indexed priority of their top pending request,
+  // highest first.  Ties are broken by group name.
+  struct StalledGroupLess {
+    bool operator()(const Group* a, const Group* b) const;
+  };
+  typedef std::set<Group*, StalledGroupLess> StalledGroupSet;
+
   typedef std::set<ConnectJob*> ConnectJobSet;
 
   struct CallbackResultPair {
@@ -443,15 +503,6 @@ class NET_EXPORT_PRIVATE ClientSocketPoolBaseHelper
   typedef std::map<const ClientSocketHandle*, CallbackResultPair>
       PendingCallbackMap;
 
-  // Inserts the request into the queue based on order they will receive
-  // sockets. Sockets which ignore the socket pool limits are first. Then
-  // requests are sorted by priority, with higher priorities closer to the
-  // front. Older requests are prioritized over requests of equal priority.
-  static void InsertRequestIntoQueue(const Request* r,
-                                     RequestQueue* pending_requests);
-  static const Request* RemoveRequestFromQueue(const RequestQueue::iterator& it,
-                                               Group* group);
-
   Group* GetOrCreateGroup(const std::string& group_name);
   void RemoveGroup(const std::string& group_name);
   void RemoveGroup(GroupMap::iterator it);
@@ -463,12 +514,21 @@ class NET_EXPORT_PRIVATE ClientSocketPoolBaseHelper
   // Start cleanup timer for idle sockets.
   void StartIdleSocketTimer();
 
-  // Scans the group map for groups which have an available socket slot and
-  // at least one pending request. Returns true if any groups are stalled, and
-  // if so (and if both |group| and |group_name| are not NULL), fills |group|
-  // and |group_name| with data of the stalled group having highest priority.
+  // Returns true if any groups have an available socket slot and more pending
+  // requests than ConnectJobs, and if so (and if both |group| and |group_name|
+  // are not NULL), fills |group| and |group_name| with data of the stalled
+  // group having highest priority.
   bool FindTopStalledGroup(Group** group, std::string* group_name) const;
 
+  // Returns the group that FindTopStalledGroup() should find, by scanning all
+  // groups.  Used to check |stalled_groups_|.
+  Group* FindTopStalledGroupByScan() const;
+
+  // Adds |group| to, moves it within, or removes it from |stalled_groups_|.
+  // Must be called whenever anything that IsStalledOnPoolMaxSockets() or
+  // TopPendingPriority() depend on changes for |group|.
+  void UpdateStalledGroup(Group* group);
+
   // Called when timer_ fires.  This method scans the idle sockets removing
   // sockets that timed out or can't be reused.
   void OnCleanupTimerFired() {
@@ -547,6 +607,11 @@ class NET_EXPORT_PRIVATE ClientSocketPoolBaseHelper
 
   GroupMap group_map_;
 
+  // The groups which are stalled on the pool's socket limit, in the order in
+  // which they should be given freed socket slots.  Keeps finding the top
+  // stalled group from scanning all groups.
+  StalledGroupSet stalled_groups_;
+
   // Map of the ClientSocketHandles for which we have a pending Task to invoke a
   // callback.  This is necessary since, before we invoke said callback, it's
   // possible that the request is cancelled.
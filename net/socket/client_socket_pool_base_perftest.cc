@@ -0,0 +1,127 @@
+// Copyright (c) 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "base/bind.h"
+#include "base/bind_helpers.h"
+#include "base/memory/scoped_vector.h"
+#include "base/message_loop/message_loop.h"
+#include "base/perftimer.h"
+#include "base/strings/stringprintf.h"
+#include "net/base/net_errors.h"
+#include "net/base/net_log.h"
+#include "net/dns/mock_host_resolver.h"
+#include "net/socket/client_socket_handle.h"
+#include "net/socket/client_socket_pool_histograms.h"
+#include "net/socket/socket_test_util.h"
+#include "net/socket/transport_client_socket_pool.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace net {
+
+namespace {
+
+const int kNumGroups = 10000;
+const int kMaxSockets = 256;
+const int kMaxSocketsPerGroup = 6;
+
+class ClientSocketPoolBasePerfTest : public testing::Test {
+ protected:
+  ClientSocketPoolBasePerfTest()
+      : histograms_("PerfTest"),
+        pool_(kMaxSockets, kMaxSocketsPerGroup, &histograms_,
+              &host_resolver_, &client_socket_factory_, NULL),
+        params_(new TransportSocketParams(HostPortPair("www.google.com", 80),
+                                          LOW, false, false,
+                                          OnHostResolutionCallback())),
+        completion_count_(0) {
+    host_resolver_.set_synchronous_mode(true);
+    // Every connect, including those that wake up stalled groups, completes
+    // synchronously, so only the pool's own bookkeeping is measured.
+    for (int i = 0; i < kNumGroups; ++i) {
+      StaticSocketDataProvider* data = new StaticSocketDataProvider();
+      data->set_connect_data(MockConnect(SYNCHRONOUS, OK));
+      client_socket_factory_.AddSocketDataProvider(data);
+      socket_data_.push_back(data);
+    }
+  }
+
+  // Requests a socket for each of |kNumGroups| groups, with mixed priorities.
+  // All but the first |kMaxSockets| requests stall on the pool's limit.
+  void StallGroups(ScopedVector<ClientSocketHandle>* handles) {
+    for (int i = 0; i < kNumGroups; ++i) {
+      ClientSocketHandle* handle = new ClientSocketHandle();
+      handles->push_back(handle);
+      int rv = handle->Init(
+          base::StringPrintf("group%d", i), params_,
+          static_cast<RequestPriority>(i % NUM_PRIORITIES),
+          base::Bind(&ClientSocketPoolBasePerfTest::OnRequestComplete,
+                     base::Unretained(this)),
+          &pool_, BoundNetLog());
+      EXPECT_EQ(i < kMaxSockets ? OK : ERR_IO_PENDING, rv);
+    }
+  }
+
+  void OnRequestComplete(int result) {
+    EXPECT_EQ(OK, result);
+    ++completion_count_;
+  }
+
+  base::MessageLoopForIO message_loop_;
+  ClientSocketPoolHistograms histograms_;
+  MockHostResolver host_resolver_;
+  MockClientSocketFactory client_socket_factory_;
+  ScopedVector<StaticSocketDataProvider> socket_data_;
+  TransportClientSocketPool pool_;
+  scoped_refptr<TransportSocketParams> params_;
+  int completion_count_;
+};
+
+TEST_F(ClientSocketPoolBasePerfTest, ReleaseSocketsToStalledGroups) {
+  ScopedVector<ClientSocketHandle> handles;
+
+  PerfTimeLogger request_timer("Socket_pool_request_10000_groups");
+  StallGroups(&handles);
+  request_timer.Done();
+  EXPECT_TRUE(pool_.IsStalled());
+
+  // Each released socket is closed, which hands its slot to the top stalled
+  // group.  Groups are not woken up in index order, so keep sweeping over the
+  // handles until all of them have had a socket.
+  PerfTimeLogger release_timer("Socket_pool_release_to_stalled_groups");
+  int released = 0;
+  while (released < kNumGroups) {
+    for (int i = 0; i < kNumGroups; ++i) {
+      if (!handles[i]->socket())
+        continue;
+      handles[i]->socket()->Disconnect();
+      handles[i]->Reset();
+      ++released;
+    }
+  }
+  release_timer.Done();
+
+  EXPECT_FALSE(pool_.IsStalled());
+  EXPECT_EQ(0, pool_.IdleSocketCount());
+  base::MessageLoop::current()->RunUntilIdle();
+}
+
+TEST_F(ClientSocketPoolBasePerfTest, CancelStalledRequests) {
+  ScopedVector<ClientSocketHandle> handles;
+  StallGroups(&handles);
+
+  PerfTimeLogger cancel_timer("Socket_pool_cancel_stalled_requests");
+  for (int i = kNumGroups - 1; i >= kMaxSockets; --i)
+    handles[i]->Reset();
+  cancel_timer.Done();
+
+  EXPECT_FALSE(pool_.IsStalled());
+  for (int i = 0; i < kMaxSockets; ++i)
+    handles[i]->Reset();
+  base::MessageLoop::current()->RunUntilIdle();
+  EXPECT_EQ(0, completion_count_);
+}
+
+}  // namespace
+
+}  // namespace net
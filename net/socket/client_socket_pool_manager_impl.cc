@@ -43,6 +43,7 @@ ClientSocketPoolManagerImpl::ClientSocketPoolManagerImpl(
     const std::string& ssl_session_cache_shard,
     ProxyService* proxy_service,
     SSLConfigService* ssl_config_service,
+    const base::WeakPtr<HttpServerProperties>& http_server_properties,
     HttpNetworkSession::SocketPoolType pool_type)
     : net_log_(net_log),
       socket_factory_(socket_factory),
@@ -53,6 +54,7 @@ ClientSocketPoolManagerImpl::ClientSocketPoolManagerImpl(
       ssl_session_cache_shard_(ssl_session_cache_shard),
       proxy_service_(proxy_service),
       ssl_config_service_(ssl_config_service),
+      http_server_properties_(http_server_properties),
       pool_type_(pool_type),
       transport_pool_histograms_("TCP"),
       transport_socket_pool_(new TransportClientSocketPool(
@@ -83,6 +85,7 @@ ClientSocketPoolManagerImpl::ClientSocketPoolManagerImpl(
       ssl_for_https_proxy_pool_histograms_("SSLforHTTPSProxy"),
       http_proxy_pool_histograms_("HTTPProxy"),
       ssl_socket_pool_for_proxies_histograms_("SSLForProxies") {
+  transport_socket_pool_->SetHttpServerProperties(http_server_properties);
   CertDatabase::GetInstance()->AddObserver(this);
 }
 
@@ -220,6 +223,7 @@ SOCKSClientSocketPool* ClientSocketPoolManagerImpl::GetSocketPoolForSOCKSProxy(
                   socket_factory_,
                   net_log_)));
   DCHECK(tcp_ret.second);
+  tcp_ret.first->second->SetHttpServerProperties(http_server_properties_);
 
   std::pair<SOCKSSocketPoolMap::iterator, bool> ret =
       socks_socket_pools_.insert(
@@ -262,6 +266,8 @@ ClientSocketPoolManagerImpl::GetSocketPoolForHTTPProxy(
                   socket_factory_,
                   net_log_)));
   DCHECK(tcp_http_ret.second);
+  tcp_http_ret.first->second->SetHttpServerProperties(
+      http_server_properties_);
 
   std::pair<TransportSocketPoolMap::iterator, bool> tcp_https_ret =
       transport_socket_pools_for_https_proxies_.insert(
@@ -275,6 +281,8 @@ ClientSocketPoolManagerImpl::GetSocketPoolForHTTPProxy(
                   socket_factory_,
                   net_log_)));
   DCHECK(tcp_https_ret.second);
+  tcp_https_ret.first->second->SetHttpServerProperties(
+      http_server_properties_);
 
   std::pair<SSLSocketPoolMap::iterator, bool> ssl_https_ret =
       ssl_socket_pools_for_https_proxies_.insert(std::make_pair(
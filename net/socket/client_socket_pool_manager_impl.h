@@ -10,6 +10,7 @@
 #include "base/compiler_specific.h"
 #include "base/memory/ref_counted.h"
 #include "base/memory/scoped_ptr.h"
+#include "base/memory/weak_ptr.h"
 #include "base/stl_util.h"
 #include "base/template_util.h"
 #include "base/threading/non_thread_safe.h"
@@ -25,6 +26,7 @@ class ClientSocketFactory;
 class ClientSocketPoolHistograms;
 class HttpProxyClientSocketPool;
 class HostResolver;
+class HttpServerProperties;
 class NetLog;
 class ServerBoundCertService;
 class ProxyService;
@@ -65,6 +67,8 @@ class ClientSocketPoolManagerImpl : public base::NonThreadSafe,
                               const std::string& ssl_session_cache_shard,
                               ProxyService* proxy_service,
                               SSLConfigService* ssl_config_service,
+                              const base::WeakPtr<HttpServerProperties>&
+                                  http_server_properties,
                               HttpNetworkSession::SocketPoolType pool_type);
   virtual ~ClientSocketPoolManagerImpl();
 
@@ -111,6 +115,7 @@ class ClientSocketPoolManagerImpl : public base::NonThreadSafe,
   const std::string ssl_session_cache_shard_;
   ProxyService* const proxy_service_;
   const scoped_refptr<SSLConfigService> ssl_config_service_;
+  const base::WeakPtr<HttpServerProperties> http_server_properties_;
   const HttpNetworkSession::SocketPoolType pool_type_;
 
   // Note: this ordering is important.
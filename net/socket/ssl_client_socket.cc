@@ -5,6 +5,9 @@
 #include "net/socket/ssl_client_socket.h"
 
 #include "base/strings/string_util.h"
+#include "base/strings/stringprintf.h"
+#include "net/base/host_port_pair.h"
+#include "net/ssl/ssl_config_service.h"
 
 namespace net {
 
@@ -65,6 +68,18 @@ const char* SSLClientSocket::NextProtoToString(NextProto next_proto) {
   return "unknown";
 }
 
+// static
+std::string SSLClientSocket::GetSessionCacheKey(
+    const HostPortPair& host_and_port,
+    const std::string& shard,
+    const SSLConfig& ssl_config) {
+  return base::StringPrintf("%s/%s/%x-%x",
+                            host_and_port.ToString().c_str(),
+                            shard.c_str(),
+                            ssl_config.version_min,
+                            ssl_config.version_max);
+}
+
 // static
 const char* SSLClientSocket::NextProtoStatusToString(
     const SSLClientSocket::NextProtoStatus status) {
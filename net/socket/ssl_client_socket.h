@@ -13,12 +13,18 @@
 #include "net/socket/ssl_socket.h"
 #include "net/socket/stream_socket.h"
 
+namespace crypto {
+class SymmetricKey;
+}
+
 namespace net {
 
 class CertVerifier;
+class HostPortPair;
 class ServerBoundCertService;
 class SSLCertRequestInfo;
 class SSLInfo;
+struct SSLConfig;
 class TransportSecurityState;
 
 // This struct groups together several fields which are used by various
@@ -105,6 +111,28 @@ class NET_EXPORT SSLClientSocket : public SSLSocket {
   // sessions.
   static void ClearSessionCache();
 
+  // Serializes the sessions in the SSL session cache to |data|, so that they
+  // can be resumed after a restart. The sessions hold their master secrets,
+  // so |data| is encrypted and authenticated with keys derived from |key|,
+  // which must be an AES key. Returns false if the sessions can't be
+  // exported, which is the case with NSS.
+  static bool SerializeSessionCache(crypto::SymmetricKey* key,
+                                    std::string* data);
+
+  // Adds the sessions of |data|, written by SerializeSessionCache() with the
+  // same |key|, to the SSL session cache. Returns false, without parsing the
+  // sessions, if |data| was not written with |key| or was modified since.
+  static bool LoadSessionCache(crypto::SymmetricKey* key,
+                               const std::string& data);
+
+  // Returns the key of the sessions with |host_and_port| in the SSL session
+  // cache. A session is only resumed by sockets in the same shard of the
+  // cache, that allow the same range of protocol versions: a connection that
+  // fell back to an older version must not offer a newer session.
+  static std::string GetSessionCacheKey(const HostPortPair& host_and_port,
+                                        const std::string& shard,
+                                        const SSLConfig& ssl_config);
+
   virtual bool set_was_npn_negotiated(bool negotiated);
 
   virtual bool was_spdy_negotiated() const;
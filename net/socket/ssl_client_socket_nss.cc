@@ -88,6 +88,7 @@
 #include "net/base/connection_type_histograms.h"
 #include "net/base/dns_util.h"
 #include "net/base/io_buffer.h"
+#include "net/base/io_buffer_pool.h"
 #include "net/base/net_errors.h"
 #include "net/base/net_log.h"
 #include "net/cert/asn1_util.h"
@@ -2103,7 +2104,7 @@ int SSLClientSocketNSS::Core::BufferRecv() {
     // buffer too full to read into, so no I/O possible at moment
     rv = ERR_IO_PENDING;
   } else {
-    scoped_refptr<IOBuffer> read_buffer(new IOBuffer(nb));
+    scoped_refptr<IOBuffer> read_buffer(new PooledIOBuffer(nb));
     if (OnNetworkTaskRunner()) {
       rv = DoBufferRecv(read_buffer.get(), nb);
     } else {
@@ -2145,7 +2146,7 @@ int SSLClientSocketNSS::Core::BufferSend() {
 
   int rv = 0;
   if (len) {
-    scoped_refptr<IOBuffer> send_buffer(new IOBuffer(len));
+    scoped_refptr<IOBuffer> send_buffer(new PooledIOBuffer(len));
     memcpy(send_buffer->data(), buf1, len1);
     memcpy(send_buffer->data() + len1, buf2, len2);
 
@@ -2789,6 +2790,19 @@ void SSLClientSocket::ClearSessionCache() {
   SSL_ClearSessionCache();
 }
 
+// static
+bool SSLClientSocket::SerializeSessionCache(crypto::SymmetricKey* key,
+                                            std::string* data) {
+  // NSS has no API to export the sessions of its client cache.
+  return false;
+}
+
+// static
+bool SSLClientSocket::LoadSessionCache(crypto::SymmetricKey* key,
+                                       const std::string& data) {
+  return false;
+}
+
 bool SSLClientSocketNSS::GetSSLInfo(SSLInfo* ssl_info) {
   EnterFunction("");
   ssl_info->Reset();
@@ -3227,14 +3241,12 @@ int SSLClientSocketNSS::InitializeSSLPeerName() {
   // Set the peer ID for session reuse.  This is necessary when we create an
   // SSL tunnel through a proxy -- GetPeerName returns the proxy's address
   // rather than the destination server's address in that case.
-  std::string peer_id = host_and_port_.ToString();
-  // If the ssl_session_cache_shard_ is non-empty, we append it to the peer id.
-  // This will cause session cache misses between sockets with different values
-  // of ssl_session_cache_shard_ and this is used to partition the session cache
-  // for incognito mode.
-  if (!ssl_session_cache_shard_.empty()) {
-    peer_id += "/" + ssl_session_cache_shard_;
-  }
+  // The peer ID includes ssl_session_cache_shard_, which partitions the
+  // session cache for incognito mode, and the protocol versions of
+  // ssl_config_, so that sessions are not offered to a fallback connection.
+  std::string peer_id = GetSessionCacheKey(host_and_port_,
+                                           ssl_session_cache_shard_,
+                                           ssl_config_);
   SECStatus rv = SSL_SetSockPeerID(nss_fd_, const_cast<char*>(peer_id.c_str()));
   if (rv != SECSuccess)
     LogFailedNSSFunction(net_log_, "SSL_SetSockPeerID", peer_id.c_str());
@@ -15,13 +15,21 @@
 #include "base/callback_helpers.h"
 #include "base/memory/singleton.h"
 #include "base/metrics/histogram.h"
-#include "base/synchronization/lock.h"
+#include "base/pickle.h"
+#include "base/strings/string_piece.h"
+#include "crypto/encryptor.h"
+#include "crypto/hkdf.h"
+#include "crypto/hmac.h"
 #include "crypto/openssl_util.h"
+#include "crypto/random.h"
+#include "crypto/symmetric_key.h"
+#include "net/base/io_buffer_pool.h"
 #include "net/base/net_errors.h"
 #include "net/cert/cert_verifier.h"
 #include "net/cert/single_request_cert_verifier.h"
 #include "net/cert/x509_certificate_net_log_param.h"
 #include "net/socket/ssl_error_params.h"
+#include "net/socket/ssl_session_cache_openssl.h"
 #include "net/ssl/openssl_client_key_store.h"
 #include "net/ssl/ssl_cert_request_info.h"
 #include "net/ssl/ssl_connection_status_flags.h"
@@ -40,8 +48,18 @@ namespace {
 #define GotoState(s) next_handshake_state_ = s
 #endif
 
-const int kSessionCacheTimeoutSeconds = 60 * 60;
-const size_t kSessionCacheMaxEntires = 1024;
+const SSLSessionCacheOpenSSL::Config kSessionCacheConfig = {
+  1024,  // max_entries
+  60 * 60,  // timeout_seconds
+};
+
+// The serialized session cache is the random IV, followed by the sessions
+// encrypted with AES-CBC, followed by the HMAC-SHA256 of both.
+const size_t kSessionCacheIVSize = 16;
+const size_t kSessionCacheMACSize = 32;
+
+// The label of the HKDF that derives the keys of the session cache.
+const char kSessionCacheKeyLabel[] = "SSL session cache";
 
 // This constant can be any non-negative/non-zero value (eg: it does not
 // overlap with any value of the net::Error range, including net::OK).
@@ -214,112 +232,11 @@ int NoOpVerifyCallback(X509_STORE_CTX*, void *) {
   return 1;
 }
 
-// OpenSSL manages a cache of SSL_SESSION, this class provides the application
-// side policy for that cache about session re-use: we retain one session per
-// unique HostPortPair, per shard.
-class SSLSessionCache {
- public:
-  SSLSessionCache() {}
-
-  void OnSessionAdded(const HostPortPair& host_and_port,
-                      const std::string& shard,
-                      SSL_SESSION* session) {
-    // Declare the session cleaner-upper before the lock, so any call into
-    // OpenSSL to free the session will happen after the lock is released.
-    crypto::ScopedOpenSSL<SSL_SESSION, SSL_SESSION_free> session_to_free;
-    base::AutoLock lock(lock_);
-
-    DCHECK_EQ(0U, session_map_.count(session));
-    const std::string cache_key = GetCacheKey(host_and_port, shard);
-
-    std::pair<HostPortMap::iterator, bool> res =
-        host_port_map_.insert(std::make_pair(cache_key, session));
-    if (!res.second) {  // Already exists: replace old entry.
-      session_to_free.reset(res.first->second);
-      session_map_.erase(session_to_free.get());
-      res.first->second = session;
-    }
-    DVLOG(2) << "Adding session " << session << " => "
-             << cache_key << ", new entry = " << res.second;
-    DCHECK(host_port_map_[cache_key] == session);
-    session_map_[session] = res.first;
-    DCHECK_EQ(host_port_map_.size(), session_map_.size());
-    DCHECK_LE(host_port_map_.size(), kSessionCacheMaxEntires);
-  }
-
-  void OnSessionRemoved(SSL_SESSION* session) {
-    // Declare the session cleaner-upper before the lock, so any call into
-    // OpenSSL to free the session will happen after the lock is released.
-    crypto::ScopedOpenSSL<SSL_SESSION, SSL_SESSION_free> session_to_free;
-    base::AutoLock lock(lock_);
-
-    SessionMap::iterator it = session_map_.find(session);
-    if (it == session_map_.end())
-      return;
-    DVLOG(2) << "Remove session " << session << " => " << it->second->first;
-    DCHECK(it->second->second == session);
-    host_port_map_.erase(it->second);
-    session_map_.erase(it);
-    session_to_free.reset(session);
-    DCHECK_EQ(host_port_map_.size(), session_map_.size());
-  }
-
-  // Looks up the host:port in the cache, and if a session is found it is added
-  // to |ssl|, returning true on success.
-  bool SetSSLSession(SSL* ssl, const HostPortPair& host_and_port,
-                     const std::string& shard) {
-    base::AutoLock lock(lock_);
-    const std::string cache_key = GetCacheKey(host_and_port, shard);
-    HostPortMap::iterator it = host_port_map_.find(cache_key);
-    if (it == host_port_map_.end())
-      return false;
-    DVLOG(2) << "Lookup session: " << it->second << " => " << cache_key;
-    SSL_SESSION* session = it->second;
-    DCHECK(session);
-    DCHECK(session_map_[session] == it);
-    // Ideally we'd release |lock_| before calling into OpenSSL here, however
-    // that opens a small risk |session| will go out of scope before it is used.
-    // Alternatively we would take a temporary local refcount on |session|,
-    // except OpenSSL does not provide a public API for adding a ref (c.f.
-    // SSL_SESSION_free which decrements the ref).
-    return SSL_set_session(ssl, session) == 1;
-  }
-
-  // Flush removes all entries from the cache. This is called when a client
-  // certificate is added.
-  void Flush() {
-    for (HostPortMap::iterator i = host_port_map_.begin();
-         i != host_port_map_.end(); i++) {
-      SSL_SESSION_free(i->second);
-    }
-    host_port_map_.clear();
-    session_map_.clear();
-  }
-
- private:
-  static std::string GetCacheKey(const HostPortPair& host_and_port,
-                                 const std::string& shard) {
-    return host_and_port.ToString() + "/" + shard;
-  }
-
-  // A pair of maps to allow bi-directional lookups between host:port and an
-  // associated session.
-  typedef std::map<std::string, SSL_SESSION*> HostPortMap;
-  typedef std::map<SSL_SESSION*, HostPortMap::iterator> SessionMap;
-  HostPortMap host_port_map_;
-  SessionMap session_map_;
-
-  // Protects access to both the above maps.
-  base::Lock lock_;
-
-  DISALLOW_COPY_AND_ASSIGN(SSLSessionCache);
-};
-
 class SSLContext {
  public:
   static SSLContext* GetInstance() { return Singleton<SSLContext>::get(); }
   SSL_CTX* ssl_ctx() { return ssl_ctx_.get(); }
-  SSLSessionCache* session_cache() { return &session_cache_; }
+  SSLSessionCacheOpenSSL* session_cache() { return &session_cache_; }
 
   SSLClientSocketOpenSSL* GetClientSocketFromSSL(SSL* ssl) {
     DCHECK(ssl);
@@ -336,7 +253,7 @@ class SSLContext {
  private:
   friend struct DefaultSingletonTraits<SSLContext>;
 
-  SSLContext() {
+  SSLContext() : session_cache_(kSessionCacheConfig) {
     crypto::EnsureOpenSSLInit();
     ssl_socket_data_index_ = SSL_get_ex_new_index(0, 0, 0, 0, 0);
     DCHECK_NE(ssl_socket_data_index_, -1);
@@ -345,8 +262,9 @@ class SSLContext {
     SSL_CTX_set_session_cache_mode(ssl_ctx_.get(), SSL_SESS_CACHE_CLIENT);
     SSL_CTX_sess_set_new_cb(ssl_ctx_.get(), NewSessionCallbackStatic);
     SSL_CTX_sess_set_remove_cb(ssl_ctx_.get(), RemoveSessionCallbackStatic);
-    SSL_CTX_set_timeout(ssl_ctx_.get(), kSessionCacheTimeoutSeconds);
-    SSL_CTX_sess_set_cache_size(ssl_ctx_.get(), kSessionCacheMaxEntires);
+    SSL_CTX_set_timeout(ssl_ctx_.get(), kSessionCacheConfig.timeout_seconds);
+    SSL_CTX_sess_set_cache_size(ssl_ctx_.get(),
+                                kSessionCacheConfig.max_entries);
     SSL_CTX_set_client_cert_cb(ssl_ctx_.get(), ClientCertCallback);
 #if defined(OPENSSL_NPN_NEGOTIATED)
     // TODO(kristianm): Only select this if ssl_config_.next_proto is not empty.
@@ -363,9 +281,7 @@ class SSLContext {
 
   int NewSessionCallback(SSL* ssl, SSL_SESSION* session) {
     SSLClientSocketOpenSSL* socket = GetClientSocketFromSSL(ssl);
-    session_cache_.OnSessionAdded(socket->host_and_port(),
-                                  socket->ssl_session_cache_shard(),
-                                  session);
+    session_cache_.OnSessionAdded(socket->session_cache_key(), session);
     return 1;  // 1 => We took ownership of |session|.
   }
 
@@ -399,7 +315,7 @@ class SSLContext {
   // session_cache_ must appear before |ssl_ctx_| because the destruction of
   // |ssl_ctx_| may trigger callbacks into |session_cache_|. Therefore,
   // |session_cache_| must be destructed after |ssl_ctx_|.
-  SSLSessionCache session_cache_;
+  SSLSessionCacheOpenSSL session_cache_;
   crypto::ScopedOpenSSL<SSL_CTX, SSL_CTX_free> ssl_ctx_;
 };
 
@@ -416,6 +332,22 @@ struct SslSetClearMask {
   long clear_mask;
 };
 
+// Derives the key that encrypts the serialized session cache, and the key
+// that authenticates it, from |key|.
+bool DeriveSessionCacheKeys(crypto::SymmetricKey* key,
+                            scoped_ptr<crypto::SymmetricKey>* encryption_key,
+                            std::string* mac_key) {
+  std::string raw_key;
+  if (!key->GetRawKey(&raw_key))
+    return false;
+  crypto::HKDF hkdf(raw_key, base::StringPiece(), kSessionCacheKeyLabel,
+                    raw_key.size(), 0);
+  encryption_key->reset(crypto::SymmetricKey::Import(
+      crypto::SymmetricKey::AES, hkdf.client_write_key().as_string()));
+  hkdf.server_write_key().CopyToString(mac_key);
+  return encryption_key->get() != NULL;
+}
+
 }  // namespace
 
 // static
@@ -424,6 +356,72 @@ void SSLClientSocket::ClearSessionCache() {
   context->session_cache()->Flush();
 }
 
+// static
+bool SSLClientSocket::SerializeSessionCache(crypto::SymmetricKey* key,
+                                            std::string* data) {
+  DCHECK(key);
+  scoped_ptr<crypto::SymmetricKey> encryption_key;
+  std::string mac_key;
+  if (!DeriveSessionCacheKeys(key, &encryption_key, &mac_key))
+    return false;
+
+  Pickle pickle;
+  SSLContext::GetInstance()->session_cache()->Persist(&pickle);
+  base::StringPiece serialized(static_cast<const char*>(pickle.data()),
+                               pickle.size());
+  std::string iv(kSessionCacheIVSize, '\0');
+  crypto::RandBytes(&iv[0], iv.size());
+  crypto::Encryptor encryptor;
+  std::string ciphertext;
+  if (!encryptor.Init(encryption_key.get(), crypto::Encryptor::CBC, iv) ||
+      !encryptor.Encrypt(serialized, &ciphertext)) {
+    return false;
+  }
+
+  std::string authenticated = iv + ciphertext;
+  crypto::HMAC hmac(crypto::HMAC::SHA256);
+  unsigned char mac[kSessionCacheMACSize];
+  if (!hmac.Init(mac_key) || !hmac.Sign(authenticated, mac, sizeof(mac)))
+    return false;
+  *data = authenticated + std::string(reinterpret_cast<char*>(mac),
+                                      sizeof(mac));
+  return true;
+}
+
+// static
+bool SSLClientSocket::LoadSessionCache(crypto::SymmetricKey* key,
+                                       const std::string& data) {
+  DCHECK(key);
+  if (data.size() < kSessionCacheIVSize + kSessionCacheMACSize)
+    return false;
+  scoped_ptr<crypto::SymmetricKey> encryption_key;
+  std::string mac_key;
+  if (!DeriveSessionCacheKeys(key, &encryption_key, &mac_key))
+    return false;
+
+  // The MAC is checked before anything else is done with |data|, so that
+  // only sessions written by SerializeSessionCache() are decrypted and parsed
+  // by OpenSSL.
+  base::StringPiece authenticated(data.data(),
+                                  data.size() - kSessionCacheMACSize);
+  base::StringPiece mac(data.data() + authenticated.size(),
+                        kSessionCacheMACSize);
+  crypto::HMAC hmac(crypto::HMAC::SHA256);
+  if (!hmac.Init(mac_key) || !hmac.Verify(authenticated, mac))
+    return false;
+
+  crypto::Encryptor encryptor;
+  std::string plaintext;
+  if (!encryptor.Init(encryption_key.get(), crypto::Encryptor::CBC,
+                      authenticated.substr(0, kSessionCacheIVSize)) ||
+      !encryptor.Decrypt(authenticated.substr(kSessionCacheIVSize),
+                         &plaintext)) {
+    return false;
+  }
+  Pickle pickle(plaintext.data(), plaintext.size());
+  return SSLContext::GetInstance()->session_cache()->Load(pickle);
+}
+
 SSLClientSocketOpenSSL::SSLClientSocketOpenSSL(
     ClientSocketHandle* transport_socket,
     const HostPortPair& host_and_port,
@@ -443,6 +441,9 @@ SSLClientSocketOpenSSL::SSLClientSocketOpenSSL(
       host_and_port_(host_and_port),
       ssl_config_(ssl_config),
       ssl_session_cache_shard_(context.ssl_session_cache_shard),
+      session_cache_key_(GetSessionCacheKey(host_and_port,
+                                            ssl_session_cache_shard_,
+                                            ssl_config)),
       trying_cached_session_(false),
       next_handshake_state_(STATE_NONE),
       npn_status_(kNextProtoUnsupported),
@@ -468,8 +469,7 @@ bool SSLClientSocketOpenSSL::Init() {
     return false;
 
   trying_cached_session_ =
-      context->session_cache()->SetSSLSession(ssl_, host_and_port_,
-                                              ssl_session_cache_shard_);
+      context->session_cache()->SetSSLSession(ssl_, session_cache_key_);
 
   BIO* ssl_bio = NULL;
   // 0 => use default buffer sizes.
@@ -1029,7 +1029,8 @@ int SSLClientSocketOpenSSL::BufferSend(void) {
     size_t max_read = BIO_ctrl_pending(transport_bio_);
     if (!max_read)
       return 0;  // Nothing pending in the OpenSSL write BIO.
-    send_buffer_ = new DrainableIOBuffer(new IOBuffer(max_read), max_read);
+    send_buffer_ =
+        new DrainableIOBuffer(new PooledIOBuffer(max_read), max_read);
     int read_bytes = BIO_read(transport_bio_, send_buffer_->data(), max_read);
     DCHECK_GT(read_bytes, 0);
     CHECK_EQ(static_cast<int>(max_read), read_bytes);
@@ -1097,7 +1098,7 @@ int SSLClientSocketOpenSSL::BufferRecv(void) {
   if (!max_write)
     return ERR_IO_PENDING;
 
-  recv_buffer_ = new IOBuffer(max_write);
+  recv_buffer_ = new PooledIOBuffer(max_write);
   int rv = transport_->socket()->Read(
       recv_buffer_.get(),
       max_write,
@@ -51,6 +51,7 @@ class SSLClientSocketOpenSSL : public SSLClientSocket {
   const std::string& ssl_session_cache_shard() const {
     return ssl_session_cache_shard_;
   }
+  const std::string& session_cache_key() const { return session_cache_key_; }
 
   // Callback from the SSL layer that indicates the remote server is requesting
   // a certificate for this client.
@@ -181,6 +182,8 @@ class SSLClientSocketOpenSSL : public SSLClientSocket {
   // session cache. i.e. sessions created with one value will not attempt to
   // resume on the socket with a different value.
   const std::string ssl_session_cache_shard_;
+  // Key of the sessions of this socket in the session cache.
+  const std::string session_cache_key_;
 
   // Used for session cache diagnostics.
   bool trying_cached_session_;
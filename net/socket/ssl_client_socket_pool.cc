@@ -79,6 +79,11 @@ SSLSocketParams::~SSLSocketParams() {}
 // Timeout for the SSL handshake portion of the connect.
 static const int kSSLHandshakeTimeoutInSeconds = 30;
 
+// Whether the latency of the first handshake of the process was recorded.
+// The certificate verification results persisted across restarts matter
+// most to that handshake.
+static bool g_first_connection_latency_recorded = false;
+
 SSLConnectJob::SSLConnectJob(const std::string& group_name,
                              const scoped_refptr<SSLSocketParams>& params,
                              const base::TimeDelta& timeout_duration,
@@ -359,6 +364,14 @@ int SSLConnectJob::DoSSLConnectComplete(int result) {
                                base::TimeDelta::FromMilliseconds(1),
                                base::TimeDelta::FromMinutes(1),
                                100);
+    if (!g_first_connection_latency_recorded) {
+      g_first_connection_latency_recorded = true;
+      UMA_HISTOGRAM_CUSTOM_TIMES("Net.SSL_Connection_Latency_First",
+                                 connect_duration,
+                                 base::TimeDelta::FromMilliseconds(1),
+                                 base::TimeDelta::FromMinutes(1),
+                                 100);
+    }
 
     SSLInfo ssl_info;
     ssl_socket_->GetSSLInfo(&ssl_info);
@@ -367,6 +380,12 @@ int SSLConnectJob::DoSSLConnectComplete(int result) {
                                 SSLConnectionStatusToCipherSuite(
                                     ssl_info.connection_status));
 
+    if (ssl_info.handshake_type != SSLInfo::HANDSHAKE_UNKNOWN) {
+      UMA_HISTOGRAM_BOOLEAN(
+          "Net.SSL_Session_Resumed",
+          ssl_info.handshake_type == SSLInfo::HANDSHAKE_RESUME);
+    }
+
     if (ssl_info.handshake_type == SSLInfo::HANDSHAKE_RESUME) {
       UMA_HISTOGRAM_CUSTOM_TIMES("Net.SSL_Connection_Latency_Resume_Handshake",
                                  connect_duration,
@@ -6,6 +6,7 @@
 
 #include "base/callback_helpers.h"
 #include "base/memory/ref_counted.h"
+#include "crypto/symmetric_key.h"
 #include "net/base/address_list.h"
 #include "net/base/io_buffer.h"
 #include "net/base/net_errors.h"
@@ -23,6 +24,7 @@
 #include "net/socket/tcp_client_socket.h"
 #include "net/ssl/ssl_cert_request_info.h"
 #include "net/ssl/ssl_config_service.h"
+#include "net/ssl/ssl_info.h"
 #include "net/test/cert_test_util.h"
 #include "net/test/spawned_test_server/spawned_test_server.h"
 #include "testing/gtest/include/gtest/gtest.h"
@@ -520,6 +522,37 @@ class SSLClientSocketTest : public PlatformTest {
                                                   context_);
   }
 
+  // Connects to |test_server| with |ssl_config|, and sets |handshake_type|
+  // to whether the connection resumed a session.
+  void ConnectToTestServer(const net::SpawnedTestServer& test_server,
+                           const net::SSLConfig& ssl_config,
+                           net::SSLInfo::HandshakeType* handshake_type) {
+    net::AddressList addr;
+    ASSERT_TRUE(test_server.GetAddressList(&addr));
+
+    net::TestCompletionCallback callback;
+    net::CapturingNetLog log;
+    scoped_ptr<net::StreamSocket> transport(
+        new net::TCPClientSocket(addr, &log, net::NetLog::Source()));
+    int rv = transport->Connect(callback.callback());
+    if (rv == net::ERR_IO_PENDING)
+      rv = callback.WaitForResult();
+    ASSERT_EQ(net::OK, rv);
+
+    scoped_ptr<net::SSLClientSocket> sock(
+        CreateSSLClientSocket(transport.release(),
+                              test_server.host_port_pair(),
+                              ssl_config));
+    rv = sock->Connect(callback.callback());
+    if (rv == net::ERR_IO_PENDING)
+      rv = callback.WaitForResult();
+    ASSERT_EQ(net::OK, rv);
+
+    net::SSLInfo ssl_info;
+    ASSERT_TRUE(sock->GetSSLInfo(&ssl_info));
+    *handshake_type = ssl_info.handshake_type;
+  }
+
   net::ClientSocketFactory* socket_factory_;
   scoped_ptr<net::MockCertVerifier> cert_verifier_;
   scoped_ptr<net::TransportSecurityState> transport_security_state_;
@@ -1624,6 +1657,91 @@ TEST(SSLClientSocket, ClearSessionCache) {
   net::SSLClientSocket::ClearSessionCache();
 }
 
+// Connects to a test server several times, and checks that all connections
+// but the first resume a session.
+TEST_F(SSLClientSocketTest, SessionResumption) {
+  net::SpawnedTestServer test_server(net::SpawnedTestServer::TYPE_HTTPS,
+                                     net::SpawnedTestServer::kLocalhost,
+                                     base::FilePath());
+  ASSERT_TRUE(test_server.Start());
+  net::SSLClientSocket::ClearSessionCache();
+
+  const int kConnections = 5;
+  int resumed_connections = 0;
+  for (int i = 0; i < kConnections; ++i) {
+    net::SSLInfo::HandshakeType handshake_type =
+        net::SSLInfo::HANDSHAKE_UNKNOWN;
+    ASSERT_NO_FATAL_FAILURE(
+        ConnectToTestServer(test_server, kDefaultSSLConfig, &handshake_type));
+    if (handshake_type == net::SSLInfo::HANDSHAKE_RESUME)
+      ++resumed_connections;
+  }
+  EXPECT_EQ(kConnections - 1, resumed_connections);
+
+  // A connection that allows other protocol versions does not offer the
+  // session.
+  net::SSLConfig ssl_config;
+  ssl_config.version_min = net::SSL_PROTOCOL_VERSION_TLS1;
+  net::SSLInfo::HandshakeType handshake_type = net::SSLInfo::HANDSHAKE_UNKNOWN;
+  ASSERT_NO_FATAL_FAILURE(
+      ConnectToTestServer(test_server, ssl_config, &handshake_type));
+  EXPECT_EQ(net::SSLInfo::HANDSHAKE_FULL, handshake_type);
+}
+
+#if defined(USE_OPENSSL)
+// Checks that sessions resume after the session cache is serialized, cleared
+// and loaded again, as after a restart.
+TEST_F(SSLClientSocketTest, SerializeSessionCache) {
+  net::SpawnedTestServer test_server(net::SpawnedTestServer::TYPE_HTTPS,
+                                     net::SpawnedTestServer::kLocalhost,
+                                     base::FilePath());
+  ASSERT_TRUE(test_server.Start());
+  net::SSLClientSocket::ClearSessionCache();
+
+  net::SSLInfo::HandshakeType handshake_type = net::SSLInfo::HANDSHAKE_UNKNOWN;
+  ASSERT_NO_FATAL_FAILURE(
+      ConnectToTestServer(test_server, kDefaultSSLConfig, &handshake_type));
+  EXPECT_EQ(net::SSLInfo::HANDSHAKE_FULL, handshake_type);
+
+  scoped_ptr<crypto::SymmetricKey> key(
+      crypto::SymmetricKey::GenerateRandomKey(crypto::SymmetricKey::AES, 128));
+  ASSERT_TRUE(key.get());
+  std::string data;
+  ASSERT_TRUE(net::SSLClientSocket::SerializeSessionCache(key.get(), &data));
+  net::SSLClientSocket::ClearSessionCache();
+
+  ASSERT_TRUE(net::SSLClientSocket::LoadSessionCache(key.get(), data));
+  ASSERT_NO_FATAL_FAILURE(
+      ConnectToTestServer(test_server, kDefaultSSLConfig, &handshake_type));
+  EXPECT_EQ(net::SSLInfo::HANDSHAKE_RESUME, handshake_type);
+}
+
+// Checks that the serialized session cache is only loaded with the key it was
+// written with, and if it was not modified.
+TEST_F(SSLClientSocketTest, LoadSessionCacheRejectsTamperedData) {
+  scoped_ptr<crypto::SymmetricKey> key(
+      crypto::SymmetricKey::GenerateRandomKey(crypto::SymmetricKey::AES, 128));
+  scoped_ptr<crypto::SymmetricKey> other_key(
+      crypto::SymmetricKey::GenerateRandomKey(crypto::SymmetricKey::AES, 128));
+  ASSERT_TRUE(key.get());
+  ASSERT_TRUE(other_key.get());
+  std::string data;
+  ASSERT_TRUE(net::SSLClientSocket::SerializeSessionCache(key.get(), &data));
+
+  EXPECT_FALSE(net::SSLClientSocket::LoadSessionCache(other_key.get(), data));
+  EXPECT_FALSE(net::SSLClientSocket::LoadSessionCache(
+      key.get(), data.substr(0, data.size() - 1)));
+  // Flip a bit of the IV, of the ciphertext and of the MAC in turn.
+  const size_t positions[] = { 0, 16, data.size() - 1 };
+  for (size_t i = 0; i < arraysize(positions); ++i) {
+    std::string tampered(data);
+    tampered[positions[i]] ^= 1;
+    EXPECT_FALSE(net::SSLClientSocket::LoadSessionCache(key.get(), tampered));
+  }
+  EXPECT_TRUE(net::SSLClientSocket::LoadSessionCache(key.get(), data));
+}
+#endif  // defined(USE_OPENSSL)
+
 // This tests that SSLInfo contains a properly re-constructed certificate
 // chain. That, in turn, verifies that GetSSLInfo is giving us the chain as
 // verified, not the chain as served by the server. (They may be different.)
@@ -34,6 +34,7 @@
 #include "crypto/rsa_private_key.h"
 #include "crypto/nss_util_internal.h"
 #include "net/base/io_buffer.h"
+#include "net/base/io_buffer_pool.h"
 #include "net/base/net_errors.h"
 #include "net/base/net_log.h"
 #include "net/socket/nss_ssl_util.h"
@@ -571,7 +572,7 @@ int SSLServerSocketNSS::BufferRecv(void) {
     // buffer too full to read into, so no I/O possible at moment
     rv = ERR_IO_PENDING;
   } else {
-    recv_buffer_ = new IOBuffer(nb);
+    recv_buffer_ = new PooledIOBuffer(nb);
     rv = transport_socket_->Read(
         recv_buffer_.get(),
         nb,
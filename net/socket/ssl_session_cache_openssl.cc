@@ -0,0 +1,221 @@
+// Copyright 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "net/socket/ssl_session_cache_openssl.h"
+
+#include <openssl/ssl.h>
+#include <time.h>
+
+#include <algorithm>
+#include <utility>
+
+#include "base/logging.h"
+#include "base/metrics/histogram.h"
+#include "base/pickle.h"
+
+namespace net {
+
+namespace {
+
+// Version of the format written by Persist(). Increment it when the format
+// changes; Load() ignores other versions.
+const int kPickleVersion = 1;
+
+void FreeSessions(const std::vector<SSL_SESSION*>& sessions) {
+  for (size_t i = 0; i < sessions.size(); ++i)
+    SSL_SESSION_free(sessions[i]);
+}
+
+}  // namespace
+
+SSLSessionCacheOpenSSL::SSLSessionCacheOpenSSL(const Config& config)
+    : config_(config),
+      key_map_(KeyMap::NO_AUTO_EVICT) {
+  DCHECK_LT(0U, config_.max_entries);
+}
+
+SSLSessionCacheOpenSSL::~SSLSessionCacheOpenSSL() {
+  Flush();
+}
+
+void SSLSessionCacheOpenSSL::OnSessionAdded(const std::string& cache_key,
+                                            SSL_SESSION* session) {
+  // Sessions are freed after the lock is released, so that no call into
+  // OpenSSL to free them happens under it.
+  std::vector<SSL_SESSION*> sessions_to_free;
+  {
+    base::AutoLock lock(lock_);
+    DCHECK_EQ(0U, session_map_.count(session));
+    DVLOG(2) << "Adding session " << session << " => " << cache_key;
+    InsertLocked(cache_key, session, &sessions_to_free);
+  }
+  FreeSessions(sessions_to_free);
+}
+
+void SSLSessionCacheOpenSSL::OnSessionRemoved(SSL_SESSION* session) {
+  std::vector<SSL_SESSION*> sessions_to_free;
+  {
+    base::AutoLock lock(lock_);
+    SessionMap::iterator it = session_map_.find(session);
+    if (it == session_map_.end())
+      return;
+    DVLOG(2) << "Remove session " << session << " => " << it->second;
+    KeyMap::iterator key_it = key_map_.Peek(it->second);
+    DCHECK(key_it != key_map_.end());
+    sessions_to_free.push_back(EraseLocked(key_it));
+  }
+  FreeSessions(sessions_to_free);
+}
+
+bool SSLSessionCacheOpenSSL::SetSSLSession(SSL* ssl,
+                                           const std::string& cache_key) {
+  std::vector<SSL_SESSION*> sessions_to_free;
+  bool found = false;
+  bool set = false;
+  {
+    base::AutoLock lock(lock_);
+    KeyMap::iterator it = key_map_.Get(cache_key);
+    if (it != key_map_.end()) {
+      SSL_SESSION* session = it->second;
+      DCHECK(session);
+      DCHECK(session_map_[session] == cache_key);
+      if (IsExpired(session)) {
+        DVLOG(2) << "Expired session: " << session << " => " << cache_key;
+        sessions_to_free.push_back(EraseLocked(it));
+      } else {
+        DVLOG(2) << "Lookup session: " << session << " => " << cache_key;
+        found = true;
+        // Ideally we'd release |lock_| before calling into OpenSSL here,
+        // however that opens a small risk |session| will go out of scope
+        // before it is used. Alternatively we would take a temporary local
+        // refcount on |session|, except OpenSSL does not provide a public API
+        // for adding a ref (c.f. SSL_SESSION_free which decrements the ref).
+        set = SSL_set_session(ssl, session) == 1;
+      }
+    }
+  }
+  FreeSessions(sessions_to_free);
+  UMA_HISTOGRAM_BOOLEAN("Net.SSL_Session_Cache_Hit", found);
+  return set;
+}
+
+void SSLSessionCacheOpenSSL::Flush() {
+  std::vector<SSL_SESSION*> sessions_to_free;
+  {
+    base::AutoLock lock(lock_);
+    for (KeyMap::iterator it = key_map_.begin(); it != key_map_.end(); ++it)
+      sessions_to_free.push_back(it->second);
+    key_map_.Clear();
+    session_map_.clear();
+  }
+  FreeSessions(sessions_to_free);
+}
+
+size_t SSLSessionCacheOpenSSL::size() const {
+  base::AutoLock lock(lock_);
+  return key_map_.size();
+}
+
+void SSLSessionCacheOpenSSL::Persist(Pickle* pickle) const {
+  std::vector<std::pair<std::string, std::string> > entries;
+  {
+    base::AutoLock lock(lock_);
+    for (KeyMap::const_reverse_iterator it = key_map_.rbegin();
+         it != key_map_.rend(); ++it) {
+      if (IsExpired(it->second))
+        continue;
+      int length = i2d_SSL_SESSION(it->second, NULL);
+      if (length <= 0)
+        continue;
+      std::string der(length, '\0');
+      unsigned char* der_data = reinterpret_cast<unsigned char*>(&der[0]);
+      if (i2d_SSL_SESSION(it->second, &der_data) != length)
+        continue;
+      entries.push_back(std::make_pair(it->first, der));
+    }
+  }
+
+  pickle->WriteInt(kPickleVersion);
+  pickle->WriteInt(entries.size());
+  for (size_t i = 0; i < entries.size(); ++i) {
+    pickle->WriteString(entries[i].first);
+    pickle->WriteData(entries[i].second.data(), entries[i].second.size());
+  }
+}
+
+bool SSLSessionCacheOpenSSL::Load(const Pickle& pickle) {
+  PickleIterator iter(pickle);
+  int version = 0;
+  int count = 0;
+  if (!iter.ReadInt(&version) || version != kPickleVersion ||
+      !iter.ReadLength(&count)) {
+    return false;
+  }
+
+  std::vector<SSL_SESSION*> sessions_to_free;
+  bool valid = true;
+  {
+    base::AutoLock lock(lock_);
+    for (int i = 0; i < count; ++i) {
+      std::string cache_key;
+      const char* der = NULL;
+      int length = 0;
+      if (!iter.ReadString(&cache_key) || !iter.ReadData(&der, &length)) {
+        valid = false;
+        break;
+      }
+      const unsigned char* der_data =
+          reinterpret_cast<const unsigned char*>(der);
+      SSL_SESSION* session = d2i_SSL_SESSION(NULL, &der_data, length);
+      if (!session) {
+        valid = false;
+        break;
+      }
+      if (IsExpired(session) || key_map_.Peek(cache_key) != key_map_.end()) {
+        sessions_to_free.push_back(session);
+        continue;
+      }
+      InsertLocked(cache_key, session, &sessions_to_free);
+    }
+  }
+  FreeSessions(sessions_to_free);
+  return valid;
+}
+
+bool SSLSessionCacheOpenSSL::IsExpired(SSL_SESSION* session) const {
+  long timeout = std::min(SSL_SESSION_get_timeout(session),
+                          static_cast<long>(config_.timeout_seconds));
+  return SSL_SESSION_get_time(session) + timeout <= time(NULL);
+}
+
+void SSLSessionCacheOpenSSL::InsertLocked(
+    const std::string& cache_key,
+    SSL_SESSION* session,
+    std::vector<SSL_SESSION*>* sessions_to_free) {
+  lock_.AssertAcquired();
+  KeyMap::iterator it = key_map_.Peek(cache_key);
+  if (it != key_map_.end())  // Already exists: replace old entry.
+    sessions_to_free->push_back(EraseLocked(it));
+  while (key_map_.size() >= config_.max_entries) {
+    KeyMap::iterator oldest = key_map_.end();
+    --oldest;
+    DVLOG(2) << "Evicting session " << oldest->second << " => "
+             << oldest->first;
+    sessions_to_free->push_back(EraseLocked(oldest));
+  }
+  key_map_.Put(cache_key, session);
+  session_map_[session] = cache_key;
+  DCHECK_EQ(key_map_.size(), session_map_.size());
+}
+
+SSL_SESSION* SSLSessionCacheOpenSSL::EraseLocked(KeyMap::iterator it) {
+  lock_.AssertAcquired();
+  SSL_SESSION* session = it->second;
+  session_map_.erase(session);
+  key_map_.Erase(it);
+  DCHECK_EQ(key_map_.size(), session_map_.size());
+  return session;
+}
+
+}  // namespace net
@@ -0,0 +1,112 @@
+// Copyright 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef NET_SOCKET_SSL_SESSION_CACHE_OPENSSL_H_
+#define NET_SOCKET_SSL_SESSION_CACHE_OPENSSL_H_
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "base/basictypes.h"
+#include "base/containers/mru_cache.h"
+#include "base/synchronization/lock.h"
+#include "net/base/net_export.h"
+
+class Pickle;
+
+// Avoid including <openssl/ssl.h> here.
+typedef struct ssl_st SSL;
+typedef struct ssl_session_st SSL_SESSION;
+
+namespace net {
+
+// OpenSSL manages a cache of SSL_SESSION, this class provides the application
+// side policy for that cache about session re-use: we retain one session per
+// cache key, which identifies the server and the settings the session may be
+// resumed with (see SSLClientSocket::GetSessionCacheKey()). Once the cache
+// is full, the least recently used session is evicted.
+//
+// The cache is shared by all the sockets of the process. All methods are
+// thread safe.
+class NET_EXPORT_PRIVATE SSLSessionCacheOpenSSL {
+ public:
+  struct Config {
+    // The maximum number of sessions in the cache.
+    size_t max_entries;
+    // Sessions are not resumed, nor persisted, once they are older than
+    // this.
+    int timeout_seconds;
+  };
+
+  explicit SSLSessionCacheOpenSSL(const Config& config);
+  ~SSLSessionCacheOpenSSL();
+
+  const Config& config() const { return config_; }
+
+  // Called when a new |session| was negotiated for |cache_key|. Takes
+  // ownership of a reference to |session|, and replaces any older session of
+  // |cache_key|.
+  void OnSessionAdded(const std::string& cache_key, SSL_SESSION* session);
+
+  // Called when OpenSSL removes |session| from its own cache, e.g. because
+  // it became invalid.
+  void OnSessionRemoved(SSL_SESSION* session);
+
+  // Looks up |cache_key| in the cache, and if a session that has not expired
+  // is found it is added to |ssl|, returning true on success.
+  bool SetSSLSession(SSL* ssl, const std::string& cache_key);
+
+  // Flush removes all entries from the cache. This is called when a client
+  // certificate is added.
+  void Flush();
+
+  size_t size() const;
+
+  // Writes the sessions that have not expired to |pickle|, from the least
+  // to the most recently used.
+  void Persist(Pickle* pickle) const;
+
+  // Adds the sessions of |pickle|, written by Persist(), to the cache, which
+  // is meant to be done at startup. Sessions of keys that are already in the
+  // cache are ignored. Returns false if |pickle| is malformed. The sessions
+  // are parsed by OpenSSL, so |pickle| must be authenticated first, as
+  // SSLClientSocket::LoadSessionCache() does.
+  bool Load(const Pickle& pickle);
+
+ private:
+  typedef base::MRUCache<std::string, SSL_SESSION*> KeyMap;
+  typedef std::map<SSL_SESSION*, std::string> SessionMap;
+
+  // Returns true if |session| is too old to be resumed.
+  bool IsExpired(SSL_SESSION* session) const;
+
+  // Adds |session| as the most recently used session of |cache_key|,
+  // evicting the session it replaces and, if the cache is full, the least
+  // recently used one. The evicted sessions are appended to
+  // |sessions_to_free|, to be freed once |lock_| is released.
+  void InsertLocked(const std::string& cache_key,
+                    SSL_SESSION* session,
+                    std::vector<SSL_SESSION*>* sessions_to_free);
+
+  // Removes the entry at |it| from both maps, and returns its session, to be
+  // freed once |lock_| is released.
+  SSL_SESSION* EraseLocked(KeyMap::iterator it);
+
+  const Config config_;
+
+  // A pair of maps to allow bi-directional lookups between cache keys and
+  // their sessions. |key_map_| is ordered by recency of use.
+  KeyMap key_map_;
+  SessionMap session_map_;
+
+  // Protects access to both the above maps.
+  mutable base::Lock lock_;
+
+  DISALLOW_COPY_AND_ASSIGN(SSLSessionCacheOpenSSL);
+};
+
+}  // namespace net
+
+#endif  // NET_SOCKET_SSL_SESSION_CACHE_OPENSSL_H_
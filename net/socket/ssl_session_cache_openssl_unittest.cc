@@ -0,0 +1,145 @@
+// Copyright 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "net/socket/ssl_session_cache_openssl.h"
+
+#include <openssl/ssl.h>
+#include <time.h>
+
+#include "base/pickle.h"
+#include "crypto/openssl_util.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace net {
+
+namespace {
+
+typedef crypto::ScopedOpenSSL<SSL, SSL_free> ScopedSSL;
+typedef crypto::ScopedOpenSSL<SSL_CTX, SSL_CTX_free> ScopedSSL_CTX;
+
+const int kTimeoutSeconds = 60;
+
+class SSLSessionCacheOpenSSLTest : public testing::Test {
+ public:
+  SSLSessionCacheOpenSSLTest() {
+    crypto::EnsureOpenSSLInit();
+    ctx_.reset(SSL_CTX_new(SSLv23_client_method()));
+  }
+
+ protected:
+  static SSLSessionCacheOpenSSL::Config MakeConfig(size_t max_entries) {
+    SSLSessionCacheOpenSSL::Config config;
+    config.max_entries = max_entries;
+    config.timeout_seconds = kTimeoutSeconds;
+    return config;
+  }
+
+  // Returns the session that |cache| sets for |cache_key|, or NULL.
+  SSL_SESSION* Lookup(SSLSessionCacheOpenSSL* cache,
+                      const std::string& cache_key) {
+    ScopedSSL ssl(SSL_new(ctx_.get()));
+    if (!cache->SetSSLSession(ssl.get(), cache_key))
+      return NULL;
+    return SSL_get_session(ssl.get());
+  }
+
+  ScopedSSL_CTX ctx_;
+};
+
+TEST_F(SSLSessionCacheOpenSSLTest, Basic) {
+  SSLSessionCacheOpenSSL cache(MakeConfig(10));
+  SSL_SESSION* session_a = SSL_SESSION_new();
+  SSL_SESSION* session_b = SSL_SESSION_new();
+  cache.OnSessionAdded("a", session_a);
+  cache.OnSessionAdded("b", session_b);
+  EXPECT_EQ(2U, cache.size());
+
+  EXPECT_EQ(session_a, Lookup(&cache, "a"));
+  EXPECT_EQ(session_b, Lookup(&cache, "b"));
+  EXPECT_EQ(NULL, Lookup(&cache, "c"));
+
+  cache.Flush();
+  EXPECT_EQ(0U, cache.size());
+  EXPECT_EQ(NULL, Lookup(&cache, "a"));
+}
+
+TEST_F(SSLSessionCacheOpenSSLTest, ReplacesSessionOfSameKey) {
+  SSLSessionCacheOpenSSL cache(MakeConfig(10));
+  SSL_SESSION* session_1 = SSL_SESSION_new();
+  SSL_SESSION* session_2 = SSL_SESSION_new();
+  cache.OnSessionAdded("a", session_1);
+  cache.OnSessionAdded("a", session_2);
+  EXPECT_EQ(1U, cache.size());
+  EXPECT_EQ(session_2, Lookup(&cache, "a"));
+}
+
+TEST_F(SSLSessionCacheOpenSSLTest, EvictsLeastRecentlyUsed) {
+  SSLSessionCacheOpenSSL cache(MakeConfig(2));
+  SSL_SESSION* session_a = SSL_SESSION_new();
+  cache.OnSessionAdded("a", session_a);
+  cache.OnSessionAdded("b", SSL_SESSION_new());
+
+  // Using "a" makes "b" the least recently used session.
+  EXPECT_EQ(session_a, Lookup(&cache, "a"));
+  SSL_SESSION* session_c = SSL_SESSION_new();
+  cache.OnSessionAdded("c", session_c);
+  EXPECT_EQ(2U, cache.size());
+  EXPECT_EQ(NULL, Lookup(&cache, "b"));
+  EXPECT_EQ(session_a, Lookup(&cache, "a"));
+  EXPECT_EQ(session_c, Lookup(&cache, "c"));
+}
+
+TEST_F(SSLSessionCacheOpenSSLTest, ExpiredSessionIsNotResumed) {
+  SSLSessionCacheOpenSSL cache(MakeConfig(10));
+  SSL_SESSION* session = SSL_SESSION_new();
+  // The session's own timeout is longer than the cache's.
+  SSL_SESSION_set_timeout(session, 10 * kTimeoutSeconds);
+  SSL_SESSION_set_time(session, time(NULL) - 2 * kTimeoutSeconds);
+  cache.OnSessionAdded("a", session);
+  EXPECT_EQ(1U, cache.size());
+
+  EXPECT_EQ(NULL, Lookup(&cache, "a"));
+  EXPECT_EQ(0U, cache.size());
+}
+
+TEST_F(SSLSessionCacheOpenSSLTest, OnSessionRemoved) {
+  SSLSessionCacheOpenSSL cache(MakeConfig(10));
+  SSL_SESSION* session_a = SSL_SESSION_new();
+  SSL_SESSION* session_b = SSL_SESSION_new();
+  cache.OnSessionAdded("a", session_a);
+  cache.OnSessionAdded("b", session_b);
+
+  cache.OnSessionRemoved(session_a);
+  EXPECT_EQ(1U, cache.size());
+  EXPECT_EQ(NULL, Lookup(&cache, "a"));
+  EXPECT_EQ(session_b, Lookup(&cache, "b"));
+
+  // Sessions that are not in the cache are ignored.
+  SSL_SESSION* other_session = SSL_SESSION_new();
+  cache.OnSessionRemoved(other_session);
+  EXPECT_EQ(1U, cache.size());
+  SSL_SESSION_free(other_session);
+}
+
+TEST_F(SSLSessionCacheOpenSSLTest, LoadRejectsMalformedPickle) {
+  SSLSessionCacheOpenSSL cache(MakeConfig(10));
+  Pickle empty_pickle;
+  EXPECT_FALSE(cache.Load(empty_pickle));
+
+  // A version 1 pickle with the key of a session, but not its data.
+  Pickle truncated_pickle;
+  truncated_pickle.WriteInt(1);
+  truncated_pickle.WriteInt(1);
+  truncated_pickle.WriteString("a");
+  EXPECT_FALSE(cache.Load(truncated_pickle));
+
+  Pickle pickle;
+  cache.Persist(&pickle);
+  EXPECT_TRUE(cache.Load(pickle));
+  EXPECT_EQ(0U, cache.size());
+}
+
+}  // namespace
+
+}  // namespace net
@@ -23,7 +23,9 @@
 #include "base/posix/eintr_wrapper.h"
 #include "base/sys_byteorder.h"
 #include "base/threading/platform_thread.h"
+#include "base/timer/timer.h"
 #include "build/build_config.h"
+#include "net/base/io_buffer.h"
 #include "net/base/ip_endpoint.h"
 #include "net/base/net_errors.h"
 #include "net/base/net_util.h"
@@ -40,6 +42,104 @@ namespace {
 
 const int kReadBufSize = 4096;
 
+#if defined(OS_POSIX)
+// How long a released socket waits for its peer to take more of the data
+// that is still queued before giving up on it.
+const int kLingerTimeoutSeconds = 60;
+
+// Sends as much of |queue| over |socket| as it takes without blocking, and
+// adds the number of bytes sent to |*bytes_sent|. Returns false on errors.
+bool SendQueuedData(SocketDescriptor socket,
+                    std::deque<scoped_refptr<DrainableIOBuffer> >* queue,
+                    int* bytes_sent) {
+  while (!queue->empty()) {
+    DrainableIOBuffer* buffer = queue->front().get();
+    int sent = HANDLE_EINTR(send(socket, buffer->data(),
+                                 buffer->BytesRemaining(), 0));
+    if (sent == StreamListenSocket::kSocketError) {
+      if (errno == EWOULDBLOCK || errno == EAGAIN)
+        return true;
+      LOG(ERROR) << "send failed: errno==" << errno;
+      return false;
+    }
+    buffer->DidConsume(sent);
+    *bytes_sent += sent;
+    if (buffer->BytesRemaining() == 0)
+      queue->pop_front();
+  }
+  return true;
+}
+
+// Takes over a socket that is released while data is still queued for it,
+// keeps sending that data as the peer takes it and closes the socket once
+// all of it is sent. Deletes itself when done, on errors, when the peer
+// takes nothing for kLingerTimeoutSeconds, or when the message loop goes
+// away.
+class LingeringSender : public base::MessageLoopForIO::Watcher,
+                        public base::MessageLoop::DestructionObserver {
+ public:
+  // Takes ownership of |socket| and of the buffers in |pending_sends|.
+  LingeringSender(SocketDescriptor socket,
+                  std::deque<scoped_refptr<DrainableIOBuffer> >* pending_sends)
+      : socket_(socket) {
+    pending_sends_.swap(*pending_sends);
+  }
+
+  void Start() {
+    base::MessageLoopForIO::current()->AddDestructionObserver(this);
+    base::MessageLoopForIO::current()->WatchFileDescriptor(
+        socket_, true, base::MessageLoopForIO::WATCH_WRITE, &watcher_, this);
+    RestartTimer();
+  }
+
+  // base::MessageLoopForIO::Watcher:
+  virtual void OnFileCanReadWithoutBlocking(int fd) OVERRIDE {
+    NOTREACHED();
+  }
+
+  virtual void OnFileCanWriteWithoutBlocking(int fd) OVERRIDE {
+    int sent = 0;
+    if (!SendQueuedData(socket_, &pending_sends_, &sent) ||
+        pending_sends_.empty()) {
+      delete this;
+      return;
+    }
+    if (sent > 0)
+      RestartTimer();
+  }
+
+  // base::MessageLoop::DestructionObserver:
+  virtual void WillDestroyCurrentMessageLoop() OVERRIDE {
+    delete this;
+  }
+
+ private:
+  virtual ~LingeringSender() {
+    watcher_.StopWatchingFileDescriptor();
+    base::MessageLoop::current()->RemoveDestructionObserver(this);
+    close(socket_);
+  }
+
+  void RestartTimer() {
+    timer_.Start(FROM_HERE,
+                 base::TimeDelta::FromSeconds(kLingerTimeoutSeconds),
+                 this, &LingeringSender::OnTimeout);
+  }
+
+  void OnTimeout() {
+    LOG(ERROR) << "Dropping unsent data of a released socket.";
+    delete this;
+  }
+
+  const SocketDescriptor socket_;
+  std::deque<scoped_refptr<DrainableIOBuffer> > pending_sends_;
+  base::MessageLoopForIO::FileDescriptorWatcher watcher_;
+  base::OneShotTimer<LingeringSender> timer_;
+
+  DISALLOW_COPY_AND_ASSIGN(LingeringSender);
+};
+#endif
+
 }  // namespace
 
 #if defined(OS_WIN)
@@ -50,6 +150,8 @@ const SocketDescriptor StreamListenSocket::kInvalidSocket = -1;
 const int StreamListenSocket::kSocketError = -1;
 #endif
 
+const int StreamListenSocket::kMaxPendingSendSize = 1024 * 1024;
+
 StreamListenSocket::StreamListenSocket(SocketDescriptor s,
                                        StreamListenSocket::Delegate* del)
     : socket_delegate_(del),
@@ -62,6 +164,8 @@ StreamListenSocket::StreamListenSocket(SocketDescriptor s,
   WatchSocket(NOT_WAITING);
 #elif defined(OS_POSIX)
   wait_state_ = NOT_WAITING;
+  watch_mode_ = base::MessageLoopForIO::WATCH_READ;
+  pending_send_size_ = 0;
 #endif
 }
 
@@ -71,6 +175,16 @@ StreamListenSocket::~StreamListenSocket() {
     WSACloseEvent(socket_event_);
     socket_event_ = WSA_INVALID_EVENT;
   }
+#elif defined(OS_POSIX)
+  // The last reference is often dropped right after a response was sent.
+  // Whatever the kernel does not take right away is left to a
+  // LingeringSender, which also closes the socket once it is done.
+  if (SendPendingData() && !pending_sends_.empty() &&
+      base::MessageLoop::current()) {
+    UnwatchSocket();
+    (new LingeringSender(socket_, &pending_sends_))->Start();
+    return;
+  }
 #endif
   CloseSocket(socket_);
 }
@@ -111,6 +225,32 @@ SocketDescriptor StreamListenSocket::AcceptSocket() {
 }
 
 void StreamListenSocket::SendInternal(const char* bytes, int len) {
+#if defined(OS_POSIX)
+  // Data must go out in order, so nothing is sent directly while older data
+  // is queued.
+  if (pending_sends_.empty()) {
+    int sent = HANDLE_EINTR(send(socket_, bytes, len, 0));
+    if (sent == len)
+      return;
+    if (sent == kSocketError) {
+      if (errno != EWOULDBLOCK && errno != EAGAIN) {
+        LOG(ERROR) << "send failed: errno==" << errno;
+        return;
+      }
+      sent = 0;
+    }
+    bytes += sent;
+    len -= sent;
+  }
+
+  // Only the part that could not be sent right away is copied.
+  scoped_refptr<IOBuffer> buffer(new IOBuffer(len));
+  memcpy(buffer->data(), bytes, len);
+  pending_sends_.push_back(new DrainableIOBuffer(buffer.get(), len));
+  pending_send_size_ += len;
+  UpdateWatchMode();
+#else
+  // Windows still blocks until all of the data is sent.
   char* send_buf = const_cast<char *>(bytes);
   int len_left = len;
   while (true) {
@@ -138,10 +278,46 @@ void StreamListenSocket::SendInternal(const char* bytes, int len) {
     }
     base::PlatformThread::YieldCurrentThread();
   }
+#endif
+}
+
+#if defined(OS_POSIX)
+bool StreamListenSocket::SendPendingData() {
+  int sent = 0;
+  bool result = SendQueuedData(socket_, &pending_sends_, &sent);
+  pending_send_size_ -= sent;
+  if (!result) {
+    pending_sends_.clear();
+    pending_send_size_ = 0;
+  }
+  return result;
 }
 
+void StreamListenSocket::UpdateWatchMode() {
+  if (wait_state_ != WAITING_READ)
+    return;
+
+  base::MessageLoopForIO::Mode mode = base::MessageLoopForIO::WATCH_READ;
+  if (pending_send_size_ > kMaxPendingSendSize)
+    mode = base::MessageLoopForIO::WATCH_WRITE;
+  else if (pending_send_size_ > 0)
+    mode = base::MessageLoopForIO::WATCH_READ_WRITE;
+  if (mode == watch_mode_)
+    return;
+
+  // WatchFileDescriptor() adds to the modes already watched, so the old
+  // watch has to go first.
+  watcher_.StopWatchingFileDescriptor();
+  base::MessageLoopForIO::current()->WatchFileDescriptor(
+      socket_, true, mode, &watcher_, this);
+  watch_mode_ = mode;
+}
+#endif
+
 void StreamListenSocket::Listen() {
-  int backlog = 10;  // TODO(erikkay): maybe don't allow any backlog?
+  // Let the kernel queue as many connections as it allows, so that bursts of
+  // clients are not refused while earlier ones are being accepted.
+  int backlog = SOMAXCONN;
   if (listen(socket_, backlog) == -1) {
     // TODO(erikkay): error handling.
     LOG(ERROR) << "Could not listen on socket.";
@@ -181,6 +357,11 @@ void StreamListenSocket::Read() {
       DCHECK_LE(len, kReadBufSize);
       buf[len] = 0;  // Already create a buffer with +1 length.
       socket_delegate_->DidRead(this, buf, len);
+#if defined(OS_POSIX)
+      // Stop reading once the peer has stopped taking responses.
+      if (pending_send_size_ > kMaxPendingSendSize)
+        break;
+#endif
     }
   } while (len == kReadBufSize);
 }
@@ -214,6 +395,7 @@ void StreamListenSocket::WatchSocket(WaitState state) {
   // Implicitly calls StartWatchingFileDescriptor().
   base::MessageLoopForIO::current()->WatchFileDescriptor(
       socket_, true, base::MessageLoopForIO::WATCH_READ, &watcher_, this);
+  watch_mode_ = base::MessageLoopForIO::WATCH_READ;
   wait_state_ = state;
 #endif
 }
@@ -284,9 +466,13 @@ void StreamListenSocket::OnFileCanReadWithoutBlocking(int fd) {
 }
 
 void StreamListenSocket::OnFileCanWriteWithoutBlocking(int fd) {
-  // MessagePumpLibevent callback, we don't listen for write events
-  // so we shouldn't ever reach here.
-  NOTREACHED();
+  // Only watched for while data is queued.
+  if (!SendPendingData()) {
+    Close();
+    // Close might have deleted this object. We should return immediately.
+    return;
+  }
+  UpdateWatchMode();
 }
 
 #endif
@@ -21,6 +21,7 @@
 #if defined(OS_WIN)
 #include <winsock2.h>
 #endif
+#include <deque>
 #include <string>
 #if defined(OS_WIN)
 #include "base/win/object_watcher.h"
@@ -30,6 +31,7 @@
 
 #include "base/basictypes.h"
 #include "base/compiler_specific.h"
+#include "base/memory/ref_counted.h"
 #include "net/base/net_export.h"
 #include "net/socket/stream_listen_socket.h"
 
@@ -41,6 +43,7 @@ typedef SOCKET SocketDescriptor;
 
 namespace net {
 
+class DrainableIOBuffer;
 class IPEndPoint;
 
 class NET_EXPORT StreamListenSocket
@@ -71,7 +74,11 @@ class NET_EXPORT StreamListenSocket
     virtual ~Delegate() {}
   };
 
-  // Send data to the socket.
+  // Send data to the socket. On POSIX, data that the socket can not take
+  // without blocking is queued and written out as the socket becomes
+  // writable; while more than kMaxPendingSendSize bytes are queued, the
+  // socket stops reading, so that a peer that does not read can not make the
+  // queue grow without bounds.
   void Send(const char* bytes, int len, bool append_linefeed = false);
   void Send(const std::string& str, bool append_linefeed = false);
 
@@ -80,6 +87,7 @@ class NET_EXPORT StreamListenSocket
 
   static const SocketDescriptor kInvalidSocket;
   static const int kSocketError;
+  static const int kMaxPendingSendSize;
 
  protected:
   enum WaitState {
@@ -112,6 +120,16 @@ class NET_EXPORT StreamListenSocket
 
   void SendInternal(const char* bytes, int len);
 
+#if defined(OS_POSIX)
+  // Sends as much of |pending_sends_| as the socket takes without blocking.
+  // Returns false on a socket error, in which case the queue is dropped.
+  bool SendPendingData();
+
+  // Watches the socket for what it is ready to handle given the amount of
+  // queued data: reads unless the queue is full, writes if it is not empty.
+  void UpdateWatchMode();
+#endif
+
 #if defined(OS_WIN)
   // ObjectWatcher delegate.
   virtual void OnObjectSignaled(HANDLE object);
@@ -124,6 +142,10 @@ class NET_EXPORT StreamListenSocket
   WaitState wait_state_;
   // The socket's libevent wrapper.
   base::MessageLoopForIO::FileDescriptorWatcher watcher_;
+  base::MessageLoopForIO::Mode watch_mode_;
+  // Data that is waiting to be sent, in the order it was passed to Send().
+  std::deque<scoped_refptr<DrainableIOBuffer> > pending_sends_;
+  int pending_send_size_;
 #endif
 
   // NOTE: This is for unit test use only!
@@ -5,10 +5,12 @@
 #include "net/socket/transport_client_socket_pool.h"
 
 #include <algorithm>
+#include <vector>
 
 #include "base/compiler_specific.h"
 #include "base/logging.h"
 #include "base/message_loop/message_loop.h"
+#include "base/message_loop/message_loop_proxy.h"
 #include "base/metrics/histogram.h"
 #include "base/strings/string_util.h"
 #include "base/time/time.h"
@@ -16,6 +18,7 @@
 #include "net/base/ip_endpoint.h"
 #include "net/base/net_errors.h"
 #include "net/base/net_log.h"
+#include "net/http/http_server_properties.h"
 #include "net/socket/client_socket_factory.h"
 #include "net/socket/client_socket_handle.h"
 #include "net/socket/client_socket_pool_base.h"
@@ -29,16 +32,17 @@ namespace net {
 // TODO(willchan): Base this off RTT instead of statically setting it. Note we
 // choose a timeout that is different from the backup connect job timer so they
 // don't synchronize.
-const int TransportConnectJob::kIPv6FallbackTimerInMs = 300;
+const int TransportConnectJob::kConnectAttemptDelayInMs = 300;
 
 namespace {
 
-// Returns true iff all addresses in |list| are in the IPv6 family.
-bool AddressListOnlyContainsIPv6(const AddressList& list) {
+// Returns true iff all addresses in |list| are in the |family| family.
+bool AddressListOnlyContainsFamily(const AddressList& list,
+                                   AddressFamily family) {
   DCHECK(!list.empty());
   for (AddressList::const_iterator iter = list.begin(); iter != list.end();
        ++iter) {
-    if (iter->GetFamily() != ADDRESS_FAMILY_IPV6)
+    if (iter->GetFamily() != family)
       return false;
   }
   return true;
@@ -84,6 +88,8 @@ TransportConnectJob::TransportConnectJob(
     base::TimeDelta timeout_duration,
     ClientSocketFactory* client_socket_factory,
     HostResolver* host_resolver,
+    const base::WeakPtr<HttpServerProperties>& http_server_properties,
+    const scoped_refptr<base::SingleThreadTaskRunner>& task_runner,
     Delegate* delegate,
     NetLog* net_log)
     : ConnectJob(group_name, timeout_duration, delegate,
@@ -91,14 +97,26 @@ TransportConnectJob::TransportConnectJob(
       params_(params),
       client_socket_factory_(client_socket_factory),
       resolver_(host_resolver),
-      next_state_(STATE_NONE) {
+      http_server_properties_(http_server_properties),
+      next_state_(STATE_NONE),
+      pending_attempts_(0),
+      winner_(0),
+      last_error_(ERR_CONNECTION_FAILED),
+      task_runner_(task_runner),
+      attempt_timer_factory_(this) {
+  if (!task_runner_.get())
+    task_runner_ = base::MessageLoopProxy::current();
 }
 
 TransportConnectJob::~TransportConnectJob() {
-  // We don't worry about cancelling the host resolution and TCP connect, since
+  // We don't worry about cancelling the host resolution and TCP connects, since
   // ~SingleRequestHostResolver and ~StreamSocket will take care of it.
 }
 
+TransportConnectJob::ConnectAttempt::ConnectAttempt() {}
+
+TransportConnectJob::ConnectAttempt::~ConnectAttempt() {}
+
 LoadState TransportConnectJob::GetLoadState() const {
   switch (next_state_) {
     case STATE_RESOLVE_HOST:
@@ -123,6 +141,33 @@ void TransportConnectJob::MakeAddressListStartWithIPv4(AddressList* list) {
   }
 }
 
+// static
+void TransportConnectJob::InterleaveAddressFamilies(AddressFamily first_family,
+                                                    AddressList* addrlist) {
+  if (addrlist->empty())
+    return;
+  if (first_family == ADDRESS_FAMILY_UNSPECIFIED)
+    first_family = addrlist->front().GetFamily();
+
+  std::vector<IPEndPoint> first;
+  std::vector<IPEndPoint> second;
+  for (AddressList::const_iterator i = addrlist->begin(); i != addrlist->end();
+       ++i) {
+    if (i->GetFamily() == first_family)
+      first.push_back(*i);
+    else
+      second.push_back(*i);
+  }
+
+  AddressList::iterator out = addrlist->begin();
+  for (size_t i = 0; i < std::max(first.size(), second.size()); ++i) {
+    if (i < first.size())
+      *out++ = first[i];
+    if (i < second.size())
+      *out++ = second[i];
+  }
+}
+
 void TransportConnectJob::OnIOComplete(int result) {
   int rv = DoLoop(result);
   if (rv != ERR_IO_PENDING)
@@ -190,142 +235,167 @@ int TransportConnectJob::DoResolveHostComplete(int result) {
 
 int TransportConnectJob::DoTransportConnect() {
   next_state_ = STATE_TRANSPORT_CONNECT_COMPLETE;
-  transport_socket_.reset(client_socket_factory_->CreateTransportClientSocket(
-        addresses_, net_log().net_log(), net_log().source()));
-  int rv = transport_socket_->Connect(
-      base::Bind(&TransportConnectJob::OnIOComplete, base::Unretained(this)));
-  if (rv == ERR_IO_PENDING &&
-      addresses_.front().GetFamily() == ADDRESS_FAMILY_IPV6 &&
-      !AddressListOnlyContainsIPv6(addresses_)) {
-    fallback_timer_.Start(FROM_HERE,
-        base::TimeDelta::FromMilliseconds(kIPv6FallbackTimerInMs),
-        this, &TransportConnectJob::DoIPv6FallbackTransportConnect);
+  DCHECK(!addresses_.empty());
+
+  // When the resolver puts IPv4 first, as the prefer-IPv4 hack has it do, the
+  // remembered family does not move IPv6 ahead of it.
+  AddressFamily preferred_family = ADDRESS_FAMILY_UNSPECIFIED;
+  if (http_server_properties_ &&
+      addresses_.front().GetFamily() != ADDRESS_FAMILY_IPV4) {
+    preferred_family = http_server_properties_->GetPreferredAddressFamily(
+        params_->destination().host_port_pair());
   }
-  return rv;
+  InterleaveAddressFamilies(preferred_family, &addresses_);
+
+  attempts_.clear();
+  pending_attempts_ = 0;
+  last_error_ = ERR_CONNECTION_FAILED;
+  return StartConnectAttempts();
 }
 
 int TransportConnectJob::DoTransportConnectComplete(int result) {
+  attempt_timer_factory_.InvalidateWeakPtrs();
   if (result == OK) {
-    bool is_ipv4 = addresses_.front().GetFamily() == ADDRESS_FAMILY_IPV4;
-    DCHECK(!connect_timing_.connect_start.is_null());
-    DCHECK(!connect_timing_.dns_start.is_null());
-    base::TimeTicks now = base::TimeTicks::Now();
-    base::TimeDelta total_duration = now - connect_timing_.dns_start;
-    UMA_HISTOGRAM_CUSTOM_TIMES(
-        "Net.DNS_Resolution_And_TCP_Connection_Latency2",
-        total_duration,
-        base::TimeDelta::FromMilliseconds(1),
-        base::TimeDelta::FromMinutes(10),
-        100);
-
-    base::TimeDelta connect_duration = now - connect_timing_.connect_start;
-    UMA_HISTOGRAM_CUSTOM_TIMES("Net.TCP_Connection_Latency",
-        connect_duration,
-        base::TimeDelta::FromMilliseconds(1),
-        base::TimeDelta::FromMinutes(10),
-        100);
-
-    if (is_ipv4) {
-      UMA_HISTOGRAM_CUSTOM_TIMES("Net.TCP_Connection_Latency_IPv4_No_Race",
-                                 connect_duration,
-                                 base::TimeDelta::FromMilliseconds(1),
-                                 base::TimeDelta::FromMinutes(10),
-                                 100);
-    } else {
-      if (AddressListOnlyContainsIPv6(addresses_)) {
-        UMA_HISTOGRAM_CUSTOM_TIMES("Net.TCP_Connection_Latency_IPv6_Solo",
-                                   connect_duration,
-                                   base::TimeDelta::FromMilliseconds(1),
-                                   base::TimeDelta::FromMinutes(10),
-                                   100);
-      } else {
-        UMA_HISTOGRAM_CUSTOM_TIMES("Net.TCP_Connection_Latency_IPv6_Raceable",
-                                   connect_duration,
-                                   base::TimeDelta::FromMilliseconds(1),
-                                   base::TimeDelta::FromMinutes(10),
-                                   100);
-      }
+    RecordWinner();
+    set_socket(attempts_[winner_]->socket.release());
+  }
+  // Cancels the attempts that lost the race.
+  attempts_.clear();
+  pending_attempts_ = 0;
+  return result;
+}
+
+int TransportConnectJob::StartConnectAttempts() {
+  while (attempts_.size() < addresses_.size()) {
+    size_t index = attempts_.size();
+    ConnectAttempt* attempt = new ConnectAttempt();
+    attempts_.push_back(attempt);
+    AddressList attempt_addresses(addresses_[index]);
+    attempt_addresses.set_canonical_name(addresses_.canonical_name());
+    attempt->socket.reset(client_socket_factory_->CreateTransportClientSocket(
+        attempt_addresses, net_log().net_log(), net_log().source()));
+    attempt->start_time = base::TimeTicks::Now();
+    int rv = attempt->socket->Connect(
+        base::Bind(&TransportConnectJob::OnAttemptComplete,
+                   base::Unretained(this), index));
+    if (rv == OK) {
+      winner_ = index;
+      return OK;
     }
-    set_socket(transport_socket_.release());
-    fallback_timer_.Stop();
-  } else {
-    // Be a bit paranoid and kill off the fallback members to prevent reuse.
-    fallback_transport_socket_.reset();
-    fallback_addresses_.reset();
+    if (rv == ERR_IO_PENDING) {
+      ++pending_attempts_;
+      if (attempts_.size() < addresses_.size())
+        StartAttemptTimer();
+      return ERR_IO_PENDING;
+    }
+    // Go straight on to the next address.
+    attempt->socket.reset();
+    last_error_ = rv;
   }
+  return pending_attempts_ > 0 ? ERR_IO_PENDING : last_error_;
+}
 
-  return result;
+void TransportConnectJob::StartAttemptTimer() {
+  attempt_timer_factory_.InvalidateWeakPtrs();
+  task_runner_->PostDelayedTask(
+      FROM_HERE,
+      base::Bind(&TransportConnectJob::OnAttemptTimer,
+                 attempt_timer_factory_.GetWeakPtr()),
+      base::TimeDelta::FromMilliseconds(kConnectAttemptDelayInMs));
 }
 
-void TransportConnectJob::DoIPv6FallbackTransportConnect() {
-  // The timer should only fire while we're waiting for the main connect to
-  // succeed.
+void TransportConnectJob::OnAttemptTimer() {
+  // The timer should only fire while we're waiting for a connect to succeed.
   if (next_state_ != STATE_TRANSPORT_CONNECT_COMPLETE) {
     NOTREACHED();
     return;
   }
 
-  DCHECK(!fallback_transport_socket_.get());
-  DCHECK(!fallback_addresses_.get());
-
-  fallback_addresses_.reset(new AddressList(addresses_));
-  MakeAddressListStartWithIPv4(fallback_addresses_.get());
-  fallback_transport_socket_.reset(
-      client_socket_factory_->CreateTransportClientSocket(
-          *fallback_addresses_, net_log().net_log(), net_log().source()));
-  fallback_connect_start_time_ = base::TimeTicks::Now();
-  int rv = fallback_transport_socket_->Connect(
-      base::Bind(
-          &TransportConnectJob::DoIPv6FallbackTransportConnectComplete,
-          base::Unretained(this)));
+  int rv = StartConnectAttempts();
   if (rv != ERR_IO_PENDING)
-    DoIPv6FallbackTransportConnectComplete(rv);
+    OnIOComplete(rv);  // Deletes |this|
 }
 
-void TransportConnectJob::DoIPv6FallbackTransportConnectComplete(int result) {
-  // This should only happen when we're waiting for the main connect to succeed.
+void TransportConnectJob::OnAttemptComplete(size_t index, int result) {
+  // This should only happen when we're waiting for a connect to succeed.
   if (next_state_ != STATE_TRANSPORT_CONNECT_COMPLETE) {
     NOTREACHED();
     return;
   }
 
   DCHECK_NE(ERR_IO_PENDING, result);
-  DCHECK(fallback_transport_socket_.get());
-  DCHECK(fallback_addresses_.get());
+  DCHECK_GT(pending_attempts_, 0u);
+  --pending_attempts_;
 
   if (result == OK) {
-    DCHECK(!fallback_connect_start_time_.is_null());
-    DCHECK(!connect_timing_.dns_start.is_null());
-    base::TimeTicks now = base::TimeTicks::Now();
-    base::TimeDelta total_duration = now - connect_timing_.dns_start;
-    UMA_HISTOGRAM_CUSTOM_TIMES(
-        "Net.DNS_Resolution_And_TCP_Connection_Latency2",
-        total_duration,
-        base::TimeDelta::FromMilliseconds(1),
-        base::TimeDelta::FromMinutes(10),
-        100);
-
-    base::TimeDelta connect_duration = now - fallback_connect_start_time_;
-    UMA_HISTOGRAM_CUSTOM_TIMES("Net.TCP_Connection_Latency",
-        connect_duration,
-        base::TimeDelta::FromMilliseconds(1),
-        base::TimeDelta::FromMinutes(10),
-        100);
-
-    UMA_HISTOGRAM_CUSTOM_TIMES("Net.TCP_Connection_Latency_IPv4_Wins_Race",
-        connect_duration,
-        base::TimeDelta::FromMilliseconds(1),
-        base::TimeDelta::FromMinutes(10),
-        100);
-    set_socket(fallback_transport_socket_.release());
-    next_state_ = STATE_NONE;
-    transport_socket_.reset();
+    winner_ = index;
+  } else {
+    // Don't wait for the timer before trying the next address.
+    attempts_[index]->socket.reset();
+    last_error_ = result;
+    result = StartConnectAttempts();
+    if (result == ERR_IO_PENDING)
+      return;
+  }
+  OnIOComplete(result);  // Deletes |this|
+}
+
+void TransportConnectJob::RecordWinner() {
+  DCHECK_LT(winner_, attempts_.size());
+  AddressFamily family = addresses_[winner_].GetFamily();
+  bool is_raceable = !AddressListOnlyContainsFamily(addresses_, family);
+
+  DCHECK(!connect_timing_.dns_start.is_null());
+  base::TimeTicks now = base::TimeTicks::Now();
+  base::TimeDelta total_duration = now - connect_timing_.dns_start;
+  UMA_HISTOGRAM_CUSTOM_TIMES(
+      "Net.DNS_Resolution_And_TCP_Connection_Latency2",
+      total_duration,
+      base::TimeDelta::FromMilliseconds(1),
+      base::TimeDelta::FromMinutes(10),
+      100);
+
+  base::TimeDelta connect_duration = now - attempts_[winner_]->start_time;
+  UMA_HISTOGRAM_CUSTOM_TIMES("Net.TCP_Connection_Latency",
+      connect_duration,
+      base::TimeDelta::FromMilliseconds(1),
+      base::TimeDelta::FromMinutes(10),
+      100);
+
+  if (family == ADDRESS_FAMILY_IPV4) {
+    if (addresses_.front().GetFamily() == ADDRESS_FAMILY_IPV4) {
+      UMA_HISTOGRAM_CUSTOM_TIMES("Net.TCP_Connection_Latency_IPv4_No_Race",
+                                 connect_duration,
+                                 base::TimeDelta::FromMilliseconds(1),
+                                 base::TimeDelta::FromMinutes(10),
+                                 100);
+    } else {
+      UMA_HISTOGRAM_CUSTOM_TIMES("Net.TCP_Connection_Latency_IPv4_Wins_Race",
+                                 connect_duration,
+                                 base::TimeDelta::FromMilliseconds(1),
+                                 base::TimeDelta::FromMinutes(10),
+                                 100);
+    }
+  } else if (!is_raceable) {
+    UMA_HISTOGRAM_CUSTOM_TIMES("Net.TCP_Connection_Latency_IPv6_Solo",
+                               connect_duration,
+                               base::TimeDelta::FromMilliseconds(1),
+                               base::TimeDelta::FromMinutes(10),
+                               100);
   } else {
-    // Be a bit paranoid and kill off the fallback members to prevent reuse.
-    fallback_transport_socket_.reset();
-    fallback_addresses_.reset();
+    UMA_HISTOGRAM_CUSTOM_TIMES("Net.TCP_Connection_Latency_IPv6_Raceable",
+                               connect_duration,
+                               base::TimeDelta::FromMilliseconds(1),
+                               base::TimeDelta::FromMinutes(10),
+                               100);
+  }
+  UMA_HISTOGRAM_COUNTS_100("Net.TCP_Connection_Attempts", attempts_.size());
+
+  // Only remember the family when there was a choice to make.
+  if (is_raceable && http_server_properties_) {
+    http_server_properties_->SetPreferredAddressFamily(
+        params_->destination().host_port_pair(), family);
   }
-  NotifyDelegateOfCompletion(result);  // Deletes |this|
 }
 
 int TransportConnectJob::ConnectInternal() {
@@ -343,6 +413,8 @@ ConnectJob*
                                  ConnectionTimeout(),
                                  client_socket_factory_,
                                  host_resolver_,
+                                 http_server_properties_,
+                                 task_runner_,
                                  delegate,
                                  net_log_);
 }
@@ -360,11 +432,12 @@ TransportClientSocketPool::TransportClientSocketPool(
     HostResolver* host_resolver,
     ClientSocketFactory* client_socket_factory,
     NetLog* net_log)
-    : base_(max_sockets, max_sockets_per_group, histograms,
+    : connect_job_factory_(new TransportConnectJobFactory(
+          client_socket_factory, host_resolver, net_log)),
+      base_(max_sockets, max_sockets_per_group, histograms,
             ClientSocketPool::unused_idle_socket_timeout(),
             ClientSocketPool::used_idle_socket_timeout(),
-            new TransportConnectJobFactory(client_socket_factory,
-                                     host_resolver, net_log)) {
+            connect_job_factory_) {
   base_.EnableConnectBackupJobs();
 }
 
@@ -473,4 +546,14 @@ ClientSocketPoolHistograms* TransportClientSocketPool::histograms() const {
   return base_.histograms();
 }
 
+void TransportClientSocketPool::SetHttpServerProperties(
+    const base::WeakPtr<HttpServerProperties>& http_server_properties) {
+  connect_job_factory_->set_http_server_properties(http_server_properties);
+}
+
+void TransportClientSocketPool::SetConnectAttemptTaskRunnerForTesting(
+    const scoped_refptr<base::SingleThreadTaskRunner>& task_runner) {
+  connect_job_factory_->set_task_runner(task_runner);
+}
+
 }  // namespace net
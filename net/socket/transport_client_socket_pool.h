@@ -10,8 +10,10 @@
 #include "base/basictypes.h"
 #include "base/memory/ref_counted.h"
 #include "base/memory/scoped_ptr.h"
+#include "base/memory/scoped_vector.h"
+#include "base/memory/weak_ptr.h"
+#include "base/single_thread_task_runner.h"
 #include "base/time/time.h"
-#include "base/timer/timer.h"
 #include "net/base/host_port_pair.h"
 #include "net/dns/host_resolver.h"
 #include "net/dns/single_request_host_resolver.h"
@@ -22,6 +24,7 @@
 namespace net {
 
 class ClientSocketFactory;
+class HttpServerProperties;
 
 typedef base::Callback<int(const AddressList&, const BoundNetLog& net_log)>
 OnHostResolutionCallback;
@@ -59,22 +62,31 @@ class NET_EXPORT_PRIVATE TransportSocketParams
 };
 
 // TransportConnectJob handles the host resolution necessary for socket creation
-// and the transport (likely TCP) connect. TransportConnectJob also has fallback
-// logic for IPv6 connect() timeouts (which may happen due to networks / routers
-// with broken IPv6 support). Those timeouts take 20s, so rather than make the
-// user wait 20s for the timeout to fire, we use a fallback timer
-// (kIPv6FallbackTimerInMs) and start a connect() to a IPv4 address if the timer
-// fires. Then we race the IPv4 connect() against the IPv6 connect() (which has
-// a headstart) and return the one that completes first to the socket pool.
+// and the transport (likely TCP) connect. Broken networks and routers may
+// blackhole some of the resolved addresses (typically IPv6 ones), and connect()
+// timeouts to those take 20s or more. So rather than trying the addresses one
+// after the other, TransportConnectJob races them: it orders the addresses so
+// that the families alternate, starting with the family that won the last race
+// to the same host unless the resolver put IPv4 first, and starts a connect()
+// to the next address every kConnectAttemptDelayInMs (or as soon as an attempt
+// fails) while the earlier attempts are still pending. The first connect() to
+// complete is returned to the socket pool and the others are cancelled.
 class NET_EXPORT_PRIVATE TransportConnectJob : public ConnectJob {
  public:
-  TransportConnectJob(const std::string& group_name,
-                      const scoped_refptr<TransportSocketParams>& params,
-                      base::TimeDelta timeout_duration,
-                      ClientSocketFactory* client_socket_factory,
-                      HostResolver* host_resolver,
-                      Delegate* delegate,
-                      NetLog* net_log);
+  // |http_server_properties| may be NULL, in which case the resolver's order
+  // decides which family is tried first. |task_runner| runs the delayed tasks
+  // that start the next connect attempts; if it is NULL, the current message
+  // loop runs them.
+  TransportConnectJob(
+      const std::string& group_name,
+      const scoped_refptr<TransportSocketParams>& params,
+      base::TimeDelta timeout_duration,
+      ClientSocketFactory* client_socket_factory,
+      HostResolver* host_resolver,
+      const base::WeakPtr<HttpServerProperties>& http_server_properties,
+      const scoped_refptr<base::SingleThreadTaskRunner>& task_runner,
+      Delegate* delegate,
+      NetLog* net_log);
   virtual ~TransportConnectJob();
 
   // ConnectJob methods.
@@ -84,7 +96,15 @@ class NET_EXPORT_PRIVATE TransportConnectJob : public ConnectJob {
   // WARNING: this method should only be used to implement the prefer-IPv4 hack.
   static void MakeAddressListStartWithIPv4(AddressList* addrlist);
 
-  static const int kIPv6FallbackTimerInMs;
+  // Reorders |addrlist| so that IPv6 and IPv4 addresses alternate, starting
+  // with |first_family|, while keeping the relative order of the addresses
+  // within each family. If |first_family| is ADDRESS_FAMILY_UNSPECIFIED, the
+  // family of the first address is used.
+  static void InterleaveAddressFamilies(AddressFamily first_family,
+                                        AddressList* addrlist);
+
+  // Delay between the start of two consecutive connect attempts.
+  static const int kConnectAttemptDelayInMs;
 
  private:
   enum State {
@@ -95,6 +115,15 @@ class NET_EXPORT_PRIVATE TransportConnectJob : public ConnectJob {
     STATE_NONE,
   };
 
+  // A connect() to a single address.
+  struct ConnectAttempt {
+    ConnectAttempt();
+    ~ConnectAttempt();
+
+    scoped_ptr<StreamSocket> socket;
+    base::TimeTicks start_time;
+  };
+
   void OnIOComplete(int result);
 
   // Runs the state transition loop.
@@ -106,8 +135,16 @@ class NET_EXPORT_PRIVATE TransportConnectJob : public ConnectJob {
   int DoTransportConnectComplete(int result);
 
   // Not part of the state machine.
-  void DoIPv6FallbackTransportConnect();
-  void DoIPv6FallbackTransportConnectComplete(int result);
+  // Starts connect attempts, in order, until one is pending or connects.
+  // Returns OK if an attempt connected, ERR_IO_PENDING if attempts are still
+  // pending, and otherwise the error of the last attempt.
+  int StartConnectAttempts();
+  // Starts the next connect attempt in kConnectAttemptDelayInMs, unless an
+  // attempt is started before that.
+  void StartAttemptTimer();
+  void OnAttemptTimer();
+  void OnAttemptComplete(size_t index, int result);
+  void RecordWinner();
 
   // Begins the host resolution and the TCP connect.  Returns OK on success
   // and ERR_IO_PENDING if it cannot immediately service the request.
@@ -117,15 +154,20 @@ class NET_EXPORT_PRIVATE TransportConnectJob : public ConnectJob {
   scoped_refptr<TransportSocketParams> params_;
   ClientSocketFactory* const client_socket_factory_;
   SingleRequestHostResolver resolver_;
+  const base::WeakPtr<HttpServerProperties> http_server_properties_;
   AddressList addresses_;
   State next_state_;
 
-  scoped_ptr<StreamSocket> transport_socket_;
-
-  scoped_ptr<StreamSocket> fallback_transport_socket_;
-  scoped_ptr<AddressList> fallback_addresses_;
-  base::TimeTicks fallback_connect_start_time_;
-  base::OneShotTimer<TransportConnectJob> fallback_timer_;
+  // One entry per address of |addresses_| that a connect() was started to, in
+  // the same order.
+  ScopedVector<ConnectAttempt> attempts_;
+  size_t pending_attempts_;
+  // Index into |attempts_| of the attempt that connected.
+  size_t winner_;
+  int last_error_;
+  scoped_refptr<base::SingleThreadTaskRunner> task_runner_;
+  // Invalidated to cancel the pending OnAttemptTimer() task, if any.
+  base::WeakPtrFactory<TransportConnectJob> attempt_timer_factory_;
 
   DISALLOW_COPY_AND_ASSIGN(TransportConnectJob);
 };
@@ -176,6 +218,16 @@ class NET_EXPORT_PRIVATE TransportClientSocketPool : public ClientSocketPool {
   virtual base::TimeDelta ConnectionTimeout() const OVERRIDE;
   virtual ClientSocketPoolHistograms* histograms() const OVERRIDE;
 
+  // Connect jobs started after this call use |http_server_properties| to
+  // learn, and remember, which address family to try first for each host.
+  void SetHttpServerProperties(
+      const base::WeakPtr<HttpServerProperties>& http_server_properties);
+
+  // Connect jobs started after this call post the tasks that start their next
+  // connect attempts to |task_runner|, rather than to the current message loop.
+  void SetConnectAttemptTaskRunnerForTesting(
+      const scoped_refptr<base::SingleThreadTaskRunner>& task_runner);
+
  private:
   typedef ClientSocketPoolBase<TransportSocketParams> PoolBase;
 
@@ -200,14 +252,28 @@ class NET_EXPORT_PRIVATE TransportClientSocketPool : public ClientSocketPool {
 
     virtual base::TimeDelta ConnectionTimeout() const OVERRIDE;
 
+    void set_http_server_properties(
+        const base::WeakPtr<HttpServerProperties>& http_server_properties) {
+      http_server_properties_ = http_server_properties;
+    }
+
+    void set_task_runner(
+        const scoped_refptr<base::SingleThreadTaskRunner>& task_runner) {
+      task_runner_ = task_runner;
+    }
+
    private:
     ClientSocketFactory* const client_socket_factory_;
     HostResolver* const host_resolver_;
+    base::WeakPtr<HttpServerProperties> http_server_properties_;
+    scoped_refptr<base::SingleThreadTaskRunner> task_runner_;
     NetLog* net_log_;
 
     DISALLOW_COPY_AND_ASSIGN(TransportConnectJobFactory);
   };
 
+  // Owned by |base_|.
+  TransportConnectJobFactory* const connect_job_factory_;
   PoolBase base_;
 
   DISALLOW_COPY_AND_ASSIGN(TransportClientSocketPool);
@@ -10,6 +10,8 @@
 #include "base/compiler_specific.h"
 #include "base/logging.h"
 #include "base/message_loop/message_loop.h"
+#include "base/run_loop.h"
+#include "base/test/test_simple_task_runner.h"
 #include "base/threading/platform_thread.h"
 #include "net/base/capturing_net_log.h"
 #include "net/base/ip_endpoint.h"
@@ -19,6 +21,7 @@
 #include "net/base/net_util.h"
 #include "net/base/test_completion_callback.h"
 #include "net/dns/mock_host_resolver.h"
+#include "net/http/http_server_properties_impl.h"
 #include "net/socket/client_socket_factory.h"
 #include "net/socket/client_socket_handle.h"
 #include "net/socket/client_socket_pool_histograms.h"
@@ -354,6 +357,7 @@ class MockClientSocketFactory : public ClientSocketFactory {
       NetLog* /* net_log */,
       const NetLog::Source& /* source */) OVERRIDE {
     allocation_count_++;
+    last_canonical_name_ = addresses.canonical_name();
 
     ClientSocketType type = client_socket_type_;
     if (client_socket_types_ &&
@@ -399,6 +403,11 @@ class MockClientSocketFactory : public ClientSocketFactory {
 
   int allocation_count() const { return allocation_count_; }
 
+  // The canonical name of the addresses of the last socket created.
+  const std::string& last_canonical_name() const {
+    return last_canonical_name_;
+  }
+
   // Set the default ClientSocketType.
   void set_client_socket_type(ClientSocketType type) {
     client_socket_type_ = type;
@@ -422,6 +431,7 @@ class MockClientSocketFactory : public ClientSocketFactory {
   int client_socket_index_;
   int client_socket_index_max_;
   base::TimeDelta delay_;
+  std::string last_canonical_name_;
 };
 
 class TransportClientSocketPoolTest : public testing::Test {
@@ -558,6 +568,59 @@ TEST(TransportConnectJobTest, MakeAddrListStartWithIPv4) {
   EXPECT_EQ(ADDRESS_FAMILY_IPV6, addrlist[3].GetFamily());
 }
 
+TEST(TransportConnectJobTest, InterleaveAddressFamilies) {
+  IPAddressNumber ip_number;
+  ASSERT_TRUE(ParseIPLiteralToNumber("192.168.1.1", &ip_number));
+  IPEndPoint addrlist_v4_1(ip_number, 80);
+  ASSERT_TRUE(ParseIPLiteralToNumber("192.168.1.2", &ip_number));
+  IPEndPoint addrlist_v4_2(ip_number, 80);
+  ASSERT_TRUE(ParseIPLiteralToNumber("192.168.1.3", &ip_number));
+  IPEndPoint addrlist_v4_3(ip_number, 80);
+  ASSERT_TRUE(ParseIPLiteralToNumber("2001:4860:b006::64", &ip_number));
+  IPEndPoint addrlist_v6_1(ip_number, 80);
+  ASSERT_TRUE(ParseIPLiteralToNumber("2001:4860:b006::66", &ip_number));
+  IPEndPoint addrlist_v6_2(ip_number, 80);
+
+  AddressList addrlist;
+
+  // Test 1: IPv4 only.  Expect no change.
+  addrlist.push_back(addrlist_v4_1);
+  addrlist.push_back(addrlist_v4_2);
+  TransportConnectJob::InterleaveAddressFamilies(ADDRESS_FAMILY_IPV6,
+                                                 &addrlist);
+  ASSERT_EQ(2u, addrlist.size());
+  EXPECT_TRUE(addrlist_v4_1 == addrlist[0]);
+  EXPECT_TRUE(addrlist_v4_2 == addrlist[1]);
+
+  // Test 2: IPv6, IPv6, IPv4, IPv4, IPv4 with no preference.  Expect the
+  // families to alternate, starting with IPv6, and the leftover IPv4 address
+  // to go last.
+  addrlist.clear();
+  addrlist.push_back(addrlist_v6_1);
+  addrlist.push_back(addrlist_v6_2);
+  addrlist.push_back(addrlist_v4_1);
+  addrlist.push_back(addrlist_v4_2);
+  addrlist.push_back(addrlist_v4_3);
+  TransportConnectJob::InterleaveAddressFamilies(ADDRESS_FAMILY_UNSPECIFIED,
+                                                 &addrlist);
+  ASSERT_EQ(5u, addrlist.size());
+  EXPECT_TRUE(addrlist_v6_1 == addrlist[0]);
+  EXPECT_TRUE(addrlist_v4_1 == addrlist[1]);
+  EXPECT_TRUE(addrlist_v6_2 == addrlist[2]);
+  EXPECT_TRUE(addrlist_v4_2 == addrlist[3]);
+  EXPECT_TRUE(addrlist_v4_3 == addrlist[4]);
+
+  // Test 3: Same list, preferring IPv4.
+  TransportConnectJob::InterleaveAddressFamilies(ADDRESS_FAMILY_IPV4,
+                                                 &addrlist);
+  ASSERT_EQ(5u, addrlist.size());
+  EXPECT_TRUE(addrlist_v4_1 == addrlist[0]);
+  EXPECT_TRUE(addrlist_v6_1 == addrlist[1]);
+  EXPECT_TRUE(addrlist_v4_2 == addrlist[2]);
+  EXPECT_TRUE(addrlist_v6_2 == addrlist[3]);
+  EXPECT_TRUE(addrlist_v4_3 == addrlist[4]);
+}
+
 TEST_F(TransportClientSocketPoolTest, Basic) {
   TestCompletionCallback callback;
   ClientSocketHandle handle;
@@ -1252,7 +1315,7 @@ TEST_F(TransportClientSocketPoolTest, IPv6FallbackSocketIPv6FinishesFirst) {
 
   client_socket_factory_.set_client_socket_types(case_types, 2);
   client_socket_factory_.set_delay(base::TimeDelta::FromMilliseconds(
-      TransportConnectJob::kIPv6FallbackTimerInMs + 50));
+      TransportConnectJob::kConnectAttemptDelayInMs + 50));
 
   // Resolve an AddressList with a IPv6 address first and then a IPv4 address.
   host_resolver_->rules()
@@ -1342,6 +1405,230 @@ TEST_F(TransportClientSocketPoolTest, IPv4HasNoFallback) {
   EXPECT_EQ(1, client_socket_factory_.allocation_count());
 }
 
+// Test that blackholed addresses of both families are skipped, one connect
+// attempt after the other, until an address that works is found.
+TEST_F(TransportClientSocketPoolTest, BlackholedAddressesAreSkipped) {
+  // Create a pool without backup jobs.
+  ClientSocketPoolBaseHelper::set_connect_backup_jobs_enabled(false);
+  TransportClientSocketPool pool(kMaxSockets,
+                                 kMaxSocketsPerGroup,
+                                 histograms_.get(),
+                                 host_resolver_.get(),
+                                 &client_socket_factory_,
+                                 NULL);
+  scoped_refptr<base::TestSimpleTaskRunner> task_runner(
+      new base::TestSimpleTaskRunner());
+  pool.SetConnectAttemptTaskRunnerForTesting(task_runner);
+
+  // The addresses are tried as IPv6, IPv4, IPv6, IPv4.
+  MockClientSocketFactory::ClientSocketType case_types[] = {
+    MockClientSocketFactory::MOCK_STALLED_CLIENT_SOCKET,
+    MockClientSocketFactory::MOCK_STALLED_CLIENT_SOCKET,
+    MockClientSocketFactory::MOCK_STALLED_CLIENT_SOCKET,
+    MockClientSocketFactory::MOCK_PENDING_CLIENT_SOCKET
+  };
+
+  client_socket_factory_.set_client_socket_types(case_types, 4);
+
+  host_resolver_->rules()->AddIPLiteralRule(
+      "*", "2:abcd::3:4:ff,3:abcd::3:4:ff,2.2.2.2,3.3.3.3", std::string());
+
+  TestCompletionCallback callback;
+  ClientSocketHandle handle;
+  int rv = handle.Init("a", low_params_, LOW, callback.callback(), &pool,
+                       BoundNetLog());
+  EXPECT_EQ(ERR_IO_PENDING, rv);
+
+  // The stalled attempts never complete, so each of the next attempts is
+  // started by the attempt timer.
+  for (int i = 1; i < 4; ++i) {
+    base::RunLoop().RunUntilIdle();
+    EXPECT_EQ(i, client_socket_factory_.allocation_count());
+    ASSERT_TRUE(task_runner->HasPendingTask());
+    EXPECT_EQ(base::TimeDelta::FromMilliseconds(
+                  TransportConnectJob::kConnectAttemptDelayInMs),
+              task_runner->NextPendingTaskDelay());
+    task_runner->RunPendingTasks();
+  }
+
+  EXPECT_EQ(OK, callback.WaitForResult());
+  EXPECT_TRUE(handle.is_initialized());
+  EXPECT_TRUE(handle.socket());
+  IPEndPoint endpoint;
+  handle.socket()->GetLocalAddress(&endpoint);
+  EXPECT_EQ(kIPv4AddressSize, endpoint.address().size());
+  EXPECT_EQ(4, client_socket_factory_.allocation_count());
+  EXPECT_FALSE(task_runner->HasPendingTask());
+}
+
+// Test that a failed connect attempt starts the next one without waiting for
+// the attempt timer.
+TEST_F(TransportClientSocketPoolTest, FailedAttemptStartsNextImmediately) {
+  // Create a pool without backup jobs.
+  ClientSocketPoolBaseHelper::set_connect_backup_jobs_enabled(false);
+  TransportClientSocketPool pool(kMaxSockets,
+                                 kMaxSocketsPerGroup,
+                                 histograms_.get(),
+                                 host_resolver_.get(),
+                                 &client_socket_factory_,
+                                 NULL);
+  // The tasks posted to |task_runner| are never run, so no attempt can be
+  // started by the attempt timer.
+  scoped_refptr<base::TestSimpleTaskRunner> task_runner(
+      new base::TestSimpleTaskRunner());
+  pool.SetConnectAttemptTaskRunnerForTesting(task_runner);
+
+  MockClientSocketFactory::ClientSocketType case_types[] = {
+    MockClientSocketFactory::MOCK_PENDING_FAILING_CLIENT_SOCKET,
+    MockClientSocketFactory::MOCK_FAILING_CLIENT_SOCKET,
+    MockClientSocketFactory::MOCK_PENDING_CLIENT_SOCKET
+  };
+
+  client_socket_factory_.set_client_socket_types(case_types, 3);
+
+  host_resolver_->rules()->AddIPLiteralRule(
+      "*", "2:abcd::3:4:ff,2.2.2.2,3:abcd::3:4:ff", std::string());
+
+  TestCompletionCallback callback;
+  ClientSocketHandle handle;
+  int rv = handle.Init("a", low_params_, LOW, callback.callback(), &pool,
+                       BoundNetLog());
+  EXPECT_EQ(ERR_IO_PENDING, rv);
+
+  EXPECT_EQ(OK, callback.WaitForResult());
+  IPEndPoint endpoint;
+  handle.socket()->GetLocalAddress(&endpoint);
+  EXPECT_EQ(kIPv6AddressSize, endpoint.address().size());
+  EXPECT_EQ(3, client_socket_factory_.allocation_count());
+}
+
+TEST_F(TransportClientSocketPoolTest, AllAttemptsFail) {
+  client_socket_factory_.set_client_socket_type(
+      MockClientSocketFactory::MOCK_PENDING_FAILING_CLIENT_SOCKET);
+
+  host_resolver_->rules()->AddIPLiteralRule(
+      "*", "2:abcd::3:4:ff,2.2.2.2,3.3.3.3", std::string());
+
+  TestCompletionCallback callback;
+  ClientSocketHandle handle;
+  EXPECT_EQ(ERR_IO_PENDING,
+            handle.Init("a", low_params_, LOW, callback.callback(), &pool_,
+                        BoundNetLog()));
+  EXPECT_EQ(ERR_CONNECTION_FAILED, callback.WaitForResult());
+  EXPECT_FALSE(handle.is_initialized());
+  EXPECT_EQ(3, client_socket_factory_.allocation_count());
+}
+
+// Test that no more connect attempts are started once one has won the race,
+// and that the winning family is tried first for the next connection.
+TEST_F(TransportClientSocketPoolTest, RemembersPreferredAddressFamily) {
+  // Create a pool without backup jobs.
+  ClientSocketPoolBaseHelper::set_connect_backup_jobs_enabled(false);
+  TransportClientSocketPool pool(kMaxSockets,
+                                 kMaxSocketsPerGroup,
+                                 histograms_.get(),
+                                 host_resolver_.get(),
+                                 &client_socket_factory_,
+                                 NULL);
+  HttpServerPropertiesImpl http_server_properties;
+  pool.SetHttpServerProperties(http_server_properties.GetWeakPtr());
+  scoped_refptr<base::TestSimpleTaskRunner> task_runner(
+      new base::TestSimpleTaskRunner());
+  pool.SetConnectAttemptTaskRunnerForTesting(task_runner);
+
+  MockClientSocketFactory::ClientSocketType case_types[] = {
+    // The blackholed IPv6 address.
+    MockClientSocketFactory::MOCK_STALLED_CLIENT_SOCKET,
+    // The IPv4 address, which wins.
+    MockClientSocketFactory::MOCK_PENDING_CLIENT_SOCKET,
+    // Only used by the second connection.
+    MockClientSocketFactory::MOCK_PENDING_CLIENT_SOCKET
+  };
+
+  client_socket_factory_.set_client_socket_types(case_types, 3);
+
+  host_resolver_->rules()->AddIPLiteralRule(
+      "*", "2:abcd::3:4:ff,2.2.2.2,3:abcd::3:4:ff", std::string());
+
+  const HostPortPair origin("www.google.com", 80);
+  EXPECT_EQ(ADDRESS_FAMILY_UNSPECIFIED,
+            http_server_properties.GetPreferredAddressFamily(origin));
+
+  TestCompletionCallback callback;
+  ClientSocketHandle handle;
+  int rv = handle.Init("a", low_params_, LOW, callback.callback(), &pool,
+                       BoundNetLog());
+  EXPECT_EQ(ERR_IO_PENDING, rv);
+  base::RunLoop().RunUntilIdle();
+  EXPECT_EQ(1, client_socket_factory_.allocation_count());
+  // The IPv4 attempt is started by the attempt timer.
+  task_runner->RunPendingTasks();
+  EXPECT_EQ(OK, callback.WaitForResult());
+  IPEndPoint endpoint;
+  handle.socket()->GetLocalAddress(&endpoint);
+  EXPECT_EQ(kIPv4AddressSize, endpoint.address().size());
+  // The second IPv6 address was never tried.
+  EXPECT_EQ(2, client_socket_factory_.allocation_count());
+  EXPECT_EQ(ADDRESS_FAMILY_IPV4,
+            http_server_properties.GetPreferredAddressFamily(origin));
+
+  // The next connection to the host starts with IPv4 and connects without
+  // touching IPv6.
+  TestCompletionCallback callback2;
+  ClientSocketHandle handle2;
+  rv = handle2.Init("b", low_params_, LOW, callback2.callback(), &pool,
+                    BoundNetLog());
+  EXPECT_EQ(ERR_IO_PENDING, rv);
+  EXPECT_EQ(OK, callback2.WaitForResult());
+  handle2.socket()->GetLocalAddress(&endpoint);
+  EXPECT_EQ(kIPv4AddressSize, endpoint.address().size());
+  EXPECT_EQ(3, client_socket_factory_.allocation_count());
+}
+
+// Test that a remembered IPv6 preference does not move IPv6 ahead of the IPv4
+// address that the resolver put first.
+TEST_F(TransportClientSocketPoolTest, PreferredFamilyKeepsIPv4First) {
+  HttpServerPropertiesImpl http_server_properties;
+  pool_.SetHttpServerProperties(http_server_properties.GetWeakPtr());
+  http_server_properties.SetPreferredAddressFamily(
+      HostPortPair("www.google.com", 80), ADDRESS_FAMILY_IPV6);
+
+  client_socket_factory_.set_client_socket_type(
+      MockClientSocketFactory::MOCK_PENDING_CLIENT_SOCKET);
+  host_resolver_->rules()->AddIPLiteralRule(
+      "*", "2.2.2.2,2:abcd::3:4:ff", std::string());
+
+  TestCompletionCallback callback;
+  ClientSocketHandle handle;
+  int rv = handle.Init("a", low_params_, LOW, callback.callback(), &pool_,
+                       BoundNetLog());
+  EXPECT_EQ(ERR_IO_PENDING, rv);
+  EXPECT_EQ(OK, callback.WaitForResult());
+  IPEndPoint endpoint;
+  handle.socket()->GetLocalAddress(&endpoint);
+  EXPECT_EQ(kIPv4AddressSize, endpoint.address().size());
+  EXPECT_EQ(1, client_socket_factory_.allocation_count());
+}
+
+// Test that each connect attempt is given the canonical name of the resolved
+// addresses.
+TEST_F(TransportClientSocketPoolTest, AttemptsKeepCanonicalName) {
+  client_socket_factory_.set_client_socket_type(
+      MockClientSocketFactory::MOCK_PENDING_CLIENT_SOCKET);
+  host_resolver_->rules()->AddIPLiteralRule(
+      "*", "2:abcd::3:4:ff,2.2.2.2", "canonical.example.com");
+
+  TestCompletionCallback callback;
+  ClientSocketHandle handle;
+  int rv = handle.Init("a", low_params_, LOW, callback.callback(), &pool_,
+                       BoundNetLog());
+  EXPECT_EQ(ERR_IO_PENDING, rv);
+  EXPECT_EQ(OK, callback.WaitForResult());
+  EXPECT_EQ(1, client_socket_factory_.allocation_count());
+  EXPECT_EQ("canonical.example.com",
+            client_socket_factory_.last_canonical_name());
+}
+
 }  // namespace
 
 }  // namespace net
@@ -37,7 +37,10 @@ BufferedSpdyFramer::BufferedSpdyFramer(SpdyMajorVersion version,
       header_buffer_used_(0),
       header_buffer_valid_(false),
       header_stream_id_(SpdyFramer::kInvalidStream),
-      frames_received_(0) {
+      frames_received_(0),
+      pending_data_stream_id_(SpdyFramer::kInvalidStream),
+      pending_data_(NULL),
+      pending_data_len_(0) {
   spdy_framer_.set_enable_compression(enable_compression);
   memset(header_buffer_, 0, sizeof(header_buffer_));
 }
@@ -58,6 +61,7 @@ void BufferedSpdyFramer::set_debug_visitor(
 
 void BufferedSpdyFramer::OnError(SpdyFramer* spdy_framer) {
   DCHECK(spdy_framer);
+  FlushPendingData();
   visitor_->OnError(spdy_framer->error_code());
 }
 
@@ -67,6 +71,7 @@ void BufferedSpdyFramer::OnSynStream(SpdyStreamId stream_id,
                                      uint8 credential_slot,
                                      bool fin,
                                      bool unidirectional) {
+  FlushPendingData();
   frames_received_++;
   DCHECK(!control_frame_fields_.get());
   control_frame_fields_.reset(new ControlFrameFields());
@@ -83,6 +88,7 @@ void BufferedSpdyFramer::OnSynStream(SpdyStreamId stream_id,
 
 void BufferedSpdyFramer::OnHeaders(SpdyStreamId stream_id,
                                    bool fin) {
+  FlushPendingData();
   frames_received_++;
   DCHECK(!control_frame_fields_.get());
   control_frame_fields_.reset(new ControlFrameFields());
@@ -95,6 +101,7 @@ void BufferedSpdyFramer::OnHeaders(SpdyStreamId stream_id,
 
 void BufferedSpdyFramer::OnSynReply(SpdyStreamId stream_id,
                                     bool fin) {
+  FlushPendingData();
   frames_received_++;
   DCHECK(!control_frame_fields_.get());
   control_frame_fields_.reset(new ControlFrameFields());
@@ -183,39 +190,80 @@ void BufferedSpdyFramer::OnStreamFrameData(SpdyStreamId stream_id,
                                            const char* data,
                                            size_t len,
                                            bool fin) {
-  visitor_->OnStreamFrameData(stream_id, data, len, fin);
+  if (!data) {
+    DCHECK_EQ(len, 0u);
+    FlushPendingData();
+    visitor_->OnStreamFrameData(stream_id, NULL, 0, fin);
+    return;
+  }
+  DCHECK(!fin);
+
+  if (pending_data_len_ > 0 &&
+      (stream_id != pending_data_stream_id_ ||
+       pending_data_len_ + len > spdy_framer_.GetDataFrameMaximumPayload())) {
+    FlushPendingData();
+  }
+  if (pending_data_len_ == 0) {
+    pending_data_stream_id_ = stream_id;
+    pending_data_ = data;
+    pending_data_len_ = len;
+    return;
+  }
+  if (pending_data_buffer_.empty())
+    pending_data_buffer_.assign(pending_data_, pending_data_len_);
+  pending_data_buffer_.append(data, len);
+  pending_data_len_ += len;
+}
+
+void BufferedSpdyFramer::FlushPendingData() {
+  if (pending_data_len_ == 0)
+    return;
+  std::string buffer;
+  buffer.swap(pending_data_buffer_);
+  const char* data = buffer.empty() ? pending_data_ : buffer.data();
+  size_t len = pending_data_len_;
+  pending_data_ = NULL;
+  pending_data_len_ = 0;
+  visitor_->OnStreamFrameData(pending_data_stream_id_, data, len, false);
 }
 
 void BufferedSpdyFramer::OnSettings(bool clear_persisted) {
+  FlushPendingData();
   visitor_->OnSettings(clear_persisted);
 }
 
 void BufferedSpdyFramer::OnSetting(SpdySettingsIds id,
                                    uint8 flags,
                                    uint32 value) {
+  FlushPendingData();
   visitor_->OnSetting(id, flags, value);
 }
 
 void BufferedSpdyFramer::OnPing(uint32 unique_id) {
+  FlushPendingData();
   visitor_->OnPing(unique_id);
 }
 
 void BufferedSpdyFramer::OnRstStream(SpdyStreamId stream_id,
                                      SpdyRstStreamStatus status) {
+  FlushPendingData();
   visitor_->OnRstStream(stream_id, status);
 }
 void BufferedSpdyFramer::OnGoAway(SpdyStreamId last_accepted_stream_id,
                                   SpdyGoAwayStatus status) {
+  FlushPendingData();
   visitor_->OnGoAway(last_accepted_stream_id, status);
 }
 
 void BufferedSpdyFramer::OnWindowUpdate(SpdyStreamId stream_id,
                                         uint32 delta_window_size) {
+  FlushPendingData();
   visitor_->OnWindowUpdate(stream_id, delta_window_size);
 }
 
 void BufferedSpdyFramer::OnPushPromise(SpdyStreamId stream_id,
                                        SpdyStreamId promised_stream_id) {
+  FlushPendingData();
   visitor_->OnPushPromise(stream_id, promised_stream_id);
 }
 
@@ -224,7 +272,9 @@ int BufferedSpdyFramer::protocol_version() {
 }
 
 size_t BufferedSpdyFramer::ProcessInput(const char* data, size_t len) {
-  return spdy_framer_.ProcessInput(data, len);
+  size_t bytes_processed = spdy_framer_.ProcessInput(data, len);
+  FlushPendingData();
+  return bytes_processed;
 }
 
 void BufferedSpdyFramer::Reset() {
@@ -153,6 +153,10 @@ class NET_EXPORT_PRIVATE BufferedSpdyFramer
                                  bool fin) OVERRIDE;
 
   // SpdyFramer methods.
+
+  // Consecutive data received for the same stream during one call is
+  // passed to the visitor in a single OnStreamFrameData() call, once
+  // something else is received or once all of |data| is processed.
   size_t ProcessInput(const char* data, size_t len);
   int protocol_version();
   void Reset();
@@ -231,6 +235,10 @@ class NET_EXPORT_PRIVATE BufferedSpdyFramer
 
   void InitHeaderStreaming(SpdyStreamId stream_id);
 
+  // Passes the data held back by OnStreamFrameData(), if any, to the
+  // visitor. Must be called before anything else is passed to it.
+  void FlushPendingData();
+
   SpdyFramer spdy_framer_;
   BufferedSpdyFramerVisitorInterface* visitor_;
 
@@ -254,6 +262,14 @@ class NET_EXPORT_PRIVATE BufferedSpdyFramer
   };
   scoped_ptr<ControlFrameFields> control_frame_fields_;
 
+  // Data received but not yet passed to the visitor. |pending_data_|
+  // points into the input as long as the data is a single chunk; once
+  // more is appended, all of it is copied into |pending_data_buffer_|.
+  SpdyStreamId pending_data_stream_id_;
+  const char* pending_data_;
+  size_t pending_data_len_;
+  std::string pending_data_buffer_;
+
   DISALLOW_COPY_AND_ASSIGN(BufferedSpdyFramer);
 };
 
@@ -4,6 +4,10 @@
 
 #include "net/spdy/buffered_spdy_framer.h"
 
+#include <string>
+#include <vector>
+
+#include "base/strings/string_number_conversions.h"
 #include "net/spdy/spdy_test_util_common.h"
 #include "testing/platform_test.h"
 
@@ -71,7 +75,11 @@ class TestBufferedSpdyVisitor : public BufferedSpdyFramerVisitorInterface {
                                  const char* data,
                                  size_t len,
                                  bool fin) OVERRIDE {
-    LOG(FATAL) << "Unexpected OnStreamFrameData call.";
+    std::string event = base::UintToString(stream_id) + ":";
+    event += data ? std::string(data, len) : "";
+    if (fin)
+      event += "<fin>";
+    events_.push_back(event);
   }
 
   virtual void OnSettings(bool clear_persisted) OVERRIDE {}
@@ -82,7 +90,9 @@ class TestBufferedSpdyVisitor : public BufferedSpdyFramerVisitorInterface {
     setting_count_++;
   }
 
-  virtual void OnPing(uint32 unique_id) OVERRIDE {}
+  virtual void OnPing(uint32 unique_id) OVERRIDE {
+    events_.push_back("ping");
+  }
 
   virtual void OnRstStream(SpdyStreamId stream_id,
                            SpdyRstStreamStatus status) OVERRIDE {
@@ -144,6 +154,9 @@ class TestBufferedSpdyVisitor : public BufferedSpdyFramerVisitorInterface {
 
   // Headers from OnSyn, OnSynReply and OnHeaders for verification.
   SpdyHeaderBlock headers_;
+
+  // The data and PINGs received, in order.
+  std::vector<std::string> events_;
 };
 
 }  // namespace
@@ -280,4 +293,37 @@ TEST_P(BufferedSpdyFramerTest, ReadHeadersHeaderBlock) {
   EXPECT_TRUE(CompareHeaderBlocks(&headers, &visitor.headers_));
 }
 
+// Data received for a stream in one ProcessInput() call is passed on in
+// one piece, until something else is received.
+TEST_P(BufferedSpdyFramerTest, CoalescesStreamData) {
+  BufferedSpdyFramer framer(spdy_version(), true);
+  scoped_ptr<SpdyFrame> frames[] = {
+    scoped_ptr<SpdyFrame>(framer.CreateDataFrame(1, "abc", 3, DATA_FLAG_NONE)),
+    scoped_ptr<SpdyFrame>(framer.CreateDataFrame(1, "de", 2, DATA_FLAG_NONE)),
+    scoped_ptr<SpdyFrame>(framer.CreateDataFrame(3, "xy", 2, DATA_FLAG_NONE)),
+    scoped_ptr<SpdyFrame>(framer.CreateDataFrame(1, "f", 1, DATA_FLAG_NONE)),
+    scoped_ptr<SpdyFrame>(framer.CreatePingFrame(2)),
+    scoped_ptr<SpdyFrame>(framer.CreateDataFrame(1, "g", 1, DATA_FLAG_NONE)),
+    scoped_ptr<SpdyFrame>(framer.CreateDataFrame(1, "h", 1, DATA_FLAG_FIN)),
+    scoped_ptr<SpdyFrame>(framer.CreateDataFrame(3, "z", 1, DATA_FLAG_NONE)),
+  };
+  std::string input;
+  for (size_t i = 0; i < arraysize(frames); ++i)
+    input.append(frames[i]->data(), frames[i]->size());
+
+  TestBufferedSpdyVisitor visitor(spdy_version());
+  visitor.buffered_spdy_framer_.set_visitor(&visitor);
+  EXPECT_EQ(input.size(),
+            visitor.buffered_spdy_framer_.ProcessInput(input.data(),
+                                                       input.size()));
+  EXPECT_EQ(0, visitor.error_count_);
+
+  const char* const kExpectedEvents[] = {
+    "1:abcde", "3:xy", "1:f", "ping", "1:gh", "1:<fin>", "3:z",
+  };
+  ASSERT_EQ(arraysize(kExpectedEvents), visitor.events_.size());
+  for (size_t i = 0; i < arraysize(kExpectedEvents); ++i)
+    EXPECT_EQ(kExpectedEvents[i], visitor.events_[i]);
+}
+
 }  // namespace net
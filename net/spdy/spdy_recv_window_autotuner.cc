@@ -0,0 +1,68 @@
+// Copyright 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "net/spdy/spdy_recv_window_autotuner.h"
+
+#include <algorithm>
+
+#include "base/logging.h"
+
+namespace net {
+
+namespace {
+
+const int64 kMinAutotunedRttMs = 1;
+
+}  // namespace
+
+SpdyRecvWindowAutotuner::SpdyRecvWindowAutotuner(int32 window_size)
+    : window_size_(window_size),
+      growth_(0),
+      should_grow_(false),
+      bytes_received_(0) {}
+
+void SpdyRecvWindowAutotuner::OnDataReceived(int32 size,
+                                             base::TimeDelta rtt,
+                                             base::TimeTicks now) {
+  DCHECK_GE(size, 1);
+  if (rtt.InMilliseconds() < kMinAutotunedRttMs) {
+    period_start_ = base::TimeTicks();
+    bytes_received_ = 0;
+    return;
+  }
+
+  if (!period_start_.is_null() && now - period_start_ >= rtt) {
+    // More than half of the window per round trip, i.e. bytes_received_ /
+    // elapsed > window_size_ / 2 / rtt.
+    const base::TimeDelta elapsed = now - period_start_;
+    if (bytes_received_ * 2 * rtt.InMicroseconds() >
+        static_cast<int64>(window_size_) * elapsed.InMicroseconds()) {
+      should_grow_ = true;
+    }
+    period_start_ = base::TimeTicks();
+  }
+
+  if (period_start_.is_null()) {
+    period_start_ = now;
+    bytes_received_ = 0;
+  }
+  bytes_received_ += size;
+}
+
+int32 SpdyRecvWindowAutotuner::TakeGrowth(int32 max_growth) {
+  if (!should_grow_)
+    return 0;
+  should_grow_ = false;
+  if (window_size_ >= kSpdyMaxAutotunedRecvWindowSize || max_growth <= 0)
+    return 0;
+
+  const int32 growth = std::min(
+      std::min(window_size_, kSpdyMaxAutotunedRecvWindowSize - window_size_),
+      max_growth);
+  window_size_ += growth;
+  growth_ += growth;
+  return growth;
+}
+
+}  // namespace net
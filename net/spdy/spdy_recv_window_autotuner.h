@@ -0,0 +1,71 @@
+// Copyright 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef NET_SPDY_SPDY_RECV_WINDOW_AUTOTUNER_H_
+#define NET_SPDY_SPDY_RECV_WINDOW_AUTOTUNER_H_
+
+#include "base/basictypes.h"
+#include "base/time/time.h"
+#include "net/base/net_export.h"
+
+namespace net {
+
+// The largest receive window, for a stream or a session, that
+// SpdyRecvWindowAutotuner grows a window to. SpdySession also stops the
+// stream receive windows of a session from growing by more than this
+// altogether, which bounds the memory the session buffers.
+const int32 kSpdyMaxAutotunedRecvWindowSize = 64 * 1024 * 1024;  // 64MB
+
+// Decides when a receive window should grow, based on how fast data
+// arrives compared to the round trip time of the connection.
+//
+// Arrivals are measured over periods of at least one round trip. A peer
+// held back by the window sends about a whole window per round trip; a
+// peer held back by the network, or by a reader which consumes data
+// slowly, sends less. If more than half of the window arrived per round
+// trip, the window doubles, up to kSpdyMaxAutotunedRecvWindowSize, so it
+// stops growing once it is at least twice the bandwidth-delay product.
+// The growth is handed out when data is next consumed, so that it goes
+// out with the next WINDOW_UPDATE. Nothing happens until the round trip
+// time is known, nor when it is under a millisecond: the initial windows
+// already cover the bandwidth of such links.
+class NET_EXPORT_PRIVATE SpdyRecvWindowAutotuner {
+ public:
+  explicit SpdyRecvWindowAutotuner(int32 window_size);
+
+  // The current size of the whole window, including its growth so far.
+  int32 window_size() const { return window_size_; }
+
+  // Sets the size of the window, when it is changed by other means.
+  void set_window_size(int32 window_size) { window_size_ = window_size; }
+
+  // How many bytes the window has grown by so far.
+  int32 growth() const { return growth_; }
+
+  // Called when |size| bytes of data arrive at |now|, and |rtt| is the
+  // round trip time of the connection.
+  void OnDataReceived(int32 size, base::TimeDelta rtt, base::TimeTicks now);
+
+  // Called when data is consumed. Returns how many bytes the window grows
+  // by, at most |max_growth|, which the caller should add to the window
+  // and announce to the peer.
+  int32 TakeGrowth(int32 max_growth);
+
+ private:
+  int32 window_size_;
+  int32 growth_;
+
+  // Whether the window should grow the next time data is consumed.
+  bool should_grow_;
+
+  // The bytes received since |period_start_|.
+  int64 bytes_received_;
+  base::TimeTicks period_start_;
+
+  DISALLOW_COPY_AND_ASSIGN(SpdyRecvWindowAutotuner);
+};
+
+}  // namespace net
+
+#endif  // NET_SPDY_SPDY_RECV_WINDOW_AUTOTUNER_H_
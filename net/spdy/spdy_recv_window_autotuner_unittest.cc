@@ -0,0 +1,140 @@
+// Copyright 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "net/spdy/spdy_recv_window_autotuner.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace net {
+
+namespace {
+
+const int32 kWindowSize = 64 * 1024;
+
+class SpdyRecvWindowAutotunerTest : public ::testing::Test {
+ protected:
+  SpdyRecvWindowAutotunerTest()
+      : now_(base::TimeTicks() + base::TimeDelta::FromSeconds(1)),
+        rtt_(base::TimeDelta::FromMilliseconds(200)) {}
+
+  base::TimeTicks now_;
+  base::TimeDelta rtt_;
+};
+
+// The window grows when more than half of it arrives within a round trip.
+TEST_F(SpdyRecvWindowAutotunerTest, GrowsWhenHalfArrivesWithinRtt) {
+  SpdyRecvWindowAutotuner autotuner(kWindowSize);
+  autotuner.OnDataReceived(kWindowSize / 4, rtt_, now_);
+  now_ += rtt_ / 2;
+  autotuner.OnDataReceived(kWindowSize / 4 + 1, rtt_, now_);
+  EXPECT_EQ(0, autotuner.TakeGrowth(kint32max));
+
+  // The period ends with the first arrival a round trip after it started.
+  now_ += rtt_ / 2;
+  autotuner.OnDataReceived(1, rtt_, now_);
+  EXPECT_EQ(kWindowSize, autotuner.TakeGrowth(kint32max));
+  EXPECT_EQ(2 * kWindowSize, autotuner.window_size());
+  EXPECT_EQ(kWindowSize, autotuner.growth());
+
+  // The growth is only handed out once.
+  EXPECT_EQ(0, autotuner.TakeGrowth(kint32max));
+}
+
+// However fast the data is consumed, the window does not grow when the
+// data arrives slowly.
+TEST_F(SpdyRecvWindowAutotunerTest, DoesNotGrowWhenDataArrivesSlowly) {
+  SpdyRecvWindowAutotuner autotuner(kWindowSize);
+  autotuner.OnDataReceived(kWindowSize / 2, rtt_, now_);
+  EXPECT_EQ(0, autotuner.TakeGrowth(kint32max));
+  now_ += 2 * rtt_;
+  autotuner.OnDataReceived(kWindowSize / 2 + 1, rtt_, now_);
+  EXPECT_EQ(0, autotuner.TakeGrowth(kint32max));
+  EXPECT_EQ(kWindowSize, autotuner.window_size());
+
+  // A new period starts with the first arrival after the previous one.
+  now_ += rtt_;
+  autotuner.OnDataReceived(1, rtt_, now_);
+  EXPECT_EQ(kWindowSize, autotuner.TakeGrowth(kint32max));
+}
+
+TEST_F(SpdyRecvWindowAutotunerTest, DoesNotGrowWithoutRtt) {
+  const base::TimeDelta kShortRtt = base::TimeDelta::FromMicroseconds(500);
+  SpdyRecvWindowAutotuner autotuner(kWindowSize);
+  autotuner.OnDataReceived(kWindowSize, base::TimeDelta(), now_);
+  autotuner.OnDataReceived(kWindowSize, base::TimeDelta(), now_ + rtt_);
+  EXPECT_EQ(0, autotuner.TakeGrowth(kint32max));
+  autotuner.OnDataReceived(kWindowSize, kShortRtt, now_ + 2 * kShortRtt);
+  autotuner.OnDataReceived(kWindowSize, kShortRtt, now_ + 4 * kShortRtt);
+  EXPECT_EQ(0, autotuner.TakeGrowth(kint32max));
+  EXPECT_EQ(kWindowSize, autotuner.window_size());
+}
+
+TEST_F(SpdyRecvWindowAutotunerTest, GrowthIsCapped) {
+  SpdyRecvWindowAutotuner autotuner(kSpdyMaxAutotunedRecvWindowSize - 10);
+  autotuner.OnDataReceived(kSpdyMaxAutotunedRecvWindowSize, rtt_, now_);
+  autotuner.OnDataReceived(1, rtt_, now_ + rtt_);
+  EXPECT_EQ(10, autotuner.TakeGrowth(kint32max));
+  EXPECT_EQ(kSpdyMaxAutotunedRecvWindowSize, autotuner.window_size());
+
+  autotuner.OnDataReceived(kSpdyMaxAutotunedRecvWindowSize, rtt_,
+                           now_ + 2 * rtt_);
+  EXPECT_EQ(0, autotuner.TakeGrowth(kint32max));
+}
+
+TEST_F(SpdyRecvWindowAutotunerTest, GrowthIsLimitedByCaller) {
+  SpdyRecvWindowAutotuner autotuner(kWindowSize);
+  autotuner.OnDataReceived(kWindowSize, rtt_, now_);
+  autotuner.OnDataReceived(1, rtt_, now_ + rtt_);
+  EXPECT_EQ(10, autotuner.TakeGrowth(10));
+  EXPECT_EQ(kWindowSize + 10, autotuner.window_size());
+  EXPECT_EQ(10, autotuner.growth());
+}
+
+// Models a transfer over a link with a long round trip time and a high
+// bandwidth. The sender only sends what the window allows, and a
+// WINDOW_UPDATE takes half a round trip to reach it. The window should
+// grow until the link, rather than the window, limits the transfer.
+TEST_F(SpdyRecvWindowAutotunerTest, HighBandwidthDelayProductLink) {
+  // 100 Mbps, 200ms round trips: 2.5MB are in flight on a full link.
+  const int64 kBytesPerMs = 100 * 1000 * 1000 / 8 / 1000;
+  const int kRttMs = 200;
+  const int kTransferMs = 20 * 1000;
+  const int32 kBandwidthDelayProduct = kBytesPerMs * kRttMs;
+
+  SpdyRecvWindowAutotuner autotuner(kWindowSize);
+  // The window the sender has, and the updates on their way to it,
+  // indexed by the millisecond they arrive. Data is consumed as soon as
+  // it is received, so an update arrives one round trip after the data
+  // it is for was sent.
+  int64 sender_window = kWindowSize;
+  std::vector<int64> updates(kTransferMs + kRttMs, 0);
+  int64 received = 0;
+  for (int ms = 0; ms < kTransferMs; ++ms) {
+    sender_window += updates[ms];
+    int64 sent = std::min(kBytesPerMs, sender_window);
+    sender_window -= sent;
+    if (sent == 0)
+      continue;
+    received += sent;
+    autotuner.OnDataReceived(
+        sent, rtt_, now_ + base::TimeDelta::FromMilliseconds(ms));
+    int32 growth = autotuner.TakeGrowth(kint32max);
+    updates[ms + kRttMs] += sent + growth;
+  }
+
+  EXPECT_GE(autotuner.window_size(), 2 * kBandwidthDelayProduct);
+  EXPECT_LT(autotuner.window_size(), 4 * kBandwidthDelayProduct);
+  // Without growth, one window is received per round trip.
+  int64 fixed_window_received =
+      static_cast<int64>(kWindowSize) * kTransferMs / kRttMs;
+  EXPECT_GT(received, 10 * fixed_window_received);
+  EXPECT_GT(received, kBytesPerMs * kTransferMs * 8 / 10);
+}
+
+}  // namespace
+
+}  // namespace net
@@ -370,6 +370,8 @@ SpdySession::SpdySession(
       session_send_window_size_(0),
       session_recv_window_size_(0),
       session_unacked_recv_window_bytes_(0),
+      session_recv_window_autotuner_(kSpdySessionInitialWindowSize),
+      stream_recv_window_growth_(0),
       net_log_(BoundNetLog::Make(net_log, NetLog::SOURCE_SPDY_SESSION)),
       verify_domain_authentication_(verify_domain_authentication),
       enable_sending_initial_data_(enable_sending_initial_data),
@@ -459,6 +461,15 @@ Error SpdySession::InitializeWithSocket(
   if (protocol_ == kProtoHTTP2Draft04)
     send_connection_header_prefix_ = true;
 
+  // The TLS handshake takes two round trips, or one when resumed; take
+  // the lower estimate until a PING measures the round trip time.
+  const LoadTimingInfo::ConnectTiming& connect_timing =
+      connection_->connect_timing();
+  if (!connect_timing.ssl_start.is_null() &&
+      !connect_timing.ssl_end.is_null()) {
+    rtt_estimate_ = (connect_timing.ssl_end - connect_timing.ssl_start) / 2;
+  }
+
   if (protocol_ >= kProtoSPDY31) {
     flow_control_state_ = FLOW_CONTROL_STREAM_AND_SESSION;
     session_send_window_size_ = kSpdySessionInitialWindowSize;
@@ -726,6 +737,20 @@ int SpdySession::GetProtocolVersion() const {
   return buffered_spdy_framer_->protocol_version();
 }
 
+void SpdySession::OnRecvWindowDataReceived(
+    SpdyRecvWindowAutotuner* autotuner,
+    int32 size) {
+  autotuner->OnDataReceived(size, rtt_estimate_, time_func_());
+}
+
+int32 SpdySession::GrowStreamRecvWindow(SpdyRecvWindowAutotuner* autotuner) {
+  DCHECK_LE(stream_recv_window_growth_, kSpdyMaxAutotunedRecvWindowSize);
+  const int32 growth = autotuner->TakeGrowth(
+      kSpdyMaxAutotunedRecvWindowSize - stream_recv_window_growth_);
+  stream_recv_window_growth_ += growth;
+  return growth;
+}
+
 base::WeakPtr<SpdySession> SpdySession::GetWeakPtr() {
   return weak_factory_.GetWeakPtr();
 }
@@ -1691,6 +1716,9 @@ void SpdySession::DeleteStream(scoped_ptr<SpdyStream> stream, int status) {
 
   write_queue_.RemovePendingWritesForStream(stream->GetWeakPtr());
 
+  stream_recv_window_growth_ -= stream->recv_window_growth();
+  DCHECK_GE(stream_recv_window_growth_, 0);
+
   // |stream->OnClose()| may end up closing |this|, so detect that.
   base::WeakPtr<SpdySession> weak_this = GetWeakPtr();
 
@@ -1817,6 +1845,8 @@ void SpdySession::OnStreamFrameData(SpdyStreamId stream_id,
     buffer.reset(new SpdyBuffer(data, len));
 
     if (flow_control_state_ == FLOW_CONTROL_STREAM_AND_SESSION) {
+      OnRecvWindowDataReceived(&session_recv_window_autotuner_,
+                               static_cast<int32>(len));
       DecreaseRecvWindowSize(static_cast<int32>(len));
       buffer->AddConsumeCallback(
           base::Bind(&SpdySession::OnReadBufferConsumed,
@@ -2277,7 +2307,8 @@ void SpdySession::OnPing(uint32 unique_id) {
 
   // We will record RTT in histogram when there are no more client sent
   // pings_in_flight_.
-  RecordPingRTTHistogram(time_func_() - last_ping_sent_time_);
+  rtt_estimate_ = time_func_() - last_ping_sent_time_;
+  RecordPingRTTHistogram(rtt_estimate_);
 }
 
 void SpdySession::OnWindowUpdate(SpdyStreamId stream_id,
@@ -2404,6 +2435,8 @@ void SpdySession::SendInitialData() {
     DCHECK_GT(session_recv_window_size_, 0);
     IncreaseRecvWindowSize(
         kDefaultInitialRecvWindowSize - session_recv_window_size_);
+    session_recv_window_autotuner_.set_window_size(
+        kDefaultInitialRecvWindowSize);
   }
 
   // Finally, notify the server about the settings they have
@@ -2801,7 +2834,9 @@ void SpdySession::OnReadBufferConsumed(
   DCHECK_GE(consume_size, 1u);
   DCHECK_LE(consume_size, static_cast<size_t>(kint32max));
 
-  IncreaseRecvWindowSize(static_cast<int32>(consume_size));
+  int32 growth = session_recv_window_autotuner_.TakeGrowth(
+      kSpdyMaxAutotunedRecvWindowSize);
+  IncreaseRecvWindowSize(static_cast<int32>(consume_size) + growth);
 }
 
 void SpdySession::IncreaseRecvWindowSize(int32 delta_window_size) {
@@ -32,6 +32,7 @@
 #include "net/spdy/spdy_framer.h"
 #include "net/spdy/spdy_header_block.h"
 #include "net/spdy/spdy_protocol.h"
+#include "net/spdy/spdy_recv_window_autotuner.h"
 #include "net/spdy/spdy_session_pool.h"
 #include "net/spdy/spdy_stream.h"
 #include "net/spdy/spdy_write_queue.h"
@@ -428,6 +429,17 @@ class NET_EXPORT SpdySession : public BufferedSpdyFramerVisitorInterface,
     return stream_initial_recv_window_size_;
   }
 
+  // Passes the arrival of |size| bytes in a receive window to |autotuner|,
+  // along with this session's round trip time estimate.
+  void OnRecvWindowDataReceived(SpdyRecvWindowAutotuner* autotuner,
+                                int32 size);
+
+  // Returns how many bytes the receive window of a stream, tuned by
+  // |autotuner|, grows by as its data is consumed. The stream windows of
+  // this session grow by at most kSpdyMaxAutotunedRecvWindowSize bytes
+  // altogether; a stream's growth is given back when it is deleted.
+  int32 GrowStreamRecvWindow(SpdyRecvWindowAutotuner* autotuner);
+
   // Returns true if no stream in the session can send data due to
   // session flow control.
   bool IsSendStalled() const {
@@ -495,6 +507,8 @@ class NET_EXPORT SpdySession : public BufferedSpdyFramerVisitorInterface,
   FRIEND_TEST_ALL_PREFIXES(SpdySessionTest, ProtocolNegotiation);
   FRIEND_TEST_ALL_PREFIXES(SpdySessionTest, ClearSettings);
   FRIEND_TEST_ALL_PREFIXES(SpdySessionTest, AdjustRecvWindowSize);
+  FRIEND_TEST_ALL_PREFIXES(SpdySessionTest, AutotuneRecvWindowSize);
+  FRIEND_TEST_ALL_PREFIXES(SpdySessionTest, AutotuneStreamRecvWindowBudget);
   FRIEND_TEST_ALL_PREFIXES(SpdySessionTest, AdjustSendWindowSize);
   FRIEND_TEST_ALL_PREFIXES(SpdySessionTest, SessionFlowControlInactiveStream);
   FRIEND_TEST_ALL_PREFIXES(SpdySessionTest, SessionFlowControlNoReceiveLeaks);
@@ -1087,6 +1101,19 @@ class NET_EXPORT SpdySession : public BufferedSpdyFramerVisitorInterface,
   int32 session_recv_window_size_;
   int32 session_unacked_recv_window_bytes_;
 
+  // Grows the session receive window when the peer is held back by it.
+  // Only used when session flow control is turned on.
+  SpdyRecvWindowAutotuner session_recv_window_autotuner_;
+
+  // The round trip time of the connection, used to autotune the receive
+  // windows. Estimated from the TLS handshake, then taken from PINGs.
+  // Zero until known.
+  base::TimeDelta rtt_estimate_;
+
+  // How many bytes the receive windows of the streams of this session have
+  // grown by altogether. At most kSpdyMaxAutotunedRecvWindowSize.
+  int32 stream_recv_window_growth_;
+
   // A queue of stream IDs that have been send-stalled at some point
   // in the past.
   std::deque<SpdyStreamId> stream_send_unstall_queue_[NUM_PRIORITIES];
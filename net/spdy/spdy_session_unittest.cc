@@ -3142,6 +3142,123 @@ TEST_P(SpdySessionTest, AdjustRecvWindowSize) {
   EXPECT_EQ(0, session->session_unacked_recv_window_bytes_);
 }
 
+// The session receive window should double when more than half of it
+// arrives within a round trip, and only then. How fast the data is
+// consumed does not matter.
+TEST_P(SpdySessionTest, AutotuneRecvWindowSize) {
+  if (GetParam() < kProtoSPDY31)
+    return;
+
+  session_deps_.host_resolver->set_synchronous_mode(true);
+  session_deps_.time_func = TheNearFuture;
+
+  const int32 kFastDataSize = 40000;
+  const int32 kSlowDataSize = 70000;
+
+  MockConnect connect_data(SYNCHRONOUS, OK);
+  MockRead reads[] = {
+    MockRead(ASYNC, 0, 2)  // EOF
+  };
+  scoped_ptr<SpdyFrame> window_update1(
+      spdy_util_.ConstructSpdyWindowUpdate(
+          kSessionFlowControlStreamId,
+          kFastDataSize + kSpdySessionInitialWindowSize));
+  scoped_ptr<SpdyFrame> window_update2(
+      spdy_util_.ConstructSpdyWindowUpdate(
+          kSessionFlowControlStreamId, kSlowDataSize));
+  MockWrite writes[] = {
+    CreateMockWrite(*window_update1, 0),
+    CreateMockWrite(*window_update2, 1),
+  };
+  DeterministicSocketData data(reads, arraysize(reads),
+                               writes, arraysize(writes));
+  data.set_connect_data(connect_data);
+  session_deps_.deterministic_socket_factory->AddSocketDataProvider(&data);
+
+  SSLSocketDataProvider ssl(SYNCHRONOUS, OK);
+  session_deps_.deterministic_socket_factory->AddSSLSocketDataProvider(&ssl);
+
+  CreateDeterministicNetworkSession();
+  base::WeakPtr<SpdySession> session =
+      CreateInsecureSpdySession(http_session_, key_, BoundNetLog());
+  const base::TimeDelta kRtt = base::TimeDelta::FromMilliseconds(200);
+  session->rtt_estimate_ = kRtt;
+  SpdyRecvWindowAutotuner* autotuner =
+      &session->session_recv_window_autotuner_;
+
+  // Over half of the window arrives within a round trip. The growth goes
+  // out with the WINDOW_UPDATE for the consumed data.
+  session->OnRecvWindowDataReceived(autotuner, kFastDataSize);
+  g_time_delta = kRtt;
+  session->OnRecvWindowDataReceived(autotuner, 1);
+  session->OnReadBufferConsumed(kFastDataSize, SpdyBuffer::CONSUME);
+  EXPECT_EQ(2 * kSpdySessionInitialWindowSize, autotuner->window_size());
+  data.RunFor(1);
+
+  // Half of the new window arrives over several round trips, and is then
+  // consumed at once.
+  g_time_delta = base::TimeDelta::FromSeconds(1);
+  session->OnRecvWindowDataReceived(autotuner, kSlowDataSize);
+  g_time_delta = base::TimeDelta::FromSeconds(3);
+  session->OnRecvWindowDataReceived(autotuner, 1);
+  session->OnReadBufferConsumed(kSlowDataSize, SpdyBuffer::CONSUME);
+  EXPECT_EQ(2 * kSpdySessionInitialWindowSize, autotuner->window_size());
+  data.RunFor(1);
+
+  EXPECT_EQ(kSpdySessionInitialWindowSize + kFastDataSize +
+            kSpdySessionInitialWindowSize + kSlowDataSize,
+            session->session_recv_window_size_);
+  EXPECT_EQ(0, session->session_unacked_recv_window_bytes_);
+}
+
+// The stream receive windows of a session should not grow by more than
+// kSpdyMaxAutotunedRecvWindowSize altogether.
+TEST_P(SpdySessionTest, AutotuneStreamRecvWindowBudget) {
+  session_deps_.host_resolver->set_synchronous_mode(true);
+  session_deps_.time_func = TheNearFuture;
+
+  MockConnect connect_data(SYNCHRONOUS, OK);
+  MockRead reads[] = {
+    MockRead(ASYNC, 0, 0)  // EOF
+  };
+  DeterministicSocketData data(reads, arraysize(reads), NULL, 0);
+  data.set_connect_data(connect_data);
+  session_deps_.deterministic_socket_factory->AddSocketDataProvider(&data);
+
+  SSLSocketDataProvider ssl(SYNCHRONOUS, OK);
+  session_deps_.deterministic_socket_factory->AddSSLSocketDataProvider(&ssl);
+
+  CreateDeterministicNetworkSession();
+  base::WeakPtr<SpdySession> session =
+      CreateInsecureSpdySession(http_session_, key_, BoundNetLog());
+  const base::TimeDelta kRtt = base::TimeDelta::FromMilliseconds(200);
+  session->rtt_estimate_ = kRtt;
+
+  // A window grows by at most half of the budget, so it takes three
+  // streams to run out of it.
+  const int32 kWindowSize = kSpdyMaxAutotunedRecvWindowSize / 2;
+  SpdyRecvWindowAutotuner autotuner1(kWindowSize);
+  SpdyRecvWindowAutotuner autotuner2(kWindowSize);
+  SpdyRecvWindowAutotuner autotuner3(kWindowSize);
+  session->OnRecvWindowDataReceived(&autotuner1, kWindowSize);
+  session->OnRecvWindowDataReceived(&autotuner2, kWindowSize);
+  session->OnRecvWindowDataReceived(&autotuner3, kWindowSize);
+  g_time_delta = kRtt;
+  session->OnRecvWindowDataReceived(&autotuner1, 1);
+  session->OnRecvWindowDataReceived(&autotuner2, 1);
+  session->OnRecvWindowDataReceived(&autotuner3, 1);
+
+  // Any two of the windows could double, but not all three.
+  EXPECT_EQ(kWindowSize, session->GrowStreamRecvWindow(&autotuner1));
+  EXPECT_EQ(kWindowSize, session->GrowStreamRecvWindow(&autotuner2));
+  EXPECT_EQ(0, session->GrowStreamRecvWindow(&autotuner3));
+  EXPECT_EQ(kSpdyMaxAutotunedRecvWindowSize,
+            session->stream_recv_window_growth_);
+  EXPECT_EQ(kWindowSize, autotuner3.window_size());
+
+  data.RunFor(1);
+}
+
 // SpdySession::{Increase,Decrease}SendWindowSize should properly
 // adjust the session send window size when the "enable_spdy_31" flag
 // is set.
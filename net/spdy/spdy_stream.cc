@@ -96,6 +96,7 @@ SpdyStream::SpdyStream(SpdyStreamType type,
       send_window_size_(initial_send_window_size),
       recv_window_size_(initial_recv_window_size),
       unacked_recv_window_bytes_(0),
+      recv_window_autotuner_(initial_recv_window_size),
       session_(session),
       delegate_(NULL),
       send_status_(
@@ -307,7 +308,12 @@ void SpdyStream::OnReadBufferConsumed(
   DCHECK_GE(session_->flow_control_state(), SpdySession::FLOW_CONTROL_STREAM);
   DCHECK_GE(consume_size, 1u);
   DCHECK_LE(consume_size, static_cast<size_t>(kint32max));
-  IncreaseRecvWindowSize(static_cast<int32>(consume_size));
+  // The growth of an inactive stream would not be given back to the
+  // session, and IncreaseRecvWindowSize() ignores it anyway.
+  int32 growth = 0;
+  if (session_->IsStreamActive(stream_id_))
+    growth = session_->GrowStreamRecvWindow(&recv_window_autotuner_);
+  IncreaseRecvWindowSize(static_cast<int32>(consume_size) + growth);
 }
 
 void SpdyStream::IncreaseRecvWindowSize(int32 delta_window_size) {
@@ -490,6 +496,8 @@ void SpdyStream::OnDataReceived(scoped_ptr<SpdyBuffer> buffer) {
   size_t length = buffer->GetRemainingSize();
   DCHECK_LE(length, session_->GetDataFrameMaximumPayload());
   if (session_->flow_control_state() >= SpdySession::FLOW_CONTROL_STREAM) {
+    session_->OnRecvWindowDataReceived(&recv_window_autotuner_,
+                                       static_cast<int32>(length));
     DecreaseRecvWindowSize(static_cast<int32>(length));
     buffer->AddConsumeCallback(
         base::Bind(&SpdyStream::OnReadBufferConsumed, GetWeakPtr()));
@@ -24,6 +24,7 @@
 #include "net/spdy/spdy_framer.h"
 #include "net/spdy/spdy_header_block.h"
 #include "net/spdy/spdy_protocol.h"
+#include "net/spdy/spdy_recv_window_autotuner.h"
 #include "net/ssl/server_bound_cert_service.h"
 #include "net/ssl/ssl_client_cert_type.h"
 #include "url/gurl.h"
@@ -193,6 +194,11 @@ class NET_EXPORT_PRIVATE SpdyStream {
 
   int32 recv_window_size() const { return recv_window_size_; }
 
+  // How many bytes the receive window has been autotuned to grow by.
+  int32 recv_window_growth() const {
+    return recv_window_autotuner_.growth();
+  }
+
   bool send_stalled_by_flow_control() const {
     return send_stalled_by_flow_control_;
   }
@@ -493,6 +499,7 @@ class NET_EXPORT_PRIVATE SpdyStream {
   int32 send_window_size_;
   int32 recv_window_size_;
   int32 unacked_recv_window_bytes_;
+  SpdyRecvWindowAutotuner recv_window_autotuner_;
 
   ScopedBandwidthMetrics metrics_;
 
@@ -4,6 +4,7 @@
 
 #include "net/spdy/spdy_write_queue.h"
 
+#include <algorithm>
 #include <cstddef>
 
 #include "base/logging.h"
@@ -26,6 +27,16 @@ SpdyWriteQueue::PendingWrite::PendingWrite(
 
 SpdyWriteQueue::PendingWrite::~PendingWrite() {}
 
+SpdyWriteQueue::WriteList::WriteList(const SpdyStream* stream)
+    : stream(stream) {}
+
+SpdyWriteQueue::WriteList::~WriteList() {
+  for (std::deque<PendingWrite>::iterator it = writes.begin();
+       it != writes.end(); ++it) {
+    delete it->frame_producer;
+  }
+}
+
 SpdyWriteQueue::SpdyWriteQueue() {}
 
 SpdyWriteQueue::~SpdyWriteQueue() {
@@ -34,7 +45,7 @@ SpdyWriteQueue::~SpdyWriteQueue() {
 
 bool SpdyWriteQueue::IsEmpty() const {
   for (int i = 0; i < NUM_PRIORITIES; i++) {
-    if (!queue_[i].empty())
+    if (!turns_[i].empty())
       return false;
   }
   return true;
@@ -46,7 +57,21 @@ void SpdyWriteQueue::Enqueue(RequestPriority priority,
                              const base::WeakPtr<SpdyStream>& stream) {
   if (stream.get())
     DCHECK_EQ(stream->priority(), priority);
-  queue_[priority].push_back(
+
+  WriteList* write_list = NULL;
+  if (stream.get()) {
+    StreamWriteListMap::const_iterator it =
+        stream_write_lists_.find(stream.get());
+    if (it != stream_write_lists_.end())
+      write_list = it->second;
+  }
+  if (!write_list) {
+    write_list = new WriteList(stream.get());
+    if (stream.get())
+      stream_write_lists_[stream.get()] = write_list;
+    turns_[priority].push_back(write_list);
+  }
+  write_list->writes.push_back(
       PendingWrite(frame_type, frame_producer.release(), stream));
 }
 
@@ -54,9 +79,16 @@ bool SpdyWriteQueue::Dequeue(SpdyFrameType* frame_type,
                              scoped_ptr<SpdyBufferProducer>* frame_producer,
                              base::WeakPtr<SpdyStream>* stream) {
   for (int i = NUM_PRIORITIES - 1; i >= 0; --i) {
-    if (!queue_[i].empty()) {
-      PendingWrite pending_write = queue_[i].front();
-      queue_[i].pop_front();
+    if (!turns_[i].empty()) {
+      WriteList* write_list = turns_[i].front();
+      turns_[i].pop_front();
+      PendingWrite pending_write = write_list->writes.front();
+      write_list->writes.pop_front();
+      if (write_list->writes.empty())
+        DeleteWriteList(write_list);
+      else
+        turns_[i].push_back(write_list);
+
       *frame_type = pending_write.frame_type;
       frame_producer->reset(pending_write.frame_producer);
       *stream = pending_write.stream;
@@ -71,62 +103,59 @@ bool SpdyWriteQueue::Dequeue(SpdyFrameType* frame_type,
 void SpdyWriteQueue::RemovePendingWritesForStream(
     const base::WeakPtr<SpdyStream>& stream) {
   DCHECK(stream.get());
-  if (DCHECK_IS_ON()) {
-    // |stream| should not have pending writes in a queue not matching
-    // its priority.
-    for (int i = 0; i < NUM_PRIORITIES; ++i) {
-      if (stream->priority() == i)
-        continue;
-      for (std::deque<PendingWrite>::const_iterator it = queue_[i].begin();
-           it != queue_[i].end(); ++it) {
-        DCHECK_NE(it->stream.get(), stream.get());
-      }
-    }
-  }
-
-  // Do the actual deletion and removal, preserving FIFO-ness.
-  std::deque<PendingWrite>* queue = &queue_[stream->priority()];
-  std::deque<PendingWrite>::iterator out_it = queue->begin();
-  for (std::deque<PendingWrite>::const_iterator it = queue->begin();
-       it != queue->end(); ++it) {
-    if (it->stream.get() == stream.get()) {
-      delete it->frame_producer;
-    } else {
-      *out_it = *it;
-      ++out_it;
-    }
-  }
-  queue->erase(out_it, queue->end());
+  StreamWriteListMap::iterator it = stream_write_lists_.find(stream.get());
+  if (it == stream_write_lists_.end())
+    return;
+
+  WriteList* write_list = it->second;
+  std::deque<WriteList*>* turns = &turns_[stream->priority()];
+  std::deque<WriteList*>::iterator turn =
+      std::find(turns->begin(), turns->end(), write_list);
+  // |stream| should not have pending writes in a queue not matching
+  // its priority.
+  DCHECK(turn != turns->end());
+  turns->erase(turn);
+  DeleteWriteList(write_list);
 }
 
 void SpdyWriteQueue::RemovePendingWritesForStreamsAfter(
     SpdyStreamId last_good_stream_id) {
   for (int i = 0; i < NUM_PRIORITIES; ++i) {
-    // Do the actual deletion and removal, preserving FIFO-ness.
-    std::deque<PendingWrite>* queue = &queue_[i];
-    std::deque<PendingWrite>::iterator out_it = queue->begin();
-    for (std::deque<PendingWrite>::const_iterator it = queue->begin();
-         it != queue->end(); ++it) {
-      if (it->stream.get() && (it->stream->stream_id() > last_good_stream_id ||
-                               it->stream->stream_id() == 0)) {
-        delete it->frame_producer;
+    // Do the actual deletion and removal, preserving the order of the
+    // remaining turns.
+    std::deque<WriteList*>* turns = &turns_[i];
+    std::deque<WriteList*>::iterator out_it = turns->begin();
+    for (std::deque<WriteList*>::const_iterator it = turns->begin();
+         it != turns->end(); ++it) {
+      // All the writes of a list are for the same stream.
+      SpdyStream* stream = (*it)->writes.front().stream.get();
+      if (stream && (stream->stream_id() > last_good_stream_id ||
+                     stream->stream_id() == 0)) {
+        DeleteWriteList(*it);
       } else {
         *out_it = *it;
         ++out_it;
       }
     }
-    queue->erase(out_it, queue->end());
+    turns->erase(out_it, turns->end());
   }
 }
 
 void SpdyWriteQueue::Clear() {
   for (int i = 0; i < NUM_PRIORITIES; ++i) {
-    for (std::deque<PendingWrite>::iterator it = queue_[i].begin();
-         it != queue_[i].end(); ++it) {
-      delete it->frame_producer;
+    for (std::deque<WriteList*>::iterator it = turns_[i].begin();
+         it != turns_[i].end(); ++it) {
+      DeleteWriteList(*it);
     }
-    queue_[i].clear();
+    turns_[i].clear();
   }
+  DCHECK(stream_write_lists_.empty());
+}
+
+void SpdyWriteQueue::DeleteWriteList(WriteList* write_list) {
+  if (write_list->stream)
+    stream_write_lists_.erase(write_list->stream);
+  delete write_list;
 }
 
 }  // namespace net
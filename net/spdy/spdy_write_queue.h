@@ -6,6 +6,7 @@
 #define NET_SPDY_SPDY_WRITE_QUEUE_H_
 
 #include <deque>
+#include <map>
 
 #include "base/basictypes.h"
 #include "base/memory/scoped_ptr.h"
@@ -21,7 +22,12 @@ class SpdyBufferProducer;
 class SpdyStream;
 
 // A queue of SpdyBufferProducers to produce frames to write. Ordered
-// by priority, and then FIFO.
+// by priority. Within a priority, streams take turns: each one writes
+// a single frame, and then goes to the back of the line if it has more
+// frames to write. This way a stream with many frames queued (e.g., a
+// large upload) doesn't hold up the other streams at its priority.
+// Frames of a single stream, and frames not associated with a stream,
+// are written in FIFO order.
 class NET_EXPORT_PRIVATE SpdyWriteQueue {
  public:
   SpdyWriteQueue();
@@ -41,8 +47,8 @@ class NET_EXPORT_PRIVATE SpdyWriteQueue {
                scoped_ptr<SpdyBufferProducer> frame_producer,
                const base::WeakPtr<SpdyStream>& stream);
 
-  // Dequeues the frame producer with the highest priority that was
-  // enqueued the earliest and its associated stream. Returns true and
+  // Dequeues the next frame producer of the highest priority stream
+  // whose turn it is, and its associated stream. Returns true and
   // fills in |frame_type|, |frame_producer|, and |stream| if
   // successful -- otherwise, just returns false.
   bool Dequeue(SpdyFrameType* frame_type,
@@ -78,8 +84,32 @@ class NET_EXPORT_PRIVATE SpdyWriteQueue {
     ~PendingWrite();
   };
 
-  // The actual write queue, binned by priority.
-  std::deque<PendingWrite> queue_[NUM_PRIORITIES];
+  // The pending writes of one stream, in FIFO order. Each write that
+  // is not associated with a stream gets its own list, so that those
+  // keep their FIFO order with respect to the streams.
+  struct WriteList {
+    explicit WriteList(const SpdyStream* stream);
+    ~WriteList();
+
+    // NULL if this list holds a single write with no stream.
+    const SpdyStream* stream;
+    std::deque<PendingWrite> writes;
+  };
+
+  typedef std::map<const SpdyStream*, WriteList*> StreamWriteListMap;
+
+  // Deletes |write_list| and its frame producers, and removes it from
+  // |stream_write_lists_|.
+  void DeleteWriteList(WriteList* write_list);
+
+  // The lists with pending writes, binned by priority, in the order in
+  // which they get their next turn.
+  std::deque<WriteList*> turns_[NUM_PRIORITIES];
+
+  // The lists of the streams with pending writes. A stream's priority
+  // doesn't change while it has pending writes, so a stream has at
+  // most one list.
+  StreamWriteListMap stream_write_lists_;
 
   DISALLOW_COPY_AND_ASSIGN(SpdyWriteQueue);
 };
@@ -0,0 +1,148 @@
+// Copyright 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+#include "base/basictypes.h"
+#include "base/memory/scoped_ptr.h"
+#include "base/perftimer.h"
+#include "base/strings/stringprintf.h"
+#include "net/base/net_log.h"
+#include "net/base/request_priority.h"
+#include "net/spdy/spdy_buffer.h"
+#include "net/spdy/spdy_buffer_producer.h"
+#include "net/spdy/spdy_stream.h"
+#include "net/spdy/spdy_write_queue.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+namespace net {
+
+namespace {
+
+// About the size of the DATA frames SpdyStream sends, and of a
+// SYN_STREAM frame for a typical request.
+const size_t kDataFrameSize = 2 * 1460 - 8;
+const size_t kSynStreamFrameSize = 300;
+
+// The upload bandwidth of the modelled connection, in bytes per
+// millisecond (1 Mbps).
+const double kBytesPerMs = 125.0;
+
+// A large upload queues kUploadFrames DATA frames at once, and a small
+// stream is started every kFramesBetweenSmallStreams frames written.
+const int kUploadFrames = 400;
+const int kSmallStreams = 20;
+const int kFramesBetweenSmallStreams = 10;
+
+scoped_ptr<SpdyBufferProducer> MakeProducer(size_t size) {
+  scoped_ptr<char[]> data(new char[size]);
+  std::memset(data.get(), 0, size);
+  return scoped_ptr<SpdyBufferProducer>(
+      new SimpleBufferProducer(
+          scoped_ptr<SpdyBuffer>(
+              new SpdyBuffer(
+                  scoped_ptr<SpdyFrame>(
+                      new SpdyFrame(data.release(), size, true))))));
+}
+
+SpdyStream* MakeTestStream(RequestPriority priority) {
+  return new SpdyStream(
+      SPDY_BIDIRECTIONAL_STREAM, base::WeakPtr<SpdySession>(),
+      GURL(), priority, 0, 0, BoundNetLog());
+}
+
+// Writes everything in |write_queue| over the modelled connection, while
+// small streams at the same priority as the upload start and each send a
+// SYN_STREAM. Logs the average and worst time from the start of a small
+// stream until its request has been written, which bounds its time to
+// first byte.
+void RunUploadWithSmallStreams(const char* name) {
+  SpdyWriteQueue write_queue;
+  scoped_ptr<SpdyStream> upload(MakeTestStream(DEFAULT_PRIORITY));
+  for (int i = 0; i < kUploadFrames; ++i) {
+    write_queue.Enqueue(DEFAULT_PRIORITY, DATA, MakeProducer(kDataFrameSize),
+                        upload->GetWeakPtr());
+  }
+
+  scoped_ptr<SpdyStream> small_streams[kSmallStreams];
+  size_t start_bytes[kSmallStreams];
+  double total_delay_ms = 0;
+  double max_delay_ms = 0;
+  int started = 0;
+  int frames_written = 0;
+  size_t bytes_written = 0;
+
+  while (true) {
+    if (started < kSmallStreams &&
+        frames_written == started * kFramesBetweenSmallStreams) {
+      small_streams[started].reset(MakeTestStream(DEFAULT_PRIORITY));
+      write_queue.Enqueue(DEFAULT_PRIORITY, SYN_STREAM,
+                          MakeProducer(kSynStreamFrameSize),
+                          small_streams[started]->GetWeakPtr());
+      start_bytes[started] = bytes_written;
+      ++started;
+    }
+
+    SpdyFrameType frame_type = DATA;
+    scoped_ptr<SpdyBufferProducer> producer;
+    base::WeakPtr<SpdyStream> stream;
+    if (!write_queue.Dequeue(&frame_type, &producer, &stream))
+      break;
+    bytes_written += producer->ProduceBuffer()->GetRemainingSize();
+    ++frames_written;
+
+    if (frame_type == SYN_STREAM) {
+      for (int i = 0; i < started; ++i) {
+        if (small_streams[i].get() != stream.get())
+          continue;
+        double delay_ms = (bytes_written - start_bytes[i]) / kBytesPerMs;
+        total_delay_ms += delay_ms;
+        max_delay_ms = std::max(max_delay_ms, delay_ms);
+      }
+    }
+  }
+  ASSERT_EQ(kSmallStreams, started);
+
+  LogPerfResult(base::StringPrintf("%s_Mean", name).c_str(),
+                total_delay_ms / kSmallStreams, "ms");
+  LogPerfResult(base::StringPrintf("%s_Max", name).c_str(),
+                max_delay_ms, "ms");
+}
+
+TEST(SpdyWriteQueuePerfTest, SmallStreamDelayBehindUpload) {
+  RunUploadWithSmallStreams("SpdyWriteQueue_SmallStreamDelay");
+}
+
+// Measures the cost of scheduling, with many streams taking turns.
+TEST(SpdyWriteQueuePerfTest, EnqueueDequeue) {
+  const int kStreams = 100;
+  const int kFramesPerStream = 100;
+  scoped_ptr<SpdyStream> streams[kStreams];
+  for (int i = 0; i < kStreams; ++i)
+    streams[i].reset(MakeTestStream(static_cast<RequestPriority>(i % 3)));
+
+  SpdyWriteQueue write_queue;
+  PerfTimeLogger timer("SpdyWriteQueue_EnqueueDequeue");
+  for (int frame = 0; frame < kFramesPerStream; ++frame) {
+    for (int i = 0; i < kStreams; ++i) {
+      write_queue.Enqueue(streams[i]->priority(), DATA, MakeProducer(16),
+                          streams[i]->GetWeakPtr());
+    }
+  }
+  SpdyFrameType frame_type = DATA;
+  scoped_ptr<SpdyBufferProducer> producer;
+  base::WeakPtr<SpdyStream> stream;
+  int frames = 0;
+  while (write_queue.Dequeue(&frame_type, &producer, &stream))
+    ++frames;
+  timer.Done();
+  EXPECT_EQ(kStreams * kFramesPerStream, frames);
+}
+
+}  // namespace
+
+}  // namespace net
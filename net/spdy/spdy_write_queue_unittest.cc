@@ -151,6 +151,55 @@ TEST_F(SpdyWriteQueueTest, DequeuesFIFO) {
   EXPECT_FALSE(write_queue.Dequeue(&frame_type, &frame_producer, &stream));
 }
 
+// Enqueue several frames for one stream, then one frame each for
+// another stream and with no stream. The streams should take turns,
+// while the frames of each stream stay in FIFO order.
+TEST_F(SpdyWriteQueueTest, DequeuesRoundRobinAcrossStreams) {
+  SpdyWriteQueue write_queue;
+
+  scoped_ptr<SpdyStream> stream1(MakeTestStream(DEFAULT_PRIORITY));
+  scoped_ptr<SpdyStream> stream2(MakeTestStream(DEFAULT_PRIORITY));
+
+  for (int i = 0; i < 3; ++i) {
+    write_queue.Enqueue(DEFAULT_PRIORITY, DATA, IntToProducer(i),
+                        stream1->GetWeakPtr());
+  }
+  write_queue.Enqueue(DEFAULT_PRIORITY, SYN_STREAM, IntToProducer(10),
+                      stream2->GetWeakPtr());
+  write_queue.Enqueue(DEFAULT_PRIORITY, RST_STREAM, IntToProducer(20),
+                      base::WeakPtr<SpdyStream>());
+  write_queue.Enqueue(DEFAULT_PRIORITY, DATA, IntToProducer(11),
+                      stream2->GetWeakPtr());
+
+  const struct {
+    SpdyFrameType frame_type;
+    int value;
+    SpdyStream* stream;
+  } kExpected[] = {
+    { DATA, 0, stream1.get() },
+    { SYN_STREAM, 10, stream2.get() },
+    { RST_STREAM, 20, NULL },
+    { DATA, 1, stream1.get() },
+    { DATA, 11, stream2.get() },
+    { DATA, 2, stream1.get() },
+  };
+
+  for (size_t i = 0; i < arraysize(kExpected); ++i) {
+    SpdyFrameType frame_type = SYN_STREAM;
+    scoped_ptr<SpdyBufferProducer> frame_producer;
+    base::WeakPtr<SpdyStream> stream;
+    ASSERT_TRUE(write_queue.Dequeue(&frame_type, &frame_producer, &stream));
+    EXPECT_EQ(kExpected[i].frame_type, frame_type) << i;
+    EXPECT_EQ(kExpected[i].value, ProducerToInt(frame_producer.Pass())) << i;
+    EXPECT_EQ(kExpected[i].stream, stream.get()) << i;
+  }
+
+  SpdyFrameType frame_type = DATA;
+  scoped_ptr<SpdyBufferProducer> frame_producer;
+  base::WeakPtr<SpdyStream> stream;
+  EXPECT_FALSE(write_queue.Dequeue(&frame_type, &frame_producer, &stream));
+}
+
 // Enqueue a bunch of writes and then call
 // RemovePendingWritesForStream() on one of the streams. No dequeued
 // write should be for that stream.
@@ -0,0 +1,226 @@
+#!/usr/bin/env python
+# Copyright 2013 The Chromium Authors. All rights reserved.
+# Use of this source code is governed by a BSD-style license that can be
+# found in the LICENSE file.
+
+"""Compiles the rules of a .gperf file into a DAFSA in a C++ byte array.
+
+The input is the file generated by net/tools/tld_cleanup, for instance
+net/base/registry_controlled_domains/effective_tld_names.gperf. Each rule in
+it is a domain name with a type between 0 and 7. The output defines
+
+  const unsigned char kDafsa[] = { ... };
+
+which registry_controlled_domain.cc walks to find the rules matching a host.
+
+The rules are reversed before they are added to the graph, so that the graph
+is walked once, from the last character of a host to the first, and passes
+through every rule which matches a suffix of the host. A trie of the reversed
+rules is built first, and identical subtrees are then merged, which turns it
+into a deterministic acyclic finite state automaton (DAFSA).
+
+Encoding
+
+The graph is a sequence of nodes, starting with the root node. A node is
+
+  <tail length> <tail> <header> <children> <child position>*
+
+A chain of nodes which end no rule and have a single child is folded into the
+node it starts at: <tail> is the sequence of characters along the chain, and
+the rest of the encoding describes the node at its end. A node in the middle
+of a chain which is also the child of another node is encoded again on its
+own, with a shorter tail.
+
+<header> is 0x80 | type for a node which ends a rule of the given type, and 0
+for a node which ends no rule. 0x40 is added if <children> is a table. A node
+with fewer than TABLE_MIN_CHILDREN children lists the characters which lead
+to them, in increasing order:
+
+  <number of children> <character>*
+
+A node with more children has a table indexed by character instead, so that
+the walk finds a child without scanning its siblings:
+
+  <first character> <table length> <entry>*
+
+The entry for a character is 0 if no child is reached by it, and the index of
+the child plus one otherwise. The <child position>s are in increasing order of
+character, and each is the distance from the start of the array to the child,
+in 3 bytes, most significant first. A child is encoded as the node reached
+after its character, which the walk has already compared.
+
+Usage: make_dafsa.py <input.gperf> <output.cc>
+"""
+
+import sys
+
+# Nodes with at least this many children have a table indexed by character.
+TABLE_MIN_CHILDREN = 8
+
+
+class InputError(Exception):
+  """Exception raised for errors in the input file."""
+
+
+class Node(object):
+  """A node of the graph.
+
+  |value| is the type of the rule which ends at this node, or None.
+  |children| maps each character to the node it leads to.
+  """
+
+  def __init__(self):
+    self.value = None
+    self.children = {}
+
+
+def parse_gperf(lines):
+  """Returns the (name, type) pairs between the two '%%' lines of a .gperf
+  file."""
+  rules = []
+  in_rules = False
+  for line in lines:
+    line = line.strip()
+    if line == '%%':
+      if in_rules:
+        return rules
+      in_rules = True
+      continue
+    if not in_rules or not line:
+      continue
+    parts = line.split(',')
+    if len(parts) != 2:
+      raise InputError('Expected "name, type": %s' % line)
+    name = parts[0].strip()
+    value = int(parts[1])
+    if not name or not 0 <= value <= 7:
+      raise InputError('Invalid rule: %s' % line)
+    for c in name:
+      if ord(c) < 0x21 or ord(c) > 0x7e:
+        raise InputError('Invalid character in rule: %s' % line)
+    rules.append((name, value))
+  raise InputError('Missing "%%" lines')
+
+
+def to_trie(rules):
+  """Returns the root of a trie of the reversed |rules|."""
+  root = Node()
+  for name, value in rules:
+    node = root
+    for c in reversed(name):
+      node = node.children.setdefault(c, Node())
+    if node.value is not None:
+      raise InputError('Duplicate rule: %s' % name)
+    node.value = value
+  return root
+
+
+def to_dafsa(root):
+  """Merges identical subtrees of the trie at |root|, and returns the new
+  root."""
+  canonical = {}
+
+  def merge(node):
+    for c in node.children:
+      node.children[c] = merge(node.children[c])
+    key = (node.value, tuple(sorted((c, id(child))
+                                    for c, child in node.children.items())))
+    return canonical.setdefault(key, node)
+
+  return merge(root)
+
+
+def fold(node):
+  """Returns the tail and the end of the chain which starts at |node|.
+
+  A chain is a sequence of nodes which end no rule and have a single child,
+  and its tail is the sequence of characters along it.
+  """
+  tail = ''
+  while node.value is None and len(node.children) == 1:
+    c = list(node.children)[0]
+    tail += c
+    node = node.children[c]
+  if len(tail) > 255:
+    raise InputError('Rule too long: %s' % tail)
+  return tail, node
+
+
+def encode_node(node, positions):
+  """Returns the encoding of |node| as a list of bytes. |positions| maps the
+  id of each node to its position, or is None to get the length only."""
+  tail, end = fold(node)
+  chars = sorted(end.children)
+  header = 0 if end.value is None else 0x80 | end.value
+  result = [len(tail)] + [ord(c) for c in tail]
+  if len(chars) >= TABLE_MIN_CHILDREN:
+    first = ord(chars[0])
+    table = [0] * (ord(chars[-1]) - first + 1)
+    for i, c in enumerate(chars):
+      table[ord(c) - first] = i + 1
+    result += [header | 0x40, first, len(table)] + table
+  else:
+    result += [header, len(chars)] + [ord(c) for c in chars]
+  for c in chars:
+    position = positions[id(end.children[c])] if positions else 0
+    result += [position >> 16, (position >> 8) & 0xff, position & 0xff]
+  return result
+
+
+def encode(root):
+  """Returns the encoding of the graph at |root| as a list of bytes."""
+  order = []
+  visited = set()
+
+  def visit(node):
+    if id(node) in visited:
+      return
+    visited.add(id(node))
+    order.append(node)
+    _, end = fold(node)
+    for c in sorted(end.children):
+      visit(end.children[c])
+
+  visit(root)
+
+  positions = {}
+  length = 0
+  for node in order:
+    positions[id(node)] = length
+    length += len(encode_node(node, None))
+  if length >= 1 << 24:
+    raise InputError('Graph too large')
+
+  result = []
+  for node in order:
+    result += encode_node(node, positions)
+  return result
+
+
+def to_cxx(data):
+  """Returns the C++ source which defines |data| as kDafsa."""
+  text = '/* This file is generated by net/tools/dafsa/make_dafsa.py.\n'
+  text += '   DO NOT EDIT! */\n\n'
+  text += 'const unsigned char kDafsa[%d] = {\n' % len(data)
+  for i in range(0, len(data), 12):
+    text += '  '
+    text += ', '.join('0x%02x' % byte for byte in data[i:i + 12])
+    text += ',\n'
+  text += '};\n'
+  return text
+
+
+def main():
+  if len(sys.argv) != 3:
+    sys.stderr.write('usage: %s infile outfile\n' % sys.argv[0])
+    return 1
+  with open(sys.argv[1], 'r') as infile:
+    rules = parse_gperf(infile)
+  data = encode(to_dafsa(to_trie(rules)))
+  with open(sys.argv[2], 'w') as outfile:
+    outfile.write(to_cxx(data))
+  return 0
+
+
+if __name__ == '__main__':
+  sys.exit(main())
@@ -211,6 +211,7 @@ class GDig {
   bool print_hosts_;
   net::IPEndPoint nameserver_;
   base::TimeDelta timeout_;
+  int race_count_;
   int parallellism_;
   ReplayLog replay_log_;
   unsigned replay_log_index_;
@@ -237,6 +238,7 @@ GDig::GDig()
     : config_timeout_(base::TimeDelta::FromSeconds(5)),
       print_config_(false),
       print_hosts_(false),
+      race_count_(0),
       parallellism_(6),
       replay_log_index_(0u),
       active_resolves_(0) {
@@ -254,6 +256,7 @@ GDig::Result GDig::Main(int argc, const char* argv[]) {
               " [--print_config] [--print_hosts]"
               " [--nameserver=<ip_address[:port]>]"
               " [--timeout=<milliseconds>]"
+              " [--race_count=<servers>]"
               " [--config_timeout=<seconds>]"
               " [--j=<parallel resolves>]"
               " [--replay_file=<path>]"
@@ -339,6 +342,19 @@ bool GDig::ParseCommandLine(int argc, const char* argv[]) {
     }
   }
 
+  if (parsed_command_line.HasSwitch("race_count")) {
+    int race_count = 0;
+    bool parsed = base::StringToInt(
+        parsed_command_line.GetSwitchValueASCII("race_count"),
+        &race_count);
+    if (parsed && race_count > 0) {
+      race_count_ = race_count;
+    } else {
+      fprintf(stderr, "Invalid race_count parameter\n");
+      return false;
+    }
+  }
+
   if (parsed_command_line.HasSwitch("replay_file")) {
     base::FilePath replay_path =
         parsed_command_line.GetSwitchValuePath("replay_file");
@@ -404,6 +420,8 @@ void GDig::OnDnsConfig(const DnsConfig& dns_config_const) {
 
   if (timeout_.InMilliseconds() > 0)
     dns_config.timeout = timeout_;
+  if (race_count_ > 0)
+    dns_config.race_count = race_count_;
   if (print_config_) {
     printf("# Dns Configuration\n"
            "%s", DnsConfigToString(dns_config).c_str());
@@ -0,0 +1,50 @@
+// Copyright 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// This utility converts a file written by NetLogBinaryLogger to the JSON
+// format read by about:net-internals.
+
+#include <stdio.h>
+
+#include <string>
+
+#include "base/at_exit.h"
+#include "base/file_util.h"
+#include "base/files/file_path.h"
+#include "net/base/net_log_binary_logger.h"
+
+static int Usage(const char* argv0) {
+  fprintf(stderr, "Usage: %s <binary log file> <output JSON file>\n", argv0);
+  return 1;
+}
+
+int main(int argc, char** argv) {
+  base::AtExitManager at_exit_manager;
+
+  if (argc != 3)
+    return Usage(argv[0]);
+
+  base::FilePath input_filename = base::FilePath::FromUTF8Unsafe(argv[1]);
+  base::FilePath output_filename = base::FilePath::FromUTF8Unsafe(argv[2]);
+
+  std::string binary_log;
+  if (!file_util::ReadFileToString(input_filename, &binary_log)) {
+    fprintf(stderr, "Failed to read %s\n", argv[1]);
+    return 1;
+  }
+
+  std::string json;
+  if (!net::NetLogBinaryLogger::ConvertToJson(binary_log, &json)) {
+    fprintf(stderr, "%s is not a binary NetLog file\n", argv[1]);
+    return 1;
+  }
+
+  if (file_util::WriteFile(output_filename, json.data(), json.size()) !=
+      static_cast<int>(json.size())) {
+    fprintf(stderr, "Failed to write %s\n", argv[2]);
+    return 1;
+  }
+
+  return 0;
+}
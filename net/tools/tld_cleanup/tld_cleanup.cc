@@ -4,9 +4,9 @@
 
 // This command-line program converts an effective-TLD data file in UTF-8 from
 // the format provided by Mozilla to the format expected by Chrome.  This
-// program generates an intermediate file which is then used by gperf to
-// generate a perfect hash map.  The benefit of this approach is that no time is
-// spent on program initialization to generate the map of this data.
+// program generates an intermediate file which is then compiled into a graph
+// by net/tools/dafsa/make_dafsa.py.  The benefit of this approach is that no
+// time is spent on program initialization to generate the map of this data.
 //
 // Running this program finds "effective_tld_names.dat" in the expected location
 // in the source checkout and generates "effective_tld_names.gperf" next to it.
@@ -250,6 +250,7 @@ URLRequestHttpJob::URLRequestHttpJob(
           base::Bind(&URLRequestHttpJob::NotifyBeforeSendHeadersCallback,
                      base::Unretained(this))),
       read_in_progress_(false),
+      persist_sdch_dictionary_(true),
       throttling_entry_(NULL),
       sdch_dictionary_advertised_(false),
       sdch_test_activated_(false),
@@ -303,7 +304,8 @@ URLRequestHttpJob::~URLRequestHttpJob() {
     // coding to assure that IF the system is shutting down, we don't have any
     // problem if the manager was deleted ahead of time.
     if (manager)  // Defensive programming.
-      manager->FetchDictionary(request_info_.url, sdch_dictionary_url_);
+      manager->FetchDictionary(request_info_.url, sdch_dictionary_url_,
+                               persist_sdch_dictionary_);
   }
   DoneWithRequest(ABORTED);
 }
@@ -405,6 +407,9 @@ void URLRequestHttpJob::NotifyHeadersComplete() {
       DCHECK_EQ(request_->url(), request_info_.url);
       // Resolve suggested URL relative to request url.
       sdch_dictionary_url_ = request_info_.url.Resolve(url_text);
+      persist_sdch_dictionary_ =
+          !network_delegate() ||
+          network_delegate()->CanPersistSdchDictionary(*request_);
     }
   }
 
@@ -190,6 +190,10 @@ class NET_EXPORT_PRIVATE URLRequestHttpJob : public URLRequestJob {
   // An URL for an SDCH dictionary as suggested in a Get-Dictionary HTTP header.
   GURL sdch_dictionary_url_;
 
+  // True if the dictionary at |sdch_dictionary_url_| may be written to disk
+  // once fetched.
+  bool persist_sdch_dictionary_;
+
   scoped_ptr<HttpTransaction> transaction_;
 
   // This is used to supervise traffic and enforce exponential
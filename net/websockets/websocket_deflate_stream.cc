@@ -0,0 +1,219 @@
+// Copyright 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "net/websockets/websocket_deflate_stream.h"
+
+#include "base/bind.h"
+#include "base/logging.h"
+#include "net/base/io_buffer.h"
+#include "net/base/net_errors.h"
+
+namespace net {
+
+namespace {
+
+// The decompressor always uses the largest window, which decodes the data of
+// a compressor with any window size.
+const int kInflaterWindowBits = 15;
+
+// Returns a complete frame with |header|, whose payload is |payload|.
+scoped_ptr<WebSocketFrameChunk> MakeCompleteFrame(
+    scoped_ptr<WebSocketFrameHeader> header,
+    const scoped_refptr<IOBufferWithSize>& payload) {
+  scoped_ptr<WebSocketFrameChunk> chunk(new WebSocketFrameChunk);
+  header->payload_length = payload->size();
+  chunk->header = header.Pass();
+  chunk->final_chunk = true;
+  if (payload->size())
+    chunk->data = payload;
+  return chunk.Pass();
+}
+
+}  // namespace
+
+const size_t WebSocketDeflateStream::kMaxInflatedFrameSize = 16 * 1024 * 1024;
+
+WebSocketDeflateStream::WebSocketDeflateStream(
+    scoped_ptr<WebSocketStream> stream,
+    WebSocketDeflater::ContextTakeOverMode mode,
+    int client_window_bits)
+    : stream_(stream.Pass()),
+      deflater_(mode),
+      inflater_(kMaxInflatedFrameSize),
+      reading_state_(NOT_COMPRESSED) {
+  DCHECK(stream_.get());
+  // These only fail when zlib can not allocate its state.
+  CHECK(deflater_.Initialize(client_window_bits));
+  CHECK(inflater_.Initialize(kInflaterWindowBits));
+}
+
+WebSocketDeflateStream::~WebSocketDeflateStream() {}
+
+int WebSocketDeflateStream::ReadFrames(
+    ScopedVector<WebSocketFrameChunk>* frame_chunks,
+    const CompletionCallback& callback) {
+  // This use of base::Unretained is safe because we own |stream_|, which
+  // does not call the callback after it is destroyed.
+  int result = stream_->ReadFrames(
+      frame_chunks,
+      base::Bind(&WebSocketDeflateStream::OnReadComplete,
+                 base::Unretained(this), frame_chunks, callback));
+  if (result < 0)
+    return result;
+  DCHECK_EQ(OK, result);
+  return InflateAndReadIfNecessary(frame_chunks, callback);
+}
+
+int WebSocketDeflateStream::WriteFrames(
+    ScopedVector<WebSocketFrameChunk>* frame_chunks,
+    const CompletionCallback& callback) {
+  int result = Deflate(frame_chunks);
+  if (result != OK)
+    return result;
+  // Nothing is written until a compressed frame is complete.
+  if (frames_to_write_.empty())
+    return OK;
+  return stream_->WriteFrames(&frames_to_write_, callback);
+}
+
+void WebSocketDeflateStream::Close() { stream_->Close(); }
+
+std::string WebSocketDeflateStream::GetSubProtocol() const {
+  return stream_->GetSubProtocol();
+}
+
+std::string WebSocketDeflateStream::GetExtensions() const {
+  return stream_->GetExtensions();
+}
+
+int WebSocketDeflateStream::SendHandshakeRequest(
+    const GURL& url,
+    const HttpRequestHeaders& headers,
+    HttpResponseInfo* response_info,
+    const CompletionCallback& callback) {
+  return stream_->SendHandshakeRequest(url, headers, response_info, callback);
+}
+
+int WebSocketDeflateStream::ReadHandshakeResponse(
+    const CompletionCallback& callback) {
+  return stream_->ReadHandshakeResponse(callback);
+}
+
+void WebSocketDeflateStream::OnReadComplete(
+    ScopedVector<WebSocketFrameChunk>* frame_chunks,
+    const CompletionCallback& callback,
+    int result) {
+  if (result != OK) {
+    frame_chunks->clear();
+    callback.Run(result);
+    return;
+  }
+  result = InflateAndReadIfNecessary(frame_chunks, callback);
+  if (result != ERR_IO_PENDING)
+    callback.Run(result);
+}
+
+int WebSocketDeflateStream::InflateAndReadIfNecessary(
+    ScopedVector<WebSocketFrameChunk>* frame_chunks,
+    const CompletionCallback& callback) {
+  int result = Inflate(frame_chunks);
+  while (result == ERR_IO_PENDING) {
+    // Only parts of compressed frames were read, which are buffered until the
+    // frames are complete.
+    result = stream_->ReadFrames(
+        frame_chunks,
+        base::Bind(&WebSocketDeflateStream::OnReadComplete,
+                   base::Unretained(this), frame_chunks, callback));
+    if (result < 0)
+      break;
+    result = Inflate(frame_chunks);
+  }
+  if (result != OK && result != ERR_IO_PENDING)
+    frame_chunks->clear();
+  return result;
+}
+
+int WebSocketDeflateStream::Inflate(
+    ScopedVector<WebSocketFrameChunk>* frame_chunks) {
+  ScopedVector<WebSocketFrameChunk> chunks;
+  chunks.swap(*frame_chunks);
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    WebSocketFrameChunk* chunk = chunks[i];
+    if (chunk->header.get()) {
+      DCHECK(!current_reading_header_.get());
+      const WebSocketFrameHeader::OpCode opcode = chunk->header->opcode;
+      if (WebSocketFrameHeader::IsKnownDataOpCode(opcode)) {
+        if (opcode != WebSocketFrameHeader::kOpCodeContinuation) {
+          reading_state_ =
+              chunk->header->reserved1 ? COMPRESSED : NOT_COMPRESSED;
+        } else if (chunk->header->reserved1) {
+          // Only the first frame of a message says it is compressed.
+          return ERR_WS_PROTOCOL_ERROR;
+        }
+        if (reading_state_ == COMPRESSED) {
+          current_reading_header_ = chunk->header.Pass();
+          current_reading_header_->reserved1 = false;
+        }
+      }
+    }
+
+    if (!current_reading_header_.get()) {
+      frame_chunks->push_back(chunk);
+      chunks[i] = NULL;
+      continue;
+    }
+    if (chunk->data.get() &&
+        !inflater_.AddBytes(chunk->data->data(), chunk->data->size())) {
+      return ERR_WS_PROTOCOL_ERROR;
+    }
+    if (chunk->final_chunk) {
+      if (current_reading_header_->final && !inflater_.Finish())
+        return ERR_WS_PROTOCOL_ERROR;
+      frame_chunks->push_back(MakeCompleteFrame(current_reading_header_.Pass(),
+                                                inflater_.GetOutput())
+                                  .release());
+    }
+  }
+  return frame_chunks->empty() ? ERR_IO_PENDING : OK;
+}
+
+int WebSocketDeflateStream::Deflate(
+    ScopedVector<WebSocketFrameChunk>* frame_chunks) {
+  frames_to_write_.clear();
+  ScopedVector<WebSocketFrameChunk> chunks;
+  chunks.swap(*frame_chunks);
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    WebSocketFrameChunk* chunk = chunks[i];
+    if (chunk->header.get()) {
+      DCHECK(!current_writing_header_.get());
+      const WebSocketFrameHeader::OpCode opcode = chunk->header->opcode;
+      if (WebSocketFrameHeader::IsKnownDataOpCode(opcode)) {
+        current_writing_header_ = chunk->header.Pass();
+        // The first frame of each message says it is compressed.
+        current_writing_header_->reserved1 =
+            opcode != WebSocketFrameHeader::kOpCodeContinuation;
+      }
+    }
+
+    if (!current_writing_header_.get()) {
+      frames_to_write_.push_back(chunk);
+      chunks[i] = NULL;
+      continue;
+    }
+    if (chunk->data.get() &&
+        !deflater_.AddBytes(chunk->data->data(), chunk->data->size())) {
+      return ERR_UNEXPECTED;
+    }
+    if (chunk->final_chunk) {
+      if (!deflater_.Finish(current_writing_header_->final))
+        return ERR_UNEXPECTED;
+      frames_to_write_.push_back(
+          MakeCompleteFrame(current_writing_header_.Pass(),
+                            deflater_.GetOutput()).release());
+    }
+  }
+  return OK;
+}
+
+}  // namespace net
@@ -0,0 +1,111 @@
+// Copyright 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef NET_WEBSOCKETS_WEBSOCKET_DEFLATE_STREAM_H_
+#define NET_WEBSOCKETS_WEBSOCKET_DEFLATE_STREAM_H_
+
+#include <string>
+
+#include "base/basictypes.h"
+#include "base/compiler_specific.h"
+#include "base/memory/scoped_ptr.h"
+#include "base/memory/scoped_vector.h"
+#include "net/base/completion_callback.h"
+#include "net/base/net_export.h"
+#include "net/websockets/websocket_deflater.h"
+#include "net/websockets/websocket_frame.h"
+#include "net/websockets/websocket_inflater.h"
+#include "net/websockets/websocket_stream.h"
+
+class GURL;
+
+namespace net {
+
+// WebSocketDeflateStream is a WebSocketStream that implements the
+// permessage-deflate extension on top of another WebSocketStream, once the
+// extension has been negotiated in the handshake.
+//
+// Data messages are compressed as they are written, with one compressor per
+// stream whose window slides across messages. Received messages with the
+// RSV1 bit set are decompressed; every other frame is passed through. Each
+// compressed frame is buffered until it is complete, because the payload
+// length in the header of a frame must be known when the frame is passed on.
+class NET_EXPORT_PRIVATE WebSocketDeflateStream : public WebSocketStream {
+ public:
+  // Frames that decompress to more than this are a protocol error.
+  static const size_t kMaxInflatedFrameSize;
+
+  // |client_window_bits| is the size of the window of the compressor, and
+  // |mode| says whether the compressor keeps it across messages, as
+  // negotiated with the client_max_window_bits and
+  // client_no_context_takeover parameters of the extension.
+  WebSocketDeflateStream(scoped_ptr<WebSocketStream> stream,
+                         WebSocketDeflater::ContextTakeOverMode mode,
+                         int client_window_bits);
+  virtual ~WebSocketDeflateStream();
+
+  // WebSocketStream functions.
+  virtual int ReadFrames(ScopedVector<WebSocketFrameChunk>* frame_chunks,
+                         const CompletionCallback& callback) OVERRIDE;
+  virtual int WriteFrames(ScopedVector<WebSocketFrameChunk>* frame_chunks,
+                          const CompletionCallback& callback) OVERRIDE;
+  virtual void Close() OVERRIDE;
+  virtual std::string GetSubProtocol() const OVERRIDE;
+  virtual std::string GetExtensions() const OVERRIDE;
+  virtual int SendHandshakeRequest(const GURL& url,
+                                   const HttpRequestHeaders& headers,
+                                   HttpResponseInfo* response_info,
+                                   const CompletionCallback& callback) OVERRIDE;
+  virtual int ReadHandshakeResponse(
+      const CompletionCallback& callback) OVERRIDE;
+
+ private:
+  enum ReadingState {
+    // Frames are passed through untouched.
+    NOT_COMPRESSED,
+    // The frames of the current message are decompressed.
+    COMPRESSED,
+  };
+
+  void OnReadComplete(ScopedVector<WebSocketFrameChunk>* frame_chunks,
+                      const CompletionCallback& callback,
+                      int result);
+
+  // Inflates the chunks that were read, and reads again while that did not
+  // produce any chunk. Returns OK, ERR_IO_PENDING or a network error.
+  int InflateAndReadIfNecessary(
+      ScopedVector<WebSocketFrameChunk>* frame_chunks,
+      const CompletionCallback& callback);
+
+  // Replaces the chunks of compressed frames in |frame_chunks| by complete
+  // decompressed frames. Returns ERR_IO_PENDING if no chunk is left.
+  int Inflate(ScopedVector<WebSocketFrameChunk>* frame_chunks);
+
+  // Moves the chunks of |frame_chunks| to |frames_to_write_|, compressing
+  // data frames. Returns OK or a network error.
+  int Deflate(ScopedVector<WebSocketFrameChunk>* frame_chunks);
+
+  scoped_ptr<WebSocketStream> stream_;
+
+  WebSocketDeflater deflater_;
+  WebSocketInflater inflater_;
+
+  ReadingState reading_state_;
+  // The header of the compressed frame being read. NULL while the chunks
+  // being read are passed through.
+  scoped_ptr<WebSocketFrameHeader> current_reading_header_;
+
+  // The header of the data frame being written, which is sent once the frame
+  // is complete. NULL while the chunks being written are passed through.
+  scoped_ptr<WebSocketFrameHeader> current_writing_header_;
+  // The frames passed to |stream_| by the last WriteFrames(), which must be
+  // kept alive until it completes.
+  ScopedVector<WebSocketFrameChunk> frames_to_write_;
+
+  DISALLOW_COPY_AND_ASSIGN(WebSocketDeflateStream);
+};
+
+}  // namespace net
+
+#endif  // NET_WEBSOCKETS_WEBSOCKET_DEFLATE_STREAM_H_
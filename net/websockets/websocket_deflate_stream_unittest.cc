@@ -0,0 +1,354 @@
+// Copyright 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "net/websockets/websocket_deflate_stream.h"
+
+#include <deque>
+#include <string>
+
+#include "base/memory/scoped_ptr.h"
+#include "base/memory/scoped_vector.h"
+#include "net/base/io_buffer.h"
+#include "net/base/net_errors.h"
+#include "net/base/test_completion_callback.h"
+#include "net/websockets/websocket_frame.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace net {
+
+namespace {
+
+// "Hello", compressed as in the example of the permessage-deflate draft.
+const char kCompressedHello[] = "\xf2\x48\xcd\xc9\xc9\x07\x00";
+const size_t kCompressedHelloSize = arraysize(kCompressedHello) - 1;
+
+// Returns the frames queued by the test, and records the frames written to
+// it.
+class FakeWebSocketStream : public WebSocketStream {
+ public:
+  FakeWebSocketStream() : pending_frame_chunks_(NULL) {}
+
+  // Queues the chunks returned by a call of ReadFrames(). An empty vector
+  // makes ReadFrames() return ERR_IO_PENDING until CompletePendingRead().
+  void AddReadResult(ScopedVector<WebSocketFrameChunk>* frame_chunks) {
+    read_results_.push_back(new ScopedVector<WebSocketFrameChunk>);
+    read_results_.back()->swap(*frame_chunks);
+  }
+
+  // Completes a pending read with the next queued chunks.
+  void CompletePendingRead() {
+    ASSERT_TRUE(pending_frame_chunks_);
+    ScopedVector<WebSocketFrameChunk>* frame_chunks = pending_frame_chunks_;
+    pending_frame_chunks_ = NULL;
+    ASSERT_EQ(OK, PopReadResult(frame_chunks));
+    pending_callback_.Run(OK);
+  }
+
+  ScopedVector<WebSocketFrameChunk>* written() { return &written_; }
+
+  virtual int ReadFrames(ScopedVector<WebSocketFrameChunk>* frame_chunks,
+                         const CompletionCallback& callback) OVERRIDE {
+    if (!read_results_.empty() && read_results_.front()->empty()) {
+      delete read_results_.front();
+      read_results_.pop_front();
+      pending_frame_chunks_ = frame_chunks;
+      pending_callback_ = callback;
+      return ERR_IO_PENDING;
+    }
+    return PopReadResult(frame_chunks);
+  }
+
+  virtual int WriteFrames(ScopedVector<WebSocketFrameChunk>* frame_chunks,
+                          const CompletionCallback& callback) OVERRIDE {
+    for (size_t i = 0; i < frame_chunks->size(); ++i)
+      written_.push_back((*frame_chunks)[i]);
+    frame_chunks->weak_clear();
+    return OK;
+  }
+
+  virtual void Close() OVERRIDE {}
+  virtual std::string GetSubProtocol() const OVERRIDE { return ""; }
+  virtual std::string GetExtensions() const OVERRIDE {
+    return "permessage-deflate";
+  }
+  virtual int SendHandshakeRequest(
+      const GURL& url,
+      const HttpRequestHeaders& headers,
+      HttpResponseInfo* response_info,
+      const CompletionCallback& callback) OVERRIDE {
+    return ERR_IO_PENDING;
+  }
+  virtual int ReadHandshakeResponse(
+      const CompletionCallback& callback) OVERRIDE {
+    return ERR_IO_PENDING;
+  }
+
+ private:
+  int PopReadResult(ScopedVector<WebSocketFrameChunk>* frame_chunks) {
+    if (read_results_.empty())
+      return ERR_CONNECTION_CLOSED;
+    frame_chunks->swap(*read_results_.front());
+    delete read_results_.front();
+    read_results_.pop_front();
+    return OK;
+  }
+
+  std::deque<ScopedVector<WebSocketFrameChunk>*> read_results_;
+  ScopedVector<WebSocketFrameChunk>* pending_frame_chunks_;
+  CompletionCallback pending_callback_;
+  ScopedVector<WebSocketFrameChunk> written_;
+};
+
+// Appends a chunk to |frame_chunks|. The chunk has a header with |opcode|,
+// |final| and |reserved1| if |has_header| is true.
+void AppendChunk(bool has_header,
+                 WebSocketFrameHeader::OpCode opcode,
+                 bool final,
+                 bool reserved1,
+                 uint64 payload_length,
+                 bool final_chunk,
+                 const std::string& data,
+                 ScopedVector<WebSocketFrameChunk>* frame_chunks) {
+  scoped_ptr<WebSocketFrameChunk> chunk(new WebSocketFrameChunk);
+  if (has_header) {
+    chunk->header.reset(new WebSocketFrameHeader(opcode));
+    chunk->header->final = final;
+    chunk->header->reserved1 = reserved1;
+    chunk->header->payload_length = payload_length;
+  }
+  chunk->final_chunk = final_chunk;
+  if (!data.empty()) {
+    chunk->data = new IOBufferWithSize(data.size());
+    memcpy(chunk->data->data(), data.data(), data.size());
+  }
+  frame_chunks->push_back(chunk.release());
+}
+
+// Appends a complete frame to |frame_chunks|.
+void AppendFrame(WebSocketFrameHeader::OpCode opcode,
+                 bool final,
+                 bool reserved1,
+                 const std::string& data,
+                 ScopedVector<WebSocketFrameChunk>* frame_chunks) {
+  AppendChunk(true, opcode, final, reserved1, data.size(), true, data,
+              frame_chunks);
+}
+
+std::string ToString(const WebSocketFrameChunk* chunk) {
+  if (!chunk->data.get())
+    return "";
+  return std::string(chunk->data->data(), chunk->data->size());
+}
+
+class WebSocketDeflateStreamTest : public testing::Test {
+ protected:
+  WebSocketDeflateStreamTest() : stream_(new FakeWebSocketStream) {
+    deflate_stream_.reset(new WebSocketDeflateStream(
+        scoped_ptr<WebSocketStream>(stream_),
+        WebSocketDeflater::TAKE_OVER_CONTEXT,
+        15));
+  }
+
+  // Owned by |deflate_stream_|.
+  FakeWebSocketStream* stream_;
+  scoped_ptr<WebSocketDeflateStream> deflate_stream_;
+};
+
+TEST_F(WebSocketDeflateStreamTest, ReadCompressedFrame) {
+  ScopedVector<WebSocketFrameChunk> input;
+  AppendFrame(WebSocketFrameHeader::kOpCodeText, true, true,
+              std::string(kCompressedHello, kCompressedHelloSize), &input);
+  stream_->AddReadResult(&input);
+
+  ScopedVector<WebSocketFrameChunk> frame_chunks;
+  ASSERT_EQ(OK, deflate_stream_->ReadFrames(&frame_chunks,
+                                            CompletionCallback()));
+  ASSERT_EQ(1u, frame_chunks.size());
+  ASSERT_TRUE(frame_chunks[0]->header.get());
+  EXPECT_FALSE(frame_chunks[0]->header->reserved1);
+  EXPECT_TRUE(frame_chunks[0]->header->final);
+  EXPECT_EQ(5u, frame_chunks[0]->header->payload_length);
+  EXPECT_TRUE(frame_chunks[0]->final_chunk);
+  EXPECT_EQ("Hello", ToString(frame_chunks[0]));
+}
+
+// The chunks of a compressed frame are buffered until the frame is complete,
+// reading again as long as nothing can be returned.
+TEST_F(WebSocketDeflateStreamTest, ReadCompressedFrameInChunks) {
+  ScopedVector<WebSocketFrameChunk> input;
+  AppendChunk(true, WebSocketFrameHeader::kOpCodeText, true, true,
+              kCompressedHelloSize, false,
+              std::string(kCompressedHello, 3), &input);
+  stream_->AddReadResult(&input);
+  AppendChunk(false, 0, false, false, 0, true,
+              std::string(kCompressedHello + 3, kCompressedHelloSize - 3),
+              &input);
+  stream_->AddReadResult(&input);
+
+  ScopedVector<WebSocketFrameChunk> frame_chunks;
+  ASSERT_EQ(OK, deflate_stream_->ReadFrames(&frame_chunks,
+                                            CompletionCallback()));
+  ASSERT_EQ(1u, frame_chunks.size());
+  EXPECT_EQ(5u, frame_chunks[0]->header->payload_length);
+  EXPECT_EQ("Hello", ToString(frame_chunks[0]));
+}
+
+TEST_F(WebSocketDeflateStreamTest, ReadCompressedFrameAsynchronously) {
+  ScopedVector<WebSocketFrameChunk> input;
+  AppendChunk(true, WebSocketFrameHeader::kOpCodeText, true, true,
+              kCompressedHelloSize, false,
+              std::string(kCompressedHello, 3), &input);
+  stream_->AddReadResult(&input);
+  stream_->AddReadResult(&input);
+  AppendChunk(false, 0, false, false, 0, true,
+              std::string(kCompressedHello + 3, kCompressedHelloSize - 3),
+              &input);
+  stream_->AddReadResult(&input);
+
+  ScopedVector<WebSocketFrameChunk> frame_chunks;
+  TestCompletionCallback callback;
+  ASSERT_EQ(ERR_IO_PENDING, deflate_stream_->ReadFrames(&frame_chunks,
+                                                        callback.callback()));
+  stream_->CompletePendingRead();
+  ASSERT_EQ(OK, callback.WaitForResult());
+  ASSERT_EQ(1u, frame_chunks.size());
+  EXPECT_EQ("Hello", ToString(frame_chunks[0]));
+}
+
+// A compressed message is made of a frame with RSV1 and continuation frames
+// without it.
+TEST_F(WebSocketDeflateStreamTest, ReadCompressedMessageInFrames) {
+  ScopedVector<WebSocketFrameChunk> input;
+  AppendFrame(WebSocketFrameHeader::kOpCodeText, false, true,
+              std::string(kCompressedHello, 3), &input);
+  AppendFrame(WebSocketFrameHeader::kOpCodeContinuation, true, false,
+              std::string(kCompressedHello + 3, kCompressedHelloSize - 3),
+              &input);
+  stream_->AddReadResult(&input);
+
+  ScopedVector<WebSocketFrameChunk> frame_chunks;
+  ASSERT_EQ(OK, deflate_stream_->ReadFrames(&frame_chunks,
+                                            CompletionCallback()));
+  ASSERT_EQ(2u, frame_chunks.size());
+  std::string message = ToString(frame_chunks[0]) + ToString(frame_chunks[1]);
+  EXPECT_EQ("Hello", message);
+  EXPECT_FALSE(frame_chunks[0]->header->final);
+  EXPECT_EQ(WebSocketFrameHeader::kOpCodeContinuation,
+            frame_chunks[1]->header->opcode);
+  EXPECT_TRUE(frame_chunks[1]->header->final);
+}
+
+// Uncompressed messages and control frames are passed through, also between
+// the frames of a compressed message.
+TEST_F(WebSocketDeflateStreamTest, ReadUncompressedFrames) {
+  ScopedVector<WebSocketFrameChunk> input;
+  AppendFrame(WebSocketFrameHeader::kOpCodeText, true, false, "Plain",
+              &input);
+  AppendFrame(WebSocketFrameHeader::kOpCodeText, false, true,
+              std::string(kCompressedHello, kCompressedHelloSize), &input);
+  AppendFrame(WebSocketFrameHeader::kOpCodePing, true, false, "Ping",
+              &input);
+  AppendFrame(WebSocketFrameHeader::kOpCodeContinuation, true, false, "",
+              &input);
+  stream_->AddReadResult(&input);
+
+  ScopedVector<WebSocketFrameChunk> frame_chunks;
+  ASSERT_EQ(OK, deflate_stream_->ReadFrames(&frame_chunks,
+                                            CompletionCallback()));
+  ASSERT_EQ(4u, frame_chunks.size());
+  EXPECT_EQ("Plain", ToString(frame_chunks[0]));
+  EXPECT_EQ("Hello", ToString(frame_chunks[1]));
+  EXPECT_EQ(WebSocketFrameHeader::kOpCodePing,
+            frame_chunks[2]->header->opcode);
+  EXPECT_EQ("Ping", ToString(frame_chunks[2]));
+  EXPECT_EQ("", ToString(frame_chunks[3]));
+  EXPECT_EQ(0u, frame_chunks[3]->header->payload_length);
+}
+
+TEST_F(WebSocketDeflateStreamTest, ReadCorruptFrame) {
+  ScopedVector<WebSocketFrameChunk> input;
+  AppendFrame(WebSocketFrameHeader::kOpCodeText, true, true,
+              "\xff\xff\xff\xff", &input);
+  stream_->AddReadResult(&input);
+
+  ScopedVector<WebSocketFrameChunk> frame_chunks;
+  EXPECT_EQ(ERR_WS_PROTOCOL_ERROR,
+            deflate_stream_->ReadFrames(&frame_chunks, CompletionCallback()));
+  EXPECT_TRUE(frame_chunks.empty());
+}
+
+TEST_F(WebSocketDeflateStreamTest, ReadReserved1OnContinuationFrame) {
+  ScopedVector<WebSocketFrameChunk> input;
+  AppendFrame(WebSocketFrameHeader::kOpCodeText, false, true,
+              std::string(kCompressedHello, 3), &input);
+  AppendFrame(WebSocketFrameHeader::kOpCodeContinuation, true, true,
+              std::string(kCompressedHello + 3, kCompressedHelloSize - 3),
+              &input);
+  stream_->AddReadResult(&input);
+
+  ScopedVector<WebSocketFrameChunk> frame_chunks;
+  EXPECT_EQ(ERR_WS_PROTOCOL_ERROR,
+            deflate_stream_->ReadFrames(&frame_chunks, CompletionCallback()));
+}
+
+// Written messages are compressed with a window that slides across them.
+TEST_F(WebSocketDeflateStreamTest, WriteMessages) {
+  ScopedVector<WebSocketFrameChunk> frame_chunks;
+  AppendFrame(WebSocketFrameHeader::kOpCodeText, true, false, "Hello",
+              &frame_chunks);
+  AppendFrame(WebSocketFrameHeader::kOpCodePing, true, false, "Ping",
+              &frame_chunks);
+  AppendFrame(WebSocketFrameHeader::kOpCodeText, true, false, "Hello",
+              &frame_chunks);
+  ASSERT_EQ(OK, deflate_stream_->WriteFrames(&frame_chunks,
+                                             CompletionCallback()));
+
+  ScopedVector<WebSocketFrameChunk>* written = stream_->written();
+  ASSERT_EQ(3u, written->size());
+  EXPECT_TRUE((*written)[0]->header->reserved1);
+  EXPECT_EQ(kCompressedHelloSize, (*written)[0]->header->payload_length);
+  EXPECT_EQ(std::string(kCompressedHello, kCompressedHelloSize),
+            ToString((*written)[0]));
+  EXPECT_FALSE((*written)[1]->header->reserved1);
+  EXPECT_EQ("Ping", ToString((*written)[1]));
+  EXPECT_TRUE((*written)[2]->header->reserved1);
+  EXPECT_EQ(std::string("\xf2\x00\x11\x00\x00", 5), ToString((*written)[2]));
+}
+
+// A frame written in chunks is sent once it is complete, and only the first
+// frame of a message has RSV1.
+TEST_F(WebSocketDeflateStreamTest, WriteMessageInChunks) {
+  ScopedVector<WebSocketFrameChunk> frame_chunks;
+  AppendChunk(true, WebSocketFrameHeader::kOpCodeText, false, false, 3, false,
+              "Hel", &frame_chunks);
+  ASSERT_EQ(OK, deflate_stream_->WriteFrames(&frame_chunks,
+                                             CompletionCallback()));
+  EXPECT_TRUE(stream_->written()->empty());
+
+  AppendChunk(false, 0, false, false, 0, true, "", &frame_chunks);
+  AppendFrame(WebSocketFrameHeader::kOpCodeContinuation, true, false, "lo",
+              &frame_chunks);
+  ASSERT_EQ(OK, deflate_stream_->WriteFrames(&frame_chunks,
+                                             CompletionCallback()));
+  ScopedVector<WebSocketFrameChunk>* written = stream_->written();
+  ASSERT_EQ(2u, written->size());
+  EXPECT_TRUE((*written)[0]->header->reserved1);
+  EXPECT_FALSE((*written)[0]->header->final);
+  EXPECT_FALSE((*written)[1]->header->reserved1);
+  EXPECT_TRUE((*written)[1]->header->final);
+
+  // The written frames read back to the original message.
+  ScopedVector<WebSocketFrameChunk> input;
+  input.swap(*written);
+  stream_->AddReadResult(&input);
+  ASSERT_EQ(OK, deflate_stream_->ReadFrames(&frame_chunks,
+                                            CompletionCallback()));
+  ASSERT_EQ(2u, frame_chunks.size());
+  EXPECT_EQ("Hello",
+            ToString(frame_chunks[0]) + ToString(frame_chunks[1]));
+}
+
+}  // namespace
+
+}  // namespace net
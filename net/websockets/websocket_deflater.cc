@@ -0,0 +1,114 @@
+// Copyright 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "net/websockets/websocket_deflater.h"
+
+#include <string.h>
+
+#include <algorithm>
+
+#include "base/logging.h"
+#include "net/base/io_buffer.h"
+#include "third_party/zlib/zlib.h"
+
+namespace net {
+
+namespace {
+
+// The output buffer grows by this many bytes at a time.
+const size_t kOutputChunkSize = 4 * 1024;
+
+// The empty stored block that ends the data of a Z_SYNC_FLUSH.
+const char kFlushTrailer[] = { '\x00', '\x00', '\xff', '\xff' };
+
+}  // namespace
+
+WebSocketDeflater::WebSocketDeflater(ContextTakeOverMode mode)
+    : mode_(mode),
+      are_bytes_added_(false) {
+}
+
+WebSocketDeflater::~WebSocketDeflater() {
+  if (stream_.get())
+    deflateEnd(stream_.get());
+}
+
+bool WebSocketDeflater::Initialize(int window_bits) {
+  DCHECK(!stream_.get());
+  DCHECK_LE(9, window_bits);
+  DCHECK_GE(MAX_WBITS, window_bits);
+  stream_.reset(new z_stream);
+  memset(stream_.get(), 0, sizeof(*stream_));
+  // A negative window size asks for raw deflate data, without zlib header.
+  int result = deflateInit2(stream_.get(), Z_DEFAULT_COMPRESSION, Z_DEFLATED,
+                            -window_bits, 8, Z_DEFAULT_STRATEGY);
+  if (result != Z_OK) {
+    stream_.reset();
+    return false;
+  }
+  return true;
+}
+
+bool WebSocketDeflater::AddBytes(const char* data, size_t size) {
+  DCHECK(stream_.get());
+  if (!size)
+    return true;
+  are_bytes_added_ = true;
+  stream_->next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data));
+  stream_->avail_in = size;
+  bool result = Deflate(Z_NO_FLUSH);
+  DCHECK(!result || stream_->avail_in == 0);
+  return result;
+}
+
+bool WebSocketDeflater::Finish(bool end_of_message) {
+  DCHECK(stream_.get());
+  if (are_bytes_added_) {
+    if (!Deflate(Z_SYNC_FLUSH))
+      return false;
+    DCHECK_LE(arraysize(kFlushTrailer), output_.size());
+    DCHECK(std::equal(kFlushTrailer, kFlushTrailer + arraysize(kFlushTrailer),
+                      output_.end() - arraysize(kFlushTrailer)));
+    if (end_of_message)
+      output_.resize(output_.size() - arraysize(kFlushTrailer));
+  } else if (end_of_message) {
+    // zlib outputs nothing when there is nothing new to flush, but a message
+    // needs some data to be inflated from. A single zero byte followed by the
+    // trailer the receiver adds is an empty stored block.
+    output_.push_back('\0');
+  }
+  are_bytes_added_ = false;
+
+  if (end_of_message && mode_ == DO_NOT_TAKE_OVER_CONTEXT)
+    return deflateReset(stream_.get()) == Z_OK;
+  return true;
+}
+
+scoped_refptr<IOBufferWithSize> WebSocketDeflater::GetOutput() {
+  scoped_refptr<IOBufferWithSize> buffer(
+      new IOBufferWithSize(output_.size()));
+  if (!output_.empty())
+    memcpy(buffer->data(), &output_.front(), output_.size());
+  output_.clear();
+  return buffer;
+}
+
+bool WebSocketDeflater::Deflate(int flush) {
+  do {
+    const size_t used = output_.size();
+    output_.resize(used + kOutputChunkSize);
+    stream_->next_out = reinterpret_cast<Bytef*>(&output_[used]);
+    stream_->avail_out = kOutputChunkSize;
+    int result = deflate(stream_.get(), flush);
+    output_.resize(output_.size() - stream_->avail_out);
+    // Z_BUF_ERROR only means that no progress was possible.
+    if (result == Z_BUF_ERROR)
+      break;
+    if (result != Z_OK)
+      return false;
+  } while (stream_->avail_out == 0);
+  return true;
+}
+
+}  // namespace net
@@ -0,0 +1,73 @@
+// Copyright 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef NET_WEBSOCKETS_WEBSOCKET_DEFLATER_H_
+#define NET_WEBSOCKETS_WEBSOCKET_DEFLATER_H_
+
+#include <vector>
+
+#include "base/basictypes.h"
+#include "base/memory/ref_counted.h"
+#include "base/memory/scoped_ptr.h"
+#include "net/base/net_export.h"
+
+typedef struct z_stream_s z_stream;  // Forward declaration for zlib.
+
+namespace net {
+
+class IOBufferWithSize;
+
+// Compresses WebSocket messages for the permessage-deflate extension.
+//
+// The compressor keeps its sliding window across messages unless it was
+// created with DO_NOT_TAKE_OVER_CONTEXT, so that repetitive messages, which
+// are common on WebSocket connections, compress to a few bytes each.
+class NET_EXPORT_PRIVATE WebSocketDeflater {
+ public:
+  enum ContextTakeOverMode {
+    DO_NOT_TAKE_OVER_CONTEXT,
+    TAKE_OVER_CONTEXT,
+  };
+
+  explicit WebSocketDeflater(ContextTakeOverMode mode);
+  ~WebSocketDeflater();
+
+  // Returns true if the compressor was set up with a window of
+  // 2^|window_bits| bytes. |window_bits| must be between 9 and 15: zlib
+  // silently uses a 512-byte window when asked for 256 bytes, which would
+  // produce data a peer that negotiated 8 bits can not decode.
+  bool Initialize(int window_bits);
+
+  // Compresses |size| bytes of |data|. The compressed data may not be
+  // available from GetOutput() before Finish() is called.
+  bool AddBytes(const char* data, size_t size);
+
+  // Flushes the data added so far, to end a frame. If |end_of_message| is
+  // true, the empty block that terminates the flushed data is removed, as the
+  // extension requires, and the next message starts from an empty window in
+  // DO_NOT_TAKE_OVER_CONTEXT mode.
+  bool Finish(bool end_of_message);
+
+  // Returns the compressed data produced since the last call and clears it.
+  scoped_refptr<IOBufferWithSize> GetOutput();
+
+  // Returns the size of the data GetOutput() would return.
+  size_t CurrentOutputSize() const { return output_.size(); }
+
+ private:
+  // Runs the compressor with |flush| until it has no more output.
+  bool Deflate(int flush);
+
+  const ContextTakeOverMode mode_;
+  scoped_ptr<z_stream> stream_;
+  std::vector<char> output_;
+  // Whether there is input that has not been flushed yet.
+  bool are_bytes_added_;
+
+  DISALLOW_COPY_AND_ASSIGN(WebSocketDeflater);
+};
+
+}  // namespace net
+
+#endif  // NET_WEBSOCKETS_WEBSOCKET_DEFLATER_H_
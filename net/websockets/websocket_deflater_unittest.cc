@@ -0,0 +1,119 @@
+// Copyright 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "net/websockets/websocket_deflater.h"
+
+#include <string.h>
+
+#include <string>
+
+#include "net/base/io_buffer.h"
+#include "net/websockets/websocket_inflater.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace net {
+
+namespace {
+
+const size_t kMaxOutputSize = 1024 * 1024;
+
+std::string ToString(IOBufferWithSize* buffer) {
+  return std::string(buffer->data(), buffer->size());
+}
+
+// Compresses |message| as a single frame.
+std::string DeflateMessage(WebSocketDeflater* deflater,
+                           const std::string& message) {
+  EXPECT_TRUE(deflater->AddBytes(message.data(), message.size()));
+  EXPECT_TRUE(deflater->Finish(true));
+  return ToString(deflater->GetOutput().get());
+}
+
+TEST(WebSocketDeflaterTest, Construct) {
+  WebSocketDeflater deflater(WebSocketDeflater::TAKE_OVER_CONTEXT);
+  ASSERT_TRUE(deflater.Initialize(9));
+  EXPECT_EQ(0u, deflater.CurrentOutputSize());
+  EXPECT_EQ(0, deflater.GetOutput()->size());
+}
+
+// The example of the permessage-deflate draft.
+TEST(WebSocketDeflaterTest, DeflateHelloTakeOverContext) {
+  WebSocketDeflater deflater(WebSocketDeflater::TAKE_OVER_CONTEXT);
+  ASSERT_TRUE(deflater.Initialize(15));
+
+  EXPECT_EQ(std::string("\xf2\x48\xcd\xc9\xc9\x07\x00", 7),
+            DeflateMessage(&deflater, "Hello"));
+  // The second message refers to the first one.
+  EXPECT_EQ(std::string("\xf2\x00\x11\x00\x00", 5),
+            DeflateMessage(&deflater, "Hello"));
+}
+
+TEST(WebSocketDeflaterTest, DeflateHelloDoNotTakeOverContext) {
+  WebSocketDeflater deflater(WebSocketDeflater::DO_NOT_TAKE_OVER_CONTEXT);
+  ASSERT_TRUE(deflater.Initialize(15));
+
+  EXPECT_EQ(std::string("\xf2\x48\xcd\xc9\xc9\x07\x00", 7),
+            DeflateMessage(&deflater, "Hello"));
+  EXPECT_EQ(std::string("\xf2\x48\xcd\xc9\xc9\x07\x00", 7),
+            DeflateMessage(&deflater, "Hello"));
+}
+
+TEST(WebSocketDeflaterTest, DeflateEmptyMessage) {
+  WebSocketDeflater deflater(WebSocketDeflater::TAKE_OVER_CONTEXT);
+  ASSERT_TRUE(deflater.Initialize(15));
+  WebSocketInflater inflater(kMaxOutputSize);
+  ASSERT_TRUE(inflater.Initialize(15));
+
+  ASSERT_TRUE(deflater.Finish(true));
+  scoped_refptr<IOBufferWithSize> output = deflater.GetOutput();
+  EXPECT_LT(0, output->size());
+  ASSERT_TRUE(inflater.AddBytes(output->data(), output->size()));
+  ASSERT_TRUE(inflater.Finish());
+  EXPECT_EQ(0u, inflater.CurrentOutputSize());
+}
+
+// Each frame is flushed so that it can be sent right away, and only the end
+// of the message drops the trailer.
+TEST(WebSocketDeflaterTest, DeflateMessageInFrames) {
+  WebSocketDeflater deflater(WebSocketDeflater::TAKE_OVER_CONTEXT);
+  ASSERT_TRUE(deflater.Initialize(15));
+  WebSocketInflater inflater(kMaxOutputSize);
+  ASSERT_TRUE(inflater.Initialize(15));
+
+  const char* const kFrames[] = { "Hello, ", "", "world", "!" };
+  for (size_t i = 0; i < arraysize(kFrames); ++i) {
+    const bool end_of_message = i + 1 == arraysize(kFrames);
+    ASSERT_TRUE(deflater.AddBytes(kFrames[i], strlen(kFrames[i])));
+    ASSERT_TRUE(deflater.Finish(end_of_message));
+    std::string frame = ToString(deflater.GetOutput().get());
+    ASSERT_TRUE(inflater.AddBytes(frame.data(), frame.size()));
+    if (end_of_message) {
+      ASSERT_TRUE(inflater.Finish());
+    }
+    // All of the data of a frame can be inflated when the frame arrives.
+    EXPECT_EQ(kFrames[i], ToString(inflater.GetOutput().get()));
+  }
+}
+
+// A large repetitive message goes through the output buffer many times.
+TEST(WebSocketDeflaterTest, DeflateLargeMessage) {
+  WebSocketDeflater deflater(WebSocketDeflater::TAKE_OVER_CONTEXT);
+  ASSERT_TRUE(deflater.Initialize(9));
+  WebSocketInflater inflater(kMaxOutputSize);
+  ASSERT_TRUE(inflater.Initialize(9));
+
+  std::string message;
+  for (int i = 0; message.size() < 512 * 1024; ++i)
+    message += static_cast<char>(i * 7 % 251);
+  std::string compressed = DeflateMessage(&deflater, message);
+  EXPECT_LT(compressed.size(), message.size());
+
+  ASSERT_TRUE(inflater.AddBytes(compressed.data(), compressed.size()));
+  ASSERT_TRUE(inflater.Finish());
+  EXPECT_EQ(message, ToString(inflater.GetOutput().get()));
+}
+
+}  // namespace
+
+}  // namespace net
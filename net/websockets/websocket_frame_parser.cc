@@ -28,14 +28,34 @@ const uint8 kPayloadLengthMask = 0x7F;
 const uint64 kMaxPayloadLengthWithoutExtendedLengthField = 125;
 const uint64 kPayloadLengthWithTwoByteExtendedLengthField = 126;
 const uint64 kPayloadLengthWithEightByteExtendedLengthField = 127;
+const size_t kMaximumFrameHeaderSize =
+    net::WebSocketFrameHeader::kBaseHeaderSize +
+    net::WebSocketFrameHeader::kMaximumExtendedLengthSize +
+    net::WebSocketFrameHeader::kMaskingKeyLength;
+
+// Payload data of a frame, decoded in place in the buffer that was read from
+// the socket. Holds a reference to that buffer rather than copying from it.
+class PayloadIOBuffer : public net::IOBufferWithSize {
+ public:
+  PayloadIOBuffer(net::IOBuffer* buffer, size_t offset, int size)
+      : net::IOBufferWithSize(buffer->data() + offset, size),
+        buffer_(buffer) {}
+
+ private:
+  virtual ~PayloadIOBuffer() {
+    // |data_| is owned by |buffer_|.
+    data_ = NULL;
+  }
+
+  scoped_refptr<net::IOBuffer> buffer_;
+};
 
 }  // Unnamed namespace.
 
 namespace net {
 
 WebSocketFrameParser::WebSocketFrameParser()
-    : current_read_pos_(0),
-      frame_offset_(0),
+    : frame_offset_(0),
       websocket_error_(kWebSocketNormalClosure) {
   std::fill(masking_key_.key,
             masking_key_.key + WebSocketFrameHeader::kMaskingKeyLength,
@@ -53,61 +73,93 @@ bool WebSocketFrameParser::Decode(
   if (!length)
     return true;
 
-  // TODO(yutak): Remove copy.
-  buffer_.insert(buffer_.end(), data, data + length);
+  // The caller may reuse |data|, so copy it once into a buffer the chunks
+  // can share.
+  DCHECK_LE(length, static_cast<size_t>(kint32max));
+  scoped_refptr<IOBuffer> buffer(new IOBuffer(length));
+  memcpy(buffer->data(), data, length);
+  return Decode(buffer.get(), static_cast<int>(length), frame_chunks);
+}
 
-  while (current_read_pos_ < buffer_.size()) {
+bool WebSocketFrameParser::Decode(
+    IOBuffer* buffer,
+    int length,
+    ScopedVector<WebSocketFrameChunk>* frame_chunks) {
+  DCHECK_GE(length, 0);
+  if (websocket_error_ != kWebSocketNormalClosure)
+    return false;
+  if (!length)
+    return true;
+
+  const char* const data = buffer->data();
+  const size_t size = length;
+  size_t read_pos = 0;
+  while (read_pos < size) {
     bool first_chunk = false;
     if (!current_frame_header_.get()) {
-      DecodeFrameHeader();
+      if (buffer_.empty()) {
+        read_pos += DecodeFrameHeader(data + read_pos, size - read_pos);
+      } else {
+        // Complete the header carried over from the previous round of
+        // Decode(). Only as many bytes as a header may need are copied.
+        const size_t carried_size = buffer_.size();
+        const size_t copy_size =
+            std::min(size - read_pos, kMaximumFrameHeaderSize - carried_size);
+        buffer_.insert(buffer_.end(), data + read_pos,
+                       data + read_pos + copy_size);
+        const size_t header_size =
+            DecodeFrameHeader(&buffer_.front(), buffer_.size());
+        if (header_size) {
+          DCHECK_GT(header_size, carried_size);
+          read_pos += header_size - carried_size;
+          buffer_.clear();
+        } else {
+          read_pos += copy_size;
+        }
+      }
       if (websocket_error_ != kWebSocketNormalClosure)
         return false;
       // If frame header is incomplete, then carry over the remaining
       // data to the next round of Decode().
-      if (!current_frame_header_.get())
+      if (!current_frame_header_.get()) {
+        buffer_.insert(buffer_.end(), data + read_pos, data + size);
         break;
+      }
       first_chunk = true;
     }
 
     scoped_ptr<WebSocketFrameChunk> frame_chunk =
-        DecodeFramePayload(first_chunk);
+        DecodeFramePayload(first_chunk, buffer, &read_pos, size);
     DCHECK(frame_chunk.get());
     frame_chunks->push_back(frame_chunk.release());
 
     if (current_frame_header_.get()) {
-      DCHECK(current_read_pos_ == buffer_.size());
+      DCHECK_EQ(size, read_pos);
       break;
     }
   }
 
-  // Drain unnecessary data. TODO(yutak): Remove copy. (but how?)
-  buffer_.erase(buffer_.begin(), buffer_.begin() + current_read_pos_);
-  current_read_pos_ = 0;
-
   // Sanity check: the size of carried-over data should not exceed
   // the maximum possible length of a frame header.
-  static const size_t kMaximumFrameHeaderSize =
-      WebSocketFrameHeader::kBaseHeaderSize +
-      WebSocketFrameHeader::kMaximumExtendedLengthSize +
-      WebSocketFrameHeader::kMaskingKeyLength;
   DCHECK_LT(buffer_.size(), kMaximumFrameHeaderSize);
 
   return true;
 }
 
-void WebSocketFrameParser::DecodeFrameHeader() {
+size_t WebSocketFrameParser::DecodeFrameHeader(const char* data,
+                                               size_t size) {
   typedef WebSocketFrameHeader::OpCode OpCode;
   static const int kMaskingKeyLength = WebSocketFrameHeader::kMaskingKeyLength;
 
   DCHECK(!current_frame_header_.get());
 
-  const char* start = &buffer_.front() + current_read_pos_;
+  const char* start = data;
   const char* current = start;
-  const char* end = &buffer_.front() + buffer_.size();
+  const char* end = data + size;
 
   // Header needs 2 bytes at minimum.
   if (end - current < 2)
-    return;
+    return 0;
 
   uint8 first_byte = *current++;
   uint8 second_byte = *current++;
@@ -122,7 +174,7 @@ void WebSocketFrameParser::DecodeFrameHeader() {
   uint64 payload_length = second_byte & kPayloadLengthMask;
   if (payload_length == kPayloadLengthWithTwoByteExtendedLengthField) {
     if (end - current < 2)
-      return;
+      return 0;
     uint16 payload_length_16;
     ReadBigEndian(current, &payload_length_16);
     current += 2;
@@ -131,7 +183,7 @@ void WebSocketFrameParser::DecodeFrameHeader() {
       websocket_error_ = kWebSocketErrorProtocolError;
   } else if (payload_length == kPayloadLengthWithEightByteExtendedLengthField) {
     if (end - current < 8)
-      return;
+      return 0;
     ReadBigEndian(current, &payload_length);
     current += 8;
     if (payload_length <= kuint16max ||
@@ -143,15 +195,14 @@ void WebSocketFrameParser::DecodeFrameHeader() {
   }
   if (websocket_error_ != kWebSocketNormalClosure) {
     buffer_.clear();
-    current_read_pos_ = 0;
     current_frame_header_.reset();
     frame_offset_ = 0;
-    return;
+    return 0;
   }
 
   if (masked) {
     if (end - current < kMaskingKeyLength)
-      return;
+      return 0;
     std::copy(current, current + kMaskingKeyLength, masking_key_.key);
     current += kMaskingKeyLength;
   } else {
@@ -165,16 +216,17 @@ void WebSocketFrameParser::DecodeFrameHeader() {
   current_frame_header_->reserved3 = reserved3;
   current_frame_header_->masked = masked;
   current_frame_header_->payload_length = payload_length;
-  current_read_pos_ += current - start;
   DCHECK_EQ(0u, frame_offset_);
+  return current - start;
 }
 
 scoped_ptr<WebSocketFrameChunk> WebSocketFrameParser::DecodeFramePayload(
-    bool first_chunk) {
-  const char* current = &buffer_.front() + current_read_pos_;
-  const char* end = &buffer_.front() + buffer_.size();
+    bool first_chunk,
+    IOBuffer* buffer,
+    size_t* read_pos,
+    size_t size) {
   uint64 next_size = std::min<uint64>(
-      end - current, current_frame_header_->payload_length - frame_offset_);
+      size - *read_pos, current_frame_header_->payload_length - frame_offset_);
   // This check must pass because |payload_length| is already checked to be
   // less than std::numeric_limits<int>::max() when the header is parsed.
   DCHECK_LE(next_size, static_cast<uint64>(kint32max));
@@ -185,17 +237,16 @@ scoped_ptr<WebSocketFrameChunk> WebSocketFrameParser::DecodeFramePayload(
   }
   frame_chunk->final_chunk = false;
   if (next_size) {
-    frame_chunk->data = new IOBufferWithSize(static_cast<int>(next_size));
-    char* io_data = frame_chunk->data->data();
-    memcpy(io_data, current, next_size);
+    frame_chunk->data =
+        new PayloadIOBuffer(buffer, *read_pos, static_cast<int>(next_size));
     if (current_frame_header_->masked) {
       // The masking function is its own inverse, so we use the same function to
       // unmask as to mask.
       MaskWebSocketFramePayload(
-          masking_key_, frame_offset_, io_data, next_size);
+          masking_key_, frame_offset_, frame_chunk->data->data(), next_size);
     }
 
-    current_read_pos_ += next_size;
+    *read_pos += next_size;
     frame_offset_ += next_size;
   }
 
@@ -17,6 +17,8 @@
 
 namespace net {
 
+class IOBuffer;
+
 // Parses WebSocket frames from byte stream.
 //
 // Specification of WebSocket frame format is available at
@@ -40,6 +42,16 @@ class NET_EXPORT WebSocketFrameParser {
               size_t length,
               ScopedVector<WebSocketFrameChunk>* frame_chunks);
 
+  // Same as above, but decodes the first |length| bytes of |buffer| without
+  // copying the payload: the data of the chunks are slices of |buffer|, which
+  // is unmasked in place and kept alive by them. The caller must not reuse
+  // |buffer| afterwards; a socket read loop should read into a new buffer
+  // each time. Only the bytes of a frame header split across two buffers are
+  // copied.
+  bool Decode(IOBuffer* buffer,
+              int length,
+              ScopedVector<WebSocketFrameChunk>* frame_chunks);
+
   // Returns kWebSocketNormalClosure if the parser has not failed to decode
   // WebSocket frames. Otherwise returns WebSocketError which is defined in
   // websocket_errors.h. We can convert net::WebSocketError to net::Error by
@@ -47,28 +59,30 @@ class NET_EXPORT WebSocketFrameParser {
   WebSocketError websocket_error() const { return websocket_error_; }
 
  private:
-  // Tries to decode a frame header from |current_read_pos_|.
-  // If successful, this function updates |current_read_pos_|,
-  // |current_frame_header_|, and |masking_key_| (if available).
-  // This function may set |failed_| to true if it observes a corrupt frame.
-  // If there is not enough data in the remaining buffer to parse a frame
-  // header, this function returns without doing anything.
-  void DecodeFrameHeader();
-
-  // Decodes frame payload and creates a WebSocketFrameChunk object.
-  // This function updates |current_read_pos_| and |frame_offset_| after
+  // Tries to decode a frame header from the |size| bytes at |data|.
+  // If successful, this function updates |current_frame_header_| and
+  // |masking_key_| (if available), and returns the size of the header.
+  // This function may set |websocket_error_| if it observes a corrupt frame.
+  // If there is not enough data to parse a frame header, this function
+  // returns 0 without doing anything.
+  size_t DecodeFrameHeader(const char* data, size_t size);
+
+  // Decodes frame payload from |buffer|, starting at |*read_pos| and ending
+  // at |size|, and creates a WebSocketFrameChunk object whose data is a slice
+  // of |buffer|. This function updates |*read_pos| and |frame_offset_| after
   // parsing. This function returns a frame object even if no payload data is
   // available at this moment, so the receiver could make use of frame header
   // information. If the end of frame is reached, this function clears
   // |current_frame_header_|, |frame_offset_| and |masking_key_|.
-  scoped_ptr<WebSocketFrameChunk> DecodeFramePayload(bool first_chunk);
+  scoped_ptr<WebSocketFrameChunk> DecodeFramePayload(bool first_chunk,
+                                                     IOBuffer* buffer,
+                                                     size_t* read_pos,
+                                                     size_t size);
 
-  // Internal buffer to store the data to parse.
+  // The start of a frame header that was split across two buffers. It is
+  // always shorter than the maximum size of a frame header.
   std::vector<char> buffer_;
 
-  // Position in |buffer_| where the next round of parsing starts.
-  size_t current_read_pos_;
-
   // Frame header and masking key of the current frame.
   // |masking_key_| is filled with zeros if the current frame is not masked.
   scoped_ptr<WebSocketFrameHeader> current_frame_header_;
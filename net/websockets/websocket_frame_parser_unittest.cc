@@ -5,6 +5,7 @@
 #include "net/websockets/websocket_frame_parser.h"
 
 #include <algorithm>
+#include <string>
 #include <vector>
 
 #include "base/basictypes.h"
@@ -103,6 +104,51 @@ TEST(WebSocketFrameParserTest, DecodeMaskedFrame) {
   EXPECT_TRUE(std::equal(kHello, kHello + kHelloLength, frame->data->data()));
 }
 
+// Payloads decoded from an IOBuffer are unmasked in place and refer to that
+// buffer, including when a frame header is split across two buffers.
+TEST(WebSocketFrameParserTest, DecodeIOBufferWithoutCopy) {
+  static const size_t kMaskedHelloHeaderLength =
+      kMaskedHelloFrameLength - kHelloLength;
+  static const size_t kSplitPos = 3;
+  std::string input(kMaskedHelloFrame, kMaskedHelloFrameLength);
+  input += input;
+  const size_t first_length = kMaskedHelloFrameLength + kSplitPos;
+  scoped_refptr<IOBuffer> first_buffer(new IOBuffer(first_length));
+  std::copy(input.begin(), input.begin() + first_length,
+            first_buffer->data());
+  const size_t second_length = input.size() - first_length;
+  scoped_refptr<IOBuffer> second_buffer(new IOBuffer(second_length));
+  std::copy(input.begin() + first_length, input.end(), second_buffer->data());
+
+  WebSocketFrameParser parser;
+  ScopedVector<WebSocketFrameChunk> frames;
+  EXPECT_TRUE(parser.Decode(first_buffer.get(), first_length, &frames));
+  EXPECT_TRUE(parser.Decode(second_buffer.get(), second_length, &frames));
+  EXPECT_EQ(kWebSocketNormalClosure, parser.websocket_error());
+  ASSERT_EQ(2u, frames.size());
+
+  const char* const expected_data[] = {
+    first_buffer->data() + kMaskedHelloHeaderLength,
+    second_buffer->data() + kMaskedHelloHeaderLength - kSplitPos,
+  };
+  for (size_t i = 0; i < frames.size(); ++i) {
+    const WebSocketFrameChunk* frame = frames[i];
+    ASSERT_TRUE(frame->header.get() != NULL);
+    EXPECT_TRUE(frame->header->masked);
+    EXPECT_TRUE(frame->final_chunk);
+    ASSERT_TRUE(frame->data.get() != NULL);
+    EXPECT_EQ(expected_data[i], frame->data->data());
+    ASSERT_EQ(static_cast<int>(kHelloLength), frame->data->size());
+    EXPECT_TRUE(
+        std::equal(kHello, kHello + kHelloLength, frame->data->data()));
+  }
+
+  // The payload stays valid after the caller drops its buffer.
+  first_buffer = NULL;
+  EXPECT_TRUE(
+      std::equal(kHello, kHello + kHelloLength, frames[0]->data->data()));
+}
+
 TEST(WebSocketFrameParserTest, DecodeManyFrames) {
   struct Input {
     const char* frame;
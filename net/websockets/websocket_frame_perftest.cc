@@ -0,0 +1,148 @@
+// Copyright 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <algorithm>
+#include <string>
+
+#include "base/memory/scoped_vector.h"
+#include "base/perftimer.h"
+#include "base/strings/stringprintf.h"
+#include "net/base/io_buffer.h"
+#include "net/websockets/websocket_deflater.h"
+#include "net/websockets/websocket_frame.h"
+#include "net/websockets/websocket_frame_parser.h"
+#include "net/websockets/websocket_inflater.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace net {
+
+namespace {
+
+// Every test processes this many bytes of messages.
+const size_t kBytesPerTest = 256 * 1024 * 1024;
+
+// The size of the buffers read from the socket.
+const int kReadSize = 32 * 1024;
+
+const size_t kSmallMessageSize = 64;
+const size_t kLargeMessageSize = 1024 * 1024;
+
+// Returns a message of |size| bytes of text that compresses moderately.
+std::string MakeMessage(size_t size) {
+  std::string message;
+  for (size_t i = 0; message.size() < size; ++i)
+    message += base::StringPrintf("{\"id\":%d,\"value\":%d},",
+                                  static_cast<int>(i),
+                                  static_cast<int>(i * i % 97));
+  message.resize(size);
+  return message;
+}
+
+// Returns the wire format of a masked text frame whose payload is |payload|.
+std::string MakeMaskedFrame(const std::string& payload) {
+  WebSocketFrameHeader header(WebSocketFrameHeader::kOpCodeText);
+  header.final = true;
+  header.masked = true;
+  header.payload_length = payload.size();
+  WebSocketMaskingKey masking_key = GenerateWebSocketMaskingKey();
+  std::string frame(GetWebSocketFrameHeaderSize(header) + payload.size(),
+                    '\0');
+  int header_size = WriteWebSocketFrameHeader(header, &masking_key,
+                                              &frame[0], frame.size());
+  EXPECT_LT(0, header_size);
+  std::copy(payload.begin(), payload.end(), frame.begin() + header_size);
+  MaskWebSocketFramePayload(masking_key, 0, &frame[header_size],
+                            payload.size());
+  return frame;
+}
+
+void LogThroughput(const char* name, size_t message_size, size_t bytes,
+                   double seconds) {
+  LogPerfResult(base::StringPrintf("%s_%uB", name,
+                                   static_cast<unsigned>(message_size)).c_str(),
+                bytes / seconds / (1024 * 1024), "MB/s");
+}
+
+// Measures how fast masked frames of |message_size| bytes are parsed from
+// socket reads, the way the browser receives them from a server that masks
+// its frames.
+void RunParserTest(size_t message_size) {
+  const size_t frames_per_stream =
+      std::max<size_t>(1, 4 * 1024 * 1024 / message_size);
+  std::string stream;
+  std::string frame = MakeMaskedFrame(MakeMessage(message_size));
+  for (size_t i = 0; i < frames_per_stream; ++i)
+    stream += frame;
+
+  size_t parsed = 0;
+  PerfTimer timer;
+  while (parsed < kBytesPerTest) {
+    WebSocketFrameParser parser;
+    for (size_t offset = 0; offset < stream.size(); offset += kReadSize) {
+      int length = std::min<size_t>(kReadSize, stream.size() - offset);
+      // A new buffer is read into every time, as the chunks refer to it.
+      scoped_refptr<IOBuffer> buffer(new IOBuffer(kReadSize));
+      memcpy(buffer->data(), stream.data() + offset, length);
+      ScopedVector<WebSocketFrameChunk> frame_chunks;
+      ASSERT_TRUE(parser.Decode(buffer.get(), length, &frame_chunks));
+      for (size_t i = 0; i < frame_chunks.size(); ++i) {
+        if (frame_chunks[i]->data.get())
+          parsed += frame_chunks[i]->data->size();
+      }
+    }
+  }
+  LogThroughput("WebSocketFrameParser_Decode", message_size, parsed,
+                timer.Elapsed().InSecondsF());
+}
+
+// Measures how fast messages of |message_size| bytes are compressed and
+// decompressed with permessage-deflate, keeping the context across messages.
+void RunDeflateTest(size_t message_size) {
+  std::string message = MakeMessage(message_size);
+  WebSocketDeflater deflater(WebSocketDeflater::TAKE_OVER_CONTEXT);
+  ASSERT_TRUE(deflater.Initialize(15));
+  WebSocketInflater inflater(2 * kLargeMessageSize);
+  ASSERT_TRUE(inflater.Initialize(15));
+
+  size_t processed = 0;
+  size_t compressed = 0;
+  PerfTimer timer;
+  while (processed < kBytesPerTest / 4) {
+    ASSERT_TRUE(deflater.AddBytes(message.data(), message.size()));
+    ASSERT_TRUE(deflater.Finish(true));
+    scoped_refptr<IOBufferWithSize> output = deflater.GetOutput();
+    compressed += output->size();
+    ASSERT_TRUE(inflater.AddBytes(output->data(), output->size()));
+    ASSERT_TRUE(inflater.Finish());
+    ASSERT_EQ(message.size(), inflater.CurrentOutputSize());
+    inflater.GetOutput();
+    processed += message.size();
+  }
+  LogThroughput("WebSocketDeflate_RoundTrip", message_size, processed,
+                timer.Elapsed().InSecondsF());
+  LogPerfResult(base::StringPrintf(
+                    "WebSocketDeflate_Ratio_%uB",
+                    static_cast<unsigned>(message_size)).c_str(),
+                static_cast<double>(processed) / compressed, "x");
+}
+
+TEST(WebSocketFramePerfTest, ParseSmallMessages) {
+  RunParserTest(kSmallMessageSize);
+}
+
+TEST(WebSocketFramePerfTest, ParseLargeMessages) {
+  RunParserTest(kLargeMessageSize);
+}
+
+TEST(WebSocketFramePerfTest, DeflateSmallMessages) {
+  RunDeflateTest(kSmallMessageSize);
+}
+
+TEST(WebSocketFramePerfTest, DeflateLargeMessages) {
+  RunDeflateTest(kLargeMessageSize);
+}
+
+}  // namespace
+
+}  // namespace net
@@ -342,6 +342,48 @@ TEST(WebSocketFrameTest, MaskPayloadAlignment) {
   }
 }
 
+// The payloads above are too small to reach the SIMD loop, which only masks
+// payloads of a few hundred bytes or more. Check larger payloads against a
+// byte-at-a-time reference, at every alignment and at sizes around the loop
+// boundaries.
+TEST(WebSocketFrameTest, MaskLargePayloadAlignment) {
+  static const size_t kMaxAlignment = 64;
+  static const size_t kMaxPayloadSize = 1024 + 67;
+  static const size_t kMaskingKeyLength =
+      WebSocketFrameHeader::kMaskingKeyLength;
+  static const char kTestMask[] = "\x9c\x3a\x71\xe5";
+  static const size_t kPayloadSizes[] = {
+    255, 256, 257, 319, 320, 321, 383, 1024, 1025, kMaxPayloadSize
+  };
+  scoped_ptr_malloc<char, base::ScopedPtrAlignedFree> scratch(
+      static_cast<char*>(
+          base::AlignedAlloc(kMaxAlignment + kMaxPayloadSize, kMaxAlignment)));
+  std::vector<char> input(kMaxPayloadSize);
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<char>(i * 7 + (i >> 8));
+  WebSocketMaskingKey masking_key;
+  std::copy(kTestMask, kTestMask + kMaskingKeyLength, masking_key.key);
+  for (size_t frame_offset = 0; frame_offset < kMaskingKeyLength;
+       ++frame_offset) {
+    for (size_t alignment = 0; alignment < kMaxAlignment; ++alignment) {
+      for (size_t i = 0; i < arraysize(kPayloadSizes); ++i) {
+        const size_t size = kPayloadSizes[i];
+        char* const payload = scratch.get() + alignment;
+        std::copy(input.begin(), input.begin() + size, payload);
+        MaskWebSocketFramePayload(masking_key, frame_offset, payload, size);
+        for (size_t j = 0; j < size; ++j) {
+          const char expected = input[j] ^
+              masking_key.key[(frame_offset + j) % kMaskingKeyLength];
+          ASSERT_EQ(expected, payload[j])
+              << "Output failed to match at byte " << j
+              << " for frame_offset=" << frame_offset
+              << ", alignment=" << alignment << ", size=" << size;
+        }
+      }
+    }
+  }
+}
+
 class WebSocketFrameTestMaskBenchmark : public testing::Test {
  public:
   WebSocketFrameTestMaskBenchmark() : iterations_(kDefaultIterations) {}
@@ -0,0 +1,96 @@
+// Copyright 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "net/websockets/websocket_inflater.h"
+
+#include <string.h>
+
+#include "base/logging.h"
+#include "net/base/io_buffer.h"
+#include "third_party/zlib/zlib.h"
+
+namespace net {
+
+namespace {
+
+// The output buffer grows by this many bytes at a time.
+const size_t kOutputChunkSize = 16 * 1024;
+
+// The empty stored block the sender removes from the end of every message.
+const char kFlushTrailer[] = { '\x00', '\x00', '\xff', '\xff' };
+
+}  // namespace
+
+WebSocketInflater::WebSocketInflater(size_t max_output_size)
+    : max_output_size_(max_output_size),
+      is_stream_ended_(false) {
+}
+
+WebSocketInflater::~WebSocketInflater() {
+  if (stream_.get())
+    inflateEnd(stream_.get());
+}
+
+bool WebSocketInflater::Initialize(int window_bits) {
+  DCHECK(!stream_.get());
+  DCHECK_LE(8, window_bits);
+  DCHECK_GE(MAX_WBITS, window_bits);
+  stream_.reset(new z_stream);
+  memset(stream_.get(), 0, sizeof(*stream_));
+  // A negative window size expects raw deflate data, without zlib header.
+  if (inflateInit2(stream_.get(), -window_bits) != Z_OK) {
+    stream_.reset();
+    return false;
+  }
+  return true;
+}
+
+bool WebSocketInflater::AddBytes(const char* data, size_t size) {
+  DCHECK(stream_.get());
+  if (!size || is_stream_ended_)
+    return true;
+  stream_->next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data));
+  stream_->avail_in = size;
+  do {
+    if (output_.size() > max_output_size_)
+      return false;
+    const size_t used = output_.size();
+    output_.resize(used + kOutputChunkSize);
+    stream_->next_out = reinterpret_cast<Bytef*>(&output_[used]);
+    stream_->avail_out = kOutputChunkSize;
+    int result = inflate(stream_.get(), Z_SYNC_FLUSH);
+    output_.resize(output_.size() - stream_->avail_out);
+    if (result == Z_STREAM_END) {
+      // The sender ended the deflate stream with a final block. The rest of
+      // the message is ignored, and the next message starts a new stream.
+      is_stream_ended_ = true;
+      break;
+    } else if (result == Z_BUF_ERROR) {
+      // No progress was possible: all the input is consumed.
+      break;
+    } else if (result != Z_OK) {
+      return false;
+    }
+  } while (stream_->avail_in > 0 || stream_->avail_out == 0);
+  return output_.size() <= max_output_size_;
+}
+
+bool WebSocketInflater::Finish() {
+  if (is_stream_ended_) {
+    is_stream_ended_ = false;
+    return inflateReset(stream_.get()) == Z_OK;
+  }
+  return AddBytes(kFlushTrailer, arraysize(kFlushTrailer));
+}
+
+scoped_refptr<IOBufferWithSize> WebSocketInflater::GetOutput() {
+  scoped_refptr<IOBufferWithSize> buffer(
+      new IOBufferWithSize(output_.size()));
+  if (!output_.empty())
+    memcpy(buffer->data(), &output_.front(), output_.size());
+  output_.clear();
+  return buffer;
+}
+
+}  // namespace net
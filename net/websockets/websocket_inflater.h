@@ -0,0 +1,63 @@
+// Copyright 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef NET_WEBSOCKETS_WEBSOCKET_INFLATER_H_
+#define NET_WEBSOCKETS_WEBSOCKET_INFLATER_H_
+
+#include <vector>
+
+#include "base/basictypes.h"
+#include "base/memory/ref_counted.h"
+#include "base/memory/scoped_ptr.h"
+#include "net/base/net_export.h"
+
+typedef struct z_stream_s z_stream;  // Forward declaration for zlib.
+
+namespace net {
+
+class IOBufferWithSize;
+
+// Decompresses WebSocket messages compressed with the permessage-deflate
+// extension. The window is kept across messages, so it decodes data from
+// peers that take over their context as well as from peers that do not.
+class NET_EXPORT_PRIVATE WebSocketInflater {
+ public:
+  // Decompressing more than |max_output_size| bytes between two calls of
+  // GetOutput() is an error, so that a small frame can not make the
+  // decompressor allocate an arbitrary amount of memory.
+  explicit WebSocketInflater(size_t max_output_size);
+  ~WebSocketInflater();
+
+  // Returns true if the decompressor was set up for a window of
+  // 2^|window_bits| bytes, between 8 and 15.
+  bool Initialize(int window_bits);
+
+  // Decompresses |size| bytes of |data|. Returns false if the data is corrupt
+  // or decompresses to too much data.
+  bool AddBytes(const char* data, size_t size);
+
+  // Ends the current message by adding back the empty block the sender
+  // removed from it.
+  bool Finish();
+
+  // Returns the decompressed data produced since the last call and clears
+  // it.
+  scoped_refptr<IOBufferWithSize> GetOutput();
+
+  // Returns the size of the data GetOutput() would return.
+  size_t CurrentOutputSize() const { return output_.size(); }
+
+ private:
+  const size_t max_output_size_;
+  scoped_ptr<z_stream> stream_;
+  std::vector<char> output_;
+  // Whether the current message ended the deflate stream with a final block.
+  bool is_stream_ended_;
+
+  DISALLOW_COPY_AND_ASSIGN(WebSocketInflater);
+};
+
+}  // namespace net
+
+#endif  // NET_WEBSOCKETS_WEBSOCKET_INFLATER_H_
@@ -0,0 +1,89 @@
+// Copyright 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "net/websockets/websocket_inflater.h"
+
+#include <string>
+
+#include "net/base/io_buffer.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace net {
+
+namespace {
+
+const size_t kMaxOutputSize = 1024 * 1024;
+
+std::string ToString(IOBufferWithSize* buffer) {
+  return std::string(buffer->data(), buffer->size());
+}
+
+// The example of the permessage-deflate draft, with the second message
+// referring to the first.
+TEST(WebSocketInflaterTest, InflateHelloTakeOverContext) {
+  WebSocketInflater inflater(kMaxOutputSize);
+  ASSERT_TRUE(inflater.Initialize(15));
+
+  ASSERT_TRUE(inflater.AddBytes("\xf2\x48\xcd\xc9\xc9\x07\x00", 7));
+  ASSERT_TRUE(inflater.Finish());
+  EXPECT_EQ("Hello", ToString(inflater.GetOutput().get()));
+
+  ASSERT_TRUE(inflater.AddBytes("\xf2\x00\x11\x00\x00", 5));
+  ASSERT_TRUE(inflater.Finish());
+  EXPECT_EQ("Hello", ToString(inflater.GetOutput().get()));
+}
+
+TEST(WebSocketInflaterTest, InflateByteByByte) {
+  static const char kCompressed[] = "\xf2\x48\xcd\xc9\xc9\x07\x00";
+  WebSocketInflater inflater(kMaxOutputSize);
+  ASSERT_TRUE(inflater.Initialize(15));
+
+  for (size_t i = 0; i < arraysize(kCompressed) - 1; ++i)
+    ASSERT_TRUE(inflater.AddBytes(kCompressed + i, 1));
+  ASSERT_TRUE(inflater.Finish());
+  EXPECT_EQ("Hello", ToString(inflater.GetOutput().get()));
+}
+
+// The data after a final block is ignored, and the next message starts a new
+// stream.
+TEST(WebSocketInflaterTest, InflateFinalBlock) {
+  WebSocketInflater inflater(kMaxOutputSize);
+  ASSERT_TRUE(inflater.Initialize(15));
+
+  // "Hello" in a final fixed Huffman block.
+  ASSERT_TRUE(inflater.AddBytes("\xf3\x48\xcd\xc9\xc9\x07\x00", 7));
+  ASSERT_TRUE(inflater.AddBytes("\xff", 1));
+  ASSERT_TRUE(inflater.Finish());
+  EXPECT_EQ("Hello", ToString(inflater.GetOutput().get()));
+
+  ASSERT_TRUE(inflater.AddBytes("\xf2\x48\xcd\xc9\xc9\x07\x00", 7));
+  ASSERT_TRUE(inflater.Finish());
+  EXPECT_EQ("Hello", ToString(inflater.GetOutput().get()));
+}
+
+TEST(WebSocketInflaterTest, InflateCorruptData) {
+  WebSocketInflater inflater(kMaxOutputSize);
+  ASSERT_TRUE(inflater.Initialize(15));
+
+  // A block type of 3 is reserved.
+  EXPECT_FALSE(inflater.AddBytes("\xff\xff\xff\xff", 4));
+}
+
+// Data that inflates to more than the limit fails before all of it is
+// inflated.
+TEST(WebSocketInflaterTest, InflateTooLargeOutput) {
+  static const size_t kSmallMaxOutputSize = 32 * 1024;
+  // A stored block of 65535 bytes.
+  std::string compressed("\x00\xff\xff\x00\x00", 5);
+  compressed.append(0xffff, 'a');
+  WebSocketInflater inflater(kSmallMaxOutputSize);
+  ASSERT_TRUE(inflater.Initialize(15));
+
+  EXPECT_FALSE(inflater.AddBytes(compressed.data(), compressed.size()));
+  EXPECT_LE(inflater.CurrentOutputSize(), kSmallMaxOutputSize + 16 * 1024);
+}
+
+}  // namespace
+
+}  // namespace net
@@ -29,6 +29,24 @@
 #  define PUP(a) *++(a)
 #endif
 
+/* Google: copy matches that are at least CHUNK_SIZE bytes back in chunks of
+   CHUNK_SIZE bytes, rather than a byte at a time.  Such a chunk cannot overlap
+   its own output, and a fixed size memcpy() compiles to a single unaligned
+   load and store on most targets.  The last chunk may write up to
+   CHUNK_SIZE - 1 bytes past the end of the match, into output space that is
+   not written yet, so the caller must make sure that there is room for it. */
+#define CHUNK_SIZE 8
+#define CHUNK_COPY(out, from, len) \
+    do { \
+        unsigned char FAR *chunk_end = out + len; \
+        do { \
+            zmemcpy(out + OFF, from + OFF, CHUNK_SIZE); \
+            out += CHUNK_SIZE; \
+            from += CHUNK_SIZE; \
+        } while (out < chunk_end); \
+        out = chunk_end; \
+    } while (0)
+
 /*
    Decode literal, length, and distance codes and write out the resulting
    literal and match bytes until either not enough input or output is
@@ -265,6 +283,11 @@ unsigned start;         /* inflate()'s starting value for strm->avail_out */
                             PUP(out) = PUP(from);
                     }
                 }
+                else if (dist >= CHUNK_SIZE &&  /* Google: see CHUNK_COPY */
+                         (unsigned)(end - out) + 257 >= len + CHUNK_SIZE) {
+                    from = out - dist;          /* copy direct from output */
+                    CHUNK_COPY(out, from, len);
+                }
                 else {
                     from = out - dist;          /* copy direct from output */
                     do {                        /* minimum length is three */
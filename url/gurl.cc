@@ -13,7 +13,11 @@
 
 #include "url/gurl.h"
 
+#include "base/containers/hash_tables.h"
+#include "base/lazy_instance.h"
 #include "base/logging.h"
+#include "base/strings/string_piece.h"
+#include "base/synchronization/lock.h"
 #include "url/url_canon_stdstring.h"
 #include "url/url_util.h"
 
@@ -80,59 +84,153 @@ const std::string& EmptyStringForGURL() {
 
 } // namespace
 
-GURL::GURL() : is_valid_(false), inner_url_(NULL) {
+// The interned URLs, by spec. The table does not hold references to them:
+// Rep::Release() removes a Rep under |lock_| before deleting it, so a Rep
+// found in the table under |lock_| is always alive.
+class GURLInternTable {
+ public:
+  GURLInternTable() {}
+
+  typedef GURL::Rep Rep;
+
+  // Returns the interned Rep for |rep|'s spec, creating it if needed.
+  Rep* Intern(const Rep& rep) {
+    base::AutoLock lock(lock_);
+    RepMap::iterator it = reps_.find(base::StringPiece(rep.spec));
+    if (it != reps_.end()) {
+      it->second->AddRef();
+      return it->second;
+    }
+    Rep* interned = new Rep(rep);
+    interned->interned = true;
+    interned->AddRef();
+    reps_[base::StringPiece(interned->spec)] = interned;
+    return interned;
+  }
+
+  // Drops a reference to |rep|, which is interned, and deletes it if this was
+  // the last one.
+  void Release(const Rep* rep) {
+    // Only the last reference needs the lock, so that it cannot be handed out
+    // again while the Rep is being deleted.
+    while (true) {
+      base::subtle::Atomic32 count =
+          base::subtle::Acquire_Load(&rep->ref_count);
+      if (count <= 1)
+        break;
+      if (base::subtle::Release_CompareAndSwap(&rep->ref_count, count,
+                                               count - 1) == count) {
+        return;
+      }
+    }
+    base::AutoLock lock(lock_);
+    if (!base::AtomicRefCountDec(&rep->ref_count)) {
+      reps_.erase(base::StringPiece(rep->spec));
+      delete rep;
+    }
+  }
+
+ private:
+  typedef base::hash_map<base::StringPiece, Rep*> RepMap;
+
+  base::Lock lock_;
+  RepMap reps_;
+
+  DISALLOW_COPY_AND_ASSIGN(GURLInternTable);
+};
+
+namespace {
+
+base::LazyInstance<GURLInternTable>::Leaky g_intern_table =
+    LAZY_INSTANCE_INITIALIZER;
+
+}  // namespace
+
+GURL::Rep::Rep() : is_valid(false), inner_url(NULL), interned(false),
+                   ref_count(0) {
 }
 
-GURL::GURL(const GURL& other)
-    : spec_(other.spec_),
-      is_valid_(other.is_valid_),
-      parsed_(other.parsed_),
-      inner_url_(NULL) {
-  if (other.inner_url_)
-    inner_url_ = new GURL(*other.inner_url_);
-  // Valid filesystem urls should always have an inner_url_.
-  DCHECK(!is_valid_ || !SchemeIsFileSystem() || inner_url_);
+GURL::Rep::Rep(const Rep& other)
+    : spec(other.spec),
+      is_valid(other.is_valid),
+      parsed(other.parsed),
+      inner_url(NULL),
+      interned(false),
+      ref_count(0) {
+  if (other.inner_url)
+    inner_url = new GURL(*other.inner_url);
 }
 
-GURL::GURL(const std::string& url_string) : inner_url_(NULL) {
-  is_valid_ = InitCanonical(url_string, &spec_, &parsed_);
-  if (is_valid_ && SchemeIsFileSystem()) {
-    inner_url_ =
-        new GURL(spec_.data(), parsed_.Length(), *parsed_.inner_parsed(), true);
-  }
+GURL::Rep::~Rep() {
+  delete inner_url;
+}
+
+void GURL::Rep::AddRef() const {
+  base::AtomicRefCountInc(&ref_count);
 }
 
-GURL::GURL(const base::string16& url_string) : inner_url_(NULL) {
-  is_valid_ = InitCanonical(url_string, &spec_, &parsed_);
-  if (is_valid_ && SchemeIsFileSystem()) {
-    inner_url_ =
-        new GURL(spec_.data(), parsed_.Length(), *parsed_.inner_parsed(), true);
+void GURL::Rep::Release() const {
+  if (interned) {
+    g_intern_table.Get().Release(this);
+    return;
   }
+  if (!base::AtomicRefCountDec(&ref_count))
+    delete this;
+}
+
+bool GURL::Rep::HasOneRef() const {
+  return base::AtomicRefCountIsOne(&ref_count);
+}
+
+GURL::GURL() {
+}
+
+GURL::GURL(const GURL& other) : rep_(other.rep_) {
+  // Valid filesystem urls should always have an inner_url_.
+  DCHECK(!is_valid() || !SchemeIsFileSystem() || inner_url());
+}
+
+GURL::GURL(const std::string& url_string) {
+  Rep* rep = MutableRep();
+  rep->is_valid = InitCanonical(url_string, &rep->spec, &rep->parsed);
+  InitializeInnerURL();
+}
+
+GURL::GURL(const base::string16& url_string) {
+  Rep* rep = MutableRep();
+  rep->is_valid = InitCanonical(url_string, &rep->spec, &rep->parsed);
+  InitializeInnerURL();
 }
 
 GURL::GURL(const char* canonical_spec, size_t canonical_spec_len,
-           const url_parse::Parsed& parsed, bool is_valid)
-    : spec_(canonical_spec, canonical_spec_len),
-      is_valid_(is_valid),
-      parsed_(parsed),
-      inner_url_(NULL) {
+           const url_parse::Parsed& parsed, bool is_valid) {
+  Rep* rep = MutableRep();
+  rep->spec.assign(canonical_spec, canonical_spec_len);
+  rep->is_valid = is_valid;
+  rep->parsed = parsed;
   InitializeFromCanonicalSpec();
 }
 
 GURL::GURL(std::string canonical_spec,
-           const url_parse::Parsed& parsed, bool is_valid)
-    : is_valid_(is_valid),
-      parsed_(parsed),
-      inner_url_(NULL) {
-  spec_.swap(canonical_spec);
+           const url_parse::Parsed& parsed, bool is_valid) {
+  Rep* rep = MutableRep();
+  rep->spec.swap(canonical_spec);
+  rep->is_valid = is_valid;
+  rep->parsed = parsed;
   InitializeFromCanonicalSpec();
 }
 
-void GURL::InitializeFromCanonicalSpec() {
-  if (is_valid_ && SchemeIsFileSystem()) {
-    inner_url_ =
-        new GURL(spec_.data(), parsed_.Length(), *parsed_.inner_parsed(), true);
+void GURL::InitializeInnerURL() {
+  if (is_valid() && SchemeIsFileSystem()) {
+    Rep* rep = MutableRep();
+    delete rep->inner_url;
+    rep->inner_url = new GURL(rep->spec.data(), rep->parsed.Length(),
+                              *rep->parsed.inner_parsed(), true);
   }
+}
+
+void GURL::InitializeFromCanonicalSpec() {
+  InitializeInnerURL();
 
 #ifndef NDEBUG
   // For testing purposes, check that the parsed canonical URL is identical to
@@ -142,52 +240,48 @@ void GURL::InitializeFromCanonicalSpec() {
   // and we can't always canonicalize them exactly. TODO(joth): see if we
   // can do a better job on this e.g. by not stripping trailing white-space
   // for non-standard URLs in this validation path. http://crbug.com/291747.
-  if (is_valid_ && IsStandard()) {
+  const std::string& spec = rep().spec;
+  const url_parse::Parsed& parsed = rep().parsed;
+  if (is_valid() && IsStandard()) {
     url_parse::Component scheme;
-    if (!url_util::FindAndCompareScheme(spec_.data(), spec_.length(),
+    if (!url_util::FindAndCompareScheme(spec.data(), spec.length(),
                                         "filesystem", &scheme) ||
-        scheme.begin == parsed_.scheme.begin) {
+        scheme.begin == parsed.scheme.begin) {
       // We can't do this check on the inner_url of a filesystem URL, as
       // canonical_spec actually points to the start of the outer URL, so we'd
       // end up with infinite recursion in this constructor.
-      GURL test_url(spec_);
-
-      DCHECK(test_url.is_valid_ == is_valid_);
-      DCHECK(test_url.spec_ == spec_);
-
-      DCHECK(test_url.parsed_.scheme == parsed_.scheme);
-      DCHECK(test_url.parsed_.username == parsed_.username);
-      DCHECK(test_url.parsed_.password == parsed_.password);
-      DCHECK(test_url.parsed_.host == parsed_.host);
-      DCHECK(test_url.parsed_.port == parsed_.port);
-      DCHECK(test_url.parsed_.path == parsed_.path);
-      DCHECK(test_url.parsed_.query == parsed_.query);
-      DCHECK(test_url.parsed_.ref == parsed_.ref);
+      GURL test_url(spec);
+
+      DCHECK(test_url.is_valid() == is_valid());
+      DCHECK(test_url.rep().spec == spec);
+
+      const url_parse::Parsed& test_parsed = test_url.rep().parsed;
+      DCHECK(test_parsed.scheme == parsed.scheme);
+      DCHECK(test_parsed.username == parsed.username);
+      DCHECK(test_parsed.password == parsed.password);
+      DCHECK(test_parsed.host == parsed.host);
+      DCHECK(test_parsed.port == parsed.port);
+      DCHECK(test_parsed.path == parsed.path);
+      DCHECK(test_parsed.query == parsed.query);
+      DCHECK(test_parsed.ref == parsed.ref);
     }
   }
 #endif
 }
 
 GURL::~GURL() {
-  delete inner_url_;
 }
 
 GURL& GURL::operator=(const GURL& other) {
-  spec_ = other.spec_;
-  is_valid_ = other.is_valid_;
-  parsed_ = other.parsed_;
-  delete inner_url_;
-  inner_url_ = NULL;
-  if (other.inner_url_)
-    inner_url_ = new GURL(*other.inner_url_);
+  rep_ = other.rep_;
   // Valid filesystem urls should always have an inner_url_.
-  DCHECK(!is_valid_ || !SchemeIsFileSystem() || inner_url_);
+  DCHECK(!is_valid() || !SchemeIsFileSystem() || inner_url());
   return *this;
 }
 
 const std::string& GURL::spec() const {
-  if (is_valid_ || spec_.empty())
-    return spec_;
+  if (is_valid() || rep().spec.empty())
+    return rep().spec;
 
   DCHECK(false) << "Trying to get the spec of an invalid URL!";
   return EmptyStringForGURL();
@@ -205,30 +299,28 @@ GURL GURL::ResolveWithCharsetConverter(
     const std::string& relative,
     url_canon::CharsetConverter* charset_converter) const {
   // Not allowed for invalid URLs.
-  if (!is_valid_)
+  if (!is_valid())
     return GURL();
 
   GURL result;
+  Rep* result_rep = result.MutableRep();
 
   // Reserve enough room in the output for the input, plus some extra so that
   // we have room if we have to escape a few things without reallocating.
-  result.spec_.reserve(spec_.size() + 32);
-  url_canon::StdStringCanonOutput output(&result.spec_);
+  result_rep->spec.reserve(rep().spec.size() + 32);
+  url_canon::StdStringCanonOutput output(&result_rep->spec);
 
   if (!url_util::ResolveRelative(
-          spec_.data(), static_cast<int>(spec_.length()), parsed_,
+          rep().spec.data(), static_cast<int>(rep().spec.length()), rep().parsed,
           relative.data(), static_cast<int>(relative.length()),
-          charset_converter, &output, &result.parsed_)) {
+          charset_converter, &output, &result_rep->parsed)) {
     // Error resolving, return an empty URL.
     return GURL();
   }
 
   output.Complete();
-  result.is_valid_ = true;
-  if (result.SchemeIsFileSystem()) {
-    result.inner_url_ = new GURL(result.spec_.data(), result.parsed_.Length(),
-                                 *result.parsed_.inner_parsed(), true);
-  }
+  result_rep->is_valid = true;
+  result.InitializeInnerURL();
   return result;
 }
 
@@ -237,93 +329,87 @@ GURL GURL::ResolveWithCharsetConverter(
     const base::string16& relative,
     url_canon::CharsetConverter* charset_converter) const {
   // Not allowed for invalid URLs.
-  if (!is_valid_)
+  if (!is_valid())
     return GURL();
 
   GURL result;
+  Rep* result_rep = result.MutableRep();
 
   // Reserve enough room in the output for the input, plus some extra so that
   // we have room if we have to escape a few things without reallocating.
-  result.spec_.reserve(spec_.size() + 32);
-  url_canon::StdStringCanonOutput output(&result.spec_);
+  result_rep->spec.reserve(rep().spec.size() + 32);
+  url_canon::StdStringCanonOutput output(&result_rep->spec);
 
   if (!url_util::ResolveRelative(
-          spec_.data(), static_cast<int>(spec_.length()), parsed_,
+          rep().spec.data(), static_cast<int>(rep().spec.length()), rep().parsed,
           relative.data(), static_cast<int>(relative.length()),
-          charset_converter, &output, &result.parsed_)) {
+          charset_converter, &output, &result_rep->parsed)) {
     // Error resolving, return an empty URL.
     return GURL();
   }
 
   output.Complete();
-  result.is_valid_ = true;
-  if (result.SchemeIsFileSystem()) {
-    result.inner_url_ = new GURL(result.spec_.data(), result.parsed_.Length(),
-                                 *result.parsed_.inner_parsed(), true);
-  }
+  result_rep->is_valid = true;
+  result.InitializeInnerURL();
   return result;
 }
 
 // Note: code duplicated below (it's inconvenient to use a template here).
 GURL GURL::ReplaceComponents(
     const url_canon::Replacements<char>& replacements) const {
-  GURL result;
-
   // Not allowed for invalid URLs.
-  if (!is_valid_)
+  if (!is_valid())
     return GURL();
 
+  GURL result;
+  Rep* result_rep = result.MutableRep();
+
   // Reserve enough room in the output for the input, plus some extra so that
   // we have room if we have to escape a few things without reallocating.
-  result.spec_.reserve(spec_.size() + 32);
-  url_canon::StdStringCanonOutput output(&result.spec_);
+  result_rep->spec.reserve(rep().spec.size() + 32);
+  url_canon::StdStringCanonOutput output(&result_rep->spec);
 
-  result.is_valid_ = url_util::ReplaceComponents(
-      spec_.data(), static_cast<int>(spec_.length()), parsed_, replacements,
-      NULL, &output, &result.parsed_);
+  result_rep->is_valid = url_util::ReplaceComponents(
+      rep().spec.data(), static_cast<int>(rep().spec.length()), rep().parsed, replacements,
+      NULL, &output, &result_rep->parsed);
 
   output.Complete();
-  if (result.is_valid_ && result.SchemeIsFileSystem()) {
-    result.inner_url_ = new GURL(spec_.data(), result.parsed_.Length(),
-                                 *result.parsed_.inner_parsed(), true);
-  }
+  result.InitializeInnerURL();
   return result;
 }
 
 // Note: code duplicated above (it's inconvenient to use a template here).
 GURL GURL::ReplaceComponents(
     const url_canon::Replacements<base::char16>& replacements) const {
-  GURL result;
-
   // Not allowed for invalid URLs.
-  if (!is_valid_)
+  if (!is_valid())
     return GURL();
 
+  GURL result;
+  Rep* result_rep = result.MutableRep();
+
   // Reserve enough room in the output for the input, plus some extra so that
   // we have room if we have to escape a few things without reallocating.
-  result.spec_.reserve(spec_.size() + 32);
-  url_canon::StdStringCanonOutput output(&result.spec_);
+  result_rep->spec.reserve(rep().spec.size() + 32);
+  url_canon::StdStringCanonOutput output(&result_rep->spec);
 
-  result.is_valid_ = url_util::ReplaceComponents(
-      spec_.data(), static_cast<int>(spec_.length()), parsed_, replacements,
-      NULL, &output, &result.parsed_);
+  result_rep->is_valid = url_util::ReplaceComponents(
+      rep().spec.data(), static_cast<int>(rep().spec.length()), rep().parsed, replacements,
+      NULL, &output, &result_rep->parsed);
 
   output.Complete();
-  if (result.is_valid_ && result.SchemeIsFileSystem()) {
-    result.inner_url_ = new GURL(spec_.data(), result.parsed_.Length(),
-                                 *result.parsed_.inner_parsed(), true);
-  }
+  result.InitializeInnerURL();
   return result;
 }
 
 GURL GURL::GetOrigin() const {
   // This doesn't make sense for invalid or nonstandard URLs, so return
   // the empty URL
-  if (!is_valid_ || !IsStandard())
+  if (!is_valid() || !IsStandard())
     return GURL();
 
   if (SchemeIsFileSystem())
-    return inner_url_->GetOrigin();
+    return inner_url()->GetOrigin();
 
   url_canon::Replacements<char> replacements;
   replacements.ClearUsername();
@@ -338,81 +424,82 @@ GURL GURL::GetOrigin() const {
 GURL GURL::GetWithEmptyPath() const {
   // This doesn't make sense for invalid or nonstandard URLs, so return
   // the empty URL.
-  if (!is_valid_ || !IsStandard())
+  if (!is_valid() || !IsStandard())
     return GURL();
 
   // We could optimize this since we know that the URL is canonical, and we are
   // appending a canonical path, so avoiding re-parsing.
   GURL other(*this);
-  if (parsed_.path.len == 0)
+  if (rep().parsed.path.len == 0)
     return other;
 
-  // Clear everything after the path.
-  other.parsed_.query.reset();
-  other.parsed_.ref.reset();
+  // Clear everything after the path. This copies the shared storage.
+  Rep* other_rep = other.MutableRep();
+  other_rep->parsed.query.reset();
+  other_rep->parsed.ref.reset();
 
   // Set the path, since the path is longer than one, we can just set the
   // first character and resize.
-  other.spec_[other.parsed_.path.begin] = '/';
-  other.parsed_.path.len = 1;
-  other.spec_.resize(other.parsed_.path.begin + 1);
+  other_rep->spec[other_rep->parsed.path.begin] = '/';
+  other_rep->parsed.path.len = 1;
+  other_rep->spec.resize(other_rep->parsed.path.begin + 1);
   return other;
 }
 
 bool GURL::IsStandard() const {
-  return url_util::IsStandard(spec_.data(), parsed_.scheme);
+  return url_util::IsStandard(rep().spec.data(), rep().parsed.scheme);
 }
 
 bool GURL::SchemeIs(const char* lower_ascii_scheme) const {
-  if (parsed_.scheme.len <= 0)
+  if (rep().parsed.scheme.len <= 0)
     return lower_ascii_scheme == NULL;
-  return url_util::LowerCaseEqualsASCII(spec_.data() + parsed_.scheme.begin,
-                                        spec_.data() + parsed_.scheme.end(),
+  return url_util::LowerCaseEqualsASCII(rep().spec.data() + rep().parsed.scheme.begin,
+                                        rep().spec.data() + rep().parsed.scheme.end(),
                                         lower_ascii_scheme);
 }
 
 int GURL::IntPort() const {
-  if (parsed_.port.is_nonempty())
-    return url_parse::ParsePort(spec_.data(), parsed_.port);
+  if (rep().parsed.port.is_nonempty())
+    return url_parse::ParsePort(rep().spec.data(), rep().parsed.port);
   return url_parse::PORT_UNSPECIFIED;
 }
 
 int GURL::EffectiveIntPort() const {
   int int_port = IntPort();
   if (int_port == url_parse::PORT_UNSPECIFIED && IsStandard())
-    return url_canon::DefaultPortForScheme(spec_.data() + parsed_.scheme.begin,
-                                           parsed_.scheme.len);
+    return url_canon::DefaultPortForScheme(rep().spec.data() + rep().parsed.scheme.begin,
+                                           rep().parsed.scheme.len);
   return int_port;
 }
 
 std::string GURL::ExtractFileName() const {
   url_parse::Component file_component;
-  url_parse::ExtractFileName(spec_.data(), parsed_.path, &file_component);
+  url_parse::ExtractFileName(rep().spec.data(), rep().parsed.path, &file_component);
   return ComponentString(file_component);
 }
 
 std::string GURL::PathForRequest() const {
-  DCHECK(parsed_.path.len > 0) << "Canonical path for requests should be non-empty";
-  if (parsed_.ref.len >= 0) {
+  DCHECK(rep().parsed.path.len > 0) << "Canonical path for requests should be non-empty";
+  if (rep().parsed.ref.len >= 0) {
     // Clip off the reference when it exists. The reference starts after the #
     // sign, so we have to subtract one to also remove it.
-    return std::string(spec_, parsed_.path.begin,
-                       parsed_.ref.begin - parsed_.path.begin - 1);
+    return std::string(rep().spec, rep().parsed.path.begin,
+                       rep().parsed.ref.begin - rep().parsed.path.begin - 1);
   }
   // Compute the actual path length, rather than depending on the spec's
   // terminator.  If we're an inner_url, our spec continues on into our outer
   // url's path/query/ref.
-  int path_len = parsed_.path.len;
-  if (parsed_.query.is_valid())
-    path_len = parsed_.query.end() - parsed_.path.begin;
+  int path_len = rep().parsed.path.len;
+  if (rep().parsed.query.is_valid())
+    path_len = rep().parsed.query.end() - rep().parsed.path.begin;
 
-  return std::string(spec_, parsed_.path.begin, path_len);
+  return std::string(rep().spec, rep().parsed.path.begin, path_len);
 }
 
 std::string GURL::HostNoBrackets() const {
   // If host looks like an IPv6 literal, strip the square brackets.
-  url_parse::Component h(parsed_.host);
-  if (h.len >= 2 && spec_[h.begin] == '[' && spec_[h.end() - 1] == ']') {
+  url_parse::Component h(rep().parsed.host);
+  if (h.len >= 2 && rep().spec[h.begin] == '[' && rep().spec[h.end() - 1] == ']') {
     h.begin++;
     h.len -= 2;
   }
@@ -420,16 +507,16 @@ std::string GURL::HostNoBrackets() const {
 }
 
 std::string GURL::GetContent() const {
-  return is_valid_ ? ComponentString(parsed_.GetContent()) : "";
+  return is_valid() ? ComponentString(rep().parsed.GetContent()) : "";
 }
 
 bool GURL::HostIsIPAddress() const {
-  if (!is_valid_ || spec_.empty())
+  if (!is_valid() || rep().spec.empty())
      return false;
 
   url_canon::RawCanonOutputT<char, 128> ignored_output;
   url_canon::CanonHostInfo host_info;
-  url_canon::CanonicalizeIPAddress(spec_.c_str(), parsed_.host,
+  url_canon::CanonicalizeIPAddress(rep().spec.c_str(), rep().parsed.host,
                                    &ignored_output, &host_info);
   return host_info.IsIPAddress();
 }
@@ -469,21 +556,21 @@ const GURL& GURL::EmptyGURL() {
 bool GURL::DomainIs(const char* lower_ascii_domain,
                     int domain_len) const {
   // Return false if this URL is not valid or domain is empty.
-  if (!is_valid_ || !domain_len)
+  if (!is_valid() || !domain_len)
     return false;
 
-  // FileSystem URLs have empty parsed_.host, so check this first.
-  if (SchemeIsFileSystem() && inner_url_)
-    return inner_url_->DomainIs(lower_ascii_domain, domain_len);
+  // FileSystem URLs have empty rep().parsed.host, so check this first.
+  if (SchemeIsFileSystem() && inner_url())
+    return inner_url()->DomainIs(lower_ascii_domain, domain_len);
 
-  if (!parsed_.host.is_nonempty())
+  if (!rep().parsed.host.is_nonempty())
     return false;
 
   // Check whether the host name is end with a dot. If yes, treat it
   // the same as no-dot unless the input comparison domain is end
   // with dot.
-  const char* last_pos = spec_.data() + parsed_.host.end() - 1;
-  int host_len = parsed_.host.len;
+  const char* last_pos = rep().spec.data() + rep().parsed.host.end() - 1;
+  int host_len = rep().parsed.host.len;
   if ('.' == *last_pos && '.' != lower_ascii_domain[domain_len - 1]) {
     last_pos--;
     host_len--;
@@ -494,7 +581,7 @@ bool GURL::DomainIs(const char* lower_ascii_domain,
     return false;
 
   // Compare this url whether belong specific domain.
-  const char* start_pos = spec_.data() + parsed_.host.begin +
+  const char* start_pos = rep().spec.data() + rep().parsed.host.begin +
                           host_len - domain_len;
 
   if (!url_util::LowerCaseEqualsASCII(start_pos,
@@ -513,11 +600,34 @@ bool GURL::DomainIs(const char* lower_ascii_domain,
   return true;
 }
 
+GURL GURL::Intern() const {
+  if (!rep_.get() || rep_->interned)
+    return *this;
+  GURL result;
+  // Adopt the reference taken by Intern().
+  result.rep_ = g_intern_table.Get().Intern(*rep_.get());
+  result.rep_->Release();
+  return result;
+}
+
 void GURL::Swap(GURL* other) {
-  spec_.swap(other->spec_);
-  std::swap(is_valid_, other->is_valid_);
-  std::swap(parsed_, other->parsed_);
-  std::swap(inner_url_, other->inner_url_);
+  rep_.swap(other->rep_);
+}
+
+// static
+const GURL::Rep& GURL::EmptyRep() {
+  static base::LazyInstance<Rep>::Leaky empty_rep = LAZY_INSTANCE_INITIALIZER;
+  return empty_rep.Get();
+}
+
+GURL::Rep* GURL::MutableRep() {
+  // Interned storage is shared through the intern table even when this is its
+  // only user.
+  if (!rep_.get())
+    rep_ = new Rep;
+  else if (!rep_->HasOneRef() || rep_->interned)
+    rep_ = new Rep(*rep_.get());
+  return rep_.get();
 }
 
 std::ostream& operator<<(std::ostream& out, const GURL& url) {
@@ -8,6 +8,8 @@
 #include <iosfwd>
 #include <string>
 
+#include "base/atomic_ref_count.h"
+#include "base/memory/ref_counted.h"
 #include "base/strings/string16.h"
 #include "url/url_canon.h"
 #include "url/url_canon_stdstring.h"
@@ -22,8 +24,8 @@ class URL_EXPORT GURL {
   // Creates an empty, invalid URL.
   GURL();
 
-  // Copy construction is relatively inexpensive, with most of the time going
-  // to reallocating the string. It does not re-parse.
+  // Copy construction is inexpensive: copies share the storage of the spec,
+  // which is never modified once shared. It does not re-parse.
   GURL(const GURL& other);
 
   // The narrow version requires the input be UTF-8. Invalid UTF-8 input will
@@ -60,14 +62,14 @@ class URL_EXPORT GURL {
   // "reasonable looking" so that the user can see how it's busted if
   // displayed to them.
   bool is_valid() const {
-    return is_valid_;
+    return rep_.get() && rep_->is_valid;
   }
 
   // Returns true if the URL is zero-length. Note that empty URLs are also
   // invalid, and is_valid() will return false for them. This is provided
   // because some users may want to treat the empty case differently.
   bool is_empty() const {
-    return spec_.empty();
+    return !rep_.get() || rep_->spec.empty();
   }
 
   // Returns the raw spec, i.e., the full text of the URL, in canonical UTF-8,
@@ -93,7 +95,7 @@ class URL_EXPORT GURL {
   //
   // The returned string is guaranteed to be valid UTF-8.
   const std::string& possibly_invalid_spec() const {
-    return spec_;
+    return rep().spec;
   }
 
   // Getter for the raw parsed structure. This allows callers to locate parts
@@ -105,20 +107,21 @@ class URL_EXPORT GURL {
   // SURE YOU ARE USING possibly_invalid_spec() to get the spec, and that you
   // don't do anything "important" with invalid specs.
   const url_parse::Parsed& parsed_for_possibly_invalid_spec() const {
-    return parsed_;
+    return rep().parsed;
   }
 
-  // Defiant equality operator!
+  // Defiant equality operator! Copies of a URL, and interned URLs with the
+  // same spec, are equal without comparing the specs.
   bool operator==(const GURL& other) const {
-    return spec_ == other.spec_;
+    return rep_.get() == other.rep_.get() || rep().spec == other.rep().spec;
   }
   bool operator!=(const GURL& other) const {
-    return spec_ != other.spec_;
+    return !(*this == other);
   }
 
   // Allows GURL to used as a key in STL (for example, a std::set or std::map).
   bool operator<(const GURL& other) const {
-    return spec_ < other.spec_;
+    return rep_.get() != other.rep_.get() && rep().spec < other.rep().spec;
   }
 
   // Resolves a URL that's possibly relative to this object's URL, and returns
@@ -233,31 +236,31 @@ class URL_EXPORT GURL {
   // Getters for various components of the URL. The returned string will be
   // empty if the component is empty or is not present.
   std::string scheme() const {  // Not including the colon. See also SchemeIs.
-    return ComponentString(parsed_.scheme);
+    return ComponentString(rep().parsed.scheme);
   }
   std::string username() const {
-    return ComponentString(parsed_.username);
+    return ComponentString(rep().parsed.username);
   }
   std::string password() const {
-    return ComponentString(parsed_.password);
+    return ComponentString(rep().parsed.password);
   }
   // Note that this may be a hostname, an IPv4 address, or an IPv6 literal
   // surrounded by square brackets, like "[2001:db8::1]".  To exclude these
   // brackets, use HostNoBrackets() below.
   std::string host() const {
-    return ComponentString(parsed_.host);
+    return ComponentString(rep().parsed.host);
   }
   std::string port() const {  // Returns -1 if "default"
-    return ComponentString(parsed_.port);
+    return ComponentString(rep().parsed.port);
   }
   std::string path() const {  // Including first slash following host
-    return ComponentString(parsed_.path);
+    return ComponentString(rep().parsed.path);
   }
   std::string query() const {  // Stuff following '?'
-    return ComponentString(parsed_.query);
+    return ComponentString(rep().parsed.query);
   }
   std::string ref() const {  // Stuff following '#'
-    return ComponentString(parsed_.ref);
+    return ComponentString(rep().parsed.ref);
   }
 
   // Existance querying. These functions will return true if the corresponding
@@ -265,31 +268,31 @@ class URL_EXPORT GURL {
   // being nonempty. http://www.google.com/? has a query that just happens to
   // be empty, and has_query() will return true.
   bool has_scheme() const {
-    return parsed_.scheme.len >= 0;
+    return rep().parsed.scheme.len >= 0;
   }
   bool has_username() const {
-    return parsed_.username.len >= 0;
+    return rep().parsed.username.len >= 0;
   }
   bool has_password() const {
-    return parsed_.password.len >= 0;
+    return rep().parsed.password.len >= 0;
   }
   bool has_host() const {
     // Note that hosts are special, absense of host means length 0.
-    return parsed_.host.len > 0;
+    return rep().parsed.host.len > 0;
   }
   bool has_port() const {
-    return parsed_.port.len >= 0;
+    return rep().parsed.port.len >= 0;
   }
   bool has_path() const {
     // Note that http://www.google.com/" has a path, the path is "/". This can
     // return false only for invalid or nonstandard URLs.
-    return parsed_.path.len >= 0;
+    return rep().parsed.path.len >= 0;
   }
   bool has_query() const {
-    return parsed_.query.len >= 0;
+    return rep().parsed.query.len >= 0;
   }
   bool has_ref() const {
-    return parsed_.ref.len >= 0;
+    return rep().parsed.ref.len >= 0;
   }
 
   // Returns a parsed version of the port. Can also be any of the special
@@ -332,6 +335,14 @@ class URL_EXPORT GURL {
                     static_cast<int>(strlen(lower_ascii_domain)));
   }
 
+  // Returns a copy of this URL which shares its storage with every other
+  // interned URL with the same spec, so that keeping many copies of a URL
+  // created from different strings costs the memory of one. Meant for URLs
+  // which are kept around in many places, like the URLs of the resources of
+  // open pages; interning a URL costs a lookup under a global lock. The
+  // storage is freed with the last URL which uses it.
+  GURL Intern() const;
+
   // Swaps the contents of this GURL object with the argument without doing
   // any memory allocations.
   void Swap(GURL* other);
@@ -344,32 +355,72 @@ class URL_EXPORT GURL {
   // Returns the inner URL of a nested URL [currently only non-null for
   // filesystem: URLs].
   const GURL* inner_url() const {
-    return inner_url_;
+    return rep().inner_url;
   }
 
  private:
+  friend class GURLInternTable;
+
+  // The storage of a URL. It is shared by the copies of a GURL, so it must not
+  // be modified once the GURL which created it is constructed, except through
+  // MutableRep().
+  struct URL_EXPORT Rep {
+    Rep();
+    // Copies everything but the reference count, for copy-on-write.
+    Rep(const Rep& other);
+    ~Rep();
+
+    // For scoped_refptr. The references are thread-safe, since copies of a
+    // URL are passed between threads.
+    void AddRef() const;
+    void Release() const;
+    bool HasOneRef() const;
+
+    // The actual text of the URL, in canonical ASCII form.
+    std::string spec;
+
+    // Set when the given URL is valid. Otherwise, we may still have a spec and
+    // components, but they may not identify valid resources (for example, an
+    // invalid port number, invalid characters in the scheme, etc.).
+    bool is_valid;
+
+    // Identified components of the canonical spec.
+    url_parse::Parsed parsed;
+
+    // Used for nested schemes [currently only filesystem:]. Owned.
+    GURL* inner_url;
+
+    // True if this is in the GURLInternTable, which keeps a weak reference to
+    // it.
+    bool interned;
+
+    mutable base::AtomicRefCount ref_count;
+
+   private:
+    void operator=(const Rep&);
+  };
+
+  // Returns the storage of this URL, or the storage of an empty URL.
+  const Rep& rep() const {
+    return rep_.get() ? *rep_.get() : EmptyRep();
+  }
+  static const Rep& EmptyRep();
+
+  // Returns storage which only this URL uses, copying it if it is shared.
+  Rep* MutableRep();
+
   void InitializeFromCanonicalSpec();
+  void InitializeInnerURL();
 
   // Returns the substring of the input identified by the given component.
   std::string ComponentString(const url_parse::Component& comp) const {
     if (comp.len <= 0)
       return std::string();
-    return std::string(spec_, comp.begin, comp.len);
+    return std::string(rep().spec, comp.begin, comp.len);
   }
 
-  // The actual text of the URL, in canonical ASCII form.
-  std::string spec_;
-
-  // Set when the given URL is valid. Otherwise, we may still have a spec and
-  // components, but they may not identify valid resources (for example, an
-  // invalid port number, invalid characters in the scheme, etc.).
-  bool is_valid_;
-
-  // Identified components of the canonical spec.
-  url_parse::Parsed parsed_;
-
-  // Used for nested schemes [currently only filesystem:].
-  GURL* inner_url_;
+  // NULL for the empty URL.
+  scoped_refptr<Rep> rep_;
 
   // TODO bug 684583: Add encoding for query params.
 };
@@ -0,0 +1,81 @@
+// Copyright 2013 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <set>
+#include <string>
+#include <vector>
+
+#include "base/basictypes.h"
+#include "base/perftimer.h"
+#include "base/strings/stringprintf.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+namespace {
+
+// A page load is modelled as a page with kResourcesPerPage subresources, and
+// each URL is copied kCopiesPerURL times, about as many as it takes to go
+// through the loader, the network stack, the cache and the history.
+const int kPageLoads = 200;
+const int kResourcesPerPage = 100;
+const int kCopiesPerURL = 10;
+
+std::string ResourceURL(int page, int resource) {
+  return base::StringPrintf(
+      "http://static%d.example.com/assets/v2/page%d/resource-%d.js?cache=%d",
+      resource % 4, page % 20, resource, page % 20);
+}
+
+// Returns the number of bytes used by the distinct specs in |urls|.
+size_t SpecBytes(const std::vector<GURL>& urls) {
+  std::set<const char*> seen;
+  size_t bytes = 0;
+  for (size_t i = 0; i < urls.size(); ++i) {
+    const std::string& spec = urls[i].possibly_invalid_spec();
+    if (seen.insert(spec.data()).second)
+      bytes += spec.capacity();
+  }
+  return bytes;
+}
+
+// Runs the page loads, and keeps all the copies of the URLs alive, like a
+// session with many open pages. If |intern| is true, the URLs are interned
+// when they are created.
+void RunPageLoads(const char* name, bool intern) {
+  std::vector<GURL> urls;
+  urls.reserve(kPageLoads * kResourcesPerPage * kCopiesPerURL);
+
+  PerfTimeLogger timer(name);
+  for (int page = 0; page < kPageLoads; ++page) {
+    for (int resource = 0; resource < kResourcesPerPage; ++resource) {
+      GURL url(ResourceURL(page, resource));
+      if (intern)
+        url = url.Intern();
+      for (int copy = 0; copy < kCopiesPerURL; ++copy)
+        urls.push_back(url);
+    }
+  }
+  timer.Done();
+
+  LogPerfResult(base::StringPrintf("%s_SpecBytes", name).c_str(),
+                SpecBytes(urls), "bytes");
+}
+
+TEST(GURLPerfTest, PageLoad) {
+  LogPerfResult("GURL_Size", sizeof(GURL), "bytes");
+  RunPageLoads("GURL_PageLoad", false);
+  RunPageLoads("GURL_PageLoad_Interned", true);
+}
+
+TEST(GURLPerfTest, Copy) {
+  GURL url(ResourceURL(0, 0));
+  PerfTimeLogger timer("GURL_Copy");
+  for (int i = 0; i < 1000000; ++i) {
+    GURL copy(url);
+    EXPECT_EQ(url, copy);
+  }
+  timer.Done();
+}
+
+}  // namespace
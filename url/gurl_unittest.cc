@@ -511,3 +511,62 @@ TEST(GURLTest, IsStandard) {
   GURL c("foo://bar/baz");
   EXPECT_FALSE(c.IsStandard());
 }
+
+// Copies share the spec, and modifying a copy leaves the original alone.
+TEST(GURLTest, CopiesShareSpec) {
+  GURL a("http://www.google.com/foo?bar#baz");
+  GURL b(a);
+  EXPECT_EQ(a.spec().data(), b.spec().data());
+
+  GURL c;
+  c = a;
+  EXPECT_EQ(a.spec().data(), c.spec().data());
+
+  GURL::Replacements replacements;
+  replacements.SetPathStr("/other");
+  GURL d = b.ReplaceComponents(replacements);
+  EXPECT_EQ("http://www.google.com/other?bar#baz", d.spec());
+  EXPECT_EQ("http://www.google.com/foo?bar#baz", a.spec());
+  EXPECT_EQ("http://www.google.com/foo?bar#baz", b.spec());
+
+  GURL e("http://www.google.com/");
+  b.Swap(&e);
+  EXPECT_EQ("http://www.google.com/", b.spec());
+  EXPECT_EQ(a.spec().data(), e.spec().data());
+}
+
+TEST(GURLTest, Intern) {
+  GURL a("http://www.google.com/foo");
+  GURL b("http://www.google.com/foo");
+  EXPECT_NE(a.spec().data(), b.spec().data());
+
+  GURL interned_a = a.Intern();
+  GURL interned_b = b.Intern();
+  EXPECT_EQ(a, interned_a);
+  EXPECT_EQ(interned_a.spec().data(), interned_b.spec().data());
+
+  // Interning an interned URL gives back the same storage.
+  GURL again = interned_a.Intern();
+  EXPECT_EQ(interned_a.spec().data(), again.spec().data());
+
+  // Interned URLs are never modified in place.
+  GURL c = interned_a;
+  GURL::Replacements replacements;
+  replacements.SetPathStr("/bar");
+  c = c.ReplaceComponents(replacements);
+  EXPECT_EQ("http://www.google.com/bar", c.spec());
+  EXPECT_EQ("http://www.google.com/foo", interned_b.spec());
+
+  // Empty and invalid URLs can be interned too.
+  EXPECT_TRUE(GURL().Intern().is_empty());
+  GURL invalid("foo");
+  EXPECT_FALSE(invalid.Intern().is_valid());
+  EXPECT_EQ(invalid.possibly_invalid_spec(),
+            invalid.Intern().possibly_invalid_spec());
+
+  // The inner URL of an interned filesystem URL survives.
+  GURL fs = GURL("filesystem:http://www.google.com/temporary/a").Intern();
+  ASSERT_TRUE(fs.inner_url());
+  EXPECT_EQ("www.google.com", fs.inner_url()->host());
+  EXPECT_EQ("/temporary", fs.inner_url()->path());
+}
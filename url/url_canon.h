@@ -112,8 +112,10 @@ class CanonOutputT {
       if (!Grow(cur_len_ + str_len - buffer_len_))
         return;
     }
-    for (int i = 0; i < str_len; i++)
-      buffer_[cur_len_ + i] = str[i];
+    // The canonicalizers append long runs of characters which need no
+    // changes, so copy them in one go.
+    if (str_len > 0)
+      memcpy(&buffer_[cur_len_], str, str_len * sizeof(T));
     cur_len_ += str_len;
   }
 
@@ -285,6 +285,24 @@ bool DoComplexHost(const base::char16* host, int host_len,
   return DoIDNHost(host, host_len, output);
 }
 
+// Appends |host| as is and returns true if it is already canonical, which is
+// the common case. Otherwise, appends nothing and returns false.
+bool AppendPlainHost(const char* spec,
+                     const url_parse::Component& host,
+                     CanonOutput* output) {
+  if (FindFirstNonPlainHostChar(spec, host.begin, host.end()) != host.end())
+    return false;
+  output->Append(&spec[host.begin], host.len);
+  return true;
+}
+
+// Wide input always goes through DoSimpleHost or DoComplexHost.
+bool AppendPlainHost(const base::char16* spec,
+                     const url_parse::Component& host,
+                     CanonOutput* output) {
+  return false;
+}
+
 template<typename CHAR, typename UCHAR>
 void DoHost(const CHAR* spec,
             const url_parse::Component& host,
@@ -297,20 +315,24 @@ void DoHost(const CHAR* spec,
     return;
   }
 
-  bool has_non_ascii, has_escaped;
-  ScanHostname<CHAR, UCHAR>(spec, host, &has_non_ascii, &has_escaped);
-
   // Keep track of output's initial length, so we can rewind later.
   const int output_begin = output->length();
 
   bool success;
-  if (!has_non_ascii && !has_escaped) {
-    success = DoSimpleHost(&spec[host.begin], host.len,
-                           output, &has_non_ascii);
-    DCHECK(!has_non_ascii);
+  if (AppendPlainHost(spec, host, output)) {
+    success = true;
   } else {
-    success = DoComplexHost(&spec[host.begin], host.len,
-                            has_non_ascii, has_escaped, output);
+    bool has_non_ascii, has_escaped;
+    ScanHostname<CHAR, UCHAR>(spec, host, &has_non_ascii, &has_escaped);
+
+    if (!has_non_ascii && !has_escaped) {
+      success = DoSimpleHost(&spec[host.begin], host.len,
+                             output, &has_non_ascii);
+      DCHECK(!has_non_ascii);
+    } else {
+      success = DoComplexHost(&spec[host.begin], host.len,
+                              has_non_ascii, has_escaped, output);
+    }
   }
 
   if (!success) {
@@ -4,6 +4,10 @@
 
 #include <errno.h>
 #include <stdlib.h>
+#include <string.h>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif  // __SSE2__
 
 #include <cstdio>
 #include <string>
@@ -257,6 +261,87 @@ void AppendInvalidNarrowString(const base::char16* spec, int begin, int end,
       spec, begin, end, output);
 }
 
+#if defined(__SSE2__)
+
+namespace {
+
+// Returns a mask with 0xff in the bytes of |chars| which are in [|lo|, |hi|].
+// Only valid for ranges of 7-bit characters, since the comparisons are
+// signed.
+inline __m128i InRange(__m128i chars, char lo, char hi) {
+  return _mm_and_si128(_mm_cmpgt_epi8(chars, _mm_set1_epi8(lo - 1)),
+                       _mm_cmplt_epi8(chars, _mm_set1_epi8(hi + 1)));
+}
+
+inline int FirstSetBit(int mask) {
+  return __builtin_ctz(mask);
+}
+
+}  // namespace
+
+int FindFirstNonPlainChar(const char* spec, int begin, int end,
+                          const char* stops, int num_stops) {
+  DCHECK(num_stops <= kMaxStopChars);
+  __m128i stop_chars[kMaxStopChars];
+  for (int i = 0; i < num_stops; i++)
+    stop_chars[i] = _mm_set1_epi8(stops[i]);
+
+  int i = begin;
+  for (; i + 16 <= end; i += 16) {
+    const __m128i chars =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(&spec[i]));
+    // Non-ASCII characters are negative, so they fall outside the range too.
+    __m128i special = _mm_xor_si128(InRange(chars, 0x21, 0x7e),
+                                    _mm_set1_epi8(-1));
+    for (int j = 0; j < num_stops; j++)
+      special = _mm_or_si128(special, _mm_cmpeq_epi8(chars, stop_chars[j]));
+    const int mask = _mm_movemask_epi8(special);
+    if (mask)
+      return i + FirstSetBit(mask);
+  }
+  for (; i < end; i++) {
+    const unsigned char ch = static_cast<unsigned char>(spec[i]);
+    if (ch <= 0x20 || ch >= 0x7f || memchr(stops, ch, num_stops))
+      return i;
+  }
+  return end;
+}
+
+int FindFirstNonPlainHostChar(const char* spec, int begin, int end) {
+  int i = begin;
+  for (; i + 16 <= end; i += 16) {
+    const __m128i chars =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(&spec[i]));
+    const __m128i plain =
+        _mm_or_si128(_mm_or_si128(InRange(chars, 'a', 'z'),
+                                  InRange(chars, '0', '9')),
+                     InRange(chars, '-', '.'));
+    const int mask = _mm_movemask_epi8(plain) ^ 0xffff;
+    if (mask)
+      return i + FirstSetBit(mask);
+  }
+  for (; i < end; i++) {
+    const char ch = spec[i];
+    if (!((ch >= 'a' && ch <= 'z') || (ch >= '0' && ch <= '9') ||
+          ch == '-' || ch == '.'))
+      return i;
+  }
+  return end;
+}
+
+#else  // __SSE2__
+
+int FindFirstNonPlainChar(const char* spec, int begin, int end,
+                          const char* stops, int num_stops) {
+  return begin;
+}
+
+int FindFirstNonPlainHostChar(const char* spec, int begin, int end) {
+  return begin;
+}
+
+#endif  // __SSE2__
+
 bool ConvertUTF16ToUTF8(const base::char16* input, int input_len,
                         CanonOutput* output) {
   bool success = true;
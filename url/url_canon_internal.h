@@ -81,6 +81,29 @@ void AppendStringOfType(const base::char16* source, int length,
                         SharedCharTypes type,
                         CanonOutput* output);
 
+// Fast scanning of 8-bit input -----------------------------------------------
+//
+// Most URLs are already canonical, so the canonicalizers first look for a run
+// of characters which they would copy unchanged, append it in one go, and
+// only process the rest one character at a time. Where SSE2 is available,
+// these scan 16 characters at a time.
+//
+// Both return an index |i| such that all the characters in [|begin|, |i|) are
+// plain, which may be before the first character which is not, so callers
+// must still handle the rest of the input themselves. On platforms without a
+// vectorized implementation, they just return |begin|.
+
+// Plain characters are printable ASCII characters (0x21 to 0x7e) other than
+// the |num_stops| characters in |stops|, of which there can be at most
+// kMaxStopChars.
+const int kMaxStopChars = 16;
+int FindFirstNonPlainChar(const char* spec, int begin, int end,
+                          const char* stops, int num_stops);
+
+// Plain characters are the ones which are canonical in a host name and need
+// no validation: lower case ASCII letters, digits, '-' and '.'.
+int FindFirstNonPlainHostChar(const char* spec, int begin, int end);
+
 // Maps the hex numerical values 0x0 to 0xf to the corresponding ASCII digit
 // that will be used to represent it.
 URL_EXPORT extern const char kHexCharLookup[0x10];
@@ -2,6 +2,9 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <string.h>
+
+#include "base/basictypes.h"
 #include "base/logging.h"
 #include "url/url_canon.h"
 #include "url/url_canon_internal.h"
@@ -75,6 +78,41 @@ const unsigned char kPathCharLookup[0x100] = {
      ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,
      ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE,  ESCAPE};
 
+// The printable ASCII characters which have the SPECIAL flag in
+// kPathCharLookup, except for the dot. Runs of other printable characters are
+// copied as is.
+const char kPathStopChars[] = "\"#%<>?\\^`{|}";
+
+// Appends the characters of |spec| from |begin| which DoPartialPath would copy
+// unchanged, and returns the index of the first one which was not appended.
+int AppendPlainPathChars(const char* spec, int begin, int end,
+                         CanonOutput* output) {
+  int plain_end = FindFirstNonPlainChar(spec, begin, end, kPathStopChars,
+                                        arraysize(kPathStopChars) - 1);
+
+  // Dots are common in file names, and only need handling when they may start
+  // a directory name, so stop at those only.
+  const char* dot = static_cast<const char*>(
+      memchr(&spec[begin], '.', plain_end - begin));
+  while (dot) {
+    int i = static_cast<int>(dot - spec);
+    if (i == begin || spec[i - 1] == '/') {
+      plain_end = i;
+      break;
+    }
+    dot = static_cast<const char*>(memchr(dot + 1, '.', plain_end - i - 1));
+  }
+
+  output->Append(&spec[begin], plain_end - begin);
+  return plain_end;
+}
+
+// Wide input is always processed one character at a time.
+int AppendPlainPathChars(const base::char16* spec, int begin, int end,
+                         CanonOutput* output) {
+  return begin;
+}
+
 enum DotDisposition {
   // The given dot is just part of a filename and is not special.
   NOT_A_DIRECTORY,
@@ -184,6 +222,10 @@ bool DoPartialPath(const CHAR* spec,
 
   bool success = true;
   for (int i = path.begin; i < end; i++) {
+    i = AppendPlainPathChars(spec, i, end, output);
+    if (i == end)
+      break;
+
     UCHAR uch = static_cast<UCHAR>(spec[i]);
     if (sizeof(CHAR) > sizeof(char) && uch >= 0x80) {
       // We only need to test wide input for having non-ASCII characters. For
@@ -2,6 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include "base/basictypes.h"
 #include "url/url_canon.h"
 #include "url/url_canon_internal.h"
 
@@ -51,6 +52,26 @@ bool IsAllASCII(const CHAR* spec, const url_parse::Component& query) {
   return true;
 }
 
+// The printable ASCII characters which are not query characters.
+const char kQueryStopChars[] = "\"#<>";
+
+// Appends the characters of |source| from |begin| which need no escaping in a
+// query, and returns the index of the first one which was not appended.
+int AppendPlainQueryChars(const char* source, int begin, int length,
+                          CanonOutput* output) {
+  int plain_end = FindFirstNonPlainChar(source, begin, length,
+                                        kQueryStopChars,
+                                        arraysize(kQueryStopChars) - 1);
+  output->Append(&source[begin], plain_end - begin);
+  return plain_end;
+}
+
+// Wide input is always processed one character at a time.
+int AppendPlainQueryChars(const base::char16* source, int begin, int length,
+                          CanonOutput* output) {
+  return begin;
+}
+
 // Appends the given string to the output, escaping characters that do not
 // match the given |type| in SharedCharTypes. This version will accept 8 or 16
 // bit characters, but assumes that they have only 7-bit values. It also assumes
@@ -59,6 +80,10 @@ template<typename CHAR>
 void AppendRaw8BitQueryString(const CHAR* source, int length,
                               CanonOutput* output) {
   for (int i = 0; i < length; i++) {
+    i = AppendPlainQueryChars(source, i, length, output);
+    if (i == length)
+      break;
+
     if (!IsQueryChar(static_cast<unsigned char>(source[i])))
       AppendEscapedChar(static_cast<unsigned char>(source[i]), output);
     else  // Doesn't need escaping.
@@ -369,6 +369,9 @@ TEST(URLCanonTest, Host) {
   IPAddressCase host_cases[] = {
        // Basic canonicalization, uppercase should be converted to lowercase.
     {"GoOgLe.CoM", L"GoOgLe.CoM", "google.com", url_parse::Component(0, 10), CanonHostInfo::NEUTRAL, -1, ""},
+      // Long hosts are scanned in blocks; check characters past the first one.
+    {"www.example-0123456789.com", L"www.example-0123456789.com", "www.example-0123456789.com", url_parse::Component(0, 26), CanonHostInfo::NEUTRAL, -1, ""},
+    {"www.example-0123456789.CoM", L"www.example-0123456789.CoM", "www.example-0123456789.com", url_parse::Component(0, 26), CanonHostInfo::NEUTRAL, -1, ""},
       // Spaces and some other characters should be escaped.
     {"Goo%20 goo%7C|.com", L"Goo%20 goo%7C|.com", "goo%20%20goo%7C%7C.com", url_parse::Component(0, 22), CanonHostInfo::NEUTRAL, -1, ""},
       // Exciting different types of spaces!
@@ -1020,6 +1023,14 @@ TEST(URLCanonTest, Path) {
       // UTF-16 input, so this doesn't happen on 8-bit.
     {"/\xef\xb7\x90zyx", NULL, "/%EF%B7%90zyx", url_parse::Component(0, 13), true},
     {NULL, L"/\xfdd0zyx", "/%EF%BF%BDzyx", url_parse::Component(0, 13), false},
+
+    // ----- long inputs, which are copied in blocks when possible -----
+    {"/abcdefghijklmnopqrstuvwxyz0123456789-_~", L"/abcdefghijklmnopqrstuvwxyz0123456789-_~", "/abcdefghijklmnopqrstuvwxyz0123456789-_~", url_parse::Component(0, 40), true},
+    {"/abcdefghijklmnopqrstuvwxyz/./0123456789abcdef/../g%41h", L"/abcdefghijklmnopqrstuvwxyz/./0123456789abcdef/../g%41h", "/abcdefghijklmnopqrstuvwxyz/gAh", url_parse::Component(0, 31), true},
+    {"/abcdefghijklmnop\x91qrstuvwxyz#", NULL, "/abcdefghijklmnop%91qrstuvwxyz%23", url_parse::Component(0, 33), true},
+      // Dots in file names are copied, dots starting directory names are not.
+    {"/abcdefghijklmnopqrstuvwxyz/app-1.2.min.js/./x", L"/abcdefghijklmnopqrstuvwxyz/app-1.2.min.js/./x", "/abcdefghijklmnopqrstuvwxyz/app-1.2.min.js/x", url_parse::Component(0, 44), true},
+    {"/abcdefghijklmnopqrstuvwxyz/.hidden", L"/abcdefghijklmnopqrstuvwxyz/.hidden", "/abcdefghijklmnopqrstuvwxyz/.hidden", url_parse::Component(0, 35), true},
   };
 
   for (size_t i = 0; i < arraysize(path_cases); i++) {
@@ -1107,6 +1118,8 @@ TEST(URLCanonTest, Query) {
     {"q=<asdf>", L"q=<asdf>", NULL, "?q=%3Casdf%3E"},
       // Escape double quotemarks in the query.
     {"q=\"asdf\"", L"q=\"asdf\"", NULL, "?q=%22asdf%22"},
+      // Long queries are copied in blocks up to the first character to escape.
+    {"abcdefghijklmnopqrstuvwxyz=0123456789&x<y>", L"abcdefghijklmnopqrstuvwxyz=0123456789&x<y>", NULL, "?abcdefghijklmnopqrstuvwxyz=0123456789&x%3Cy%3E"},
   };
 
   for (size_t i = 0; i < ARRAYSIZE(query_cases); i++) {